@@ -505,6 +505,12 @@ public:
     // arrays handle all of the references for you.
     uInt nrefs() const;
 
+    // Does the underlying storage belong to the Array? It is False if the
+    // Array was created with StorageInitPolicy SHARE, thus if the storage is
+    // owned by someone else. Only if True, the storage can be kept alive by
+    // keeping a reference to the Array.
+    Bool ownsStorage() const;
+
     // Check to see if the Array is consistent. This is about the same thing
     // as checking for invariants. If AIPS_DEBUG is defined, this is invoked
     // after construction and on entry to most member functions.
@@ -822,6 +822,11 @@ template<class T> uInt Array<T>::nrefs() const
     return data_p.nrefs();
 }
 
+template<class T> Bool Array<T>::ownsStorage() const
+{
+    return data_p->isOwner();
+}
+
 // This is relatively expensive
 template<class T> Bool Array<T>::ok() const
 {
@@ -32,6 +32,7 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/BasicMath/Functors.h>
 #include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArraySIMD.h>
 //# Needed to get the proper Complex typedef's
 #include <casacore/casa/BasicSL/Complex.h>
 #include <casacore/casa/Utilities/Assert.h>
@@ -198,6 +199,9 @@ inline void checkArrayShapes (const ArrayBase& left, const ArrayBase& right,
 // They are modeled after std::transform.
 // They do not check if the shapes conform; as in std::transform the
 // user must take care that the operands conform.
+// If the arrays are contiguous, the SIMD kernels in
+// <linkto class=ArraySIMD>ArraySIMD</linkto> are used for the operators
+// and data types supported by them.
 // <group>
 // Transform left and right to a result using the binary operator.
 // Result MUST be a contiguous array.
@@ -207,8 +211,11 @@ inline void arrayContTransform (const Array<L>& left, const Array<R>& right,
 {
   DebugAssert (result.contiguousStorage(), AipsError);
   if (left.contiguousStorage()  &&  right.contiguousStorage()) {
-    std::transform (left.cbegin(), left.cend(), right.cbegin(),
-                    result.cbegin(), op);
+    if (! arraySimdTransform (left.data(), right.data(), result.data(),
+                              result.nelements(), op)) {
+      std::transform (left.cbegin(), left.cend(), right.cbegin(),
+                      result.cbegin(), op);
+    }
   } else {
     std::transform (left.begin(), left.end(), right.begin(),
                     result.cbegin(), op);
@@ -223,8 +230,11 @@ inline void arrayContTransform (const Array<L>& left, R right,
 {
   DebugAssert (result.contiguousStorage(), AipsError);
   if (left.contiguousStorage()) {
-    myrtransform (left.cbegin(), left.cend(),
-                 result.cbegin(), right, op);
+    if (! arraySimdTransformRight (left.data(), right, result.data(),
+                                   result.nelements(), op)) {
+      myrtransform (left.cbegin(), left.cend(),
+                    result.cbegin(), right, op);
+    }
     ////    std::transform (left.cbegin(), left.cend(),
     ////                    result.cbegin(), bind2nd(op, right));
   } else {
@@ -243,8 +253,11 @@ inline void arrayContTransform (L left, const Array<R>& right,
 {
   DebugAssert (result.contiguousStorage(), AipsError);
   if (right.contiguousStorage()) {
-    myltransform (right.cbegin(), right.cend(),
-                  result.cbegin(), left, op);
+    if (! arraySimdTransformLeft (left, right.data(), result.data(),
+                                  result.nelements(), op)) {
+      myltransform (right.cbegin(), right.cend(),
+                    result.cbegin(), left, op);
+    }
     ////    std::transform (right.cbegin(), right.cend(),
     ////                    result.cbegin(), bind1st(op, left));
   } else {
@@ -263,7 +276,10 @@ inline void arrayContTransform (const Array<T>& arr,
 {
   DebugAssert (result.contiguousStorage(), AipsError);
   if (arr.contiguousStorage()) {
-    std::transform (arr.cbegin(), arr.cend(), result.cbegin(), op);
+    if (! arraySimdTransform (arr.data(), result.data(),
+                              result.nelements(), op)) {
+      std::transform (arr.cbegin(), arr.cend(), result.cbegin(), op);
+    }
   } else {
     std::transform (arr.begin(), arr.end(), result.cbegin(), op);
   }
@@ -321,7 +337,10 @@ inline void arrayTransformInPlace (Array<L>& left, const Array<R>& right,
                                    BinaryOperator op)
 {
   if (left.contiguousStorage()  &&  right.contiguousStorage()) {
-    transformInPlace (left.cbegin(), left.cend(), right.cbegin(), op);
+    if (! arraySimdTransform (left.data(), right.data(), left.data(),
+                              left.nelements(), op)) {
+      transformInPlace (left.cbegin(), left.cend(), right.cbegin(), op);
+    }
   } else {
     transformInPlace (left.begin(), left.end(), right.begin(), op);
   }
@@ -333,7 +352,10 @@ template<typename L, typename R, typename BinaryOperator>
 inline void arrayTransformInPlace (Array<L>& left, R right, BinaryOperator op)
 {
   if (left.contiguousStorage()) {
-    myiptransform (left.cbegin(), left.cend(), right, op);
+    if (! arraySimdTransformRight (left.data(), right, left.data(),
+                                   left.nelements(), op)) {
+      myiptransform (left.cbegin(), left.cend(), right, op);
+    }
     ////    transformInPlace (left.cbegin(), left.cend(), bind2nd(op, right));
   } else {
     myiptransform (left.begin(), left.end(), right, op);
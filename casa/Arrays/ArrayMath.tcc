@@ -759,13 +759,15 @@ template<class T> void minMax(T &minVal, T &maxVal, const Array<T> &array)
   T minv = array.data()[0];
   T maxv = minv;
   if (array.contiguousStorage()) {
-    typename Array<T>::const_contiter iterEnd = array.cend();
-    for (typename Array<T>::const_contiter iter = array.cbegin();
-         iter!=iterEnd; ++iter) {
-      if (*iter < minv) {
-        minv = *iter;
-      } else if (*iter > maxv) {
-        maxv = *iter;
+    if (! ArraySIMD::minMax (minv, maxv, array.data(), array.nelements())) {
+      typename Array<T>::const_contiter iterEnd = array.cend();
+      for (typename Array<T>::const_contiter iter = array.cbegin();
+           iter!=iterEnd; ++iter) {
+        if (*iter < minv) {
+          minv = *iter;
+        } else if (*iter > maxv) {
+          maxv = *iter;
+        }
       }
     }
   } else {
@@ -1041,9 +1043,14 @@ template<class T> Array<T> fmod(const Array<T> &a, const T &b)
 // </thrown>
 template<class T> T sum(const Array<T> &a)
 {
-  return a.contiguousStorage() ?
-    std::accumulate(a.cbegin(), a.cend(), T(), std::plus<T>()) :
-    std::accumulate(a.begin(),  a.end(),  T(), std::plus<T>());
+  if (a.contiguousStorage()) {
+    T result;
+    if (ArraySIMD::sum (result, a.data(), a.nelements())) {
+      return result;
+    }
+    return std::accumulate(a.cbegin(), a.cend(), T(), std::plus<T>());
+  }
+  return std::accumulate(a.begin(),  a.end(),  T(), std::plus<T>());
 }
 
 // <thrown>
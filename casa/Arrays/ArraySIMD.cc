@@ -0,0 +1,356 @@
+//# ArraySIMD.cc: SIMD kernels for contiguous array math
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/Arrays/ArraySIMD.h>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+//# The kernels need the GCC vector extensions and target pragma on x86.
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) \
+    && __GNUC__ >= 5 && (defined(__x86_64__) || defined(__i386__))
+# define CASA_ARRAYSIMD 1
+# include <immintrin.h>
+#endif
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+#ifdef CASA_ARRAYSIMD
+
+#pragma GCC push_options
+#pragma GCC target ("sse2")
+namespace arraysimd_sse2 {
+#define CASA_SIMD_NBYTES 16
+#include <casacore/casa/Arrays/ArraySIMDKernels.h>
+#undef CASA_SIMD_NBYTES
+  inline VD vsqrt (VD v)
+    { return (VD)_mm_sqrt_pd ((__m128d)v); }
+  inline VD loadFloats (const Float* p)
+  {
+    __m128 f = _mm_setzero_ps();
+    memcpy (&f, p, 2*sizeof(Float));
+    return (VD)_mm_cvtps_pd (f);
+  }
+  inline void storeFloats (Float* p, VD v)
+  {
+    __m128 f = _mm_cvtpd_ps ((__m128d)v);
+    memcpy (p, &f, 2*sizeof(Float));
+  }
+}
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target ("avx2")
+namespace arraysimd_avx2 {
+#define CASA_SIMD_NBYTES 32
+#include <casacore/casa/Arrays/ArraySIMDKernels.h>
+#undef CASA_SIMD_NBYTES
+  inline VD vsqrt (VD v)
+    { return (VD)_mm256_sqrt_pd ((__m256d)v); }
+  inline VD loadFloats (const Float* p)
+  {
+    return (VD)_mm256_cvtps_pd (_mm_loadu_ps (p));
+  }
+  inline void storeFloats (Float* p, VD v)
+  {
+    _mm_storeu_ps (p, _mm256_cvtpd_ps ((__m256d)v));
+  }
+}
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target ("avx512f")
+namespace arraysimd_avx512 {
+#define CASA_SIMD_NBYTES 64
+#include <casacore/casa/Arrays/ArraySIMDKernels.h>
+#undef CASA_SIMD_NBYTES
+  // The zero-masked intrinsics are used (with all lanes enabled), because
+  // the plain ones use an undefined source vector, which makes GCC warn
+  // about a possibly uninitialized value.
+  inline VD vsqrt (VD v)
+    { return (VD)_mm512_maskz_sqrt_pd (0xff, (__m512d)v); }
+  inline VD loadFloats (const Float* p)
+  {
+    return (VD)_mm512_maskz_cvtps_pd (0xff, _mm256_loadu_ps (p));
+  }
+  inline void storeFloats (Float* p, VD v)
+  {
+    _mm256_storeu_ps (p, _mm512_maskz_cvtpd_ps (0xff, (__m512d)v));
+  }
+}
+#pragma GCC pop_options
+
+// Call the kernel for the level in use.
+#define ARRAYSIMD_DISPATCH(CALL) \
+  switch (itsLevel) { \
+  case AVX512: \
+    return arraysimd_avx512::CALL; \
+  case AVX2: \
+    return arraysimd_avx2::CALL; \
+  case SSE2: \
+    return arraysimd_sse2::CALL; \
+  default: \
+    break; \
+  } \
+  return False
+
+#else
+
+// Without SIMD support no kernel can be used. The dummy kernels below have
+// unnamed parameters, so the arguments are not reported as unused.
+namespace arraysimd_none {
+  template<typename T1, typename T2, typename T3>
+  inline Bool abs (const T1&, const T2&, const T3&)
+    { return False; }
+  template<typename T1, typename T2, typename T3>
+  inline Bool amplitude (const T1&, const T2&, const T3&)
+    { return False; }
+  template<typename T1, typename T2, typename T3, typename T4>
+  inline Bool sum (const T1&, const T2&, const T3&, const T4&)
+    { return False; }
+  template<typename T1, typename T2, typename T3, typename T4>
+  inline Bool sumsquares (const T1&, const T2&, const T3&, const T4&)
+    { return False; }
+  template<typename T1, typename T2, typename T3, typename T4, typename T5>
+  inline Bool minMax (const T1&, const T2&, const T3&, const T4&, const T5&)
+    { return False; }
+  template<typename T1, typename T2, typename T3, typename T4, typename T5>
+  inline Bool transform (const T1&, const T2&, const T3&, const T4&,
+                         const T5&)
+    { return False; }
+  template<typename T1, typename T2, typename T3, typename T4, typename T5>
+  inline Bool transformLeft (const T1&, const T2&, const T3&, const T4&,
+                             const T5&)
+    { return False; }
+  template<typename T1, typename T2, typename T3, typename T4, typename T5>
+  inline Bool transformRight (const T1&, const T2&, const T3&, const T4&,
+                              const T5&)
+    { return False; }
+}
+
+#define ARRAYSIMD_DISPATCH(CALL) \
+  return arraysimd_none::CALL
+
+#endif
+
+
+  // The level is set at startup; before that it is None, so the kernels
+  // are not used during static initialization.
+  ArraySIMD::Level ArraySIMD::itsLevel = ArraySIMD::maxLevel();
+
+  ArraySIMD::Level ArraySIMD::maxLevel()
+  {
+#ifdef CASA_ARRAYSIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports ("avx512f")) {
+      return AVX512;
+    }
+    if (__builtin_cpu_supports ("avx2")) {
+      return AVX2;
+    }
+    if (__builtin_cpu_supports ("sse2")) {
+      return SSE2;
+    }
+#endif
+    return None;
+  }
+
+  ArraySIMD::Level ArraySIMD::setLevel (Level level)
+  {
+    Level maxl = maxLevel();
+    itsLevel = (level > maxl ? maxl : level);
+    return itsLevel;
+  }
+
+  const char* ArraySIMD::levelName (Level level)
+  {
+    switch (level) {
+    case SSE2:
+      return "SSE2";
+    case AVX2:
+      return "AVX2";
+    case AVX512:
+      return "AVX512";
+    default:
+      break;
+    }
+    return "None";
+  }
+
+
+  Bool ArraySIMD::transform (Operator op, const Float* left,
+                             const Float* right, Float* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transform (op, left, right, result, n));
+  }
+  Bool ArraySIMD::transform (Operator op, const Double* left,
+                             const Double* right, Double* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transform (op, left, right, result, n));
+  }
+  Bool ArraySIMD::transform (Operator op, const Complex* left,
+                             const Complex* right, Complex* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transform (op, left, right, result, n));
+  }
+  Bool ArraySIMD::transform (Operator op, const DComplex* left,
+                             const DComplex* right, DComplex* result,
+                             size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transform (op, left, right, result, n));
+  }
+
+  Bool ArraySIMD::transformRight (Operator op, const Float* left, Float right,
+                                  Float* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transformRight (op, left, right, result, n));
+  }
+  Bool ArraySIMD::transformRight (Operator op, const Double* left,
+                                  Double right, Double* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transformRight (op, left, right, result, n));
+  }
+  Bool ArraySIMD::transformRight (Operator op, const Complex* left,
+                                  Complex right, Complex* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transformRight (op, left, right, result, n));
+  }
+  Bool ArraySIMD::transformRight (Operator op, const DComplex* left,
+                                  DComplex right, DComplex* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transformRight (op, left, right, result, n));
+  }
+
+  Bool ArraySIMD::transformLeft (Operator op, Float left, const Float* right,
+                                 Float* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transformLeft (op, left, right, result, n));
+  }
+  Bool ArraySIMD::transformLeft (Operator op, Double left,
+                                 const Double* right, Double* result,
+                                 size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transformLeft (op, left, right, result, n));
+  }
+  Bool ArraySIMD::transformLeft (Operator op, Complex left,
+                                 const Complex* right, Complex* result,
+                                 size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transformLeft (op, left, right, result, n));
+  }
+  Bool ArraySIMD::transformLeft (Operator op, DComplex left,
+                                 const DComplex* right, DComplex* result,
+                                 size_t n)
+  {
+    ARRAYSIMD_DISPATCH (transformLeft (op, left, right, result, n));
+  }
+
+  Bool ArraySIMD::abs (const Float* in, Float* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (abs (in, result, n));
+  }
+  Bool ArraySIMD::abs (const Double* in, Double* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (abs (in, result, n));
+  }
+
+  Bool ArraySIMD::amplitude (const Complex* in, Float* result, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (amplitude (in, result, n));
+  }
+
+  Bool ArraySIMD::sum (Float& result, const Float* in, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sum (result, in, 0, n));
+  }
+  Bool ArraySIMD::sum (Double& result, const Double* in, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sum (result, in, 0, n));
+  }
+  Bool ArraySIMD::sum (Complex& result, const Complex* in, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sum (result, in, 0, n));
+  }
+  Bool ArraySIMD::sum (DComplex& result, const DComplex* in, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sum (result, in, 0, n));
+  }
+
+  Bool ArraySIMD::sum (Float& result, const Float* in, const Bool* mask,
+                       size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sum (result, in, mask, n));
+  }
+  Bool ArraySIMD::sum (Double& result, const Double* in, const Bool* mask,
+                       size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sum (result, in, mask, n));
+  }
+  Bool ArraySIMD::sum (Complex& result, const Complex* in, const Bool* mask,
+                       size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sum (result, in, mask, n));
+  }
+  Bool ArraySIMD::sum (DComplex& result, const DComplex* in,
+                       const Bool* mask, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sum (result, in, mask, n));
+  }
+
+  Bool ArraySIMD::sumsquares (Float& result, const Float* in,
+                              const Bool* mask, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sumsquares (result, in, mask, n));
+  }
+  Bool ArraySIMD::sumsquares (Double& result, const Double* in,
+                              const Bool* mask, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (sumsquares (result, in, mask, n));
+  }
+
+  Bool ArraySIMD::minMax (Float& minv, Float& maxv, const Float* in,
+                          size_t n)
+  {
+    ARRAYSIMD_DISPATCH (minMax (minv, maxv, in, 0, n));
+  }
+  Bool ArraySIMD::minMax (Double& minv, Double& maxv, const Double* in,
+                          size_t n)
+  {
+    ARRAYSIMD_DISPATCH (minMax (minv, maxv, in, 0, n));
+  }
+  Bool ArraySIMD::minMax (Float& minv, Float& maxv, const Float* in,
+                          const Bool* mask, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (minMax (minv, maxv, in, mask, n));
+  }
+  Bool ArraySIMD::minMax (Double& minv, Double& maxv, const Double* in,
+                          const Bool* mask, size_t n)
+  {
+    ARRAYSIMD_DISPATCH (minMax (minv, maxv, in, mask, n));
+  }
+
+} //# NAMESPACE CASACORE - END
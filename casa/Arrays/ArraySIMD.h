@@ -0,0 +1,329 @@
+//# ArraySIMD.h: SIMD kernels for contiguous array math
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_ARRAYSIMD_H
+#define CASA_ARRAYSIMD_H
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/BasicMath/Functors.h>
+#include <functional>
+#include <cstddef>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// SIMD kernels for contiguous array math
+// </summary>
+//
+// <use visibility=local>
+//
+// <reviewed reviewer="" date="" tests="tArraySIMD.cc" demos="">
+// </reviewed>
+//
+// <synopsis>
+// ArrayMath and MaskArrMath use these kernels for the basic arithmetic
+// operators and some reductions if the arrays are contiguous and of type
+// Float, Double, Complex or DComplex. The kernels process multiple values
+// per instruction using the SSE2, AVX2 or AVX-512 instruction set. At
+// startup the best instruction set supported by the CPU is selected, but
+// another level can be set (e.g. to compare the performance).
+//
+// Each kernel returns False if it does nothing, which is the case if
+// the level is None, the data type or operator is not supported, or
+// the kernels are not available on the platform (they need GCC on x86).
+// The caller then uses its generic code. Hence each kernel has a template
+// version returning False for the data types not supported.
+//
+// The results are the same as those of the generic code, except that:
+// <ul>
+//  <li> The sums are done in another order, thus can differ a bit due to
+//       rounding.
+//  <li> The complex multiplication does not do the C99 Annex G recovery
+//       of infinite results if the result is NaN.
+// </ul>
+// The output array of an element-wise operation can be the same as
+// an input array, but should not partially overlap.
+// </synopsis>
+//
+// <example>
+// <srcblock>
+//   // Use the generic code to compare the performance.
+//   ArraySIMD::Level level = ArraySIMD::level();
+//   ArraySIMD::setLevel (ArraySIMD::None);
+//   Timer timer;
+//   Float s = sum(arr);
+//   timer.show ("generic");
+//   ArraySIMD::setLevel (level);
+// </srcblock>
+// </example>
+
+class ArraySIMD
+{
+public:
+  // The instruction set used.
+  enum Level {
+    None=0,
+    SSE2,
+    AVX2,
+    AVX512
+  };
+
+  // The supported binary operators.
+  enum Operator {
+    PLUS,
+    MINUS,
+    TIMES,
+    DIVIDE
+  };
+
+  // Get the level in use.
+  static Level level()
+    { return itsLevel; }
+
+  // Get the highest level supported by the CPU.
+  static Level maxLevel();
+
+  // Set the level to use. It is limited to the highest level supported.
+  // It returns the level set.
+  static Level setLevel (Level level);
+
+  // Get the name of a level.
+  static const char* levelName (Level level);
+
+  // Apply the operator to two arrays of n elements.
+  // Division is only supported for Float and Double.
+  // <group>
+  template<typename L, typename R, typename RES>
+  static Bool transform (Operator, const L*, const R*, RES*, size_t)
+    { return False; }
+  static Bool transform (Operator, const Float* left, const Float* right,
+                         Float* result, size_t n);
+  static Bool transform (Operator, const Double* left, const Double* right,
+                         Double* result, size_t n);
+  static Bool transform (Operator, const Complex* left, const Complex* right,
+                         Complex* result, size_t n);
+  static Bool transform (Operator, const DComplex* left,
+                         const DComplex* right, DComplex* result, size_t n);
+  // </group>
+
+  // Apply the operator to an array and a scalar right operand.
+  // <group>
+  template<typename L, typename R, typename RES>
+  static Bool transformRight (Operator, const L*, R, RES*, size_t)
+    { return False; }
+  static Bool transformRight (Operator, const Float* left, Float right,
+                              Float* result, size_t n);
+  static Bool transformRight (Operator, const Double* left, Double right,
+                              Double* result, size_t n);
+  static Bool transformRight (Operator, const Complex* left, Complex right,
+                              Complex* result, size_t n);
+  static Bool transformRight (Operator, const DComplex* left, DComplex right,
+                              DComplex* result, size_t n);
+  // </group>
+
+  // Apply the operator to a scalar left operand and an array.
+  // <group>
+  template<typename L, typename R, typename RES>
+  static Bool transformLeft (Operator, L, const R*, RES*, size_t)
+    { return False; }
+  static Bool transformLeft (Operator, Float left, const Float* right,
+                             Float* result, size_t n);
+  static Bool transformLeft (Operator, Double left, const Double* right,
+                             Double* result, size_t n);
+  static Bool transformLeft (Operator, Complex left, const Complex* right,
+                             Complex* result, size_t n);
+  static Bool transformLeft (Operator, DComplex left, const DComplex* right,
+                             DComplex* result, size_t n);
+  // </group>
+
+  // Get the absolute values.
+  // <group>
+  template<typename T, typename RES>
+  static Bool abs (const T*, RES*, size_t)
+    { return False; }
+  static Bool abs (const Float* in, Float* result, size_t n);
+  static Bool abs (const Double* in, Double* result, size_t n);
+  // </group>
+
+  // Get the amplitudes of Complex values. They are calculated in double
+  // precision as <src>sqrt(re*re + im*im)</src>, which cannot overflow or
+  // underflow for Float values.
+  // <br>There is no kernel for DComplex, because in double precision
+  // <src>re*re</src> overflows for values above about 1e154 (and underflows
+  // below about 1e-162), where <src>std::abs</src> does not. So for DComplex
+  // False is returned and the generic code is used.
+  // <group>
+  template<typename T, typename RES>
+  static Bool amplitude (const T*, RES*, size_t)
+    { return False; }
+  static Bool amplitude (const Complex* in, Float* result, size_t n);
+  // </group>
+
+  // Get the sum of the values.
+  // <group>
+  template<typename T>
+  static Bool sum (T&, const T*, size_t)
+    { return False; }
+  static Bool sum (Float& result, const Float* in, size_t n);
+  static Bool sum (Double& result, const Double* in, size_t n);
+  static Bool sum (Complex& result, const Complex* in, size_t n);
+  static Bool sum (DComplex& result, const DComplex* in, size_t n);
+  // </group>
+
+  // Get the sum of the values having a True mask.
+  // <group>
+  template<typename T>
+  static Bool sum (T&, const T*, const Bool*, size_t)
+    { return False; }
+  static Bool sum (Float& result, const Float* in, const Bool* mask,
+                   size_t n);
+  static Bool sum (Double& result, const Double* in, const Bool* mask,
+                   size_t n);
+  static Bool sum (Complex& result, const Complex* in, const Bool* mask,
+                   size_t n);
+  static Bool sum (DComplex& result, const DComplex* in, const Bool* mask,
+                   size_t n);
+  // </group>
+
+  // Get the sum of the squared values having a True mask.
+  // <group>
+  template<typename T>
+  static Bool sumsquares (T&, const T*, const Bool*, size_t)
+    { return False; }
+  static Bool sumsquares (Float& result, const Float* in, const Bool* mask,
+                          size_t n);
+  static Bool sumsquares (Double& result, const Double* in, const Bool* mask,
+                          size_t n);
+  // </group>
+
+  // Update the minimum and maximum with the values (having a True mask).
+  // Like the generic code, NaN values are ignored unless the initial
+  // minimum or maximum is NaN.
+  // <group>
+  template<typename T>
+  static Bool minMax (T&, T&, const T*, size_t)
+    { return False; }
+  static Bool minMax (Float& minv, Float& maxv, const Float* in, size_t n);
+  static Bool minMax (Double& minv, Double& maxv, const Double* in,
+                      size_t n);
+  template<typename T>
+  static Bool minMax (T&, T&, const T*, const Bool*, size_t)
+    { return False; }
+  static Bool minMax (Float& minv, Float& maxv, const Float* in,
+                      const Bool* mask, size_t n);
+  static Bool minMax (Double& minv, Double& maxv, const Double* in,
+                      const Bool* mask, size_t n);
+  // </group>
+
+private:
+  static Level itsLevel;
+};
+
+
+// <summary>
+// Map a binary functor to an ArraySIMD operator
+// </summary>
+// <synopsis>
+// Only the std functors for the basic arithmetic operators are mapped.
+// </synopsis>
+// <group>
+template<typename OP> struct ArraySimdOperator
+{
+  enum {valid = 0, oper = ArraySIMD::PLUS};
+};
+template<typename T> struct ArraySimdOperator<std::plus<T> >
+{
+  enum {valid = 1, oper = ArraySIMD::PLUS};
+};
+template<typename T> struct ArraySimdOperator<std::minus<T> >
+{
+  enum {valid = 1, oper = ArraySIMD::MINUS};
+};
+template<typename T> struct ArraySimdOperator<std::multiplies<T> >
+{
+  enum {valid = 1, oper = ArraySIMD::TIMES};
+};
+template<typename T> struct ArraySimdOperator<std::divides<T> >
+{
+  enum {valid = 1, oper = ArraySIMD::DIVIDE};
+};
+// </group>
+
+// Apply a binary or unary functor using the SIMD kernels if possible.
+// They return False if not possible.
+// <group>
+template<typename L, typename R, typename RES, typename OP>
+inline Bool arraySimdTransform (const L* left, const R* right, RES* result,
+                                size_t n, OP)
+{
+  return ArraySimdOperator<OP>::valid  &&
+    ArraySIMD::transform (ArraySIMD::Operator(ArraySimdOperator<OP>::oper),
+                          left, right, result, n);
+}
+template<typename L, typename R, typename RES, typename OP>
+inline Bool arraySimdTransformRight (const L* left, R right, RES* result,
+                                     size_t n, OP)
+{
+  return ArraySimdOperator<OP>::valid  &&
+    ArraySIMD::transformRight (ArraySIMD::Operator(ArraySimdOperator<OP>::oper),
+                               left, right, result, n);
+}
+template<typename L, typename R, typename RES, typename OP>
+inline Bool arraySimdTransformLeft (L left, const R* right, RES* result,
+                                    size_t n, OP)
+{
+  return ArraySimdOperator<OP>::valid  &&
+    ArraySIMD::transformLeft (ArraySIMD::Operator(ArraySimdOperator<OP>::oper),
+                              left, right, result, n);
+}
+template<typename T, typename RES, typename OP>
+inline Bool arraySimdTransform (const T*, RES*, size_t, OP)
+{
+  return False;
+}
+inline Bool arraySimdTransform (const Float* in, Float* result, size_t n,
+                                Abs<Float>)
+{
+  return ArraySIMD::abs (in, result, n);
+}
+inline Bool arraySimdTransform (const Double* in, Double* result, size_t n,
+                                Abs<Double>)
+{
+  return ArraySIMD::abs (in, result, n);
+}
+inline Bool arraySimdTransform (const Complex* in, Float* result, size_t n,
+                                CAbs<Complex,Float>)
+{
+  return ArraySIMD::amplitude (in, result, n);
+}
+// </group>
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,640 @@
+//# ArraySIMDKernels.h: SIMD kernels for a single instruction set
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# This file is not installed. It is included by ArraySIMD.cc in a
+//# separate namespace for each instruction set, which is enabled using
+//# the GCC target pragma. The kernels are written using the GCC vector
+//# extensions, so the compiler generates the instructions of that set.
+//# Before including, CASA_SIMD_NBYTES has to be defined as the vector
+//# size in bytes. After including, the functions vsqrt, loadFloats and
+//# storeFloats have to be defined using the intrinsics of the set.
+
+  // The vector types.
+  typedef Float  VF  __attribute__((vector_size(CASA_SIMD_NBYTES)));
+  typedef Double VD  __attribute__((vector_size(CASA_SIMD_NBYTES)));
+  typedef Int    VIF __attribute__((vector_size(CASA_SIMD_NBYTES)));
+  typedef Int64  VID __attribute__((vector_size(CASA_SIMD_NBYTES)));
+
+  // Square root of the lanes.
+  inline VD vsqrt (VD v);
+  // Load a VD from Floats, or store a VD in Floats.
+  inline VD loadFloats (const Float* p);
+  inline void storeFloats (Float* p, VD v);
+
+  template<typename T> struct Vec;
+  template<> struct Vec<Float>
+  {
+    typedef VF  V;
+    typedef VIF VI;
+  };
+  template<> struct Vec<Double>
+  {
+    typedef VD  V;
+    typedef VID VI;
+  };
+
+  // Unaligned load and store.
+  template<typename V, typename T>
+  inline V vload (const T* p)
+  {
+    V v;
+    memcpy (&v, p, sizeof(V));
+    return v;
+  }
+  template<typename V, typename T>
+  inline void vstore (T* p, V v)
+  {
+    memcpy (p, &v, sizeof(V));
+  }
+
+  // A vector with the values alternating (as in a complex number).
+  template<typename V, typename T>
+  inline V vpair (T v0, T v1)
+  {
+    V v = V();
+    for (size_t k=0; k<sizeof(V)/sizeof(T); k+=2) {
+      v[k]   = v0;
+      v[k+1] = v1;
+    }
+    return v;
+  }
+
+  // Select the lanes of a where the mask is set, otherwise of b.
+  template<typename V, typename VI>
+  inline V vselect (VI mask, V a, V b)
+  {
+    return (V)((mask & (VI)a) | (~mask & (VI)b));
+  }
+
+  // Make a lane mask from Bools. Each Bool is used for 2**SHIFT lanes.
+  // If possible, the Bools (having value 0 or 1) are converted to
+  // lanes of type VM at once.
+  template<typename VI, typename VM, int N>
+  inline VI vmaskConvert (const Bool* mask)
+  {
+#if __GNUC__ >= 9
+    typedef unsigned char VB __attribute__((vector_size(N)));
+    VB b;
+    memcpy (&b, mask, N);
+    return (VI)(-__builtin_convertvector (b, VM));
+#else
+    VM m = VM();
+    for (int k=0; k<N; ++k) {
+      m[k] = mask[k] ? -1 : 0;
+    }
+    return (VI)m;
+#endif
+  }
+  template<int SHIFT, typename VI>
+  inline VI vmask (const Bool* mask);
+  template<>
+  inline VIF vmask<0,VIF> (const Bool* mask)
+    { return vmaskConvert<VIF, VIF, sizeof(VIF)/sizeof(Int)> (mask); }
+  template<>
+  inline VID vmask<0,VID> (const Bool* mask)
+    { return vmaskConvert<VID, VID, sizeof(VID)/sizeof(Int64)> (mask); }
+  template<>
+  inline VIF vmask<1,VIF> (const Bool* mask)
+    { return vmaskConvert<VIF, VID, sizeof(VID)/sizeof(Int64)> (mask); }
+  template<>
+  inline VID vmask<1,VID> (const Bool* mask)
+  {
+    const int N = sizeof(VID)/sizeof(Int64);
+    VID m = VID();
+#if __GNUC__ >= 9
+    // Convert the N/2 Bools and duplicate each lane.
+    typedef unsigned char VB __attribute__((vector_size(N)));
+    VB b = VB();
+    memcpy (&b, mask, N/2);
+    VID index;
+    for (int k=0; k<N; ++k) {
+      index[k] = k>>1;
+    }
+    m = __builtin_shuffle (-__builtin_convertvector (b, VID), index);
+#else
+    for (int k=0; k<N; ++k) {
+      m[k] = mask[k>>1] ? -1 : 0;
+    }
+#endif
+    return m;
+  }
+
+  // Shuffle masks for complex numbers for the given number of lanes.
+  // <group>
+  template<typename VI, int N> struct Shuffle;
+  template<typename VI> struct Shuffle<VI,2>
+  {
+    static VI swap()  { VI m = {1,0}; return m; }
+    static VI real()  { VI m = {0,0}; return m; }
+    static VI imag()  { VI m = {1,1}; return m; }
+    static VI evens() { VI m = {0,2}; return m; }
+    static VI odds()  { VI m = {1,3}; return m; }
+  };
+  template<typename VI> struct Shuffle<VI,4>
+  {
+    static VI swap()  { VI m = {1,0,3,2}; return m; }
+    static VI real()  { VI m = {0,0,2,2}; return m; }
+    static VI imag()  { VI m = {1,1,3,3}; return m; }
+    static VI evens() { VI m = {0,2,4,6}; return m; }
+    static VI odds()  { VI m = {1,3,5,7}; return m; }
+  };
+  template<typename VI> struct Shuffle<VI,8>
+  {
+    static VI swap()  { VI m = {1,0,3,2,5,4,7,6}; return m; }
+    static VI real()  { VI m = {0,0,2,2,4,4,6,6}; return m; }
+    static VI imag()  { VI m = {1,1,3,3,5,5,7,7}; return m; }
+    static VI evens() { VI m = {0,2,4,6,8,10,12,14}; return m; }
+    static VI odds()  { VI m = {1,3,5,7,9,11,13,15}; return m; }
+  };
+  template<typename VI> struct Shuffle<VI,16>
+  {
+    static VI swap()  { VI m = {1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14};
+                        return m; }
+    static VI real()  { VI m = {0,0,2,2,4,4,6,6,8,8,10,10,12,12,14,14};
+                        return m; }
+    static VI imag()  { VI m = {1,1,3,3,5,5,7,7,9,9,11,11,13,13,15,15};
+                        return m; }
+  };
+  // </group>
+
+  // The operators (for scalars and vectors).
+  // <group>
+  struct OpPlus
+  {
+    template<typename X> static X apply (X a, X b) { return a + b; }
+  };
+  struct OpMinus
+  {
+    template<typename X> static X apply (X a, X b) { return a - b; }
+  };
+  struct OpTimes
+  {
+    template<typename X> static X apply (X a, X b) { return a * b; }
+  };
+  struct OpDivide
+  {
+    template<typename X> static X apply (X a, X b) { return a / b; }
+  };
+  // </group>
+
+
+  // Element-wise operation on real values, where left and/or right are
+  // arrays (with step 1) or scalars (with step 0).
+  template<typename OP, size_t lstep, size_t rstep, typename T>
+  inline void realTransform (const T* l, const T* r, T* res, size_t n)
+  {
+    typedef typename Vec<T>::V V;
+    const size_t nl = sizeof(V) / sizeof(T);
+    // A scalar is only dereferenced if given (an array can be empty).
+    const V lscalar = V() + (lstep ? T() : *l);
+    const V rscalar = V() + (rstep ? T() : *r);
+    size_t i = 0;
+    for (; i+nl <= n; i+=nl) {
+      V lv = (lstep ? vload<V>(l+i) : lscalar);
+      V rv = (rstep ? vload<V>(r+i) : rscalar);
+      vstore (res+i, OP::apply (lv, rv));
+    }
+    for (; i<n; ++i) {
+      res[i] = OP::apply (l[i*lstep], r[i*rstep]);
+    }
+  }
+
+  // Complex addition or subtraction is done on the real and imaginary
+  // parts separately.
+  template<typename OP, size_t lstep, size_t rstep, typename T>
+  inline void complexTransform (const std::complex<T>* l,
+                                const std::complex<T>* r,
+                                std::complex<T>* res, size_t n)
+  {
+    typedef typename Vec<T>::V V;
+    const size_t nl = sizeof(V) / sizeof(T);
+    const T* lp = reinterpret_cast<const T*>(l);
+    const T* rp = reinterpret_cast<const T*>(r);
+    T* resp = reinterpret_cast<T*>(res);
+    const V lscalar = (lstep ? V() : vpair<V> (lp[0], lp[1]));
+    const V rscalar = (rstep ? V() : vpair<V> (rp[0], rp[1]));
+    const size_t n2 = 2*n;
+    size_t i = 0;
+    for (; i+nl <= n2; i+=nl) {
+      V lv = (lstep ? vload<V>(lp+i) : lscalar);
+      V rv = (rstep ? vload<V>(rp+i) : rscalar);
+      vstore (resp+i, OP::apply (lv, rv));
+    }
+    for (; i<n2; i+=2) {
+      resp[i]   = OP::apply (lp[i*lstep],   rp[i*rstep]);
+      resp[i+1] = OP::apply (lp[i*lstep+1], rp[i*rstep+1]);
+    }
+  }
+
+  // Complex multiplication (l may be an array or a scalar).
+  // (a,b)*(c,d) = (a*c - b*d, a*d + b*c) is calculated as
+  // (a,a)*(c,d) + (-1,1)*(b,b)*(d,c).
+  template<size_t lstep, typename T>
+  inline void complexTimes (const std::complex<T>* l,
+                            const std::complex<T>* r,
+                            std::complex<T>* res, size_t n)
+  {
+    typedef typename Vec<T>::V V;
+    typedef typename Vec<T>::VI VI;
+    typedef Shuffle<VI, sizeof(V)/sizeof(T)> Shuf;
+    const size_t nl = sizeof(V) / sizeof(T);
+    const T* lp = reinterpret_cast<const T*>(l);
+    const T* rp = reinterpret_cast<const T*>(r);
+    T* resp = reinterpret_cast<T*>(res);
+    const V sign = vpair<V> (T(-1), T(1));
+    const V lre  = V() + (lstep ? T() : lp[0]);
+    const V lim  = sign * (lstep ? T() : lp[1]);
+    const size_t n2 = 2*n;
+    size_t i = 0;
+    for (; i+nl <= n2; i+=nl) {
+      V rv = vload<V>(rp+i);
+      V rsw = __builtin_shuffle (rv, Shuf::swap());
+      if (lstep) {
+        V lv = vload<V>(lp+i);
+        vstore (resp+i, __builtin_shuffle (lv, Shuf::real()) * rv +
+                sign * __builtin_shuffle (lv, Shuf::imag()) * rsw);
+      } else {
+        vstore (resp+i, lre * rv + lim * rsw);
+      }
+    }
+    for (; i<n2; i+=2) {
+      T a = lp[i*lstep];
+      T b = lp[i*lstep+1];
+      T c = rp[i];
+      T d = rp[i+1];
+      resp[i]   = a*c - b*d;
+      resp[i+1] = a*d + b*c;
+    }
+  }
+
+  template<size_t lstep, size_t rstep, typename T>
+  inline Bool doRealTransform (ArraySIMD::Operator op,
+                               const T* l, const T* r, T* res, size_t n)
+  {
+    switch (op) {
+    case ArraySIMD::PLUS:
+      realTransform<OpPlus,lstep,rstep> (l, r, res, n);
+      break;
+    case ArraySIMD::MINUS:
+      realTransform<OpMinus,lstep,rstep> (l, r, res, n);
+      break;
+    case ArraySIMD::TIMES:
+      realTransform<OpTimes,lstep,rstep> (l, r, res, n);
+      break;
+    case ArraySIMD::DIVIDE:
+      realTransform<OpDivide,lstep,rstep> (l, r, res, n);
+      break;
+    }
+    return True;
+  }
+
+  template<size_t lstep, size_t rstep, typename T>
+  inline Bool doComplexTransform (ArraySIMD::Operator op,
+                                  const std::complex<T>* l,
+                                  const std::complex<T>* r,
+                                  std::complex<T>* res, size_t n)
+  {
+    switch (op) {
+    case ArraySIMD::PLUS:
+      complexTransform<OpPlus,lstep,rstep> (l, r, res, n);
+      return True;
+    case ArraySIMD::MINUS:
+      complexTransform<OpMinus,lstep,rstep> (l, r, res, n);
+      return True;
+    case ArraySIMD::TIMES:
+      // Multiplication is commutative, so a scalar can be on the left.
+      if (rstep) {
+        complexTimes<lstep> (l, r, res, n);
+      } else {
+        complexTimes<rstep> (r, l, res, n);
+      }
+      return True;
+    default:
+      break;
+    }
+    return False;
+  }
+
+
+  template<typename T>
+  inline void absolute (const T* in, T* res, size_t n)
+  {
+    typedef typename Vec<T>::V V;
+    typedef typename Vec<T>::VI VI;
+    const size_t nl = sizeof(V) / sizeof(T);
+    // Clear the sign bit (which is the only bit set in -0).
+    const VI signBit = (VI)(-(V() + T(0)));
+    size_t i = 0;
+    for (; i+nl <= n; i+=nl) {
+      vstore (res+i, (V)((VI)vload<V>(in+i) & ~signBit));
+    }
+    for (; i<n; ++i) {
+      res[i] = std::fabs (in[i]);
+    }
+  }
+
+  inline VD loadPart (const Double* p)
+    { return vload<VD> (p); }
+  inline VD loadPart (const Float* p)
+    { return loadFloats (p); }
+  inline void storePart (Double* p, VD v)
+    { vstore (p, v); }
+  inline void storePart (Float* p, VD v)
+    { storeFloats (p, v); }
+
+  // The amplitude is calculated in double precision, so it is only used
+  // for Complex (see ArraySIMD::amplitude).
+  template<typename T>
+  inline void amplitude (const std::complex<T>* in, T* res, size_t n)
+  {
+    typedef Shuffle<VID, sizeof(VD)/sizeof(Double)> Shuf;
+    const size_t nd = sizeof(VD) / sizeof(Double);
+    const T* p = reinterpret_cast<const T*>(in);
+    size_t i = 0;
+    for (; i+nd <= n; i+=nd) {
+      VD a = loadPart (p + 2*i);
+      VD b = loadPart (p + 2*i + nd);
+      VD re = __builtin_shuffle (a, b, Shuf::evens());
+      VD im = __builtin_shuffle (a, b, Shuf::odds());
+      storePart (res+i, vsqrt (re*re + im*im));
+    }
+    for (; i<n; ++i) {
+      Double re = in[i].real();
+      Double im = in[i].imag();
+      res[i] = T(std::sqrt (re*re + im*im));
+    }
+  }
+
+
+  // Sum the vectors in p, thus the first n/nl*nl values.
+  // The number of values summed is returned in nsum.
+  template<typename T>
+  inline typename Vec<T>::V vsum (const T* p, size_t n, size_t& nsum)
+  {
+    typedef typename Vec<T>::V V;
+    const size_t nl = sizeof(V) / sizeof(T);
+    // Use multiple accumulators to hide the latency of the addition.
+    V s0 = V();
+    V s1 = V();
+    V s2 = V();
+    V s3 = V();
+    size_t i = 0;
+    for (; i+4*nl <= n; i+=4*nl) {
+      s0 += vload<V>(p+i);
+      s1 += vload<V>(p+i+nl);
+      s2 += vload<V>(p+i+2*nl);
+      s3 += vload<V>(p+i+3*nl);
+    }
+    for (; i+nl <= n; i+=nl) {
+      s0 += vload<V>(p+i);
+    }
+    nsum = i;
+    return (s0 + s1) + (s2 + s3);
+  }
+
+  // Sum (the squares of) the vectors in p having a True mask.
+  // Each mask value is used for 2**SHIFT values.
+  template<int SHIFT, bool SQUARE, typename T>
+  inline typename Vec<T>::V vsumMasked (const T* p, const Bool* mask,
+                                        size_t n, size_t& nsum)
+  {
+    typedef typename Vec<T>::V V;
+    typedef typename Vec<T>::VI VI;
+    const size_t nl = sizeof(V) / sizeof(T);
+    V s0 = V();
+    V s1 = V();
+    size_t i = 0;
+    for (; i+2*nl <= n; i+=2*nl) {
+      V v0 = vload<V>(p+i);
+      V v1 = vload<V>(p+i+nl);
+      if (SQUARE) {
+        v0 *= v0;
+        v1 *= v1;
+      }
+      s0 += (V)((VI)v0 & vmask<SHIFT,VI>(mask + (i>>SHIFT)));
+      s1 += (V)((VI)v1 & vmask<SHIFT,VI>(mask + ((i+nl)>>SHIFT)));
+    }
+    for (; i+nl <= n; i+=nl) {
+      V v0 = vload<V>(p+i);
+      if (SQUARE) {
+        v0 *= v0;
+      }
+      s0 += (V)((VI)v0 & vmask<SHIFT,VI>(mask + (i>>SHIFT)));
+    }
+    nsum = i;
+    return s0 + s1;
+  }
+
+  template<typename T>
+  inline void realSum (T& result, const T* in, const Bool* mask, size_t n)
+  {
+    typedef typename Vec<T>::V V;
+    const size_t nl = sizeof(V) / sizeof(T);
+    size_t i;
+    V s = (mask ? vsumMasked<0,false> (in, mask, n, i) : vsum (in, n, i));
+    T sum = 0;
+    for (size_t k=0; k<nl; ++k) {
+      sum += s[k];
+    }
+    for (; i<n; ++i) {
+      if (!mask || mask[i]) {
+        sum += in[i];
+      }
+    }
+    result = sum;
+  }
+
+  template<typename T>
+  inline void complexSum (std::complex<T>& result, const std::complex<T>* in,
+                          const Bool* mask, size_t n)
+  {
+    typedef typename Vec<T>::V V;
+    const size_t nl = sizeof(V) / sizeof(T);
+    const T* p = reinterpret_cast<const T*>(in);
+    size_t i;
+    V s = (mask ? vsumMasked<1,false> (p, mask, 2*n, i) : vsum (p, 2*n, i));
+    // The even lanes contain the real parts, the odd ones the imaginary.
+    T re = 0;
+    T im = 0;
+    for (size_t k=0; k<nl; k+=2) {
+      re += s[k];
+      im += s[k+1];
+    }
+    for (i/=2; i<n; ++i) {
+      if (!mask || mask[i]) {
+        re += in[i].real();
+        im += in[i].imag();
+      }
+    }
+    result = std::complex<T>(re, im);
+  }
+
+  template<typename T>
+  inline void sumSquares (T& result, const T* in, const Bool* mask, size_t n)
+  {
+    typedef typename Vec<T>::V V;
+    const size_t nl = sizeof(V) / sizeof(T);
+    size_t i;
+    V s = vsumMasked<0,true> (in, mask, n, i);
+    T sum = 0;
+    for (size_t k=0; k<nl; ++k) {
+      sum += s[k];
+    }
+    for (; i<n; ++i) {
+      if (mask[i]) {
+        sum += in[i] * in[i];
+      }
+    }
+    result = sum;
+  }
+
+  // Update the minimum and maximum. Like the generic code, a NaN value
+  // is ignored because the comparisons are False. Therefore values with
+  // a False mask are replaced by NaN.
+  // The expression (a < b ? a : b) results in a single min instruction.
+  template<typename T>
+  inline void minMax (T& minv, T& maxv, const T* in, const Bool* mask,
+                      size_t n)
+  {
+    typedef typename Vec<T>::V V;
+    typedef typename Vec<T>::VI VI;
+    const size_t nl = sizeof(V) / sizeof(T);
+    const V nanv = V() + std::numeric_limits<T>::quiet_NaN();
+    // Use two accumulators to hide the latency.
+    V vmin0 = V() + minv;
+    V vmax0 = V() + maxv;
+    V vmin1 = vmin0;
+    V vmax1 = vmax0;
+    size_t i = 0;
+    for (; i+2*nl <= n; i+=2*nl) {
+      V v0 = vload<V>(in+i);
+      V v1 = vload<V>(in+i+nl);
+      if (mask) {
+        v0 = vselect (vmask<0,VI>(mask+i), v0, nanv);
+        v1 = vselect (vmask<0,VI>(mask+i+nl), v1, nanv);
+      }
+      vmin0 = (v0 < vmin0 ? v0 : vmin0);
+      vmax0 = (v0 > vmax0 ? v0 : vmax0);
+      vmin1 = (v1 < vmin1 ? v1 : vmin1);
+      vmax1 = (v1 > vmax1 ? v1 : vmax1);
+    }
+    for (; i+nl <= n; i+=nl) {
+      V v0 = vload<V>(in+i);
+      if (mask) {
+        v0 = vselect (vmask<0,VI>(mask+i), v0, nanv);
+      }
+      vmin0 = (v0 < vmin0 ? v0 : vmin0);
+      vmax0 = (v0 > vmax0 ? v0 : vmax0);
+    }
+    for (size_t k=0; k<nl; ++k) {
+      if (vmin0[k] < minv) minv = vmin0[k];
+      if (vmin1[k] < minv) minv = vmin1[k];
+      if (vmax0[k] > maxv) maxv = vmax0[k];
+      if (vmax1[k] > maxv) maxv = vmax1[k];
+    }
+    for (; i<n; ++i) {
+      if (!mask || mask[i]) {
+        if (in[i] < minv) minv = in[i];
+        if (in[i] > maxv) maxv = in[i];
+      }
+    }
+  }
+
+
+  // The functions called by ArraySIMD.
+  // <group>
+  Bool transform (ArraySIMD::Operator op, const Float* l, const Float* r,
+                  Float* res, size_t n)
+    { return doRealTransform<1,1> (op, l, r, res, n); }
+  Bool transform (ArraySIMD::Operator op, const Double* l, const Double* r,
+                  Double* res, size_t n)
+    { return doRealTransform<1,1> (op, l, r, res, n); }
+  Bool transform (ArraySIMD::Operator op, const Complex* l, const Complex* r,
+                  Complex* res, size_t n)
+    { return doComplexTransform<1,1> (op, l, r, res, n); }
+  Bool transform (ArraySIMD::Operator op, const DComplex* l,
+                  const DComplex* r, DComplex* res, size_t n)
+    { return doComplexTransform<1,1> (op, l, r, res, n); }
+
+  Bool transformRight (ArraySIMD::Operator op, const Float* l, Float r,
+                       Float* res, size_t n)
+    { return doRealTransform<1,0> (op, l, &r, res, n); }
+  Bool transformRight (ArraySIMD::Operator op, const Double* l, Double r,
+                       Double* res, size_t n)
+    { return doRealTransform<1,0> (op, l, &r, res, n); }
+  Bool transformRight (ArraySIMD::Operator op, const Complex* l, Complex r,
+                       Complex* res, size_t n)
+    { return doComplexTransform<1,0> (op, l, &r, res, n); }
+  Bool transformRight (ArraySIMD::Operator op, const DComplex* l, DComplex r,
+                       DComplex* res, size_t n)
+    { return doComplexTransform<1,0> (op, l, &r, res, n); }
+
+  Bool transformLeft (ArraySIMD::Operator op, Float l, const Float* r,
+                      Float* res, size_t n)
+    { return doRealTransform<0,1> (op, &l, r, res, n); }
+  Bool transformLeft (ArraySIMD::Operator op, Double l, const Double* r,
+                      Double* res, size_t n)
+    { return doRealTransform<0,1> (op, &l, r, res, n); }
+  Bool transformLeft (ArraySIMD::Operator op, Complex l, const Complex* r,
+                      Complex* res, size_t n)
+    { return doComplexTransform<0,1> (op, &l, r, res, n); }
+  Bool transformLeft (ArraySIMD::Operator op, DComplex l, const DComplex* r,
+                      DComplex* res, size_t n)
+    { return doComplexTransform<0,1> (op, &l, r, res, n); }
+
+  Bool abs (const Float* in, Float* res, size_t n)
+    { absolute (in, res, n); return True; }
+  Bool abs (const Double* in, Double* res, size_t n)
+    { absolute (in, res, n); return True; }
+
+  Bool amplitude (const Complex* in, Float* res, size_t n)
+    { amplitude<Float> (in, res, n); return True; }
+
+  Bool sum (Float& result, const Float* in, const Bool* mask, size_t n)
+    { realSum (result, in, mask, n); return True; }
+  Bool sum (Double& result, const Double* in, const Bool* mask, size_t n)
+    { realSum (result, in, mask, n); return True; }
+  Bool sum (Complex& result, const Complex* in, const Bool* mask, size_t n)
+    { complexSum (result, in, mask, n); return True; }
+  Bool sum (DComplex& result, const DComplex* in, const Bool* mask,
+            size_t n)
+    { complexSum (result, in, mask, n); return True; }
+
+  Bool sumsquares (Float& result, const Float* in, const Bool* mask,
+                   size_t n)
+    { sumSquares (result, in, mask, n); return True; }
+  Bool sumsquares (Double& result, const Double* in, const Bool* mask,
+                   size_t n)
+    { sumSquares (result, in, mask, n); return True; }
+
+  Bool minMax (Float& minv, Float& maxv, const Float* in, const Bool* mask,
+               size_t n)
+    { minMax<Float> (minv, maxv, in, mask, n); return True; }
+  Bool minMax (Double& minv, Double& maxv, const Double* in,
+               const Bool* mask, size_t n)
+    { minMax<Double> (minv, maxv, in, mask, n); return True; }
+  // </group>
@@ -33,6 +33,7 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/ArrayError.h>
+#include <casacore/casa/Arrays/ArraySIMD.h>
 #include <casacore/casa/Arrays/ArrayIter.h>
 #include <casacore/casa/Arrays/VectorIter.h>
 #include <casacore/casa/Utilities/GenSort.h>
@@ -1028,14 +1029,21 @@ template<class T> T FUNC (const MaskedArray<T> &left) \
                          "MaskedArray must have at least 1 element")); \
     } \
 \
-    while (ntotal--) { \
-        if (*leftmaskS) { \
-            if (*leftarrS OP result) { \
-                result = *leftarrS; \
+    T minv = result; \
+    T maxv = result; \
+    if (ArraySIMD::minMax (minv, maxv, leftarrS, leftmaskS, ntotal)) { \
+        /* Take the min or max depending on OP. */ \
+        result = (minv OP maxv  ?  minv : maxv); \
+    } else { \
+        while (ntotal--) { \
+            if (*leftmaskS) { \
+                if (*leftarrS OP result) { \
+                    result = *leftarrS; \
+                } \
             } \
+            leftarrS++; \
+            leftmaskS++; \
         } \
-        leftarrS++; \
-        leftmaskS++; \
     } \
 \
     left.freeArrayStorage(leftarrStorage, leftarrDelete); \
@@ -1349,12 +1357,14 @@ template<class T> T sum(const MaskedArray<T> &left)
 
     T sum = 0;
     uInt ntotal = left.nelements();
-    while (ntotal--) {
-        if (*leftmaskS) {
-            sum += *leftarrS;
+    if (! ArraySIMD::sum (sum, leftarrS, leftmaskS, ntotal)) {
+        while (ntotal--) {
+            if (*leftmaskS) {
+                sum += *leftarrS;
+            }
+            leftarrS++;
+            leftmaskS++;
         }
-        leftarrS++;
-        leftmaskS++;
     }
 
     left.freeArrayStorage(leftarrStorage, leftarrDelete);
@@ -1381,12 +1391,14 @@ template<class T> T sumsquares(const MaskedArray<T> &left)
 
     T sumsquares = 0;
     uInt ntotal = left.nelements();
-    while (ntotal--) {
-        if (*leftmaskS) {
-            sumsquares += (*leftarrS * *leftarrS);
+    if (! ArraySIMD::sumsquares (sumsquares, leftarrS, leftmaskS, ntotal)) {
+        while (ntotal--) {
+            if (*leftmaskS) {
+                sumsquares += (*leftarrS * *leftarrS);
+            }
+            leftarrS++;
+            leftmaskS++;
         }
-        leftarrS++;
-        leftmaskS++;
     }
 
     left.freeArrayStorage(leftarrStorage, leftarrDelete);
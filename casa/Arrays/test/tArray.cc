@@ -986,6 +986,7 @@ int main()
 	  }
 	  Array<Int> ai2(shape, ip, COPY);
 	  AlwaysAssertExit(allEQ(ai2, ai));
+	  AlwaysAssertExit(!ai.ownsStorage() && ai2.ownsStorage());
 	  ai2 = 11;
 	  AlwaysAssertExit(ip[0] == 0 && ip[99] == 99 && 
 			   ai(IPosition(2,4,19)) == 99 && allEQ(ai2, 11));
@@ -0,0 +1,266 @@
+//# tArraySIMD.cc: Test the SIMD kernels used by ArrayMath and MaskArrMath
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/Arrays/ArraySIMD.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayIO.h>
+#include <casacore/casa/Arrays/MaskArrMath.h>
+#include <casacore/casa/Arrays/MaskedArray.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <iostream>
+#include <vector>
+
+using namespace casacore;
+using namespace std;
+
+// The results of the kernels are compared with those of the generic code
+// (level None) for all levels supported by the CPU. The values are small
+// multiples of 0.25, so the results of the arithmetic and sums are exact.
+// The array sizes test the remainders of the vector loops.
+
+Float value (uInt i)
+{
+  return Float((i*7) % 11) - 5 + 0.25*(i%4);
+}
+
+template<typename T> void makeValue (T& v, uInt i)
+  { v = value(i); }
+template<typename T> void makeValue (std::complex<T>& v, uInt i)
+  { v = std::complex<T> (value(i), value(i+5)); }
+
+template<typename T>
+Vector<T> makeArray (uInt n, uInt offset)
+{
+  Vector<T> arr(n);
+  for (uInt i=0; i<n; ++i) {
+    makeValue (arr[i], i+offset);
+  }
+  return arr;
+}
+
+// Do the element-wise operations supported for all types.
+template<typename T>
+vector<Array<T> > doOperators (const Array<T>& a, const Array<T>& b, T s)
+{
+  vector<Array<T> > res;
+  res.push_back (a + b);
+  res.push_back (a - b);
+  res.push_back (a * b);
+  res.push_back (a + s);
+  res.push_back (s + a);
+  res.push_back (a - s);
+  res.push_back (s - a);
+  res.push_back (a * s);
+  res.push_back (s * a);
+  Array<T> c(a.copy());
+  c += b;
+  res.push_back (c.copy());
+  c -= s;
+  res.push_back (c.copy());
+  c *= b;
+  res.push_back (c.copy());
+  c *= s;
+  res.push_back (c.copy());
+  // A non-contiguous array uses the generic code.
+  Array<T> d(a.copy());
+  if (d.nelements() > 1) {
+    Vector<T> vd(d);
+    Vector<T> vb(b);
+    Vector<T> sub(vd(Slice(0, vd.nelements()/2, 2)));
+    sub += vb(Slice(0, vb.nelements()/2));
+  }
+  res.push_back (d);
+  return res;
+}
+
+// Do the operations supported for real types.
+template<typename T>
+vector<Array<T> > doRealOperators (const Array<T>& a, const Array<T>& b, T s)
+{
+  vector<Array<T> > res = doOperators (a, b, s);
+  res.push_back (a / b);
+  res.push_back (a / s);
+  res.push_back (s / b);
+  res.push_back (fabs(a));
+  res.push_back (abs(a));
+  Array<T> c(a.copy());
+  c /= b;
+  res.push_back (c.copy());
+  c /= s;
+  res.push_back (c.copy());
+  Vector<T> mm(8, T(0));
+  if (a.nelements() > 0) {
+    minMax (mm[0], mm[1], a);
+  }
+  LogicalArray mask(a.shape());
+  Vector<Bool> vmask(mask);
+  for (uInt i=0; i<vmask.nelements(); ++i) {
+    vmask[i] = (i%3 != 1);
+  }
+  MaskedArray<T> ma(a, mask);
+  if (ma.nelementsValid() > 0) {
+    mm[2] = min(ma);
+    mm[3] = max(ma);
+    mm[4] = sum(ma);
+    mm[5] = sumsquares(ma);
+  }
+  mm[6] = sum(a);
+  res.push_back (mm);
+  return res;
+}
+
+template<typename T>
+void compare (const vector<Array<T> >& res, const vector<Array<T> >& exp,
+              Double tol=0)
+{
+  AlwaysAssertExit (res.size() == exp.size());
+  for (uInt i=0; i<res.size(); ++i) {
+    if (! allNear (res[i], exp[i], tol)) {
+      cout << "Result " << i << " differs for "
+           << res[i].nelements() << " elements" << endl;
+      cout << res[i] << exp[i];
+      AlwaysAssertExit (False);
+    }
+  }
+}
+
+template<typename T>
+void testReal (ArraySIMD::Level level, uInt n)
+{
+  Vector<T> a = makeArray<T> (n, 0);
+  // Avoid division by zero.
+  Vector<T> b = fabs(makeArray<T> (n, 3)) + T(0.5);
+  T s(2.5);
+  ArraySIMD::setLevel (ArraySIMD::None);
+  vector<Array<T> > exp = doRealOperators<T> (a, b, s);
+  ArraySIMD::setLevel (level);
+  compare (doRealOperators<T> (a, b, s), exp);
+}
+
+template<typename T>
+void testComplex (ArraySIMD::Level level, uInt n)
+{
+  typedef typename T::value_type R;
+  Vector<T> a = makeArray<T> (n, 0);
+  Vector<T> b = makeArray<T> (n, 3);
+  T s(2.5, -1.25);
+  ArraySIMD::setLevel (ArraySIMD::None);
+  vector<Array<T> > exp = doOperators<T> (a, b, s);
+  Array<R> expAmpl = amplitude(a);
+  Vector<T> expSum(2);
+  expSum[0] = sum(a);
+  LogicalArray mask(a.shape());
+  mask = True;
+  if (n > 1) {
+    Vector<Bool> vmask(mask);
+    vmask(Slice(0, (n+1)/2, 2)) = False;
+    expSum[1] = sum(MaskedArray<T>(a, mask));
+  }
+  ArraySIMD::setLevel (level);
+  compare (doOperators<T> (a, b, s), exp);
+  // The amplitude is calculated in another way.
+  AlwaysAssertExit (allNear (amplitude(a), expAmpl, 1e-6));
+  Vector<T> resSum(2);
+  resSum[0] = sum(a);
+  if (n > 1) {
+    resSum[1] = sum(MaskedArray<T>(a, mask));
+  }
+  AlwaysAssertExit (allEQ (resSum, expSum));
+}
+
+// Like the generic code, NaN values are ignored by min and max.
+void testNaN (ArraySIMD::Level level)
+{
+  ArraySIMD::setLevel (level);
+  Vector<Float> a = makeArray<Float> (37, 0);
+  setNaN (a[20]);
+  Float minv, maxv;
+  minMax (minv, maxv, a);
+  AlwaysAssertExit (minv == -5  &&  maxv == 5.75);
+  LogicalArray mask(a.shape());
+  mask = True;
+  AlwaysAssertExit (min(a(mask)) == -5  &&  max(a(mask)) == 5.75);
+  // A NaN as the first value results in NaN.
+  setNaN (a[0]);
+  minMax (minv, maxv, a);
+  AlwaysAssertExit (isNaN(minv)  &&  isNaN(maxv));
+}
+
+// The amplitude must not overflow or underflow for large or small values.
+// For DComplex the generic code is used, thus it gives std::abs.
+void testAmplitudeRange (ArraySIMD::Level level)
+{
+  ArraySIMD::setLevel (level);
+  Vector<Complex> a(37);
+  Vector<DComplex> da(37);
+  for (uInt i=0; i<a.size(); ++i) {
+    Float f = (i%2 == 0 ? 3e30 : 3e-30);
+    a[i] = Complex(f, -f);
+    Double d = (i%2 == 0 ? 3e200 : 3e-200);
+    da[i] = DComplex(d, -d);
+  }
+  Vector<Float> ampl = amplitude(a);
+  Vector<Double> dampl = amplitude(da);
+  for (uInt i=0; i<a.size(); ++i) {
+    AlwaysAssertExit (near (ampl[i], std::abs(a[i]), 1e-6));
+    AlwaysAssertExit (dampl[i] == std::abs(da[i]));
+  }
+}
+
+int main()
+{
+  try {
+    cout << "Maximum level: " << ArraySIMD::levelName(ArraySIMD::maxLevel())
+         << endl;
+    uInt sizes[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33,
+                    63, 64, 65, 100, 1001};
+    for (Int lev=ArraySIMD::SSE2; lev<=ArraySIMD::maxLevel(); ++lev) {
+      ArraySIMD::Level level = ArraySIMD::Level(lev);
+      for (uInt i=0; i<sizeof(sizes)/sizeof(uInt); ++i) {
+        testReal<Float>      (level, sizes[i]);
+        testReal<Double>     (level, sizes[i]);
+        testComplex<Complex> (level, sizes[i]);
+        testComplex<DComplex>(level, sizes[i]);
+      }
+      testNaN (level);
+      testAmplitudeRange (level);
+    }
+    // The level cannot exceed the maximum supported.
+    AlwaysAssertExit (ArraySIMD::setLevel (ArraySIMD::AVX512) ==
+                      ArraySIMD::maxLevel());
+  } catch (AipsError& x) {
+    cout << "Unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
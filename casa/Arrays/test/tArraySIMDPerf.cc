@@ -0,0 +1,174 @@
+//# tArraySIMDPerf.cc: Performance of ArrayMath with and without SIMD kernels
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/Arrays/ArraySIMD.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/MaskArrMath.h>
+#include <casacore/casa/Arrays/MaskedArray.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/OS/PrecTimer.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+using namespace casacore;
+using namespace std;
+
+// Time each operator with the generic code (level None, which is the
+// implementation without the SIMD kernels) and with each SIMD level
+// supported by the CPU. The time in msec and the speedup are shown.
+// Optionally the array size and number of loops can be given as arguments.
+
+// Execute the expression nloop times for each level and show the timings.
+#define TIMEOP(NAME, EXPR) \
+  { \
+    cout << setw(12) << left << NAME << right; \
+    Double t0 = 0; \
+    for (Int lev=ArraySIMD::None; lev<=ArraySIMD::maxLevel(); ++lev) { \
+      ArraySIMD::setLevel (ArraySIMD::Level(lev)); \
+      PrecTimer timer; \
+      timer.start(); \
+      for (uInt j=0; j<nloop; ++j) { \
+        EXPR; \
+      } \
+      timer.stop(); \
+      Double t = timer.getReal(); \
+      if (lev == ArraySIMD::None) { \
+        t0 = t; \
+        cout << setw(10) << setprecision(4) << 1000*t; \
+      } else { \
+        cout << setw(10) << setprecision(4) << 1000*t \
+             << " (" << setw(5) << setprecision(3) << t0/max(t, 1e-9) \
+             << ')'; \
+      } \
+    } \
+    cout << endl; \
+  }
+
+void showHeader (const String& type)
+{
+  cout << endl << setw(12) << left << type << right;
+  for (Int lev=ArraySIMD::None; lev<=ArraySIMD::maxLevel(); ++lev) {
+    cout << setw(10) << ArraySIMD::levelName (ArraySIMD::Level(lev));
+    if (lev != ArraySIMD::None) {
+      cout << "        ";
+    }
+  }
+  cout << endl;
+}
+
+template<typename T>
+void timeReal (const String& type, uInt n, uInt nloop)
+{
+  Array<T> a(IPosition(1,n));
+  Array<T> b(IPosition(1,n));
+  indgen (a, T(-1), T(1e-4));
+  indgen (b, T(1), T(2e-4));
+  LogicalArray mask(a > T(0));
+  MaskedArray<T> ma(a, mask);
+  Array<T> res;
+  Array<T> c(a.copy());
+  // Use a factor near 1 to avoid overflow in the in-place loops.
+  T s(1.0001);
+  T v(0);
+  showHeader (type);
+  TIMEOP ("a+b",      res.reference (a+b));
+  TIMEOP ("a-b",      res.reference (a-b));
+  TIMEOP ("a*b",      res.reference (a*b));
+  TIMEOP ("a/b",      res.reference (a/b));
+  TIMEOP ("s-a",      res.reference (s-a));
+  TIMEOP ("a+=b",     c += b);
+  TIMEOP ("a*=s",     c *= s);
+  TIMEOP ("a/=s",     c /= s);
+  TIMEOP ("abs",      res.reference (abs(a)));
+  TIMEOP ("sum",      v += sum(a));
+  TIMEOP ("min/max",  v += max(a) - min(a));
+  TIMEOP ("msum",     v += sum(ma));
+  TIMEOP ("msumsq",   v += sumsquares(ma));
+  TIMEOP ("mmin/mmax", v += max(ma) - min(ma));
+  AlwaysAssertExit (v != 0);
+}
+
+template<typename T>
+void timeComplex (const String& type, uInt n, uInt nloop)
+{
+  typedef typename T::value_type R;
+  Array<R> re(IPosition(1,n));
+  Array<R> im(IPosition(1,n));
+  indgen (re, R(-1), R(1e-4));
+  indgen (im, R(1), R(-2e-4));
+  Array<T> a(makeComplex (re, im));
+  Array<T> b(makeComplex (im, re));
+  LogicalArray mask(re > R(0));
+  MaskedArray<T> ma(a, mask);
+  Array<T> res;
+  Array<R> rres;
+  Array<T> c(a.copy());
+  T s(0.6, 0.8);
+  T v(0);
+  showHeader (type);
+  TIMEOP ("a+b",       res.reference (a+b));
+  TIMEOP ("a-b",       res.reference (a-b));
+  TIMEOP ("a*b",       res.reference (a*b));
+  TIMEOP ("s-a",       res.reference (s-a));
+  TIMEOP ("a+=b",      c += b);
+  TIMEOP ("a*=s",      c *= s);
+  TIMEOP ("amplitude", rres.reference (amplitude(a)));
+  TIMEOP ("sum",       v += sum(a));
+  TIMEOP ("msum",      v += sum(ma));
+  AlwaysAssertExit (v != T(0));
+}
+
+int main (int argc, char* argv[])
+{
+  try {
+    uInt n = 100000;
+    uInt nloop = 100;
+    if (argc > 1) {
+      istringstream istr(argv[1]);
+      istr >> n;
+    }
+    if (argc > 2) {
+      istringstream istr(argv[2]);
+      istr >> nloop;
+    }
+    cout << "Time in msec for " << nloop << " loops on " << n
+         << " elements (speedup)" << endl;
+    ArraySIMD::Level level = ArraySIMD::level();
+    timeReal<Float>       ("Float",    n, nloop);
+    timeReal<Double>      ("Double",   n, nloop);
+    timeComplex<Complex>  ("Complex",  n, nloop);
+    timeComplex<DComplex> ("DComplex", n, nloop);
+    ArraySIMD::setLevel (level);
+  } catch (AipsError& x) {
+    cout << "Unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;
+}
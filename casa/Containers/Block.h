@@ -29,9 +29,11 @@
 #define CASA_BLOCK_H
 
 #include <casacore/casa/aips.h>
+#include <casacore/casa/Containers/BlockPool.h>
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <cstddef>                  // for ptrdiff_t
+#include <new>                      // for placement new
 
 //# For index checking
 #if defined(AIPS_ARRAY_INDEX_CHECK)
@@ -153,6 +155,11 @@ protected:
 //
 // If index checking is turned on, an out-of-bounds index will
 // generate an <src>indexError<uInt></src> exception.
+//
+// If the <linkto class=BlockPool>BlockPool</linkto> is enabled (globally or
+// by a BlockPoolScope in the current thread), the storage of a Block is
+// taken from the pool, which avoids malloc and free for short-lived
+// Blocks (e.g. temporary Arrays). Such storage is aligned on 64 bytes.
 // </synopsis>
 //
 // <example> 
@@ -179,14 +186,14 @@ template<class T> class Block: public BlockTrace
 public:
   // Create a zero-length Block. Note that any index into this Block
   // is an error.
-  Block() : npts(0), array(0), destroyPointer(True) {}
+  Block() : npts(0), array(0), destroyPointer(True), pooled(False) {}
   // Create a Block with the given number of points. The values in Block
   // are uninitialized. Note that indices range between 0 and n-1.
-  explicit Block(size_t n) : npts(n), array(n>0 ? new T[n] : 0), destroyPointer(True)
+  explicit Block(size_t n) : npts(n), array(allocStorage(n, pooled)), destroyPointer(True)
     { traceAlloc (array, npts); }
   // Create a Block of the given length, and initialize (via operator= for 
   // objects of type T) with the provided value.
-  Block(size_t n, T val) : npts(n), array(n > 0 ? new T[n] : 0), destroyPointer(True)
+  Block(size_t n, T val) : npts(n), array(allocStorage(n, pooled)), destroyPointer(True)
     { traceAlloc (array, npts);
       objset(array, val, npts);
     }
@@ -197,12 +204,13 @@ public:
   // the Block is destructed, otherwise the actual storage is not destroyed.
   // If true, <src>storagePointer</src> is set to <src>0</src>.
   Block(size_t n, T *&storagePointer, Bool takeOverStorage = True)
-    : npts(n), array(storagePointer), destroyPointer(takeOverStorage)
+    : npts(n), array(storagePointer), destroyPointer(takeOverStorage),
+      pooled(False)
     { if (destroyPointer) storagePointer = 0;}
 
   // Copy the other block into this one. Uses copy, not reference, semantics.
   Block(const Block<T> &other)
-    : npts(other.npts), array(npts > 0 ? new T[npts] : 0), destroyPointer(True)
+    : npts(other.npts), array(allocStorage(npts, pooled)), destroyPointer(True)
     { traceAlloc (array, npts);
       objcopy(array, other.array, npts);
     }
@@ -220,7 +228,7 @@ public:
   ~Block()
     { if (array && destroyPointer) {
         traceFree (array, npts);
-        delete [] array; array = 0;
+        freeStorage (array, npts, pooled); array = 0;
       }
     } 
 
@@ -247,7 +255,8 @@ public:
   // <group>
   void resize(size_t n, Bool forceSmaller=False, Bool copyElements=True) {
     if (!(n == npts || (n < npts && forceSmaller == False))) {
-      T *tp = n > 0 ? new T[n] : 0;
+      Bool tpPooled;
+      T *tp = allocStorage (n, tpPooled);
       traceAlloc (tp, n);
       if (copyElements) {
 	size_t nmin = npts < n ? npts : n;  // Don't copy too much!
@@ -255,11 +264,12 @@ public:
       };
       if (array && destroyPointer) { // delete...
         traceFree (array, npts);
-	delete [] array;
+	freeStorage (array, npts, pooled);
 	array = 0;
       };
       npts = n;
       destroyPointer = True;
+      pooled = tpPooled;
       array = tp;                       // ... and swap pointer
     };
   }
@@ -282,18 +292,20 @@ public:
 #endif
     }
     if (forceSmaller == True) {
-      T *tp = new T[npts - 1];
+      Bool tpPooled;
+      T *tp = allocStorage (npts - 1, tpPooled);
       traceAlloc (array, npts-1);
       objcopy(tp, array, whichOne);
       objcopy(tp+whichOne, array + whichOne + 1, npts - whichOne - 1);
       if (array && destroyPointer) {
         traceFree (array, npts);
-	delete [] array;
+	freeStorage (array, npts, pooled);
 	array = 0;
       };
       npts--;
       array = tp;
       destroyPointer = True;
+      pooled = tpPooled;
     } else objmove(array+whichOne, array + whichOne + 1, npts - whichOne - 1);
   }
   // </group>
@@ -306,12 +318,13 @@ public:
   void replaceStorage(size_t n, T *&storagePointer, Bool takeOverStorage=True) {
     if (array && destroyPointer) {
       traceFree (array, npts);
-      delete [] array;
+      freeStorage (array, npts, pooled);
       array = 0;
     };
     npts = n;
     array = storagePointer;
     destroyPointer = takeOverStorage;
+    pooled = False;
     if (destroyPointer) storagePointer = 0;
   };
 
@@ -380,6 +393,10 @@ public:
   // Is the block empty (i.e. no elements)?
   Bool empty() const {return npts == 0;}
 
+  // Does the block own its storage, i.e., will it be deleted upon
+  // destruction? It is False if the storage is shared with the creator.
+  Bool isOwner() const {return destroyPointer;}
+
   // Define the STL-style iterators.
   // It makes it possible to iterate through all data elements.
   // <srcblock>
@@ -428,12 +445,55 @@ public:
   }
 
  private:
+  // Allocate the storage for n elements, from the BlockPool if enabled.
+  // <src>isPooled</src> tells if the storage was taken from the pool.
+  static T* allocStorage (size_t n, Bool& isPooled)
+  {
+    isPooled = False;
+    if (n == 0) {
+      return 0;
+    }
+    if (! BlockPool::isEnabled()) {
+      return new T[n];
+    }
+    T* tp = static_cast<T*>(BlockPool::allocate (n*sizeof(T)));
+    size_t i = 0;
+    try {
+      for (; i<n; ++i) {
+        ::new (static_cast<void*>(tp+i)) T;
+      }
+    } catch (...) {
+      while (i > 0) {
+        tp[--i].~T();
+      }
+      BlockPool::deallocate (tp, n*sizeof(T));
+      throw;
+    }
+    isPooled = True;
+    return tp;
+  }
+
+  // Free the storage allocated by allocStorage.
+  static void freeStorage (T* tp, size_t n, Bool isPooled)
+  {
+    if (isPooled) {
+      for (size_t i=0; i<n; ++i) {
+        tp[i].~T();
+      }
+      BlockPool::deallocate (tp, n*sizeof(T));
+    } else {
+      delete [] tp;
+    }
+  }
+
   // The number of points in the vector
   size_t npts;
   // The actual storage
   T *array;
   // Can we delete the storage upon destruction?
   Bool destroyPointer;
+  // Was the storage taken from the BlockPool?
+  Bool pooled;
 };
 
 // <summary>
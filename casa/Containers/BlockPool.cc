@@ -0,0 +1,293 @@
+//# BlockPool.cc: Thread-local pool of memory chunks for Block storage
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/casa/Containers/BlockPool.h>
+#include <casacore/casa/OS/Mutex.h>
+#include <set>
+#include <new>
+#include <stdlib.h>
+#ifdef USE_THREADS
+#include <pthread.h>
+#endif
+#if __cplusplus >= 201103L
+#include <atomic>
+#endif
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  // Chunks up to 2**22 bytes (4 MB) are kept in the pool.
+  // The smallest chunk is 2**6 bytes (the alignment).
+  // Each power of 2 is divided in 4 size classes.
+  const uInt theMinLog2 = 6;
+  const uInt theMaxLog2 = 22;
+  const uInt theNrSizeClass = 1 + 4*(theMaxLog2 - theMinLog2);
+
+  // The pool of a thread. A free chunk contains the pointer to the
+  // next free chunk in its size class.
+  struct BlockPoolState
+  {
+    BlockPoolState()
+      : cached(0), scopeDepth(0), nalloc(0), nreused(0), nfree(0)
+    {
+      for (uInt i=0; i<theNrSizeClass; ++i) {
+        freeList[i] = 0;
+      }
+    }
+    void* freeList[theNrSizeClass];
+    size_t cached;
+    uInt   scopeDepth;
+    size_t nalloc;
+    size_t nreused;
+    size_t nfree;
+  };
+
+  // The global switch and the maximum pool size can be changed by any
+  // thread while others use them, so they are atomic.
+  // The pool of a thread is found using a thread-local pointer.
+#if __cplusplus >= 201103L
+  static std::atomic<bool>   theEnabled (false);
+  static std::atomic<size_t> theMaxCacheSize (64*1024*1024);
+  static thread_local BlockPoolState* theThreadState = 0;
+#else
+  static volatile Bool   theEnabled = False;
+  static volatile size_t theMaxCacheSize = 64*1024*1024;
+  static __thread BlockPoolState* theThreadState = 0;
+#endif
+
+  // The statistics of the pools of finished threads.
+  static BlockPool::Statistics theRetired = {0, 0, 0, 0};
+
+  // The pools of the active threads.
+  // Function statics are used, because Blocks can be created during
+  // static initialization.
+  static std::set<BlockPoolState*>& theStates()
+  {
+    static std::set<BlockPoolState*> states;
+    return states;
+  }
+  static Mutex& theStatesMutex()
+  {
+    static Mutex mutex;
+    return mutex;
+  }
+
+  // Free all chunks in the pool of a thread.
+  static void clearState (BlockPoolState& state)
+  {
+    for (uInt i=0; i<theNrSizeClass; ++i) {
+      void* ptr = state.freeList[i];
+      while (ptr) {
+        void* next = *static_cast<void**>(ptr);
+        free (ptr);
+        ptr = next;
+      }
+      state.freeList[i] = 0;
+    }
+    state.cached = 0;
+  }
+
+  static BlockPoolState* newState()
+  {
+    BlockPoolState* state = new BlockPoolState();
+    ScopedMutexLock lock(theStatesMutex());
+    theStates().insert (state);
+    return state;
+  }
+
+#ifdef USE_THREADS
+  // The pool of a thread is deleted when the thread ends.
+  static pthread_key_t  theStateKey;
+  static pthread_once_t theStateKeyOnce = PTHREAD_ONCE_INIT;
+
+  extern "C" {
+    static void deleteBlockPoolState (void* ptr)
+    {
+      BlockPoolState* state = static_cast<BlockPoolState*>(ptr);
+      clearState (*state);
+      {
+        ScopedMutexLock lock(theStatesMutex());
+        theRetired.nalloc  += state->nalloc;
+        theRetired.nreused += state->nreused;
+        theRetired.nfree   += state->nfree;
+        theStates().erase (state);
+      }
+      delete state;
+    }
+    static void makeBlockPoolStateKey()
+    {
+      pthread_key_create (&theStateKey, &deleteBlockPoolState);
+    }
+  }
+#endif
+
+  // Get the pool of this thread; create it if not existing yet.
+  static BlockPoolState& getState()
+  {
+    if (theThreadState == 0) {
+      theThreadState = newState();
+#ifdef USE_THREADS
+      pthread_once (&theStateKeyOnce, &makeBlockPoolStateKey);
+      pthread_setspecific (theStateKey, theThreadState);
+#endif
+    }
+    return *theThreadState;
+  }
+
+  // Get the size class of a chunk and the size of the chunks in it.
+  // Each power of 2 is divided in 4 size classes, so less than 25% of
+  // a chunk is unused. It returns theNrSizeClass if the chunk is too
+  // large for the pool.
+  inline uInt sizeClass (size_t nbytes, size_t& chunkSize)
+  {
+    if (nbytes <= (size_t(1) << theMinLog2)) {
+      chunkSize = size_t(1) << theMinLog2;
+      return 0;
+    }
+    if (nbytes > (size_t(1) << theMaxLog2)) {
+      chunkSize = nbytes;
+      return theNrSizeClass;
+    }
+    // Find k such that 2**k < nbytes <= 2**(k+1).
+    uInt k = theMinLog2;
+    while ((size_t(1) << (k+1)) < nbytes) {
+      ++k;
+    }
+    size_t base = size_t(1) << k;
+    size_t step = base >> 2;
+    size_t n = (nbytes - base + step - 1) / step;
+    chunkSize = base + n*step;
+    return 4*(k - theMinLog2) + n;
+  }
+
+
+  void BlockPool::setEnabled (Bool enable)
+  {
+    theEnabled = enable;
+    if (!enable) {
+      BlockPoolState& state = getState();
+      if (state.scopeDepth == 0) {
+        clearState (state);
+      }
+    }
+  }
+
+  Bool BlockPool::isEnabled()
+  {
+    // Do not create the pool of this thread if not needed.
+    return (theThreadState != 0  &&  theThreadState->scopeDepth > 0)  ||
+           theEnabled;
+  }
+
+  void BlockPool::setMaxCacheSize (size_t nbytes)
+  {
+    theMaxCacheSize = nbytes;
+  }
+
+  size_t BlockPool::maxCacheSize()
+  {
+    return theMaxCacheSize;
+  }
+
+  void* BlockPool::allocate (size_t nbytes)
+  {
+    BlockPoolState& state = getState();
+    state.nalloc++;
+    size_t chunkSize;
+    uInt cls = sizeClass (nbytes, chunkSize);
+    if (cls < theNrSizeClass) {
+      void* ptr = state.freeList[cls];
+      if (ptr) {
+        state.freeList[cls] = *static_cast<void**>(ptr);
+        state.cached -= chunkSize;
+        state.nreused++;
+        return ptr;
+      }
+    }
+    // Allocate the full chunk, so it can be reused for the size class.
+    void* ptr;
+    if (posix_memalign (&ptr, Alignment, chunkSize) != 0) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  void BlockPool::deallocate (void* ptr, size_t nbytes)
+  {
+    if (ptr == 0) {
+      return;
+    }
+    BlockPoolState& state = getState();
+    state.nfree++;
+    size_t chunkSize;
+    uInt cls = sizeClass (nbytes, chunkSize);
+    if (cls < theNrSizeClass  &&  (state.scopeDepth > 0 || theEnabled)) {
+      if (state.cached + chunkSize <= theMaxCacheSize) {
+        *static_cast<void**>(ptr) = state.freeList[cls];
+        state.freeList[cls] = ptr;
+        state.cached += chunkSize;
+        return;
+      }
+    }
+    free (ptr);
+  }
+
+  void BlockPool::clear()
+  {
+    clearState (getState());
+  }
+
+  BlockPool::Statistics BlockPool::statistics()
+  {
+    ScopedMutexLock lock(theStatesMutex());
+    Statistics stat = theRetired;
+    // The counters of other threads are read without locking them;
+    // that is good enough for statistics.
+    const std::set<BlockPoolState*>& states = theStates();
+    for (std::set<BlockPoolState*>::const_iterator iter=states.begin();
+         iter!=states.end(); ++iter) {
+      stat.nalloc  += (*iter)->nalloc;
+      stat.nreused += (*iter)->nreused;
+      stat.nfree   += (*iter)->nfree;
+      stat.ncached += (*iter)->cached;
+    }
+    return stat;
+  }
+
+  void BlockPool::enterScope()
+  {
+    getState().scopeDepth++;
+  }
+
+  void BlockPool::leaveScope()
+  {
+    BlockPoolState& state = getState();
+    if (--state.scopeDepth == 0  &&  !theEnabled) {
+      clearState (state);
+    }
+  }
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,183 @@
+//# BlockPool.h: Thread-local pool of memory chunks for Block storage
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_BLOCKPOOL_H
+#define CASA_BLOCKPOOL_H
+
+#include <casacore/casa/aips.h>
+#include <cstddef>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Thread-local pool of memory chunks for Block storage
+// </summary>
+//
+// <use visibility=export>
+//
+// <reviewed reviewer="" date="" tests="tBlockPool.cc" demos="">
+// </reviewed>
+//
+// <synopsis>
+// Expressions on arrays (e.g. in ArrayMath, LEL or TaQL) create many
+// short-lived temporary arrays, often with the same shape. Each of them
+// allocates and frees its storage, which can take a measurable fraction
+// of the time for small and medium sized arrays.
+// <br>If the pool is enabled, Block (thus Array) takes its storage from
+// BlockPool. Freed storage is kept in a pool per thread, so it can be
+// reused by the next allocation of the same size class in that thread
+// without calling malloc and free. Each power of 2 is divided in 4 size
+// classes (with a minimum of 64 bytes), so less than 25% of a chunk is
+// unused. Chunks larger than 4 MB are not kept in the pool, because for
+// them the cost of malloc is small compared to using the storage.
+// The total size of the chunks kept by a thread is limited (default 64 MB).
+// The storage is always aligned on 64 bytes, which is good for SIMD
+// instructions and avoids false sharing between threads.
+//
+// The pool can be enabled globally using <src>setEnabled</src> or for
+// the current thread only using an object of class
+// <linkto class=BlockPoolScope>BlockPoolScope</linkto>. Note that storage
+// allocated from the pool can be freed at any time in any thread.
+// Such storage is kept in the pool of the freeing thread if the pool is
+// enabled in that thread, otherwise it is freed.
+//
+// The statistics tell how many allocations have been done from the pool
+// and how many of them could reuse storage (thus avoided a malloc).
+// </synopsis>
+//
+// <example>
+// <srcblock>
+// {
+//   // Use the pool for all arrays created in this scope in this thread.
+//   BlockPoolScope poolScope;
+//   for (uInt i=0; i<n; ++i) {
+//     result += sin(arr[i]) * cos(arr[i]);  // temporaries reuse storage
+//   }
+// }
+// cout << BlockPool::statistics().nreused << endl;
+// </srcblock>
+// </example>
+
+class BlockPool
+{
+public:
+  // The alignment (in bytes) of the storage.
+  static const size_t Alignment = 64;
+
+  // The statistics of the pool (summed over all threads).
+  struct Statistics {
+    // Number of allocations done from the pool.
+    size_t nalloc;
+    // Number of allocations that reused a chunk in the pool.
+    size_t nreused;
+    // Number of chunks freed to the pool.
+    size_t nfree;
+    // Total size of the chunks currently kept in the pools.
+    size_t ncached;
+  };
+
+  // Enable or disable the pool for all threads.
+  // Disabling frees the chunks kept by the calling thread (unless a
+  // BlockPoolScope is active in it).
+  static void setEnabled (Bool enable);
+
+  // Is the pool enabled for the current thread (globally or by a scope)?
+  static Bool isEnabled();
+
+  // Get or set the maximum total size (in bytes) of the chunks kept by
+  // a single thread.
+  // <group>
+  static void setMaxCacheSize (size_t nbytes);
+  static size_t maxCacheSize();
+  // </group>
+
+  // Allocate storage of the given size, aligned on <src>Alignment</src>.
+  // It reuses a chunk in the pool of this thread if possible.
+  // A <src>std::bad_alloc</src> exception is thrown if out of memory.
+  static void* allocate (size_t nbytes);
+
+  // Free storage allocated with <src>allocate</src>. The size must be
+  // the size given at allocation. The storage is kept in the pool if
+  // the pool is enabled in this thread and the pool is not full.
+  static void deallocate (void* ptr, size_t nbytes);
+
+  // Free all chunks kept in the pool of the current thread.
+  static void clear();
+
+  // Get the statistics of the pools of all threads.
+  static Statistics statistics();
+
+private:
+  friend class BlockPoolScope;
+
+  // Enter or leave a scope in which the pool is enabled for this thread.
+  // Leaving the outermost scope frees the chunks kept by this thread,
+  // unless the pool is enabled globally.
+  // <group>
+  static void enterScope();
+  static void leaveScope();
+  // </group>
+};
+
+
+// <summary>
+// Enable the BlockPool in the current thread during the lifetime of the object
+// </summary>
+//
+// <use visibility=export>
+//
+// <reviewed reviewer="" date="" tests="tBlockPool.cc" demos="">
+// </reviewed>
+//
+// <synopsis>
+// Creating an object of this class enables the
+// <linkto class=BlockPool>BlockPool</linkto> for the storage of Blocks
+// (thus Arrays) created in the current thread. Its destructor disables
+// it again and frees the chunks kept in the pool (unless nested in another
+// scope or if the pool is enabled globally). Thus the memory kept by the
+// pool is bounded by the scope.
+// </synopsis>
+
+class BlockPoolScope
+{
+public:
+  BlockPoolScope()
+    { BlockPool::enterScope(); }
+  ~BlockPoolScope()
+    { BlockPool::leaveScope(); }
+private:
+  // Copying is not possible.
+  // <group>
+  BlockPoolScope (const BlockPoolScope&);
+  BlockPoolScope& operator= (const BlockPoolScope&);
+  // </group>
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,134 @@
+//# LRUCache.h: A small cache keeping the most recently used values
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_LRUCACHE_H
+#define CASA_LRUCACHE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <list>
+#include <map>
+#include <utility>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// A small cache keeping the most recently used values
+// </summary>
+//
+// <use visibility=export>
+//
+// <reviewed reviewer="" date="" tests="tLRUCache.cc" demos="">
+// </reviewed>
+//
+// <synopsis>
+// LRUCache maps keys to values like a <src>std::map</src>, but holds at
+// most <src>maxSize</src> entries. When a new entry is added to a full
+// cache, the least recently used entry is removed. An entry is used when
+// it is added or found by <src>find</src>.
+// <br>Finding, adding and removing an entry take logarithmic time. The key
+// type must have an <src>operator<</src>.
+// <p>
+// The class is not thread-safe. If a cache is shared by multiple threads,
+// the user has to synchronize the access (e.g. using a
+// <linkto class=Mutex>Mutex</linkto>).
+// </synopsis>
+//
+// <example>
+// <srcblock>
+// LRUCache<String, Int> cache(2);
+// cache.put ("a", 1);
+// cache.put ("b", 2);
+// cache.find ("a");          // "a" is now the most recently used
+// cache.put ("c", 3);        // removes "b"
+// </srcblock>
+// </example>
+//
+// <templating arg=K>
+// <li> copy constructor
+// <li> operator<
+// </templating>
+// <templating arg=V>
+// <li> copy constructor
+// <li> assignment operator
+// </templating>
+
+template<typename K, typename V>
+class LRUCache
+{
+public:
+  // Construct an empty cache holding at most <src>maxSize</src> entries.
+  // A size 0 means that nothing is cached.
+  explicit LRUCache (uInt maxSize=64);
+
+  // Find the value of the given key and make it the most recently used.
+  // A null pointer is returned if the key is not in the cache.
+  // The pointer is valid until the entry is removed.
+  V* find (const K& key);
+
+  // Is the key in the cache? It does not change the order of use.
+  Bool contains (const K& key) const
+    { return itsMap.find(key) != itsMap.end(); }
+
+  // Add the value of the given key and make it the most recently used.
+  // The value of an existing key is replaced. If the cache is full, the
+  // least recently used entry is removed.
+  void put (const K& key, const V& value);
+
+  // Get or set the maximum number of entries.
+  // Setting it to a lower value removes the least recently used entries.
+  // <group>
+  uInt maxSize() const
+    { return itsMaxSize; }
+  void setMaxSize (uInt maxSize);
+  // </group>
+
+  // Get the number of entries in the cache.
+  uInt size() const
+    { return itsList.size(); }
+
+  // Remove all entries.
+  void clear();
+
+private:
+  // Remove the least recently used entries until at most n are left.
+  void shrink (uInt n);
+
+  //# The list is ordered from most to least recently used.
+  typedef std::list<std::pair<K,V> > EntryList;
+  EntryList itsList;
+  std::map<K, typename EntryList::iterator> itsMap;
+  uInt      itsMaxSize;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/casa/Containers/LRUCache.tcc>
+#endif //# CASACORE_NO_AUTO_TEMPLATES
+#endif
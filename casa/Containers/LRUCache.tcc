@@ -0,0 +1,93 @@
+//# LRUCache.tcc: A small cache keeping the most recently used values
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef CASA_LRUCACHE_TCC
+#define CASA_LRUCACHE_TCC
+
+//# Includes
+#include <casacore/casa/Containers/LRUCache.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+template<typename K, typename V>
+LRUCache<K,V>::LRUCache (uInt maxSize)
+  : itsMaxSize (maxSize)
+{}
+
+template<typename K, typename V>
+V* LRUCache<K,V>::find (const K& key)
+{
+  typename std::map<K, typename EntryList::iterator>::iterator iter =
+    itsMap.find (key);
+  if (iter == itsMap.end()) {
+    return 0;
+  }
+  // Move the entry to the front of the list (iterators stay valid).
+  itsList.splice (itsList.begin(), itsList, iter->second);
+  return &(iter->second->second);
+}
+
+template<typename K, typename V>
+void LRUCache<K,V>::put (const K& key, const V& value)
+{
+  V* ptr = find (key);
+  if (ptr) {
+    *ptr = value;
+  } else if (itsMaxSize > 0) {
+    shrink (itsMaxSize-1);
+    itsList.push_front (std::make_pair (key, value));
+    itsMap[key] = itsList.begin();
+  }
+}
+
+template<typename K, typename V>
+void LRUCache<K,V>::setMaxSize (uInt maxSize)
+{
+  itsMaxSize = maxSize;
+  shrink (maxSize);
+}
+
+template<typename K, typename V>
+void LRUCache<K,V>::clear()
+{
+  itsMap.clear();
+  itsList.clear();
+}
+
+template<typename K, typename V>
+void LRUCache<K,V>::shrink (uInt n)
+{
+  while (itsList.size() > n) {
+    itsMap.erase (itsList.back().first);
+    itsList.pop_back();
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,144 @@
+//# tBlockPool.cc: This program tests the BlockPool class
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Containers/BlockPool.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Check that the storage is aligned as promised.
+template<typename T>
+Bool isAligned (const Block<T>& bl)
+{
+  return (size_t(bl.storage()) % BlockPool::Alignment) == 0;
+}
+
+void testScope()
+{
+  BlockPool::Statistics st0 = BlockPool::statistics();
+  AlwaysAssertExit (! BlockPool::isEnabled());
+  {
+    BlockPoolScope scope;
+    AlwaysAssertExit (BlockPool::isEnabled());
+    const Double* ptr;
+    {
+      Block<Double> bl(100, 1.);
+      AlwaysAssertExit (isAligned(bl));
+      ptr = bl.storage();
+    }
+    // Same size class, so it must reuse the storage.
+    Block<Double> bl(99, 2.);
+    AlwaysAssertExit (bl.storage() == ptr);
+    AlwaysAssertExit (bl[89] == 2.);
+    BlockPool::Statistics st1 = BlockPool::statistics();
+    AlwaysAssertExit (st1.nalloc == st0.nalloc + 2);
+    AlwaysAssertExit (st1.nreused == st0.nreused + 1);
+    AlwaysAssertExit (st1.nfree == st0.nfree + 1);
+    {
+      // A much smaller block is in another size class, so the slack
+      // of a reused chunk is limited.
+      Block<Double> blf(64, 1.);
+      ptr = blf.storage();
+    }
+    {
+      Block<Double> bls(40, 1.);
+      AlwaysAssertExit (bls.storage() != ptr);
+    }
+    // Resizing and copying also take their storage from the pool.
+    bl.resize (200);
+    AlwaysAssertExit (isAligned(bl)  &&  bl[89] == 2.);
+    Block<Double> bl2(bl);
+    AlwaysAssertExit (isAligned(bl2)  &&  bl2[89] == 2.);
+    bl.remove (0);
+    AlwaysAssertExit (bl.nelements() == 199  &&  bl[88] == 2.);
+    {
+      // Nested scopes are possible.
+      BlockPoolScope scope2;
+      Block<Int> bl3(10, 3);
+    }
+    AlwaysAssertExit (BlockPool::isEnabled());
+    AlwaysAssertExit (BlockPool::statistics().ncached > 0);
+  }
+  // Leaving the scope clears the pool.
+  AlwaysAssertExit (! BlockPool::isEnabled());
+  AlwaysAssertExit (BlockPool::statistics().ncached == 0);
+}
+
+void testGlobal()
+{
+  BlockPool::setEnabled (True);
+  AlwaysAssertExit (BlockPool::isEnabled());
+  // Objects having a constructor and destructor.
+  Block<String> bl(10, "abc");
+  for (uInt i=0; i<bl.nelements(); ++i) {
+    AlwaysAssertExit (bl[i] == "abc");
+  }
+  bl.resize (20);
+  AlwaysAssertExit (bl[9] == "abc"  &&  bl[19].empty());
+  // Storage not allocated by the pool can be taken over.
+  Int* ptr = new Int[5];
+  Block<Int> bl2(5, ptr);
+  AlwaysAssertExit (ptr == 0);
+  Block<Int> bl3(6);
+  ptr = new Int[5];
+  bl3.replaceStorage (5, ptr);
+  // Large blocks are not kept in the pool, but are aligned.
+  size_t ncached = BlockPool::statistics().ncached;
+  Block<Char> bl4(8*1024*1024);
+  AlwaysAssertExit (isAligned(bl4));
+  bl4.resize (0, True);
+  AlwaysAssertExit (BlockPool::statistics().ncached == ncached);
+  // Limit the pool size.
+  size_t maxSize = BlockPool::maxCacheSize();
+  BlockPool::setMaxCacheSize (1024);
+  {
+    Block<Char> bl5(4096);
+  }
+  AlwaysAssertExit (BlockPool::statistics().ncached <= 1024);
+  BlockPool::setMaxCacheSize (maxSize);
+  BlockPool::setEnabled (False);
+  AlwaysAssertExit (! BlockPool::isEnabled());
+  AlwaysAssertExit (BlockPool::statistics().ncached == 0);
+}
+
+int main()
+{
+  try {
+    testScope();
+    testGlobal();
+  } catch (AipsError& x) {
+    cout << "Unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
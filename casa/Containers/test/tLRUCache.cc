@@ -0,0 +1,95 @@
+//# tLRUCache.cc: Test program for class LRUCache
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/casa/Containers/LRUCache.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+void testOrder()
+{
+  LRUCache<String, Int> cache(3);
+  AlwaysAssertExit (cache.maxSize() == 3  &&  cache.size() == 0);
+  AlwaysAssertExit (cache.find("a") == 0);
+  cache.put ("a", 1);
+  cache.put ("b", 2);
+  cache.put ("c", 3);
+  AlwaysAssertExit (cache.size() == 3);
+  // Using "a" makes "b" the least recently used.
+  AlwaysAssertExit (*cache.find("a") == 1);
+  cache.put ("d", 4);
+  AlwaysAssertExit (cache.size() == 3);
+  AlwaysAssertExit (! cache.contains("b"));
+  AlwaysAssertExit (cache.contains("a")  &&  cache.contains("c")  &&
+                    cache.contains("d"));
+  // Replacing a value also uses it, so "c" is removed next.
+  cache.put ("a", 10);
+  AlwaysAssertExit (*cache.find("a") == 10  &&  cache.size() == 3);
+  cache.put ("e", 5);
+  AlwaysAssertExit (! cache.contains("c"));
+  // contains does not change the order, so "d" is removed next.
+  AlwaysAssertExit (cache.contains("d"));
+  cache.put ("f", 6);
+  AlwaysAssertExit (! cache.contains("d"));
+  // A found value can be changed in place.
+  *cache.find("e") = 50;
+  AlwaysAssertExit (*cache.find("e") == 50);
+  // Shrinking removes the least recently used entries ("a" and "f").
+  cache.setMaxSize (1);
+  AlwaysAssertExit (cache.size() == 1  &&  cache.contains("e"));
+  cache.clear();
+  AlwaysAssertExit (cache.size() == 0  &&  cache.maxSize() == 1);
+}
+
+void testZeroSize()
+{
+  LRUCache<Int, Double> cache(0);
+  cache.put (1, 1.);
+  AlwaysAssertExit (cache.size() == 0  &&  cache.find(1) == 0);
+  cache.setMaxSize (2);
+  cache.put (1, 1.);
+  cache.put (2, 2.);
+  cache.put (3, 3.);
+  AlwaysAssertExit (cache.size() == 2  &&  !cache.contains(1));
+  AlwaysAssertExit (*cache.find(2) == 2.  &&  *cache.find(3) == 3.);
+}
+
+int main()
+{
+  try {
+    testOrder();
+    testZeroSize();
+  } catch (AipsError& x) {
+    cout << "Unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -30,10 +30,48 @@
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// Lock a shard mutex if given (i.e. if the cache is concurrent).
+class BucketCacheShardLock
+{
+public:
+    explicit BucketCacheShardLock (Mutex* mutex)
+      : itsMutex (mutex)
+      { if (itsMutex) itsMutex->lock(); }
+    ~BucketCacheShardLock()
+      { if (itsMutex) itsMutex->unlock(); }
+private:
+    BucketCacheShardLock (const BucketCacheShardLock&);
+    BucketCacheShardLock& operator= (const BucketCacheShardLock&);
+    Mutex* itsMutex;
+};
+
+
+BucketCache::ExclusiveLock::ExclusiveLock (BucketCache& cache)
+: itsCache (cache)
+{
+    // Lock the shards in a fixed order to avoid deadlocks.
+    if (itsCache.its_NShard > 1) {
+        for (uInt i=0; i<itsCache.its_NShard; i++) {
+	    itsCache.its_ShardMutex[i]->lock();
+	}
+    }
+}
+
+BucketCache::ExclusiveLock::~ExclusiveLock()
+{
+    if (itsCache.its_NShard > 1) {
+        for (uInt i=itsCache.its_NShard; i>0; i--) {
+	    itsCache.its_ShardMutex[i-1]->unlock();
+	}
+    }
+}
+
+
 BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
 			  uInt bucketSize, uInt nrOfBuckets,
 			  uInt cacheSize, void* ownerObject,
@@ -47,38 +85,31 @@ BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
   its_WriteCallBack (writeCallBack),
   its_InitCallBack  (initCallBack),
   its_DeleteCallBack(deleteCallBack),
+  its_ReadBucket    (0),
+  its_WriteBucket   (0),
   its_StartOffset   (startOffset),
   its_BucketSize    (bucketSize),
   its_CurNrOfBuckets(0),
   its_NewNrOfBuckets(nrOfBuckets),
   its_CacheSize     (cacheSize),
-  its_CacheSizeUsed (0),
-  its_Cache         (cacheSize, static_cast<char*>(0)),
+  its_NShard        (1),
+  its_ShardSize     (cacheSize),
   its_ActualSlot    (0),
   its_SlotNr        (nrOfBuckets, Int(-1)),
-  its_BucketNr      (cacheSize, uInt(0)),
-  its_Dirty         (cacheSize, uInt(0)),
-  its_LRU           (cacheSize, uInt(0)),
-  its_LRUCounter    (0),
-  its_Buffer        (0),
   its_NrOfFree      (0),
   its_FirstFree     (-1)
 {
-    initStatistics();
     // The bucketsize must be set.
     if (bucketSize == 0) {
 	throw (AipsError ("BucketCache::BucketCache; bucketsize=0"));
     }
     // A cache without slots is not possible; so give it a slot.
     if (its_CacheSize == 0) {
-	resize (1);
-    }
-    // Allocate a buffer (for data in external format).
-    // Initialize it to prevent "uninitialized memory errors" when writing.
-    its_Buffer = new char[bucketSize];
-    for (uInt i=0; i<bucketSize; i++) {
-	its_Buffer[i] = 0;
+	its_CacheSize = 1;
     }
+    // Allocate the buffer (for data in external format) and the slots.
+    createShards();
+    setupShards();
     // Open the file if not open yet and get its physical size.
     // Use that to determine the number of buckets in the file.
     its_file->open();
@@ -97,39 +128,139 @@ BucketCache::~BucketCache()
     // It is not flushed (that should have been done before).
     // In that way no needless flushes are done for a temporary table.
     clear (0, False);
-    delete [] its_Buffer;
+    deleteShards();
+}
+
+void BucketCache::createShards()
+{
+    // Allocate a buffer per shard.
+    // Initialize it to prevent "uninitialized memory errors" when writing.
+    its_Buffer.resize (its_NShard, True, False);
+    for (uInt i=0; i<its_NShard; i++) {
+        its_Buffer[i] = new char[its_BucketSize];
+	for (uInt j=0; j<its_BucketSize; j++) {
+	    its_Buffer[i][j] = 0;
+	}
+    }
+    // Mutexes are only needed in concurrent mode.
+    // They are recursive, because locked functions call each other.
+    if (its_NShard > 1) {
+        its_ShardMutex.resize (its_NShard, True, False);
+	for (uInt i=0; i<its_NShard; i++) {
+	    its_ShardMutex[i] = new Mutex (Mutex::Recursive);
+	}
+    }
+}
+
+void BucketCache::deleteShards()
+{
+    for (uInt i=0; i<its_Buffer.nelements(); i++) {
+        delete [] its_Buffer[i];
+    }
+    for (uInt i=0; i<its_ShardMutex.nelements(); i++) {
+        delete its_ShardMutex[i];
+    }
+    its_Buffer.resize (0, True, False);
+    its_ShardMutex.resize (0, True, False);
+}
+
+void BucketCache::setupShards()
+{
+    // Divide the slots evenly over the shards; each shard needs a slot.
+    its_ShardSize = std::max (its_CacheSize / its_NShard, 1u);
+    uInt nslot = its_NShard * its_ShardSize;
+    its_Cache.resize    (nslot, True, False);
+    its_BucketNr.resize (nslot, True, False);
+    its_Dirty.resize    (nslot, True, False);
+    its_LRU.resize      (nslot, True, False);
+    its_Pinned.resize   (nslot, True, False);
+    for (uInt i=0; i<nslot; i++) {
+	its_Cache[i]    = 0;
+	its_BucketNr[i] = 0;
+	its_Dirty[i]    = 0;
+	its_LRU[i]      = 0;
+	its_Pinned[i]   = 0;
+    }
+    its_ShardUsed.resize  (its_NShard, True, False);
+    its_LRUCounter.resize (its_NShard, True, False);
+    naccess_p.resize      (its_NShard, True, False);
+    nread_p.resize        (its_NShard, True, False);
+    ninit_p.resize        (its_NShard, True, False);
+    nwrite_p.resize       (its_NShard, True, False);
+    for (uInt i=0; i<its_NShard; i++) {
+        its_ShardUsed[i]  = 0;
+	its_LRUCounter[i] = 0;
+    }
+    initStatistics();
+    its_ActualSlot = 0;
+}
+
+void BucketCache::setConcurrency (uInt nShard)
+{
+    if (nShard == 0) {
+        nShard = 1;
+    }
+    if (nShard == its_NShard) {
+        return;
+    }
+    for (uInt i=0; i<its_Pinned.nelements(); i++) {
+        if (its_Pinned[i] > 0) {
+	    throw AipsError ("BucketCache::setConcurrency: "
+			     "cache contains pinned buckets");
+	}
+    }
+    // The buckets get distributed differently over the slots,
+    // so write and remove all buckets in the cache.
+    clear();
+    deleteShards();
+    its_NShard = nShard;
+    createShards();
+    setupShards();
 }
 
 void BucketCache::clear (uInt fromSlot, Bool doFlush)
 {
+    ExclusiveLock lock(*this);
     if (doFlush) {
         flush (fromSlot);
     }
-    for (uInt i=fromSlot; i<its_CacheSizeUsed; i++) {
-	its_DeleteCallBack (its_Owner, its_Cache[i]);
-	its_Cache[i] = 0;
-	its_SlotNr[its_BucketNr[i]] = -1;
+    for (uInt shard=0; shard<its_NShard; shard++) {
+        uInt first = shard * its_ShardSize;
+	uInt end   = first + its_ShardUsed[shard];
+	for (uInt i=std::max(fromSlot, first); i<end; i++) {
+	    its_DeleteCallBack (its_Owner, its_Cache[i]);
+	    its_Cache[i] = 0;
+	    its_Pinned[i] = 0;
+	    its_SlotNr[its_BucketNr[i]] = -1;
+	}
+	if (fromSlot < end) {
+	    its_ShardUsed[shard] = (fromSlot > first  ?  fromSlot - first : 0);
+	}
     }
     if (fromSlot == 0) {
-	its_LRUCounter = 0;
+        for (uInt shard=0; shard<its_NShard; shard++) {
+	    its_LRUCounter[shard] = 0;
+	}
 	initStatistics();
     }
-    if (fromSlot < its_CacheSizeUsed) {
-	its_CacheSizeUsed = fromSlot;
-    }
 }
 
 Bool BucketCache::flush (uInt fromSlot)
 {
+    ExclusiveLock lock(*this);
     // Initialize remaining buckets when everything has to be flushed.
     if (fromSlot == 0  &&  its_NewNrOfBuckets > 0) {
 	initializeBuckets (its_NewNrOfBuckets - 1);
     }
     Bool hasWritten = False;
-    for (uInt i=fromSlot; i<its_CacheSizeUsed; i++) {
-	if (its_Dirty[i]) {
-	    writeBucket (i);
-	    hasWritten = True;
+    for (uInt shard=0; shard<its_NShard; shard++) {
+        uInt first = shard * its_ShardSize;
+	uInt end   = first + its_ShardUsed[shard];
+	for (uInt i=std::max(fromSlot, first); i<end; i++) {
+	    if (its_Dirty[i]) {
+	        writeBucket (i);
+		hasWritten = True;
+	    }
 	}
     }
     return hasWritten;
@@ -137,6 +268,20 @@ Bool BucketCache::flush (uInt fromSlot)
 
 void BucketCache::resize (uInt cacheSize)
 {
+    ExclusiveLock lock(*this);
+    if (its_NShard > 1) {
+        // The slots have to be divided again over the shards,
+        // so the entire cache is cleared.
+        if (cacheSize == 0) {
+	    cacheSize = 1;
+	}
+	if (cacheSize != its_CacheSize) {
+	    clear();
+	    its_CacheSize = cacheSize;
+	    setupShards();
+	}
+	return;
+    }
     // Clear the part of the cache to be deleted.
     clear (cacheSize);
     // The cache must contain at least one slot.
@@ -152,16 +297,19 @@ void BucketCache::resize (uInt cacheSize)
     its_BucketNr.resize (cacheSize);
     its_LRU.resize      (cacheSize);
     its_Dirty.resize    (cacheSize);
+    its_Pinned.resize   (cacheSize);
     // Initialize the new part of the cache.
     for (uInt i=its_CacheSize; i<cacheSize; i++) {
 	its_Cache[i]    = 0;
 	its_BucketNr[i] = 0;
 	its_LRU[i]      = 0;
 	its_Dirty[i]    = 0;
+	its_Pinned[i]   = 0;
     }
     its_CacheSize = cacheSize;
-    if (its_CacheSizeUsed > cacheSize) {
-	its_CacheSizeUsed = cacheSize;
+    its_ShardSize = cacheSize;
+    if (its_ShardUsed[0] > cacheSize) {
+	its_ShardUsed[0] = cacheSize;
     }
     its_ActualSlot = 0;
 }
@@ -170,6 +318,7 @@ void BucketCache::resize (uInt cacheSize)
 void BucketCache::resync (uInt nrBucket, uInt nrOfFreeBucket,
 			  Int firstFreeBucket)
 {
+    ExclusiveLock lock(*this);
     // Clear the entire cache, so data will be reread.
     // Set it to the new size.
     clear();
@@ -182,6 +331,20 @@ void BucketCache::resync (uInt nrBucket, uInt nrOfFreeBucket,
 }
 
 
+void BucketCache::setBucketIO (BucketCacheReadBucket readBucket,
+			       BucketCacheWriteBucket writeBucket)
+{
+    ExclusiveLock lock(*this);
+    its_ReadBucket     = readBucket;
+    its_WriteBucket    = writeBucket;
+    its_CurNrOfBuckets = its_NewNrOfBuckets;
+}
+
+Bool BucketCache::inCache (uInt bucketNr) const
+{
+    return bucketNr < its_SlotNr.nelements()  &&  its_SlotNr[bucketNr] >= 0;
+}
+
 uInt BucketCache::nBucket() const
 {
     return its_NewNrOfBuckets;
@@ -189,54 +352,102 @@ uInt BucketCache::nBucket() const
 
 void BucketCache::setDirty()
 {
+    ExclusiveLock lock(*this);
     its_Dirty[its_ActualSlot] = 1;
 }
 
 
-void BucketCache::setLRU()
+void BucketCache::setLRU (uInt slotNr)
 {
-    // When the LRU counter would wrap, clear all LRU info in the cache.
-    if (its_LRUCounter == 4294967295u) {
-	its_LRUCounter = 0;
-	for (uInt i=0; i<its_CacheSizeUsed; i++) {
+    uInt shard = slotNr / its_ShardSize;
+    // When the LRU counter would wrap, clear all LRU info in the shard.
+    if (its_LRUCounter[shard] == 4294967295u) {
+	its_LRUCounter[shard] = 0;
+	uInt first = shard * its_ShardSize;
+	for (uInt i=first; i<first+its_ShardUsed[shard]; i++) {
 	    its_LRU[i] = 0;
 	}
     }
-    its_LRU[its_ActualSlot] = ++its_LRUCounter;
+    its_LRU[slotNr] = ++its_LRUCounter[shard];
 }
 
 char* BucketCache::getBucket (uInt bucketNr)
+{
+    ExclusiveLock lock(*this);
+    its_ActualSlot = accessBucket (bucketNr);
+    return its_Cache[its_ActualSlot];
+}
+
+char* BucketCache::pinBucket (uInt bucketNr)
+{
+    // Buckets in the file can be accessed by locking their shard only.
+    if (its_NShard > 1) {
+        BucketCacheShardLock lock(its_ShardMutex[shardOf(bucketNr)]);
+	if (bucketNr < its_CurNrOfBuckets) {
+	    uInt slotNr = accessBucket (bucketNr);
+	    its_Pinned[slotNr]++;
+	    return its_Cache[slotNr];
+	}
+    }
+    // Initializing buckets requires exclusive access.
+    ExclusiveLock lock(*this);
+    uInt slotNr = accessBucket (bucketNr);
+    its_Pinned[slotNr]++;
+    return its_Cache[slotNr];
+}
+
+void BucketCache::unpinBucket (uInt bucketNr)
 {
     if (bucketNr >= its_NewNrOfBuckets) {
 	throw (indexError<Int> (bucketNr));
     }
-    naccess_p++;
+    BucketCacheShardLock lock(its_NShard > 1  ?
+			      its_ShardMutex[shardOf(bucketNr)] : 0);
+    Int slotNr = its_SlotNr[bucketNr];
+    if (slotNr < 0  ||  its_Pinned[slotNr] == 0) {
+        throw AipsError ("BucketCache::unpinBucket: bucket " +
+			 String::toString(bucketNr) + " is not pinned");
+    }
+    its_Pinned[slotNr]--;
+}
+
+uInt BucketCache::accessBucket (uInt bucketNr)
+{
+    if (bucketNr >= its_NewNrOfBuckets) {
+	throw (indexError<Int> (bucketNr));
+    }
+    naccess_p[shardOf(bucketNr)]++;
     // Test if it is already in the cache.
-    if (its_SlotNr[bucketNr] >= 0) {
-	its_ActualSlot = its_SlotNr[bucketNr];
-	setLRU();
-	return its_Cache[its_ActualSlot];
+    Int slotNr = its_SlotNr[bucketNr];
+    if (slotNr >= 0) {
+	setLRU (slotNr);
+	return slotNr;
     }
     // Not in cache, so get a slot.
     // Read the bucket when it is already in the file.
     // Otherwise get a new initialized bucket.
     if (bucketNr < its_CurNrOfBuckets) {
-	getSlot (bucketNr);
-	readBucket (its_ActualSlot);
-    }else{
-        if (! its_file->isWritable()) {
-            throw AipsError ("BucketCache::getBucket: bucket " +
-                             String::toString(bucketNr) +
-                             " exceeds nr of buckets");
-        }
-	initializeBuckets (bucketNr);
+	uInt slot = findSlot (bucketNr);
+	readBucket (slot);
+	return slot;
     }
-    return its_Cache[its_ActualSlot];
+    if (! its_file->isWritable()) {
+        throw AipsError ("BucketCache::getBucket: bucket " +
+			 String::toString(bucketNr) +
+			 " exceeds nr of buckets");
+    }
+    initializeBuckets (bucketNr);
+    return its_SlotNr[bucketNr];
 }
 
 void BucketCache::extend (uInt nrBucket)
 {
+    ExclusiveLock lock(*this);
     its_NewNrOfBuckets += nrBucket;
+    // The owner handles reading buckets not written yet.
+    if (its_ReadBucket != 0) {
+        its_CurNrOfBuckets = its_NewNrOfBuckets;
+    }
     uInt oldSize = its_SlotNr.nelements();
     if (oldSize < its_NewNrOfBuckets) {
         uInt newSize = oldSize*2;
@@ -252,14 +463,19 @@ void BucketCache::extend (uInt nrBucket)
     
 uInt BucketCache::addBucket (char* data)
 {
+    ExclusiveLock lock(*this);
+    if (its_ReadBucket != 0) {
+        throw AipsError ("BucketCache::addBucket cannot be used if the "
+			 "owner does the bucket IO");
+    }
     uInt bucketNr;
     if (its_FirstFree >= 0) {
 	// There is a free list, so get the first bucket from it.
 	bucketNr = its_FirstFree;
 	its_file->seek (its_StartOffset + Int64(bucketNr) * its_BucketSize);
-	its_file->read (its_Buffer,
+	its_file->read (its_Buffer[0],
 		   CanonicalConversion::canonicalSize (static_cast<Int*>(0)));
-	CanonicalConversion::toLocal (its_FirstFree, its_Buffer);
+	CanonicalConversion::toLocal (its_FirstFree, its_Buffer[0]);
 	its_NrOfFree--;
     }else{
 	// No free buckets, so extend the file.
@@ -279,13 +495,18 @@ uInt BucketCache::addBucket (char* data)
 
 void BucketCache::removeBucket()
 {
+    ExclusiveLock lock(*this);
+    if (its_ReadBucket != 0) {
+        throw AipsError ("BucketCache::removeBucket cannot be used if the "
+			 "owner does the bucket IO");
+    }
     // Removing a bucket means adding it to the beginning of the free list.
     // Thus store the bucket nr of the first free in this bucket
     // and make this bucket the first free.
     uInt bucketNr = its_BucketNr[its_ActualSlot];
-    CanonicalConversion::fromLocal (its_Buffer, its_FirstFree);
+    CanonicalConversion::fromLocal (its_Buffer[0], its_FirstFree);
     its_file->seek (its_StartOffset + Int64(bucketNr) * its_BucketSize);
-    its_file->write (its_Buffer, its_BucketSize);
+    its_file->write (its_Buffer[0], its_BucketSize);
     its_Dirty[its_ActualSlot] = 0;
     its_FirstFree = bucketNr;
     its_NrOfFree++;
@@ -295,6 +516,7 @@ void BucketCache::removeBucket()
     its_Cache[its_ActualSlot] = 0;
     its_SlotNr[bucketNr] = -1;
     its_LRU[its_ActualSlot] = 0;
+    its_Pinned[its_ActualSlot] = 0;
     its_ActualSlot = 0;
 }
 
@@ -302,12 +524,14 @@ void BucketCache::removeBucket()
 void BucketCache::get (char* buf, uInt length, Int64 offset)
 {
     checkOffset (length, offset);
+    ScopedMutexLock lock(its_FileMutex);
     its_file->seek (offset);
     its_file->read (buf, length);
 }
 void BucketCache::put (const char* buf, uInt length, Int64 offset)
 {
     checkOffset (length, offset);
+    ScopedMutexLock lock(its_FileMutex);
     its_file->seek (offset);
     its_file->write (buf, length);
 }
@@ -323,50 +547,89 @@ void BucketCache::checkOffset (uInt length, Int64 offset) const
 
 void BucketCache::getSlot (uInt bucketNr)
 {
-    if (its_CacheSizeUsed < its_CacheSize) {
-	its_ActualSlot = its_CacheSizeUsed++;
+    its_ActualSlot = findSlot (bucketNr);
+}
+
+uInt BucketCache::findSlot (uInt bucketNr)
+{
+    // A bucket can only be held in a slot of its own shard.
+    uInt shard = shardOf (bucketNr);
+    uInt first = shard * its_ShardSize;
+    uInt slotNr;
+    if (its_ShardUsed[shard] < its_ShardSize) {
+	slotNr = first + its_ShardUsed[shard]++;
     }else{
-	its_ActualSlot = 0;
-	uInt least = its_LRU[0];
-	for (uInt i=1; i<its_CacheSizeUsed; i++) {
-	    if (its_LRU[i] < least) {
-		least = its_LRU[i];
-		its_ActualSlot = i;
+        // Reuse the least recently used slot which is not pinned.
+        Bool found = False;
+	uInt least = 0;
+	slotNr = first;
+	for (uInt i=first; i<first+its_ShardSize; i++) {
+	    if (its_Pinned[i] == 0  &&  (!found  ||  its_LRU[i] < least)) {
+		least   = its_LRU[i];
+		slotNr  = i;
+		found   = True;
 	    }
 	}
-	if (its_Dirty[its_ActualSlot]) {
-	    writeBucket (its_ActualSlot);
+	if (!found) {
+	    throw AipsError ("BucketCache: all " +
+			     String::toString(its_ShardSize) +
+			     " cache slots of shard " + String::toString(shard) +
+			     " are pinned");
+	}
+	if (its_Dirty[slotNr]) {
+	    writeBucket (slotNr);
 	}
-	if (its_Cache[its_ActualSlot] != 0) {
-	    its_DeleteCallBack (its_Owner, its_Cache[its_ActualSlot]);
-	    its_Cache[its_ActualSlot] = 0;
-	    its_SlotNr[its_BucketNr[its_ActualSlot]] = -1;
+	if (its_Cache[slotNr] != 0) {
+	    its_DeleteCallBack (its_Owner, its_Cache[slotNr]);
+	    its_Cache[slotNr] = 0;
+	    its_SlotNr[its_BucketNr[slotNr]] = -1;
 	}
     }
-    setLRU();
-    its_BucketNr[its_ActualSlot] = bucketNr;
-    its_SlotNr[bucketNr] = its_ActualSlot;
+    setLRU (slotNr);
+    its_BucketNr[slotNr] = bucketNr;
+    its_SlotNr[bucketNr] = slotNr;
+    return slotNr;
 }
 
 
 void BucketCache::writeBucket (uInt slotNr)
 {
 ///    cout << "write " << its_BucketNr[slotNr] << " " << slotNr;
-    its_WriteCallBack (its_Owner, its_Buffer, its_Cache[slotNr]);
-    its_file->seek (its_StartOffset +
-		    Int64(its_BucketNr[slotNr]) * its_BucketSize);
-    its_file->write (its_Buffer, its_BucketSize);
+    uInt shard = slotNr / its_ShardSize;
+    its_WriteCallBack (its_Owner, its_Buffer[shard], its_Cache[slotNr]);
+    {
+        ScopedMutexLock lock(its_FileMutex);
+	if (its_WriteBucket != 0) {
+	    its_WriteBucket (its_Owner, its_BucketNr[slotNr],
+			     its_Buffer[shard]);
+	} else {
+	    its_file->seek (its_StartOffset +
+			    Int64(its_BucketNr[slotNr]) * its_BucketSize);
+	    its_file->write (its_Buffer[shard], its_BucketSize);
+	}
+    }
     its_Dirty[slotNr] = 0;
-    nwrite_p++;
+    nwrite_p[shard]++;
 }
 void BucketCache::readBucket (uInt slotNr)
 {
 ///    cout << "read " << its_BucketNr[slotNr] << " " << slotNr;
-    its_file->seek (its_StartOffset +
-		    Int64(its_BucketNr[slotNr]) * its_BucketSize);
-    its_file->read (its_Buffer, its_BucketSize);
-    its_Cache[slotNr] = its_ReadCallBack (its_Owner, its_Buffer);
-    nread_p++;
+    uInt shard = slotNr / its_ShardSize;
+    {
+        // Only the file access is serialized; the conversion is done
+        // in parallel for the shards.
+        ScopedMutexLock lock(its_FileMutex);
+	if (its_ReadBucket != 0) {
+	    its_ReadBucket (its_Owner, its_BucketNr[slotNr],
+			    its_Buffer[shard]);
+	} else {
+	    its_file->seek (its_StartOffset +
+			    Int64(its_BucketNr[slotNr]) * its_BucketSize);
+	    its_file->read (its_Buffer[shard], its_BucketSize);
+	}
+    }
+    its_Cache[slotNr] = its_ReadCallBack (its_Owner, its_Buffer[shard]);
+    nread_p[shard]++;
 }
 void BucketCache::initializeBuckets (uInt bucketNr)
 {
@@ -376,49 +639,74 @@ void BucketCache::initializeBuckets (uInt bucketNr)
 ///	cout << "init " << its_CurNrOfBuckets << " " << its_ActualSlot;
 	its_Cache[its_ActualSlot] = its_InitCallBack (its_Owner);
 	its_Dirty[its_ActualSlot] = 1;
+	ninit_p[shardOf(its_CurNrOfBuckets)]++;
 	its_CurNrOfBuckets++;
-	ninit_p++;
     }
 }
 
 
 void BucketCache::showStatistics (ostream& os) const
 {
+    uInt naccess = 0;
+    uInt nread   = 0;
+    uInt ninit   = 0;
+    uInt nwrite  = 0;
+    for (uInt i=0; i<its_NShard; i++) {
+        naccess += naccess_p[i];
+	nread   += nread_p[i];
+	ninit   += ninit_p[i];
+	nwrite  += nwrite_p[i];
+    }
     os << "cacheSize: " << its_CacheSize << " (*" << its_BucketSize
        << ")" << endl;
+    if (its_NShard > 1) {
+        os << "#shards:   " << its_NShard << " (*" << its_ShardSize
+	   << " slots)" << endl;
+    }
     os << "#buckets:  " << its_CurNrOfBuckets;
-    if (nread_p+nwrite_p > its_CurNrOfBuckets) {
+    if (nread+nwrite > its_CurNrOfBuckets) {
 	os << "         (<  #reads + #writes!)";
     }
     os << endl;
     if (its_NrOfFree > 0) {
 	os << "#deleted:  " << its_NrOfFree << endl;
     }
-    if (nread_p > 0) {
-	os << "#reads:    " << nread_p << endl;
+    if (nread > 0) {
+	os << "#reads:    " << nread << endl;
     }
-    if (ninit_p > 0) {
-	os << "#inits:    " << ninit_p << endl;
+    if (ninit > 0) {
+	os << "#inits:    " << ninit << endl;
     }
-    if (nwrite_p > 0) {
-	os << "#writes:   " << nwrite_p << endl;
+    if (nwrite > 0) {
+	os << "#writes:   " << nwrite << endl;
     }
-    os << "#accesses: " << naccess_p;
-    if (naccess_p > 0) {
+    os << "#accesses: " << naccess;
+    if (naccess > 0) {
 	os << "        hit-rate:  "
-	   << 100 * float(naccess_p - nread_p - ninit_p) /
-	                               float(naccess_p) << "%";
+	   << 100 * float(naccess - nread - ninit) / float(naccess) << "%";
+    }
+    os << endl;
+    if (its_NShard > 1) {
+        for (uInt i=0; i<its_NShard; i++) {
+	    os << "  shard " << i << ": #accesses: " << naccess_p[i];
+	    if (naccess_p[i] > 0) {
+	        os << "        hit-rate:  "
+		   << 100 * float(naccess_p[i] - nread_p[i] - ninit_p[i]) /
+		                                     float(naccess_p[i]) << "%";
+	    }
+	    os << endl;
+	}
     }
-    cout << endl;
 }
 
 void BucketCache::initStatistics()
 {
-    naccess_p = 0;
-    nread_p   = 0;
-    ninit_p   = 0;
-    nwrite_p  = 0;
+    for (uInt i=0; i<its_NShard; i++) {
+        naccess_p[i] = 0;
+	nread_p[i]   = 0;
+	ninit_p[i]   = 0;
+	nwrite_p[i]  = 0;
+    }
 }
 
 } //# NAMESPACE CASACORE - END
-
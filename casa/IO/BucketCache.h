@@ -33,6 +33,7 @@
 #include <casacore/casa/IO/BucketFile.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
+#include <casacore/casa/OS/Mutex.h>
 
 //# Forward clarations
 #include <casacore/casa/iosfwd.h>
@@ -71,6 +72,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // The DeleteBuffer callback function has to delete the buffer
 // allocated by the ToLocal function.
 // <p>
+// Optionally the owner can do the IO of the buckets itself (for example
+// to store them compressed) by means of the ReadBucket and WriteBucket
+// callback functions (see <src>BucketCache::setBucketIO</src>).
+// ReadBucket has to fill the buffer with the canonical data of the given
+// bucket, while WriteBucket has to store the canonical data in the buffer.
+// <p>
 // The functions get a pointer to the owner object, which was provided
 // at construction time. The callback function has to cast this to the
 // correct type and can use it thereafter.
@@ -91,6 +98,10 @@ typedef void (*BucketCacheFromLocal) (void* ownerObject, char* canonical,
 				      const char* local);
 typedef char* (*BucketCacheAddBuffer) (void* ownerObject);
 typedef void (*BucketCacheDeleteBuffer) (void* ownerObject, char* buffer);
+typedef void (*BucketCacheReadBucket) (void* ownerObject, uInt bucketNr,
+				       char* canonical);
+typedef void (*BucketCacheWriteBucket) (void* ownerObject, uInt bucketNr,
+					const char* canonical);
 // </group>
 
 
@@ -143,6 +154,22 @@ typedef void (*BucketCacheDeleteBuffer) (void* ownerObject, char* buffer);
 // <p>
 // Statistics are kept to know how efficient the cache is working.
 // It is possible to initialize and show the statistics.
+// <p>
+// By default a BucketCache object can only be used by a single thread.
+// Function <src>setConcurrency</src> turns it into a concurrent cache
+// which is split into a number of shards. A bucket is handled by shard
+// <src>bucketNr % nShard</src>. Each shard has its own slots, LRU
+// administration, conversion buffer and statistics, and is protected by
+// its own mutex. In this way multiple threads can access buckets in
+// different shards in parallel; only the physical file IO is serialized.
+// <br>In concurrent mode readers should use <src>pinBucket</src> and
+// <src>unpinBucket</src>. A pinned bucket is never removed from the cache,
+// so the returned pointer stays valid until it is unpinned, even when other
+// threads access the same shard.
+// All other operations (getBucket, setDirty, addBucket, removeBucket,
+// extend, flush, etc.) are seen as write operations. They lock all shards,
+// thus are serialized with respect to each other and to the readers.
+// Note that the callback functions must be thread-safe as well.
 // </synopsis> 
 
 // <motivation>
@@ -264,6 +291,34 @@ public:
     // Get the current cache size (in buckets).
     uInt cacheSize() const;
 
+    // Make the cache concurrent by splitting it into the given number of
+    // shards. The cache slots are evenly divided over the shards, but each
+    // shard has at least one slot. A value 0 or 1 makes the cache
+    // non-concurrent (which is the default).
+    // <br>The cache is flushed and cleared before being resharded.
+    // It is not possible while buckets are pinned.
+    void setConcurrency (uInt nShard);
+
+    // Get the number of shards (1 means non-concurrent).
+    uInt nShard() const;
+
+    // Is the cache concurrent?
+    Bool isConcurrent() const;
+
+    // Let the owner do the IO of the buckets using the given callback
+    // functions instead of reading and writing them at fixed places in
+    // the file. In this way the owner can store buckets with a variable
+    // length (e.g. compressed). All buckets are regarded to exist, so the
+    // owner has to handle the read of a bucket not written yet.
+    // <br>The free bucket list cannot be used in this mode, so
+    // addBucket and removeBucket throw an exception.
+    // The file IO done by the callback functions is serialized.
+    void setBucketIO (BucketCacheReadBucket readBucket,
+		      BucketCacheWriteBucket writeBucket);
+
+    // Is the given bucket in the cache?
+    Bool inCache (uInt bucketNr) const;
+
     // Set the dirty bit for the current bucket.
     void setDirty();
 
@@ -276,6 +331,20 @@ public:
     // A pointer to the data in converted format is returned.
     char* getBucket (uInt bucketNr);
 
+    // Get a bucket and pin it in the cache, so it cannot be removed by
+    // subsequent accesses (from this or other threads).
+    // It does not make the bucket current, so it can be used by concurrent
+    // readers. Only the shard the bucket belongs to is locked; the bucket
+    // is only initialized (which locks all shards) if it is not in the
+    // file yet.
+    // <br>Every call to pinBucket has to be matched by a call to
+    // unpinBucket. An exception is thrown if a bucket is needed in a shard
+    // in which all slots are pinned.
+    // <group>
+    char* pinBucket (uInt bucketNr);
+    void unpinBucket (uInt bucketNr);
+    // </group>
+
     // Extend the file with the given number of buckets.
     // The buckets get initialized when they are acquired
     // (using getBucket) for the first time.
@@ -317,9 +386,24 @@ public:
     void initStatistics();
 
     // Show the statistics.
+    // In concurrent mode the hit rate per shard is shown as well.
     void showStatistics (ostream& os) const;
 
 private:
+    // Lock all shards (in a fixed order) in concurrent mode,
+    // so the cache can be modified safely. It is a no-op otherwise.
+    class ExclusiveLock
+    {
+    public:
+        explicit ExclusiveLock (BucketCache& cache);
+        ~ExclusiveLock();
+    private:
+        ExclusiveLock (const ExclusiveLock&);
+        ExclusiveLock& operator= (const ExclusiveLock&);
+        BucketCache& itsCache;
+    };
+    friend class ExclusiveLock;
+
     // The file used.
     BucketFile* its_file;
     // The owner object.
@@ -332,6 +416,9 @@ private:
     BucketCacheAddBuffer its_InitCallBack;
     // The delete callback function.
     BucketCacheDeleteBuffer its_DeleteCallBack;
+    // The optional read and write bucket callback functions (0 = not used).
+    BucketCacheReadBucket  its_ReadBucket;
+    BucketCacheWriteBucket its_WriteBucket;
     // The starting offsets of the buckets in the file.
     Int64    its_StartOffset;
     // The bucket size.
@@ -342,8 +429,13 @@ private:
     uInt     its_NewNrOfBuckets;
     // The size of the cache (i.e. #buckets fitting in it).
     uInt     its_CacheSize;
-    // The nr of slots used in the cache.
-    uInt     its_CacheSizeUsed;
+    // The number of shards (1 = non-concurrent).
+    uInt     its_NShard;
+    // The number of slots per shard.
+    // Shard i uses slots [i*its_ShardSize, (i+1)*its_ShardSize).
+    uInt     its_ShardSize;
+    // The nr of slots used in each shard.
+    Block<uInt>  its_ShardUsed;
     // The cache itself.
     PtrBlock<char*> its_Cache; 
     // The cache slot actually used.
@@ -356,19 +448,25 @@ private:
     Block<uInt>  its_Dirty;
     // Determine when a block is used for the last time.
     Block<uInt>  its_LRU;
-    // The Least Recently Used counter.
-    uInt         its_LRUCounter;
-    // The internal buffer.
-    char*        its_Buffer;
+    // The pin count of each slot (a pinned slot cannot be reused).
+    Block<uInt>  its_Pinned;
+    // The Least Recently Used counter per shard.
+    Block<uInt>  its_LRUCounter;
+    // The internal buffer per shard (for data in external format).
+    PtrBlock<char*> its_Buffer;
+    // The mutex per shard (only used in concurrent mode).
+    PtrBlock<Mutex*> its_ShardMutex;
+    // The mutex serializing the file IO (only used in concurrent mode).
+    Mutex        its_FileMutex;
     // The number of free buckets.
     uInt its_NrOfFree;
     // The first free bucket (-1 = no free buckets).
     Int  its_FirstFree;
-    // The statistics.
-    uInt naccess_p;
-    uInt nread_p;
-    uInt ninit_p;
-    uInt nwrite_p;
+    // The statistics per shard.
+    Block<uInt> naccess_p;
+    Block<uInt> nread_p;
+    Block<uInt> ninit_p;
+    Block<uInt> nwrite_p;
 
 
     // Copy constructor is not possible.
@@ -377,12 +475,32 @@ private:
     // Assignment is not possible.
     BucketCache& operator= (const BucketCache&);
 
-    // Set the LRU information for the current slot.
-    void setLRU();
+    // Get the shard a bucket belongs to.
+    uInt shardOf (uInt bucketNr) const;
+
+    // Create the conversion buffer and mutex of each shard.
+    void createShards();
+
+    // Allocate the slots and statistics of the shards and clear them.
+    void setupShards();
 
-    // Get a cache slot for the bucket.
+    // Delete the shard mutexes and conversion buffers.
+    void deleteShards();
+
+    // Set the LRU information for the given slot.
+    void setLRU (uInt slotNr);
+
+    // Get a cache slot for the bucket and make it the current one.
     void getSlot (uInt bucketNr);
 
+    // Get a cache slot for the bucket in its shard and return its number.
+    // It does not change the current slot.
+    uInt findSlot (uInt bucketNr);
+
+    // Get the bucket (without any locking). If needed, it is read
+    // or initialized. It returns the slot number.
+    uInt accessBucket (uInt bucketNr);
+
     // Write a bucket.
     void writeBucket (uInt slotNr);
 
@@ -403,6 +521,15 @@ private:
 inline uInt BucketCache::cacheSize() const
     { return its_CacheSize; }
 
+inline uInt BucketCache::nShard() const
+    { return its_NShard; }
+
+inline Bool BucketCache::isConcurrent() const
+    { return its_NShard > 1; }
+
+inline uInt BucketCache::shardOf (uInt bucketNr) const
+    { return bucketNr % its_NShard; }
+
 inline Int BucketCache::firstFreeBucket() const
     { return its_FirstFree; }
 
@@ -40,6 +40,7 @@ void a (Bool);
 void b (Bool);
 void c (uInt bufSize);
 void d (uInt bufSize);
+void e();
 
 int main (int argc, const char*[])
 {
@@ -54,6 +55,7 @@ int main (int argc, const char*[])
 //	d (1024);
 //	d (32768);
 //	d (327680);
+	e();
     } catch (AipsError x) {
 	cout << "Caught an exception: " << x.getMesg() << endl;
 	return 1;
@@ -256,3 +258,53 @@ void d (uInt)
     timer.show();
     cout << "<<<" << endl;
 }
+
+// Test a concurrent cache.
+void e()
+{
+    // Open the file.
+    BucketFile file("tBucketCache_tmp.data", False);
+    file.open();
+    Int rec[128];
+    file.read ((char*)rec, 512);
+    BucketCache cache (&file, 512, 32768, rec[0], 8, 0, aToLocal, aFromLocal,
+		       aInitBuffer, aDeleteBuffer);
+    cache.setConcurrency (4);
+    cout << "concurrent cache with " << cache.nShard() << " shards" << endl;
+    // Read the buckets in parallel.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (Int i=0; i<100; i++) {
+	char* buf = cache.pinBucket(i+5);
+	if (*(Int*)buf != i+1  ||  *(Int*)(buf+32760) != i+10) {
+	    cout << "Error in bucket " << i+5 << endl;
+	}
+	cache.unpinBucket(i+5);
+    }
+    // All slots of a shard pinned should give an exception.
+    cache.pinBucket (0);
+    cache.pinBucket (4);
+    try {
+        cache.pinBucket (8);
+    } catch (AipsError& x) {
+        cout << x.getMesg() << endl;
+    }
+    cache.unpinBucket (0);
+    cache.unpinBucket (4);
+    try {
+        cache.unpinBucket (4);
+    } catch (AipsError& x) {
+        cout << x.getMesg() << endl;
+    }
+    // Read sequentially (twice) to get deterministic statistics.
+    cache.clear();
+    for (uInt j=0; j<2; j++) {
+	for (uInt i=5; i<13; i++) {
+	    cache.pinBucket(i);
+	    cache.unpinBucket(i);
+	}
+    }
+    cache.getBucket(13);
+    cache.showStatistics (cout);
+}
@@ -254,6 +254,18 @@ LogIO &operator<<(LogIO &os, Long item)
     return os;
 }
 
+LogIO &operator<<(LogIO &os, uInt64 item)
+{
+    os.output() << item;
+    return os;
+}
+
+LogIO &operator<<(LogIO &os, Int64 item)
+{
+    os.output() << item;
+    return os;
+}
+
 LogIO &operator<<(LogIO &os, Bool item)
 {
     os.output() << (item ? 1:0);
@@ -294,6 +294,8 @@ LogIO &operator<<(LogIO &os, Int item);
 LogIO &operator<<(LogIO &os, uInt item);
 LogIO &operator<<(LogIO &os, uLong item);
 LogIO &operator<<(LogIO &os, Long item);
+LogIO &operator<<(LogIO &os, uInt64 item);
+LogIO &operator<<(LogIO &os, Int64 item);
 LogIO &operator<<(LogIO &os, Bool item);
 LogIO &operator<<(LogIO &os, ostream &(*item)(ostream &));
 // </group>
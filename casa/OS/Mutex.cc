@@ -28,10 +28,13 @@
 #include <casacore/casa/OS/Mutex.h>
 #include <errno.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <iostream>
 
 //# Define a macro to cast the void* to pthread_mutex_t*.
 #define ITSMUTEX \
   (static_cast<pthread_mutex_t*>(itsMutex))
+#define ITSCOND \
+  (static_cast<pthread_cond_t*>(itsCond))
 
 namespace casacore {
 
@@ -113,6 +116,44 @@ namespace casacore {
     }
   }
 
+
+  Condition::Condition()
+  {
+    itsCond = new pthread_cond_t;
+    int error = pthread_cond_init (ITSCOND, 0);
+    if (error != 0) throw SystemCallError ("pthread_cond_init", error);
+  }
+
+  Condition::~Condition()
+  {
+    // A destructor cannot throw, so only report an error.
+    int error = pthread_cond_destroy (ITSCOND);
+    if (error != 0) {
+      std::cerr << "~Condition: pthread_cond_destroy error "
+                << error << std::endl;
+    }
+    delete ITSCOND;
+  }
+
+  void Condition::wait (Mutex& mutex)
+  {
+    int error = pthread_cond_wait
+      (ITSCOND, static_cast<pthread_mutex_t*>(mutex.itsMutex));
+    if (error != 0) throw SystemCallError ("pthread_cond_wait", error);
+  }
+
+  void Condition::signal()
+  {
+    int error = pthread_cond_signal (ITSCOND);
+    if (error != 0) throw SystemCallError ("pthread_cond_signal", error);
+  }
+
+  void Condition::broadcast()
+  {
+    int error = pthread_cond_broadcast (ITSCOND);
+    if (error != 0) throw SystemCallError ("pthread_cond_broadcast", error);
+  }
+
 #else
 
   Mutex::Mutex (Mutex::Type)
@@ -126,6 +167,17 @@ namespace casacore {
   Bool Mutex::trylock()
   { return True; }
 
+  Condition::Condition()
+    : itsCond(0) {}
+  Condition::~Condition()
+  {}
+  void Condition::wait (Mutex&)
+  {}
+  void Condition::signal()
+  {}
+  void Condition::broadcast()
+  {}
+
 #endif
 
 
@@ -71,6 +71,9 @@ namespace casacore {
     bool trylock();
 
   private:
+    // A Condition needs access to the underlying mutex.
+    friend class Condition;
+
     // Forbid copy constructor.
     Mutex (const Mutex&);
     // Forbid assignment.
@@ -116,6 +119,63 @@ namespace casacore {
   };
 
 
+  // <summary>Wrapper around a pthreads condition variable</summary>
+  // <use visibility=export>
+  //
+  // <reviewed reviewer="UNKNOWN" date="before2004/08/25" tests="" demos="">
+  // </reviewed>
+  //
+  // <synopsis>
+  // This class is a wrapper around a pthreads condition variable.
+  // It makes it possible for a thread to wait until another thread
+  // signals that the shared state (protected by a Mutex) has changed.
+  // <br>As usual for condition variables, the waiting thread should test
+  // the state in a loop, because spurious wakeups can occur.
+  // <br>If casacore is built without thread support, the functions are
+  // no-ops. In that case no other thread can exist to change the state.
+  // </synopsis>
+  //
+  // <example>
+  // <srcblock>
+  // ScopedMutexLock lock(mutex);
+  // while (queue.empty()) {
+  //   condition.wait (mutex);
+  // }
+  // </srcblock>
+  // </example>
+
+  class Condition
+  {
+  public:
+    // Create the condition variable.
+    Condition();
+
+    // Destroy the condition variable.
+    ~Condition();
+
+    // Wait until the condition is signaled.
+    // The mutex must be locked by the calling thread. It is unlocked
+    // while waiting and locked again before the function returns.
+    void wait (Mutex& mutex);
+
+    // Wake up one of the waiting threads.
+    void signal();
+
+    // Wake up all waiting threads.
+    void broadcast();
+
+  private:
+    // Forbid copy constructor.
+    Condition (const Condition&);
+    // Forbid assignment.
+    Condition& operator= (const Condition&);
+
+    //# Data members
+    //# Use void*, because we cannot forward declare pthread_cond_t.
+    void* itsCond;
+  };
+
+
   // <summary>Thread-safe initialization of global variables</summary>
   // <use visibility=export>
   //
@@ -152,6 +152,49 @@ void testNormal()
   mutex.unlock();
 }
 
+// Test a condition variable by passing values from a producer to a consumer.
+void testCondition()
+{
+  cout << "Test Condition ..." << endl;
+  Mutex mutex;
+  Condition cond;
+  int value = 0;
+  int sum   = 0;
+#ifdef _OPENMP
+#pragma omp parallel sections num_threads(2)
+#endif
+  {
+#ifdef _OPENMP
+#pragma omp section
+#endif
+    {
+      for (int i=1; i<=10; ++i) {
+        ScopedMutexLock lock(mutex);
+        while (value != 0) {
+          cond.wait (mutex);
+        }
+        value = i;
+        cond.broadcast();
+      }
+    }
+#ifdef _OPENMP
+#pragma omp section
+#endif
+    {
+      for (int i=1; i<=10; ++i) {
+        ScopedMutexLock lock(mutex);
+        while (value == 0) {
+          cond.wait (mutex);
+        }
+        sum += value;
+        value = 0;
+        cond.broadcast();
+      }
+    }
+  }
+  AlwaysAssertExit (sum == 55);
+}
+
 void testMutexedInitFunc (void* arg)
 {
   int* count = static_cast<int*>(arg);
@@ -193,6 +236,9 @@ int main()
     testRecursive();
     testNormal();
     testMutexedInitParallel();
+#ifdef _OPENMP
+    testCondition();
+#endif
 #endif
   } catch (AipsError& x) {
     cout << "Caught an exception: " << x.getMesg() << endl;
@@ -327,8 +327,15 @@ public:
     // is resized to that number.
     // <br> By default it'll try if the faster GenSortIndirect can be used
     // if a sort on a single key is used.
+    // <br>The 64-bit version makes it possible to sort more than 4 billion
+    // records (e.g. the rows in a table). Note that it does not try
+    // to use GenSortIndirect.
+    // <group>
     uInt sort (Vector<uInt>& indexVector, uInt nrrec,
 	       int options = DefaultSort, Bool tryGenSort = True) const;
+    uInt64 sort (Vector<uInt64>& indexVector, uInt64 nrrec,
+                 int options = DefaultSort, Bool tryGenSort = True) const;
+    // </group>
 
     // Get all unique records in a sorted array. The array order is
     // given in the indexVector (as possibly returned by the sort function).
@@ -346,6 +353,9 @@ public:
     uInt unique (Vector<uInt>& uniqueVector, uInt nrrec) const;
     uInt unique (Vector<uInt>& uniqueVector,
 		 const Vector<uInt>& indexVector) const;
+    uInt64 unique (Vector<uInt64>& uniqueVector, uInt64 nrrec) const;
+    uInt64 unique (Vector<uInt64>& uniqueVector,
+                   const Vector<uInt64>& indexVector) const;
     // </group>
 
 private:
@@ -358,41 +368,66 @@ private:
     void addKey (SortKey*);
     // </group>
 
+    // Do the sort or unique for the given index type.
+    // <group>
+    template<typename T>
+    T doSort (Vector<T>& indexVector, T nrrec,
+              int options, Bool tryGenSort) const;
+    template<typename T>
+    T doUnique (Vector<T>& uniqueVector, const Vector<T>& indexVector) const;
+    // </group>
+
     // Do an insertion sort, optionally skipping duplicates.
     // <group>
-    uInt insSort (uInt nr, uInt* indices) const;
-    uInt insSortNoDup (uInt nr, uInt* indices) const;
+    template<typename T>
+    T insSort (T nr, T* indices) const;
+    template<typename T>
+    T insSortNoDup (T nr, T* indices) const;
     // </group>
 
     // Do a merge sort, if possible in parallel using OpenMP.
     // Note that the env.var. OMP_NUM_TRHEADS sets the maximum nr of threads
     // to use. It defaults to the number of cores.
-    uInt parSort (int nthr, uInt nrrec, uInt* inx) const;
-    void merge (uInt* inx, uInt* tmp, uInt size, uInt* index,
-                uInt nparts) const;
+    template<typename T>
+    T parSort (int nthr, T nrrec, T* inx) const;
+    template<typename T>
+    void merge (T* inx, T* tmp, T size, T* index,
+                T nparts) const;
 
     // Do a quicksort, optionally skipping duplicates
     // (qkSort is the actual quicksort function).
     // <group>
-    uInt quickSort (uInt nr, uInt* indices) const;
-    uInt quickSortNoDup (uInt nr, uInt* indices) const;
-    void qkSort (Int nr, uInt* indices) const;
+    template<typename T>
+    T quickSort (T nr, T* indices) const;
+    template<typename T>
+    T quickSortNoDup (T nr, T* indices) const;
+    template<typename T>
+    void qkSort (Int64 nr, T* indices) const;
     // </group>
 
     // Do a heapsort, optionally skipping duplicates.
     // <group>
-    uInt heapSort (uInt nr, uInt* indices) const;
-    uInt heapSortNoDup (uInt nr, uInt* indices) const;
+    template<typename T>
+    T heapSort (T nr, T* indices) const;
+    template<typename T>
+    T heapSortNoDup (T nr, T* indices) const;
     // </group>
 
     // Siftdown algorithm for heapsort.
-    void siftDown (Int low, Int up, uInt* indices) const;
+    template<typename T>
+    void siftDown (Int64 low, Int64 up, T* indices) const;
 
     // Compare the keys of 2 records.
-    int compare (uInt index1, uInt index2) const;
+    int compare (uInt64 index1, uInt64 index2) const;
 
     // Swap 2 indices.
-    inline void swap (Int index1, Int index2, uInt* indices) const;
+    template<typename T>
+    inline void swap (Int64 index1, Int64 index2, T* indices) const
+    {
+        T t = indices[index1];
+        indices[index1] = indices[index2];
+        indices[index2] = t;
+    }
 
 
     PtrBlock<SortKey*> keys_p;                    //# keys to sort on
@@ -404,12 +439,6 @@ private:
 
 
 
-inline void Sort::swap (Int i, Int j, uInt* inx) const
-{
-    uInt t = inx[i];
-    inx[i] = inx[j];
-    inx[j] = t;
-}
 
 
 
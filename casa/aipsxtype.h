@@ -38,6 +38,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 typedef long long Int64;
 typedef unsigned long long uInt64;
 
+// Define the type of a row number in a table.
+typedef uInt64 rownr_t;
+
 //# All FITS code seems to assume longs are 4 bytes. Take care of machines 
 //# for which this isn't true here by defining FitsLong to be the 4 byte int.
 //# Use FitsLong instead of long in the FITS code where it matters.
@@ -48,8 +48,125 @@
 #include <casacore/casa/iomanip.h>  
 #include <casacore/casa/sstream.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// Minimum number of conversions per thread to make it worthwhile
+// to do many wcs conversions in parallel.
+static const uInt theirMinTransformsPerThread = 4096;
+
+// Determine the number of threads to use for nTransforms wcs conversions.
+static uInt nThreadsWCS (uInt nTransforms)
+{
+  uInt nthr = 1;
+#ifdef _OPENMP
+  if (! omp_in_parallel()) {
+    nthr = std::min (uInt(omp_get_max_threads()),
+                     nTransforms / theirMinTransformsPerThread);
+    nthr = std::max (nthr, 1u);
+  }
+#endif
+  return nthr;
+}
+
+// Tell if all axes in the (set) wcs structure are linear.
+// For such axes the conversion is a simple affine transformation
+// world = crval + cdelt*pc*(pixel-crpix), which can be done much faster
+// than by wcslib. Note that the 100s digit of wcs.types is 0 for
+// linear axes (including spectral axes without an algorithm code).
+static Bool isLinearWCS (const ::wcsprm& wcs)
+{
+  for (Int i=0; i<wcs.naxis; ++i) {
+    if ((wcs.types[i] / 100) % 10 != 0) {
+      return False;
+    }
+  }
+  return True;
+}
+
+// Fill the matrix (in row-major order) of the linear transformation
+// from pixel to intermediate world coordinates or its inverse.
+// wcslib does not fill it if PC is the unit matrix.
+static void linearMatrixWCS (Block<Double>& mat, const ::wcsprm& wcs,
+                             Bool toWorld)
+{
+  const uInt nAxes = wcs.naxis;
+  mat.resize (nAxes*nAxes, True, False);
+  if (wcs.lin.unity) {
+    mat = 0.;
+    for (uInt i=0; i<nAxes; ++i) {
+      mat[i*nAxes+i] = (toWorld  ?  wcs.lin.cdelt[i] : 1./wcs.lin.cdelt[i]);
+    }
+  } else {
+    const Double* m = (toWorld  ?  wcs.lin.piximg : wcs.lin.imgpix);
+    for (uInt i=0; i<nAxes*nAxes; ++i) {
+      mat[i] = m[i];
+    }
+  }
+}
+
+// Do the affine transformation out = outRef + mat*(in - inRef)
+// for a matrix of nAxes x nTransforms positions.
+// The loops are written such that the compiler can vectorize them.
+static void affineWCS (Double* out, const Double* in, uInt nAxes,
+                       uInt nTransforms, const Double* mat,
+                       const Double* inRef, const Double* outRef)
+{
+  if (nAxes == 1) {
+    const Double scale = mat[0];
+    const Double offset = outRef[0] - scale*inRef[0];
+    for (uInt j=0; j<nTransforms; ++j) {
+      out[j] = offset + scale*in[j];
+    }
+  } else if (nAxes == 2) {
+    const Double m00=mat[0], m01=mat[1], m10=mat[2], m11=mat[3];
+    const Double r0=inRef[0], r1=inRef[1];
+    const Double o0=outRef[0], o1=outRef[1];
+    for (uInt j=0; j<2*nTransforms; j+=2) {
+      const Double d0 = in[j] - r0;
+      const Double d1 = in[j+1] - r1;
+      out[j]   = o0 + m00*d0 + m01*d1;
+      out[j+1] = o1 + m10*d0 + m11*d1;
+    }
+  } else {
+    for (uInt j=0; j<nTransforms; ++j) {
+      const Double* pin = in + j*nAxes;
+      Double* pout = out + j*nAxes;
+      for (uInt i=0; i<nAxes; ++i) {
+        Double sum = outRef[i];
+        const Double* m = mat + i*nAxes;
+        for (uInt k=0; k<nAxes; ++k) {
+          sum += m[k] * (pin[k] - inRef[k]);
+        }
+        pout[i] = sum;
+      }
+    }
+  }
+}
+
+// Make a copy of the wcs structure and set it, so it can be used
+// by a thread. It is done in a critical section, because the wcslib
+// unit parser used by wcsset is not reentrant.
+static int copyWCS (::wcsprm& wcsCopy, const ::wcsprm& wcs)
+{
+  int iret;
+#ifdef _OPENMP
+#pragma omp critical(casacore_Coordinate_copyWCS)
+#endif
+  {
+    wcsCopy.flag = -1;
+    iret = wcscopy (1, &wcs, &wcsCopy);
+    if (iret == 0) {
+      iret = wcsset (&wcsCopy);
+    }
+  }
+  return iret;
+}
+
+
 Coordinate::Coordinate()
 : worldMin_p(0),
   worldMax_p(0)
@@ -1036,6 +1153,25 @@ Bool Coordinate::toWorldManyWCS (Matrix<Double>& world, const Matrix<Double>& pi
     world.resize(pixel.shape());
     failures.resize(nTransforms);
 
+// Purely linear axes are converted by an affine transformation.
+
+    if (! setWCSIfNeeded (wcs)) {
+        return False;
+    }
+    if (isLinearWCS (wcs)) {
+        Block<Double> mat;
+        linearMatrixWCS (mat, wcs, True);
+        Bool deleteWorld, deletePixel;
+        Double* pWorld = world.getStorage(deleteWorld);
+        const Double* pPixel = pixel.getStorage(deletePixel);
+        affineWCS (pWorld, pPixel, nAxes, nTransforms, mat.storage(),
+                   wcs.crpix, wcs.crval);
+        pixel.freeStorage(pPixel, deletePixel);
+        world.putStorage(pWorld, deleteWorld);
+        failures = False;
+        return True;
+    }
+
 // Generate pointers and intermediaries for wcs
 
     Bool deleteWorld, deletePixel;
@@ -1055,7 +1191,36 @@ Bool Coordinate::toWorldManyWCS (Matrix<Double>& world, const Matrix<Double>& pi
     Double* pTheta = theta.getStorage(deleteTheta);    
     Int* pStat = stat.getStorage(deleteStat);    
 //
-    int iret = wcsp2s (&wcs, nTransforms, nAxes, pPixel, pImgCrd, pPhi, pTheta, pWorld, pStat);
+    int iret = 0;
+    const uInt nthr = nThreadsWCS (nTransforms);
+    if (nthr <= 1) {
+       iret = wcsp2s (&wcs, nTransforms, nAxes, pPixel, pImgCrd, pPhi, pTheta, pWorld, pStat);
+    } else {
+
+// Split the columns in chunks; each thread uses its own copy of the
+// wcs structure, because wcslib can change it.
+
+       Block<int> irets(nthr, 0);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthr)
+#endif
+       for (Int thr=0; thr<Int(nthr); ++thr) {
+          const uInt st  = uInt(uInt64(nTransforms) * thr / nthr);
+          const uInt end = uInt(uInt64(nTransforms) * (thr+1) / nthr);
+          ::wcsprm wcsCopy;
+          int ierr = copyWCS (wcsCopy, wcs);
+          if (ierr == 0) {
+             ierr = wcsp2s (&wcsCopy, end-st, nAxes, pPixel + st*nAxes,
+                            pImgCrd + st*nAxes, pPhi + st, pTheta + st,
+                            pWorld + st*nAxes, pStat + st);
+          }
+          wcsfree (&wcsCopy);
+          irets[thr] = ierr;
+       }
+       for (uInt thr=0; thr<nthr && iret==0; ++thr) {
+          iret = irets[thr];
+       }
+    }
     for (uInt i=0; i<nTransforms; i++) {
        failures[i] = pStat[i]!=0;
     }
@@ -1087,6 +1252,25 @@ Bool Coordinate::toPixelManyWCS (Matrix<Double>& pixel, const Matrix<Double>& wo
     pixel.resize(world.shape());
     failures.resize(nTransforms);
 
+// Purely linear axes are converted by an affine transformation.
+
+    if (! setWCSIfNeeded (wcs)) {
+        return False;
+    }
+    if (isLinearWCS (wcs)) {
+        Block<Double> mat;
+        linearMatrixWCS (mat, wcs, False);
+        Bool deleteWorld, deletePixel;
+        Double* pPixel = pixel.getStorage(deletePixel);
+        const Double* pWorld = world.getStorage(deleteWorld);
+        affineWCS (pPixel, pWorld, nAxes, nTransforms, mat.storage(),
+                   wcs.crval, wcs.crpix);
+        world.freeStorage(pWorld, deleteWorld);
+        pixel.putStorage(pPixel, deletePixel);
+        failures = False;
+        return True;
+    }
+
 // Generate wcs pointers and intermediaries
 
     Bool deleteWorld, deletePixel;
@@ -1106,8 +1290,37 @@ Bool Coordinate::toPixelManyWCS (Matrix<Double>& pixel, const Matrix<Double>& wo
 
 // Convert from wcs units to pixel
 
-    const int nC = nTransforms;
-    int iret = wcss2p (&wcs, nC, nAxes, pWorld, pPhi, pTheta, pImgCrd, pPixel, pStat);
+    int iret = 0;
+    const uInt nthr = nThreadsWCS (nTransforms);
+    if (nthr <= 1) {
+       const int nC = nTransforms;
+       iret = wcss2p (&wcs, nC, nAxes, pWorld, pPhi, pTheta, pImgCrd, pPixel, pStat);
+    } else {
+
+// Split the columns in chunks; each thread uses its own copy of the
+// wcs structure, because wcslib can change it.
+
+       Block<int> irets(nthr, 0);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthr)
+#endif
+       for (Int thr=0; thr<Int(nthr); ++thr) {
+          const uInt st  = uInt(uInt64(nTransforms) * thr / nthr);
+          const uInt end = uInt(uInt64(nTransforms) * (thr+1) / nthr);
+          ::wcsprm wcsCopy;
+          int ierr = copyWCS (wcsCopy, wcs);
+          if (ierr == 0) {
+             ierr = wcss2p (&wcsCopy, end-st, nAxes, pWorld + st*nAxes,
+                            pPhi + st, pTheta + st, pImgCrd + st*nAxes,
+                            pPixel + st*nAxes, pStat + st);
+          }
+          wcsfree (&wcsCopy);
+          irets[thr] = ierr;
+       }
+       for (uInt thr=0; thr<nthr && iret==0; ++thr) {
+          iret = irets[thr];
+       }
+    }
     for (uInt i=0; i<nTransforms; i++) {
        failures[i] = pStat[i]!=0;
     }
@@ -1248,5 +1461,18 @@ void Coordinate::set_wcs (::wcsprm& wcs)
     }
 }
 
+Bool Coordinate::setWCSIfNeeded (::wcsprm& wcs) const
+{
+    if (wcs.flag != WCSSET) {
+        if (int iret = wcsset(&wcs)) {
+            String errmsg = "wcs wcsset_error: ";
+            errmsg += wcsset_errmsg[iret];
+            set_error(errmsg);
+            return False;
+        }
+    }
+    return True;
+}
+
 } //# NAMESPACE CASACORE - END
 
@@ -507,6 +507,11 @@ protected:
    // Functions to interconvert pixel<->world via wcs.  These functions are called 
    // explicitly by the to{world,Pixel} functions in the appropriate wcs-based derived
    // classes. 
+   // <br>The Many functions convert purely linear axes (e.g. a LinearCoordinate
+   // or a SpectralCoordinate without an algorithm code) directly by an affine
+   // transformation. Otherwise, if compiled with OpenMP, large matrices are split
+   // in chunks converted in parallel, each thread using its own copy of the
+   // wcs structure.
    // <group>
    Bool toWorldWCS (Vector<Double> &world, const Vector<Double> &pixel, wcsprm& wcs) const;
    Bool toPixelWCS(Vector<Double> &pixel,  const Vector<Double> &world, wcsprm& wcs) const;
@@ -551,6 +556,10 @@ protected:
    // Call wcsset on the wcs structure
    void set_wcs (wcsprm& wcs);
 
+   // Call wcsset on the wcs structure if not done yet.
+   // It returns False and sets the error message if wcsset fails.
+   Bool setWCSIfNeeded (wcsprm& wcs) const;
+
     // toMix ranges.  Should be set by derived class.
     Vector<Double> worldMin_p, worldMax_p;
 
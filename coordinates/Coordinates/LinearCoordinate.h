@@ -182,6 +182,21 @@ public:
 			 const Vector<Double> &world) const;
     // </group>
 
+    // Batch up a lot of transformations. The first (most rapidly varying) axis
+    // of the matrices contain the coordinates. Returns False if any conversion
+    // failed  and  <src>errorMessage()</src> will hold a message.
+    // The <src>failures</src> array is the length of the number of conversions
+    // (True for failure, False for success).
+    // A linear transformation is done directly, otherwise wcslib is used.
+    // <group>
+    virtual Bool toWorldMany(Matrix<Double>& world,
+                             const Matrix<Double>& pixel,
+                             Vector<Bool>& failures) const;
+    virtual Bool toPixelMany(Matrix<Double>& pixel,
+                             const Matrix<Double>& world,
+                             Vector<Bool>& failures) const;
+    // </group>
+
 
     // Return the requested attribute
     // <group>
@@ -1311,7 +1311,48 @@ void doit8 ()
       }    
    }
 
+// Many conversions (which can be done in parallel)
 
+   {
+      DirectionCoordinate lc = makeCoordinate(MDirection::J2000,
+                                           proj, crval, crpix,
+                                           cdelt, xform);
+//
+      Vector<Bool> failures, failures2;
+      const Int nCoord = 100000;
+      Matrix<Double> pixel(2, nCoord), pixel2;
+      Matrix<Double> world(2, nCoord);
+      for (Int i=0; i<nCoord; i++) {   
+        pixel(0,i) = (i%500) - 250.5;
+        pixel(1,i) = (i/500) - 100.5;
+      }
+//
+      if (!lc.toWorldMany(world, pixel, failures)) {
+         throw(AipsError(String("toWorldMany conversion failed because ") + lc.errorMessage())); 
+      }
+      if (!lc.toPixelMany(pixel2, world, failures2)) {
+         throw(AipsError(String("toPixelMany conversion failed because ") + lc.errorMessage())); 
+      }
+      if (!allNearAbs(pixel, pixel2, 1e-6)) {
+         throw(AipsError("to{World,Pixel}Many reflection failed"));
+      }
+//
+      Vector<Double> world2, pix2;
+      for (Int i=0; i<nCoord; i+=37) {
+         if (!lc.toWorld(world2, pixel.column(i))) {
+            throw(AipsError(String("toWorld failed because ") + lc.errorMessage())); 
+         }
+         if (!allNear(world2, world.column(i), 1e-10)) {
+            throw(AipsError("World conversions gave wrong results in toWorldMany"));
+         }
+         if (!lc.toPixel(pix2, world.column(i))) {
+            throw(AipsError(String("toPixel failed because ") + lc.errorMessage())); 
+         }
+         if (!allNearAbs(pix2, pixel2.column(i), 1e-10)) {
+            throw(AipsError("Pixel conversions gave wrong results in toPixelMany"));
+         }
+      }    
+   }
 }
 
 void doit9 ()
@@ -47,6 +47,7 @@ LinearCoordinate makeCoordinate(Vector<String>& names,
                                 Vector<Double>& cdelt,
                                 Matrix<Double>& xform,
                                 uInt n=2);
+void checkMany (const LinearCoordinate& lc, uInt nCoord);
 
 int main()
 {
@@ -450,6 +451,22 @@ int main()
      }
 
 //
+// Test many conversions (done by an affine transformation)
+//
+      {
+         for (uInt n=1; n<=3; n++) {
+            LinearCoordinate lc = makeCoordinate(names, units, crpix, crval,
+                                                 cdelt, xform, n);
+            checkMany (lc, 20000);
+            if (n > 1) {
+               xform(0,n-1) = 0.5;
+               xform(n-1,0) = -0.25;
+               LinearCoordinate lc2(names, units, crval, cdelt, xform, crpix);
+               checkMany (lc2, 20000);
+            }
+         }
+      }
+//
 // Test record saving
 //
       {
@@ -525,3 +542,35 @@ LinearCoordinate makeCoordinate (Vector<String>& names,
    return lc;
 }
 
+void checkMany (const LinearCoordinate& lc, uInt nCoord)
+{
+   const uInt n = lc.nPixelAxes();
+   Matrix<Double> pixel(n, nCoord), pixel2, world;
+   for (uInt i=0; i<nCoord; i++) {
+      for (uInt j=0; j<n; j++) {
+         pixel(j,i) = Double(i%1000) - 500 + 0.1*j;
+      }
+   }
+   Vector<Bool> failures, failures2;
+   if (!lc.toWorldMany(world, pixel, failures)) {
+      throw(AipsError(String("toWorldMany conversion failed because ") + lc.errorMessage())); 
+   }
+   if (!lc.toPixelMany(pixel2, world, failures2)) {
+      throw(AipsError(String("toPixelMany conversion failed because ") + lc.errorMessage())); 
+   }
+   if (anyTrue(failures) || anyTrue(failures2)) {
+      throw(AipsError("to{World,Pixel}Many gave failures"));
+   }
+   if (!allNearAbs(pixel, pixel2, 1e-8)) {
+      throw(AipsError("to{World,Pixel}Many reflection failed"));
+   }
+   Vector<Double> world2;
+   for (uInt i=0; i<nCoord; i+=97) {
+      if (!lc.toWorld(world2, pixel.column(i))) {
+         throw(AipsError(String("toWorld failed because ") + lc.errorMessage())); 
+      }
+      if (!allNearAbs(world2, world.column(i), 1e-8)) {
+         throw(AipsError("World conversions gave wrong results in toWorldMany"));
+      }
+   }
+}
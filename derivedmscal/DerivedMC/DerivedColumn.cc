@@ -32,54 +32,99 @@ namespace casacore {
 
   HourangleColumn::~HourangleColumn()
   {}
-  void HourangleColumn::get (uInt rowNr, Double& data)
+  void HourangleColumn::get (rownr_t rowNr, Double& data)
   {
     data = itsEngine->getHA (itsAntNr, rowNr);
   }
+  uInt HourangleColumn::getBlock (rownr_t rowNr, uInt nrmax, Double* dataPtr)
+  {
+    for (uInt i=0; i<nrmax; ++i) {
+      dataPtr[i] = itsEngine->getHA (itsAntNr, rowNr+i);
+    }
+    return nrmax;
+  }
 
   ParAngleColumn::~ParAngleColumn()
   {}
-  void ParAngleColumn::get (uInt rowNr, Double& data)
+  void ParAngleColumn::get (rownr_t rowNr, Double& data)
   {
     data = itsEngine->getPA (itsAntNr, rowNr);
   }
+  uInt ParAngleColumn::getBlock (rownr_t rowNr, uInt nrmax, Double* dataPtr)
+  {
+    for (uInt i=0; i<nrmax; ++i) {
+      dataPtr[i] = itsEngine->getPA (itsAntNr, rowNr+i);
+    }
+    return nrmax;
+  }
 
   LASTColumn::~LASTColumn()
   {}
-  void LASTColumn::get (uInt rowNr, Double& data)
+  void LASTColumn::get (rownr_t rowNr, Double& data)
   {
     data = itsEngine->getLAST (itsAntNr, rowNr);
   }
+  uInt LASTColumn::getBlock (rownr_t rowNr, uInt nrmax, Double* dataPtr)
+  {
+    for (uInt i=0; i<nrmax; ++i) {
+      dataPtr[i] = itsEngine->getLAST (itsAntNr, rowNr+i);
+    }
+    return nrmax;
+  }
 
   HaDecColumn::~HaDecColumn()
   {}
-  IPosition HaDecColumn::shape (uInt)
+  IPosition HaDecColumn::shape (rownr_t)
   {
     return IPosition(1,2);
   }
-  void HaDecColumn::getArray (uInt rowNr, Array<Double>& data)
+  void HaDecColumn::getArray (rownr_t rowNr, Array<Double>& data)
   {
     itsEngine->getHaDec (itsAntNr, rowNr, data);
   }
+  void HaDecColumn::getArrayColumn (Array<Double>& data)
+  {
+    // Let the engine fill the values of each row directly in the array.
+    Bool deleteIt;
+    Double* dataPtr = data.getStorage (deleteIt);
+    rownr_t nrow = data.shape()[1];
+    for (rownr_t i=0; i<nrow; ++i) {
+      Vector<Double> vec(IPosition(1,2), dataPtr + 2*i, SHARE);
+      itsEngine->getHaDec (itsAntNr, i, vec);
+    }
+    data.putStorage (dataPtr, deleteIt);
+  }
 
   AzElColumn::~AzElColumn()
   {}
-  IPosition AzElColumn::shape (uInt)
+  IPosition AzElColumn::shape (rownr_t)
   {
     return IPosition(1,2);
   }
-  void AzElColumn::getArray (uInt rowNr, Array<Double>& data)
+  void AzElColumn::getArray (rownr_t rowNr, Array<Double>& data)
   {
     itsEngine->getAzEl (itsAntNr, rowNr, data);
   }
+  void AzElColumn::getArrayColumn (Array<Double>& data)
+  {
+    // Let the engine fill the values of each row directly in the array.
+    Bool deleteIt;
+    Double* dataPtr = data.getStorage (deleteIt);
+    rownr_t nrow = data.shape()[1];
+    for (rownr_t i=0; i<nrow; ++i) {
+      Vector<Double> vec(IPosition(1,2), dataPtr + 2*i, SHARE);
+      itsEngine->getAzEl (itsAntNr, i, vec);
+    }
+    data.putStorage (dataPtr, deleteIt);
+  }
 
   UVWJ2000Column::~UVWJ2000Column()
   {}
-  IPosition UVWJ2000Column::shape (uInt)
+  IPosition UVWJ2000Column::shape (rownr_t)
   {
     return IPosition(1,3);
   }
-  void UVWJ2000Column::getArray (uInt rowNr, Array<Double>& data)
+  void UVWJ2000Column::getArray (rownr_t rowNr, Array<Double>& data)
   {
     itsEngine->getUVWJ2000 (rowNr, data);
   }
@@ -48,7 +48,8 @@ namespace casacore {
         itsAntNr  (antnr)
     {}
     virtual ~HourangleColumn();
-    virtual void get (uInt rowNr, Double& data);
+    virtual void get (rownr_t rowNr, Double& data);
+    virtual uInt getBlock (rownr_t rowNr, uInt nrmax, Double* dataPtr);
   private:
     MSCalEngine* itsEngine;
     Int          itsAntNr;    //# -1=array 0=antenna1 1=antenna2
@@ -65,7 +66,8 @@ namespace casacore {
         itsAntNr  (antnr)
     {}
     virtual ~LASTColumn();
-    virtual void get (uInt rowNr, Double& data);
+    virtual void get (rownr_t rowNr, Double& data);
+    virtual uInt getBlock (rownr_t rowNr, uInt nrmax, Double* dataPtr);
   private:
     MSCalEngine* itsEngine;
     Int          itsAntNr;    //# -1=array 0=antenna1 1=antenna2
@@ -82,7 +84,8 @@ namespace casacore {
         itsAntNr  (antnr)
     {}
     virtual ~ParAngleColumn();
-    virtual void get (uInt rowNr, Double& data);
+    virtual void get (rownr_t rowNr, Double& data);
+    virtual uInt getBlock (rownr_t rowNr, uInt nrmax, Double* dataPtr);
   private:
     MSCalEngine* itsEngine;
     Int          itsAntNr;    //# 0=antenna1 1=antenna2
@@ -99,8 +102,9 @@ namespace casacore {
         itsAntNr  (antnr)
     {}
     virtual ~HaDecColumn();
-    virtual IPosition shape (uInt rownr);
-    virtual void getArray (uInt rowNr, Array<Double>& data);
+    virtual IPosition shape (rownr_t rownr);
+    virtual void getArray (rownr_t rowNr, Array<Double>& data);
+    virtual void getArrayColumn (Array<Double>& data);
   private:
     MSCalEngine* itsEngine;
     Int          itsAntNr;    //# 0=antenna1 1=antenna2
@@ -117,8 +121,9 @@ namespace casacore {
         itsAntNr  (antnr)
     {}
     virtual ~AzElColumn();
-    virtual IPosition shape (uInt rownr);
-    virtual void getArray (uInt rowNr, Array<Double>& data);
+    virtual IPosition shape (rownr_t rownr);
+    virtual void getArray (rownr_t rowNr, Array<Double>& data);
+    virtual void getArrayColumn (Array<Double>& data);
   private:
     MSCalEngine* itsEngine;
     Int          itsAntNr;    //# 0=antenna1 1=antenna2
@@ -134,8 +139,8 @@ namespace casacore {
       : itsEngine (engine)
     {}
     virtual ~UVWJ2000Column();
-    virtual IPosition shape (uInt rownr);
-    virtual void getArray (uInt rowNr, Array<Double>& data);
+    virtual IPosition shape (rownr_t rownr);
+    virtual void getArray (rownr_t rowNr, Array<Double>& data);
   private:
     MSCalEngine* itsEngine;
   };
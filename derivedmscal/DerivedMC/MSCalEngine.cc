@@ -46,7 +46,8 @@ namespace casacore {
 MSCalEngine::MSCalEngine()
   : itsLastCalInx   (-1),
     itsReadFieldDir (True),
-    itsDirColName   ("PHASE_DIR")
+    itsDirColName   ("PHASE_DIR"),
+    itsCacheSize    (100000)
 {}
 
 MSCalEngine::~MSCalEngine()
@@ -65,44 +66,102 @@ void MSCalEngine::setTable (const Table& table)
     itsFieldDir.clear();
   }
   itsCalIdMap.clear();
+  itsCache.clear();
 }
 
-double MSCalEngine::getHA (Int antnr, uInt rownr)
+void MSCalEngine::setCacheSize (uInt size)
 {
-  setData (antnr, rownr);
-  return itsRADecToHADec().getValue().get()[0];
+  itsCacheSize = size;
+  if (itsCache.size() > size) {
+    itsCache.clear();
+  }
 }
 
-void MSCalEngine::getHaDec (Int antnr, uInt rownr, Array<double>& data)
+MSCalEngine::CacheValue& MSCalEngine::getCacheValue()
+{
+  if (itsCacheSize == 0) {
+    itsNoCache.filled = 0;
+    return itsNoCache;
+  }
+  CacheKey key;
+  key.time    = itsLastTime;
+  key.calInx  = itsLastCalInx;
+  key.antId   = itsLastAntId;
+  key.fieldId = itsLastFieldId;
+  // Simply clear the cache if it gets too large. Usually the rows are
+  // in time order, so the older entries are not needed anymore.
+  if (itsCache.size() >= itsCacheSize  &&  itsCache.find(key) == itsCache.end()) {
+    itsCache.clear();
+  }
+  return itsCache[key];
+}
+
+double MSCalEngine::getHA (Int antnr, rownr_t rownr)
+{
+  return getHaDecValue(antnr, rownr).haDec[0];
+}
+
+void MSCalEngine::getHaDec (Int antnr, rownr_t rownr, Array<double>& data)
+{
+  CacheValue& value = getHaDecValue (antnr, rownr);
+  data = Vector<Double>(IPosition(1,2), value.haDec, SHARE);
+}
+
+MSCalEngine::CacheValue& MSCalEngine::getHaDecValue (Int antnr,
+                                                     rownr_t rownr)
 {
   setData (antnr, rownr);
-  data = itsRADecToHADec().getValue().get();
+  CacheValue& value = getCacheValue();
+  if ((value.filled & HADEC) == 0) {
+    Vector<Double> haDec = itsRADecToHADec().getValue().get();
+    value.haDec[0] = haDec[0];
+    value.haDec[1] = haDec[1];
+    value.filled |= HADEC;
+  }
+  return value;
 }
 
-double MSCalEngine::getPA (Int antnr, uInt rownr)
+double MSCalEngine::getPA (Int antnr, rownr_t rownr)
 {
   Int mount = setData (antnr, rownr);
-  if (mount == 1) {
-    // Do the conversions using the machines.
-    return itsRADecToAzEl().getValue().positionAngle
-      (itsPoleToAzEl().getValue());
+  CacheValue& value = getCacheValue();
+  if ((value.filled & PA) == 0) {
+    value.pa = 0.;
+    if (mount == 1) {
+      // Do the conversions using the machines.
+      value.pa = itsRADecToAzEl().getValue().positionAngle
+        (itsPoleToAzEl().getValue());
+    }
+    value.filled |= PA;
   }
-  return 0.;
+  return value.pa;
 }
 
-double MSCalEngine::getLAST (Int antnr, uInt rownr)
+double MSCalEngine::getLAST (Int antnr, rownr_t rownr)
 {
   setData (antnr, rownr);
-  return itsUTCToLAST().getValue().get();
+  CacheValue& value = getCacheValue();
+  if ((value.filled & LAST) == 0) {
+    value.last = itsUTCToLAST().getValue().get();
+    value.filled |= LAST;
+  }
+  return value.last;
 }
 
-void MSCalEngine::getAzEl (Int antnr, uInt rownr, Array<double>& data)
+void MSCalEngine::getAzEl (Int antnr, rownr_t rownr, Array<double>& data)
 {
   setData (antnr, rownr);
-  data = itsRADecToAzEl().getValue().get();
+  CacheValue& value = getCacheValue();
+  if ((value.filled & AZEL) == 0) {
+    Vector<Double> azEl = itsRADecToAzEl().getValue().get();
+    value.azEl[0] = azEl[0];
+    value.azEl[1] = azEl[1];
+    value.filled |= AZEL;
+  }
+  data = Vector<Double>(IPosition(1,2), value.azEl, SHARE);
 }
 
-void MSCalEngine::getUVWJ2000 (uInt rownr, Array<double>& data)
+void MSCalEngine::getUVWJ2000 (rownr_t rownr, Array<double>& data)
 {
   setData (1, rownr);
   Int ant1 = itsAntCol[0](rownr);
@@ -138,15 +197,17 @@ void MSCalEngine::setDirection (const MDirection& dir)
   itsFieldDir[0].resize (1);
   itsFieldDir[0][0] = dir;
   itsReadFieldDir = False;
+  itsCache.clear();
 }
 
 void MSCalEngine::setDirColName (const String& colName)
 {
   itsDirColName = colName;
   itsReadFieldDir = True;
+  itsCache.clear();
 }
 
-Int MSCalEngine::setData (Int antnr, uInt rownr)
+Int MSCalEngine::setData (Int antnr, rownr_t rownr)
 {
   // Initialize if not done yet.
   if (itsLastCalInx < 0) {
@@ -102,6 +102,14 @@ namespace casacore {
 // The engine can also be used for old CASA Calibration Tables. It understands
 // how they reference the MeasurementSets. Because these calibration tables
 // contain no ANTENNA2 columns, columns XX2 are the same as XX1.
+//
+// The values only depend on time, antenna (or array center), field, and
+// CAL_DESC_ID (for calibration tables). Because many rows (baselines)
+// share the same antenna at a given time, the calculated values are kept
+// in a cache with that key, so the conversions are done only once per
+// antenna per time. The cache is cleared when it exceeds the maximum size
+// (see <src>setCacheSize</src>; default 100000 entries) and when the table
+// or direction is changed.
 // </synopsis>
 
 // <motivation>
@@ -132,24 +140,56 @@ public:
   void setDirColName (const String& colName);
 
   // Get the hourangle for the given row.
-  double getHA (Int antnr, uInt rownr);
+  double getHA (Int antnr, rownr_t rownr);
 
   // Get the hourangle/DEC for the given row.
-  void getHaDec (Int antnr, uInt rownr, Array<Double>&);
+  void getHaDec (Int antnr, rownr_t rownr, Array<Double>&);
 
   // Get the parallatic angle for the given row.
-  double getPA (Int antnr, uInt rownr);
+  double getPA (Int antnr, rownr_t rownr);
 
   // Get the local sidereal time for the given row.
-  double getLAST (Int antnr, uInt rownr);
+  double getLAST (Int antnr, rownr_t rownr);
 
   // Get the azimuth/elevation for the given row.
-  void getAzEl (Int antnr, uInt rownr, Array<Double>&);
+  void getAzEl (Int antnr, rownr_t rownr, Array<Double>&);
 
   // Get the UVW in J2000 for the given row.
-  void getUVWJ2000 (uInt rownr, Array<Double>&);
+  void getUVWJ2000 (rownr_t rownr, Array<Double>&);
+
+  // Set the maximum number of entries in the cache of calculated values.
+  // A size 0 means that no cache is used.
+  void setCacheSize (uInt size);
 
 private:
+  // The values kept in the cache for a given key.
+  // The mask tells which values have been calculated.
+  struct CacheValue {
+    CacheValue() : filled(0) {}
+    Double haDec[2];
+    Double azEl[2];
+    Double pa;
+    Double last;
+    uInt   filled;
+  };
+  // The key of the cache; it is the state set by setData.
+  struct CacheKey {
+    Double time;
+    Int    calInx;
+    Int    antId;
+    Int    fieldId;
+    Bool operator< (const CacheKey& that) const
+    {
+      if (time    != that.time)    return time    < that.time;
+      if (calInx  != that.calInx)  return calInx  < that.calInx;
+      if (antId   != that.antId)   return antId   < that.antId;
+      return fieldId < that.fieldId;
+    }
+  };
+  // Bits telling which values are filled in a CacheValue.
+  enum CacheMask {HADEC=1, AZEL=2, PA=4, LAST=8};
+
+
   // Copy constructor cannot be used.
   MSCalEngine (const MSCalEngine& that);
 
@@ -158,7 +198,14 @@ private:
   
   // Set the data in the measure converter machines.
   // It returns the mount of the antenna.
-  Int setData (Int antnr, uInt rownr);
+  Int setData (Int antnr, rownr_t rownr);
+
+  // Get the cache entry for the state set by the last setData.
+  // If the cache is not used, the entry is emptied.
+  CacheValue& getCacheValue();
+
+  // Get the cache entry for the given row with the hourangle/DEC filled in.
+  CacheValue& getHaDecValue (Int antnr, rownr_t rownr);
 
   // Initialize the column objects, etc.
   void init();
@@ -209,6 +256,9 @@ private:
   MBaseline::Convert          itsBLToJ2000;    //# convert ITRF to J2000
   MeasFrame                   itsFrame;        //# frame used by the converters
   MDirection                  itsLastDirJ2000; //# itsLastFieldId dir in J2000
+  map<CacheKey,CacheValue>    itsCache;        //# calculated values
+  uInt                        itsCacheSize;    //# max nr of cache entries
+  CacheValue                  itsNoCache;      //# entry if no cache is used
 };
 
 
@@ -26,6 +26,7 @@
 //# $Id: tDerivedMSCal.cc 21521 2014-12-10 08:06:42Z gervandiepen $
 
 #include <casacore/derivedmscal/DerivedMC/DerivedMSCal.h>
+#include <casacore/derivedmscal/DerivedMC/MSCalEngine.h>
 #include <casacore/ms/MSOper/MSDerivedValues.h>
 #include <casacore/ms/MeasurementSets/MeasurementSet.h>
 #include <casacore/ms/MeasurementSets/MSMainColumns.h>
@@ -88,6 +89,32 @@ void check (uInt rownr,
   }
 }
 
+// Check that all values calculated by an engine using a cache are the
+// same as calculated by an engine without a cache.
+// All rows are done twice, so the second time the values come from the cache.
+void checkCache (MSCalEngine& cached, MSCalEngine& fresh, uInt nrow)
+{
+  for (uInt pass=0; pass<2; ++pass) {
+    for (uInt i=0; i<nrow; ++i) {
+      for (Int antnr=-1; antnr<2; ++antnr) {
+        AlwaysAssertExit (near(cached.getHA(antnr,i),
+                               fresh.getHA(antnr,i), 1e-10));
+        AlwaysAssertExit (near(cached.getPA(antnr,i),
+                               fresh.getPA(antnr,i), 1e-10));
+        AlwaysAssertExit (near(cached.getLAST(antnr,i),
+                               fresh.getLAST(antnr,i), 1e-10));
+        Array<Double> cval, fval;
+        cached.getHaDec (antnr, i, cval);
+        fresh.getHaDec (antnr, i, fval);
+        AlwaysAssertExit (allNear(cval, fval, 1e-10));
+        cached.getAzEl (antnr, i, cval);
+        fresh.getAzEl (antnr, i, fval);
+        AlwaysAssertExit (allNear(cval, fval, 1e-10));
+      }
+    }
+  }
+}
+
 int main(int argc, char* argv[])
 {
   try {
@@ -172,7 +199,7 @@ int main(int argc, char* argv[])
     mdv.setObservatoryPosition (arrayPos);
     // Now loop through quite some rows and compare result of DerivedMSCal
     // with MSDerivedValues.
-    uInt nr = std::max(tab.nrow(), 1000u);
+    uInt nr = std::max(tab.nrow(), rownr_t(1000));
     Int lastFldId = -1;
     for (uInt i=0; i<nr; ++i) {
       Int fldId = fld(i);
@@ -191,6 +218,50 @@ int main(int argc, char* argv[])
         check (i, uvw, uvwJ2000);
       }
     }
+    // Check that getting entire columns gives the same result.
+    {
+      Vector<double> haCol = ha1.getColumn();
+      Vector<double> paCol = pa1.getColumn();
+      Array<double> azelCol = azel1.getColumn();
+      for (uInt i=0; i<tab.nrow(); ++i) {
+        AlwaysAssertExit (near(haCol[i], ha1(i), 1e-10));
+        AlwaysAssertExit (near(paCol[i], pa1(i), 1e-10));
+      }
+      AlwaysAssertExit (azelCol.shape() == IPosition(2, 2, tab.nrow()));
+      for (uInt i=0; i<tab.nrow(); ++i) {
+        AlwaysAssertExit (allNear(azelCol[i], azel1(i), 1e-10));
+      }
+      Vector<double> lastCol = last1.getColumn();
+      for (uInt i=0; i<tab.nrow(); ++i) {
+        AlwaysAssertExit (near(lastCol[i], last1(i), 1e-10));
+      }
+    }
+    // Check that the cached values in MSCalEngine are the same as the
+    // values calculated without a cache, also after the direction or the
+    // table has changed.
+    {
+      uInt nrow = std::min(tab.nrow(), rownr_t(200));
+      MSCalEngine cached;
+      MSCalEngine fresh;
+      fresh.setCacheSize (0);
+      cached.setTable (tab);
+      fresh.setTable (tab);
+      checkCache (cached, fresh, nrow);
+      MDirection dir(Quantity(1.,"rad"), Quantity(0.5,"rad"), MDirection::J2000);
+      cached.setDirection (dir);
+      MSCalEngine fresh2;
+      fresh2.setCacheSize (0);
+      fresh2.setTable (tab);
+      fresh2.setDirection (dir);
+      checkCache (cached, fresh2, nrow);
+      Table sorted = tab.sort ("TIME", Sort::Descending);
+      cached.setTable (sorted);
+      MSCalEngine fresh3;
+      fresh3.setCacheSize (0);
+      fresh3.setTable (sorted);
+      fresh3.setDirection (dir);
+      checkCache (cached, fresh3, nrow);
+    }
     // Now time getting the hourangle using DataMan and MSDerivedValues.
     double totha = 0;
     Timer timer;
@@ -32,6 +32,8 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/CountedPtr.h>
 #include <casacore/measures/Measures/MDirection.h>
 #include <casacore/measures/Measures/MFrequency.h>
 #include <casacore/scimath/Mathematics/Interpolate2D.h>
@@ -161,7 +163,9 @@ public:
 // the coordinate grid, it will no longer (for that 2D coordinate only) be
 // computed internally, which may save a lot of time.  Ordinarily, if you
 // regridded many planes of a cube in one call to regrid, the coordinate grid
-// is cached for you.   To trigger successive calls to regrid to go back to
+// is cached for you. Also successive calls to regrid for planes with the
+// same 2D coordinates and shapes reuse the grid computed by the previous call.
+// To trigger successive calls to regrid to go back to
 // internal computation, set zero length Cube and Matrix.  <src>gridMask</src>
 // is True for successfull coordinate conversions, and False otherwise.
 // <group>
@@ -225,6 +229,14 @@ public:
   Cube<Double> itsUser2DCoordinateGrid;
   Matrix<Bool> itsUser2DCoordinateGridMask;
   Bool itsNotify;
+//
+  // The key and coordinates for which its2DCoordinateGrid was computed,
+  // so it can be reused by a next regrid of like planes.
+  String itsGridCacheKey;
+  CountedPtr<Coordinate> itsGridCacheInCoord;
+  CountedPtr<Coordinate> itsGridCacheOutCoord;
+  Bool itsGridCacheAllFailed;
+  Bool itsGridCacheMissedIt;
 //  
   // Check shape and axes.  Exception if no good.  If pixelAxes
   // of length 0, set to all axes according to shape
@@ -235,6 +247,17 @@ public:
                   const CoordinateSystem& outCoords,
                   Bool verbose);
 
+  // Make the key telling for which shapes, axes and settings
+  // the 2D coordinate grid is computed.
+  String _gridCacheKey (const CoordinateSystem& inCoords,
+                        const CoordinateSystem& outCoords,
+                        Int inCoordinate, Int outCoordinate,
+                        const IPosition& inPixelAxes,
+                        const IPosition& outPixelAxes,
+                        const IPosition& inShape,
+                        const IPosition& outShape,
+                        uInt decimate) const;
+
   // Find maps between coordinate systems
   void findMaps (uInt nDim, 
                  Vector<Int>& pixelAxisMap1,
@@ -46,6 +46,7 @@
 
 #include <casacore/casa/sstream.h>
 #include <casacore/casa/fstream.h>
+#include <casacore/casa/iomanip.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -53,14 +54,18 @@ template<class T>
 ImageRegrid<T>::ImageRegrid()
 : itsShowLevel(0),
   itsDisableConversions(False),
-  itsNotify(False)
+  itsNotify(False),
+  itsGridCacheAllFailed(False),
+  itsGridCacheMissedIt(False)
 {;}
 
 template<class T>
 ImageRegrid<T>::ImageRegrid(const ImageRegrid& other)  
 : itsShowLevel(other.itsShowLevel),
   itsDisableConversions(other.itsDisableConversions),
-  itsNotify(other.itsNotify)
+  itsNotify(other.itsNotify),
+  itsGridCacheAllFailed(False),
+  itsGridCacheMissedIt(False)
 {;}
 
 
@@ -885,6 +890,7 @@ void ImageRegrid<T>::regridTwoAxisCoordinate (
 		if (itsNotify) {
 			os << "Using user set DirectionCoordinate grid" << LogIO::POST;
 		}
+		itsGridCacheKey = String();
 		//
 		{
 			IPosition shp1 = its2DCoordinateGrid.shape();
@@ -915,6 +921,7 @@ void ImageRegrid<T>::regridTwoAxisCoordinate (
 		missedIt = True;
 		IPosition outPosFull(outLattice.ndim(),0);
 		if (replicate) {
+			itsGridCacheKey = String();
 			make2DCoordinateGrid (its2DCoordinateGrid, minInX, minInY, maxInX,
 					maxInY,
 					pixelScale, xInAxis, yInAxis, xOutAxis, yOutAxis,
@@ -926,14 +933,37 @@ void ImageRegrid<T>::regridTwoAxisCoordinate (
 			its2DCoordinateGridMask.set(True);
 		}
 		else {
-			make2DCoordinateGrid (os, allFailed, missedIt, minInX, minInY, maxInX,
-					maxInY,
-					its2DCoordinateGrid, its2DCoordinateGridMask,
-					inCoords, outCoords, inCoordinate, outCoordinate,
-					xInAxis, yInAxis, xOutAxis,
-					yOutAxis,
-					inPixelAxes, outPixelAxes, inShape, outPosFull,
-					outShape, decimate);
+			// Reuse the grid made by the previous regrid if that was
+			// for the same 2D coordinates and shapes.
+			const String cacheKey = _gridCacheKey (inCoords, outCoords,
+					inCoordinate, outCoordinate,
+					inPixelAxes, outPixelAxes,
+					inShape, outShape, decimate);
+			if (! itsGridCacheKey.empty()  &&  cacheKey == itsGridCacheKey
+					&&  itsGridCacheInCoord->near(inCoords.coordinate(inCoordinate), 0)
+					&&  itsGridCacheOutCoord->near(outCoords.coordinate(outCoordinate), 0)) {
+				if (itsNotify) {
+					os << "Reusing DirectionCoordinate grid of previous regrid" <<
+							LogIO::POST;
+				}
+				allFailed = itsGridCacheAllFailed;
+				missedIt = itsGridCacheMissedIt;
+			} else {
+				itsGridCacheKey = String();
+				make2DCoordinateGrid (os, allFailed, missedIt, minInX, minInY, maxInX,
+						maxInY,
+						its2DCoordinateGrid, its2DCoordinateGridMask,
+						inCoords, outCoords, inCoordinate, outCoordinate,
+						xInAxis, yInAxis, xOutAxis,
+						yOutAxis,
+						inPixelAxes, outPixelAxes, inShape, outPosFull,
+						outShape, decimate);
+				itsGridCacheKey = cacheKey;
+				itsGridCacheInCoord = inCoords.coordinate(inCoordinate).clone();
+				itsGridCacheOutCoord = outCoords.coordinate(outCoordinate).clone();
+				itsGridCacheAllFailed = allFailed;
+				itsGridCacheMissedIt = missedIt;
+			}
 		}
 	}
 	s1 += t1.all();
@@ -1262,60 +1292,108 @@ void ImageRegrid<T>::make2DCoordinateGrid(LogIO& os, Bool& allFailed, Bool&misse
 // to be masked as the coarse grid is unlikely to finish exactly
 // on the lattice edge
 
+// The conversions are done for blocks of output rows at a time.
+// Without a reference conversion machine the (possibly parallel)
+// toWorldMany and toPixelMany functions are used. If that fails for some
+// pixel (e.g. off the sky), the block is done pixel by pixel.
+
   Timer t0;
+  const uInt nRowPix = (ni + iInc - 1) / iInc;
+  const uInt nRowBlock = max(1u, 65536u / max(1u, nRowPix));
+  Matrix<Double> outPixels, worlds, inPixels;
+  Vector<Bool> okPixels, failures1, failures2;
   uInt ii = 0;
   uInt jj = 0;
-  for (uInt j=0; j<nj; j+=jInc,jj++) {
-	  ii = 0;
-	  for (uInt i=0; i<ni; i+=iInc,ii++) {
-		  outPixel(outXIdx) = i + outPos[xOutAxis];
-		  outPixel(outYIdx) = j + outPos[yOutAxis];
-
-		  // Do coordinate conversions (outpixel to world to inpixel)
-		  // for the axes of interest
-
-		  if (useMachine) {                             // must be Direction
-			  ok1 = outDir.toWorld(outMVD, outPixel);
-			  ok2 = False;
-			  if (ok1) {
-				  inMVD = machine(outMVD).getValue();
-				  ok2 = inDir.toPixel(inPixel, inMVD);
-			  };
+  for (uInt jst=0; jst<nj; jst+=jInc*nRowBlock) {
+	  const uInt jend = min(nj, jst+jInc*nRowBlock);
+	  uInt nPix = 0;
+	  for (uInt j=jst; j<jend; j+=jInc) {
+		  nPix += nRowPix;
+	  }
+	  outPixels.resize(2, nPix);
+	  inPixels.resize(2, nPix);
+	  okPixels.resize(nPix);
+	  uInt k = 0;
+	  for (uInt j=jst; j<jend; j+=jInc) {
+		  for (uInt i=0; i<ni; i+=iInc,k++) {
+			  outPixels(outXIdx,k) = i + outPos[xOutAxis];
+			  outPixels(outYIdx,k) = j + outPos[yOutAxis];
+		  }
+	  }
+	  Bool doneMany = False;
+	  if (!useMachine) {
+		  if (isDir) {
+			  doneMany = outDir.toWorldMany(worlds, outPixels, failures1) &&
+					  inDir.toPixelMany(inPixels, worlds, failures2);
 		  } else {
-			  if (isDir) {
-				  ok1 = outDir.toWorld(world, outPixel);
+			  doneMany = outLin.toWorldMany(worlds, outPixels, failures1) &&
+					  inLin.toPixelMany(inPixels, worlds, failures2);
+		  }
+		  if (doneMany) {
+			  okPixels = True;
+		  }
+	  }
+	  if (!doneMany) {
+		  for (k=0; k<nPix; k++) {
+			  outPixel = outPixels.column(k);
+
+			  // Do coordinate conversions (outpixel to world to inpixel)
+			  // for the axes of interest
+
+			  if (useMachine) {                             // must be Direction
+				  ok1 = outDir.toWorld(outMVD, outPixel);
 				  ok2 = False;
-				  if (ok1) ok2 = inDir.toPixel(inPixel, world);
+				  if (ok1) {
+					  inMVD = machine(outMVD).getValue();
+					  ok2 = inDir.toPixel(inPixel, inMVD);
+				  };
 			  } else {
-				  ok1 = outLin.toWorld(world, outPixel);
-				  ok2 = False;
-				  if (ok1) ok2 = inLin.toPixel(inPixel, world);
+				  if (isDir) {
+					  ok1 = outDir.toWorld(world, outPixel);
+					  ok2 = False;
+					  if (ok1) ok2 = inDir.toPixel(inPixel, world);
+				  } else {
+					  ok1 = outLin.toWorld(world, outPixel);
+					  ok2 = False;
+					  if (ok1) ok2 = inLin.toPixel(inPixel, world);
+				  }
+			  };
+			  okPixels[k] = ok1 && ok2;
+			  if (okPixels[k]) {
+				  inPixels.column(k) = inPixel;
 			  }
-		  };
-		  //
-		  if (!ok1 || !ok2) {
-			  succeed(i,j) = False;
-			  if (decimate>1) ijInMask2D(ii,jj) = False;
-		  } else {
-
-			  // This gives the 2D input pixel coordinate (relative to
-			  // the start of the full Lattice)
-			  // to find the interpolated result at.  (,,0) pertains to
-			  // inX and (,,1) to inY
-			  in2DPos(i,j,0) = inPixel(inXIdx);
-			  in2DPos(i,j,1) = inPixel(inYIdx);
-			  allFailed = False;
-			  succeed(i,j) = True;
-			  //
-			  if (decimate <= 1) {
-				  minInX = min(minInX,inPixel(inXIdx));
-				  minInY = min(minInY,inPixel(inYIdx));
-				  maxInX = max(maxInX,inPixel(inXIdx));
-				  maxInY = max(maxInY,inPixel(inYIdx));
+		  }
+	  }
+	  k = 0;
+	  for (uInt j=jst; j<jend; j+=jInc,jj++) {
+		  ii = 0;
+		  for (uInt i=0; i<ni; i+=iInc,ii++,k++) {
+			  if (!okPixels[k]) {
+				  succeed(i,j) = False;
+				  if (decimate>1) ijInMask2D(ii,jj) = False;
 			  } else {
-				  iInPos2D(ii,jj) = inPixel(inXIdx);
-				  jInPos2D(ii,jj) = inPixel(inYIdx);
-				  ijInMask2D(ii,jj) = True;
+				  const Double inX = inPixels(inXIdx,k);
+				  const Double inY = inPixels(inYIdx,k);
+
+				  // This gives the 2D input pixel coordinate (relative to
+				  // the start of the full Lattice)
+				  // to find the interpolated result at.  (,,0) pertains to
+				  // inX and (,,1) to inY
+				  in2DPos(i,j,0) = inX;
+				  in2DPos(i,j,1) = inY;
+				  allFailed = False;
+				  succeed(i,j) = True;
+				  //
+				  if (decimate <= 1) {
+					  minInX = min(minInX,inX);
+					  minInY = min(minInY,inY);
+					  maxInX = max(maxInX,inX);
+					  maxInY = max(maxInY,inY);
+				  } else {
+					  iInPos2D(ii,jj) = inX;
+					  jInPos2D(ii,jj) = inY;
+					  ijInMask2D(ii,jj) = True;
+				  };
 			  };
 		  };
 	  };
@@ -1556,10 +1634,7 @@ void ImageRegrid<T>::regrid2DMatrix(Lattice<T>& outCursor,
   inChunk2DShape[0] = inChunkTrc2D[xInAxis] - inChunkBlc2D[xInAxis] + 1;
   inChunk2DShape[1] = inChunkTrc2D[yInAxis] - inChunkBlc2D[yInAxis] + 1;
   //
-  Vector<Double> pix2DPos2(2);
   IPosition outPos3;
-  Bool interpOK;
-  T result(0);
   //
   for (outCursorIter.reset(); !outCursorIter.atEnd(); outCursorIter++) {
     
@@ -1598,33 +1673,30 @@ void ImageRegrid<T>::regrid2DMatrix(Lattice<T>& outCursor,
       outMaskMCursor = &(outMaskCursorIterPtr->rwMatrixCursor());
     };
     
-    ArrayAccessor<Bool, Axis<0> > sucp0;
-    ArrayAccessor<Bool, Axis<1> > sucp1(succeed);
-    ArrayAccessor<T, Axis<0> > outMp0;
-    ArrayAccessor<T, Axis<1> > outMp1(outMCursor);
-    ArrayAccessor<Bool, Axis<0> > outMaskMp0;
-    ArrayAccessor<Bool, Axis<1> > outMaskMp1;
-    if (outIsMasked) outMaskMp1.init(*outMaskMCursor);
-    uInt dpix2DPos = &pix2DPos(0,0,1) - &pix2DPos(0,0,0);
-
-    for (uInt j=0; j<nCol; j++) {
-      if (outIsMasked) outMaskMp0 = outMaskMp1;
-      sucp0 = sucp1;
-      outMp0 = outMp1;
+    // The columns are interpolated in parallel. Interpolate2D::interp
+    // is thread-safe and each thread writes its own output columns.
+    const Double xBlc = inChunkBlc[xInAxis];
+    const Double yBlc = inChunkBlc[yInAxis];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (nCol>1 && nRow*nCol>=4096)
+#endif
+    for (Int j=0; j<Int(nCol); j++) {
+      Vector<Double> pix2DPos2(2);
+      T result(0);
+      Bool interpOK;
+      const uInt jj = outPos3[yOutAxis] + j;
       for (uInt i=0; i<nRow; i++) {
-	if (! *sucp0) {
-	  *outMp0 = 0.0;
-	  if (outIsMasked) *outMaskMp0 = False;
+	const uInt ii = outPos3[xOutAxis] + i;
+	if (! succeed(ii,jj)) {
+	  outMCursor(i,j) = 0.0;
+	  if (outIsMasked) (*outMaskMCursor)(i,j) = False;
 	} else {
 	  
-	  // Now do the interpolation. pix2DPos(i,j,) is the absolute input
+	  // Now do the interpolation. pix2DPos(ii,jj,) is the absolute input
 	  // pixel coordinate in the input lattice for the
 	  // current output pixel.
-	  uInt ii = outPos3[xOutAxis] + i;
-	  uInt jj = outPos3[yOutAxis] + j;
-	  const Double *pix2Dp = &pix2DPos(ii,jj,0);
-	  pix2DPos2[0] = *pix2Dp - inChunkBlc[xInAxis];
-	  pix2DPos2[1] = *(pix2Dp + dpix2DPos) - inChunkBlc[yInAxis];
+	  pix2DPos2[0] = pix2DPos(ii,jj,0) - xBlc;
+	  pix2DPos2[1] = pix2DPos(ii,jj,1) - yBlc;
 	  if (inIsMasked) {                     
 	    interpOK = interp.interp(result, pix2DPos2, inDataChunk2D,
 				     *inMaskChunk2DPtr);
@@ -1632,20 +1704,14 @@ void ImageRegrid<T>::regrid2DMatrix(Lattice<T>& outCursor,
 	    interpOK = interp.interp(result, pix2DPos2, inDataChunk2D);
 	  };
 	  if (interpOK) {
-	    *outMp0 = scale * result;
-	    if (outIsMasked) *outMaskMp0 = True; 
+	    outMCursor(i,j) = scale * result;
+	    if (outIsMasked) (*outMaskMCursor)(i,j) = True; 
 	  } else {
-	    *outMp0 = 0.0;
-	    if (outIsMasked) *outMaskMp0 = False; 
+	    outMCursor(i,j) = 0.0;
+	    if (outIsMasked) (*outMaskMCursor)(i,j) = False; 
 	  };
 	};
-	sucp0++;
-	outMp0++;
-	outMaskMp0++;
       };
-      sucp1++;
-      outMp1++;
-      outMaskMp1++;
     };
     //
     if (pProgressMeter) {
@@ -2245,6 +2311,39 @@ Bool ImageRegrid<T>::minmax(Double &minX, Double &maxX, Double &minY,
   return (maxX < minX);
 }
 
+template<class T>
+String ImageRegrid<T>::_gridCacheKey (const CoordinateSystem& inCoords,
+                                      const CoordinateSystem& outCoords,
+                                      Int inCoordinate, Int outCoordinate,
+                                      const IPosition& inPixelAxes,
+                                      const IPosition& outPixelAxes,
+                                      const IPosition& inShape,
+                                      const IPosition& outShape,
+                                      uInt decimate) const
+{
+  // The coordinates themselves are compared separately.
+  // The ObsInfo matters for a possible direction reference conversion.
+  ostringstream oss;
+  oss << inShape << outShape << inPixelAxes << outPixelAxes
+      << ' ' << decimate << ' ' << itsDisableConversions;
+  if (inCoords.type(inCoordinate) == Coordinate::DIRECTION  &&
+      outCoords.type(outCoordinate) == Coordinate::DIRECTION) {
+    oss << ' ' << MDirection::showType
+             (inCoords.directionCoordinate(inCoordinate).directionType(True))
+        << ' ' << MDirection::showType
+             (outCoords.directionCoordinate(outCoordinate).directionType(True));
+    const ObsInfo& inObs = inCoords.obsInfo();
+    const ObsInfo& outObs = outCoords.obsInfo();
+    oss << ' ' << inObs.telescope() << ' ' << outObs.telescope()
+        << setprecision(17)
+        << ' ' << inObs.obsDate().getValue().get()
+        << ' ' << inObs.obsDate().getRefString()
+        << ' ' << outObs.obsDate().getValue().get()
+        << ' ' << outObs.obsDate().getRefString();
+  }
+  return oss.str();
+}
+
 template<class T>
 void ImageRegrid<T>::get2DCoordinateGrid (Cube<Double> &grid,
 					  Matrix<Bool> &gridMask) const
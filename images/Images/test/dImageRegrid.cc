@@ -0,0 +1,176 @@
+//# dImageRegrid.cc: Measure the throughput of regridding an image
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+// dImageRegrid measures the throughput of ImageRegrid as done by the
+// imageregrid application. A cube with a DirectionCoordinate and a
+// SpectralCoordinate is regridded to a shifted and rescaled (J2000)
+// or a GALACTIC DirectionCoordinate using the linear, cubic and lanczos
+// interpolation methods.
+// The cube is regridded in one go and plane by plane. The latter reuses
+// the coordinate grid of the first plane; both results must be the same.
+//
+//   shape     The shape of the cube (default 256,256,8)
+//   decimate  The coordinate grid decimation factor (default 0)
+//   methods   The interpolation methods (default linear,cubic,lanczos)
+
+#include <casacore/casa/Inputs/Input.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayUtil.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/OS/Timer.h>
+#include <casacore/coordinates/Coordinates/CoordinateSystem.h>
+#include <casacore/coordinates/Coordinates/CoordinateUtil.h>
+#include <casacore/coordinates/Coordinates/DirectionCoordinate.h>
+#include <casacore/images/Images/TempImage.h>
+#include <casacore/images/Images/SubImage.h>
+#include <casacore/images/Images/ImageRegrid.h>
+#include <casacore/lattices/Lattices/TiledShape.h>
+#include <casacore/measures/Measures/MCDirection.h>
+#include <casacore/measures/Measures/MDirection.h>
+#include <casacore/scimath/Mathematics/Interpolate2D.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// Make the output coordinate system.
+CoordinateSystem makeOutCoords (const CoordinateSystem& inCoords,
+                                MDirection::Types outType)
+{
+  CoordinateSystem outCoords(inCoords);
+  Int dirCoord = outCoords.findCoordinate (Coordinate::DIRECTION);
+  const DirectionCoordinate& inDir = inCoords.directionCoordinate (dirCoord);
+  Vector<Double> refVal = inDir.referenceValue();
+  Vector<Double> incr = inDir.increment();
+  Vector<Double> refPix = inDir.referencePixel();
+  Quantum<Double> lon(refVal[0], inDir.worldAxisUnits()[0]);
+  Quantum<Double> lat(refVal[1], inDir.worldAxisUnits()[1]);
+  MDirection inRef(lon, lat, inDir.directionType());
+  MVDirection outRef = MDirection::Convert (inRef, outType)().getValue();
+  Double toRad = Quantum<Double>(1, inDir.worldAxisUnits()[0]).getValue("rad");
+  Matrix<Double> xform(2,2);
+  xform = 0.;
+  xform.diagonal() = 1.;
+  // Shift and rescale a bit, so real interpolation is needed.
+  DirectionCoordinate outDir (outType, inDir.projection(),
+                              outRef.getLong() + 3*incr[0]*toRad,
+                              outRef.getLat() - 2*incr[1]*toRad,
+                              0.9*incr[0]*toRad, 0.9*incr[1]*toRad,
+                              xform, refPix[0] + 0.3, refPix[1] - 0.2);
+  outCoords.replaceCoordinate (outDir, dirCoord);
+  return outCoords;
+}
+
+void doRegrid (const ImageInterface<Float>& inImage,
+               MDirection::Types outType, const String& methodName,
+               uInt decimate)
+{
+  const IPosition shape = inImage.shape();
+  CoordinateSystem outCoords = makeOutCoords (inImage.coordinates(), outType);
+  TempImage<Float> outImage1(TiledShape(shape), outCoords);
+  TempImage<Float> outImage2(TiledShape(shape), outCoords);
+  Interpolate2D::Method method = Interpolate2D::stringToMethod (methodName);
+  IPosition axes(2, 0, 1);
+  const Double mpix = shape.product() / 1e6;
+  cout << MDirection::showType(outType) << ' ' << methodName << endl;
+  // Regrid the cube at once.
+  {
+    ImageRegrid<Float> regridder;
+    regridder.disableReferenceConversions (False);
+    Timer timer;
+    regridder.regrid (outImage1, method, axes, inImage, False, decimate);
+    Double t = timer.real();
+    cout << "  cube           " << mpix/max(t, 1e-6) << " Mpixel/sec" << endl;
+  }
+  // Regrid plane by plane, so the coordinate grid is reused.
+  {
+    ImageRegrid<Float> regridder;
+    regridder.disableReferenceConversions (False);
+    IPosition planeShape(shape);
+    for (uInt i=2; i<planeShape.nelements(); ++i) {
+      planeShape[i] = 1;
+    }
+    IPosition blc(shape.nelements(), 0);
+    Timer timer;
+    for (Int i=0; i<shape[2]; ++i) {
+      blc[2] = i;
+      Slicer slicer(blc, planeShape);
+      SubImage<Float> inPlane(inImage, slicer);
+      SubImage<Float> outPlane(outImage2, slicer, True);
+      regridder.regrid (outPlane, method, axes, inPlane, False, decimate);
+    }
+    Double t = timer.real();
+    cout << "  plane by plane " << mpix/max(t, 1e-6) << " Mpixel/sec" << endl;
+  }
+  AlwaysAssertExit (allNear (outImage1.get(), outImage2.get(), 1e-5));
+}
+
+int main (int argc, const char* argv[])
+{
+  try {
+    Input inputs(1);
+    inputs.version ("$Revision$");
+    inputs.create ("shape", "256,256,8", "Shape of the cube", "Block<Int>");
+    inputs.create ("decimate", "0", "Coordinate grid decimation factor");
+    inputs.create ("methods", "linear,cubic,lanczos", "Interpolation methods");
+    inputs.readArguments (argc, argv);
+    const Block<Int> shapeU (inputs.getIntArray("shape"));
+    const uInt decimate = inputs.getInt ("decimate");
+    const Vector<String> methods =
+      stringToVector (inputs.getString("methods"));
+    IPosition shape(shapeU.nelements());
+    for (uInt i=0; i<shape.nelements(); ++i) {
+      shape[i] = shapeU[i];
+    }
+    AlwaysAssertExit (shape.nelements() == 3);
+    CoordinateSystem cSys = CoordinateUtil::makeCoordinateSystem (shape, False);
+    TempImage<Float> inImage(TiledShape(shape), cSys);
+    // Fill with a smooth function varying per plane.
+    Array<Float> data(shape);
+    for (Int k=0; k<shape[2]; ++k) {
+      for (Int j=0; j<shape[1]; ++j) {
+        for (Int i=0; i<shape[0]; ++i) {
+          data(IPosition(3,i,j,k)) = (k+1) * sin(0.05*i) * cos(0.07*j);
+        }
+      }
+    }
+    inImage.put (data);
+    for (uInt i=0; i<methods.nelements(); ++i) {
+      doRegrid (inImage, MDirection::J2000, methods[i], decimate);
+      doRegrid (inImage, MDirection::GALACTIC, methods[i], decimate);
+    }
+  } catch (AipsError& x) {
+    cout << "Unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -176,6 +176,59 @@ void LattStatsSpecialize::accumulate (
 	}
 }
 
+void LattStatsSpecialize::merge (
+	Double& nPts, Double& sum,
+	Double& mean, Double& nvariance, Double& variance,
+	Double& sumSq, Double nPts2, Double sum2,
+	Double mean2, Double nvariance2, Double sumSq2
+) {
+	if (nPts2 <= 0) {
+		return;
+	}
+	Double n = nPts + nPts2;
+	Double delta = mean2 - mean;
+	mean += delta*nPts2/n;
+	nvariance += nvariance2 + delta*delta*nPts*nPts2/n;
+	variance = (n <= 1) ? 0 : nvariance/(n-1);
+	nPts = n;
+	sum += sum2;
+	sumSq += sumSq2;
+}
+
+void LattStatsSpecialize::merge (
+	DComplex& nPts, DComplex& sum,
+	DComplex& mean, DComplex& nvariance, DComplex& variance,
+	DComplex& sumSq, DComplex nPts2, DComplex sum2,
+	DComplex mean2, DComplex nvariance2, DComplex sumSq2
+) {
+	Double rn = real(nPts);
+	Double rs = real(sum);
+	Double rm = real(mean);
+	Double rnv = real(nvariance);
+	Double rv = real(variance);
+	Double rsq = real(sumSq);
+	merge (
+		rn, rs, rm, rnv, rv, rsq, real(nPts2), real(sum2),
+		real(mean2), real(nvariance2), real(sumSq2)
+	);
+	Double in = imag(nPts);
+	Double is = imag(sum);
+	Double im = imag(mean);
+	Double inv = imag(nvariance);
+	Double iv = imag(variance);
+	Double isq = imag(sumSq);
+	merge (
+		in, is, im, inv, iv, isq, imag(nPts2), imag(sum2),
+		imag(mean2), imag(nvariance2), imag(sumSq2)
+	);
+	nPts = DComplex(rn, in);
+	sum = DComplex(rs, is);
+	mean = DComplex(rm, im);
+	nvariance = DComplex(rnv, inv);
+	variance = DComplex(rv, iv);
+	sumSq = DComplex(rsq, isq);
+}
+
 Double LattStatsSpecialize::getMean (Double sum, Double n)
 {
    Double tmp = 0.0;
@@ -96,6 +96,18 @@ public:
                            const Bool fixedMinMax, const Complex datum,
                            const uInt& pos, const Complex useIt);
 
+   // Merge the accumulation of another (independent) part of the data into
+   // the given accumulation. The running mean and variance are combined
+   // exactly, for Complex separately for the real and imaginary parts.
+   static void merge (Double& nPts, Double& sum,
+                      Double& mean, Double& nvariance, Double& variance,
+                      Double& sumSq, Double nPts2, Double sum2,
+                      Double mean2, Double nvariance2, Double sumSq2);
+   static void merge (DComplex& nPts, DComplex& sum,
+                      DComplex& mean, DComplex& nvariance, DComplex& variance,
+                      DComplex& sumSq, DComplex nPts2, DComplex sum2,
+                      DComplex mean2, DComplex nvariance2, DComplex sumSq2);
+
    static Bool hasSomePoints (Double npts);
    static Bool hasSomePoints (DComplex npts);
 //
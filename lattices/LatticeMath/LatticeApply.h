@@ -41,6 +41,8 @@ template <class T, class U> class TiledCollapser;
 template <class T, class U> class LineCollapser;
 template <class T> class Lattice;
 template <class T> class MaskedLattice;
+template <class T> class Array;
+template <class T> class CountedPtr;
 class LatticeProgress;
 class IPosition;
 class LatticeRegion;
@@ -146,6 +148,10 @@ public:
 // lattice at the location of the collapsed line. The output lattice must
 // be supplied with the correct shape (the shape of the supplied region).
 // The default region is the entire input lattice.
+// <br>If compiled with OpenMP and if the collapser can be cloned (see
+// <linkto class=LineCollapser>LineCollapser</linkto>), the lines in a tile
+// are collapsed in parallel using at most <src>omp_get_max_threads()</src>
+// threads. The lattice itself is always read by the calling thread.
 // <group>
     static void lineApply (MaskedLattice<U>& latticeOut, 
 			   const MaskedLattice<T>& latticeIn,
@@ -191,6 +197,13 @@ public:
 // be supplied with the correct shape (the shape of the supplied region
 // plus the number of values resulting from the collapse).
 // The default region is the entire input lattice.
+// <br>If compiled with OpenMP and if the collapser can be cloned and merged
+// (see <linkto class=TiledCollapser>TiledCollapser</linkto>), the tiles of
+// a collapsed chunk are processed in parallel using at most
+// <src>omp_get_max_threads()</src> threads, each collapsing into its own
+// copy of the collapser. The lattice itself is read by the calling thread,
+// which collects the tiles in batches (one tile per thread).
+// At the end of a chunk the copies are merged into the given collapser.
 // <group>
     static void tiledApply (MaskedLattice<U>& latticeOut,
 			    const MaskedLattice<T>& latticeIn,
@@ -247,6 +260,33 @@ private:
 			      const IPosition& shapeOut,
 			      const IPosition& collapseAxes,
 			      Int newOutAxis);
+
+    // Get the maximum number of threads to use for a parallel apply.
+    // It is 1 if not compiled with OpenMP or if already in a parallel region.
+    static uInt maxThreads();
+
+    // Collapse the data of a tile (in tiledApply) into the accumulator
+    // of the given collapser.
+    static void processTile (TiledCollapser<T,U>& collapser,
+                             const Array<T>& cursor,
+                             const Array<Bool>& mask, Bool useMask,
+                             const IPosition& pos,
+                             const IPosition& collapseAxes, uInt collStart,
+                             const IPosition& iterAxes,
+                             const IPosition& ioMap, uInt resultAxis);
+
+    // Collapse the first <src>ntile</src> tiles in the batch in parallel.
+    // Thread <src>i</src> uses <src>clones[i-1]</src>; thread 0 uses
+    // <src>collapser</src>.
+    static void processTiles (TiledCollapser<T,U>& collapser,
+                              const Block<CountedPtr<TiledCollapser<T,U> > >& clones,
+                              const Block<Array<T> >& cursors,
+                              const Block<Array<Bool> >& masks,
+                              const Block<IPosition>& positions,
+                              uInt ntile, Bool useMask,
+                              const IPosition& collapseAxes, uInt collStart,
+                              const IPosition& iterAxes,
+                              const IPosition& ioMap, uInt resultAxis);
 };
 
 
@@ -46,8 +46,13 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/CountedPtr.h>
 #include <casacore/casa/iostream.h>
 
+#ifdef _OPENMP
+# include <omp.h>
+#endif
+
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -153,6 +158,23 @@ void LatticeApply<T,U>::lineApply (MaskedLattice<U>& latticeOut,
     collapser.init (nResult);
     if (tellProgress != 0) tellProgress->init (nLine);
 
+// Determine if the lines can be collapsed in parallel.
+// Each thread uses its own copy of the collapser.
+
+    uInt nthr = maxThreads();
+    Block<CountedPtr<LineCollapser<T,U> > > clones;
+    if (nthr > 1) {
+	clones.resize (nthr-1);
+	for (uInt i=0; i<nthr-1; ++i) {
+	    clones[i] = collapser.clone();
+	    if (clones[i].null()) {
+		nthr = 1;
+		clones.resize (0);
+		break;
+	    }
+	}
+    }
+
 // Iterate through all the lines.
 // Per tile the lines (in the collapseAxis direction) are
 // assembled into a single array, which is put thereafter.
@@ -188,7 +210,8 @@ void LatticeApply<T,U>::lineApply (MaskedLattice<U>& latticeOut,
 	U* result = array.getStorage (deleteIt);
 	Bool* resultMask = arrayMask.getStorage (deleteMask);
 	uInt n = array.nelements() / nResult;
-	for (uInt i=0; i<n; ++i) {
+	if (nthr == 1) {
+	  for (uInt i=0; i<n; ++i) {
 	    DebugAssert (! inIter.atEnd(), AipsError);
 	    const IPosition pos (inIter.position());
 	    Vector<Bool> mask;
@@ -204,6 +227,51 @@ void LatticeApply<T,U>::lineApply (MaskedLattice<U>& latticeOut,
 			       inIter.vectorCursor(), mask, pos);
 	    ++inIter;
 	    if (tellProgress != 0) tellProgress->nstepsDone (inIter.nsteps());
+	  }
+	} else {
+	  // Read all lines of the tile (the lattice cannot be read in
+	  // parallel) and collapse them in parallel thereafter.
+	  Block<Vector<T> > lines(n);
+	  Block<Vector<Bool> > masks(n);
+	  Block<IPosition> positions(n);
+	  for (uInt i=0; i<n; ++i) {
+	    DebugAssert (! inIter.atEnd(), AipsError);
+	    positions[i] = inIter.position();
+	    if (useMask) {
+		Array<Bool> tmp;
+		((MaskedLattice<T>&)latticeIn).getMaskSlice
+                          (tmp, Slicer(positions[i], inIter.cursorShape()),
+			   True);
+		masks[i].reference (tmp);
+	    }
+	    lines[i].reference (inIter.vectorCursor().copy());
+	    ++inIter;
+	    if (tellProgress != 0) tellProgress->nstepsDone (inIter.nsteps());
+	  }
+	  String errMsg;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthr)
+#endif
+	  for (Int i=0; i<Int(n); ++i) {
+	    uInt thr = 0;
+#ifdef _OPENMP
+	    thr = omp_get_thread_num();
+#endif
+	    LineCollapser<T,U>& coll = (thr==0 ? collapser : *clones[thr-1]);
+	    // An exception cannot be thrown out of a parallel loop.
+	    try {
+	      coll.process (result[i], resultMask[i],
+			    lines[i], masks[i], positions[i]);
+	    } catch (std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(LatticeApplyError)
+#endif
+	      errMsg = x.what();
+	    }
+	  }
+	  if (! errMsg.empty()) {
+	    throw AipsError (errMsg);
+	  }
 	}
 	array.putStorage (result, deleteIt);
 	arrayMask.putStorage (resultMask, deleteMask);
@@ -457,6 +525,36 @@ void LatticeApply<T,U>::tiledApply (
 	    }
     }
 
+    // Determine if the tiles can be processed in parallel. That is only
+    // useful if a chunk to collapse consists of multiple tiles.
+    // Each thread collapses into the accumulator of its own copy of the
+    // collapser. The copies are merged when a chunk has been processed.
+    uInt nthr = maxThreads();
+    uInt ntilePerChunk = 1;
+    for (j=0; j<collDim; ++j) {
+        const uInt axis = collapseAxes(j);
+        ntilePerChunk *= 1 + trc(axis)/inTileShape(axis) -
+                         blc(axis)/inTileShape(axis);
+    }
+    nthr = std::min (nthr, ntilePerChunk);
+    Block<CountedPtr<TiledCollapser<T,U> > > clones;
+    if (nthr > 1) {
+        clones.resize (nthr-1);
+        for (i=0; i<nthr-1; ++i) {
+            clones[i] = collapser.clone();
+            if (clones[i].null()) {
+                nthr = 1;
+                clones.resize (0);
+                break;
+            }
+        }
+    }
+    // The batch of tiles to be processed in parallel.
+    Block<Array<T> > cursors(nthr > 1 ? nthr : 0);
+    Block<Array<Bool> > masks(cursors.nelements());
+    Block<IPosition> positions(cursors.nelements());
+    uInt ntile = 0;
+
     // Iterate through all the tiles.
     // TileStepper is set up in such a way that the collapse axes are iterated
     // fastest. When all collapse axes are handled, thus when the iter axes
@@ -482,7 +580,6 @@ void LatticeApply<T,U>::tiledApply (
 	    );
 	    const IPosition& cursorShape = cursor.shape();
 	    IPosition pos = inIter.position();
-	    IPosition latPos = pos;
 	    Array<Bool> mask;
 	    if (useMask) {
 	        // Casting const away is innocent.
@@ -502,6 +599,15 @@ void LatticeApply<T,U>::tiledApply (
 	    }
 	    if (firstTime  ||  outPos != iterPos) {
 	        if (!firstTime) {
+                // Process the remaining tiles of the chunk and merge
+                // the accumulators of all threads.
+                processTiles (collapser, clones, cursors, masks, positions,
+                              ntile, useMask, collapseAxes, collStart,
+                              iterAxes, ioMap, resultAxis);
+                ntile = 0;
+                for (i=0; i<clones.nelements(); ++i) {
+                    collapser.mergeAccumulator (*clones[i]);
+                }
 		        Array<U> result;
 		        Array<Bool> resultMask;
 		        collapser.endAccumulator (result, resultMask, outShape);
@@ -526,88 +632,27 @@ void LatticeApply<T,U>::tiledApply (
 		        }
 	        }
 	        collapser.initAccumulator (n1, n3);
+            for (i=0; i<clones.nelements(); ++i) {
+                clones[i]->initAccumulator (n1, n3);
+            }
 	    }
 
-        // Put the collapsed lines into an output buffer
-        // Initialize the cursor position needed in the loop.
-
-	    IPosition curPos (inDim, 0);
-
-        // Determine the increment for the first collapse axes.
-        // This is done by taking the difference between the adresses of two pixels
-        // in the cursor (if there are 2 pixels).
-
-	    IPosition chunkShape (inDim, 1);
-	    for (j=0; j<collStart; ++j) {
-	        const uInt axis = collapseAxes(j);
-	        chunkShape(axis) = cursorShape(axis);
-	    }
-	    uInt nval = chunkShape.product();
-	    const uInt axis = collapseAxes(0);
-
-    	IPosition p0(inDim, 0);
-	    IPosition p1(inDim, 0);
-	    p1[axis] = 1;
-	    // general for Arrays with contiguous or non-contiguous storage.
-	    uInt dataIncr = &(cursor(p1)) - &(cursor(p0));
-	    uInt maskIncr = useMask ? &(mask(p1)) - &(mask(p0)) : 0;
-
-        // Iterate in the outer loop through the iterator axes.
-        // Iterate in the inner loop through the collapse axes.
-
-	    uInt index1 = 0;
-	    uInt index3 = 0;
-	    for (;;) {
-	        for (;;) {
-		        if (useMask) {
-		            collapser.process (
-                        index1, index3, &(cursor(curPos)), &(mask(curPos)),
-				        dataIncr, maskIncr, nval, latPos, chunkShape
-                    );
-		        }
-                else {
-		            collapser.process(
-                        index1, index3,
-				        &(cursor(curPos)), 0,
-				        dataIncr, maskIncr, nval, latPos, chunkShape
-                    );
-		        }
-		        // Increment a collapse axis until all axes are handled.
-		        for (j=collStart; j<collDim; ++j) {
-		            uInt axis = collapseAxes(j);
-		            if (++curPos(axis) < cursorShape(axis)) {
-			            break;
-		            }
-		            curPos(axis) = 0;               // restart this axis
-		        }
-		        if (j == collDim) {
-		            break;                          // all axes are handled
-		        }
-	        }
-	
-            // Increment an iteration axis until all iteration axes are handled.
-	
-	        for (j=0; j<iterDim; ++j) {
-		        uInt arraxis = iterAxes(j);
-		        uInt axis = ioMap(arraxis);
-		        ++latPos(axis);
-		        if (++curPos(axis) < cursorShape(axis)) {
-		            if (arraxis < resultAxis) {
-		                ++index1;
-		            }
-                    else {
-		                ++index3;
-			            index1 = 0;
-		            }
-		            break;
-		        }
-		        curPos(axis) = 0;
-		        latPos(axis) = pos(axis);
-	        }
-	        if (j == iterDim) {
-		        break;
-	        }
-	    }
+        // Collapse the tile directly if done serially. Otherwise add a copy
+        // of it to the batch (the iterator reuses its cursor buffer).
+        if (nthr == 1) {
+            processTile (collapser, cursor, mask, useMask, pos,
+                         collapseAxes, collStart, iterAxes, ioMap, resultAxis);
+        } else {
+            cursors[ntile].reference (cursor.copy());
+            masks[ntile].reference (mask);
+            positions[ntile] = pos;
+            if (++ntile == nthr) {
+                processTiles (collapser, clones, cursors, masks, positions,
+                              ntile, useMask, collapseAxes, collStart,
+                              iterAxes, ioMap, resultAxis);
+                ntile = 0;
+            }
+        }
 	    ++inIter;
 	    if (tellProgress != 0) {
             tellProgress->nstepsDone (inIter.nsteps());
@@ -615,6 +660,12 @@ void LatticeApply<T,U>::tiledApply (
     }
 
     // Write out the last output array.
+    processTiles (collapser, clones, cursors, masks, positions,
+                  ntile, useMask, collapseAxes, collStart,
+                  iterAxes, ioMap, resultAxis);
+    for (i=0; i<clones.nelements(); ++i) {
+        collapser.mergeAccumulator (*clones[i]);
+    }
     Array<U> result;
     Array<Bool> resultMask;
     collapser.endAccumulator (result, resultMask, outShape);
@@ -626,6 +677,161 @@ void LatticeApply<T,U>::tiledApply (
 }
 
 
+template <class T, class U>
+void LatticeApply<T,U>::processTile (TiledCollapser<T,U>& collapser,
+                                     const Array<T>& cursor,
+                                     const Array<Bool>& mask, Bool useMask,
+                                     const IPosition& pos,
+                                     const IPosition& collapseAxes,
+                                     uInt collStart,
+                                     const IPosition& iterAxes,
+                                     const IPosition& ioMap,
+                                     uInt resultAxis)
+{
+    uInt j;
+    const IPosition& cursorShape = cursor.shape();
+    const uInt inDim = cursorShape.nelements();
+    const uInt collDim = collapseAxes.nelements();
+    const uInt iterDim = iterAxes.nelements();
+    IPosition latPos = pos;
+
+    // Put the collapsed lines into an output buffer
+    // Initialize the cursor position needed in the loop.
+
+    IPosition curPos (inDim, 0);
+
+    // Determine the increment for the first collapse axes.
+    // This is done by taking the difference between the adresses of two pixels
+    // in the cursor (if there are 2 pixels).
+
+    IPosition chunkShape (inDim, 1);
+    for (j=0; j<collStart; ++j) {
+        const uInt axis = collapseAxes(j);
+        chunkShape(axis) = cursorShape(axis);
+    }
+    uInt nval = chunkShape.product();
+    const uInt axis = collapseAxes(0);
+
+    IPosition p0(inDim, 0);
+    IPosition p1(inDim, 0);
+    p1[axis] = 1;
+    // general for Arrays with contiguous or non-contiguous storage.
+    uInt dataIncr = &(cursor(p1)) - &(cursor(p0));
+    uInt maskIncr = useMask ? &(mask(p1)) - &(mask(p0)) : 0;
+
+    // Iterate in the outer loop through the iterator axes.
+    // Iterate in the inner loop through the collapse axes.
+
+    uInt index1 = 0;
+    uInt index3 = 0;
+    for (;;) {
+        for (;;) {
+	        if (useMask) {
+	            collapser.process (
+                    index1, index3, &(cursor(curPos)), &(mask(curPos)),
+		            dataIncr, maskIncr, nval, latPos, chunkShape
+                );
+	        }
+            else {
+	            collapser.process(
+                    index1, index3,
+		            &(cursor(curPos)), 0,
+		            dataIncr, maskIncr, nval, latPos, chunkShape
+                );
+	        }
+	        // Increment a collapse axis until all axes are handled.
+	        for (j=collStart; j<collDim; ++j) {
+	            uInt axis = collapseAxes(j);
+	            if (++curPos(axis) < cursorShape(axis)) {
+		            break;
+	            }
+	            curPos(axis) = 0;               // restart this axis
+	        }
+	        if (j == collDim) {
+	            break;                          // all axes are handled
+	        }
+        }
+
+        // Increment an iteration axis until all iteration axes are handled.
+
+        for (j=0; j<iterDim; ++j) {
+	        uInt arraxis = iterAxes(j);
+	        uInt axis = ioMap(arraxis);
+	        ++latPos(axis);
+	        if (++curPos(axis) < cursorShape(axis)) {
+	            if (arraxis < resultAxis) {
+	                ++index1;
+	            }
+                else {
+	                ++index3;
+		            index1 = 0;
+	            }
+	            break;
+	        }
+	        curPos(axis) = 0;
+	        latPos(axis) = pos(axis);
+        }
+        if (j == iterDim) {
+	        break;
+        }
+    }
+}
+
+
+template <class T, class U>
+void LatticeApply<T,U>::processTiles
+                    (TiledCollapser<T,U>& collapser,
+                     const Block<CountedPtr<TiledCollapser<T,U> > >& clones,
+                     const Block<Array<T> >& cursors,
+                     const Block<Array<Bool> >& masks,
+                     const Block<IPosition>& positions,
+                     uInt ntile, Bool useMask,
+                     const IPosition& collapseAxes, uInt collStart,
+                     const IPosition& iterAxes,
+                     const IPosition& ioMap, uInt resultAxis)
+{
+    if (ntile == 0) {
+        return;
+    }
+    String errMsg;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(ntile)
+#endif
+    for (Int i=0; i<Int(ntile); ++i) {
+        uInt thr = 0;
+#ifdef _OPENMP
+        thr = omp_get_thread_num();
+#endif
+        TiledCollapser<T,U>& coll = (thr==0 ? collapser : *clones[thr-1]);
+        // An exception cannot be thrown out of a parallel loop.
+        try {
+            processTile (coll, cursors[i], masks[i], useMask, positions[i],
+                         collapseAxes, collStart, iterAxes, ioMap,
+                         resultAxis);
+        } catch (std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(LatticeApplyError)
+#endif
+            errMsg = x.what();
+        }
+    }
+    if (! errMsg.empty()) {
+        throw AipsError (errMsg);
+    }
+}
+
+
+template <class T, class U>
+uInt LatticeApply<T,U>::maxThreads()
+{
+#ifdef _OPENMP
+    if (! omp_in_parallel()) {
+        return omp_get_max_threads();
+    }
+#endif
+    return 1;
+}
+
 
 template <class T, class U>
 IPosition LatticeApply<T,U>::prepare (const IPosition& inShape,
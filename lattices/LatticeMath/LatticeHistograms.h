@@ -489,9 +489,19 @@ public:
 // Can handle null mask
    virtual Bool canHandleNullMask() const {return True;};
 
+// Make a copy using the same statistics object to collapse tiles
+// in another thread.
+    virtual TiledCollapser<T,T>* clone() const;
+
+// Add the histograms of a copy made by <src>clone</src> to this one.
+    virtual void mergeAccumulator (TiledCollapser<T,T>& other);
+
 private:
     LatticeStatistics<T>* pStats_p;
     Block<T>* pHist_p;
+    // The data min and max (from the statistics object) per histogram
+    Block<T> clipMin_p, clipMax_p;
+    Block<Bool> haveClip_p;
     uInt nBins_p;
     uInt n1_p;
     uInt n3_p;
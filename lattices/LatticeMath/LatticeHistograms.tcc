@@ -1244,11 +1244,15 @@ void LatticeHistograms<T>::setStream (ostream& os, Int oPrec)
 template <class T>
 HistTiledCollapser<T>::HistTiledCollapser(LatticeStatistics<T>* pStats, uInt nBins)
 : pStats_p(pStats),
+  pHist_p(0),
   nBins_p(nBins)
 {;}
    
 template <class T>
-HistTiledCollapser<T>::~HistTiledCollapser<T>() {}
+HistTiledCollapser<T>::~HistTiledCollapser<T>()
+{
+    delete pHist_p;
+}
 
 template <class T>
 void HistTiledCollapser<T>::init (uInt nOutPixelsPerCollapse)
@@ -1264,6 +1268,10 @@ void HistTiledCollapser<T>::initAccumulator (uInt n1, uInt n3)
 {
    pHist_p = new Block<T>(nBins_p*n1*n3);
    pHist_p->set(0);
+   clipMin_p.resize(n1*n3, True, False);
+   clipMax_p.resize(n1*n3, True, False);
+   haveClip_p.resize(n1*n3, True, False);
+   haveClip_p.set(False);
 //          
    n1_p = n1;
    n3_p = n3;
@@ -1283,17 +1291,28 @@ void HistTiledCollapser<T>::process (
 //
 
 // Fish out the min and max for this chunk of the data 
-// from the statistics object
-
-   typedef typename NumericTraits<T>::PrecisionType AccumType; 
-   Vector<AccumType> stats;
-   pStats_p->getStats(stats, startPos, True);
+// from the statistics object. They are the same for all chunks
+// of a histogram, so they only need to be fetched once.
+// The statistics object cannot be used by multiple threads.
+
+   uInt index = index1 + index3*n1_p;
+   if (! haveClip_p[index]) {
+      typedef typename NumericTraits<T>::PrecisionType AccumType; 
+      Vector<AccumType> stats;
+#ifdef _OPENMP
+#pragma omp critical(HistTiledCollapser)
+#endif
+      pStats_p->getStats(stats, startPos, True);
 
 // Assignment from AccumType to T ok (e.g. Double to FLoat)
 
+      clipMin_p[index] = stats(LatticeStatsBase::MIN);
+      clipMax_p[index] = stats(LatticeStatsBase::MAX);
+      haveClip_p[index] = True;
+   }
    Vector<T> clip(2);
-   clip(0) = stats(LatticeStatsBase::MIN);
-   clip(1) = stats(LatticeStatsBase::MAX);
+   clip(0) = clipMin_p[index];
+   clip(1) = clipMax_p[index];
 
 // Set histogram bin width
    
@@ -1341,8 +1360,29 @@ void HistTiledCollapser<T>::endAccumulator(Array<T>& result,
     
     result.putStorage (res, deleteRes);
     delete pHist_p;
+    pHist_p = 0;
 }      
 
+template <class T>
+TiledCollapser<T,T>* HistTiledCollapser<T>::clone() const
+{
+    return new HistTiledCollapser<T>(pStats_p, nBins_p);
+}
+
+template <class T>
+void HistTiledCollapser<T>::mergeAccumulator (TiledCollapser<T,T>& other)
+{
+    HistTiledCollapser<T>& that = dynamic_cast<HistTiledCollapser<T>&>(other);
+    AlwaysAssert (that.n1_p == n1_p  &&  that.n3_p == n3_p, AipsError);
+    T* histPtr = pHist_p->storage();
+    const T* otherPtr = that.pHist_p->storage();
+    for (uInt k=0; k<nBins_p*n1_p*n3_p; k++) {
+       *histPtr++ += *otherPtr++;
+    }
+    delete that.pHist_p;
+    that.pHist_p = 0;
+}
+
 } //# NAMESPACE CASACORE - END
 
 
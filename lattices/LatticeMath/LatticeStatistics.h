@@ -54,6 +54,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 template <class T> class MaskedLattice;
 template <class T> class TempLattice;
 class IPosition;
+class LatticeStepper;
 
 template <class AccumType, class T, class U> class StatisticsAlgorithm;
 template <class AccumType, class T, class U> class ClassicalStatistics;
@@ -581,6 +582,15 @@ private:
 	) const;
 
    void _doStatsLoop(uInt nsets, CountedPtr<LattStatsProgress> progressMeter);
+
+   // Get the number of threads to use for the robust statistics. It is
+   // limited by the number of sets and by the memory needed to hold
+   // the data of a set per thread.
+   uInt _nRobustThreads(uInt64 nsets, uInt64 setSize) const;
+
+   // Compute the robust statistics of <src>nthr</src> sets at a time in
+   // parallel, each using its own statistics algorithm object.
+   void _generateRobustParallel(LatticeStepper& stepper, uInt nthr);
 };
 
 } //# NAMESPACE CASA - END
@@ -76,6 +76,10 @@
 #include <casacore/scimath/Mathematics/FitToHalfStatistics.h>
 #include <casacore/scimath/Mathematics/HingesFencesStatistics.h>
 
+#ifdef _OPENMP
+# include <omp.h>
+#endif
+
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 template <class T>
@@ -1010,6 +1014,16 @@ void LatticeStatistics<T>::generateRobust () {
 	IPosition axisPath = cursorAxes_p;
 	axisPath.append(displayAxes_p);
 	LatticeStepper stepper(latticeShape, cursorShape, axisPath);
+	if (doRobust_p) {
+		uInt nthr = _nRobustThreads(
+			latticeShape.product()/cursorShape.product(),
+			cursorShape.product()
+		);
+		if (nthr > 1) {
+			_generateRobustParallel(stepper, nthr);
+			return;
+		}
+	}
 	std::set<Double> fractions;
 	CountedPtr<StatisticsAlgorithm<AccumType, const T*, const Bool*> > sa;
 	LatticeStatsDataProvider<T> lattDP;
@@ -1086,6 +1100,149 @@ void LatticeStatistics<T>::generateRobust () {
 	}
 }
 
+template <class T>
+uInt LatticeStatistics<T>::_nRobustThreads(uInt64 nsets, uInt64 setSize) const {
+	uInt nthr = 1;
+#ifdef _OPENMP
+	if (! omp_in_parallel()) {
+		nthr = omp_get_max_threads();
+	}
+#endif
+	if (nsets < nthr) {
+		nthr = nsets;
+	}
+	// The data of the sets processed in parallel are held in memory.
+	// Like the storage lattice, use at most 10% of the memory for them.
+	uInt64 setBytes = setSize * (
+		sizeof(T) + (pInLattice_p->isMasked() ? sizeof(Bool) : 0)
+	);
+	uInt64 maxBytes = uInt64(HostInfo::memoryTotal()) * 1024 / 10;
+	if (setBytes * nthr > maxBytes) {
+		nthr = std::max(uInt64(1), maxBytes/setBytes);
+	}
+	return nthr;
+}
+
+template <class T>
+void LatticeStatistics<T>::_generateRobustParallel(
+	LatticeStepper& stepper, uInt nthr
+) {
+	// The lattice cannot be read in parallel, so the data of nthr sets
+	// are read first. Thereafter the median and quantiles of these sets
+	// are determined in parallel (which for large sets is done by binning
+	// the data in two passes).
+	std::set<Double> fractions;
+	fractions.insert(0.25);
+	fractions.insert(0.75);
+	DataRanges range;
+	if (! noInclude_p || ! noExclude_p) {
+		range.push_back(std::pair<T, T>(range_p[0], range_p[1]));
+	}
+	const Bool isMasked = pInLattice_p->isMasked();
+	Block<CountedPtr<StatisticsAlgorithm<AccumType, const T*, const Bool*> > > sas(nthr);
+	for (uInt i=0; i<nthr; ++i) {
+		sas[i] = _createStatsAlgorithm();
+	}
+	Block<Array<T> > data(nthr);
+	Block<Array<Bool> > masks(nthr);
+	Block<IPosition> positions(nthr);
+	Block<uInt64> npts(nthr);
+	Block<AccumType> mins(nthr), maxs(nthr), medians(nthr),
+		medAbsDevMeds(nthr), q1s(nthr), q3s(nthr);
+	stepper.reset();
+	while (! stepper.atEnd()) {
+		uInt n = 0;
+		for (; n<nthr && ! stepper.atEnd(); stepper++) {
+			const IPosition curPos = stepper.position();
+			uInt64 knownNpts = (uInt64)abs(pStoreLattice_p->getAt(
+				locInStorageLattice(curPos, LatticeStatsBase::NPTS)
+			));
+			if (knownNpts == 0) {
+				// Stick zero in storage lattice (it's not initialized)
+				AccumType val(0);
+				pStoreLattice_p->putAt(val, locInStorageLattice(curPos, LatticeStatsBase::MEDIAN));
+				pStoreLattice_p->putAt(val, locInStorageLattice(curPos, LatticeStatsBase::MEDABSDEVMED));
+				pStoreLattice_p->putAt(val, locInStorageLattice(curPos, LatticeStatsBase::QUARTILE));
+				pStoreLattice_p->putAt(val, locInStorageLattice(curPos, LatticeStatsBase::Q1));
+				pStoreLattice_p->putAt(val, locInStorageLattice(curPos, LatticeStatsBase::Q3));
+				continue;
+			}
+			Slicer slicer(curPos, stepper.endPosition(), Slicer::endIsLast);
+			data[n].reference(pInLattice_p->getSlice(slicer));
+			if (isMasked) {
+				masks[n].reference(pInLattice_p->getMaskSlice(slicer));
+			}
+			positions[n].resize(curPos.nelements());
+			positions[n] = curPos;
+			npts[n] = knownNpts;
+			mins[n] = pStoreLattice_p->getAt(
+				locInStorageLattice(curPos, LatticeStatsBase::MIN)
+			);
+			maxs[n] = pStoreLattice_p->getAt(
+				locInStorageLattice(curPos, LatticeStatsBase::MAX)
+			);
+			++n;
+		}
+		String errMsg;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(n)
+#endif
+		for (Int i=0; i<Int(n); ++i) {
+			// An exception cannot be thrown out of a parallel loop.
+			try {
+				StatisticsAlgorithm<AccumType, const T*, const Bool*>& sa = *sas[i];
+				Bool deleteData, deleteMask;
+				const T* pData = data[i].getStorage(deleteData);
+				const Bool* pMask = isMasked ? masks[i].getStorage(deleteMask) : 0;
+				uInt nr = data[i].nelements();
+				if (pMask == 0) {
+					if (range.empty()) {
+						sa.setData(pData, nr);
+					}
+					else {
+						sa.setData(pData, nr, range, ! noInclude_p);
+					}
+				}
+				else if (range.empty()) {
+					sa.setData(pData, pMask, nr);
+				}
+				else {
+					sa.setData(pData, pMask, nr, range, ! noInclude_p);
+				}
+				std::map<Double, AccumType> quantiles;
+				medians[i] = sa.getMedianAndQuantiles(
+					quantiles, fractions, new uInt64(npts[i]),
+					new AccumType(mins[i]), new AccumType(maxs[i])
+				);
+				medAbsDevMeds[i] = sa.getMedianAbsDevMed();
+				q1s[i] = quantiles[0.25];
+				q3s[i] = quantiles[0.75];
+				data[i].freeStorage(pData, deleteData);
+				if (pMask != 0) {
+					masks[i].freeStorage(pMask, deleteMask);
+				}
+			}
+			catch (const std::exception& x) {
+#ifdef _OPENMP
+#pragma omp critical(LatticeStatisticsError)
+#endif
+				errMsg = x.what();
+			}
+		}
+		if (! errMsg.empty()) {
+			throw AipsError(errMsg);
+		}
+		for (uInt i=0; i<n; ++i) {
+			const IPosition& curPos = positions[i];
+			pStoreLattice_p->putAt(medians[i], locInStorageLattice(curPos, LatticeStatsBase::MEDIAN));
+			pStoreLattice_p->putAt(medAbsDevMeds[i], locInStorageLattice(curPos, LatticeStatsBase::MEDABSDEVMED));
+			pStoreLattice_p->putAt(q3s[i] - q1s[i], locInStorageLattice(curPos, LatticeStatsBase::QUARTILE));
+			pStoreLattice_p->putAt(q1s[i], locInStorageLattice(curPos, LatticeStatsBase::Q1));
+			pStoreLattice_p->putAt(q3s[i], locInStorageLattice(curPos, LatticeStatsBase::Q3));
+		}
+	}
+}
+
 template <class T>
 CountedPtr<StatisticsAlgorithm<typename LatticeStatistics<T>::AccumType, const T*, const Bool*> >
 LatticeStatistics<T>::_createStatsAlgorithm() const {
@@ -66,6 +66,8 @@ class IPosition;
 // <p>
 // The user has to derive a concrete class from this base class
 // and implement the (pure) virtual functions.
+// If it also implements <src>clone</src>, LatticeApply can
+// collapse the lines in parallel.
 // <br> The main function is <src>process</src>, which needs to do the
 // calculation.
 // <br> Other functions make it possible to perform an initial check.
@@ -134,6 +136,13 @@ public:
 			       const Vector<T>& line,
 			       const Vector<Bool>& mask,
 			       const IPosition& pos) = 0;
+
+// Make a copy of the collapser to be used by another thread in a parallel
+// <src>lineApply</src>. It is called after <src>init</src>, so the copy
+// has to keep the initialized state.
+// <br>The default implementation returns a null pointer, meaning that the
+// collapser cannot be used in parallel.
+    virtual LineCollapser<T,U>* clone() const;
 };
 
 
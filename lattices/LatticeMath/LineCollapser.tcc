@@ -44,6 +44,12 @@ Bool LineCollapser<T,U>::canHandleNullMask() const
     return False;
 }
 
+template<class T, class U>
+LineCollapser<T,U>* LineCollapser<T,U>::clone() const
+{
+    return 0;
+}
+
 } //# NAMESPACE CASACORE - END
 
 
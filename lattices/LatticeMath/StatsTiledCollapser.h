@@ -146,6 +146,16 @@ public:
     // Can handle null mask
     virtual Bool canHandleNullMask() const {return True;};
 
+    // Make a copy with the same pixel selection to collapse tiles in
+    // another thread.
+    virtual TiledCollapser<T,U>* clone() const;
+
+    // Merge the accumulator of a copy made by <src>clone</src> into this one.
+    // The sums and number of points are added, the running mean and variance
+    // are combined exactly and the min/max (and their positions) are taken
+    // over both.
+    virtual void mergeAccumulator (TiledCollapser<T,U>& other);
+
     // Find the location of the minimum and maximum data values
     // in the input lattice.
  	void minMaxPos(IPosition& minPos, IPosition& maxPos);
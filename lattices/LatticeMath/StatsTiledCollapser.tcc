@@ -296,6 +296,69 @@ void StatsTiledCollapser<T,U>::endAccumulator(
     result.putStorage (res, deleteRes);
 }
 
+template <class T, class U>
+TiledCollapser<T,U>* StatsTiledCollapser<T,U>::clone() const {
+	return new StatsTiledCollapser<T,U>(
+		_range, ! _include, ! _exclude, _fixedMinMax
+	);
+}
+
+template <class T, class U>
+void StatsTiledCollapser<T,U>::mergeAccumulator (TiledCollapser<T,U>& other) {
+	StatsTiledCollapser<T,U>& that = dynamic_cast<StatsTiledCollapser<T,U>&>(other);
+	AlwaysAssert(that._n1 == _n1 && that._n3 == _n3, AipsError);
+	uInt n = _n1*_n3;
+	for (uInt i=0; i<n; ++i) {
+		LattStatsSpecialize::merge(
+			(*_npts)[i], (*_sum)[i], (*_mean)[i], (*_nvariance)[i],
+			(*_variance)[i], (*_sumSq)[i], (*that._npts)[i],
+			(*that._sum)[i], (*that._mean)[i], (*that._nvariance)[i],
+			(*that._sumSq)[i]
+		);
+		if ((*that._initMinMax)[i]) {
+			// The other accumulator has no data for this index.
+			continue;
+		}
+		T& dataMin = (*_min)[i];
+		T& dataMax = (*_max)[i];
+		const T& otherMin = (*that._min)[i];
+		const T& otherMax = (*that._max)[i];
+		if ((*_initMinMax)[i]) {
+			dataMin = otherMin;
+			dataMax = otherMax;
+			(*_initMinMax)[i] = False;
+			if (_isReal && that._minpos.nelements() > 0) {
+				_minpos = that._minpos;
+				_maxpos = that._maxpos;
+			}
+		}
+		else {
+			T newMin = LattStatsSpecialize::min(dataMin, otherMin);
+			T newMax = LattStatsSpecialize::max(dataMax, otherMax);
+			if (_isReal && that._minpos.nelements() > 0) {
+				if (newMin != dataMin) {
+					_minpos = that._minpos;
+				}
+				if (newMax != dataMax) {
+					_maxpos = that._maxpos;
+				}
+			}
+			dataMin = newMin;
+			dataMax = newMax;
+		}
+	}
+	// The accumulator of the other collapser is not needed anymore.
+	that._sum = NULL;
+	that._sumSq = NULL;
+	that._npts = NULL;
+	that._min = NULL;
+	that._max = NULL;
+	that._initMinMax = NULL;
+	that._mean = NULL;
+	that._variance = NULL;
+	that._nvariance = NULL;
+}
+
 template <class T, class U>
 void StatsTiledCollapser<T,U>::minMaxPos(IPosition& minPos, IPosition& maxPos)
 {
@@ -67,6 +67,9 @@ class IPosition;
 // <p>
 // The user has to derive a concrete class from this base class
 // and implement the (pure) virtual functions.
+// If it also implements <src>clone</src> and <src>mergeAccumulator</src>,
+// LatticeApply can process the tiles in parallel, each thread collapsing
+// into its own accumulator.
 // <br> The main function is <src>process</src>, which needs to do the
 // calculation.
 // <br> Other functions make it possible to perform an initial check.
@@ -155,6 +158,22 @@ public:
     virtual void endAccumulator (Array<U>& result, 
                                  Array<Bool>& resultMask,
 				 const IPosition& shape) = 0;
+
+// Make a copy of the collapser to be used by another thread in a parallel
+// <src>tiledApply</src>. It is called after <src>init</src>, so the copy
+// has to keep the initialized state, but it gets its own accumulator.
+// <br>The default implementation returns a null pointer, meaning that the
+// collapser cannot be used in parallel. A derived class supporting it
+// has to implement <src>clone</src> and <src>mergeAccumulator</src>.
+    virtual TiledCollapser<T,U>* clone() const;
+
+// Merge the accumulator of the given collapser (made by <src>clone</src>)
+// into the accumulator of this collapser. It is called for each copy after
+// all tiles of a collapsed chunk are processed and before
+// <src>endAccumulator</src> is called for this collapser.
+// The accumulator of the other collapser can be deleted thereafter.
+// <br>The default implementation throws an exception.
+    virtual void mergeAccumulator (TiledCollapser<T,U>& other);
 };
 
 
@@ -30,6 +30,7 @@
 
 
 #include <casacore/lattices/LatticeMath/TiledCollapser.h>
+#include <casacore/casa/Exceptions/Error.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -44,6 +45,19 @@ Bool TiledCollapser<T,U>::canHandleNullMask() const
     return False;
 }
 
+template<class T, class U>
+TiledCollapser<T,U>* TiledCollapser<T,U>::clone() const
+{
+    return 0;
+}
+
+template<class T, class U>
+void TiledCollapser<T,U>::mergeAccumulator (TiledCollapser<T,U>&)
+{
+    throw AipsError ("TiledCollapser::mergeAccumulator - "
+                     "not implemented in derived class");
+}
+
 } //# NAMESPACE CASACORE - END
 
 
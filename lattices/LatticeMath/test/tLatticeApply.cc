@@ -50,6 +50,9 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
 
+#ifdef _OPENMP
+# include <omp.h>
+#endif
 
 #include <casacore/casa/namespace.h>
 class MyLineCollapser : public LineCollapser<Int>
@@ -66,6 +69,7 @@ public:
 			  const Vector<Int>& vector,
 			  const Vector<Bool>& arrayMask,
 			  const IPosition& pos);
+    virtual LineCollapser<Int>* clone() const;
 };
 void MyLineCollapser::init (uInt nOutPixelsPerCollapse)
 {
@@ -115,6 +119,10 @@ void MyLineCollapser::multiProcess (Vector<Int>& result,
     result(1) = -result(0);
     resultMask(0) = resultMask(1) = fnd;
 }
+LineCollapser<Int>* MyLineCollapser::clone() const
+{
+    return new MyLineCollapser();
+}
 
 
 class MyTiledCollapser : public TiledCollapser<Int>
@@ -132,6 +140,8 @@ public:
     virtual void endAccumulator (Array<Int>& result,
 				 Array<Bool>& resultMask,
 				 const IPosition& shape);
+    virtual TiledCollapser<Int>* clone() const;
+    virtual void mergeAccumulator (TiledCollapser<Int>& other);
 private:
     Matrix<uInt>* itsSum1;
     Block<Int>*   itsSum2;
@@ -222,6 +232,25 @@ void MyTiledCollapser::endAccumulator (Array<Int>& result,
     delete itsNpts;
     itsNpts = 0;
 }
+TiledCollapser<Int>* MyTiledCollapser::clone() const
+{
+    return new MyTiledCollapser();
+}
+void MyTiledCollapser::mergeAccumulator (TiledCollapser<Int>& other)
+{
+    MyTiledCollapser& that = dynamic_cast<MyTiledCollapser&>(other);
+    *itsSum1 += *that.itsSum1;
+    *itsNpts += *that.itsNpts;
+    for (uInt i=0; i<itsSum2->nelements(); i++) {
+	(*itsSum2)[i] += (*that.itsSum2)[i];
+    }
+    delete that.itsSum1;
+    that.itsSum1 = 0;
+    delete that.itsSum2;
+    that.itsSum2 = 0;
+    delete that.itsNpts;
+    that.itsNpts = 0;
+}
 
 
 class MyLatticeProgress : public LatticeProgress
@@ -621,6 +650,10 @@ void doIt (int argc, const char* argv[])
 int main (int argc, const char* argv[])
 {
     try {
+#ifdef _OPENMP
+        // Use multiple threads to test the parallel apply.
+        omp_set_num_threads (4);
+#endif
 	doIt (argc,argv);
 	cout<< "OK"<< endl;
 	return 0;
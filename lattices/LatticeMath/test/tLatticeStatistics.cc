@@ -44,6 +44,10 @@
 
 #include <casacore/casa/iostream.h>
 
+#ifdef _OPENMP
+# include <omp.h>
+#endif
+
 #include <casacore/casa/namespace.h>
 void doitFloat(LogIO& os);
 void do1DFloat (const Vector<Float>& results,
@@ -63,6 +67,10 @@ void test2DFloat (LatticeStatistics<Float>& stats, const Vector<Float>& results,
 int main()
 {
 	try {
+#ifdef _OPENMP
+		// Use multiple threads to test the parallel statistics.
+		omp_set_num_threads(4);
+#endif
 		LogOrigin lor("tLatticeStatistics", "main()", WHERE);
 		LogIO os(lor);
 		doitFloat(os);
@@ -372,6 +380,49 @@ int main()
 			AlwaysAssert(maxPos.size() == 0, AipsError);
 
 		}
+		{
+			// per plane statistics (computed in parallel if possible)
+			IPosition shape(3, 20, 30, 8);
+			Array<Float> cube(shape);
+			indgen(cube);
+			cube = cube*cube - Float(500)*cube;
+			ArrayLattice<Float> latt(cube);
+			SubLattice<Float> subLatt(latt);
+			LatticeStatistics<Float> stats(subLatt);
+			stats.setAxes(IPosition(2, 0, 1).asVector());
+			Array<Double> npts, mean, median, q1, q3, mins, maxs;
+			stats.getStatistic(npts, LatticeStatsBase::NPTS, False);
+			stats.getStatistic(mean, LatticeStatsBase::MEAN, False);
+			stats.getStatistic(mins, LatticeStatsBase::MIN, False);
+			stats.getStatistic(maxs, LatticeStatsBase::MAX, False);
+			stats.getStatistic(median, LatticeStatsBase::MEDIAN, False);
+			stats.getStatistic(q1, LatticeStatsBase::Q1, False);
+			stats.getStatistic(q3, LatticeStatsBase::Q3, False);
+			AlwaysAssert(npts.shape() == IPosition(1, shape[2]), AipsError);
+			std::set<Double> fractions;
+			fractions.insert(0.25);
+			fractions.insert(0.75);
+			for (Int i=0; i<shape[2]; ++i) {
+				IPosition pos(1, i);
+				Array<Float> plane = cube(
+					IPosition(3, 0, 0, i), IPosition(3, shape[0]-1, shape[1]-1, i)
+				).copy();
+				Bool deleteIt;
+				const Float* pData = plane.getStorage(deleteIt);
+				ClassicalStatistics<Double, const Float*, const Bool*> cs;
+				cs.setData(pData, plane.nelements());
+				std::map<Double, Double> quantiles;
+				Double expMedian = cs.getMedianAndQuantiles(quantiles, fractions);
+				plane.freeStorage(pData, deleteIt);
+				AlwaysAssert(npts(pos) == plane.nelements(), AipsError);
+				AlwaysAssert(near(mean(pos), casa::mean(plane)), AipsError);
+				AlwaysAssert(mins(pos) == casa::min(plane), AipsError);
+				AlwaysAssert(maxs(pos) == casa::max(plane), AipsError);
+				AlwaysAssert(near(median(pos), expMedian), AipsError);
+				AlwaysAssert(near(q1(pos), quantiles[0.25]), AipsError);
+				AlwaysAssert(near(q3(pos), quantiles[0.75]), AipsError);
+			}
+		}
 	}
 	catch (const AipsError& x) {
 		cerr << "aipserror: error " << x.getMesg() << endl;
@@ -30,6 +30,7 @@
 #include <casacore/casa/BasicSL/Constants.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/measures/Measures/MeasTable.h>
+#include <casacore/measures/Measures/MeasTimeCache.h>
 #include <casacore/casa/System/AipsrcValue.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -140,10 +141,22 @@ void Aberration::refresh() {
 }
 
 void Aberration::calcAber(Double t) {
-  if (!nearAbs(t, checkEpoch,
-	       AipsrcValue<Double>::get(Aberration::interval_reg)) ||
-      (AipsrcValue<Bool>::get(Aberration::usejpl_reg) &&
-       method != B1950) ) {
+  Double interval = AipsrcValue<Double>::get(Aberration::interval_reg);
+  Bool usejpl = (AipsrcValue<Bool>::get(Aberration::usejpl_reg) &&
+                 method != B1950);
+  Double cval[6];
+  Double cacheEpoch;
+  if (!usejpl && !nearAbs(t, checkEpoch, interval) &&
+      MeasTimeCache::global().get (MeasTimeCache::ABERRATION, method,
+                                   t, interval, cacheEpoch, cval, 6)) {
+    // Use the values calculated (by any Aberration object) for a nearby epoch.
+    checkEpoch = cacheEpoch;
+    for (Int i=0; i<3; i++) {
+      aval[i] = cval[i];
+      dval[i] = cval[i+3];
+    }
+  }
+  if (!nearAbs(t, checkEpoch, interval) || usejpl) {
     checkEpoch = t;
     switch (method) {
     case B1950:
@@ -291,6 +304,14 @@ void Aberration::calcAber(Double t) {
       }
       break;
     }
+    if (!usejpl) {
+      for (i=0; i<3; i++) {
+        cval[i]   = aval[i];
+        cval[i+3] = dval[i];
+      }
+      MeasTimeCache::global().put (MeasTimeCache::ABERRATION, method,
+                                   checkEpoch, cval, 6);
+    }
   }
 }
 
@@ -91,6 +91,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //		or DE405). If using the JPL database, the d_interval (and the
 //		output of derivative()) are irrelevant.
 // </ul>
+// The calculated values are kept in the process-wide
+// <linkto class=MeasTimeCache>MeasTimeCache</linkto>, so they can be
+// shared by all Aberration objects (e.g. in different threads) using epochs
+// within the interpolation interval.
 // </synopsis>
 //
 // <example>
@@ -41,6 +41,11 @@ MCBase::~MCBase() {}
 //# Operators
 
 //# Member functions
+Bool MCBase::getRotation(RotMatrix &, MRBase &, MRBase &,
+			 const MConvertBase &) {
+  return False;
+}
+
 void MCBase::makeState(uInt *state,
 		       const uInt ntyp, const uInt nrout,
 		       const uInt list[][3]) {
@@ -39,6 +39,7 @@ class MeasValue;
 class MCBase;
 class MRBase;
 class MConvertBase;
+class RotMatrix;
 class String;
 
 //# Typedefs
@@ -153,6 +154,16 @@ public:
 			 MRBase &inref,
 			 MRBase &outref,
 			 const MConvertBase &mc) = 0;
+
+  // Get the rotation matrix <src>rot</src> such that the conversion
+  // of a value <src>in</src> equals <src>rot*in</src> for the current
+  // frame. It makes it possible to convert many values fast.
+  // False is returned if the conversion is not a pure rotation
+  // (which is the default).
+  virtual Bool getRotation(RotMatrix &rot,
+			   MRBase &inref,
+			   MRBase &outref,
+			   const MConvertBase &mc);
   // </group>
 
 protected:
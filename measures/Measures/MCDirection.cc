@@ -32,6 +32,7 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/measures/Measures/MCDirection.h>
+#include <casacore/casa/Quanta/RotMatrix.h>
 #include <casacore/measures/Measures/MeasFrame.h>
 #include <casacore/casa/Quanta/MVPosition.h>
 #include <casacore/measures/Measures/Nutation.h>
@@ -587,6 +588,62 @@ void MCDirection::doConvert(MVDirection &in,
   }	// for
 }
 
+Bool MCDirection::isRotation(uInt routine) {
+  switch (routine) {
+  case HADEC_ITRF:
+  case ITRF_HADEC:
+  case GAL_J2000:
+  case GAL_B1950:
+  case J2000_GAL:
+  case B1950_GAL:
+  case J2000_JMEAN:
+  case B1950_BMEAN:
+  case JMEAN_J2000:
+  case JMEAN_JTRUE:
+  case BMEAN_B1950:
+  case BMEAN_BTRUE:
+  case JTRUE_JMEAN:
+  case BTRUE_BMEAN:
+  case HADEC_AZEL:
+  case HADEC_AZELGEO:
+  case AZEL_HADEC:
+  case AZELGEO_HADEC:
+  case AZEL_AZELSW:
+  case AZELSW_AZEL:
+  case AZELGEO_AZELSWGEO:
+  case AZELSWGEO_AZELGEO:
+  case ECLIP_J2000:
+  case J2000_ECLIP:
+  case MECLIP_JMEAN:
+  case JMEAN_MECLIP:
+  case TECLIP_JTRUE:
+  case JTRUE_TECLIP:
+  case GAL_SUPERGAL:
+  case SUPERGAL_GAL:
+  case ICRS_J2000:
+  case J2000_ICRS:
+    return True;
+  default:
+    return False;
+  }
+}
+
+Bool MCDirection::getRotation(RotMatrix &rot,
+			      MRBase &inref,
+			      MRBase &outref,
+			      const MConvertBase &mc) {
+  for (Int i=0; i<mc.nMethod(); i++) {
+    if (!isRotation(mc.getMethod(i))) return False;
+  }
+  // The columns of the matrix are the converted unit vectors.
+  for (uInt j=0; j<3; j++) {
+    MVDirection unit(j==0 ? 1 : 0, j==1 ? 1 : 0, j==2 ? 1 : 0);
+    doConvert(unit, inref, outref, mc);
+    for (uInt i=0; i<3; i++) rot(i,j) = unit(i);
+  }
+  return True;
+}
+
 String MCDirection::showState() {
   fillState();
   return MCBase::showState(MCDirection::FromTo_p[0],
@@ -230,8 +230,19 @@ private:
 		 MRBase &inref,
 		 MRBase &outref,
 		 const MConvertBase &mc);
+
+  // Get the rotation matrix of the conversion if all its routines are
+  // rotations (e.g. J2000 to GALACTIC, HADEC to AZEL, or precession and
+  // nutation).
+  virtual Bool getRotation(RotMatrix &rot,
+			   MRBase &inref,
+			   MRBase &outref,
+			   const MConvertBase &mc);
   
 private:
+  // Is the conversion routine a rotation (independent of the direction)?
+  static Bool isRotation(uInt routine);
+
   // Fill the global state in a thread-safe way.
   static void doFillState (void*);  
 };
@@ -40,6 +40,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Forward Declarations
 class MCBase;
 class MeasVal;
+class MeasFrame;
+template <class T> class Vector;
+template <class T> class Matrix;
 
 //# Typedefs
 
@@ -199,6 +202,27 @@ public:
   const M &operator()(const typename M::Ref &mr);
   const M &operator()(typename M::Types mr);
   // </group>
+
+  // Convert a batch of values to the output reference.
+  // Each column of <src>in</src> contains the internal vector of a value
+  // (e.g. the direction cosines for an MDirection, or the x,y,z in m for
+  // an MPosition; see <src>MVType::getVector()</src>). The converted values
+  // are stored in the same way in <src>out</src>, which is resized as needed.
+  // <br>It is much faster than converting the values one by one, because
+  // no Measure objects are created for the results. Furthermore, if the
+  // conversion consists of rotations only (e.g. J2000 to GALACTIC or
+  // HADEC to AZEL), the combined rotation matrix is calculated once and
+  // applied to all values in a tight loop.
+  // <br>In the second version the epoch of the given frame (which should be
+  // the frame used by the conversion) is reset to <src>epochs[i]</src>
+  // (in days, in the reference type of the frame's epoch) before converting
+  // value <src>i</src>. Consecutive values with the same epoch are converted
+  // together, so it is best to order the values in time.
+  // <group>
+  void convert(Matrix<Double> &out, const Matrix<Double> &in);
+  void convert(Matrix<Double> &out, const Matrix<Double> &in,
+	       const Vector<Double> &epochs, MeasFrame &frame);
+  // </group>
   
   //# General Member Functions
   // Set a new model for the conversion
@@ -274,6 +298,9 @@ private:
   const typename M::MVType &convert();
   const typename M::MVType &convert(const typename M::MVType &val);
   // </group>
+  // Convert a batch of <src>nval</src> values of <src>nrv</src> elements
+  // each (stored contiguously).
+  void convertBatch(Double *out, const Double *in, uInt nrv, uInt nval);
 };
 
 //# Global functions
@@ -35,6 +35,8 @@
 #include <casacore/measures/Measures/MeasFrame.h>
 #include <casacore/measures/Measures/MCBase.h>
 #include <casacore/measures/Measures/MRBase.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Quanta/RotMatrix.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -287,6 +289,81 @@ const M &MeasConvert<M>::operator()(typename M::Types mr) {
   return operator()(*(typename M::MVType*)(model->getData()));
 }
 
+template<class M>
+void MeasConvert<M>::convert(Matrix<Double> &out, const Matrix<Double> &in) {
+  out.resize(in.shape());
+  Bool deleteIn, deleteOut;
+  const Double *inPtr = in.getStorage(deleteIn);
+  Double *outPtr = out.getStorage(deleteOut);
+  convertBatch(outPtr, inPtr, in.nrow(), in.ncolumn());
+  in.freeStorage(inPtr, deleteIn);
+  out.putStorage(outPtr, deleteOut);
+}
+
+template<class M>
+void MeasConvert<M>::convert(Matrix<Double> &out, const Matrix<Double> &in,
+			     const Vector<Double> &epochs, MeasFrame &frame) {
+  if (epochs.nelements() != in.ncolumn()) {
+    throw(AipsError("MeasConvert::convert: number of epochs and "
+		    "values mismatch"));
+  }
+  out.resize(in.shape());
+  Bool deleteIn, deleteOut;
+  const Double *inPtr = in.getStorage(deleteIn);
+  Double *outPtr = out.getStorage(deleteOut);
+  uInt nrv = in.nrow();
+  uInt nval = in.ncolumn();
+  uInt st = 0;
+  while (st < nval) {
+    // Convert all consecutive values with the same epoch together.
+    uInt end = st+1;
+    while (end < nval && epochs(end) == epochs(st)) end++;
+    frame.resetEpoch(epochs(st));
+    convertBatch(outPtr + st*nrv, inPtr + st*nrv, nrv, end-st);
+    st = end;
+  }
+  in.freeStorage(inPtr, deleteIn);
+  out.putStorage(outPtr, deleteOut);
+}
+
+template<class M>
+void MeasConvert<M>::convertBatch(Double *out, const Double *in,
+				  uInt nrv, uInt nval) {
+  if (!model) {
+    throw(AipsError("MeasConvert::convert: no Measure model defined"));
+  }
+  if (nval == 0) return;
+  // Offsets cannot be handled as a rotation.
+  RotMatrix rot;
+  if (nrv == 3 && !offin && !offout &&
+      cvdat->getRotation(rot, *model->getRefPtr(), outref, *this)) {
+    const Double r00 = rot(0,0), r01 = rot(0,1), r02 = rot(0,2);
+    const Double r10 = rot(1,0), r11 = rot(1,1), r12 = rot(1,2);
+    const Double r20 = rot(2,0), r21 = rot(2,1), r22 = rot(2,2);
+    for (uInt i=0; i<3*nval; i+=3) {
+      const Double x = in[i];
+      const Double y = in[i+1];
+      const Double z = in[i+2];
+      out[i]   = r00*x + r01*y + r02*z;
+      out[i+1] = r10*x + r11*y + r12*z;
+      out[i+2] = r20*x + r21*y + r22*z;
+    }
+    return;
+  }
+  // Otherwise convert the values one by one, but without creating
+  // Measure objects.
+  for (uInt i=0; i<nval; i++) {
+    locres->putVector(Vector<Double>(IPosition(1,nrv),
+				     const_cast<Double*>(in + i*nrv), SHARE));
+    convert(*locres);
+    if (offout) *locres -= *offout;
+    Vector<Double> res(locres->getVector());
+    for (uInt j=0; j<nrv && j<res.nelements(); j++) {
+      out[i*nrv + j] = res(j);
+    }
+  }
+}
+
 //# Member functions
 template<class M>
 void MeasConvert<M>::init() {
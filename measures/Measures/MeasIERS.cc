@@ -53,10 +53,13 @@ const Double MeasIERS::INTV = 5;
 uInt MeasIERS::predicttime_reg = 0;
 uInt MeasIERS::notable_reg = 0;
 uInt MeasIERS::forcepredict_reg = 0;
+Double MeasIERS::predictTime = MeasIERS::INTV;
+Bool MeasIERS::noTable = False;
+Bool MeasIERS::forcePredict = False;
 volatile Bool MeasIERS::needInit = True;
 Double MeasIERS::dateNow = 0.0;
 Vector<Double> MeasIERS::ldat[MeasIERS::N_Files][MeasIERS::N_Types];
-Bool MeasIERS::msgDone = False;
+volatile Bool MeasIERS::msgDone = False;
 const String MeasIERS::tp[MeasIERS::N_Files] = {"IERSeop97", "IERSpredict"};
 uInt MeasIERS::sizeNote = 0;
 uInt MeasIERS::nNote = 0;
@@ -77,14 +80,16 @@ Bool MeasIERS::get(Double &returnValue,
       needInit = False;
     }
   }
+  // Note that from here on only data are used which do not change anymore,
+  // so no locking is needed.
   // Exit if no table has to be used.
-  if (AipsrcValue<Bool>::get(MeasIERS::notable_reg)) return True;
+  if (noTable) return True;
   // Test if PREDICTED has to be used.
   Int which = MEASURED;
   if (file == PREDICTED ||
       ldat[MEASURED][0].empty() ||
-      AipsrcValue<Bool>::get(MeasIERS::forcepredict_reg) ||
-      (dateNow-date) <= AipsrcValue<Double>::get(MeasIERS::predicttime_reg)) {
+      forcePredict ||
+      (dateNow-date) <= predictTime) {
     which = PREDICTED;
   }
 
@@ -161,6 +166,9 @@ void MeasIERS::initMeas() {
   forcepredict_reg = 
     AipsrcValue<Bool>::registerRC(String("measures.measiers.b_forcepredict"),
                                   False);
+  predictTime  = AipsrcValue<Double>::get(MeasIERS::predicttime_reg);
+  noTable      = AipsrcValue<Bool>::get(MeasIERS::notable_reg);
+  forcePredict = AipsrcValue<Bool>::get(MeasIERS::forcepredict_reg);
   dateNow = Time().modifiedJulianDay();
 
   TableRecord kws;
@@ -94,6 +94,13 @@ class String;
 // </ul>
 // These values can be set in aipsrc as well as using 
 // <linkto class=AipsrcValue>AipsrcValue</linkto> set() methods.
+// They are read once when the tables are initialised, so a change using
+// a set() method is only taken into account after <src>closeTables()</src>.
+//
+// The IERS tables are read entirely into memory when first needed.
+// Thereafter the data are not changed anymore (until
+// <src>closeTables()</src> is called), so <src>get()</src> can be used by
+// multiple threads without any locking.
 // <note>
 // 	A message is Logged (once) if an IERS table cannot be found.
 //	A message is logged (once) if a date outside the range in
@@ -269,7 +276,7 @@ private:
   // Read data (meas - predict)
   static Vector<Double> ldat[N_Files][N_Types];
   // Message given
-  static Bool msgDone;
+  static volatile Bool msgDone;
   // File names
   static const String tp[N_Files];
   // Check prediction interval
@@ -278,6 +285,12 @@ private:
   static uInt notable_reg;
   // Force prediction
   static uInt forcepredict_reg;
+  // The values of the above aipsrc variables (read at initialisation)
+  // <group>
+  static Double predictTime;
+  static Bool noTable;
+  static Bool forcePredict;
+  // </group>
   // Size of close notification list
   static uInt sizeNote;
   // Tables notifying that they should be closed
@@ -52,8 +52,8 @@ Bool MeasJPL::get(Vector<Double> &returnValue,
     return False;
   }
   // Get or read the correct data if needed.
-  // Note that fillMeas uses locks to be thread-safe. The pointer returned
-  // will never change, even if fillMeas has to extend the buffer.
+  // Note that fillMeas uses a lock to be thread-safe when reading the data.
+  // The pointer returned will never change until the table is closed.
   Double intv;
   const Double* dta = fillMeas(intv, file, date);
   if (!dta) {
@@ -163,6 +163,7 @@ Bool MeasJPL::doInitMeas(MeasJPL::Files which) {
   Double dt;
   String vs;
   Bool ok = True;
+  Int n = 0;
   if (!MeasIERS::getTable(MeasJPL::t[which], kws, row,
                           rfp, vs, dt, 
                           1, names, tp[which],
@@ -200,7 +201,7 @@ Bool MeasJPL::doInitMeas(MeasJPL::Files which) {
     }
     cn[which][MeasJPL::GMS] = kws.asDouble("GMS")/
       cn[which][MeasJPL::CAU]/cn[which][MeasJPL::CAU];
-    Int n = t[which].nrow();
+    n = t[which].nrow();
     row.get(n-1);
     if (*(rfp[0]) != mjd0[which] + n*dmjd[which]) { 
       ok = False;
@@ -223,6 +224,12 @@ Bool MeasJPL::doInitMeas(MeasJPL::Files which) {
         }
       }
       acc[Int(which)].attach(t[which], "x");
+      // Set up the buffers for the data of all rows.
+      dval[which].resize (n);
+      dptr[which] = new const Double* volatile[n];
+      for (Int i=0; i<n; ++i) {
+        dptr[which][i] = 0;
+      }
     }
   }
   if (!ok) {
@@ -245,8 +252,9 @@ void MeasJPL::closeMeas() {
           mjd0[i] = 0;
           mjdl[i] = 0;
           dmjd[i] = 0;
-          curDate[i].resize (0);
           dval[i].resize (0);
+          delete [] dptr[i];
+          dptr[i] = 0;
           t[i] = Table();
         }
         needInit[i] = True;
@@ -266,18 +274,19 @@ const Double* MeasJPL::fillMeas(Double &intv, MeasJPL::Files which,
   ut = (ut-mjd0[which])/dmjd[which];
   intv = ((utf.getDay() - (ut*dmjd[which] + mjd0[which]))
 	   + utf.getDayFraction()) / dmjd[which];
-  // If needed, read the data of this interval.
-  ScopedMutexLock locker(theirMutex);
-  for (size_t i=0; i<curDate[which].size(); ++i) {
-    if (ut == curDate[which][i]) {
-      return dval[which][i].data();
+  // If needed, read the data of this interval (using a double checked lock).
+  const Double* dta = dptr[which][ut-1];
+  if (dta == 0) {
+    ScopedMutexLock locker(theirMutex);
+    dta = dptr[which][ut-1];
+    if (dta == 0) {
+      Array<Double> data (acc[Int(which)](ut-1));
+      dval[which][ut-1].reference (data);
+      dta = dval[which][ut-1].data();
+      dptr[which][ut-1] = dta;
     }
   }
-  // Read the data for this date and add to the buffers.
-  Array<Double> data (acc[Int(which)](ut-1));
-  dval[which].push_back (data);
-  curDate[which].push_back (ut);
-  return data.data();
+  return dta;
 }
 
 void MeasJPL::interMeas(Double res[], MeasJPL::Files, Double intv, 
@@ -328,8 +337,8 @@ Int MeasJPL::mjdl[MeasJPL::N_Files] = {0, 0};
 Int MeasJPL::dmjd[MeasJPL::N_Files] = {0, 0};
 const String MeasJPL::tp[MeasJPL::N_Files] = {"DE200", "DE405"};
 Int MeasJPL::idx[MeasJPL::N_Files][3][13];
-vector<Int> MeasJPL::curDate[MeasJPL::N_Files];
 vector<Vector<Double> > MeasJPL::dval[MeasJPL::N_Files];
+const Double* volatile* MeasJPL::dptr[MeasJPL::N_Files] = {0, 0};
 Double MeasJPL::aufac[MeasJPL::N_Files];
 Double MeasJPL::emrat[MeasJPL::N_Files];
 Double MeasJPL::cn[MeasJPL::N_Files][MeasJPL::N_Codes];
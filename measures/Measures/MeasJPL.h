@@ -78,6 +78,11 @@ class MVEpoch;
 // The enumeration code gives the available data and planets. See
 // E.M. Standish et al., JPL IOM 314.10 - 127 for further details.
 // <br>
+// The data of a table row (covering <src>dMJD</src> days) are read when
+// first needed and kept in memory until the tables are closed. Once read
+// they do not change, so they can be used by multiple threads without
+// locking; only reading a new row requires a lock.
+// <br>
 // Note that the normal usage of these tables is through the Measures system.
 // 
 // <note>
@@ -214,6 +219,8 @@ private:
   static Bool initMeas(MeasJPL::Files which);
   static Bool doInitMeas(MeasJPL::Files which);
   // Get a pointer to the data for the given date. It reads the data if needed.
+  // Only reading the data requires a lock; data already read are used
+  // without locking.
   static const Double* fillMeas(Double &intv, MeasJPL::Files which,
                                 const MVEpoch &utf);
   // Interpolate Chebyshev polymomial to res
@@ -238,10 +245,11 @@ private:
   static const String tp[N_Files];
   // Index in record
   static Int idx[N_Files][3][13];
-  // Dates of the data read in buffer.
-  static vector<Int> curDate[N_Files];
-  // Data read in.
+  // Data read in (one entry per table row, filled when first needed).
   static vector<Vector<Double> > dval[N_Files];
+  // Pointer to the data of each table row (0 if not read yet).
+  // Once set, it does not change until the table is closed.
+  static const Double* volatile* dptr[N_Files];
   // Some helper data read from the table keywords
   // <group>
   static Double aufac[N_Files];
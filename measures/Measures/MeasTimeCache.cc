@@ -0,0 +1,186 @@
+//# MeasTimeCache.cc: Thread-safe cache of time-dependent Measures values
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+//# Includes
+#include <casacore/measures/Measures/MeasTimeCache.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <algorithm>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+MeasTimeCache MeasTimeCache::theirCache;
+Bool MeasTimeCache::theirSizeSet = False;
+
+
+MeasTimeCache::MeasTimeCache (uInt maxSize)
+  : itsMaxSize  (maxSize),
+    itsNHits    (0),
+    itsNMisses  (0)
+{}
+
+MeasTimeCache::~MeasTimeCache()
+{}
+
+MeasTimeCache& MeasTimeCache::global()
+{
+  ScopedMutexLock lock(theirCache.itsMutex);
+  if (!theirSizeSet) {
+    Int size;
+    AipsrcValue<Int>::find (size, "measures.timecache.size", 128);
+    theirCache.itsMaxSize = std::max (size, 0);
+    theirCache.shrink (theirCache.itsMaxSize);
+    theirSizeSet = True;
+  }
+  return theirCache;
+}
+
+Bool MeasTimeCache::get (Types type, Int variant, Double epoch,
+                         Double tolerance, Double& cacheEpoch,
+                         Double* values, uInt nvalues)
+{
+  AlwaysAssert (nvalues <= MaxNValues, AipsError);
+  ScopedMutexLock lock(itsMutex);
+  // Only the nearest entries before and after the epoch can match.
+  MapIter iter = itsMap.lower_bound (Key(type, variant, epoch));
+  MapIter found = itsMap.end();
+  Double mindiff = 0;
+  if (iter != itsMap.end()  &&  iter->first.type == type  &&
+      iter->first.variant == variant) {
+    mindiff = iter->first.epoch - epoch;
+    if (mindiff <= tolerance) {
+      found = iter;
+    }
+  }
+  if (iter != itsMap.begin()) {
+    --iter;
+    if (iter->first.type == type  &&  iter->first.variant == variant) {
+      Double diff = epoch - iter->first.epoch;
+      if (diff <= tolerance  &&  (found == itsMap.end()  ||  diff < mindiff)) {
+        found = iter;
+      }
+    }
+  }
+  if (found == itsMap.end()) {
+    itsNMisses++;
+    return False;
+  }
+  itsNHits++;
+  // Make it the most recently used entry.
+  itsList.splice (itsList.begin(), itsList, found->second);
+  const Entry& entry = itsList.front();
+  cacheEpoch = entry.key.epoch;
+  std::copy (entry.values, entry.values + nvalues, values);
+  return True;
+}
+
+void MeasTimeCache::put (Types type, Int variant, Double epoch,
+                         const Double* values, uInt nvalues)
+{
+  AlwaysAssert (nvalues <= MaxNValues, AipsError);
+  ScopedMutexLock lock(itsMutex);
+  if (itsMaxSize == 0) {
+    return;
+  }
+  // Overwrite an existing entry for this epoch; otherwise add a new one.
+  Key key(type, variant, epoch);
+  MapIter iter = itsMap.find (key);
+  if (iter != itsMap.end()) {
+    itsList.splice (itsList.begin(), itsList, iter->second);
+  } else {
+    shrink (itsMaxSize-1);
+    itsList.push_front (Entry(key));
+    itsMap.insert (std::make_pair (key, itsList.begin()));
+  }
+  Entry& entry = itsList.front();
+  std::copy (values, values + nvalues, entry.values);
+}
+
+void MeasTimeCache::shrink (uInt n)
+{
+  // Remove the least recently used entries.
+  while (itsList.size() > n) {
+    itsMap.erase (itsList.back().key);
+    itsList.pop_back();
+  }
+}
+
+uInt MeasTimeCache::maxSize() const
+{
+  ScopedMutexLock lock(itsMutex);
+  return itsMaxSize;
+}
+
+void MeasTimeCache::setMaxSize (uInt maxSize)
+{
+  ScopedMutexLock lock(itsMutex);
+  itsMaxSize = maxSize;
+  shrink (maxSize);
+  if (this == &theirCache) {
+    theirSizeSet = True;
+  }
+}
+
+uInt MeasTimeCache::size() const
+{
+  ScopedMutexLock lock(itsMutex);
+  return itsList.size();
+}
+
+void MeasTimeCache::clear()
+{
+  ScopedMutexLock lock(itsMutex);
+  itsList.clear();
+  itsMap.clear();
+  itsNHits   = 0;
+  itsNMisses = 0;
+}
+
+uInt64 MeasTimeCache::nhits() const
+{
+  ScopedMutexLock lock(itsMutex);
+  return itsNHits;
+}
+
+uInt64 MeasTimeCache::nmisses() const
+{
+  ScopedMutexLock lock(itsMutex);
+  return itsNMisses;
+}
+
+void MeasTimeCache::showStatistics (std::ostream& os) const
+{
+  ScopedMutexLock lock(itsMutex);
+  os << "MeasTimeCache: " << itsList.size() << " of " << itsMaxSize
+     << " entries used, " << itsNHits << " hits, "
+     << itsNMisses << " misses" << endl;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,209 @@
+//# MeasTimeCache.h: Thread-safe cache of time-dependent Measures values
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+#ifndef MEASURES_MEASTIMECACHE_H
+#define MEASURES_MEASTIMECACHE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/OS/Mutex.h>
+#include <casacore/casa/iosfwd.h>
+#include <list>
+#include <map>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Thread-safe cache of time-dependent Measures values
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tMeasMath">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=Nutation>Nutation</linkto>
+//   <li> <linkto class=Aberration>Aberration</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Classes like Nutation and Aberration calculate their values from long
+// series of periodic terms. Each object keeps the values for the last epoch
+// and uses a linear approximation for epochs within a given interval
+// (e.g. <src>measures.nutation.d_interval</src>). However, this only helps
+// if the object is used for epochs in order. If multiple threads (each with
+// their own conversion engine) convert data at interleaved times, the series
+// are recalculated all the time.
+// <br>MeasTimeCache is a process-wide cache shared by all those objects.
+// An entry holds the values (up to <src>MaxNValues</src>) calculated at a
+// given epoch for a given type and variant (e.g. the nutation method).
+// An object that needs the values at an epoch can look them up in the cache
+// using the interpolation interval as tolerance. If found, the entry's
+// epoch is used as the reference epoch of the linear approximation, exactly
+// as if the object had calculated the values itself at that epoch.
+// <p>
+// The entries are ordered on type, variant and epoch, so a lookup only
+// needs to look at the nearest epochs before and after the given epoch,
+// which takes O(log(n)) time.
+// <br>The cache has a maximum number of entries; when full, the least recently
+// used entry is replaced. Normally only the global cache (see function
+// <src>global</src>) is used. Its size is defined by the aipsrc variable
+// <src>measures.timecache.size</src> (default 128). A size 0 disables the
+// cache. The number of hits and misses is counted, which can be used to tune
+// the size and the interpolation intervals.
+// <br>A mutex synchronizes access to the cache. It is only held for the
+// short time needed to look up or add an entry.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   Double vals[3];
+//   Double cacheEpoch;
+//   if (! MeasTimeCache::global().get (MeasTimeCache::ABERRATION, method,
+//                                      epoch, 0.04, cacheEpoch, vals, 3)) {
+//     ... calculate vals ...
+//     MeasTimeCache::global().put (MeasTimeCache::ABERRATION, method,
+//                                  epoch, vals, 3);
+//   }
+// </srcblock>
+// </example>
+
+class MeasTimeCache
+{
+public:
+  // The maximum number of values in a cache entry.
+  enum {MaxNValues = 8};
+
+  // The types of values that can be cached.
+  enum Types {
+    // Nutation angles and equation of the equinoxes.
+    NUTATION,
+    // Derivatives of the nutation angles and equation of the equinoxes.
+    NUTATION_DERIVATIVE,
+    // Aberration vector and its derivative.
+    ABERRATION
+  };
+
+  // Construct an empty cache holding at most <src>maxSize</src> entries.
+  explicit MeasTimeCache (uInt maxSize=128);
+
+  ~MeasTimeCache();
+
+  // Look up the values of the given type and variant for an epoch
+  // within <src>tolerance</src> days from the given epoch. If multiple
+  // entries match, the nearest one is taken.
+  // If found, the epoch of the entry and its values are returned.
+  // <br>It returns False if not found.
+  Bool get (Types type, Int variant, Double epoch, Double tolerance,
+            Double& cacheEpoch, Double* values, uInt nvalues);
+
+  // Add the values of the given type and variant at the given epoch.
+  // An existing entry for exactly that epoch is overwritten.
+  // If the cache is full, the least recently used entry is replaced.
+  void put (Types type, Int variant, Double epoch,
+            const Double* values, uInt nvalues);
+
+  // Get or set the maximum number of entries.
+  // Setting it to a lower value removes the least recently used entries.
+  // <group>
+  uInt maxSize() const;
+  void setMaxSize (uInt maxSize);
+  // </group>
+
+  // Get the number of entries in the cache.
+  uInt size() const;
+
+  // Remove all entries from the cache and reset the statistics.
+  void clear();
+
+  // Get the number of cache hits and misses.
+  // <group>
+  uInt64 nhits() const;
+  uInt64 nmisses() const;
+  // </group>
+
+  // Show the statistics.
+  void showStatistics (std::ostream&) const;
+
+  // Get the process-wide cache used by the Measures classes.
+  // At first use its size is read from aipsrc.
+  static MeasTimeCache& global();
+
+private:
+  // The copy constructor and assignment are forbidden.
+  // <group>
+  MeasTimeCache (const MeasTimeCache&);
+  MeasTimeCache& operator= (const MeasTimeCache&);
+  // </group>
+
+  // Remove the least recently used entries until at most n are left.
+  void shrink (uInt n);
+
+  //# The key of a cache entry.
+  struct Key {
+    Key (Types t, Int v, Double e)
+      : type(t), variant(v), epoch(e) {}
+    Bool operator< (const Key& that) const
+    {
+      return (type < that.type  ||
+              (type == that.type  &&  (variant < that.variant  ||
+                                       (variant == that.variant  &&
+                                        epoch < that.epoch))));
+    }
+    Types  type;
+    Int    variant;
+    Double epoch;
+  };
+  //# A cached set of values.
+  struct Entry {
+    Entry (const Key& k) : key(k) {}
+    Key    key;
+    Double values[MaxNValues];
+  };
+  typedef std::list<Entry>::iterator EntryIter;
+  typedef std::map<Key, EntryIter>::iterator MapIter;
+
+  //# The entries in order of use (most recently used first).
+  std::list<Entry> itsList;
+  //# The entries ordered on key.
+  std::map<Key, EntryIter> itsMap;
+  uInt   itsMaxSize;
+  uInt64 itsNHits;
+  uInt64 itsNMisses;
+  //# A mutex to synchronize access to the cache.
+  mutable Mutex itsMutex;
+  //# The global cache.
+  static MeasTimeCache theirCache;
+  static Bool theirSizeSet;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -33,6 +33,7 @@
 #include <casacore/casa/System/AipsrcValue.h>
 #include <casacore/measures/Measures/MeasIERS.h>
 #include <casacore/measures/Measures/MeasTable.h>
+#include <casacore/measures/Measures/MeasTimeCache.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -76,6 +77,7 @@ void Nutation::init(NutationTypes type) {
 
 void Nutation::copy(const Nutation &other) {
   method_p = other.method_p;
+  cacheVariant_p = other.cacheVariant_p;
   checkEpoch_p = other.checkEpoch_p;
   checkDerEpoch_p = other.checkDerEpoch_p;
   eqeq_p = other.eqeq_p;
@@ -137,11 +139,13 @@ void Nutation::fill() {
       AipsrcValue<Bool>::registerRC(String("measures.nutation.b_usejpl"),
 				    False);
   }
+  cacheVariant_p = cacheVariant();
 }
 
 void Nutation::refresh() {
   checkEpoch_p = 1e30;
   checkDerEpoch_p = 1e30;
+  cacheVariant_p = cacheVariant();
 }
 
 Double Nutation::eqox(Double epoch) {
@@ -184,6 +188,17 @@ void Nutation::calcNut(Double time, Bool calcDer) {
     epsilon = AipsrcValue<Double>::get(Nutation::myInterval_reg);
   }
   Bool renew = False;
+  Double cval[7];
+  Double cacheEpoch;
+  if (!nearAbs(time, checkEpoch_p, epsilon) &&
+      MeasTimeCache::global().get (MeasTimeCache::NUTATION, cacheVariant_p,
+                                   time, epsilon, cacheEpoch, cval, 5)) {
+    // Use the values calculated (by any Nutation object) for a nearby epoch.
+    checkEpoch_p = cacheEpoch;
+    for (uInt i=0; i<3; i++) nval_p[i] = cval[i];
+    eqeq_p = cval[3];
+    neval_p = cval[4];
+  }
   if (!nearAbs(time, checkEpoch_p, epsilon)) {
     checkEpoch_p = time;
     renew = True;
@@ -342,6 +357,11 @@ void Nutation::calcNut(Double time, Bool calcDer) {
     default:
       break;
     }
+    for (uInt i=0; i<3; i++) cval[i] = nval_p[i];
+    cval[3] = eqeq_p;
+    cval[4] = neval_p;
+    MeasTimeCache::global().put (MeasTimeCache::NUTATION, cacheVariant_p,
+                                 checkEpoch_p, cval, 5);
   }
   if ((renew && calcDer) ||
       (!renew && calcDer && checkEpoch_p != checkDerEpoch_p) ||
@@ -349,6 +369,16 @@ void Nutation::calcNut(Double time, Bool calcDer) {
        checkEpoch_p != checkDerEpoch_p)) {
     t = checkEpoch_p;
     checkDerEpoch_p = t;
+    if (MeasTimeCache::global().get (MeasTimeCache::NUTATION_DERIVATIVE,
+                                     cacheVariant_p, t, 0., cacheEpoch,
+                                     cval, 7)) {
+      for (uInt i=0; i<3; i++) dval_p[i] = cval[i];
+      deqeq_p = cval[3];
+      deval_p = cval[4];
+      eqeq_p  = cval[5];
+      neval_p = cval[6];
+      return;
+    }
     switch (method_p) {
     case B1950:
       t = (t - MeasData::MJDB1900)/MeasData::JDCEN;
@@ -504,9 +534,23 @@ void Nutation::calcNut(Double time, Bool calcDer) {
     default:
       break;
     }
+    for (uInt i=0; i<3; i++) cval[i] = dval_p[i];
+    cval[3] = deqeq_p;
+    cval[4] = deval_p;
+    cval[5] = eqeq_p;
+    cval[6] = neval_p;
+    MeasTimeCache::global().put (MeasTimeCache::NUTATION_DERIVATIVE,
+                                 cacheVariant_p, checkDerEpoch_p, cval, 7);
   }
 }
 
+Int Nutation::cacheVariant() const {
+  // The values also depend on the use of the IERS and JPL tables.
+  return 4*method_p +
+    2*(AipsrcValue<Bool>::get(Nutation::myUseiers_reg) ? 1:0) +
+    (AipsrcValue<Bool>::get(Nutation::myUsejpl_reg) ? 1:0);
+}
+
 
 } //# NAMESPACE CASACORE - END
 
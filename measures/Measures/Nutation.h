@@ -108,6 +108,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> measures.nutation.b_useiers: use the IERS Database nutation
 //		 corrections for IAU1980 (default False)
 // </ul>
+// The calculated angles are kept in the process-wide
+// <linkto class=MeasTimeCache>MeasTimeCache</linkto>, so they can be
+// shared by all Nutation objects (e.g. in different threads) using epochs
+// within the interpolation interval. Note that after a refresh() the values
+// can still be found in that cache; use its <src>clear()</src> function to
+// force a full recalculation.
 // </synopsis>
 //
 // <example>
@@ -198,6 +204,8 @@ class Nutation {
   //# Data members
   // Method to be used
   NutationTypes method_p;
+  // Variant of the values in the MeasTimeCache (see cacheVariant())
+  Int cacheVariant_p;
   // Check epoch for linear approximation
   Double checkEpoch_p;
   // Check epoch for calculation of derivatives
@@ -233,6 +241,9 @@ class Nutation {
   void fill();
   // Calculate Nutation angles for time t; also derivatives if True given
   void calcNut(Double t, Bool calcDer = False);
+  // Determine the variant to use for the values in the MeasTimeCache.
+  // It is determined once by fill() and refresh().
+  Int cacheVariant() const;
 };
 
 
@@ -28,6 +28,8 @@
 //# Includes
 #include <casacore/measures/Measures/UVWMachine.h>
 #include <casacore/casa/Quanta/Euler.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Exceptions/Error.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -217,6 +219,77 @@ void UVWMachine::convertUVW(Vector<Double> &phase,
   }
 }
 
+// Multiply the n uvw coordinates (3 values each) with the rotation matrix
+// (i.e., uvw = uvw * rot). If phrot is given, the phase is calculated
+// from the rotated coordinates.
+// The matrix elements are copied to scalars, so the compiler can keep them
+// in registers and vectorize the loop.
+static void rotateUVW(Double *uvw, Double *phase, Int64 n,
+		      const RotMatrix &rot, const MVPosition *phrot) {
+  const Double r00 = rot(0,0), r01 = rot(0,1), r02 = rot(0,2);
+  const Double r10 = rot(1,0), r11 = rot(1,1), r12 = rot(1,2);
+  const Double r20 = rot(2,0), r21 = rot(2,1), r22 = rot(2,2);
+  if (phrot) {
+    const Double p0 = (*phrot)(0), p1 = (*phrot)(1), p2 = (*phrot)(2);
+#ifdef _OPENMP
+#pragma omp parallel for if (n > 100000)
+#endif
+    for (Int64 i=0; i<n; i++) {
+      Double *p = uvw + 3*i;
+      Double u = p[0]*r00 + p[1]*r10 + p[2]*r20;
+      Double v = p[0]*r01 + p[1]*r11 + p[2]*r21;
+      Double w = p[0]*r02 + p[1]*r12 + p[2]*r22;
+      p[0] = u;
+      p[1] = v;
+      p[2] = w;
+      phase[i] = p0*u + p1*v + p2*w;
+    }
+  } else {
+#ifdef _OPENMP
+#pragma omp parallel for if (n > 100000)
+#endif
+    for (Int64 i=0; i<n; i++) {
+      Double *p = uvw + 3*i;
+      Double u = p[0]*r00 + p[1]*r10 + p[2]*r20;
+      Double v = p[0]*r01 + p[1]*r11 + p[2]*r21;
+      Double w = p[0]*r02 + p[1]*r12 + p[2]*r22;
+      p[0] = u;
+      p[1] = v;
+      p[2] = w;
+    }
+  }
+}
+
+void UVWMachine::convertUVW(Matrix<Double> &uv) const {
+  if (uv.nrow() != 3) {
+    throw AipsError("UVWMachine::convertUVW: uvw matrix must have 3 rows");
+  }
+  if (!nop_p && uv.ncolumn() > 0) {
+    Bool deleteIt;
+    Double *data = uv.getStorage(deleteIt);
+    rotateUVW(data, 0, uv.ncolumn(), uvproj_p, 0);
+    uv.putStorage(data, deleteIt);
+  }
+}
+
+void UVWMachine::convertUVW(Vector<Double> &phase,
+			    Matrix<Double> &uv) const {
+  if (uv.nrow() != 3) {
+    throw AipsError("UVWMachine::convertUVW: uvw matrix must have 3 rows");
+  }
+  phase.resize(uv.ncolumn());
+  phase = 0;
+  if (!nop_p && uv.ncolumn() > 0) {
+    Bool deleteIt, deletePh;
+    Double *data = uv.getStorage(deleteIt);
+    Double *ph = phase.getStorage(deletePh);
+    rotateUVW(data, ph, uv.ncolumn(), uvrot_p, &phrot_p);
+    if (proj_p) rotateUVW(data, 0, uv.ncolumn(), rot4_p, 0);
+    phase.putStorage(ph, deletePh);
+    uv.putStorage(data, deleteIt);
+  }
+}
+
 Double UVWMachine::getPhase(Vector<Double> &uv) const {
   Double phase;
   convertUVW(phase, uv);
@@ -27,6 +27,11 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/measures/Measures/MDirection.h>
+#include <casacore/measures/Measures/MCDirection.h>
+#include <casacore/measures/Measures/MEpoch.h>
+#include <casacore/measures/Measures/MeasConvert.h>
+#include <casacore/measures/Measures/MeasFrame.h>
+#include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/namespace.h>
 
 Bool testShiftAngle() {
@@ -98,11 +103,62 @@ Bool testShiftAngle() {
 	return True;
 }
 
+// Check that a batch conversion gives the same result as converting
+// the directions one by one.
+void checkBatch(MDirection::Convert& conv, const Matrix<Double>& in,
+		const Matrix<Double>& out) {
+	for (uInt i=0; i<in.ncolumn(); i++) {
+		Vector<Double> exp = conv(Vector<Double>(in.column(i))).
+			getValue().getValue();
+		for (uInt j=0; j<3; j++) {
+			AlwaysAssert(abs(out(j,i) - exp(j)) < 1e-12, AipsError);
+		}
+	}
+}
+
+Bool testBatchConvert() {
+	Matrix<Double> in(3, 10);
+	for (uInt i=0; i<in.ncolumn(); i++) {
+		MVDirection dir(Quantity(i*35., "deg"), Quantity(i*17.-80, "deg"));
+		in.column(i) = dir.getValue();
+	}
+	Matrix<Double> out;
+	// A pure rotation.
+	MDirection::Convert toGal(MDirection::J2000, MDirection::GALACTIC);
+	toGal.convert(out, in);
+	checkBatch(toGal, in, out);
+	// A rotation depending on the epoch.
+	MeasFrame frame(MEpoch(Quantity(55000., "d"), MEpoch::TDB));
+	MDirection::Convert toMean(MDirection::J2000,
+				   MDirection::Ref(MDirection::JMEAN, frame));
+	toMean.convert(out, in);
+	checkBatch(toMean, in, out);
+	// A non-rotation.
+	MDirection::Convert toB1950(MDirection::J2000, MDirection::B1950);
+	toB1950.convert(out, in);
+	checkBatch(toB1950, in, out);
+	// Different epochs.
+	Vector<Double> epochs(in.ncolumn());
+	for (uInt i=0; i<epochs.nelements(); i++) {
+		epochs(i) = 55000. + 100*(i/3);
+	}
+	toMean.convert(out, in, epochs, frame);
+	for (uInt i=0; i<in.ncolumn(); i++) {
+		frame.resetEpoch(epochs(i));
+		Vector<Double> exp = toMean(Vector<Double>(in.column(i))).
+			getValue().getValue();
+		for (uInt j=0; j<3; j++) {
+			AlwaysAssert(abs(out(j,i) - exp(j)) < 1e-12, AipsError);
+		}
+	}
+	return True;
+}
 
 int main() {
 	try {
 		Bool success = True;
 		success = success && testShiftAngle();
+		success = success && testBatchConvert();
 
 		if (success) {
 			cout << "tMDirection succeeded" << endl;
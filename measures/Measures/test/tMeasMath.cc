@@ -37,6 +37,7 @@
 #include <casacore/casa/Quanta/RotMatrix.h>
 #include <casacore/casa/Quanta/Euler.h>
 #include <casacore/measures/Measures/MeasTable.h>
+#include <casacore/measures/Measures/MeasTimeCache.h>
 #include <casacore/measures/Measures/Precession.h>
 #include <casacore/measures/Measures/Nutation.h>
 #include <casacore/measures/Measures/Aberration.h>
@@ -370,5 +371,44 @@ int main()
 	cout << x.getMesg() << endl;
     } 
 
+    try {
+      cout << "MeasTimeCache checks -----------------" << endl;
+      // Interleaved epochs for two objects give the same results
+      // with and without the cache (within the accuracy of the linear
+      // approximation within the interpolation interval).
+      MeasTimeCache& cache = MeasTimeCache::global();
+      cache.setMaxSize(0);
+      cache.clear();
+      Vector<Double> nref(64), aref(64);
+      for (uInt i=0; i<64; i++) {
+	Double ep = 51116 + (i%8) + 0.0005*i;
+	Nutation nut;
+	Aberration ab;
+	nref(i) = nut(ep)(1);
+	aref(i) = ab(ep)(0);
+      }
+      cout << "Cache used: " << (cache.size() + cache.nhits() > 0) << endl;
+      cache.setMaxSize(64);
+      Nutation nut1, nut2;
+      Aberration ab1, ab2;
+      Bool nok = True;
+      Bool aok = True;
+      for (uInt i=0; i<64; i++) {
+	Double ep = 51116 + (i%8) + 0.0005*i;
+	Nutation &nut = (i%2 == 0 ? nut1 : nut2);
+	Aberration &ab = (i%2 == 0 ? ab1 : ab2);
+	nok = nok && nearAbs(nut(ep)(1), nref(i), 1e-9);
+	aok = aok && nearAbs(ab(ep)(0), aref(i), 1e-9);
+      }
+      cout << "Nutation equal: " << nok << endl;
+      cout << "Aberration equal: " << aok << endl;
+      cout << "Cache used: " << (cache.nhits() > 0) << endl;
+      cache.clear();
+      cout << "Cache cleared: " << (cache.size() + cache.nhits() == 0) <<
+	endl;
+    } catch (AipsError x) {
+	cout << x.getMesg() << endl;
+    } 
+
     return(0);
 }
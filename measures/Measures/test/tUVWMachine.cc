@@ -30,6 +30,7 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/measures/Measures/UVWMachine.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
 #include <casacore/casa/Arrays/ArrayIO.h>
 #include <casacore/measures/Measures/MPosition.h>
 #include <casacore/measures/Measures/MEpoch.h>
@@ -300,6 +301,43 @@ int main() {
     vmvo = um(vmv);
     cout << "Corrected UVW:        " << vmvo(0) << endl;
 
+    cout << "---------------Matrix: ----------------" << endl;
+    Matrix<Double> mdd(3, 1000);
+    for (uInt i=0; i<mdd.ncolumn(); ++i) {
+      mdd.column(i) = uvw.getValue();
+      mdd(0,i) += i;
+      mdd(2,i) -= 0.5*i;
+    }
+    Matrix<Double> mdd1(mdd.copy());
+    Vector<Double> mph;
+    ump.convertUVW(mph, mdd1);
+    cout << "Phase correction:     " << mph(0) << endl;
+    cout << "Corrected UVW:        " << MVPosition(mdd1.column(0)) << endl;
+    Matrix<Double> mdd2(mdd.copy());
+    ump.convertUVW(mdd2);
+    cout << "Corrected UVW:        " << MVPosition(mdd2.column(0)) << endl;
+    Matrix<Double> mdd3(mdd.copy());
+    um.convertUVW(mdd3);
+    cout << "Corrected UVW:        " << MVPosition(mdd3.column(0)) << endl;
+    // Compare with the conversion of the individual vectors.
+    Bool ok = True;
+    for (uInt i=0; i<mdd.ncolumn(); ++i) {
+      Vector<Double> v1(mdd.column(i).copy());
+      Double ph1;
+      ump.convertUVW(ph1, v1);
+      Vector<Double> v2(mdd.column(i).copy());
+      ump.convertUVW(v2);
+      Vector<Double> v3(mdd.column(i).copy());
+      um.convertUVW(v3);
+      ok = ok && nearAbs(mph(i), ph1, 1e-10);
+      for (uInt j=0; j<3; ++j) {
+	ok = ok && nearAbs(mdd1(j,i), v1(j), 1e-10) &&
+	  nearAbs(mdd2(j,i), v2(j), 1e-10) &&
+	  nearAbs(mdd3(j,i), v3(j), 1e-10);
+      }
+    }
+    cout << "Matrix conversion:    " << (ok ? "ok" : "not ok") << endl;
+
     cout << "---------------------------------------" << endl;
 
   } catch (AipsError x) {
@@ -31,6 +31,7 @@
 #include <casacore/casa/OS/File.h>
 #include <casacore/measures/Measures/MeasTable.h>
 #include <casacore/ms/MSOper/MSKeys.h>
+#include <casacore/ms/MSOper/MSMetaDataSummary.h>
 #include <casacore/ms/MeasurementSets/MSFieldColumns.h>
 #include <casacore/ms/MeasurementSets/MSSpWindowColumns.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
@@ -89,7 +90,7 @@ MSMetaData::MSMetaData(const MeasurementSet *const &ms, const Float maxCacheSize
 	  _taqlTempTable(
 		File(ms->tableName()).exists() ? 0 : 1, ms
 	  ), _flagsColumn(),
-	   _spwInfoStored(False) {}
+	   _spwInfoStored(False), _rowSummary(), _rowSummaryDone(False) {}
 
 MSMetaData::~MSMetaData() {}
 
@@ -619,6 +620,19 @@ std::map<ScanKey, std::set<Int> > MSMetaData::_getScanToStatesMap() const {
 			myScanToStatesMap[*scanKey] = empty;
 		}
 	}
+	else if (_getRowSummary()) {
+		const MSMetaDataSummary::RowMap& rowMap = _getRowSummary()->rowMap();
+		MSMetaDataSummary::RowMap::const_iterator iter = rowMap.begin();
+		MSMetaDataSummary::RowMap::const_iterator end = rowMap.end();
+		ScanKey key;
+		while (iter != end) {
+			key.obsID = iter->first.obsID;
+			key.arrayID = iter->first.arrayID;
+			key.scan = iter->first.scan;
+			myScanToStatesMap[key].insert(iter->first.stateID);
+			++iter;
+		}
+	}
 	else {
 		map<SubScanKey, SubScanProperties> subScanProps = _getSubScanProperties();
 		//map<ScanKey, ScanProperties> scanProps;
@@ -937,20 +951,33 @@ void MSMetaData::_getFieldsAndSpwMaps(
 		spwToFieldMap = _spwToFieldIDsMap;
 		return;
 	}
-	CountedPtr<Vector<Int> > allDDIDs = _getDataDescIDs();
-	CountedPtr<Vector<Int> > allFieldIDs = _getFieldIDs();
-	Vector<Int>::const_iterator endDDID = allDDIDs->end();
-	Vector<Int>::const_iterator curField = allFieldIDs->begin();
 	fieldToSpwMap.clear();
 	spwToFieldMap.resize(nSpw(True));
 	vector<uInt> ddidToSpwMap = _getDataDescIDToSpwMap();
-	for (
-		Vector<Int>::const_iterator curDDID=allDDIDs->begin();
-		curDDID!=endDDID; ++curDDID, ++curField
-	) {
-		uInt spw = ddidToSpwMap[*curDDID];
-		fieldToSpwMap[*curField].insert(spw);
-		spwToFieldMap[spw].insert(*curField);
+	const MSMetaDataSummary* summary = _getRowSummary();
+	if (summary) {
+		MSMetaDataSummary::RowMap::const_iterator iter = summary->rowMap().begin();
+		MSMetaDataSummary::RowMap::const_iterator end = summary->rowMap().end();
+		while (iter != end) {
+			uInt spw = ddidToSpwMap[iter->first.ddID];
+			fieldToSpwMap[iter->first.fieldID].insert(spw);
+			spwToFieldMap[spw].insert(iter->first.fieldID);
+			++iter;
+		}
+	}
+	else {
+		CountedPtr<Vector<Int> > allDDIDs = _getDataDescIDs();
+		CountedPtr<Vector<Int> > allFieldIDs = _getFieldIDs();
+		Vector<Int>::const_iterator endDDID = allDDIDs->end();
+		Vector<Int>::const_iterator curField = allFieldIDs->begin();
+		for (
+			Vector<Int>::const_iterator curDDID=allDDIDs->begin();
+			curDDID!=endDDID; ++curDDID, ++curField
+		) {
+			uInt spw = ddidToSpwMap[*curDDID];
+			fieldToSpwMap[*curField].insert(spw);
+			spwToFieldMap[spw].insert(*curField);
+		}
 	}
 	std::map<Int, std::set<uInt> >::const_iterator mapEnd = fieldToSpwMap.end();
 	uInt mySize = 0;
@@ -1149,6 +1176,25 @@ void MSMetaData::_getScansAndDDIDMaps(
 	scanToDDIDMap.clear();
 	ddIDToScanMap.clear();
 	ddIDToScanMap.resize(nDataDescriptions());
+	const MSMetaDataSummary* summary = _getRowSummary();
+	if (summary) {
+		MSMetaDataSummary::RowMap::const_iterator iter = summary->rowMap().begin();
+		MSMetaDataSummary::RowMap::const_iterator end = summary->rowMap().end();
+		ScanKey myScanKey;
+		while (iter != end) {
+			myScanKey.obsID = iter->first.obsID;
+			myScanKey.arrayID = iter->first.arrayID;
+			myScanKey.scan = iter->first.scan;
+			scanToDDIDMap[myScanKey].insert(iter->first.ddID);
+			ddIDToScanMap[iter->first.ddID].insert(myScanKey);
+			++iter;
+		}
+		if (_cacheUpdated(_sizeof(scanToDDIDMap) + _sizeof(ddIDToScanMap))) {
+			_scanToDDIDsMap = scanToDDIDMap;
+			_ddidToScansMap = ddIDToScanMap;
+		}
+		return;
+	}
 	std::map<SubScanKey, SubScanProperties> subScanProps = _getSubScanProperties();
 	std::map<SubScanKey, SubScanProperties>::const_iterator iter = subScanProps.begin();
 	std::map<SubScanKey, SubScanProperties>::const_iterator end = subScanProps.end();
@@ -1452,6 +1498,24 @@ std::set<SubScanKey> MSMetaData::_getSubScanKeys() const {
 		return _subscans;
 	}
 	std::set<SubScanKey> mysubscans;
+	SubScanKey subScanKey;
+	const MSMetaDataSummary* summary = _getRowSummary();
+	if (summary) {
+		MSMetaDataSummary::RowMap::const_iterator iter = summary->rowMap().begin();
+		MSMetaDataSummary::RowMap::const_iterator end = summary->rowMap().end();
+		while (iter != end) {
+			subScanKey.obsID = iter->first.obsID;
+			subScanKey.arrayID = iter->first.arrayID;
+			subScanKey.scan = iter->first.scan;
+			subScanKey.fieldID = iter->first.fieldID;
+			mysubscans.insert(subScanKey);
+			++iter;
+		}
+		if (_cacheUpdated(mysubscans.size()*sizeof(SubScanKey))) {
+			_subscans = mysubscans;
+		}
+		return mysubscans;
+	}
 	CountedPtr<Vector<Int> > scans = _getScans();
 	CountedPtr<Vector<Int> > fields = _getFieldIDs();
 	CountedPtr<Vector<Int> > arrays = _getArrayIDs();
@@ -1461,7 +1525,6 @@ std::set<SubScanKey> MSMetaData::_getSubScanKeys() const {
 	Vector<Int>::const_iterator fIter = fields->begin();
 	Vector<Int>::const_iterator oIter = obs->begin();
 	Vector<Int>::const_iterator aIter = arrays->begin();
-	SubScanKey subScanKey;
 	while (scanIter != scanEnd) {
 		subScanKey.obsID = *oIter;
 		subScanKey.arrayID = *aIter;
@@ -2516,6 +2579,17 @@ vector<Int> MSMetaData::_getNumCorrs() const {
 	return myvec;
 }
 
+const MSMetaDataSummary* MSMetaData::_getRowSummary() const {
+	// A summary can only be persisted for an entire MS.
+	if (! _rowSummaryDone) {
+		_rowSummaryDone = True;
+		if (_ms->isRootTable()) {
+			_rowSummary.reset(new MSMetaDataSummary(*_ms));
+		}
+	}
+	return _rowSummary.get();
+}
+
 vector<std::set<Int> > MSMetaData::_getObservationIDToArrayIDsMap() const {
 	// this method is responsible for setting _obsToArraysMap
 	if (! _obsToArraysMap.empty()) {
@@ -3277,18 +3351,30 @@ void MSMetaData::_getFieldsAndStatesMaps(
 		stateToFieldsMap = _stateToFieldsMap;
 		return;
 	}
-	CountedPtr<Vector<Int> > allStates = _getStateIDs();
-	CountedPtr<Vector<Int> > allFields = _getFieldIDs();
-	Vector<Int>::const_iterator endState = allStates->end();
-	Vector<Int>::const_iterator curField = allFields->begin();
 	fieldToStatesMap.clear();
 	stateToFieldsMap.clear();
-	for (
-		Vector<Int>::const_iterator curState=allStates->begin();
-		curState!=endState; ++curState, ++curField
-	) {
-		fieldToStatesMap[*curField].insert(*curState);
-		stateToFieldsMap[*curState].insert(*curField);
+	const MSMetaDataSummary* summary = _getRowSummary();
+	if (summary) {
+		MSMetaDataSummary::RowMap::const_iterator iter = summary->rowMap().begin();
+		MSMetaDataSummary::RowMap::const_iterator end = summary->rowMap().end();
+		while (iter != end) {
+			fieldToStatesMap[iter->first.fieldID].insert(iter->first.stateID);
+			stateToFieldsMap[iter->first.stateID].insert(iter->first.fieldID);
+			++iter;
+		}
+	}
+	else {
+		CountedPtr<Vector<Int> > allStates = _getStateIDs();
+		CountedPtr<Vector<Int> > allFields = _getFieldIDs();
+		Vector<Int>::const_iterator endState = allStates->end();
+		Vector<Int>::const_iterator curField = allFields->begin();
+		for (
+			Vector<Int>::const_iterator curState=allStates->begin();
+			curState!=endState; ++curState, ++curField
+		) {
+			fieldToStatesMap[*curField].insert(*curState);
+			stateToFieldsMap[*curState].insert(*curField);
+		}
 	}
 	if (
 		_cacheUpdated(
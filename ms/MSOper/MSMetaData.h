@@ -39,6 +39,7 @@
 namespace casacore {
 
 template <class T> class ArrayColumn;
+class MSMetaDataSummary;
 struct ArrayKey;
 struct ScanKey;
 struct SubScanKey;
@@ -75,6 +76,11 @@ public:
 	// do not use a cache, in which case, each method call will have to (re)query
 	// the MS. It is highly recommended to use a cache of reasonable size for the
 	// specified MS if multiple methods are going to be called.
+	// The scan, field, spectral window, state and intent relations are
+	// derived from a summary of the ID columns (see class MSMetaDataSummary).
+	// If such a summary has been persisted in the MS and is still valid,
+	// the main table does not need to be read. This is not done if the MS
+	// is a selection of another MS. Note that the MS is never changed.
 	MSMetaData(const MeasurementSet *const &ms, const Float maxCacheSizeMB);
 
 	virtual ~MSMetaData();
@@ -496,6 +502,10 @@ private:
 	mutable std::set<SubScanKey> _subscans;
 	mutable std::map<ScanKey, std::set<SubScanKey> > _scanToSubScans;
 
+	// The persistent summary of the ID columns in the main table.
+	mutable CountedPtr<MSMetaDataSummary> _rowSummary;
+	mutable Bool _rowSummaryDone;
+
 	//mutable CountedPtr<std::map<Double, TimeStampProperties> > _timeStampPropsMap;
 
 	// disallow copy constructor and = operator
@@ -630,6 +640,11 @@ private:
 
 	vector<std::set<Int> > _getObservationIDToArrayIDsMap() const;
 
+	// get the persistent summary of the ID columns in the main table
+	// (see class MSMetaDataSummary). It returns 0 if the MS is a
+	// selection, in which case the columns have to be read.
+	const MSMetaDataSummary* _getRowSummary() const;
+
 	vector<MPosition> _getObservatoryPositions();
 
 	void _getRowStats(
@@ -0,0 +1,236 @@
+//# MSMetaDataSummary.cc: Persistent summary of the ID columns of a MeasurementSet
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+#include <casacore/ms/MSOper/MSMetaDataSummary.h>
+
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableRecord.h>
+
+#include <algorithm>
+
+namespace casacore {
+
+// The number of rows read at a time when making the summary.
+static const rownr_t _chunkSize = 1048576;
+
+Bool operator<(const MSMetaDataSummary::Key& lhs, const MSMetaDataSummary::Key& rhs) {
+	if (lhs.obsID != rhs.obsID) {
+		return lhs.obsID < rhs.obsID;
+	}
+	if (lhs.arrayID != rhs.arrayID) {
+		return lhs.arrayID < rhs.arrayID;
+	}
+	if (lhs.scan != rhs.scan) {
+		return lhs.scan < rhs.scan;
+	}
+	if (lhs.fieldID != rhs.fieldID) {
+		return lhs.fieldID < rhs.fieldID;
+	}
+	if (lhs.ddID != rhs.ddID) {
+		return lhs.ddID < rhs.ddID;
+	}
+	return lhs.stateID < rhs.stateID;
+}
+
+MSMetaDataSummary::MSMetaDataSummary()
+	: _rowMap(), _nrow(0), _nrowRead(0) {}
+
+MSMetaDataSummary::MSMetaDataSummary(const MeasurementSet& ms)
+	: _rowMap(), _nrow(0), _nrowRead(0) {
+	// Changes not flushed yet are not reflected in the modify counter,
+	// so a persisted summary can only be trusted if the table is readonly.
+	if (ms.isWritable() || ! _fromKeyword(ms, True)) {
+		_rowMap.clear();
+		_nrow = 0;
+		_addRows(ms, 0, ms.nrow());
+	}
+}
+
+MSMetaDataSummary::~MSMetaDataSummary() {}
+
+const String& MSMetaDataSummary::keywordName() {
+	static const String name("MSMETADATA_SUMMARY");
+	return name;
+}
+
+void MSMetaDataSummary::write(MeasurementSet& ms, Bool rowsAppended) {
+	Bool locked = ms.hasLock(FileLocker::Write);
+	if (! locked) {
+		ms.lock(FileLocker::Write);
+	}
+	MSMetaDataSummary summary;
+	if (! rowsAppended || ! summary._fromKeyword(ms, False)) {
+		summary._rowMap.clear();
+		summary._nrow = 0;
+	}
+	summary._addRows(ms, summary._nrow, ms.nrow());
+	// Flush outstanding changes, so the data counter is up-to-date.
+	// Writing the keyword does not change the data counter.
+	ms.flush();
+	uInt counter = ms.dataModifyCounter();
+	ms.rwKeywordSet().defineRecord(keywordName(), summary._toRecord(counter));
+	ms.flush();
+	if (! locked) {
+		ms.unlock();
+	}
+}
+
+void MSMetaDataSummary::remove(MeasurementSet& ms) {
+	if (ms.keywordSet().isDefined(keywordName())) {
+		ms.rwKeywordSet().removeField(keywordName());
+	}
+}
+
+Bool MSMetaDataSummary::_fromKeyword(
+	const MeasurementSet& ms, Bool checkStamp
+) {
+	// The keywords and modify counter are only up-to-date if locked.
+	Table tab(ms);
+	Bool locked = tab.hasLock(FileLocker::Read);
+	if (! locked) {
+		tab.lock(FileLocker::Read);
+	}
+	Bool valid = False;
+	const String& name = keywordName();
+	const TableRecord& keywords = tab.keywordSet();
+	try {
+		if (keywords.isDefined(name) && keywords.dataType(name) == TpRecord) {
+			const TableRecord& rec = keywords.asRecord(name);
+			Int64 nrow = rec.asInt64("NROW");
+			valid = rec.isDefined("VERSION") && rec.asInt("VERSION") == 3
+				&& nrow >= 0 && rownr_t(nrow) <= tab.nrow();
+			if (valid && checkStamp) {
+				valid = rownr_t(nrow) == tab.nrow()
+					&& rec.asuInt("DATAMODIFYCOUNTER")
+						== tab.dataModifyCounter();
+			}
+			Matrix<Int> keys(rec.asArrayInt("KEYS"));
+			Vector<Int64> nrows(rec.asArrayInt64("NROWS"));
+			if (
+				valid && keys.ncolumn() == nrows.size()
+				&& (nrows.empty() || keys.nrow() == 6)
+			) {
+				Key key;
+				for (uInt i=0; i<nrows.size(); ++i) {
+					key.obsID = keys(0, i);
+					key.arrayID = keys(1, i);
+					key.scan = keys(2, i);
+					key.fieldID = keys(3, i);
+					key.ddID = keys(4, i);
+					key.stateID = keys(5, i);
+					_rowMap[key] = nrows[i];
+				}
+				_nrow = nrow;
+			} else {
+				valid = False;
+			}
+		}
+	}
+	catch (const AipsError&) {
+		// A record in an unexpected format is regarded as invalid.
+		valid = False;
+	}
+	if (! locked) {
+		tab.unlock();
+	}
+	return valid;
+}
+
+TableRecord MSMetaDataSummary::_toRecord(uInt dataModifyCounter) const {
+	uInt n = _rowMap.size();
+	Matrix<Int> keys(6, n);
+	Vector<Int64> nrows(n);
+	RowMap::const_iterator iter = _rowMap.begin();
+	RowMap::const_iterator end = _rowMap.end();
+	for (uInt i=0; iter!=end; ++iter, ++i) {
+		keys(0, i) = iter->first.obsID;
+		keys(1, i) = iter->first.arrayID;
+		keys(2, i) = iter->first.scan;
+		keys(3, i) = iter->first.fieldID;
+		keys(4, i) = iter->first.ddID;
+		keys(5, i) = iter->first.stateID;
+		nrows[i] = iter->second;
+	}
+	TableRecord rec;
+	rec.define("VERSION", 3);
+	rec.define("NROW", Int64(_nrow));
+	rec.define("DATAMODIFYCOUNTER", dataModifyCounter);
+	rec.define("KEYS", keys);
+	rec.define("NROWS", nrows);
+	return rec;
+}
+
+void MSMetaDataSummary::_addRows(
+	const MeasurementSet& ms, rownr_t startRow, rownr_t endRow
+) {
+	ROScalarColumn<Int> obsCol(ms, MS::columnName(MS::OBSERVATION_ID));
+	ROScalarColumn<Int> arrayCol(ms, MS::columnName(MS::ARRAY_ID));
+	ROScalarColumn<Int> scanCol(ms, MS::columnName(MS::SCAN_NUMBER));
+	ROScalarColumn<Int> fieldCol(ms, MS::columnName(MS::FIELD_ID));
+	ROScalarColumn<Int> ddCol(ms, MS::columnName(MS::DATA_DESC_ID));
+	ROScalarColumn<Int> stateCol(ms, MS::columnName(MS::STATE_ID));
+	Vector<Int> obs, arrays, scans, fields, ddIDs, states;
+	Key key;
+	RowMap::iterator cur = _rowMap.end();
+	for (rownr_t start=startRow; start<endRow; start+=_chunkSize) {
+		rownr_t n = std::min(_chunkSize, endRow - start);
+		Slicer rowRange(IPosition(1, start), IPosition(1, n));
+		obsCol.getColumnRange(rowRange, obs, True);
+		arrayCol.getColumnRange(rowRange, arrays, True);
+		scanCol.getColumnRange(rowRange, scans, True);
+		fieldCol.getColumnRange(rowRange, fields, True);
+		ddCol.getColumnRange(rowRange, ddIDs, True);
+		stateCol.getColumnRange(rowRange, states, True);
+		for (rownr_t i=0; i<n; ++i) {
+			// Consecutive rows usually have the same IDs, so only look up
+			// the map entry if they differ.
+			if (
+				cur == _rowMap.end() || obs[i] != key.obsID
+				|| arrays[i] != key.arrayID || scans[i] != key.scan
+				|| fields[i] != key.fieldID || ddIDs[i] != key.ddID
+				|| states[i] != key.stateID
+			) {
+				key.obsID = obs[i];
+				key.arrayID = arrays[i];
+				key.scan = scans[i];
+				key.fieldID = fields[i];
+				key.ddID = ddIDs[i];
+				key.stateID = states[i];
+				cur = _rowMap.insert(std::make_pair(key, rownr_t(0))).first;
+			}
+			++cur->second;
+		}
+	}
+	_nrowRead += endRow - startRow;
+	_nrow = endRow;
+}
+
+}
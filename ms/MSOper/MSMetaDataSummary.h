@@ -0,0 +1,161 @@
+//# MSMetaDataSummary.h: Persistent summary of the ID columns of a MeasurementSet
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+#ifndef MS_MSMETADATASUMMARY_H
+#define MS_MSMETADATASUMMARY_H
+
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/ms/MeasurementSets/MeasurementSet.h>
+
+#include <map>
+
+namespace casacore {
+
+class TableRecord;
+
+// <summary>
+// Persistent summary of the ID columns in the main table of a MeasurementSet.
+// </summary>
+
+// <synopsis>
+// MSMetaDataSummary contains the unique combinations of observation ID,
+// array ID, scan number, field ID, data description ID and state ID in the
+// main table of a MeasurementSet, together with their number of rows.
+// Most of the scan, field, spectral window and intent maps of
+// <linkto class=MSMetaData>MSMetaData</linkto> can be derived from it
+// without reading the main table.
+//
+// The summary can be persisted in the keyword <src>MSMETADATA_SUMMARY</src>
+// of the main table using the static function <src>write</src>. It is never
+// written implicitly. When constructed, the summary is read from this
+// keyword if its validity stamp matches the table. Otherwise (or if no
+// summary exists) the summary is made by reading the ID columns in chunks.
+//
+// The stamp consists of the number of rows and the data modify counter of
+// the table (see <src>Table::dataModifyCounter</src>). The counter is
+// incremented by every change in the column data written to the table, so
+// any such change in the main table (e.g. rewritten IDs or removed rows)
+// invalidates the summary. Changes in the keywords (such as writing the
+// summary itself) do not change the counter.
+// The persisted summary is not used if the table is writable in this
+// process, because changes not flushed yet are not reflected in the
+// counter.
+// <br>Because appending rows changes the counter as well, the summary
+// cannot detect that only rows were appended. Function <src>write</src>
+// can be told so, in which case only the appended rows are read and
+// added to the persisted summary.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   // Persist the summary once, so MSMetaData can use it thereafter.
+//   MeasurementSet ms("my.ms", Table::Update);
+//   MSMetaDataSummary::write (ms);
+// </srcblock>
+// </example>
+
+class MSMetaDataSummary {
+
+public:
+
+	// A unique combination of IDs in the main table.
+	struct Key {
+		Int obsID;
+		Int arrayID;
+		Int scan;
+		Int fieldID;
+		Int ddID;
+		Int stateID;
+	};
+
+	// The IDs combinations and their number of rows.
+	typedef std::map<Key, rownr_t> RowMap;
+
+	// Get the summary of the main table. It is read from the keyword if
+	// valid, otherwise it is made from the main table.
+	// The table is not changed.
+	explicit MSMetaDataSummary(const MeasurementSet& ms);
+
+	~MSMetaDataSummary();
+
+	// Get the ID combinations and their number of rows.
+	const RowMap& rowMap() const { return _rowMap; }
+
+	// Get the number of rows summarized.
+	rownr_t nrow() const { return _nrow; }
+
+	// Get the number of rows read from the main table when making or
+	// updating the summary. It is 0 if a valid summary was read.
+	rownr_t nrowRead() const { return _nrowRead; }
+
+	// Make the summary and store it in the keyword. The table is flushed
+	// first, so the stamp contains the current data modify counter.
+	// If <src>rowsAppended=True</src>, the caller guarantees that rows
+	// have only been appended since the summary was written, so an
+	// existing summary is extended with the new rows instead of being
+	// made from scratch.
+	static void write(MeasurementSet& ms, Bool rowsAppended=False);
+
+	// Remove the summary from the table (if it has one).
+	static void remove(MeasurementSet& ms);
+
+	// Get the name of the keyword containing the summary.
+	static const String& keywordName();
+
+private:
+
+	RowMap _rowMap;
+	rownr_t _nrow, _nrowRead;
+
+	// Create an empty summary.
+	MSMetaDataSummary();
+
+	// disallow copy constructor and = operator
+	MSMetaDataSummary(const MSMetaDataSummary&);
+	MSMetaDataSummary& operator=(const MSMetaDataSummary&);
+
+	// Read the summary from the keyword. If <src>checkStamp=True</src>,
+	// it returns False if the summary does not match the table.
+	// It also returns False if there is no summary or if it is invalid.
+	Bool _fromKeyword(const MeasurementSet& ms, Bool checkStamp);
+
+	TableRecord _toRecord(uInt dataModifyCounter) const;
+
+	// Add the rows in the given range to the summary.
+	void _addRows(const MeasurementSet& ms, rownr_t startRow, rownr_t endRow);
+
+};
+
+// define operator<() so it can be used as a key in std::map
+Bool operator<(const MSMetaDataSummary::Key& lhs, const MSMetaDataSummary::Key& rhs);
+
+}
+
+#endif
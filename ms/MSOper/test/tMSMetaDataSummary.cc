@@ -0,0 +1,185 @@
+//# tMSMetaDataSummary.cc: Test program for class MSMetaDataSummary
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+#include <casacore/ms/MSOper/MSMetaDataSummary.h>
+#include <casacore/ms/MeasurementSets/MeasurementSet.h>
+#include <casacore/ms/MeasurementSets/MSMainColumns.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <iostream>
+
+using namespace casacore;
+using namespace std;
+
+// Add rows for the given scan with 2 fields and 3 data descriptions.
+void addRows (MeasurementSet& ms, Int scan, uInt ntime)
+{
+  MSMainColumns mscols(ms);
+  for (uInt t=0; t<ntime; ++t) {
+    for (Int dd=0; dd<3; ++dd) {
+      rownr_t row = ms.nrow();
+      ms.addRow();
+      mscols.time().put (row, 1e9 + 10*scan + t);
+      mscols.scanNumber().put (row, scan);
+      mscols.fieldId().put (row, scan%2);
+      mscols.dataDescId().put (row, dd);
+      mscols.stateId().put (row, t%2);
+      mscols.observationId().put (row, 0);
+      mscols.arrayId().put (row, 0);
+    }
+  }
+}
+
+// Check the summary against the expected contents.
+void check (const MSMetaDataSummary& summary, Int nscan, uInt ntime)
+{
+  AlwaysAssertExit (summary.rowMap().size() == uInt(nscan*3*2));
+  rownr_t nrow = 0;
+  for (MSMetaDataSummary::RowMap::const_iterator iter=summary.rowMap().begin();
+       iter!=summary.rowMap().end(); ++iter) {
+    AlwaysAssertExit (iter->first.fieldID == iter->first.scan%2);
+    AlwaysAssertExit (iter->second == ntime/2);
+    nrow += iter->second;
+  }
+  AlwaysAssertExit (nrow == summary.nrow());
+}
+
+int main()
+{
+  try {
+    {
+      SetupNewTable newtab("tMSMetaDataSummary_tmp.ms",
+                           MS::requiredTableDesc(), Table::New);
+      MeasurementSet ms(newtab);
+      ms.createDefaultSubtables (Table::New);
+      for (Int scan=0; scan<4; ++scan) {
+        addRows (ms, scan, 10);
+      }
+    }
+    {
+      // A summary is made, but not stored implicitly.
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms", Table::Update);
+      MSMetaDataSummary summary(ms);
+      AlwaysAssertExit (summary.nrow() == 120  &&  summary.nrowRead() == 120);
+      AlwaysAssertExit (! ms.keywordSet().isDefined
+                        (MSMetaDataSummary::keywordName()));
+      check (summary, 4, 10);
+      MSMetaDataSummary::write (ms);
+      AlwaysAssertExit (ms.keywordSet().isDefined
+                        (MSMetaDataSummary::keywordName()));
+      // It is not used as long as the table is writable.
+      MSMetaDataSummary summary2(ms);
+      AlwaysAssertExit (summary2.nrowRead() == 120);
+    }
+    {
+      // Thereafter it is read from the keyword.
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms");
+      MSMetaDataSummary summary(ms);
+      AlwaysAssertExit (summary.nrow() == 120  &&  summary.nrowRead() == 0);
+      check (summary, 4, 10);
+    }
+    {
+      // Appended rows invalidate the summary, but can be added to it.
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms", Table::Update);
+      addRows (ms, 4, 10);
+      addRows (ms, 5, 10);
+    }
+    {
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms");
+      MSMetaDataSummary summary(ms);
+      AlwaysAssertExit (summary.nrow() == 180  &&  summary.nrowRead() == 180);
+      check (summary, 6, 10);
+    }
+    {
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms", Table::Update);
+      MSMetaDataSummary::write (ms, True);
+    }
+    {
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms");
+      MSMetaDataSummary summary(ms);
+      AlwaysAssertExit (summary.nrow() == 180  &&  summary.nrowRead() == 0);
+      check (summary, 6, 10);
+    }
+    {
+      // Changing a keyword does not invalidate the summary.
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms", Table::Update);
+      ms.rwKeywordSet().define ("TESTKEY", 1);
+    }
+    {
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms");
+      MSMetaDataSummary summary(ms);
+      AlwaysAssertExit (summary.nrow() == 180  &&  summary.nrowRead() == 0);
+    }
+    {
+      // A change in an interior row invalidates the summary.
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms", Table::Update);
+      MSMainColumns(ms).fieldId().put (50, 7);
+    }
+    {
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms");
+      MSMetaDataSummary summary(ms);
+      AlwaysAssertExit (summary.nrowRead() == 180);
+      rownr_t nfield7 = 0;
+      for (MSMetaDataSummary::RowMap::const_iterator
+             iter=summary.rowMap().begin();
+           iter!=summary.rowMap().end(); ++iter) {
+        if (iter->first.fieldID == 7) {
+          nfield7 += iter->second;
+        }
+      }
+      AlwaysAssertExit (nfield7 == 1);
+    }
+    {
+      // Removing and adding a row (keeping the number of rows)
+      // invalidates the summary.
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms", Table::Update);
+      MSMainColumns(ms).fieldId().put (50, 0);
+      MSMetaDataSummary::write (ms);
+      ms.removeRow (ms.nrow() - 1);
+      ms.addRow();
+    }
+    {
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms");
+      MSMetaDataSummary summary(ms);
+      AlwaysAssertExit (summary.nrow() == 180  &&  summary.nrowRead() == 180);
+    }
+    {
+      // Removing the summary means it has to be made again.
+      MeasurementSet ms("tMSMetaDataSummary_tmp.ms", Table::Update);
+      MSMetaDataSummary::remove (ms);
+      AlwaysAssertExit (! ms.keywordSet().isDefined
+                        (MSMetaDataSummary::keywordName()));
+    }
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
@@ -0,0 +1,249 @@
+//# MSPrefetchIter.cc: Iterate through MeasurementSets with chunks prepared in a background thread
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+//# Includes
+#include <casacore/ms/MeasurementSets/MSPrefetchIter.h>
+#include <casacore/tables/Tables/TableProxy.h>
+#include <casacore/casa/Containers/ValueHolder.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <algorithm>
+#include <limits>
+#ifdef USE_THREADS
+#include <pthread.h>
+#endif
+
+#define ITSTHREAD \
+  (static_cast<pthread_t*>(itsThread))
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+MSPrefetchIter::MSPrefetchIter (const MeasurementSet& ms,
+                                const Block<Int>& sortColumns,
+                                Double timeInterval,
+                                Bool addDefaultSortColumns,
+                                uInt queueSize,
+                                const Vector<String>& prefetchColumns)
+  : itsIter (ms, sortColumns, timeInterval, addDefaultSortColumns)
+{
+  init (queueSize, prefetchColumns);
+}
+
+MSPrefetchIter::MSPrefetchIter (const Block<MeasurementSet>& mss,
+                                const Block<Int>& sortColumns,
+                                Double timeInterval,
+                                Bool addDefaultSortColumns,
+                                uInt queueSize,
+                                const Vector<String>& prefetchColumns)
+  : itsIter (mss, sortColumns, timeInterval, addDefaultSortColumns)
+{
+  init (queueSize, prefetchColumns);
+}
+
+MSPrefetchIter::~MSPrefetchIter()
+{
+#ifdef USE_THREADS
+  if (itsThread != 0) {
+    {
+      ScopedMutexLock lock(itsMutex);
+      itsStop = True;
+      itsCondition.broadcast();
+    }
+    pthread_join (*ITSTHREAD, 0);
+    delete ITSTHREAD;
+  }
+#endif
+}
+
+void MSPrefetchIter::init (uInt queueSize,
+                           const Vector<String>& prefetchColumns)
+{
+  itsColumns.assign (prefetchColumns);
+  itsQueueSize = std::max (queueSize, 1u);
+  itsFirst  = 0;
+  itsNrMade = 0;
+  itsNext   = 0;
+  itsAll    = False;
+  itsEnd    = False;
+  itsStop   = False;
+  itsThread = 0;
+  itsIter.origin();
+#ifdef USE_THREADS
+  itsThread = new pthread_t;
+  int error = pthread_create (ITSTHREAD, 0, runThread, this);
+  if (error != 0) {
+    delete ITSTHREAD;
+    itsThread = 0;
+    throw SystemCallError ("pthread_create", error);
+  }
+#endif
+}
+
+void* MSPrefetchIter::runThread (void* iter)
+{
+  static_cast<MSPrefetchIter*>(iter)->run();
+  return 0;
+}
+
+void MSPrefetchIter::run()
+{
+  while (True) {
+    {
+      ScopedMutexLock lock(itsMutex);
+      while (!itsStop  &&  !itsEnd  &&  !itsAll  &&
+             itsNrMade >= itsNext + itsQueueSize) {
+        itsCondition.wait (itsMutex);
+      }
+      if (itsStop  ||  itsEnd) {
+        break;
+      }
+    }
+    makeChunk();
+  }
+}
+
+void MSPrefetchIter::makeChunk()
+{
+  // Only this function accesses the tables, so the chunks' tables are
+  // released here as well. The chunk last obtained by next() has to
+  // stay valid.
+  // A placeholder for the new chunk is added, so it can be filled without
+  // holding the lock. Other threads do not use it until itsNrMade is
+  // incremented.
+  MSIterChunk* chunkPtr;
+  {
+    ScopedMutexLock lock(itsMutex);
+    if (! itsAll) {
+      while (itsFirst + 1 < itsNext) {
+        itsChunks.pop_front();
+        itsFirst++;
+      }
+    }
+    itsChunks.push_back (MSIterChunk());
+    chunkPtr = &(itsChunks.back());
+  }
+  MSIterChunk& chunk = *chunkPtr;
+  Bool end = False;
+  String error;
+  // An exception cannot be passed to the other threads, so keep its message.
+  try {
+    if (! itsIter.more()) {
+      end = True;
+    } else {
+      chunk.table             = itsIter.table();
+      chunk.chunkNr           = itsNrMade;
+      chunk.msId              = itsIter.msId();
+      chunk.arrayId           = itsIter.arrayId();
+      chunk.fieldId           = itsIter.fieldId();
+      chunk.dataDescId        = itsIter.dataDescriptionId();
+      chunk.spectralWindowId  = itsIter.spectralWindowId();
+      chunk.polarizationId    = itsIter.polarizationId();
+      chunk.newMS             = itsIter.newMS();
+      chunk.newField          = itsIter.newField();
+      chunk.newSpectralWindow = itsIter.newSpectralWindow();
+      chunk.frequency         = itsIter.frequency();
+      chunk.phaseCenter       = itsIter.phaseCenter();
+      if (itsColumns.size() > 0) {
+        TableProxy proxy(chunk.table);
+        for (uInt i=0; i<itsColumns.size(); ++i) {
+          chunk.data.defineFromValueHolder
+            (itsColumns[i], proxy.getColumn (itsColumns[i], 0, -1, 1));
+        }
+      }
+      itsIter++;
+    }
+  } catch (std::exception& x) {
+    error = x.what();
+    end   = True;
+  }
+  ScopedMutexLock lock(itsMutex);
+  if (end) {
+    itsChunks.pop_back();
+    itsError = error;
+    itsEnd   = True;
+  } else {
+    itsNrMade++;
+  }
+  itsCondition.broadcast();
+}
+
+Bool MSPrefetchIter::waitForChunk (uInt chunkNr)
+{
+  while (chunkNr >= itsNrMade  &&  !itsEnd) {
+#ifdef USE_THREADS
+    itsCondition.wait (itsMutex);
+#else
+    makeChunk();
+#endif
+  }
+  if (chunkNr >= itsNrMade  &&  !itsError.empty()) {
+    throw AipsError ("MSPrefetchIter: iteration failed: " + itsError);
+  }
+  return chunkNr < itsNrMade;
+}
+
+const MSIterChunk* MSPrefetchIter::next()
+{
+  ScopedMutexLock lock(itsMutex);
+  if (! waitForChunk (itsNext)) {
+    return 0;
+  }
+  const MSIterChunk* chunk = &(itsChunks[itsNext - itsFirst]);
+  itsNext++;
+  itsCondition.broadcast();
+  return chunk;
+}
+
+uInt MSPrefetchIter::nchunk()
+{
+  ScopedMutexLock lock(itsMutex);
+  itsAll = True;
+  itsCondition.broadcast();
+  waitForChunk (std::numeric_limits<uInt>::max());
+  return itsNrMade;
+}
+
+const MSIterChunk& MSPrefetchIter::getChunk (uInt chunkNr)
+{
+  ScopedMutexLock lock(itsMutex);
+  itsAll = True;
+  itsCondition.broadcast();
+  if (! waitForChunk (chunkNr)) {
+    throw AipsError ("MSPrefetchIter::getChunk: chunk " +
+                     String::toString(chunkNr) + " does not exist");
+  }
+  if (chunkNr < itsFirst) {
+    throw AipsError ("MSPrefetchIter::getChunk: chunk " +
+                     String::toString(chunkNr) +
+                     " has already been removed after next()");
+  }
+  return itsChunks[chunkNr - itsFirst];
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,256 @@
+//# MSPrefetchIter.h: Iterate through MeasurementSets with chunks prepared in a background thread
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+#ifndef MS_MSPREFETCHITER_H
+#define MS_MSPREFETCHITER_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/ms/MeasurementSets/MSIter.h>
+#include <casacore/casa/OS/Mutex.h>
+#include <casacore/casa/Containers/Record.h>
+#include <deque>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// A chunk of a MeasurementSet produced by MSPrefetchIter
+// </summary>
+
+// <use visibility=export>
+
+// <synopsis>
+// This struct contains the table of a single MSIter iteration step and
+// the meta data that MSIter would give for that step. The meta data are
+// copies, so they stay valid when the iterator moves on.
+// The <src>new*</src> flags tell if a value differs from the previous
+// chunk in iteration order.
+// <br>Field <src>data</src> contains the data of the columns to be
+// prefetched (as given to the MSPrefetchIter constructor).
+// </synopsis>
+
+struct MSIterChunk
+{
+  MSIterChunk()
+    : chunkNr(0), msId(-1), arrayId(-1), fieldId(-1), dataDescId(-1),
+      spectralWindowId(-1), polarizationId(-1),
+      newMS(False), newField(False), newSpectralWindow(False)
+  {}
+
+  // The (reference) table containing the rows of the chunk.
+  Table table;
+  // The sequence number of the chunk.
+  uInt  chunkNr;
+  Int   msId;
+  Int   arrayId;
+  Int   fieldId;
+  Int   dataDescId;
+  Int   spectralWindowId;
+  Int   polarizationId;
+  Bool  newMS;
+  Bool  newField;
+  Bool  newSpectralWindow;
+  // The frequencies of the channels (see MSIter::frequency).
+  Vector<Double> frequency;
+  // The phase center of the field.
+  MDirection     phaseCenter;
+  // The data of the prefetched columns (a field per column).
+  Record         data;
+};
+
+
+// <summary>
+// Iterate through MeasurementSets with chunks prepared in a background thread
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tMSIter.cc">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class="MSIter">MSIter</linkto>
+// </prerequisite>
+
+// <synopsis>
+// MSPrefetchIter iterates in the same way as <linkto class=MSIter>MSIter</linkto>
+// (it uses an MSIter internally), but the iteration is done by a
+// background thread. For each iteration step it makes an
+// <linkto class=MSIterChunk>MSIterChunk</linkto> containing the table
+// and the meta data (such as frequencies and phase center), which are
+// read from the subtables when needed. Optionally the data of some columns
+// (e.g. DATA, FLAG and UVW) are read into the chunk as well.
+// The thread stays at most <src>queueSize</src> chunks ahead of the
+// chunks obtained by function <src>next</src>. In this way the iteration
+// and reading overlap with the processing of the chunks.
+// <p>
+// It is also possible to process the chunks in multiple threads by
+// giving each thread its own range of chunks. Function <src>nchunk</src>
+// waits until all chunks are made, whereafter <src>getChunk</src> can be
+// used to get a chunk.
+// <p>
+// The chunks are kept by the iterator; <src>next</src> and
+// <src>getChunk</src> return a reference to them. In this way no table
+// objects are copied or destructed by the caller. The table system is not
+// thread-safe, so while the background thread is iterating, only the
+// iterator accesses the tables; the caller should use the prefetched data
+// and meta data in the chunk instead of its table. The synchronization
+// is done internally and is only held while exchanging a chunk, thus
+// not while the iterator advances.
+// <br>After <src>nchunk</src> has returned, the background thread does
+// not access the tables anymore, so the chunks' tables can be used
+// (with the usual restrictions of the table system).
+// <br>If casacore is built without thread support, the chunks are made
+// when asked for.
+// </synopsis>
+
+// <example>
+// <srcblock>
+// MeasurementSet ms("my.ms");
+// Block<Int> sort;
+// MSPrefetchIter iter(ms, sort, 60., True, 4, Vector<String>(1, "DATA"));
+// while (const MSIterChunk* chunk = iter.next()) {
+//   Cube<Complex> data (chunk->data.asArrayComplex ("DATA"));
+//   process (data, chunk->frequency, chunk->phaseCenter);
+// }
+// </srcblock>
+// Processing disjoint ranges of chunks in parallel can be done like:
+// <srcblock>
+// Int nchunk = iter.nchunk();
+// #pragma omp parallel for
+// for (Int i=0; i<nchunk; ++i) {
+//   const MSIterChunk& chunk = iter.getChunk (i);
+//   ...
+// }
+// </srcblock>
+// </example>
+
+// <motivation>
+// Imaging and calibration applications have to wait for MSIter to find
+// the rows of the next chunk and read the meta data and the data.
+// </motivation>
+
+class MSPrefetchIter
+{
+public:
+  // Create the iterator for one or more MeasurementSets.
+  // The arguments are the same as for MSIter.
+  // The iteration thread keeps at most <src>queueSize</src> chunks ahead.
+  // The data of the given columns are read into each chunk. They must be
+  // scalar columns or array columns with a fixed shape in a chunk.
+  // <group>
+  MSPrefetchIter (const MeasurementSet& ms, const Block<Int>& sortColumns,
+                  Double timeInterval=0, Bool addDefaultSortColumns=True,
+                  uInt queueSize=4,
+                  const Vector<String>& prefetchColumns=Vector<String>());
+  MSPrefetchIter (const Block<MeasurementSet>& mss,
+                  const Block<Int>& sortColumns,
+                  Double timeInterval=0, Bool addDefaultSortColumns=True,
+                  uInt queueSize=4,
+                  const Vector<String>& prefetchColumns=Vector<String>());
+  // </group>
+
+  // Stop the iteration thread.
+  ~MSPrefetchIter();
+
+  // Get the next chunk. It waits until the chunk has been made.
+  // It returns a null pointer if there are no more chunks.
+  // <br>The chunk stays valid until <src>next</src> is called again.
+  // To limit memory usage, the iterator thereafter removes it, unless
+  // <src>getChunk</src> or <src>nchunk</src> has been called before.
+  const MSIterChunk* next();
+
+  // Get the total number of chunks. It waits until all chunks have
+  // been made.
+  uInt nchunk();
+
+  // Get the given chunk. It waits until the chunk has been made.
+  // An exception is thrown if the chunk number is invalid or if the
+  // chunk has already been removed after being obtained by <src>next</src>.
+  const MSIterChunk& getChunk (uInt chunkNr);
+
+private:
+  // Forbid copy constructor and assignment.
+  // <group>
+  MSPrefetchIter (const MSPrefetchIter&);
+  MSPrefetchIter& operator= (const MSPrefetchIter&);
+  // </group>
+
+  // Initialize and start the thread.
+  void init (uInt queueSize, const Vector<String>& prefetchColumns);
+
+  // Remove the chunks consumed by <src>next</src>, make the chunk of the
+  // current iteration step and advance the iterator.
+  // It sets itsEnd if the iteration is at its end.
+  // The lock on itsMutex must not be held; it is only acquired to update
+  // the queue, thus not while the chunk is made.
+  void makeChunk();
+
+  // Wait until the given chunk has been made or the iteration has ended.
+  // It returns False if the chunk does not exist.
+  // The lock on itsMutex has to be held.
+  Bool waitForChunk (uInt chunkNr);
+
+  // The function executed by the thread.
+  static void* runThread (void* iter);
+
+  // Make chunks until the end or until stopped.
+  void run();
+
+  //# Data members
+  MSIter   itsIter;
+  Vector<String> itsColumns;
+  // The lock for the chunks and state below.
+  Mutex    itsMutex;
+  Condition itsCondition;
+  // The chunks made (and the one being made). A deque is used, because
+  // references to its elements stay valid when adding or removing at
+  // the begin or end.
+  std::deque<MSIterChunk> itsChunks;
+  uInt     itsQueueSize;
+  // The chunk number of the first chunk in itsChunks.
+  uInt     itsFirst;
+  // The number of chunks made.
+  uInt     itsNrMade;
+  // The number of chunks obtained by next().
+  uInt     itsNext;
+  // Make all chunks regardless of the queue size?
+  Bool     itsAll;
+  Bool     itsEnd;
+  Bool     itsStop;
+  // The error message if the iteration failed.
+  String   itsError;
+  // The thread handle (a void* to avoid including pthread.h).
+  void*    itsThread;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
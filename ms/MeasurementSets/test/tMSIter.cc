@@ -29,6 +29,7 @@
 
 #include <casacore/ms/MeasurementSets/MeasurementSet.h>
 #include <casacore/ms/MeasurementSets/MSIter.h>
+#include <casacore/ms/MeasurementSets/MSPrefetchIter.h>
 #include <casacore/ms/MeasurementSets/MSColumns.h>
 #include <casacore/ms/MeasurementSets/MSFieldColumns.h>
 #include <casacore/ms/MeasurementSets/MSDataDescColumns.h>
@@ -40,6 +41,8 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/ArrayIO.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <iostream>
 #include <sstream>
 
@@ -146,6 +149,74 @@ void iterMS (double binwidth)
   }
 }
 
+void iterMSPrefetch (double binwidth)
+{
+  // The chunks must be the same as made by MSIter.
+  MeasurementSet ms("tMSIter_tmp.ms");
+  Block<int> sort(2);
+  sort[0] = MS::ANTENNA1;
+  sort[1] = MS::ANTENNA2;
+  Vector<String> columns(2);
+  columns[0] = "TIME";
+  columns[1] = "DATA";
+  // Keep the meta data and prefetched data of the chunks. While iterating,
+  // only the iterator accesses the tables.
+  vector<MSIterChunk> chunks;
+  {
+    MSPrefetchIter iter(ms, sort, binwidth, False, 2, columns);
+    while (const MSIterChunk* chunk = iter.next()) {
+      AlwaysAssertExit (chunk->chunkNr == chunks.size());
+      chunks.push_back (MSIterChunk());
+      MSIterChunk& copy = chunks.back();
+      copy.chunkNr    = chunk->chunkNr;
+      copy.fieldId    = chunk->fieldId;
+      copy.dataDescId = chunk->dataDescId;
+      copy.newMS      = chunk->newMS;
+      copy.frequency  = chunk->frequency;
+      copy.data       = chunk->data;
+    }
+    AlwaysAssertExit (iter.next() == 0);
+    // The chunks obtained by next() have been removed.
+    Bool removed = False;
+    try {
+      iter.getChunk (0);
+    } catch (AipsError&) {
+      removed = True;
+    }
+    AlwaysAssertExit (removed  ||  chunks.size() <= 2);
+  }
+  MSIter msIter(ms, sort, binwidth, False);
+  uInt nchunk = 0;
+  for (msIter.origin(); msIter.more(); msIter++) {
+    AlwaysAssertExit (nchunk < chunks.size());
+    const MSIterChunk& chunk = chunks[nchunk];
+    AlwaysAssertExit (chunk.fieldId == msIter.fieldId());
+    AlwaysAssertExit (chunk.dataDescId == msIter.dataDescriptionId());
+    AlwaysAssertExit (allEQ (chunk.frequency, msIter.frequency()));
+    AlwaysAssertExit (chunk.newMS == (nchunk == 0));
+    AlwaysAssertExit (allEQ (chunk.data.asArrayDouble("TIME"),
+                             ROScalarColumn<Double>(msIter.table(),
+                                                    "TIME").getColumn()));
+    AlwaysAssertExit (allEQ (chunk.data.asArrayComplex("DATA"),
+                             ROArrayColumn<Complex>(msIter.table(),
+                                                    "DATA").getColumn()));
+    nchunk++;
+  }
+  AlwaysAssertExit (nchunk == chunks.size());
+  // Get the chunks in random order. After nchunk() the iterator does not
+  // access the tables anymore.
+  MSPrefetchIter iter2(ms, sort, binwidth, False);
+  AlwaysAssertExit (iter2.nchunk() == nchunk);
+  for (uInt i=0; i<nchunk; ++i) {
+    const MSIterChunk& chunk1 = iter2.getChunk (nchunk-i-1);
+    const MSIterChunk& chunk2 = iter2.getChunk (i);
+    AlwaysAssertExit (chunk1.chunkNr == nchunk-i-1  &&  chunk2.chunkNr == i);
+    AlwaysAssertExit (chunk1.table.nrow() > 0  &&  chunk2.table.nrow() > 0);
+    AlwaysAssertExit (chunk1.data.nfields() == 0);
+  }
+  cout << "MSPrefetchIter gave " << nchunk << " chunks" << endl;
+}
+
 int main (int argc, char* argv[])
 {
   try {
@@ -171,6 +242,7 @@ int main (int argc, char* argv[])
     }
     createMS(nant, ntime, msinterval);
     iterMS (binwidth);
+    iterMSPrefetch (binwidth);
   } catch (std::exception& x) {
     cerr << "Unexpected exception: " << x.what() << endl;
     return 1;
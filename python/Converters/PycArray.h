@@ -90,6 +90,18 @@ namespace casacore { namespace python {
   boost::python::object makePyArrayObject (casacore::Array<String> const& arr);
   // </group>
 
+  // Make the PyArrayObject sharing the Array's storage if possible.
+  // It avoids a copy of the data for large arrays (e.g. a column read
+  // by TableProxy::getColumn). If the storage cannot be shared (or for
+  // strings), it is the same as makePyArrayObject.
+  // <group>
+  template <typename T>
+  boost::python::object makePyArrayObjectShared (casacore::Array<T> const& arr);
+  template <>
+  boost::python::object makePyArrayObjectShared
+    (casacore::Array<String> const& arr);
+  // </group>
+
   // Convert Array to Python.
   template <typename T>
   struct casa_array_to_python
@@ -397,3 +397,26 @@
     (casacore::Array<Complex> const& arr);
   template boost::python::object makePyArrayObject
     (casacore::Array<DComplex> const& arr);
+
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<Bool> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<uChar> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<Short> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<uShort> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<Int> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<uInt> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<Int64> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<Float> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<Double> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<Complex> const& arr);
+  template boost::python::object makePyArrayObjectShared
+    (casacore::Array<DComplex> const& arr);
@@ -85,4 +85,14 @@
   template <typename T>
   boost::python::object makePyArrayObject (casacore::Array<T> const& arr);
 
+  // Convert a Casacore array to a Python array object sharing the storage
+  // of the Casacore array, thus without copying the data. A copy of the
+  // Array object is kept in a capsule that is the base object of the Python
+  // array, so the storage stays alive until the Python array is deleted.
+  // The storage is only shared if it is contiguous, owned by the Array, not
+  // referenced by another Array (to avoid unexpected aliasing), and has
+  // the same layout in Python. Otherwise makePyArrayObject is used.
+  template <typename T>
+  boost::python::object makePyArrayObjectShared (casacore::Array<T> const& arr);
+
 
@@ -314,6 +314,59 @@ namespace casacore { namespace python { namespace numpy {
     return boost::python::object(boost::python::handle<>((PyObject*)po));
   }
 
+  // Delete the Array kept alive by a Python array sharing its storage.
+  template <typename T>
+  void deleteSharedArray (PyObject* capsule)
+  {
+    delete static_cast<casacore::Array<T>*>
+      (PyCapsule_GetPointer (capsule, "casacore.Array"));
+  }
+
+  template <typename T>
+  boost::python::object makePyArrayObjectShared (casacore::Array<T> const& arr)
+  {
+    // Only share if numpy can use the data as is and if nobody else
+    // can change the data behind Python's back (or delete it).
+    if (sizeof(T) != sizeof(typename TypeConvTraits<T>::python_type)
+	||  arr.size() == 0  ||  !arr.contiguousStorage()
+	||  arr.nrefs() != 1  ||  !arr.ownsStorage()) {
+      return makePyArrayObject (arr);
+    }
+    // Load the API if needed.
+    if (!PyArray_API) loadAPI();
+    // Swap axes, because Casacore has row minor and Python row major order.
+    int nd = arr.ndim();
+    vector<npy_intp> newshp(nd);
+    const IPosition& shp = arr.shape();
+    for (int i=0; i<nd; i++) {
+      newshp[i] = shp[nd-i-1];
+    }
+    // The copy references the storage, so it stays alive as long as
+    // the capsule (i.e., the numpy array) exists.
+    casacore::Array<T>* keep = new casacore::Array<T>(arr);
+    PyObject* capsule = PyCapsule_New (keep, "casacore.Array",
+				       &deleteSharedArray<T>);
+    if (capsule == 0) {
+      delete keep;
+      boost::python::throw_error_already_set();
+    }
+    PyArrayObject* po = (PyArrayObject*)
+      (PyArray_SimpleNewFromData (nd, &(newshp[0]),
+				  TypeConvTraits<T>::pyType(),
+				  keep->data()));
+    if (po == 0) {
+      Py_DECREF (capsule);
+      boost::python::throw_error_already_set();
+    }
+    // The numpy array steals the reference to the capsule.
+#if NPY_API_VERSION >= 0x00000007
+    PyArray_SetBaseObject (po, capsule);
+#else
+    po->base = capsule;
+#endif
+    return boost::python::object(boost::python::handle<>((PyObject*)po));
+  }
+
 
 }}}
 
@@ -60,26 +60,28 @@ namespace casacore { namespace python {
       return boost::python::object(vh.asDComplex());
     case TpString:
       return boost::python::object((std::string const&)(vh.asString()));
+    // Arrays share their storage with numpy if possible, because the
+    // ValueHolder is usually a temporary result (e.g. of a column read).
     case TpArrayBool:
-      return casa_array_to_python<Bool>::makeobject (vh.asArrayBool());
+      return makePyArrayObjectShared (vh.asArrayBool());
     case TpArrayUChar:
-      return casa_array_to_python<uChar>::makeobject (vh.asArrayuChar());
+      return makePyArrayObjectShared (vh.asArrayuChar());
     case TpArrayShort:
-      return casa_array_to_python<Short>::makeobject (vh.asArrayShort());
+      return makePyArrayObjectShared (vh.asArrayShort());
     case TpArrayInt:
-      return casa_array_to_python<Int>::makeobject (vh.asArrayInt());
+      return makePyArrayObjectShared (vh.asArrayInt());
     case TpArrayUInt:
-      return casa_array_to_python<uInt>::makeobject (vh.asArrayuInt());
+      return makePyArrayObjectShared (vh.asArrayuInt());
     case TpArrayInt64:
-      return casa_array_to_python<Int64>::makeobject (vh.asArrayInt64());
+      return makePyArrayObjectShared (vh.asArrayInt64());
     case TpArrayFloat:
-      return casa_array_to_python<Float>::makeobject (vh.asArrayFloat());
+      return makePyArrayObjectShared (vh.asArrayFloat());
     case TpArrayDouble:
-      return casa_array_to_python<Double>::makeobject (vh.asArrayDouble());
+      return makePyArrayObjectShared (vh.asArrayDouble());
     case TpArrayComplex:
-      return casa_array_to_python<Complex>::makeobject (vh.asArrayComplex());
+      return makePyArrayObjectShared (vh.asArrayComplex());
     case TpArrayDComplex:
-      return casa_array_to_python<DComplex>::makeobject (vh.asArrayDComplex());
+      return makePyArrayObjectShared (vh.asArrayDComplex());
     case TpArrayString:
       return casa_array_to_python<String>::makeobject (vh.asArrayString());
     case TpRecord:
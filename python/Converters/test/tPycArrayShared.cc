@@ -0,0 +1,137 @@
+//# tPycArrayShared.cc: Test program for sharing Arrays with numpy
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/python/Converters/PycExcp.h>
+#include <casacore/python/Converters/PycBasicData.h>
+#include <casacore/python/Converters/PycArray.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/Vector.h>
+
+#include <boost/python.hpp>
+
+using namespace boost::python;
+
+// This module tests makePyArrayObjectShared.
+// Each function creates an Array in the same way (shape [3,4] filled with
+// 0..11) and returns it as a numpy array. The address of the Array data is
+// remembered, so tPycArrayShared.py can check if numpy shares the data or
+// has a copy of it.
+// Only the first function can share; the others hit one of the guards
+// in makePyArrayObjectShared and must fall back to a copy.
+
+namespace casacore { namespace python {
+
+  struct TPycArrayShared
+  {
+    TPycArrayShared()
+      : itsAddr   (0),
+        itsBuffer (12)
+      {}
+
+    // Return the address of the data of the last Array made.
+    Int64 lastaddr() const
+      { return Int64(itsAddr); }
+
+    // A temporary, contiguous Array owning its data; it is shared.
+    // The Array itself is destroyed when returning, so the numpy array
+    // is the only one keeping the data alive.
+    object shared()
+    {
+      Array<Double> arr(IPosition(2,3,4));
+      indgen (arr);
+      itsAddr = size_t(arr.data());
+      return makePyArrayObjectShared (arr);
+    }
+
+    // A noncontiguous section of an Array; it is copied.
+    object noncontiguous()
+    {
+      Array<Double> arr(IPosition(2,6,4));
+      indgen (arr);
+      Array<Double> sect = arr(IPosition(2,0,0), IPosition(2,5,3),
+                               IPosition(2,2,1));
+      indgen (sect);
+      itsAddr = size_t(sect.data());
+      return makePyArrayObjectShared (sect);
+    }
+
+    // An Array whose data is also referenced by itsKept; it is copied,
+    // otherwise changing itsKept would change the numpy array.
+    object multiref()
+    {
+      Array<Double> arr(IPosition(2,3,4));
+      indgen (arr);
+      itsKept.reference (arr);
+      itsAddr = size_t(arr.data());
+      return makePyArrayObjectShared (arr);
+    }
+
+    // The sum of itsKept, used to check that the copy made by multiref
+    // is independent of it.
+    Double keptsum() const
+      { return sum(itsKept); }
+
+    // An Array using storage it does not own; it is copied, because the
+    // storage can be deleted by its owner at any time.
+    object borrowed()
+    {
+      Array<Double> arr(IPosition(2,3,4), itsBuffer.data(), SHARE);
+      indgen (arr);
+      itsAddr = size_t(arr.data());
+      return makePyArrayObjectShared (arr);
+    }
+
+    size_t         itsAddr;
+    Array<Double>  itsKept;
+    Vector<Double> itsBuffer;
+  };
+
+
+  void testPycArrayShared()
+  {
+    class_<TPycArrayShared> ("tPycArrayShared", init<>())
+      .def ("lastaddr",      &TPycArrayShared::lastaddr)
+      .def ("shared",        &TPycArrayShared::shared)
+      .def ("noncontiguous", &TPycArrayShared::noncontiguous)
+      .def ("multiref",      &TPycArrayShared::multiref)
+      .def ("keptsum",       &TPycArrayShared::keptsum)
+      .def ("borrowed",      &TPycArrayShared::borrowed)
+      ;
+  }
+
+}}
+
+
+BOOST_PYTHON_MODULE(_tPycArrayShared)
+{
+  // Register the required converters.
+  casacore::python::register_convert_excp();
+  casacore::python::register_convert_basicdata();
+
+  // Execute the test.
+  casacore::python::testPycArrayShared();
+}
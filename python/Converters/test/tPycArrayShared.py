@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+from _tPycArrayShared import *
+
+def isshared(t, a):
+    # A shared array refers to the Array data and is kept alive by its base.
+    return (a.ctypes.data == t.lastaddr()  and  a.base is not None
+            and  not a.flags.owndata)
+
+def iscopy(t, a):
+    return (a.ctypes.data != t.lastaddr()  and  a.flags.owndata)
+
+def hasvalues(a):
+    return (a.shape == (4,3)  and
+            (a == NUM.arange(12, dtype=NUM.float64).reshape(4,3)).all())
+
+def testshared(t):
+    print 'testshared'
+    a = t.shared()
+    print isshared(t, a), hasvalues(a)
+    # The C++ Array is gone; making other arrays must not affect the data.
+    b = t.shared()
+    print isshared(t, b), a.ctypes.data != b.ctypes.data
+    del b
+    c = t.borrowed()
+    print hasvalues(a)
+    # The data can be changed and is still valid when the module object
+    # is gone.
+    a[1,2] = -1
+    del t
+    print a[1,2], a.sum()
+
+def testnoncontiguous(t):
+    print 'testnoncontiguous'
+    a = t.noncontiguous()
+    print iscopy(t, a), hasvalues(a)
+
+def testmultiref(t):
+    print 'testmultiref'
+    a = t.multiref()
+    print iscopy(t, a), hasvalues(a)
+    a[0,0] = 100
+    print t.keptsum()
+
+def testborrowed(t):
+    print 'testborrowed'
+    a = t.borrowed()
+    print iscopy(t, a), hasvalues(a)
+
+if __name__ == "__main__":
+
+    import numpy as NUM;
+    t = tPycArrayShared();
+    testnoncontiguous(t)
+    testmultiref(t)
+    testborrowed(t)
+    testshared(t)
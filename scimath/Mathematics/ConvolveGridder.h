@@ -59,6 +59,25 @@ public:
 		      const Vector<Domain>& position,
 		      Range& value);
 
+  // Grid or degrid a batch of values. Column i of <src>positions</src>
+  // holds the position of value i. The values are bucketed in strips
+  // along the last grid axis, so values close on the grid are handled
+  // together. When compiled with OpenMP, the strips are handled in parallel.
+  // In gridding first the even strips are done, thereafter the odd strips.
+  // A strip is at least twice the support wide, so values gridded at the
+  // same time cannot write the same grid cells.
+  // <br>Values off the grid are skipped (degridded values are set to zero).
+  // False is returned if any value was off the grid.
+  // <group>
+  virtual Bool grid(Array<Range>& gridded,
+		    const Matrix<Domain>& positions,
+		    const Vector<Range>& values);
+
+  virtual Bool degrid(const Array<Range>& gridded,
+		      const Matrix<Domain>& positions,
+		      Vector<Range>& values);
+  // </group>
+
   Vector<Double>& cFunction();
 
   Vector<Int>& cSupport();
@@ -69,6 +88,15 @@ protected:
   virtual Range correctionFactor1D(Int loc, Int len);
 
 private:
+  // Determine the grid location and position of each value in a batch.
+  // Sort the indices of the values on the grid by strip along the last axis
+  // (stable, thus in input order within a strip). The indices of strip j
+  // are <src>order(stripStart(j))</src> till <src>order(stripStart(j+1))</src>.
+  // It returns False if any value is off the grid.
+  Bool bucketValues(const Matrix<Domain>& positions, Bool subtractOffset,
+		    Matrix<Int>& locs, Matrix<Domain>& gridPositions,
+		    Vector<uInt>& order, Vector<uInt>& stripStart);
+
   Vector<Double> convFunc;
   Vector<Int> supportVec;
   Vector<Int> loc;
@@ -33,6 +33,11 @@
 #include <casacore/casa/BasicSL/Constants.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/Slice.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -381,6 +386,168 @@ Bool ConvolveGridder<Domain, Range>::degrid(const Array<Range> &gridded,
   }
 }
 
+template <class Domain, class Range>
+Bool ConvolveGridder<Domain, Range>::bucketValues(const Matrix<Domain>& positions,
+					    Bool subtractOffset,
+					    Matrix<Int>& locs,
+					    Matrix<Domain>& gridPositions,
+					    Vector<uInt>& order,
+					    Vector<uInt>& stripStart)
+{
+  AlwaysAssert(Int(positions.nrow()) == ndim, AipsError);
+  const uInt nvalue = positions.ncolumn();
+  locs.resize(ndim, nvalue);
+  gridPositions.resize(ndim, nvalue);
+  // Use strips of at least 16 rows to keep the number of strips moderate.
+  const Int lastAxis = ndim-1;
+  const Int stripWidth = max(2*support+1, 16);
+  const uInt nstrip = (shapeVec(lastAxis) + stripWidth - 1) / stripWidth;
+  stripStart.resize(nstrip+1);
+  stripStart = 0;
+  Vector<uInt> stripIndex(nvalue);
+  Bool allOnGrid = True;
+  for (uInt i=0; i<nvalue; ++i) {
+    Bool on = True;
+    for (Int axis=0; axis<ndim; ++axis) {
+      Domain gpos = scale(axis)*positions(axis,i) + offset(axis);
+      Int l = this->nint(gpos);
+      if (subtractOffset) {
+	l -= offsetVec(axis);
+      }
+      gridPositions(axis,i) = gpos;
+      locs(axis,i) = l;
+      if (l+support >= shapeVec(axis)  ||  l-support < 0) {
+	on = False;
+      }
+    }
+    if (on) {
+      stripIndex(i) = locs(lastAxis,i) / stripWidth;
+      ++stripStart(stripIndex(i)+1);
+    } else {
+      stripIndex(i) = nstrip;
+      allOnGrid = False;
+    }
+  }
+  for (uInt j=0; j<nstrip; ++j) {
+    stripStart(j+1) += stripStart(j);
+  }
+  order.resize(stripStart(nstrip));
+  Vector<uInt> next(stripStart(Slice(0, nstrip)).copy());
+  for (uInt i=0; i<nvalue; ++i) {
+    if (stripIndex(i) < nstrip) {
+      order(next(stripIndex(i))++) = i;
+    }
+  }
+  return allOnGrid;
+}
+
+template <class Domain, class Range>
+Bool ConvolveGridder<Domain, Range>::grid(Array<Range>& gridded,
+				    const Matrix<Domain>& positions,
+				    const Vector<Range>& values)
+{
+  AlwaysAssert(positions.ncolumn() == values.nelements(), AipsError);
+  AlwaysAssert(gridded.shape().isEqual(shape), AipsError);
+  if (ndim < 1  ||  ndim > 3) {
+    return False;
+  }
+  Matrix<Int> locs;
+  Matrix<Domain> gpos;
+  Vector<uInt> order, stripStart;
+  Bool allOnGrid = bucketValues(positions, True, locs, gpos,
+				order, stripStart);
+  const IPosition& fs = gridded.shape();
+  vector<Int> s(fs.begin(), fs.end());
+  Bool deleteGrid, deleteValues;
+  Range* gridPtr = gridded.getStorage(deleteGrid);
+  const Range* valuePtr = values.getStorage(deleteValues);
+  Double* convPtr = convFunc.data();
+  const Int nstrip = stripStart.nelements() - 1;
+  // Grid the even strips in parallel, thereafter the odd ones.
+  for (Int first=0; first<2; ++first) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (Int strip=first; strip<nstrip; strip+=2) {
+      for (uInt j=stripStart(strip); j<stripStart(strip+1); ++j) {
+	const uInt i = order(j);
+	Int* l = &(locs(0,i));
+	Double* p = &(gpos(0,i));
+	switch (ndim) {
+	case 1:
+	  grd1d(&s[0], l, gridPtr, valuePtr+i, &support,
+		&sampling, p, convPtr);
+	  break;
+	case 2:
+	  grd2d(&s[0], &s[1], l, l+1, gridPtr, valuePtr+i, &support,
+		&sampling, p, p+1, convPtr);
+	  break;
+	default:
+	  grd3d(&s[0], &s[1], &s[2], l, l+1, l+2, gridPtr, valuePtr+i,
+		&support, &sampling, p, p+1, p+2, convPtr);
+	  break;
+	}
+      }
+    }
+  }
+  values.freeStorage(valuePtr, deleteValues);
+  gridded.putStorage(gridPtr, deleteGrid);
+  return allOnGrid;
+}
+
+template <class Domain, class Range>
+Bool ConvolveGridder<Domain, Range>::degrid(const Array<Range>& gridded,
+				    const Matrix<Domain>& positions,
+				    Vector<Range>& values)
+{
+  AlwaysAssert(gridded.shape().isEqual(shape), AipsError);
+  values.resize(positions.ncolumn());
+  values = Range(0);
+  if (ndim < 1  ||  ndim > 3) {
+    return False;
+  }
+  Matrix<Int> locs;
+  Matrix<Domain> gpos;
+  Vector<uInt> order, stripStart;
+  Bool allOnGrid = bucketValues(positions, False, locs, gpos,
+				order, stripStart);
+  const IPosition& fs = gridded.shape();
+  vector<Int> s(fs.begin(), fs.end());
+  Bool deleteGrid, deleteValues;
+  const Range* gridPtr = gridded.getStorage(deleteGrid);
+  Range* valuePtr = values.getStorage(deleteValues);
+  Double* convPtr = convFunc.data();
+  const Int nstrip = stripStart.nelements() - 1;
+  // Degridding only reads the grid, so all strips can be done in parallel.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (Int strip=0; strip<nstrip; ++strip) {
+    for (uInt j=stripStart(strip); j<stripStart(strip+1); ++j) {
+      const uInt i = order(j);
+      Int* l = &(locs(0,i));
+      Double* p = &(gpos(0,i));
+      switch (ndim) {
+      case 1:
+	dgrd1d(&s[0], l, gridPtr, valuePtr+i, &support,
+	       &sampling, p, convPtr);
+	break;
+      case 2:
+	dgrd2d(&s[0], &s[1], l, l+1, gridPtr, valuePtr+i, &support,
+	       &sampling, p, p+1, convPtr);
+	break;
+      default:
+	dgrd3d(&s[0], &s[1], &s[2], l, l+1, l+2, gridPtr, valuePtr+i,
+	       &support, &sampling, p, p+1, p+2, convPtr);
+	break;
+      }
+    }
+  }
+  gridded.freeStorage(gridPtr, deleteGrid);
+  values.putStorage(valuePtr, deleteValues);
+  return allOnGrid;
+}
+
 template <class Domain, class Range>
 Range ConvolveGridder<Domain, Range>::correctionFactor1D(Int loc, Int len)
 {
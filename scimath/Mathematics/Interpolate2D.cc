@@ -245,7 +245,8 @@ void Interpolate2D::bcucof (Double c[4][4], const Double y[4],
     {0,0,0,0,0,0,0,0,2,-2,0,0,1,1,0,0},
     {-6,6,-6,6,-3,-3,3,3,-4,4,2,-2,-2,-2,-1,-1},
     {4,-4,4,-4,2,2,-2,-2,2,-2,-2,2,1,1,1,1} };
-  static Double X[16], CL[16];
+  // Local buffers (instead of static ones) to make it thread-safe.
+  Double X[16], CL[16];
   
   // Pack temporary
   for (uInt i=0; i<4; ++i) {
@@ -277,6 +278,8 @@ Interpolate2D::Method Interpolate2D::stringToMethod (const String &method) {
   Interpolate2D::Method method2;
   if (tmp==String("N")) {
     method2 = Interpolate2D::NEAREST;
+  } else if (typeU.size() > 1  &&  typeU.at(0, 2) == "LA") {
+    method2 = Interpolate2D::LANCZOS;
   } else if (tmp==String("L")) {
     method2 = Interpolate2D::LINEAR;
   } else if (tmp==String("C")) {
@@ -180,8 +180,8 @@ class Interpolate2D {
   // Recover interpolation method
   Method interpolationMethod() const {return itsMethod;}
   
-  // Convert string ("nearest", "linear", "cubic") to interpolation method
-  // Minimum match will do.
+  // Convert string ("nearest", "linear", "cubic", "lanczos") to interpolation
+  // method. Minimum match will do ("l" means linear, "la" or "z" lanczos).
   static Interpolate2D::Method stringToMethod(const String &method);
   
  private:
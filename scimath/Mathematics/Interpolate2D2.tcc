@@ -281,12 +281,26 @@ Bool Interpolate2D::interpLanczos(T &result,
         return True;
     }
 
+    // The kernel is separable, so first calculate the weights in x and y
+    // (only 4a instead of 8a*a kernel evaluations) and sum the data
+    // along x for each row.
+    const Int n = 2*Int(a);
+    const Int i0 = Int(floorx - a + 1);
+    const Int j0 = Int(floory - a + 1);
+    Double wx[2*3];
+    Double wy[2*3];
+    for (Int k=0; k<n; ++k) {
+        wx[k] = L(x - (i0+k), a);
+        wy[k] = L(y - (j0+k), a);
+    }
     // Interpolate
     result = 0;
-    for (T i = floorx - a + 1; i <= floorx + a; ++i) {
-        for (T j = floory - a + 1; j <= floory + a; ++j) {
-            result += data(i, j) * L(x - i, a) * L(y - j, a);
+    for (Int k=0; k<n; ++k) {
+        Double sum = 0;
+        for (Int m=0; m<n; ++m) {
+            sum += data(i0+m, j0+k) * wx[m];
         }
+        result += sum * wy[k];
     }
 
     return True;
@@ -0,0 +1,123 @@
+//# tConvolveGridder.cc: Test and time per-value and batch gridding
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/scimath/Mathematics/ConvolveGridder.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <iostream>
+#include <sstream>
+
+using namespace casacore;
+using namespace std;
+
+// Compare gridding and degridding of nvalue values one by one with
+// doing it in a batch. The timings are shown.
+// Optionally the number of values and grid size can be given as arguments.
+void doTest (uInt nvalue, Int gridSize)
+{
+  IPosition shape(2, gridSize, gridSize);
+  Vector<Double> scale(2, 1.);
+  Vector<Double> offset(2, Double(gridSize/2));
+  ConvolveGridder<Double, Complex> gridder(shape, scale, offset, "SF");
+  // Make pseudo-random positions; some are off the grid.
+  Matrix<Double> positions(2, nvalue);
+  Vector<Complex> values(nvalue);
+  uInt seed = 1;
+  Double range = 0.55*gridSize;
+  for (uInt i=0; i<nvalue; ++i) {
+    for (uInt j=0; j<2; ++j) {
+      seed = seed*1103515245 + 12345;
+      positions(j,i) = (Double((seed>>8) % 100000) / 100000. - 0.5) * range * 2;
+    }
+    values(i) = Complex(1 + i%7, Float(i%3) - 1);
+  }
+  Array<Complex> grid1(shape);
+  Array<Complex> grid2(shape);
+  grid1 = Complex();
+  grid2 = Complex();
+  {
+    Timer timer;
+    // Suppress the "Off grid" messages of the per-value grid.
+    streambuf* coutBuf = cout.rdbuf (0);
+    for (uInt i=0; i<nvalue; ++i) {
+      gridder.grid (grid1, positions.column(i), values(i));
+    }
+    cout.rdbuf (coutBuf);
+    timer.show (cout, "per-value grid  ");
+  }
+  Bool allOnGrid;
+  {
+    Timer timer;
+    allOnGrid = gridder.grid (grid2, positions, values);
+    timer.show (cout, "batch grid      ");
+  }
+  AlwaysAssertExit (! allOnGrid);
+  // The order of adding values to the grid can differ.
+  AlwaysAssertExit (allNearAbs (grid1, grid2, 1e-3*max(amplitude(grid1))));
+  Vector<Complex> result1(nvalue, Complex());
+  Vector<Complex> result2;
+  {
+    Timer timer;
+    for (uInt i=0; i<nvalue; ++i) {
+      gridder.degrid (grid1, positions.column(i), result1(i));
+    }
+    timer.show (cout, "per-value degrid");
+  }
+  {
+    Timer timer;
+    gridder.degrid (grid1, positions, result2);
+    timer.show (cout, "batch degrid    ");
+  }
+  AlwaysAssertExit (allNear (result1, result2, 1e-5));
+}
+
+int main (int argc, char* argv[])
+{
+  try {
+    uInt nvalue = 100000;
+    Int gridSize = 512;
+    if (argc > 1) {
+      istringstream istr(argv[1]);
+      istr >> nvalue;
+    }
+    if (argc > 2) {
+      istringstream istr(argv[2]);
+      istr >> gridSize;
+    }
+    doTest (nvalue, gridSize);
+  } catch (AipsError& x) {
+    cout << "Unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
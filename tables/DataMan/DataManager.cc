@@ -59,7 +59,7 @@ DataManager::DataManager()
 : nrcol_p       (0),
   seqnr_p       (0),
   asBigEndian_p (False),
-  tsmOption_p   (TSMOption::Buffer, 0, 0),
+  tsmOption_p   (TSMOption::Buffer, 0, 0, 0),
   multiFile_p   (0),
   clone_p       (0)
 {
@@ -92,13 +92,13 @@ Bool DataManager::isStorageManager() const
     { return True; }
 
 
-uInt DataManager::open1 (uInt nrrow, AipsIO& ios)
+rownr_t DataManager::open1 (rownr_t nrrow, AipsIO& ios)
 {
     open (nrrow, ios);
     return nrrow;
 }
 
-uInt DataManager::resync1 (uInt nrrow)
+rownr_t DataManager::resync1 (rownr_t nrrow)
 {
     resync (nrrow);
     return nrrow;
@@ -124,7 +124,8 @@ void DataManager::setMultiFile (MultiFileBase* mfile)
   multiFile_p = mfile;
   // Only caching can be used with a MultiFile.
   if (multiFile_p) {
-    tsmOption_p = TSMOption(TSMOption::Cache, 0, tsmOption_p.maxCacheSizeMB());
+    tsmOption_p = TSMOption(TSMOption::Cache, 0, tsmOption_p.maxCacheSizeMB(),
+                            tsmOption_p.prefetchDepth());
   }
 }
 
@@ -252,10 +253,10 @@ Bool DataManager::canAddColumn() const
 Bool DataManager::canRemoveColumn() const
     { return False; }
 
-void DataManager::addRow (uInt)
+void DataManager::addRow (rownr_t)
     { throw (DataManInvOper ("DataManager::addRow not allowed")); }
 
-void DataManager::removeRow (uInt)
+void DataManager::removeRow (rownr_t)
     { throw (DataManInvOper ("DataManager::removeRow not allowed")); }
 
 void DataManager::addColumn (DataManagerColumn*)
@@ -348,32 +349,32 @@ void DataManagerColumn::setShapeColumn (const IPosition&)
                           " in column " + columnName());
 }
 
-void DataManagerColumn::setShape (uInt, const IPosition&)
+void DataManagerColumn::setShape (rownr_t, const IPosition&)
 {
     throw DataManInvOper("setShape only allowed for non-FixedShape arrays"
                          " in column " + columnName());
 }
 
-void DataManagerColumn::setShapeTiled (uInt rownr, const IPosition& shape,
+void DataManagerColumn::setShapeTiled (rownr_t rownr, const IPosition& shape,
 				       const IPosition&)
 {
     setShape (rownr, shape);
 }
 
 // By default the shape is defined (for scalars).
-Bool DataManagerColumn::isShapeDefined (uInt)
+Bool DataManagerColumn::isShapeDefined (rownr_t)
 {
     return True;
 }
 
 // The default implementation of ndim is to use the shape.
-uInt DataManagerColumn::ndim (uInt rownr)
+uInt DataManagerColumn::ndim (rownr_t rownr)
 {
     return shape(rownr).nelements();
 }
 
 // The shape of the array in the given row.
-IPosition DataManagerColumn::shape (uInt)
+IPosition DataManagerColumn::shape (rownr_t)
 {
     return IPosition(0);
 }
@@ -414,6 +415,24 @@ Bool DataManagerColumn::canAccessColumnSlice (Bool& reask) const
     return False;
 }
 
+Bool DataManagerColumn::getZoneMap (Vector<rownr_t>&, Vector<Double>&,
+                                    Vector<Double>&)
+{
+    return False;
+}
+
+Bool DataManagerColumn::prepareConcurrentGet (uInt)
+{
+    return False;
+}
+
+void DataManagerColumn::getScalarCellsConcurrentV (const rownr_t*, size_t,
+                                                   void*) const
+{
+    throw (DataManInvOper("DataManagerColumn::getScalarCellsConcurrent"
+                          " not allowed in column " + columnName()));
+}
+
 
 String DataManagerColumn::dataTypeId() const
     { return String(); }
@@ -430,9 +449,9 @@ void DataManagerColumn::throwPut() const
 
 
 #define DATAMANAGER_GETPUT(T,NM) \
-void DataManagerColumn::aips_name2(get,NM) (uInt, T*) \
+void DataManagerColumn::aips_name2(get,NM) (rownr_t, T*) \
     { throwGet(); } \
-void DataManagerColumn::aips_name2(put,NM) (uInt, const T*) \
+void DataManagerColumn::aips_name2(put,NM) (rownr_t, const T*) \
     { throwPut(); }
 
 DATAMANAGER_GETPUT(Bool,BoolV)
@@ -448,12 +467,12 @@ DATAMANAGER_GETPUT(DComplex,DComplexV)
 DATAMANAGER_GETPUT(String,StringV)
 
 
-void DataManagerColumn::getOtherV (uInt, void*)
+void DataManagerColumn::getOtherV (rownr_t, void*)
 {
   throw (DataManInvOper ("DataManagerColumn::getOtherV not allowed"
                          " in column " + columnName()));
 }
-void DataManagerColumn::putOtherV (uInt, const void*)
+void DataManagerColumn::putOtherV (rownr_t, const void*)
 {
   throw (DataManInvOper ("DataManagerColumn::putOtherV not allowed"
                          " in column " + columnName()));
@@ -479,23 +498,23 @@ void DataManagerColumn::putScalarColumnCellsV (const RefRows&, const void*)
   throw (DataManInvOper("DataManagerColumn::putScalarColumnCells not allowed"
                         " in column " + columnName()));
 }
-uInt DataManagerColumn::getBlockV (uInt, uInt, void*)
+uInt DataManagerColumn::getBlockV (rownr_t, uInt, void*)
 {
   throw (DataManInvOper("DataManagerColumn::getBlock not allowed"
                         " in column " + columnName()));
   return 0;
 }
-void DataManagerColumn::putBlockV (uInt, uInt, const void*)
+void DataManagerColumn::putBlockV (rownr_t, uInt, const void*)
 {
   throw (DataManInvOper("DataManagerColumn::putBlock not allowed"
                         " in column " + columnName()));
 }
-void DataManagerColumn::getArrayV (uInt, void*)
+void DataManagerColumn::getArrayV (rownr_t, void*)
 {
   throw (DataManInvOper("DataManagerColumn::getArray not allowed"
                         " in column " + columnName()));
 }
-void DataManagerColumn::putArrayV (uInt, const void*)
+void DataManagerColumn::putArrayV (rownr_t, const void*)
 {
   throw (DataManInvOper("DataManagerColumn::putArray not allowed"
                         " in column " + columnName()));
@@ -520,12 +539,12 @@ void DataManagerColumn::putArrayColumnCellsV (const RefRows&, const void*)
   throw (DataManInvOper("DataManagerColumn::putArrayColumnCells not allowed"
                         " in column " + columnName()));
 }
-void DataManagerColumn::getSliceV (uInt, const Slicer&, void*)
+void DataManagerColumn::getSliceV (rownr_t, const Slicer&, void*)
 {
   throw (DataManInvOper("DataManagerColumn::getSlice not allowed"
                         " in column " + columnName()));
 }
-void DataManagerColumn::putSliceV (uInt, const Slicer&, const void*)
+void DataManagerColumn::putSliceV (rownr_t, const Slicer&, const void*)
 {
   throw (DataManInvOper("DataManagerColumn::putSlice not allowed"
                         " in column " + columnName()));
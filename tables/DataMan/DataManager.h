@@ -53,6 +53,7 @@ class IPosition;
 class Slicer;
 class RefRows;
 template<class T> class Array;
+template<class T> class Vector;
 class AipsIO;
 
 
@@ -445,11 +446,11 @@ private:
 
     // Add rows to all columns.
     // The default implementation throws a "not possible" exception.
-    virtual void addRow (uInt nrrow);
+    virtual void addRow (rownr_t nrrow);
 
     // Delete a row from all columns.
     // The default implementation throws a "not possible" exception.
-    virtual void removeRow (uInt rownr);
+    virtual void removeRow (rownr_t rownr);
 
     // Add a column.
     // The default implementation throws a "not possible" exception.
@@ -473,13 +474,13 @@ private:
     virtual Bool flush (AipsIO& ios, Bool fsync) = 0;
 
     // Let the data manager initialize itself for a new table.
-    virtual void create (uInt nrrow) = 0;
+    virtual void create (rownr_t nrrow) = 0;
 
     // Let the data manager initialize itself for an existing table.
     // The AipsIO stream represents the main table file and must be
     // used by virtual column engines to retrieve the data stored
     // in the flush function.
-    virtual void open (uInt nrrow, AipsIO& ios) = 0;
+    virtual void open (rownr_t nrrow, AipsIO& ios) = 0;
 
     // Open as above.
     // The data manager can return the number of rows it thinks there are.
@@ -487,12 +488,12 @@ private:
     // data are written outside the table system, thus for which no rows
     // have been added.
     // <br>By default it calls open and returns <src>nrrow</src>.
-    virtual uInt open1 (uInt nrrow, AipsIO& ios);
+    virtual rownr_t open1 (rownr_t nrrow, AipsIO& ios);
 
     // Resync the data by rereading cached data from the file.
     // This is called when a lock is acquired on the file and it appears 
     // that data in this data manager has been changed by another process.
-    virtual void resync (uInt nrrow) = 0;
+    virtual void resync (rownr_t nrrow) = 0;
 
     // Resync as above.
     // The data manager can return the number of rows it thinks there are.
@@ -500,7 +501,7 @@ private:
     // data are written outside the table system, thus for which no rows
     // have been added.
     // <br>By default it calls resync and returns <src>nrrow</src>.
-    virtual uInt resync1 (uInt nrrow);
+    virtual rownr_t resync1 (rownr_t nrrow);
 
     // Let the data manager initialize itself further.
     // Prepare is called after create/open has been called for all
@@ -660,25 +661,25 @@ public:
 
     // Set the shape of an (variable-shaped) array in the given row.
     // By default it throws a "not possible" exception.
-    virtual void setShape (uInt rownr, const IPosition& shape);
+    virtual void setShape (rownr_t rownr, const IPosition& shape);
 
     // Set the shape and tile shape of an (variable-shaped) array
     // in the given row.
     // By default it ignores the tile shape (thus only sets the shape).
-    virtual void setShapeTiled (uInt rownr, const IPosition& shape,
+    virtual void setShapeTiled (rownr_t rownr, const IPosition& shape,
 				const IPosition& tileShape);
 
     // Is the value shape defined in the given row?
     // By default it returns True.
-    virtual Bool isShapeDefined (uInt rownr);
+    virtual Bool isShapeDefined (rownr_t rownr);
 
     // Get the dimensionality of the item in the given row.
     // By default it returns shape(rownr).nelements().
-    virtual uInt ndim (uInt rownr);
+    virtual uInt ndim (rownr_t rownr);
 
     // Get the shape of the item in the given row.
     // By default it returns a zero-length IPosition (for a scalar value).
-    virtual IPosition shape (uInt rownr);
+    virtual IPosition shape (rownr_t rownr);
 
     // Can the data manager handle chaging the shape of an existing array?
     // Default is no.
@@ -752,6 +753,39 @@ public:
     // By default reask is set to False.
     virtual Bool canAccessColumnSlice (Bool& reask) const;
 
+    // Get the zone map of a scalar numeric column, i.e. the minimum and
+    // maximum value in each part (usually a bucket) of the column.
+    // Part <src>i</src> contains the rows from <src>startRows[i]</src>
+    // till <src>startRows[i+1]</src> (or till the end of the column).
+    // The range given for a part can be wider than the actual range of its
+    // values, but never narrower. NaN values are not taken into account.
+    // It can be used to skip parts of the column that cannot contain
+    // the values searched for.
+    // <br>False is returned if the data manager does not support zone maps
+    // for the column (which is the default).
+    virtual Bool getZoneMap (Vector<rownr_t>& startRows,
+                             Vector<Double>& minValues,
+                             Vector<Double>& maxValues);
+
+    // Prepare the column for getting scalar values by <src>nthreads</src>
+    // threads at the same time using <src>getScalarCellsConcurrentV</src>.
+    // A value of 1 ends the concurrent access.
+    // <br>False is returned if the data manager cannot read the column
+    // concurrently (which is the default). In that case the caller has to
+    // serialize the access to the column.
+    // <br>The column must not be changed while being read concurrently.
+    virtual Bool prepareConcurrentGet (uInt nthreads);
+
+    // Get the scalar values in the given rows.
+    // The argument dataPtr is in fact a T* pointing to a buffer of
+    // <src>nrow</src> values.
+    // It can be called by multiple threads at the same time once
+    // <src>prepareConcurrentGet</src> has returned True.
+    // The default implementation throws an "invalid operation" exception.
+    virtual void getScalarCellsConcurrentV (const rownr_t* rownrs,
+                                            size_t nrow,
+                                            void* dataPtr) const;
+
     // Get access to the ColumnCache object.
     // <group>
     ColumnCache& columnCache()
@@ -768,30 +802,30 @@ public:
     // The compiler complains about hiding virtual functions if you do not
     // declare all virtual functions with the same name in a derived class.
     // <group>
-    void get (uInt rownr, Bool* dataPtr)
+    void get (rownr_t rownr, Bool* dataPtr)
 	{ getBoolV (rownr, dataPtr); }
-    void get (uInt rownr, uChar* dataPtr)
+    void get (rownr_t rownr, uChar* dataPtr)
 	{ getuCharV (rownr, dataPtr); }
-    void get (uInt rownr, Short* dataPtr)
+    void get (rownr_t rownr, Short* dataPtr)
 	{ getShortV (rownr, dataPtr); }
-    void get (uInt rownr, uShort* dataPtr)
+    void get (rownr_t rownr, uShort* dataPtr)
 	{ getuShortV (rownr, dataPtr); }
-    void get (uInt rownr, Int* dataPtr)
+    void get (rownr_t rownr, Int* dataPtr)
 	{ getIntV (rownr, dataPtr); }
-    void get (uInt rownr, uInt* dataPtr)
+    void get (rownr_t rownr, uInt* dataPtr)
 	{ getuIntV (rownr, dataPtr); }
-    void get (uInt rownr, float* dataPtr)
+    void get (rownr_t rownr, float* dataPtr)
 	{ getfloatV (rownr, dataPtr); } 
-   void get (uInt rownr, double* dataPtr)
+   void get (rownr_t rownr, double* dataPtr)
 	{ getdoubleV (rownr, dataPtr); }
-    void get (uInt rownr, Complex* dataPtr)
+    void get (rownr_t rownr, Complex* dataPtr)
 	{ getComplexV (rownr, dataPtr); }
-    void get (uInt rownr, DComplex* dataPtr)
+    void get (rownr_t rownr, DComplex* dataPtr)
 	{ getDComplexV (rownr, dataPtr); }
-    void get (uInt rownr, String* dataPtr)
+    void get (rownr_t rownr, String* dataPtr)
 	{ getStringV (rownr, dataPtr); }
     // This function is the get for all non-standard data types.
-    void get (uInt rownr, void* dataPtr)
+    void get (rownr_t rownr, void* dataPtr)
 	{ getOtherV (rownr, dataPtr); }
     // </group>
 
@@ -803,30 +837,30 @@ public:
     // The compiler complains about hiding virtual functions if you do not
     // declare all virtual functions with the same name in a derived class.
     // <group>
-    void put (uInt rownr, const Bool* dataPtr)
+    void put (rownr_t rownr, const Bool* dataPtr)
 	{ putBoolV (rownr, dataPtr); }
-    void put (uInt rownr, const uChar* dataPtr)
+    void put (rownr_t rownr, const uChar* dataPtr)
 	{ putuCharV (rownr, dataPtr); }
-    void put (uInt rownr, const Short* dataPtr)
+    void put (rownr_t rownr, const Short* dataPtr)
 	{ putShortV (rownr, dataPtr); }
-    void put (uInt rownr, const uShort* dataPtr)
+    void put (rownr_t rownr, const uShort* dataPtr)
 	{ putuShortV (rownr, dataPtr); }
-    void put (uInt rownr, const Int* dataPtr)
+    void put (rownr_t rownr, const Int* dataPtr)
 	{ putIntV (rownr, dataPtr); }
-    void put (uInt rownr, const uInt* dataPtr)
+    void put (rownr_t rownr, const uInt* dataPtr)
 	{ putuIntV (rownr, dataPtr); }
-    void put (uInt rownr, const float* dataPtr)
+    void put (rownr_t rownr, const float* dataPtr)
 	{ putfloatV (rownr, dataPtr); }
-    void put (uInt rownr, const double* dataPtr)
+    void put (rownr_t rownr, const double* dataPtr)
 	{ putdoubleV (rownr, dataPtr); }
-    void put (uInt rownr, const Complex* dataPtr)
+    void put (rownr_t rownr, const Complex* dataPtr)
 	{ putComplexV (rownr, dataPtr); }
-    void put (uInt rownr, const DComplex* dataPtr)
+    void put (rownr_t rownr, const DComplex* dataPtr)
 	{ putDComplexV (rownr, dataPtr); }
-    void put (uInt rownr, const String* dataPtr)
+    void put (rownr_t rownr, const String* dataPtr)
 	{ putStringV (rownr, dataPtr); }
     // This function is the put for all non-standard data types.
-    void put (uInt rownr, const void* dataPtr)
+    void put (rownr_t rownr, const void* dataPtr)
 	{ putOtherV (rownr, dataPtr); }
     // </group>
 
@@ -871,7 +905,7 @@ public:
     // The argument dataPtr is in fact a T*, but a void*
     // is needed to be generic.
     // The default implementation throws an "invalid operation" exception.
-    virtual uInt getBlockV (uInt rownr, uInt nrmax, void* dataPtr);
+    virtual uInt getBlockV (rownr_t rownr, uInt nrmax, void* dataPtr);
 
     // Put nrmax scalars from the given row on.
     // It returns the actual number of values put.
@@ -880,7 +914,7 @@ public:
     // The argument dataPtr is in fact a const T*, but a const void*
     // is needed to be generic.
     // The default implementation throws an "invalid operation" exception.
-    virtual void putBlockV (uInt rownr, uInt nrmax, const void* dataPtr);
+    virtual void putBlockV (rownr_t rownr, uInt nrmax, const void* dataPtr);
 
     // Get the array value in the given row.
     // The argument dataPtr is in fact an Array<T>*, but a void*
@@ -888,7 +922,7 @@ public:
     // The array pointed to by dataPtr has to have the correct shape
     // (which is guaranteed by the ArrayColumn get function).
     // The default implementation throws an "invalid operation" exception.
-    virtual void getArrayV (uInt rownr, void* dataPtr);
+    virtual void getArrayV (rownr_t rownr, void* dataPtr);
 
     // Put the array value into the given row.
     // The argument dataPtr is in fact a const Array<T>*, but a const void*
@@ -896,7 +930,7 @@ public:
     // The array pointed to by dataPtr has to have the correct shape
     // (which is guaranteed by the ArrayColumn put function).
     // The default implementation throws an "invalid operation" exception.
-    virtual void putArrayV (uInt rownr, const void* dataPtr);
+    virtual void putArrayV (rownr_t rownr, const void* dataPtr);
 
     // Get all array values in the column.
     // The argument dataPtr is in fact an Array<T>*, but a void*
@@ -938,7 +972,7 @@ public:
     // The array pointed to by dataPtr has to have the correct shape
     // (which is guaranteed by the ArrayColumn getSlice function).
     // The default implementation throws an "invalid operation" exception.
-    virtual void getSliceV (uInt rownr, const Slicer& slicer, void* dataPtr);
+    virtual void getSliceV (rownr_t rownr, const Slicer& slicer, void* dataPtr);
 
     // Put into a section of the array in the given row.
     // The argument dataPtr is in fact a const Array<T>*, but a const void*
@@ -946,7 +980,7 @@ public:
     // The array pointed to by dataPtr has to have the correct shape
     // (which is guaranteed by the ArrayColumn putSlice function).
     // The default implementation throws an "invalid operation" exception.
-    virtual void putSliceV (uInt rownr, const Slicer& slicer,
+    virtual void putSliceV (rownr_t rownr, const Slicer& slicer,
 			    const void* dataPtr);
 
     // Get a section of all arrays in the column.
@@ -1004,37 +1038,37 @@ protected:
     // Get the scalar value in the given row.
     // The default implementation throws an "invalid operation" exception.
     // <group>
-    virtual void getBoolV     (uInt rownr, Bool* dataPtr);
-    virtual void getuCharV    (uInt rownr, uChar* dataPtr);
-    virtual void getShortV    (uInt rownr, Short* dataPtr);
-    virtual void getuShortV   (uInt rownr, uShort* dataPtr);
-    virtual void getIntV      (uInt rownr, Int* dataPtr);
-    virtual void getuIntV     (uInt rownr, uInt* dataPtr);
-    virtual void getfloatV    (uInt rownr, float* dataPtr);
-    virtual void getdoubleV   (uInt rownr, double* dataPtr);
-    virtual void getComplexV  (uInt rownr, Complex* dataPtr);
-    virtual void getDComplexV (uInt rownr, DComplex* dataPtr);
-    virtual void getStringV   (uInt rownr, String* dataPtr);
+    virtual void getBoolV     (rownr_t rownr, Bool* dataPtr);
+    virtual void getuCharV    (rownr_t rownr, uChar* dataPtr);
+    virtual void getShortV    (rownr_t rownr, Short* dataPtr);
+    virtual void getuShortV   (rownr_t rownr, uShort* dataPtr);
+    virtual void getIntV      (rownr_t rownr, Int* dataPtr);
+    virtual void getuIntV     (rownr_t rownr, uInt* dataPtr);
+    virtual void getfloatV    (rownr_t rownr, float* dataPtr);
+    virtual void getdoubleV   (rownr_t rownr, double* dataPtr);
+    virtual void getComplexV  (rownr_t rownr, Complex* dataPtr);
+    virtual void getDComplexV (rownr_t rownr, DComplex* dataPtr);
+    virtual void getStringV   (rownr_t rownr, String* dataPtr);
     // This function is the get for all non-standard data types.
-    virtual void getOtherV    (uInt rownr, void* dataPtr);
+    virtual void getOtherV    (rownr_t rownr, void* dataPtr);
     // </group>
 
     // Put the scalar value into the given row.
     // The default implementation throws an "invalid operation" exception.
     // <group>
-    virtual void putBoolV     (uInt rownr, const Bool* dataPtr);
-    virtual void putuCharV    (uInt rownr, const uChar* dataPtr);
-    virtual void putShortV    (uInt rownr, const Short* dataPtr);
-    virtual void putuShortV   (uInt rownr, const uShort* dataPtr);
-    virtual void putIntV      (uInt rownr, const Int* dataPtr);
-    virtual void putuIntV     (uInt rownr, const uInt* dataPtr);
-    virtual void putfloatV    (uInt rownr, const float* dataPtr);
-    virtual void putdoubleV   (uInt rownr, const double* dataPtr);
-    virtual void putComplexV  (uInt rownr, const Complex* dataPtr);
-    virtual void putDComplexV (uInt rownr, const DComplex* dataPtr);
-    virtual void putStringV   (uInt rownr, const String* dataPtr);
+    virtual void putBoolV     (rownr_t rownr, const Bool* dataPtr);
+    virtual void putuCharV    (rownr_t rownr, const uChar* dataPtr);
+    virtual void putShortV    (rownr_t rownr, const Short* dataPtr);
+    virtual void putuShortV   (rownr_t rownr, const uShort* dataPtr);
+    virtual void putIntV      (rownr_t rownr, const Int* dataPtr);
+    virtual void putuIntV     (rownr_t rownr, const uInt* dataPtr);
+    virtual void putfloatV    (rownr_t rownr, const float* dataPtr);
+    virtual void putdoubleV   (rownr_t rownr, const double* dataPtr);
+    virtual void putComplexV  (rownr_t rownr, const Complex* dataPtr);
+    virtual void putDComplexV (rownr_t rownr, const DComplex* dataPtr);
+    virtual void putStringV   (rownr_t rownr, const String* dataPtr);
     // This function is the put for all non-standard data types.
-    virtual void putOtherV    (uInt rownr, const void* dataPtr);
+    virtual void putOtherV    (rownr_t rownr, const void* dataPtr);
     // </group>
 
 private:
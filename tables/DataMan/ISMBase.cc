@@ -216,8 +216,9 @@ void ISMBase::showIndexStatistics (ostream& os)
 void ISMBase::showBucketLayout (ostream& os)
 {
   uInt cursor=0;
-  uInt bstrow=0;
-  uInt bnrow, bucketNr;
+  rownr_t bstrow=0;
+  rownr_t bnrow;
+  uInt bucketNr;
   while (getIndex().nextBucketNr (cursor, bstrow, bnrow, bucketNr)) {
     os << " bucket strow=" << bstrow << " bucketnr=" << bucketNr << endl;
     ((ISMBucket*) (getCache().getBucket (bucketNr)))->show (os);
@@ -366,6 +367,10 @@ void ISMBase::writeIndex()
     if (index_p == 0) {
 	return;
     }
+    // Store the up-to-date zone maps in the index.
+    for (uInt i=0; i<ncolumn(); i++) {
+	colSet_p[i]->flushZoneMap();
+    }
     uInt nbuckets = getCache().nBucket();
     // Write a few items at the beginning of the file.
     file_p->seek (0);
@@ -403,16 +408,16 @@ void ISMBase::writeIndex()
 }
     
 
-ISMBucket* ISMBase::getBucket (uInt rownr, uInt& bucketStartRow,
-			       uInt& bucketNrrow)
+ISMBucket* ISMBase::getBucket (rownr_t rownr, rownr_t& bucketStartRow,
+			       rownr_t& bucketNrrow)
 {
     uInt bucketNr = getIndex().getBucketNr (rownr, bucketStartRow,
 					     bucketNrrow);
     return (ISMBucket*) (getCache().getBucket (bucketNr));
 }
 
-ISMBucket* ISMBase::nextBucket (uInt& cursor, uInt& bucketStartRow,
-				uInt& bucketNrrow)
+ISMBucket* ISMBase::nextBucket (uInt& cursor, rownr_t& bucketStartRow,
+				rownr_t& bucketNrrow)
 {
     uInt bucketNr;
     if (getIndex().nextBucketNr (cursor, bucketStartRow,
@@ -428,7 +433,7 @@ void ISMBase::setBucketDirty()
     dataChanged_p = True;
 }
 
-void ISMBase::addBucket (uInt rownr, ISMBucket* bucket)
+void ISMBase::addBucket (rownr_t rownr, ISMBucket* bucket)
 {
     // Add the bucket to the cache and the index.
     // It's the last bucket in the cache.
@@ -458,7 +463,7 @@ Bool ISMBase::canRemoveColumn() const
 }
 
 
-void ISMBase::addRow (uInt nrrow)
+void ISMBase::addRow (rownr_t nrrow)
 {
     getIndex().addRow (nrrow);
     uInt nrcol = ncolumn();
@@ -469,17 +474,19 @@ void ISMBase::addRow (uInt nrrow)
     dataChanged_p = True;
 }
 
-void ISMBase::removeRow (uInt rownr)
+void ISMBase::removeRow (rownr_t rownr)
 {
     // Get the bucket and interval to which the row belongs.
     uInt i;
-    uInt bucketStartRow, bucketNrrow;
+    rownr_t bucketStartRow, bucketNrrow;
     ISMBucket* bucket = getBucket (rownr, bucketStartRow, bucketNrrow);
-    uInt bucketRownr = rownr - bucketStartRow;
+    rownr_t bucketRownr = rownr - bucketStartRow;
     // Remove that row from the bucket for all columns.
     uInt nrcol = ncolumn();
     for (i=0; i<nrcol; i++) {
 	colSet_p[i]->remove (bucketRownr, bucket, bucketNrrow, nrrow_p-1);
+	// All rows thereafter shift.
+	colSet_p[i]->setZoneMapChanged (rownr, nrrow_p);
     }
     // Remove the row from the index.
     Int emptyBucket = getIndex().removeRow (rownr);
@@ -589,7 +596,7 @@ Bool ISMBase::flush (AipsIO& ios, Bool fsync)
     return changed;
 }
 
-void ISMBase::resync (uInt nrrow)
+void ISMBase::resync (rownr_t nrrow)
 {
     nrrow_p = nrrow;
     if (index_p != 0) {
@@ -607,15 +614,19 @@ void ISMBase::resync (uInt nrrow)
     }
 }
 
-void ISMBase::create (uInt nrrow)
+void ISMBase::create (rownr_t nrrow)
 {
     init();
     recreate();
     nrrow_p = 0;
+    // Maintain a zone map for the numeric scalar columns.
+    for (uInt i=0; i<ncolumn(); i++) {
+	colSet_p[i]->activateZoneMap();
+    }
     addRow (nrrow);
 }
 
-void ISMBase::open (uInt tabNrrow, AipsIO& ios)
+void ISMBase::open (rownr_t tabNrrow, AipsIO& ios)
 {
     nrrow_p = tabNrrow;
     // Do not check the bucketsize for an existing table.
@@ -737,18 +748,18 @@ void ISMBase::init()
 }
 
 Bool ISMBase::checkBucketLayout (uInt &offendingCursor,
-                                 uInt &offendingBucketStartRow,
-                                 uInt &offendingBucketNrow,
+                                 rownr_t &offendingBucketStartRow,
+                                 rownr_t &offendingBucketNrow,
                                  uInt &offendingBucketNr,
                                  uInt &offendingCol,
                                  uInt &offendingIndex,
-                                 uInt &offendingRow,
-                                 uInt &offendingPrevRow)
+                                 rownr_t &offendingRow,
+                                 rownr_t &offendingPrevRow)
 {
   Bool ok = False;
   uInt cursor = 0;
-  uInt bucketStartRow = 0;
-  uInt bucketNrow = 0;
+  rownr_t bucketStartRow = 0;
+  rownr_t bucketNrow = 0;
   uInt bucketNr = 0;
   while (getIndex().nextBucketNr(cursor, bucketStartRow, bucketNrow, bucketNr)) {
     ok = ((ISMBucket*) (getCache().getBucket(bucketNr)))->check(offendingCol,
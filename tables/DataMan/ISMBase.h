@@ -168,8 +168,8 @@ public:
     // Get the bucket containing the given row.
     // Also return the first and last row of that bucket.
     // The bucket object is created and deleted by the caching mechanism.
-    ISMBucket* getBucket (uInt rownr, uInt& bucketStartRow,
-			  uInt& bucketNrrow);
+    ISMBucket* getBucket (rownr_t rownr, rownr_t& bucketStartRow,
+			  rownr_t& bucketNrrow);
 
     // Get the next bucket.
     // cursor=0 indicates the start of the iteration.
@@ -178,8 +178,17 @@ public:
     // After each iteration BucketStartRow and bucketNrrow are set.
     // A 0 is returned when no more buckets.
     // The bucket object is created and deleted by the caching mechanism.
-    ISMBucket* nextBucket (uInt& cursor, uInt& bucketStartRow,
-			   uInt& bucketNrrow);
+    ISMBucket* nextBucket (uInt& cursor, rownr_t& bucketStartRow,
+			   rownr_t& bucketNrrow);
+
+    // Get the index object.
+    // This will construct the index object if not present yet.
+    // The index object will be deleted by the destructor.
+    ISMIndex& getIndex();
+
+    // Tell that the index has changed (e.g. a zone map), so it is written
+    // when the storage manager is flushed.
+    void setIndexChanged();
 
     // Get access to the temporary buffer.
     char* tempBuffer() const;
@@ -190,7 +199,7 @@ public:
     uInt uniqueNr();
 
     // Get the number of rows in this storage manager.
-    uInt nrow() const;
+    rownr_t nrow() const;
 
     // Can the storage manager add rows? (yes)
     virtual Bool canAddRow() const;
@@ -215,7 +224,7 @@ public:
 
     // Add a bucket to the storage manager (i.e. to the cache).
     // The pointer is taken over.
-    void addBucket (uInt rownr, ISMBucket* bucket);
+    void addBucket (rownr_t rownr, ISMBucket* bucket);
 
     // Make the current bucket in the cache dirty (i.e. something has been
     // changed in it and it needs to be written when removed from the cache).
@@ -228,13 +237,13 @@ public:
 
     // Check that there are no repeated rowIds in the buckets comprising this ISM.
     Bool checkBucketLayout (uInt &offendingCursor,
-                            uInt &offendingBucketStartRow,
-                            uInt &offendingBucketNrow,
+                            rownr_t &offendingBucketStartRow,
+                            rownr_t &offendingBucketNrow,
                             uInt &offendingBucketNr,
                             uInt &offendingCol,
                             uInt &offendingIndex,
-                            uInt &offendingRow,
-                            uInt &offendingPrevRow);
+                            rownr_t &offendingRow,
+                            rownr_t &offendingPrevRow);
 
 private:
     // Copy constructor (only meant for clone function).
@@ -255,15 +264,15 @@ private:
 
     // Let the storage manager create files as needed for a new table.
     // This allows a column with an indirect array to create its file.
-    virtual void create (uInt nrrow);
+    virtual void create (rownr_t nrrow);
 
     // Open the storage manager file for an existing table, read in
     // the data, and let the ISMColumn objects read their data.
-    virtual void open (uInt nrrow, AipsIO&);
+    virtual void open (rownr_t nrrow, AipsIO&);
 
     // Resync the storage manager with the new file contents.
     // This is done by clearing the cache.
-    virtual void resync (uInt nrrow);
+    virtual void resync (rownr_t nrrow);
 
     // Reopen the storage manager files for read/write.
     virtual void reopenRW();
@@ -280,10 +289,10 @@ private:
     // Add rows to the storage manager.
     // Per column it extends the interval for which the last value written
     // is valid.
-    virtual void addRow (uInt nrrow);
+    virtual void addRow (rownr_t nrrow);
 
     // Delete a row from all columns.
-    virtual void removeRow (uInt rownr);
+    virtual void removeRow (rownr_t rownr);
 
     // Do the final addition of a column.
     // The <src>DataManagerColumn</src> object has already been created
@@ -319,11 +328,6 @@ private:
     // The cache object will be deleted by the destructor.
     BucketCache& getCache();
 
-    // Get the index object.
-    // This will construct the index object if not present yet.
-    // The index object will be deleted by the destructor.
-    ISMIndex& getIndex();
-
     // Construct the cache object (if not constructed yet).
     void makeCache();
 
@@ -347,7 +351,7 @@ private:
     // Unique nr for column in this storage manager.
     uInt         uniqnr_p;
     // The number of rows in the columns.
-    uInt         nrrow_p;
+    rownr_t         nrrow_p;
     // The assembly of all columns.
     PtrBlock<ISMColumn*>  colSet_p;
     // The cache with the ISM buckets.
@@ -394,7 +398,7 @@ inline uInt ISMBase::uniqueNr()
     return uniqnr_p++;
 }
 
-inline uInt ISMBase::nrow() const
+inline rownr_t ISMBase::nrow() const
 {
     return nrrow_p;
 }
@@ -430,6 +434,11 @@ inline ISMIndex& ISMBase::getIndex()
     return *index_p;
 }
 
+inline void ISMBase::setIndexChanged()
+{
+    dataChanged_p = True;
+}
+
 inline ISMColumn& ISMBase::getColumn (uInt colnr)
 {
     return *(colSet_p[colnr]);
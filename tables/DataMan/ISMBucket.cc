@@ -29,6 +29,7 @@
 #include <casacore/tables/DataMan/ISMBucket.h>
 #include <casacore/tables/DataMan/ISMBase.h>
 #include <casacore/tables/DataMan/ISMColumn.h>
+#include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Containers/BlockIO.h>
 #include <casacore/casa/Utilities/BinarySearch.h>
@@ -47,13 +48,13 @@ ISMBucket::ISMBucket (ISMBase* parent, const char* bucketStorage)
   uIntSize_p (parent->uIntSize()),
   dataLeng_p (0),
   indexLeng_p(0),
-  rowIndex_p (parent->ncolumn(), static_cast<Block<uInt>*>(0)),
+  rowIndex_p (parent->ncolumn(), static_cast<Block<rownr_t>*>(0)),
   offIndex_p (parent->ncolumn(), static_cast<Block<uInt>*>(0)),
   indexUsed_p(parent->ncolumn(), (uInt)0)
 {
     uInt nrcol = stmanPtr_p->ncolumn();
     for (uInt i=0; i<nrcol; i++) {
-	rowIndex_p[i] = new Block<uInt>;
+	rowIndex_p[i] = new Block<rownr_t>;
 	offIndex_p[i] = new Block<uInt>;
     }
     // Get the initial index length.
@@ -98,7 +99,7 @@ void ISMBucket::copy (const ISMBucket& that)
 }
 
 
-uInt& ISMBucket::getOffset (uInt colnr, uInt rownr)
+uInt& ISMBucket::getOffset (uInt colnr, rownr_t rownr)
 {
     Bool found;
     uInt inx = binarySearchBrackets (found, *(rowIndex_p[colnr]),
@@ -110,10 +111,10 @@ uInt& ISMBucket::getOffset (uInt colnr, uInt rownr)
     return (*(offIndex_p[colnr]))[inx];
 }
 
-uInt ISMBucket::getInterval (uInt colnr, uInt rownr, uInt bucketNrrow,
-			     uInt& start, uInt& end, uInt& offset) const
+uInt ISMBucket::getInterval (uInt colnr, rownr_t rownr, rownr_t bucketNrrow,
+			     rownr_t& start, rownr_t& end, uInt& offset) const
 {
-    Block<uInt>& rowIndex = *(rowIndex_p[colnr]);
+    Block<rownr_t>& rowIndex = *(rowIndex_p[colnr]);
     Bool found;
     uInt inx = binarySearchBrackets (found, rowIndex,
 				     rownr, indexUsed_p[colnr]);
@@ -174,13 +175,13 @@ Bool ISMBucket::canAddData (uInt leng) const
     return False;
 }
 
-void ISMBucket::addData (uInt colnr, uInt rownr, uInt index,
+void ISMBucket::addData (uInt colnr, rownr_t rownr, uInt index,
 			 const char* data, uInt leng)
 {
 #ifdef AIPS_TRACE
     cout << "  add at index "<< index<<endl;
 #endif
-    Block<uInt>& rowIndex = *(rowIndex_p[colnr]);
+    Block<rownr_t>& rowIndex = *(rowIndex_p[colnr]);
     Block<uInt>& offIndex = *(offIndex_p[colnr]);
     uInt nrused = indexUsed_p[colnr];
     DebugAssert ((index == 0  ||  rowIndex[index-1] < rownr)  &&
@@ -222,7 +223,7 @@ uInt ISMBucket::getLength (uInt fixedLength, const char* data) const
 }
 
 
-void ISMBucket::shiftLeft (uInt index, uInt nr, Block<uInt>& rowIndex,
+void ISMBucket::shiftLeft (uInt index, uInt nr, Block<rownr_t>& rowIndex,
 			   Block<uInt>& offIndex, uInt& nused, uInt leng)
 {
 #ifdef AIPS_TRACE
@@ -313,11 +314,22 @@ void ISMBucket::write (char* bucketStorage) const
     // Copy the data.
     memcpy (bucketStorage + uIntSize_p, data_p, dataLeng_p);
     // Write the index.
+    // The row numbers are relative to the start of the bucket and are
+    // stored as 32-bit values to keep the bucket layout unchanged.
+    Block<uInt> rows;
     for (uInt i=0; i<nrcol; i++) {
 	offset += writeuInt (bucketStorage+offset, &(indexUsed_p[i]), 1);
 	uInt nr = indexUsed_p[i];
-	offset += writeuInt (bucketStorage+offset,
-			     rowIndex_p[i]->storage(), nr);
+	const Block<rownr_t>& rowIndex = *(rowIndex_p[i]);
+	rows.resize (nr, False, False);
+	for (uInt j=0; j<nr; j++) {
+	    if (rowIndex[j] > 4294967295u) {
+		throw DataManError ("ISMBucket::write: relative row number "
+				    "in bucket exceeds 32 bits");
+	    }
+	    rows[j] = rowIndex[j];
+	}
+	offset += writeuInt (bucketStorage+offset, rows.storage(), nr);
 	offset += writeuInt (bucketStorage+offset,
 			     offIndex_p[i]->storage(), nr);
     }
@@ -338,13 +350,18 @@ void ISMBucket::read (const char* bucketStorage)
     dataLeng_p = offset - uIntSize_p;
     memcpy (data_p, bucketStorage + uIntSize_p, dataLeng_p);
     // Read the index.
+    Block<uInt> rows;
     for (uInt i=0; i<nrcol; i++) {
 	offset += readuInt (&(indexUsed_p[i]), bucketStorage+offset, 1);
 	uInt nr = indexUsed_p[i];
 	rowIndex_p[i]->resize (nr);
 	offIndex_p[i]->resize (nr);
-	offset += readuInt (rowIndex_p[i]->storage(),
-			    bucketStorage+offset, nr);
+	rows.resize (nr, False, False);
+	offset += readuInt (rows.storage(), bucketStorage+offset, nr);
+	Block<rownr_t>& rowIndex = *(rowIndex_p[i]);
+	for (uInt j=0; j<nr; j++) {
+	    rowIndex[j] = rows[j];
+	}
 	offset += readuInt (offIndex_p[i]->storage(),
 			    bucketStorage+offset, nr);
     }
@@ -355,11 +372,12 @@ void ISMBucket::read (const char* bucketStorage)
 
 Bool ISMBucket::simpleSplit (ISMBucket* left, ISMBucket* right,
 			     Block<Bool>& duplicated,
-			     uInt& splitRownr, uInt rownr)
+			     rownr_t& splitRownr, rownr_t rownr)
 {
     // Determine the last rownr in the bucket.
-    uInt i, row;
-    uInt lastRow = 0;
+    uInt i;
+    rownr_t row;
+    rownr_t lastRow = 0;
     uInt nrcol = stmanPtr_p->ncolumn();
     for (i=0; i<nrcol; i++) {
 	row = (*(rowIndex_p[i]))[indexUsed_p[i]-1];
@@ -404,14 +422,14 @@ Bool ISMBucket::simpleSplit (ISMBucket* left, ISMBucket* right,
 
 uInt ISMBucket::split (ISMBucket*& left, ISMBucket*& right,
 		       Block<Bool>& duplicated,
-		       uInt bucketStartRow, uInt bucketNrrow,
-		       uInt colnr, uInt rownr, uInt lengToAdd)
+		       rownr_t bucketStartRow, rownr_t bucketNrrow,
+		       uInt colnr, rownr_t rownr, uInt lengToAdd)
 {
     uInt nrcol = stmanPtr_p->ncolumn();
     duplicated.resize (nrcol);
     left  = new ISMBucket (stmanPtr_p, 0);
     right = new ISMBucket (stmanPtr_p, 0);
-    uInt splitRownr;
+    rownr_t splitRownr;
     // Try a simple split if the current bucket is the last one.
     // (Then we usually add to the end of the file).
     if (bucketStartRow + bucketNrrow >= stmanPtr_p->nrow()) {
@@ -427,7 +445,7 @@ uInt ISMBucket::split (ISMBucket*& left, ISMBucket*& right,
     }
     // Create a block containing the row numbers of all
     // values in all columns. Include the new item.
-    Block<uInt> rows(nr + 1);
+    Block<rownr_t> rows(nr + 1);
     rows[0] = rownr;               // new item
     nr = 1;
     for (i=0; i<nrcol; i++) {
@@ -436,8 +454,8 @@ uInt ISMBucket::split (ISMBucket*& left, ISMBucket*& right,
 	}
     }
     // Sort it (uniquely) to get all row numbers with a value.
-    uInt nruniq = GenSort<uInt>::sort (rows, rows.nelements(), 
-				       Sort::Ascending, Sort::NoDuplicates);
+    uInt nruniq = GenSort<rownr_t>::sort (rows, rows.nelements(),
+				          Sort::Ascending, Sort::NoDuplicates);
     // If the bucket contains values of only one row, a simple split
     // can be done (and should succeed).
     if (nruniq == 1) {
@@ -497,7 +515,7 @@ uInt ISMBucket::split (ISMBucket*& left, ISMBucket*& right,
     // each column. A row has to be copied completely, because a row
     // cannot be split over multiple buckets.
     cursor = 0;
-    uInt row;
+    rownr_t row;
     for (j=0; j<index; j++) {
 	row = rows[j];
 	for (i=0; i<nrcol; i++) {
@@ -587,7 +605,7 @@ uInt ISMBucket::getSplit (uInt totLeng, const Block<uInt>& rowLeng,
 }
 
 
-uInt ISMBucket::copyData (ISMBucket& other, uInt colnr, uInt toRownr,
+uInt ISMBucket::copyData (ISMBucket& other, uInt colnr, rownr_t toRownr,
 			  uInt fromIndex, uInt toIndex) const
 {
     // Determine the length of the data item.
@@ -614,7 +632,7 @@ void ISMBucket::show (ostream& os) const
 }
 
 Bool ISMBucket::check (uInt &offendingCol, uInt &offendingIndex,
-                       uInt &offendingRow, uInt &offendingPrevRow) const
+                       rownr_t &offendingRow, rownr_t &offendingPrevRow) const
 {
   uInt ncols = stmanPtr_p->ncolumn();
   for (uInt col_i=0; col_i<ncols; ++col_i) {
@@ -28,6 +28,8 @@
 #include <casacore/tables/DataMan/ISMColumn.h>
 #include <casacore/tables/DataMan/ISMBase.h>
 #include <casacore/tables/DataMan/ISMBucket.h>
+#include <casacore/tables/DataMan/ISMIndex.h>
+#include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/RefRows.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Vector.h>
@@ -37,6 +39,8 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/LECanonicalConversion.h>
+#include <float.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -50,7 +54,8 @@ ISMColumn::ISMColumn (ISMBase* parent, int dataType, uInt colnr)
   startRow_p    (-1),
   endRow_p      (-1),
   lastValue_p   (0),
-  lastRowPut_p  (0)
+  lastRowPut_p  (0),
+  zoneMapInit_p (False)
 {
     //# The increment in the column cache is always 0,
     //# because multiple rows refer to the same value.
@@ -108,25 +113,28 @@ void ISMColumn::setShapeColumn (const IPosition& shape)
     shape_p  = shape;
 }
 
-uInt ISMColumn::ndim (uInt)
+uInt ISMColumn::ndim (rownr_t)
 {
     return shape_p.nelements();
 }
-IPosition ISMColumn::shape (uInt)
+IPosition ISMColumn::shape (rownr_t)
 {
     return shape_p;
 }
 
 
-void ISMColumn::addRow (uInt, uInt)
+void ISMColumn::addRow (rownr_t newNrrow, rownr_t oldNrrow)
 {
-    //# Nothing to do.
+    if (newNrrow > oldNrrow) {
+        setZoneMapChanged (oldNrrow, newNrrow-1);
+    }
 }
 
-void ISMColumn::remove (uInt bucketRownr, ISMBucket* bucket, uInt bucketNrrow,
-			uInt newNrrow)
+void ISMColumn::remove (rownr_t bucketRownr, ISMBucket* bucket, rownr_t bucketNrrow,
+			rownr_t newNrrow)
 {
-    uInt inx, stint, endint, offset;
+    uInt inx, offset;
+    rownr_t stint, endint;
     // Get the index where to remove the value.
     // If the rownr is not the start of the interval, index is one further.
     inx = bucket->getInterval (colnr_p, bucketRownr, bucketNrrow,
@@ -138,7 +146,7 @@ void ISMColumn::remove (uInt bucketRownr, ISMBucket* bucket, uInt bucketNrrow,
 #endif
 
     // Get bucket information needed to remove the data.
-    Block<uInt>& rowIndex = bucket->rowIndex (colnr_p);
+    Block<rownr_t>& rowIndex = bucket->rowIndex (colnr_p);
     Block<uInt>& offIndex = bucket->offIndex (colnr_p);
     uInt& nused = bucket->indexUsed (colnr_p);
     // Invalidate the last value read.
@@ -172,77 +180,77 @@ void ISMColumn::remove (uInt bucketRownr, ISMBucket* bucket, uInt bucketNrrow,
 }
 
 
-void ISMColumn::getBoolV (uInt rownr, Bool* value)
+void ISMColumn::getBoolV (rownr_t rownr, Bool* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(Bool*)lastValue_p;
 }
-void ISMColumn::getuCharV (uInt rownr, uChar* value)
+void ISMColumn::getuCharV (rownr_t rownr, uChar* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(uChar*)lastValue_p;
 }
-void ISMColumn::getShortV (uInt rownr, Short* value)
+void ISMColumn::getShortV (rownr_t rownr, Short* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(Short*)lastValue_p;
 }
-void ISMColumn::getuShortV (uInt rownr, uShort* value)
+void ISMColumn::getuShortV (rownr_t rownr, uShort* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(uShort*)lastValue_p;
 }
-void ISMColumn::getIntV (uInt rownr, Int* value)
+void ISMColumn::getIntV (rownr_t rownr, Int* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(Int*)lastValue_p;
 }
-void ISMColumn::getuIntV (uInt rownr, uInt* value)
+void ISMColumn::getuIntV (rownr_t rownr, uInt* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(uInt*)lastValue_p;
 }
-void ISMColumn::getfloatV (uInt rownr, float* value)
+void ISMColumn::getfloatV (rownr_t rownr, float* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(float*)lastValue_p;
 }
-void ISMColumn::getdoubleV (uInt rownr, double* value)
+void ISMColumn::getdoubleV (rownr_t rownr, double* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(double*)lastValue_p;
 }
-void ISMColumn::getComplexV (uInt rownr, Complex* value)
+void ISMColumn::getComplexV (rownr_t rownr, Complex* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(Complex*)lastValue_p;
 }
-void ISMColumn::getDComplexV (uInt rownr, DComplex* value)
+void ISMColumn::getDComplexV (rownr_t rownr, DComplex* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
     }
     *value = *(DComplex*)lastValue_p;
 }
-void ISMColumn::getStringV (uInt rownr, String* value)
+void ISMColumn::getStringV (rownr_t rownr, String* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, True);
@@ -252,66 +260,66 @@ void ISMColumn::getStringV (uInt rownr, String* value)
 
 void ISMColumn::getScalarColumnBoolV (Vector<Bool>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getBoolV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(Bool*)lastValue_p;
 	}
     }
 }
 void ISMColumn::getScalarColumnuCharV (Vector<uChar>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getuCharV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(uChar*)lastValue_p;
 	}
     }
 }
 void ISMColumn::getScalarColumnShortV (Vector<Short>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getShortV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(Short*)lastValue_p;
 	}
     }
 }
 void ISMColumn::getScalarColumnuShortV (Vector<uShort>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getuShortV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(uShort*)lastValue_p;
 	}
     }
 }
 void ISMColumn::getScalarColumnIntV (Vector<Int>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getIntV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(Int*)lastValue_p;
 	}
     }
 }
 void ISMColumn::getScalarColumnuIntV (Vector<uInt>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getuIntV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(uInt*)lastValue_p;
 	}
     }
@@ -320,55 +328,55 @@ void ISMColumn::getScalarColumnfloatV (Vector<float>* dataPtr)
 {
     //# Note: using getStorage/putStorage is about 3 times faster
     //# if the vector is consecutive, but it is slower if not.
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getfloatV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(float*)lastValue_p;
 	}
     }
 }
 void ISMColumn::getScalarColumndoubleV (Vector<double>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getdoubleV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(double*)lastValue_p;
 	}
     }
 }
 void ISMColumn::getScalarColumnComplexV (Vector<Complex>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getComplexV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(Complex*)lastValue_p;
 	}
     }
 }
 void ISMColumn::getScalarColumnDComplexV (Vector<DComplex>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getDComplexV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(DComplex*)lastValue_p;
 	}
     }
 }
 void ISMColumn::getScalarColumnStringV (Vector<String>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
-    uInt rownr = 0;
+    rownr_t nrrow = dataPtr->nelements();
+    rownr_t rownr = 0;
     while (rownr < nrrow) {
 	getStringV (rownr, &((*dataPtr)(rownr)));
-	for (rownr++; Int(rownr)<=endRow_p; rownr++) {
+	for (rownr++; Int64(rownr)<=endRow_p; rownr++) {
 	    (*dataPtr)(rownr) = *(String*)lastValue_p;
 	}
     }
@@ -386,16 +394,16 @@ void ISMColumn::aips_name2(getScalarColumnCells,NM) \
     if (rownrs.isSliced()) { \
         RefRowsSliceIter iter(rownrs); \
         while (! iter.pastEnd()) { \
-            uInt rownr = iter.sliceStart(); \
-            uInt end = iter.sliceEnd(); \
-            uInt incr = iter.sliceIncr(); \
+            rownr_t rownr = iter.sliceStart(); \
+            rownr_t end = iter.sliceEnd(); \
+            rownr_t incr = iter.sliceIncr(); \
             while (rownr <= end) { \
                 if (rownr < cache.start()  ||  rownr > cache.end()) { \
                     aips_name2(get,NM) (rownr, valptr); \
                     DebugAssert (cache.incr() == 0, AipsError); \
                 } \
                 const T* cacheValue = (const T*)(cache.dataPtr()); \
-                uInt endrow = min (end, cache.end()); \
+                rownr_t endrow = std::min (end, cache.end()); \
                 while (rownr <= endrow) { \
 	            *valptr++ = *cacheValue; \
                     rownr += incr; \
@@ -404,20 +412,20 @@ void ISMColumn::aips_name2(getScalarColumnCells,NM) \
 	    iter++; \
         } \
     } else { \
-        const Vector<uInt>& rowvec = rownrs.rowVector(); \
+        const Vector<rownr_t>& rowvec = rownrs.rowVector(); \
         uInt nr = rowvec.nelements(); \
         if (nr > 0) { \
             Bool delR; \
-            const uInt* rows = rowvec.getStorage (delR); \
+            const rownr_t* rows = rowvec.getStorage (delR); \
             if (rows[0] < cache.start()  ||  rows[0] > cache.end()) { \
                 aips_name2(get,NM) (0, &(value[0])); \
             } \
             const T* cacheValue = (const T*)(cache.dataPtr()); \
-            uInt strow = cache.start(); \
-            uInt endrow = cache.end(); \
+            rownr_t strow = cache.start(); \
+            rownr_t endrow = cache.end(); \
             AlwaysAssert (cache.incr() == 0, AipsError); \
             for (uInt i=0; i<nr; i++) { \
-	        uInt rownr = rows[i]; \
+	        rownr_t rownr = rows[i]; \
                 if (rownr >= strow  &&  rownr <= endrow) { \
 	            value[i] = *cacheValue; \
 	        } else { \
@@ -444,15 +452,16 @@ ISMCOLUMN_GET(Complex,ComplexV)
 ISMCOLUMN_GET(DComplex,DComplexV)
 ISMCOLUMN_GET(String,StringV)
 
-void ISMColumn::getValue (uInt rownr, void* value, Bool setCache)
+void ISMColumn::getValue (rownr_t rownr, void* value, Bool setCache)
 {
     // Get the bucket with its row number boundaries.
-    uInt bucketStartRow, bucketNrrow;
+    rownr_t bucketStartRow, bucketNrrow;
     ISMBucket* bucket = stmanPtr_p->getBucket (rownr, bucketStartRow,
 					       bucketNrrow);
     // Get the interval in the bucket with its rownr boundaries.
     rownr -= bucketStartRow;
-    uInt offset, stint, endint;
+    uInt offset;
+    rownr_t stint, endint;
     bucket->getInterval (colnr_p, rownr, bucketNrrow, stint, endint, offset);
     // Get the value.
     // Set the start and end rownr for which this value is valid.
@@ -464,130 +473,130 @@ void ISMColumn::getValue (uInt rownr, void* value, Bool setCache)
     }
 }
 
-void ISMColumn::putBoolV (uInt rownr, const Bool* value)
+void ISMColumn::putBoolV (rownr_t rownr, const Bool* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putuCharV (uInt rownr, const uChar* value)
+void ISMColumn::putuCharV (rownr_t rownr, const uChar* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putShortV (uInt rownr, const Short* value)
+void ISMColumn::putShortV (rownr_t rownr, const Short* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putuShortV (uInt rownr, const uShort* value)
+void ISMColumn::putuShortV (rownr_t rownr, const uShort* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putIntV (uInt rownr, const Int* value)
+void ISMColumn::putIntV (rownr_t rownr, const Int* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putuIntV (uInt rownr, const uInt* value)
+void ISMColumn::putuIntV (rownr_t rownr, const uInt* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putfloatV (uInt rownr, const float* value)
+void ISMColumn::putfloatV (rownr_t rownr, const float* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putdoubleV (uInt rownr, const double* value)
+void ISMColumn::putdoubleV (rownr_t rownr, const double* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putComplexV (uInt rownr, const Complex* value)
+void ISMColumn::putComplexV (rownr_t rownr, const Complex* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putDComplexV (uInt rownr, const DComplex* value)
+void ISMColumn::putDComplexV (rownr_t rownr, const DComplex* value)
 {
     putValue (rownr, value);
 }
-void ISMColumn::putStringV (uInt rownr, const String* value)
+void ISMColumn::putStringV (rownr_t rownr, const String* value)
 {
     putValue (rownr, value);
 }
 
 void ISMColumn::putScalarColumnBoolV (const Vector<Bool>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnuCharV (const Vector<uChar>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnShortV (const Vector<Short>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnuShortV (const Vector<uShort>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnIntV (const Vector<Int>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnuIntV (const Vector<uInt>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnfloatV (const Vector<float>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumndoubleV (const Vector<double>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnComplexV (const Vector<Complex>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnDComplexV (const Vector<DComplex>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 void ISMColumn::putScalarColumnStringV (const Vector<String>* dataPtr)
 {
-    uInt nrrow = dataPtr->nelements();
+    rownr_t nrrow = dataPtr->nelements();
     for (uInt i=0; i<nrrow; i++) {
 	putValue (i, &((*dataPtr)(i)));
     }
 }
 
-void ISMColumn::getArrayBoolV (uInt rownr, Array<Bool>* value)
+void ISMColumn::getArrayBoolV (rownr_t rownr, Array<Bool>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -595,14 +604,14 @@ void ISMColumn::getArrayBoolV (uInt rownr, Array<Bool>* value)
     *value = Array<Bool> (shape_p, (Bool*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayBoolV (uInt rownr, const Array<Bool>* value)
+void ISMColumn::putArrayBoolV (rownr_t rownr, const Array<Bool>* value)
 {
     Bool deleteIt;
     const Bool* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayuCharV (uInt rownr, Array<uChar>* value)
+void ISMColumn::getArrayuCharV (rownr_t rownr, Array<uChar>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -610,14 +619,14 @@ void ISMColumn::getArrayuCharV (uInt rownr, Array<uChar>* value)
     *value = Array<uChar> (shape_p, (uChar*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayuCharV (uInt rownr, const Array<uChar>* value)
+void ISMColumn::putArrayuCharV (rownr_t rownr, const Array<uChar>* value)
 {
     Bool deleteIt;
     const uChar* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayShortV (uInt rownr, Array<Short>* value)
+void ISMColumn::getArrayShortV (rownr_t rownr, Array<Short>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -625,14 +634,14 @@ void ISMColumn::getArrayShortV (uInt rownr, Array<Short>* value)
     *value = Array<Short> (shape_p, (Short*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayShortV (uInt rownr, const Array<Short>* value)
+void ISMColumn::putArrayShortV (rownr_t rownr, const Array<Short>* value)
 {
     Bool deleteIt;
     const Short* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayuShortV (uInt rownr, Array<uShort>* value)
+void ISMColumn::getArrayuShortV (rownr_t rownr, Array<uShort>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -640,14 +649,14 @@ void ISMColumn::getArrayuShortV (uInt rownr, Array<uShort>* value)
     *value = Array<uShort> (shape_p, (uShort*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayuShortV (uInt rownr, const Array<uShort>* value)
+void ISMColumn::putArrayuShortV (rownr_t rownr, const Array<uShort>* value)
 {
     Bool deleteIt;
     const uShort* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayIntV (uInt rownr, Array<Int>* value)
+void ISMColumn::getArrayIntV (rownr_t rownr, Array<Int>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -655,14 +664,14 @@ void ISMColumn::getArrayIntV (uInt rownr, Array<Int>* value)
     *value = Array<Int> (shape_p, (Int*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayIntV (uInt rownr, const Array<Int>* value)
+void ISMColumn::putArrayIntV (rownr_t rownr, const Array<Int>* value)
 {
     Bool deleteIt;
     const Int* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayuIntV (uInt rownr, Array<uInt>* value)
+void ISMColumn::getArrayuIntV (rownr_t rownr, Array<uInt>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -670,14 +679,14 @@ void ISMColumn::getArrayuIntV (uInt rownr, Array<uInt>* value)
     *value = Array<uInt> (shape_p, (uInt*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayuIntV (uInt rownr, const Array<uInt>* value)
+void ISMColumn::putArrayuIntV (rownr_t rownr, const Array<uInt>* value)
 {
     Bool deleteIt;
     const uInt* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayfloatV (uInt rownr, Array<float>* value)
+void ISMColumn::getArrayfloatV (rownr_t rownr, Array<float>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -685,14 +694,14 @@ void ISMColumn::getArrayfloatV (uInt rownr, Array<float>* value)
     *value = Array<float> (shape_p, (float*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayfloatV (uInt rownr, const Array<float>* value)
+void ISMColumn::putArrayfloatV (rownr_t rownr, const Array<float>* value)
 {
     Bool deleteIt;
     const float* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArraydoubleV (uInt rownr, Array<double>* value)
+void ISMColumn::getArraydoubleV (rownr_t rownr, Array<double>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -700,14 +709,14 @@ void ISMColumn::getArraydoubleV (uInt rownr, Array<double>* value)
     *value = Array<double> (shape_p, (double*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArraydoubleV (uInt rownr, const Array<double>* value)
+void ISMColumn::putArraydoubleV (rownr_t rownr, const Array<double>* value)
 {
     Bool deleteIt;
     const double* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayComplexV (uInt rownr, Array<Complex>* value)
+void ISMColumn::getArrayComplexV (rownr_t rownr, Array<Complex>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -715,14 +724,14 @@ void ISMColumn::getArrayComplexV (uInt rownr, Array<Complex>* value)
     *value = Array<Complex> (shape_p, (Complex*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayComplexV (uInt rownr, const Array<Complex>* value)
+void ISMColumn::putArrayComplexV (rownr_t rownr, const Array<Complex>* value)
 {
     Bool deleteIt;
     const Complex* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayDComplexV (uInt rownr, Array<DComplex>* value)
+void ISMColumn::getArrayDComplexV (rownr_t rownr, Array<DComplex>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -730,14 +739,14 @@ void ISMColumn::getArrayDComplexV (uInt rownr, Array<DComplex>* value)
     *value = Array<DComplex> (shape_p, (DComplex*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayDComplexV (uInt rownr, const Array<DComplex>* value)
+void ISMColumn::putArrayDComplexV (rownr_t rownr, const Array<DComplex>* value)
 {
     Bool deleteIt;
     const DComplex* data = value->getStorage (deleteIt);
     putValue (rownr, data);
     value->freeStorage (data, deleteIt);
 }
-void ISMColumn::getArrayStringV (uInt rownr, Array<String>* value)
+void ISMColumn::getArrayStringV (rownr_t rownr, Array<String>* value)
 {
     if (isLastValueInvalid (rownr)) {
 	getValue (rownr, lastValue_p, False);
@@ -745,7 +754,7 @@ void ISMColumn::getArrayStringV (uInt rownr, Array<String>* value)
     *value = Array<String> (shape_p, (String*)lastValue_p, SHARE);
 }
 
-void ISMColumn::putArrayStringV (uInt rownr, const Array<String>* value)
+void ISMColumn::putArrayStringV (rownr_t rownr, const Array<String>* value)
 {
     Bool deleteIt;
     const String* data = value->getStorage (deleteIt);
@@ -754,14 +763,15 @@ void ISMColumn::putArrayStringV (uInt rownr, const Array<String>* value)
 }
 
 
-void ISMColumn::putValue (uInt rownr, const void* value)
+void ISMColumn::putValue (rownr_t rownr, const void* value)
 {
     // Get the bucket and interval to which the row belongs.
-    uInt bucketStartRow, bucketNrrow;
+    rownr_t bucketStartRow, bucketNrrow;
     ISMBucket* bucket = stmanPtr_p->getBucket (rownr, bucketStartRow,
 					       bucketNrrow);
-    uInt bucketRownr = rownr - bucketStartRow;
-    uInt inx, stint, endint, offset;
+    rownr_t bucketRownr = rownr - bucketStartRow;
+    uInt inx, offset;
+    rownr_t stint, endint;
     // Get the index where to add/replace the new value.
     // Note: offset gives the offset of the current value, which is often NOT
     //       the same as offIndex[inx] (usually it is offIndex[inx-1]).
@@ -775,7 +785,7 @@ void ISMColumn::putValue (uInt rownr, const void* value)
 #endif
 
     // Get bucket information needed to write the data.
-    Block<uInt>& rowIndex = bucket->rowIndex (colnr_p);
+    Block<rownr_t>& rowIndex = bucket->rowIndex (colnr_p);
     Block<uInt>& offIndex = bucket->offIndex (colnr_p);
     uInt& nused = bucket->indexUsed (colnr_p);
     // Determine if the new row is after the last row ever put for this column.
@@ -806,6 +816,8 @@ void ISMColumn::putValue (uInt rownr, const void* value)
     // We have to write the value, so let the cache set the dirty flag
     // for this bucket.
     stmanPtr_p->setBucketDirty();
+    // After the last row put the value is valid for all further rows.
+    setZoneMapChanged (rownr, afterLastRowPut ? stmanPtr_p->nrow() : rownr);
     // Get the temporary buffer from the storage manager.
     uInt lenData;
     char* buffer = stmanPtr_p->tempBuffer();
@@ -963,7 +975,7 @@ void ISMColumn::putValue (uInt rownr, const void* value)
     }
 }
 
-void ISMColumn::putFromRow (uInt rownr, const char* data, uInt lenData)
+void ISMColumn::putFromRow (rownr_t rownr, const char* data, uInt lenData)
 {
     // Skip the first bucket, because that is the one containing the
     // row just written.
@@ -975,7 +987,7 @@ void ISMColumn::putFromRow (uInt rownr, const char* data, uInt lenData)
 #endif
 
     ISMBucket* bucket;
-    uInt bucketNrrow;
+    rownr_t bucketNrrow;
     uInt cursor = 0;
     bucket = stmanPtr_p->nextBucket (cursor, rownr, bucketNrrow);
     // Loop through all buckets from the given row on.
@@ -1000,13 +1012,14 @@ void ISMColumn::putFromRow (uInt rownr, const char* data, uInt lenData)
 #endif
 }
 
-void ISMColumn::putData (ISMBucket* bucket, uInt bucketStartRow,
-			 uInt bucketNrrow, uInt bucketRownr,
+void ISMColumn::putData (ISMBucket* bucket, rownr_t bucketStartRow,
+			 rownr_t bucketNrrow, rownr_t bucketRownr,
 			 const char* data, uInt lenData,
 			 Bool afterLastRow, Bool canSplit)
 {
     // Determine the index.
-    uInt inx, start, end, dum3;
+    uInt inx, dum3;
+    rownr_t start, end;
     inx = bucket->getInterval (colnr_p, bucketRownr, 0, start, end, dum3);
     if ((afterLastRow  &&  bucketRownr == 0)  ||  start == end) {
 	Block<uInt>& offIndex = bucket->offIndex (colnr_p);
@@ -1018,8 +1031,8 @@ void ISMColumn::putData (ISMBucket* bucket, uInt bucketStartRow,
     }
 }
 
-void ISMColumn::replaceData (ISMBucket* bucket, uInt bucketStartRow,
-			     uInt bucketNrrow, uInt bucketRownr, uInt& offset,
+void ISMColumn::replaceData (ISMBucket* bucket, rownr_t bucketStartRow,
+			     rownr_t bucketNrrow, rownr_t bucketRownr, uInt& offset,
 			     const char* data, uInt lenData, Bool canSplit)
 {
     // Replacing a value means removing the old value.
@@ -1037,7 +1050,7 @@ void ISMColumn::replaceData (ISMBucket* bucket, uInt bucketStartRow,
     ISMBucket* left;
     ISMBucket* right;
     Block<Bool> duplicated;
-    uInt splitRownr = bucket->split (left, right, duplicated,
+    rownr_t splitRownr = bucket->split (left, right, duplicated,
 				     bucketStartRow, bucketNrrow,
 				     colnr_p, bucketRownr, lenData - oldLeng);
 
@@ -1061,8 +1074,8 @@ void ISMColumn::replaceData (ISMBucket* bucket, uInt bucketStartRow,
     stmanPtr_p->addBucket (splitRownr + bucketStartRow, right);
 }
 
-Bool ISMColumn::addData (ISMBucket* bucket, uInt bucketStartRow,
-			 uInt bucketNrrow, uInt bucketRownr, uInt inx,
+Bool ISMColumn::addData (ISMBucket* bucket, rownr_t bucketStartRow,
+			 rownr_t bucketNrrow, rownr_t bucketRownr, uInt inx,
 			 const char* data, uInt lenData,
 			 Bool afterLastRow, Bool canSplit)
 {
@@ -1076,7 +1089,7 @@ Bool ISMColumn::addData (ISMBucket* bucket, uInt bucketStartRow,
     ISMBucket* left;
     ISMBucket* right;
     Block<Bool> duplicated;
-    uInt splitRownr = bucket->split (left, right, duplicated,
+    rownr_t splitRownr = bucket->split (left, right, duplicated,
 				     bucketStartRow, bucketNrrow,
 				     colnr_p, bucketRownr, lenData);
 
@@ -1089,8 +1102,8 @@ Bool ISMColumn::addData (ISMBucket* bucket, uInt bucketStartRow,
     bucket->copy (*left);
     delete left;
     // Add the data to the correct part.
-    uInt startRow = bucketStartRow;
-    uInt nrrow    = splitRownr;
+    rownr_t startRow = bucketStartRow;
+    rownr_t nrrow    = splitRownr;
     if (bucketRownr >= splitRownr) {
 	bucket = right;
 	bucketRownr -= splitRownr;
@@ -1106,23 +1119,23 @@ Bool ISMColumn::addData (ISMBucket* bucket, uInt bucketStartRow,
 }
 
 #ifdef AIPS_TRACE
-void ISMColumn::handleCopy (uInt rownr, const char*)
+void ISMColumn::handleCopy (rownr_t rownr, const char*)
 {
     cout << "   handleCopy for row " << rownr
 	 << ", column " << colnr_p << endl;
 #else
-void ISMColumn::handleCopy (uInt, const char*)
+void ISMColumn::handleCopy (rownr_t, const char*)
 {
 #endif
 }
 
 #ifdef AIPS_TRACE
-void ISMColumn::handleRemove (uInt rownr, const char*)
+void ISMColumn::handleRemove (rownr_t rownr, const char*)
 {
     cout << "   handleRemove for row " << rownr
 	 << ", column " << colnr_p << endl;
 #else
-void ISMColumn::handleRemove (uInt, const char*)
+void ISMColumn::handleRemove (rownr_t, const char*)
 {
 #endif
 }
@@ -1287,26 +1300,124 @@ void ISMColumn::doCreate (ISMBucket* bucket)
     bucket->addData (colnr_p, 0, 0, buffer, leng);
 }
 
-void ISMColumn::getFile (uInt nrrow)
+void ISMColumn::getFile (rownr_t nrrow)
 {
     init();
     lastRowPut_p = nrrow;
 }
-Bool ISMColumn::flush (uInt, Bool)
+Bool ISMColumn::flush (rownr_t, Bool)
 {
     return False;
 }
-void ISMColumn::resync (uInt nrrow)
+void ISMColumn::resync (rownr_t nrrow)
 {
     // Invalidate the last value read.
     columnCache().invalidate();
     startRow_p   = -1;
     endRow_p     = -1;
     lastRowPut_p = nrrow;
+    // The zone map has to be read again from the index.
+    zoneMapInit_p = False;
 }
 void ISMColumn::reopenRW()
 {}
 
+Bool ISMColumn::canHaveZoneMap() const
+{
+    return StManZoneMap::isSupported (DataType(dataType()))  &&
+           shape_p.nelements() == 0;
+}
+
+void ISMColumn::activateZoneMap()
+{
+    if (canHaveZoneMap()) {
+        zoneMap_p.activate();
+        zoneMapInit_p = True;
+    }
+}
+
+void ISMColumn::initZoneMap()
+{
+    // Get the possibly existing zone map from the index.
+    if (!zoneMapInit_p) {
+        zoneMap_p = StManZoneMap();
+        if (canHaveZoneMap()) {
+            stmanPtr_p->getIndex().getZoneMap (colnr_p, zoneMap_p);
+        }
+        zoneMapInit_p = True;
+    }
+}
+
+void ISMColumn::setZoneMapChanged (rownr_t startRow, rownr_t endRow)
+{
+    initZoneMap();
+    zoneMap_p.setChanged (startRow, endRow);
+}
+
+void ISMColumn::updateZoneMap()
+{
+    if (zoneMap_p.hasChanged()) {
+        Vector<rownr_t> startRows = stmanPtr_p->getIndex().getStartRows();
+        Vector<uInt> zones = zoneMap_p.update (startRows, stmanPtr_p->nrow());
+        // A zone is a bucket; only the values stored in it have to be read.
+        DataType dtype = DataType(dataType());
+        Block<char> buf(typeSize_p);
+        for (uInt i=0; i<zones.size(); ++i) {
+            rownr_t bucketStartRow, bucketNrrow;
+            ISMBucket* bucket = stmanPtr_p->getBucket (startRows[zones[i]],
+                                                       bucketStartRow,
+                                                       bucketNrrow);
+            const Block<uInt>& offIndex = bucket->offIndex (colnr_p);
+            uInt nused = bucket->indexUsed (colnr_p);
+            Double minv = DBL_MAX;
+            Double maxv = -DBL_MAX;
+            for (uInt j=0; j<nused; ++j) {
+                readFunc_p (buf.storage(), bucket->get (offIndex[j]),
+                            nrcopy_p);
+                Double vmin, vmax;
+                StManZoneMap::minMax (vmin, vmax, buf.storage(), 1, dtype);
+                minv = std::min (minv, vmin);
+                maxv = std::max (maxv, vmax);
+            }
+            zoneMap_p.setZone (zones[i], minv, maxv);
+        }
+    }
+}
+
+Bool ISMColumn::getZoneMap (Vector<rownr_t>& startRows,
+                            Vector<Double>& minValues,
+                            Vector<Double>& maxValues)
+{
+    if (!canHaveZoneMap()) {
+        return False;
+    }
+    initZoneMap();
+    if (! zoneMap_p.isActive()) {
+        activateZoneMap();
+    }
+    if (zoneMap_p.hasChanged()) {
+        updateZoneMap();
+        // Write the new zone map when the table is flushed.
+        if (stmanPtr_p->table().isWritable()) {
+            stmanPtr_p->setIndexChanged();
+        }
+    }
+    zoneMap_p.getZones (startRows, minValues, maxValues);
+    return True;
+}
+
+void ISMColumn::flushZoneMap()
+{
+    if (zoneMapInit_p) {
+        if (zoneMap_p.isActive()) {
+            updateZoneMap();
+            stmanPtr_p->getIndex().setZoneMap (colnr_p, zoneMap_p);
+        } else {
+            stmanPtr_p->getIndex().removeZoneMap (colnr_p);
+        }
+    }
+}
+
 
 Conversion::ValueFunction* ISMColumn::getReaduInt (Bool asBigEndian)
 {
@@ -33,6 +33,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/StManColumn.h>
 #include <casacore/tables/DataMan/ISMBase.h>
+#include <casacore/tables/DataMan/StManZoneMap.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Utilities/Compare.h>
@@ -127,58 +128,58 @@ public:
 
     // Get the dimensionality of the item in the given row.
     // This is the same for all rows.
-    virtual uInt ndim (uInt rownr);
+    virtual uInt ndim (rownr_t rownr);
 
     // Get the shape of the array in the given row.
     // This is the same for all rows.
-    virtual IPosition shape (uInt rownr);
+    virtual IPosition shape (rownr_t rownr);
 
     // Let the column object initialize itself for a newly created table.
     // This is meant for a derived class.
     virtual void doCreate (ISMBucket*);
 
     // Let the column object initialize itself for an existing table.
-    virtual void getFile (uInt nrrow);
+    virtual void getFile (rownr_t nrrow);
 
     // Flush and optionally fsync the data.
     // This is meant for a derived class.
-    virtual Bool flush (uInt nrrow, Bool fsync);
+    virtual Bool flush (rownr_t nrrow, Bool fsync);
 
     // Resync the storage manager with the new file contents.
     // It resets the last rownr put.
-    void resync (uInt nrrow);
+    void resync (rownr_t nrrow);
 
     // Let the column reopen its data files for read/write access.
     virtual void reopenRW();
 
     // Get a scalar value in the given row.
     // <group>
-    virtual void getBoolV     (uInt rownr, Bool* dataPtr);
-    virtual void getuCharV    (uInt rownr, uChar* dataPtr);
-    virtual void getShortV    (uInt rownr, Short* dataPtr);
-    virtual void getuShortV   (uInt rownr, uShort* dataPtr);
-    virtual void getIntV      (uInt rownr, Int* dataPtr);
-    virtual void getuIntV     (uInt rownr, uInt* dataPtr);
-    virtual void getfloatV    (uInt rownr, float* dataPtr);
-    virtual void getdoubleV   (uInt rownr, double* dataPtr);
-    virtual void getComplexV  (uInt rownr, Complex* dataPtr);
-    virtual void getDComplexV (uInt rownr, DComplex* dataPtr);
-    virtual void getStringV   (uInt rownr, String* dataPtr);
+    virtual void getBoolV     (rownr_t rownr, Bool* dataPtr);
+    virtual void getuCharV    (rownr_t rownr, uChar* dataPtr);
+    virtual void getShortV    (rownr_t rownr, Short* dataPtr);
+    virtual void getuShortV   (rownr_t rownr, uShort* dataPtr);
+    virtual void getIntV      (rownr_t rownr, Int* dataPtr);
+    virtual void getuIntV     (rownr_t rownr, uInt* dataPtr);
+    virtual void getfloatV    (rownr_t rownr, float* dataPtr);
+    virtual void getdoubleV   (rownr_t rownr, double* dataPtr);
+    virtual void getComplexV  (rownr_t rownr, Complex* dataPtr);
+    virtual void getDComplexV (rownr_t rownr, DComplex* dataPtr);
+    virtual void getStringV   (rownr_t rownr, String* dataPtr);
     // </group>
 
     // Put a scalar value in the given row.
     // <group>
-    virtual void putBoolV     (uInt rownr, const Bool* dataPtr);
-    virtual void putuCharV    (uInt rownr, const uChar* dataPtr);
-    virtual void putShortV    (uInt rownr, const Short* dataPtr);
-    virtual void putuShortV   (uInt rownr, const uShort* dataPtr);
-    virtual void putIntV      (uInt rownr, const Int* dataPtr);
-    virtual void putuIntV     (uInt rownr, const uInt* dataPtr);
-    virtual void putfloatV    (uInt rownr, const float* dataPtr);
-    virtual void putdoubleV   (uInt rownr, const double* dataPtr);
-    virtual void putComplexV  (uInt rownr, const Complex* dataPtr);
-    virtual void putDComplexV (uInt rownr, const DComplex* dataPtr);
-    virtual void putStringV   (uInt rownr, const String* dataPtr);
+    virtual void putBoolV     (rownr_t rownr, const Bool* dataPtr);
+    virtual void putuCharV    (rownr_t rownr, const uChar* dataPtr);
+    virtual void putShortV    (rownr_t rownr, const Short* dataPtr);
+    virtual void putuShortV   (rownr_t rownr, const uShort* dataPtr);
+    virtual void putIntV      (rownr_t rownr, const Int* dataPtr);
+    virtual void putuIntV     (rownr_t rownr, const uInt* dataPtr);
+    virtual void putfloatV    (rownr_t rownr, const float* dataPtr);
+    virtual void putdoubleV   (rownr_t rownr, const double* dataPtr);
+    virtual void putComplexV  (rownr_t rownr, const Complex* dataPtr);
+    virtual void putDComplexV (rownr_t rownr, const DComplex* dataPtr);
+    virtual void putStringV   (rownr_t rownr, const String* dataPtr);
     // </group>
 
     // Get the scalar values in the entire column.
@@ -246,41 +247,41 @@ public:
 
     // Get an array value in the given row.
     // <group>
-    virtual void getArrayBoolV     (uInt rownr, Array<Bool>* dataPtr);
-    virtual void getArrayuCharV    (uInt rownr, Array<uChar>* dataPtr);
-    virtual void getArrayShortV    (uInt rownr, Array<Short>* dataPtr);
-    virtual void getArrayuShortV   (uInt rownr, Array<uShort>* dataPtr);
-    virtual void getArrayIntV      (uInt rownr, Array<Int>* dataPtr);
-    virtual void getArrayuIntV     (uInt rownr, Array<uInt>* dataPtr);
-    virtual void getArrayfloatV    (uInt rownr, Array<float>* dataPtr);
-    virtual void getArraydoubleV   (uInt rownr, Array<double>* dataPtr);
-    virtual void getArrayComplexV  (uInt rownr, Array<Complex>* dataPtr);
-    virtual void getArrayDComplexV (uInt rownr, Array<DComplex>* dataPtr);
-    virtual void getArrayStringV   (uInt rownr, Array<String>* dataPtr);
+    virtual void getArrayBoolV     (rownr_t rownr, Array<Bool>* dataPtr);
+    virtual void getArrayuCharV    (rownr_t rownr, Array<uChar>* dataPtr);
+    virtual void getArrayShortV    (rownr_t rownr, Array<Short>* dataPtr);
+    virtual void getArrayuShortV   (rownr_t rownr, Array<uShort>* dataPtr);
+    virtual void getArrayIntV      (rownr_t rownr, Array<Int>* dataPtr);
+    virtual void getArrayuIntV     (rownr_t rownr, Array<uInt>* dataPtr);
+    virtual void getArrayfloatV    (rownr_t rownr, Array<float>* dataPtr);
+    virtual void getArraydoubleV   (rownr_t rownr, Array<double>* dataPtr);
+    virtual void getArrayComplexV  (rownr_t rownr, Array<Complex>* dataPtr);
+    virtual void getArrayDComplexV (rownr_t rownr, Array<DComplex>* dataPtr);
+    virtual void getArrayStringV   (rownr_t rownr, Array<String>* dataPtr);
     // </group>
 
     // Put an array value in the given row.
     // <group>
-    virtual void putArrayBoolV     (uInt rownr, const Array<Bool>* dataPtr);
-    virtual void putArrayuCharV    (uInt rownr, const Array<uChar>* dataPtr);
-    virtual void putArrayShortV    (uInt rownr, const Array<Short>* dataPtr);
-    virtual void putArrayuShortV   (uInt rownr, const Array<uShort>* dataPtr);
-    virtual void putArrayIntV      (uInt rownr, const Array<Int>* dataPtr);
-    virtual void putArrayuIntV     (uInt rownr, const Array<uInt>* dataPtr);
-    virtual void putArrayfloatV    (uInt rownr, const Array<float>* dataPtr);
-    virtual void putArraydoubleV   (uInt rownr, const Array<double>* dataPtr);
-    virtual void putArrayComplexV  (uInt rownr, const Array<Complex>* dataPtr);
-    virtual void putArrayDComplexV (uInt rownr, const Array<DComplex>* dataPtr);
-    virtual void putArrayStringV   (uInt rownr, const Array<String>* dataPtr);
+    virtual void putArrayBoolV     (rownr_t rownr, const Array<Bool>* dataPtr);
+    virtual void putArrayuCharV    (rownr_t rownr, const Array<uChar>* dataPtr);
+    virtual void putArrayShortV    (rownr_t rownr, const Array<Short>* dataPtr);
+    virtual void putArrayuShortV   (rownr_t rownr, const Array<uShort>* dataPtr);
+    virtual void putArrayIntV      (rownr_t rownr, const Array<Int>* dataPtr);
+    virtual void putArrayuIntV     (rownr_t rownr, const Array<uInt>* dataPtr);
+    virtual void putArrayfloatV    (rownr_t rownr, const Array<float>* dataPtr);
+    virtual void putArraydoubleV   (rownr_t rownr, const Array<double>* dataPtr);
+    virtual void putArrayComplexV  (rownr_t rownr, const Array<Complex>* dataPtr);
+    virtual void putArrayDComplexV (rownr_t rownr, const Array<DComplex>* dataPtr);
+    virtual void putArrayStringV   (rownr_t rownr, const Array<String>* dataPtr);
     // </group>
 
     // Add (newNrrow-oldNrrow) rows to the column and initialize
     // the new rows when needed.
-    virtual void addRow (uInt newNrrow, uInt oldNrrow);
+    virtual void addRow (rownr_t newNrrow, rownr_t oldNrrow);
 
     // Remove the given row in the bucket from the column.
-    void remove (uInt bucketRownr, ISMBucket* bucket, uInt bucketNrrow,
-		 uInt newNrrow);
+    void remove (rownr_t bucketRownr, ISMBucket* bucket, rownr_t bucketNrrow,
+		 rownr_t newNrrow);
 
     // Get the function needed to read/write a uInt from/to external format.
     // This is used by other classes to read the length of a variable
@@ -292,11 +293,11 @@ public:
 
     // Give a derived class the opportunity to react on the duplication
     // of a value. It is used by ISMIndColumn.
-    virtual void handleCopy (uInt rownr, const char* value);
+    virtual void handleCopy (rownr_t rownr, const char* value);
 
     // Give a derived class the opportunity to react on the removal
     // of a value. It is used by ISMIndColumn.
-    virtual void handleRemove (uInt rownr, const char* value);
+    virtual void handleRemove (rownr_t rownr, const char* value);
 
     // Get the fixed length of the data value in a cell of this column
     // (0 = variable length).
@@ -305,17 +306,46 @@ public:
     // Get the nr of elements in this data value.
     uInt nelements() const;
 
+    // Get the zone map (minimum and maximum value per bucket) of the column.
+    // It is only possible for numeric scalar columns.
+    // If the column does not have a zone map yet, it is made and maintained
+    // thereafter.
+    virtual Bool getZoneMap (Vector<rownr_t>& startRows,
+                             Vector<Double>& minValues,
+                             Vector<Double>& maxValues);
+
+    // Maintain a zone map for the column (if possible).
+    // It is used for the columns of a new table.
+    void activateZoneMap();
+
+    // Bring the zone map (if maintained) up-to-date and store it in the
+    // index, so it is written with the index.
+    void flushZoneMap();
+
+    // Mark the given rows as changed in the zone map.
+    void setZoneMapChanged (rownr_t startRow, rownr_t endRow);
+
 
 protected:
     // Test if the last value is invalid for this row.
-    int isLastValueInvalid (Int rownr) const;
+    int isLastValueInvalid (Int64 rownr) const;
 
     // Get the value for this row.
     // Set the cache if the flag is set.
-    void getValue (uInt rownr, void* value, Bool setCache);
+    void getValue (rownr_t rownr, void* value, Bool setCache);
 
     // Put the value for this row.
-    void putValue (uInt rownr, const void* value);
+    void putValue (rownr_t rownr, const void* value);
+
+    // Can the column have a zone map?
+    // By default it can if it is a scalar with a numeric data type.
+    virtual Bool canHaveZoneMap() const;
+
+    // Get the zone map from the index (if not done yet).
+    void initZoneMap();
+
+    // Calculate the zones with changed rows.
+    void updateZoneMap();
 
     //# Declare member variables.
     // Pointer to the parent storage manager.
@@ -335,11 +365,11 @@ protected:
     uInt              nrcopy_p;
     // Cache for interval for which last value read is valid.
     // The last value is valid for startRow_p till endRow_p (inclusive).
-    Int               startRow_p;
-    Int               endRow_p;
+    Int64             startRow_p;
+    Int64             endRow_p;
     void*             lastValue_p;
     // The last row for which a value has been put.
-    uInt              lastRowPut_p;
+    rownr_t           lastRowPut_p;
     // The size of the data type in local format.
     uInt              typeSize_p;
     // Pointer to a convert function for writing.
@@ -348,6 +378,10 @@ protected:
     Conversion::ValueFunction* readFunc_p;
     // Pointer to a compare function.
     ObjCompareFunc*   compareFunc_p;
+    // The zone map of the column.
+    StManZoneMap      zoneMap_p;
+    // Has the zone map been initialized from the index?
+    Bool              zoneMapInit_p;
 
 
 private:
@@ -365,26 +399,26 @@ private:
     void clear();
 
     // Put the value in all buckets from the given row on.
-    void putFromRow (uInt rownr, const char* data, uInt lenData);
+    void putFromRow (rownr_t rownr, const char* data, uInt lenData);
 
     // Put a data value into the bucket.
     // When it is at the first row of the bucket, it replaces the value.
     // Otherwise it is added.
-    void putData (ISMBucket* bucket, uInt bucketStartRow,
-		  uInt bucketNrrow, uInt bucketRownr,
+    void putData (ISMBucket* bucket, rownr_t bucketStartRow,
+		  rownr_t bucketNrrow, rownr_t bucketRownr,
 		  const char* data, uInt lenData,
 		  Bool afterLastRow, Bool canSplit);
 
     // Replace a value at the given offset in the bucket.
     // If the bucket is too small, it will be split (if allowed).
-    void replaceData (ISMBucket* bucket, uInt bucketStartRow,
-		      uInt bucketNrrow, uInt bucketRownr, uInt& offset,
+    void replaceData (ISMBucket* bucket, rownr_t bucketStartRow,
+		      rownr_t bucketNrrow, rownr_t bucketRownr, uInt& offset,
 		      const char* data, uInt lenData, Bool canSplit = True);
 
     // Add a value at the given index in the bucket.
     // If the bucket is too small, it will be split (if allowed).
-    Bool addData (ISMBucket* bucket, uInt bucketStartRow,
-		  uInt bucketNrrow, uInt bucketRownr, uInt inx,
+    Bool addData (ISMBucket* bucket, rownr_t bucketStartRow,
+		  rownr_t bucketNrrow, rownr_t bucketRownr, uInt inx,
 		  const char* data, uInt lenData,
 		  Bool afterLastRow = False, Bool canSplit = True);
 
@@ -408,7 +442,7 @@ private:
 };
 
 
-inline int ISMColumn::isLastValueInvalid (Int rownr) const
+inline int ISMColumn::isLastValueInvalid (Int64 rownr) const
 {
     return rownr < startRow_p  ||  rownr > endRow_p;
 }
@@ -40,7 +40,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 ISMIndex::ISMIndex (ISMBase* parent)
 : stmanPtr_p (parent),
   nused_p    (1),
-  rows_p     (2, (uInt)0),
+  rows_p     (2, rownr_t(0)),
   bucketNr_p (1, (uInt)0)
 {}
 
@@ -49,23 +49,72 @@ ISMIndex::~ISMIndex()
 
 void ISMIndex::get (AipsIO& os)
 {
-    os.getstart ("ISMIndex");
+    uInt version = os.getstart ("ISMIndex");
     os >> nused_p;
-    getBlock (os, rows_p);
+    if (version > 1) {
+        getBlock (os, rows_p);
+    } else {
+        Block<uInt> rows;
+        getBlock (os, rows);
+        rows_p.resize (rows.nelements(), True, False);
+        for (uInt i=0; i<rows.nelements(); ++i) {
+            rows_p[i] = rows[i];
+        }
+    }
     getBlock (os, bucketNr_p);
+    zoneMaps_p.clear();
+    // Version 3 keyed the zone maps by column name, which is not correct
+    // after a column rename. Those zone maps are skipped (thus rebuilt).
+    if (version > 2) {
+        uInt nmap;
+        os >> nmap;
+        for (uInt i=0; i<nmap; ++i) {
+            if (version == 3) {
+                String name;
+                os >> name;
+                StManZoneMap zoneMap;
+                zoneMap.get (os);
+            } else {
+                uInt colnr;
+                os >> colnr;
+                zoneMaps_p[colnr].get (os);
+            }
+        }
+    }
     os.getend();
 }
 
 void ISMIndex::put (AipsIO& os)
 {
-    os.putstart ("ISMIndex", 1);
-    os << nused_p;
-    putBlock (os, rows_p, nused_p + 1);
+    // Use 64-bit row numbers only if needed.
+    // Zone maps need the newest format.
+    Bool useZone = !zoneMaps_p.empty();
+    if (useZone  ||  rows_p[nused_p] > 4294967295u) {
+        os.putstart ("ISMIndex", useZone ? 4 : 2);
+        os << nused_p;
+        putBlock (os, rows_p, nused_p + 1);
+    } else {
+        os.putstart ("ISMIndex", 1);
+        os << nused_p;
+        Block<uInt> rows(nused_p + 1);
+        for (uInt i=0; i<=nused_p; ++i) {
+            rows[i] = rows_p[i];
+        }
+        putBlock (os, rows, nused_p + 1);
+    }
     putBlock (os, bucketNr_p, nused_p);
+    if (useZone) {
+        os << uInt(zoneMaps_p.size());
+        for (std::map<uInt,StManZoneMap>::const_iterator iter =
+               zoneMaps_p.begin(); iter != zoneMaps_p.end(); ++iter) {
+            os << iter->first;
+            iter->second.put (os);
+        }
+    }
     os.putend();
 }
 
-void ISMIndex::addBucketNr (uInt rownr, uInt bucketNr)
+void ISMIndex::addBucketNr (rownr_t rownr, uInt bucketNr)
 {
     if (nused_p >= bucketNr_p.nelements()) {
 	rows_p.resize (nused_p + 64 + 1);
@@ -83,12 +132,12 @@ void ISMIndex::addBucketNr (uInt rownr, uInt bucketNr)
     nused_p++;
 }
 
-void ISMIndex::addRow (uInt nrrow)
+void ISMIndex::addRow (rownr_t nrrow)
 {
     rows_p[nused_p] += nrrow;
 }
 
-Int ISMIndex::removeRow (uInt rownr)
+Int ISMIndex::removeRow (rownr_t rownr)
 {
     // Decrement the row number for all intervals after the row
     // to be removed.
@@ -114,7 +163,7 @@ Int ISMIndex::removeRow (uInt rownr)
     return emptyBucket;
 }
 
-uInt ISMIndex::getIndex (uInt rownr) const
+uInt ISMIndex::getIndex (rownr_t rownr) const
 {
     // If no exact match, the interval starts at the previous index.
     Bool found;
@@ -126,8 +175,8 @@ uInt ISMIndex::getIndex (uInt rownr) const
     return index;
 }
 
-uInt ISMIndex::getBucketNr (uInt rownr, uInt& bucketStartRow,
-			    uInt& bucketNrrow) const
+uInt ISMIndex::getBucketNr (rownr_t rownr, rownr_t& bucketStartRow,
+			    rownr_t& bucketNrrow) const
 {
     uInt index = getIndex (rownr);
     bucketStartRow = rows_p[index];
@@ -135,8 +184,8 @@ uInt ISMIndex::getBucketNr (uInt rownr, uInt& bucketStartRow,
     return bucketNr_p[index];
 }
 
-Bool ISMIndex::nextBucketNr (uInt& cursor, uInt& bucketStartRow,
-			     uInt& bucketNrrow, uInt& bucketNr) const
+Bool ISMIndex::nextBucketNr (uInt& cursor, rownr_t& bucketStartRow,
+			     rownr_t& bucketNrrow, uInt& bucketNr) const
 {
     // When first time, get the index of the bucket containing the row.
     // End the iteration when the first row is past the end.
@@ -158,6 +207,35 @@ Bool ISMIndex::nextBucketNr (uInt& cursor, uInt& bucketStartRow,
     return True;
 }
 
+Vector<rownr_t> ISMIndex::getStartRows() const
+{
+    Vector<rownr_t> startRows(nused_p);
+    for (uInt i=0; i<nused_p; ++i) {
+        startRows[i] = rows_p[i];
+    }
+    return startRows;
+}
+
+void ISMIndex::setZoneMap (uInt colnr, const StManZoneMap& zoneMap)
+{
+    zoneMaps_p[colnr] = zoneMap;
+}
+
+Bool ISMIndex::getZoneMap (uInt colnr, StManZoneMap& zoneMap) const
+{
+    std::map<uInt,StManZoneMap>::const_iterator iter = zoneMaps_p.find (colnr);
+    if (iter == zoneMaps_p.end()) {
+        return False;
+    }
+    zoneMap = iter->second;
+    return True;
+}
+
+void ISMIndex::removeZoneMap (uInt colnr)
+{
+    zoneMaps_p.erase (colnr);
+}
+
 void ISMIndex::show (ostream& os) const
 {
     os << "ISMIndex " << nused_p << " strow:bucket";
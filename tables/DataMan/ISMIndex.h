@@ -31,6 +31,9 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/tables/DataMan/StManZoneMap.h>
+#include <map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -65,6 +68,8 @@ class AipsIO;
 // When the ISM is closed or flushed, the index is written back after
 // all buckets in the file. A little header at the beginning of the file
 // indicates the starting offset of the index.
+// <br>The index also holds the zone maps (minimum and maximum value per
+// bucket) of the columns, so they are stored together with it.
 // </synopsis> 
 
 // <motivation>
@@ -87,29 +92,34 @@ public:
     ~ISMIndex();
 
     // Add a row.
-    void addRow (uInt nrrow);
+    void addRow (rownr_t nrrow);
 
     // Remove a row from the index.
     // If the result of this is that the entire bucket gets empty,
     // that bucketnr is returned. Otherwise -1 is returned.
-    Int removeRow (uInt rownr);
+    Int removeRow (rownr_t rownr);
 
     // Get the bucket number for the given row.
     // Also return the start row of the bucket and the number of rows in it.
-    uInt getBucketNr (uInt rownr, uInt& bucketStartRow,
-		      uInt& bucketNrrow) const;
+    uInt getBucketNr (rownr_t rownr, rownr_t& bucketStartRow,
+		      rownr_t& bucketNrrow) const;
 
     // Read the bucket index from the AipsIO object.
+    // Both 32-bit (version 1) and 64-bit (version 2) row numbers
+    // can be read. Version 3 also contains the zone maps.
     void get (AipsIO& os);
 
     // Write the bucket index into the AipsIO object.
+    // The row numbers are written as 32-bit values (version 1) if they fit
+    // and if no zone maps have to be written, so older software can still
+    // read it.
     void put (AipsIO& os);
 
     // Add a bucket number to the index.
     // Argument <src>rownr</src> gives the starting row of the bucket.
     // It is used to add the bucket number at the correct place
     // (such that the row numbers are kept in ascending order).
-    void addBucketNr (uInt rownr, uInt bucketNr);
+    void addBucketNr (rownr_t rownr, uInt bucketNr);
 
     // Get the number of the next bucket from the index and return
     // it in <src>bucketNr</src>. The starting row of that bucket and
@@ -121,12 +131,27 @@ public:
     // to 0 if you to start at the first bucket).
     // <br>The next iterations return the next bucket number and fill
     // the starting row and number of rows.
-    Bool nextBucketNr (uInt& cursor, uInt& bucketStartRow, uInt& bucketNrrow,
-		       uInt& bucketNr) const;
+    Bool nextBucketNr (uInt& cursor, rownr_t& bucketStartRow,
+                       rownr_t& bucketNrrow, uInt& bucketNr) const;
 
     // Show the index.
     void show (std::ostream&) const;
 
+    // Get the first row number of each bucket.
+    Vector<rownr_t> getStartRows() const;
+
+    // Set the zone map of the given column (to be written with the index).
+    // The column is identified by its number, because (unlike the column
+    // name) it does not change when the column is renamed.
+    void setZoneMap (uInt colnr, const StManZoneMap& zoneMap);
+
+    // Get the zone map of the given column.
+    // It returns False if the index does not contain the zone map.
+    Bool getZoneMap (uInt colnr, StManZoneMap& zoneMap) const;
+
+    // Remove the zone map of the given column (if existing).
+    void removeZoneMap (uInt colnr);
+
 private:
     // Forbid copy constructor.
     ISMIndex (const ISMIndex&);
@@ -135,7 +160,7 @@ private:
     ISMIndex& operator= (const ISMIndex&);
 
     // Get the index of the bucket containing the given row.
-    uInt getIndex (uInt rownr) const;
+    uInt getIndex (rownr_t rownr) const;
 
 
     //# Declare member variables.
@@ -144,9 +169,11 @@ private:
     // Number of entries used.
     uInt              nused_p;
     // Rownr index (i.e. row rows_p[i] starts in bucketNr_p[i]).
-    Block<uInt>       rows_p;
+    Block<rownr_t>    rows_p;
     // Corresponding bucket number.
     Block<uInt>       bucketNr_p;
+    // Zone maps of the columns (keyed by column number).
+    std::map<uInt,StManZoneMap> zoneMaps_p;
 };
 
 
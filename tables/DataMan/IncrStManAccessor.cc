@@ -93,13 +93,13 @@ void ROIncrementalStManAccessor::showBucketLayout (ostream& os) const
 }
 
 Bool ROIncrementalStManAccessor::checkBucketLayout (uInt &offendingCursor,
-                                                    uInt &offendingBucketStartRow,
-                                                    uInt &offendingBucketNrow,
+                                                    rownr_t &offendingBucketStartRow,
+                                                    rownr_t &offendingBucketNrow,
                                                     uInt &offendingBucketNr,
                                                     uInt &offendingCol,
                                                     uInt &offendingIndex,
-                                                    uInt &offendingRow,
-                                                    uInt &offendingPrevRow) const
+                                                    rownr_t &offendingRow,
+                                                    rownr_t &offendingPrevRow) const
 {
   Bool ok;
   ok = dataManPtr_p->checkBucketLayout (offendingCursor,
@@ -145,13 +145,13 @@ public:
 
     // Check that there are no repeated rowIds in the buckets comprising this ISM
     Bool checkBucketLayout (uInt &offendingCursor,
-                            uInt &offendingBucketStartRow,
-                            uInt &offendingBucketNrow,
+                            rownr_t &offendingBucketStartRow,
+                            rownr_t &offendingBucketNrow,
                             uInt &offendingBucketNr,
                             uInt &offendingCol,
                             uInt &offendingIndex,
-                            uInt &offendingRow,
-                            uInt &offendingPrevRow) const;
+                            rownr_t &offendingRow,
+                            rownr_t &offendingPrevRow) const;
 
 private:
     //# Declare the data members.
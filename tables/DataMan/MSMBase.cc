@@ -219,7 +219,7 @@ void MSMBase::removeColumn (DataManagerColumn* colp)
   throw (DataManInternalError ("MSMBase::removeColumn: no such column"));
 }
 
-void MSMBase::addRow (uInt nr)
+void MSMBase::addRow (rownr_t nr)
 {
   //# Add the number of rows to each column.
   for (uInt i=0; i<ncolumn(); i++) {
@@ -229,7 +229,7 @@ void MSMBase::addRow (uInt nr)
 }
 
 
-void MSMBase::removeRow (uInt rownr)
+void MSMBase::removeRow (rownr_t rownr)
 {
   for (uInt i=0; i<ncolumn(); i++) {
     colSet_p[i]->remove (rownr);
@@ -243,7 +243,7 @@ Bool MSMBase::flush (AipsIO&, Bool)
   return False;
 }
 
-void MSMBase::create (uInt nrrow)
+void MSMBase::create (rownr_t nrrow)
 {
   //# Do not add the required nr of rows yet.
   // It is done later in reallocateColumn to avoid that all row data
@@ -252,7 +252,7 @@ void MSMBase::create (uInt nrrow)
   nrrowCreate_p = nrrow;
 }
 
-void MSMBase::open (uInt tabNrrow, AipsIO&)
+void MSMBase::open (rownr_t tabNrrow, AipsIO&)
 {
   nrrow_p = tabNrrow;
   //# Create the required nr of rows and initialize them.
@@ -261,7 +261,7 @@ void MSMBase::open (uInt tabNrrow, AipsIO&)
   }
 }
 
-void MSMBase::resync (uInt nrrow)
+void MSMBase::resync (rownr_t nrrow)
 {
   // Add or remove rows if it has changed.
   // Note that removing decreases the row number, so the same row number
@@ -57,17 +57,17 @@ MSMColumn::~MSMColumn()
 }
 
 
-void MSMColumn::doCreate (uInt nrrow)
+void MSMColumn::doCreate (rownr_t nrrow)
 {
   addRow (nrrow, 0);
   initData (data_p[1], nrrow);
 }
 
-void MSMColumn::addRow (uInt nrnew, uInt)
+void MSMColumn::addRow (rownr_t nrnew, rownr_t)
 {
   //# Extend the column sizes if needed.
   if (nrnew > nralloc_p) {
-    uInt n = nralloc_p + 4096;
+    rownr_t n = nralloc_p + 4096;
     if (n < nrnew) {
       n = nrnew;
     }
@@ -75,7 +75,7 @@ void MSMColumn::addRow (uInt nrnew, uInt)
   }
 }
 
-void MSMColumn::resize (uInt nr)
+void MSMColumn::resize (rownr_t nr)
 {
   //# Extend internal blocks if needed.
   if (nrext_p+1 >= data_p.nelements()) {
@@ -93,7 +93,7 @@ void MSMColumn::resize (uInt nr)
 }
 
 
-uInt MSMColumn::findExt (uInt index, Bool setCache)
+uInt MSMColumn::findExt (rownr_t index, Bool setCache)
 {
   //# Use a binary search to get the block containing the index.
   Int st = 0;
@@ -114,7 +114,7 @@ uInt MSMColumn::findExt (uInt index, Bool setCache)
     }
   }
   if (i > Int(nrext_p)) {
-    throw (indexError<uInt>(index, "MSMColumn::findExt - "
+    throw (indexError<rownr_t>(index, "MSMColumn::findExt - "
 			    "rownr out of range"));
   }
   if (setCache) {
@@ -123,13 +123,13 @@ uInt MSMColumn::findExt (uInt index, Bool setCache)
   return i;
 }
 
-uInt MSMColumn::nextExt (void*& ext, uInt& extnr, uInt nrmax) const
+rownr_t MSMColumn::nextExt (void*& ext, uInt& extnr, rownr_t nrmax) const
 {
   if (++extnr > nrext_p) {
     return 0;
   }
   ext = data_p[extnr];
-  uInt n = ncum_p[extnr];
+  rownr_t n = ncum_p[extnr];
   if (n > nrmax) {
     n = nrmax;
   }
@@ -141,24 +141,24 @@ uInt MSMColumn::nextExt (void*& ext, uInt& extnr, uInt nrmax) const
 
 
 #define MSMCOLUMN_GETPUT(T,NM) \
-void MSMColumn::aips_name2(get,NM) (uInt rownr, T* value) \
+void MSMColumn::aips_name2(get,NM) (rownr_t rownr, T* value) \
 { \
   uInt extnr = findExt(rownr, True); \
   *value = ((T*)(data_p[extnr])) [rownr-ncum_p[extnr-1]]; \
 } \
-void MSMColumn::aips_name2(put,NM) (uInt rownr, const T* value) \
+void MSMColumn::aips_name2(put,NM) (rownr_t rownr, const T* value) \
 { \
   uInt extnr = findExt(rownr, True); \
   ((T*)(data_p[extnr])) [rownr-ncum_p[extnr-1]] = *value; \
 } \
-uInt MSMColumn::aips_name2(getBlock,NM) (uInt rownr, uInt nrmax, T* value) \
+uInt MSMColumn::aips_name2(getBlock,NM) (rownr_t rownr, uInt nrmax, T* value) \
 { \
   uInt nr; \
   uInt extnr = findExt(rownr, True); \
-  nrmax = min (nrmax, nralloc_p-rownr); \
+  nrmax = std::min (rownr_t(nrmax), nralloc_p-rownr); \
   uInt nrm = nrmax; \
   while (nrmax > 0) { \
-    nr = min (nrmax, ncum_p[extnr]-rownr); \
+    nr = std::min (rownr_t(nrmax), ncum_p[extnr]-rownr); \
     objcopy (value, ((T*)(data_p[extnr])) +rownr-ncum_p[extnr-1], nr); \
     nrmax -= nr; \
     value += nr; \
@@ -167,13 +167,13 @@ uInt MSMColumn::aips_name2(getBlock,NM) (uInt rownr, uInt nrmax, T* value) \
   } \
   return nrm; \
 } \
-void MSMColumn::aips_name2(putBlock,NM) (uInt rownr, uInt nrmax, const T* value) \
+void MSMColumn::aips_name2(putBlock,NM) (rownr_t rownr, uInt nrmax, const T* value) \
 { \
   uInt nr; \
   uInt extnr = findExt(rownr, True); \
-  nrmax = min (nrmax, nralloc_p-rownr); \
+  nrmax = std::min (rownr_t(nrmax), nralloc_p-rownr); \
   while (nrmax > 0) { \
-    nr = min (nrmax, ncum_p[extnr]-rownr); \
+    nr = std::min (rownr_t(nrmax), ncum_p[extnr]-rownr); \
     objcopy (((T*)(data_p[extnr])) +rownr-ncum_p[extnr-1], value, nr); \
     nrmax -= nr; \
     value += nr; \
@@ -192,16 +192,16 @@ void MSMColumn::aips_name2(getScalarColumnCells,NM) \
   if (rownrs.isSliced()) { \
     RefRowsSliceIter iter(rownrs); \
     while (! iter.pastEnd()) { \
-      uInt rownr = iter.sliceStart(); \
-      uInt end = iter.sliceEnd(); \
-      uInt incr = iter.sliceIncr(); \
+      rownr_t rownr = iter.sliceStart(); \
+      rownr_t end = iter.sliceEnd(); \
+      rownr_t incr = iter.sliceIncr(); \
       while (rownr <= end) { \
         if (rownr < cache.start()  ||  rownr > cache.end()) { \
           aips_name2(get,NM) (rownr, valptr); \
         } \
 	uInt inx = rownr - cache.start(); \
         const T* cacheValue = (const T*)(cache.dataPtr()) + inx; \
-        uInt endrow = min (end, cache.end()); \
+        rownr_t endrow = std::min (end, cache.end()); \
         while (rownr <= endrow) { \
 	  *valptr++ = *cacheValue; \
           rownr += incr; \
@@ -211,19 +211,19 @@ void MSMColumn::aips_name2(getScalarColumnCells,NM) \
       iter++; \
     } \
   } else { \
-    const Vector<uInt>& rowvec = rownrs.rowVector(); \
+    const Vector<rownr_t>& rowvec = rownrs.rowVector(); \
     uInt nr = rowvec.nelements(); \
     if (nr > 0) { \
       Bool delR; \
-      const uInt* rows = rowvec.getStorage (delR); \
+      const rownr_t* rows = rowvec.getStorage (delR); \
       if (rows[0] < cache.start()  ||  rows[0] > cache.end()) { \
         findExt(rows[0], True); \
       } \
       const T* cacheValue = (const T*)(cache.dataPtr()); \
-      uInt strow = cache.start(); \
-      uInt endrow = cache.end(); \
+      rownr_t strow = cache.start(); \
+      rownr_t endrow = cache.end(); \
       for (uInt i=0; i<nr; i++) { \
-	uInt rownr = rows[i]; \
+	rownr_t rownr = rows[i]; \
         if (rownr >= strow  &&  rownr <= endrow) { \
 	  value[i] = cacheValue[rownr-strow]; \
 	} else { \
@@ -252,11 +252,11 @@ MSMCOLUMN_GETPUT(DComplex,DComplexV)
 MSMCOLUMN_GETPUT(String,StringV)
 
 
-void MSMColumn::remove (uInt index)
+void MSMColumn::remove (rownr_t index)
 {
   //# Find the extension.
   uInt extnr  = findExt(index, False);
-  uInt nrval  = ncum_p[extnr] - ncum_p[extnr-1];
+  rownr_t nrval  = ncum_p[extnr] - ncum_p[extnr-1];
   void* datap = data_p[extnr];
   //# If the extension contains only this element, remove the extension.
   if (nrval == 1) {
@@ -506,12 +506,12 @@ void MSMColumn::initData (void* datap, uInt nrval)
 }
 
 
-void* MSMColumn::getArrayPtr (uInt rownr)
+void* MSMColumn::getArrayPtr (rownr_t rownr)
 {
   uInt extnr = findExt(rownr, False);
   return ((void**)(data_p[extnr])) [rownr-ncum_p[extnr-1]];
 }
-void MSMColumn::putArrayPtr (uInt rownr, void* ptr)
+void MSMColumn::putArrayPtr (rownr_t rownr, void* ptr)
 {
   uInt extnr = findExt(rownr, False);
   ((void**)(data_p[extnr])) [rownr-ncum_p[extnr-1]] = ptr;
@@ -115,34 +115,34 @@ public:
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the Scalar/ArrayColumn get function).
   // <group>
-  void getBoolV     (uInt rownr, Bool* dataPtr);
-  void getuCharV    (uInt rownr, uChar* dataPtr);
-  void getShortV    (uInt rownr, Short* dataPtr);
-  void getuShortV   (uInt rownr, uShort* dataPtr);
-  void getIntV      (uInt rownr, Int* dataPtr);
-  void getuIntV     (uInt rownr, uInt* dataPtr);
-  void getfloatV    (uInt rownr, float* dataPtr);
-  void getdoubleV   (uInt rownr, double* dataPtr);
-  void getComplexV  (uInt rownr, Complex* dataPtr);
-  void getDComplexV (uInt rownr, DComplex* dataPtr);
-  void getStringV   (uInt rownr, String* dataPtr);
+  void getBoolV     (rownr_t rownr, Bool* dataPtr);
+  void getuCharV    (rownr_t rownr, uChar* dataPtr);
+  void getShortV    (rownr_t rownr, Short* dataPtr);
+  void getuShortV   (rownr_t rownr, uShort* dataPtr);
+  void getIntV      (rownr_t rownr, Int* dataPtr);
+  void getuIntV     (rownr_t rownr, uInt* dataPtr);
+  void getfloatV    (rownr_t rownr, float* dataPtr);
+  void getdoubleV   (rownr_t rownr, double* dataPtr);
+  void getComplexV  (rownr_t rownr, Complex* dataPtr);
+  void getDComplexV (rownr_t rownr, DComplex* dataPtr);
+  void getStringV   (rownr_t rownr, String* dataPtr);
   // </group>
 
   // Put a scalar value into the given row.
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the Scalar/ArrayColumn put function).
   // <group>
-  void putBoolV     (uInt rownr, const Bool* dataPtr);
-  void putuCharV    (uInt rownr, const uChar* dataPtr);
-  void putShortV    (uInt rownr, const Short* dataPtr);
-  void putuShortV   (uInt rownr, const uShort* dataPtr);
-  void putIntV      (uInt rownr, const Int* dataPtr);
-  void putuIntV     (uInt rownr, const uInt* dataPtr);
-  void putfloatV    (uInt rownr, const float* dataPtr);
-  void putdoubleV   (uInt rownr, const double* dataPtr);
-  void putComplexV  (uInt rownr, const Complex* dataPtr);
-  void putDComplexV (uInt rownr, const DComplex* dataPtr);
-  void putStringV   (uInt rownr, const String* dataPtr);
+  void putBoolV     (rownr_t rownr, const Bool* dataPtr);
+  void putuCharV    (rownr_t rownr, const uChar* dataPtr);
+  void putShortV    (rownr_t rownr, const Short* dataPtr);
+  void putuShortV   (rownr_t rownr, const uShort* dataPtr);
+  void putIntV      (rownr_t rownr, const Int* dataPtr);
+  void putuIntV     (rownr_t rownr, const uInt* dataPtr);
+  void putfloatV    (rownr_t rownr, const float* dataPtr);
+  void putdoubleV   (rownr_t rownr, const double* dataPtr);
+  void putComplexV  (rownr_t rownr, const Complex* dataPtr);
+  void putDComplexV (rownr_t rownr, const DComplex* dataPtr);
+  void putStringV   (rownr_t rownr, const String* dataPtr);
   // </group>
 
   // Get scalars from the given row on with a maximum of nrmax values.
@@ -151,17 +151,17 @@ public:
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the ScalarColumn get function).
   // <group>
-  uInt getBlockBoolV     (uInt rownr, uInt nrmax, Bool* dataPtr);
-  uInt getBlockuCharV    (uInt rownr, uInt nrmax, uChar* dataPtr);
-  uInt getBlockShortV    (uInt rownr, uInt nrmax, Short* dataPtr);
-  uInt getBlockuShortV   (uInt rownr, uInt nrmax, uShort* dataPtr);
-  uInt getBlockIntV      (uInt rownr, uInt nrmax, Int* dataPtr);
-  uInt getBlockuIntV     (uInt rownr, uInt nrmax, uInt* dataPtr);
-  uInt getBlockfloatV    (uInt rownr, uInt nrmax, float* dataPtr);
-  uInt getBlockdoubleV   (uInt rownr, uInt nrmax, double* dataPtr);
-  uInt getBlockComplexV  (uInt rownr, uInt nrmax, Complex* dataPtr);
-  uInt getBlockDComplexV (uInt rownr, uInt nrmax, DComplex* dataPtr);
-  uInt getBlockStringV   (uInt rownr, uInt nrmax, String* dataPtr);
+  uInt getBlockBoolV     (rownr_t rownr, uInt nrmax, Bool* dataPtr);
+  uInt getBlockuCharV    (rownr_t rownr, uInt nrmax, uChar* dataPtr);
+  uInt getBlockShortV    (rownr_t rownr, uInt nrmax, Short* dataPtr);
+  uInt getBlockuShortV   (rownr_t rownr, uInt nrmax, uShort* dataPtr);
+  uInt getBlockIntV      (rownr_t rownr, uInt nrmax, Int* dataPtr);
+  uInt getBlockuIntV     (rownr_t rownr, uInt nrmax, uInt* dataPtr);
+  uInt getBlockfloatV    (rownr_t rownr, uInt nrmax, float* dataPtr);
+  uInt getBlockdoubleV   (rownr_t rownr, uInt nrmax, double* dataPtr);
+  uInt getBlockComplexV  (rownr_t rownr, uInt nrmax, Complex* dataPtr);
+  uInt getBlockDComplexV (rownr_t rownr, uInt nrmax, DComplex* dataPtr);
+  uInt getBlockStringV   (rownr_t rownr, uInt nrmax, String* dataPtr);
   // </group>
 
   // Put nrmax scalars from the given row on.
@@ -170,17 +170,17 @@ public:
   // The buffer pointed to by dataPtr has to have the correct length
   // (which is guaranteed by the ScalarColumn put function).
   // <group>
-  void putBlockBoolV     (uInt rownr, uInt nrmax, const Bool* dataPtr);
-  void putBlockuCharV    (uInt rownr, uInt nrmax, const uChar* dataPtr);
-  void putBlockShortV    (uInt rownr, uInt nrmax, const Short* dataPtr);
-  void putBlockuShortV   (uInt rownr, uInt nrmax, const uShort* dataPtr);
-  void putBlockIntV      (uInt rownr, uInt nrmax, const Int* dataPtr);
-  void putBlockuIntV     (uInt rownr, uInt nrmax, const uInt* dataPtr);
-  void putBlockfloatV    (uInt rownr, uInt nrmax, const float* dataPtr);
-  void putBlockdoubleV   (uInt rownr, uInt nrmax, const double* dataPtr);
-  void putBlockComplexV  (uInt rownr, uInt nrmax, const Complex* dataPtr);
-  void putBlockDComplexV (uInt rownr, uInt nrmax, const DComplex* dataPtr);
-  void putBlockStringV   (uInt rownr, uInt nrmax, const String* dataPtr);
+  void putBlockBoolV     (rownr_t rownr, uInt nrmax, const Bool* dataPtr);
+  void putBlockuCharV    (rownr_t rownr, uInt nrmax, const uChar* dataPtr);
+  void putBlockShortV    (rownr_t rownr, uInt nrmax, const Short* dataPtr);
+  void putBlockuShortV   (rownr_t rownr, uInt nrmax, const uShort* dataPtr);
+  void putBlockIntV      (rownr_t rownr, uInt nrmax, const Int* dataPtr);
+  void putBlockuIntV     (rownr_t rownr, uInt nrmax, const uInt* dataPtr);
+  void putBlockfloatV    (rownr_t rownr, uInt nrmax, const float* dataPtr);
+  void putBlockdoubleV   (rownr_t rownr, uInt nrmax, const double* dataPtr);
+  void putBlockComplexV  (rownr_t rownr, uInt nrmax, const Complex* dataPtr);
+  void putBlockDComplexV (rownr_t rownr, uInt nrmax, const DComplex* dataPtr);
+  void putBlockStringV   (rownr_t rownr, uInt nrmax, const String* dataPtr);
   // </group>
 
   // Get the scalar values in some cells of the column.
@@ -213,19 +213,19 @@ public:
   // </group>
 
   // Add (newNrrow-oldNrrow) rows to the column.
-  virtual void addRow (uInt newNrrow, uInt oldNrrow);
+  virtual void addRow (rownr_t newNrrow, rownr_t oldNrrow);
 
   // Resize the data blocks.
   // This adds an extension when needed.
-  void resize (uInt nrval);
+  void resize (rownr_t nrval);
 
   // Remove the given row.
   // If no rows remain in the extension, the extension is also removed.
-  virtual void remove (uInt rownr);
+  virtual void remove (rownr_t rownr);
 
   // Create the number of rows in a new table.
   // This is used when a table gets created or opened.
-  virtual void doCreate (uInt nrrow);
+  virtual void doCreate (rownr_t nrrow);
 
   // Check if the class invariants still hold.
   virtual Bool ok() const;
@@ -237,23 +237,23 @@ protected:
   // The data is indirectly accessed via a pointer (for the derived classes).
   Bool  byPtr_p;
   // The number of allocated rows in the column.
-  uInt  nralloc_p;
+  rownr_t  nralloc_p;
   // The nr of extensions in use.
   uInt  nrext_p;
   // The assembly of all extensions (actually Block<T*>).
   Block<void*> data_p;
   // The cumulative nr of rows in all extensions.
-  Block<uInt>  ncum_p;
+  Block<rownr_t> ncum_p;
 
   // Find the extension in which the row number is.
   // If the flag is true, it also sets the columnCache object.
-  uInt findExt (uInt rownr, Bool setCache);
+  uInt findExt (rownr_t rownr, Bool setCache);
 
   // Get the next extension.
   // For the first iteration extnr should be zero.
   // It returns the number of values in it until the maximum is reached.
   // Zero means no more extensions.
-  uInt nextExt (void*& ext, uInt& extnr, uInt nrmax) const;
+  rownr_t nextExt (void*& ext, uInt& extnr, rownr_t nrmax) const;
 
   // Allocate an extension with the data type of the column.
   void* allocData (uInt nrval, Bool byPtr);
@@ -276,11 +276,11 @@ protected:
 
   // Get the pointer for the given row.
   // This is for the derived classes like StManArrayColumnMemory.
-  void* getArrayPtr (uInt rownr);
+  void* getArrayPtr (rownr_t rownr);
 
   // Put the pointer for the given row.
   // This is for the derived classes like StManArrayColumnMemory.
-  void putArrayPtr (uInt rownr, void* dataPtr);
+  void putArrayPtr (rownr_t rownr, void* dataPtr);
 
 private:
   // Forbid copy constructor.
@@ -40,6 +40,7 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/BucketMapped.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/IO/MemoryIO.h>
 #include <casacore/casa/IO/CanonicalIO.h>
@@ -61,6 +62,7 @@ SSMBase::SSMBase (Int aBucketSize, uInt aCacheSize)
   itsNrRows            (0),
   itsCache             (0),
   itsFile              (0),
+  itsMapped            (0),
   itsStringHandler     (0),
   itsPersCacheSize     (max(aCacheSize,2u)),
   itsCacheSize         (0),
@@ -93,6 +95,7 @@ SSMBase::SSMBase (const String& aDataManName,
   itsNrRows            (0),
   itsCache             (0),
   itsFile              (0),
+  itsMapped            (0),
   itsStringHandler     (0),
   itsPersCacheSize     (max(aCacheSize,2u)),
   itsCacheSize         (0),
@@ -125,6 +128,7 @@ SSMBase::SSMBase (const String& aDataManName,
   itsNrRows            (0),
   itsCache             (0),
   itsFile              (0),
+  itsMapped            (0),
   itsStringHandler     (0),
   itsPersCacheSize     (2),
   itsCacheSize         (0),
@@ -166,6 +170,7 @@ SSMBase::SSMBase (const SSMBase& that)
   itsNrRows            (0),
   itsCache             (0),
   itsFile              (0),
+  itsMapped            (0),
   itsStringHandler     (0),
   itsPersCacheSize     (that.itsPersCacheSize),
   itsCacheSize         (0),
@@ -191,6 +196,7 @@ SSMBase::~SSMBase()
     delete itsPtrIndex[i];
   }
   delete itsCache;
+  delete itsMapped;
   delete itsFile;
   delete itsIosFile;
   delete itsStringHandler;
@@ -377,6 +383,26 @@ void SSMBase::makeCache()
     if (forceFill) {
       readIndexBuckets();
     }
+    if (itsFile->isMapped()  &&  !itsFile->isWritable()) {
+      makeMapped();
+    }
+  }
+}
+
+void SSMBase::makeMapped()
+{
+  // The buckets start after the header (of 512 bytes).
+  delete itsMapped;
+  itsMapped = 0;
+  itsMapped = new BucketMapped (itsFile, 512, itsBucketSize, itsNrBuckets);
+}
+
+void SSMBase::clearMapped()
+{
+  delete itsMapped;
+  itsMapped = 0;
+  for (uInt i=0; i<ncolumn(); i++) {
+    itsPtrColumn[i]->resync (itsNrRows);
   }
 }
 
@@ -515,6 +541,11 @@ void SSMBase::writeIndex()
   TypeIO*   aMio;
   MemoryIO  aMemBuf;
 
+  // Bring the zone maps up-to-date, so they are written with the index.
+  for (uInt i=0; i<ncolumn(); i++) {
+    itsPtrColumn[i]->flushZoneMap();
+  }
+
   // Use the file given by the BucketFile object..
   // Use a buffer size (512) equal to start of buckets in the file,
   // so the IO buffers in the different objects do not overlap.
@@ -673,7 +704,7 @@ Bool SSMBase::canRemoveColumn() const
 }
 
 
-void SSMBase::addRow (uInt aNrRows)
+void SSMBase::addRow (rownr_t aNrRows)
 {
   //make sure cache is available and filled (I need itsPtrIndex)
   getCache();
@@ -693,7 +724,7 @@ void SSMBase::addRow (uInt aNrRows)
   isDataChanged = True;
 }
 
-void SSMBase::removeRow (uInt aRowNr)
+void SSMBase::removeRow (rownr_t aRowNr)
 {
   uInt aNrCol = ncolumn();
   for (uInt j=0; j< aNrCol; j++) {
@@ -805,6 +836,7 @@ void SSMBase::addColumn (DataManagerColumn* aColumn)
   }
 
   aSSMC->addRow(itsNrRows,0,aBestFit != -1);
+  aSSMC->activateZoneMap();
   isDataChanged = True;
 }
 
@@ -836,6 +868,7 @@ void SSMBase::removeColumn (DataManagerColumn* aColumn)
       isFound=True;
 
       itsPtrColumn[i]->removeColumn();
+      itsPtrIndex[itsColIndexMap[i]]->removeZoneMap (itsColumnOffset[i]);
 
       // free up space
       Int aNrColumns = itsPtrIndex[itsColIndexMap[i]]->removeColumn
@@ -903,8 +936,8 @@ char* SSMBase::initCallBack (void* anOwner)
   return aBucket;
 }
 
-char* SSMBase::find(uInt aRowNr,     uInt aColNr, 
-		    uInt& aStartRow, uInt& anEndRow)
+char* SSMBase::find(rownr_t aRowNr,     uInt aColNr, 
+		    rownr_t& aStartRow, rownr_t& anEndRow)
 {
  
   // Make sure that cache is available and filled.
@@ -912,16 +945,55 @@ char* SSMBase::find(uInt aRowNr,     uInt aColNr,
   SSMIndex* anIndexPtr = itsPtrIndex[itsColIndexMap[aColNr]];
   uInt aBucketNr;
   anIndexPtr->find(aRowNr,aBucketNr,aStartRow,anEndRow);
+  if (itsMapped != 0) {
+    return const_cast<char*>(itsMapped->getBucket(aBucketNr)) +
+           itsColumnOffset[aColNr];
+  }
   char* aPtr = getBucket(aBucketNr);
   return aPtr + itsColumnOffset[aColNr];
 }
 
 
 
+void SSMBase::setConcurrency (uInt nthreads)
+{
+  getCache();
+  if (itsMapped == 0) {
+    // Another thread can pin a bucket in the same shard, so each shard
+    // needs at least a slot per thread. Resize before setting the shards,
+    // because both clear a sharded cache.
+    if (nthreads > 1) {
+      itsCache->resize (max(itsCacheSize, nthreads*nthreads));
+      itsCache->setConcurrency (nthreads);
+    } else {
+      itsCache->setConcurrency (1);
+      itsCache->resize (itsCacheSize);
+    }
+  }
+}
+
+const char* SSMBase::pinBucket (uInt aBucketNr, uInt aColNr)
+{
+  if (itsMapped != 0) {
+    return itsMapped->getBucket(aBucketNr) + itsColumnOffset[aColNr];
+  }
+  return itsCache->pinBucket(aBucketNr) + itsColumnOffset[aColNr];
+}
+
+void SSMBase::unpinBucket (uInt aBucketNr)
+{
+  if (itsMapped == 0) {
+    itsCache->unpinBucket (aBucketNr);
+  }
+}
+
+
 void SSMBase::recreate()
 {
   delete itsCache;
   itsCache = 0;
+  delete itsMapped;
+  itsMapped = 0;
   delete itsFile;
   itsFile = 0;
   delete itsIosFile;
@@ -988,15 +1060,26 @@ Bool SSMBase::flush (AipsIO& ios, Bool doFsync)
   return changed;
 }
 
-void SSMBase::resync (uInt aNrRows)
+void SSMBase::resync (rownr_t aNrRows)
 {
   itsNrRows = aNrRows;
+  // The file might have been extended by another process, so
+  // reopen the file to remap it.
+  if (itsMapped != 0) {
+    delete itsMapped;
+    itsMapped = 0;
+    itsFile->close();
+    itsFile->open();
+  }
   if (itsPtrIndex.nelements() != 0) {
     readHeader();
   }
   if (itsCache != 0) {
     itsCache->resync (itsNrBuckets, itsFreeBucketsNr, 
 		      itsFirstFreeBucket);
+    if (itsFile->isMapped()  &&  !itsFile->isWritable()) {
+      makeMapped();
+    }
   }
   if (itsPtrIndex.nelements() != 0) {
     readIndexBuckets();
@@ -1014,15 +1097,19 @@ void SSMBase::resync (uInt aNrRows)
   }
 }
 
-void SSMBase::create (uInt aNrRows)
+void SSMBase::create (rownr_t aNrRows)
 {
   init();
   recreate();
   itsNrRows = 0;
   addRow (aNrRows);
+  // Maintain zone maps for the columns of a new table.
+  for (uInt i=0; i<ncolumn(); i++) {
+    itsPtrColumn[i]->activateZoneMap();
+  }
 }
 
-void SSMBase::open (uInt aRowNr, AipsIO& ios)
+void SSMBase::open (rownr_t aRowNr, AipsIO& ios)
 {
   itsNrRows = aRowNr;
   ios.getstart ("SSM");
@@ -1031,8 +1118,13 @@ void SSMBase::open (uInt aRowNr, AipsIO& ios)
   getBlock (ios,itsColIndexMap);
   ios.getend();
   
+  // Memory-mapped IO is only used for readonly tables, because the
+  // file would have to be remapped when it gets extended.
+  // Note that the TSMOption is always Cache if a MultiFile is used.
+  Bool useMapped = (!table().isWritable()  &&
+                    tsmOption().option() == TSMOption::MMap);
   itsFile = new BucketFile (fileName(), table().isWritable(),
-                            0, False, multiFile());
+                            0, useMapped, multiFile());
   AlwaysAssert (itsFile != 0, AipsError);
 
   // Let the column object initialize themselves (if needed)
@@ -1054,6 +1146,10 @@ StManArrayFile* SSMBase::openArrayFile (ByteIO::OpenOption anOpt)
 
 void SSMBase::reopenRW()
 {
+  // Writing cannot be done in the readonly mapped file.
+  if (itsMapped != 0) {
+    clearMapped();
+  }
   if (itsFile != 0) {
     itsFile->setRW();
   }
@@ -39,6 +39,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Forward declarations
 class BucketCache;
 class BucketFile;
+class BucketMapped;
 class StManArrayFile;
 class SSMIndex;
 class SSMColumn;
@@ -82,6 +83,15 @@ class SSMStringHandler;
 // <linkto class=BucketCache>BucketCache</linkto>.
 // It also keeps a list of free buckets. A bucket is freed when it is
 // not needed anymore (e.g. all data from it are deleted).
+// <br>If the table is opened readonly and the
+// <linkto class=TSMOption>TSMOption</linkto> tells to use memory-mapped IO,
+// the data buckets are accessed directly in a memory-mapped file using
+// class <linkto class=BucketMapped>BucketMapped</linkto>. In that case
+// no copies of the data buckets have to be made. Furthermore, if the data
+// are stored in the native endianness, SSMColumn can use the data
+// directly from the mapped file without copying and converting them.
+// When the table is reopened for read/write, the mapped access is
+// switched off.
 // <p>
 // Data buckets form the main part of the SSM. The data can be viewed as
 // a few streams of buckets, where each stream contains the data of
@@ -254,6 +264,18 @@ public:
   
   // Get access to the given Index.
   SSMIndex& getIndex (uInt anIdxNr);
+
+  // Get access to the Index used by the given column.
+  SSMIndex& getColumnIndex (uInt aColNr);
+
+  // Get the offset of the given column in the buckets of its Index.
+  // It is unique within the Index and does not change when the column
+  // is renamed, so it is used to identify the column's zone map.
+  uInt getColumnOffset (uInt aColNr) const;
+
+  // Tell that the index has to be written at the next flush
+  // (used by SSMColumn when its zone map has changed).
+  void setIndexChanged();
   
   // Make the current bucket in the cache dirty (i.e. something has been
   // changed in it and it needs to be written when removed from the cache).
@@ -267,8 +289,31 @@ public:
   // Find the bucket containing the column and row and return the pointer
   // to the beginning of the column data in that bucket.
   // It also fills in the start and end row for the column data.
-  char* find (uInt aRowNr,     uInt aColNr, 
-	      uInt& aStartRow, uInt& anEndRow);
+  // <br>If memory-mapped access is used (see <src>isMapped</src>),
+  // the pointer points into the mapped file, thus should only be used
+  // for reading.
+  char* find (rownr_t aRowNr,     uInt aColNr, 
+	      rownr_t& aStartRow, rownr_t& anEndRow);
+
+  // Prepare the bucket cache for reading by <src>nthreads</src> threads
+  // at the same time using <src>pinBucket</src>. A value of 1 ends it.
+  // The cache is split in a shard per thread and is enlarged (if needed)
+  // to have a slot per thread in each shard. The original cache size is
+  // restored when the concurrent reading ends.
+  // <br>A memory-mapped file can be read concurrently as such.
+  void setConcurrency (uInt nthreads);
+
+  // Get the bucket for reading by one of the concurrent threads and return
+  // the pointer to the beginning of the column data in that bucket.
+  // The bucket stays in the cache until <src>unpinBucket</src> is called.
+  // <group>
+  const char* pinBucket (uInt aBucketNr, uInt aColNr);
+  void unpinBucket (uInt aBucketNr);
+  // </group>
+
+  // Are the data buckets accessed using a memory-mapped file?
+  // It makes sure the file is opened and the index is read.
+  Bool isMapped();
 
   // Add a new bucket and get its bucket number.
   uInt getNewBucket();
@@ -314,15 +359,15 @@ private:
   
   // Let the storage manager create files as needed for a new table.
   // This allows a column with an indirect array to create its file.
-  virtual void create (uInt aNrRows);
+  virtual void create (rownr_t aNrRows);
   
   // Open the storage manager file for an existing table, read in
   // the data, and let the SSMColumn objects read their data.
-  virtual void open (uInt aRowNr, AipsIO&);
+  virtual void open (rownr_t aRowNr, AipsIO&);
   
   // Resync the storage manager with the new file contents.
   // This is done by clearing the cache.
-  virtual void resync (uInt aRowNr);
+  virtual void resync (rownr_t aRowNr);
   
   // Reopen the storage manager files for read/write.
   virtual void reopenRW();
@@ -345,10 +390,10 @@ private:
   
   // Add rows to the storage manager.
   // Per column it extends number of rows.
-  virtual void addRow (uInt aNrRows);
+  virtual void addRow (rownr_t aNrRows);
   
   // Delete a row from all columns.
-  virtual void removeRow (uInt aRowNr);
+  virtual void removeRow (rownr_t aRowNr);
   
   // Do the final addition of a column.
   virtual void addColumn (DataManagerColumn*);
@@ -379,7 +424,15 @@ private:
   BucketCache& getCache();
   
   // Construct the cache object (if not constructed yet).
+  // It also creates the mapped access object if the file is mapped.
   void makeCache();
+
+  // Create the mapped access object for the data buckets.
+  void makeMapped();
+
+  // Remove the mapped access object and invalidate the column caches
+  // (because they can point into the mapped file).
+  void clearMapped();
   
   // Read the header.
   void readHeader();
@@ -415,6 +468,9 @@ private:
   
   // The file containing all data.
   BucketFile*  itsFile;
+
+  // The memory-mapped access to the data buckets (if used).
+  BucketMapped* itsMapped;
   
   // String handler class
   SSMStringHandler* itsStringHandler;
@@ -490,6 +546,12 @@ inline BucketCache& SSMBase::getCache()
   return *itsCache;
 }
 
+inline Bool SSMBase::isMapped()
+{
+  getCache();
+  return itsMapped != 0;
+}
+
 inline SSMColumn& SSMBase::getColumn (uInt aColNr)
 {
   return *(itsPtrColumn[aColNr]);
@@ -500,6 +562,22 @@ inline SSMIndex& SSMBase::getIndex (uInt anIdxNr)
   return *(itsPtrIndex[anIdxNr]);
 }
 
+inline SSMIndex& SSMBase::getColumnIndex (uInt aColNr)
+{
+  getCache();
+  return *(itsPtrIndex[itsColIndexMap[aColNr]]);
+}
+
+inline uInt SSMBase::getColumnOffset (uInt aColNr) const
+{
+  return itsColumnOffset[aColNr];
+}
+
+inline void SSMBase::setIndexChanged()
+{
+  isDataChanged = True;
+}
+
 inline SSMStringHandler* SSMBase::getStringHandler()
 {
   return itsStringHandler;
@@ -27,7 +27,9 @@
 
 #include <casacore/tables/DataMan/SSMColumn.h>
 #include <casacore/tables/DataMan/SSMBase.h>
+#include <casacore/tables/DataMan/SSMIndex.h>
 #include <casacore/tables/DataMan/SSMStringHandler.h>
+#include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/RefRows.h>
 #include <casacore/casa/Arrays/Array.h>
 #include <casacore/casa/Arrays/Vector.h>
@@ -37,6 +39,7 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/LECanonicalConversion.h>
+#include <casacore/casa/OS/HostInfo.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -50,7 +53,9 @@ SSMColumn::SSMColumn (SSMBase* aParent, int aDataType, uInt aColNr)
   itsMaxLen      (0),
   itsNrElem      (1),
   itsNrCopy      (0),
-  itsData        (0)
+  itsData        (0),
+  itsMapAlign    (0),
+  itsZoneMapInit (False)
 {
   init();
 }
@@ -73,33 +78,36 @@ void SSMColumn::setMaxLength (uInt maxLength)
     init();
 }
 
-uInt SSMColumn::ndim (uInt)
+uInt SSMColumn::ndim (rownr_t)
 {
     return itsShape.nelements();
 }
 
-IPosition SSMColumn::shape (uInt)
+IPosition SSMColumn::shape (rownr_t)
 {
     return itsShape;
 }
 
-void SSMColumn::doCreate(uInt)
+void SSMColumn::doCreate(rownr_t)
 {
 }
 
-void SSMColumn::getFile(uInt)
+void SSMColumn::getFile(rownr_t)
 {
 }
 
-void SSMColumn::addRow (uInt aNewNrRows, uInt, Bool doInit)
+void SSMColumn::addRow (rownr_t aNewNrRows, rownr_t anOldNrRows, Bool doInit)
 {
+  if (aNewNrRows > anOldNrRows) {
+    setZoneMapChanged (anOldNrRows, aNewNrRows-1);
+  }
   if (doInit  &&  dataType() == TpString) {
-    uInt aRowNr=0;
-    uInt aNrRows=aNewNrRows;
+    rownr_t aRowNr=0;
+    rownr_t aNrRows=aNewNrRows;
     
     while (aNrRows > 0) {
-      uInt  aStartRow;
-      uInt  anEndRow;
+      rownr_t  aStartRow;
+      rownr_t  anEndRow;
       char* aValPtr;
       aValPtr = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
       aRowNr = anEndRow+1;
@@ -111,13 +119,16 @@ void SSMColumn::addRow (uInt aNewNrRows, uInt, Bool doInit)
   }
 }
 
-void SSMColumn::deleteRow(uInt aRowNr)
+void SSMColumn::deleteRow(rownr_t aRowNr)
 {
   char* aValue;
-  uInt  aSRow;
-  uInt  anERow;
+  rownr_t  aSRow;
+  rownr_t  anERow;
   int aDT = dataType();
 
+  // All rows thereafter shift.
+  setZoneMapChanged (aRowNr, itsSSMPtr->getNRow());
+
   if (aDT == TpString  &&  itsMaxLen == 0) {
     Int buf[3];
     getRowValue(buf, aRowNr);
@@ -142,8 +153,8 @@ void SSMColumn::deleteRow(uInt aRowNr)
 
   // first check if aRowNr is in cache, if not, fill cache
   // In both cases remove row from cache
-  uInt  aStartRow = columnCache().start();
-  uInt  anEndRow  = columnCache().end();
+  rownr_t  aStartRow = columnCache().start();
+  rownr_t  anEndRow  = columnCache().end();
 
   // Remove from cache if needed
   if (aRowNr >= aStartRow  &&  aRowNr <= anEndRow) {
@@ -179,7 +190,7 @@ void SSMColumn::deleteRow(uInt aRowNr)
   }
 }
 
-void SSMColumn::shiftRows(char* aValue, uInt aRowNr, uInt aSRow, uInt anERow)
+void SSMColumn::shiftRows(char* aValue, rownr_t aRowNr, rownr_t aSRow, rownr_t anERow)
 {
   // Shift from aRrowNr on 1 to the left.
   char* aToPtr = aValue + (aRowNr-aSRow) * itsExternalSizeBytes;
@@ -191,59 +202,69 @@ void SSMColumn::shiftRows(char* aValue, uInt aRowNr, uInt aSRow, uInt anERow)
 }
 
 
-void SSMColumn::getBoolV (uInt aRowNr, Bool* aValue)
+void SSMColumn::getBoolV (rownr_t aRowNr, Bool* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<Bool*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const Bool*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
-void SSMColumn::getuCharV (uInt aRowNr, uChar* aValue)
+void SSMColumn::getuCharV (rownr_t aRowNr, uChar* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<uChar*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const uChar*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
-void SSMColumn::getShortV (uInt aRowNr, Short* aValue)
+void SSMColumn::getShortV (rownr_t aRowNr, Short* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<Short*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const Short*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
-void SSMColumn::getuShortV (uInt aRowNr, uShort* aValue)
+void SSMColumn::getuShortV (rownr_t aRowNr, uShort* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<uShort*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const uShort*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
-void SSMColumn::getIntV (uInt aRowNr, Int* aValue)
+void SSMColumn::getIntV (rownr_t aRowNr, Int* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<Int*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const Int*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
-void SSMColumn::getuIntV (uInt aRowNr, uInt* aValue)
+void SSMColumn::getuIntV (rownr_t aRowNr, uInt* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<uInt*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const uInt*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
-void SSMColumn::getfloatV (uInt aRowNr, float* aValue)
+void SSMColumn::getfloatV (rownr_t aRowNr, float* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<float*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const float*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
-void SSMColumn::getdoubleV (uInt aRowNr, double* aValue)
+void SSMColumn::getdoubleV (rownr_t aRowNr, double* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<double*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const double*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
-void SSMColumn::getComplexV (uInt aRowNr, Complex* aValue)
+void SSMColumn::getComplexV (rownr_t aRowNr, Complex* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<Complex*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const Complex*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
 
-void SSMColumn::getDComplexV (uInt aRowNr,DComplex* aValue)
+void SSMColumn::getDComplexV (rownr_t aRowNr,DComplex* aValue)
 {
   getValue(aRowNr);
-  *aValue = static_cast<DComplex*>(itsData)[aRowNr-columnCache().start()];
+  *aValue = static_cast<const DComplex*>(columnCache().dataPtr())
+              [aRowNr-columnCache().start()];
 }
 
-void SSMColumn::getStringV (uInt aRowNr, String* aValue)
+void SSMColumn::getStringV (rownr_t aRowNr, String* aValue)
 {
   if (itsMaxLen > 0) {
     // Allocate the maximum number of characters needed
@@ -251,8 +272,8 @@ void SSMColumn::getStringV (uInt aRowNr, String* aValue)
     // Should be changed to use real Char*
     aValue->alloc(itsMaxLen+1);
     char* sp = const_cast<char*>(aValue->chars());
-    uInt  aStartRow;
-    uInt  anEndRow;
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* buf = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
     itsReadFunc (sp, buf+(aRowNr-aStartRow)*itsExternalSizeBytes,
 		 itsNrCopy);
@@ -288,10 +309,10 @@ void SSMColumn::getStringV (uInt aRowNr, String* aValue)
   }
 }
 
-Char* SSMColumn::getRowValue(Int* data, uInt aRowNr)
+Char* SSMColumn::getRowValue(Int* data, rownr_t aRowNr)
 {
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aValue;
   aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
   itsReadFunc (data, aValue+(aRowNr-aStartRow)*itsExternalSizeBytes,
@@ -299,22 +320,70 @@ Char* SSMColumn::getRowValue(Int* data, uInt aRowNr)
   return aValue+(aRowNr-aStartRow)*itsExternalSizeBytes;
 }
 
-void SSMColumn::getValue(uInt aRowNr)
+void SSMColumn::getValue(rownr_t aRowNr)
 {
   if (aRowNr < columnCache().start()  ||  aRowNr > columnCache().end()) {
-    uInt  aStartRow;
-    uInt  anEndRow;
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* aValue;
     aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
-    itsReadFunc (getDataPtr(), aValue, (anEndRow-aStartRow+1) * itsNrCopy);
-    columnCache().set (aStartRow, anEndRow, getDataPtr());
+    // If the data in a memory-mapped file are in local format and properly
+    // aligned, they can be used directly.
+    if (itsMapAlign > 0  &&  itsSSMPtr->isMapped()
+    &&  (reinterpret_cast<std::size_t>(aValue) % itsMapAlign) == 0) {
+      columnCache().set (aStartRow, anEndRow, aValue);
+    } else {
+      itsReadFunc (getDataPtr(), aValue, (anEndRow-aStartRow+1) * itsNrCopy);
+      columnCache().set (aStartRow, anEndRow, getDataPtr());
+    }
+  }
+}
+
+Bool SSMColumn::prepareConcurrentGet (uInt nthreads)
+{
+  if (itsNrElem != 1  ||  dataType() == TpString) {
+    return False;
+  }
+  itsSSMPtr->setConcurrency (nthreads);
+  return True;
+}
+
+void SSMColumn::getScalarCellsConcurrentV (const rownr_t* rownrs, size_t nrow,
+                                           void* dataPtr) const
+{
+  char* to = static_cast<char*>(dataPtr);
+  const SSMIndex& anIndex = itsSSMPtr->getColumnIndex (itsColNr);
+  size_t i = 0;
+  while (i < nrow) {
+    uInt aBucketNr;
+    rownr_t aStartRow;
+    rownr_t anEndRow;
+    anIndex.find (rownrs[i], aBucketNr, aStartRow, anEndRow);
+    const char* aValue = itsSSMPtr->pinBucket (aBucketNr, itsColNr);
+    // Convert the consecutive rows in this bucket in one go.
+    do {
+      size_t n = 1;
+      while (i+n < nrow  &&  rownrs[i+n] == rownrs[i]+n
+             &&  rownrs[i+n] <= anEndRow) {
+        n++;
+      }
+      rownr_t anOff = rownrs[i] - aStartRow;
+      if (dataType() == TpBool) {
+        Conversion::bitToBool (to + i*itsLocalSize, aValue, anOff, n);
+      } else {
+        itsReadFunc (to + i*itsLocalSize, aValue + anOff*itsExternalSizeBytes,
+                     n*itsNrCopy);
+      }
+      i += n;
+    } while (i < nrow  &&  rownrs[i] >= aStartRow  &&  rownrs[i] <= anEndRow);
+    itsSSMPtr->unpinBucket (aBucketNr);
   }
 }
 
-void SSMColumn::putBoolV (uInt aRowNr, const Bool* aValue)
+void SSMColumn::putBoolV (rownr_t aRowNr, const Bool* aValue)
 {
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aDummy;
 
   aDummy = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
@@ -330,7 +399,7 @@ void SSMColumn::putBoolV (uInt aRowNr, const Bool* aValue)
       *aValue;
   }
 }
-void SSMColumn::putuCharV (uInt aRowNr, const uChar* aValue)
+void SSMColumn::putuCharV (rownr_t aRowNr, const uChar* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -338,7 +407,7 @@ void SSMColumn::putuCharV (uInt aRowNr, const uChar* aValue)
       *aValue;
   }
 }
-void SSMColumn::putShortV (uInt aRowNr, const Short* aValue)
+void SSMColumn::putShortV (rownr_t aRowNr, const Short* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -346,7 +415,7 @@ void SSMColumn::putShortV (uInt aRowNr, const Short* aValue)
       *aValue;
   }
 }
-void SSMColumn::putuShortV (uInt aRowNr, const uShort* aValue)
+void SSMColumn::putuShortV (rownr_t aRowNr, const uShort* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -354,7 +423,7 @@ void SSMColumn::putuShortV (uInt aRowNr, const uShort* aValue)
       *aValue;
   }
 }
-void SSMColumn::putIntV (uInt aRowNr, const Int* aValue)
+void SSMColumn::putIntV (rownr_t aRowNr, const Int* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -362,7 +431,7 @@ void SSMColumn::putIntV (uInt aRowNr, const Int* aValue)
       *aValue;
   }
 }
-void SSMColumn::putuIntV (uInt aRowNr, const uInt* aValue)
+void SSMColumn::putuIntV (rownr_t aRowNr, const uInt* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -370,7 +439,7 @@ void SSMColumn::putuIntV (uInt aRowNr, const uInt* aValue)
       *aValue;
   }
 }
-void SSMColumn::putfloatV (uInt aRowNr, const float* aValue)
+void SSMColumn::putfloatV (rownr_t aRowNr, const float* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -378,7 +447,7 @@ void SSMColumn::putfloatV (uInt aRowNr, const float* aValue)
       *aValue;
   }
 }
-void SSMColumn::putdoubleV (uInt aRowNr, const double* aValue)
+void SSMColumn::putdoubleV (rownr_t aRowNr, const double* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -386,7 +455,7 @@ void SSMColumn::putdoubleV (uInt aRowNr, const double* aValue)
       *aValue;
   }
 }
-void SSMColumn::putComplexV (uInt aRowNr, const Complex* aValue)
+void SSMColumn::putComplexV (rownr_t aRowNr, const Complex* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -395,7 +464,7 @@ void SSMColumn::putComplexV (uInt aRowNr, const Complex* aValue)
   }
 }
 
-void SSMColumn::putDComplexV (uInt aRowNr, const DComplex* aValue)
+void SSMColumn::putDComplexV (rownr_t aRowNr, const DComplex* aValue)
 {
   putValue(aRowNr,aValue);
   if (aRowNr >= columnCache().start()  &&  aRowNr <= columnCache().end()) {
@@ -404,12 +473,12 @@ void SSMColumn::putDComplexV (uInt aRowNr, const DComplex* aValue)
   }
 }
 
-void SSMColumn::putStringV (uInt aRowNr, const String* aValue)
+void SSMColumn::putStringV (rownr_t aRowNr, const String* aValue)
 {
   // Fixed length strings are written directly.
   if (itsMaxLen > 0) {
-    uInt  aStartRow;
-    uInt  anEndRow;
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* aDummy = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
     itsWriteFunc (aDummy+(aRowNr-aStartRow)*itsExternalSizeBytes,
 		  aValue->chars(), min(itsMaxLen, aValue->length()+1));
@@ -444,21 +513,22 @@ void SSMColumn::putStringV (uInt aRowNr, const String* aValue)
   }
 }
 
-void SSMColumn::putValue(uInt aRowNr, const void* aValue)
+void SSMColumn::putValue(rownr_t aRowNr, const void* aValue)
 {
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aDummy = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
   itsWriteFunc (aDummy+(aRowNr-aStartRow)*itsExternalSizeBytes,
   		aValue, itsNrCopy);
   itsSSMPtr->setBucketDirty();
+  setZoneMapChanged (aRowNr, aRowNr);
 }
 
-void SSMColumn::putValueShortString(uInt aRowNr, const void* aValue,
+void SSMColumn::putValueShortString(rownr_t aRowNr, const void* aValue,
 				    const String& string)
 {
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aDummy;
 
   aDummy = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
@@ -558,15 +628,15 @@ void SSMColumn::getScalarColumnStringV (Vector<String>* aDataPtr)
   }
 }
 
-void SSMColumn::getColumnValue(void* anArray,uInt aNrRows)
+void SSMColumn::getColumnValue(void* anArray,rownr_t aNrRows)
 {
   char* aDataPtr = static_cast<char*>(anArray);
-  uInt aRowNr=0;
+  rownr_t aRowNr=0;
   Int rowsToDo = aNrRows;
   
   while (rowsToDo > 0) {
-    uInt  aStartRow;
-    uInt  anEndRow;
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* aValue;
     aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
     aRowNr = anEndRow+1;
@@ -664,15 +734,15 @@ void SSMColumn::putScalarColumnStringV (const Vector<String>* aDataPtr)
   }
 }
 
-void SSMColumn::putColumnValue(const void* anArray,uInt aNrRows)
+void SSMColumn::putColumnValue(const void* anArray,rownr_t aNrRows)
 {
   const char* aDataPtr = static_cast<const char*>(anArray);
-  uInt aRowNr=0;
+  rownr_t aRowNr=0;
   Int rowsToDo=aNrRows;
 
   while (rowsToDo > 0) {
-    uInt  aStartRow;
-    uInt  anEndRow;
+    rownr_t  aStartRow;
+    rownr_t  anEndRow;
     char* aValPtr;
     aValPtr = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
     aRowNr = anEndRow+1;
@@ -685,6 +755,9 @@ void SSMColumn::putColumnValue(const void* anArray,uInt aNrRows)
 
   // Be sure cache will be emptied
   columnCache().invalidate();
+  if (aNrRows > 0) {
+    setZoneMapChanged (0, aNrRows-1);
+  }
 }
 
 void SSMColumn::removeColumn()
@@ -744,12 +817,119 @@ void SSMColumn::init()
     itsLocalSize         *= itsNrElem;
     itsExternalSizeBits   = 8*itsExternalSizeBytes;
   }
+  // Determine if the data in a mapped file can be used directly.
+  // That is the case for numeric data in local format.
+  // Note that complex values are aligned as their parts.
+  itsMapAlign = 0;
+  if (aDT != TpString  &&  aDT != TpBool
+  &&  asBigEndian == HostInfo::bigEndian()
+  &&  itsExternalSizeBytes == itsLocalSize) {
+    itsMapAlign = ValType::getTypeSize(aDT);
+    if (aDT == TpComplex  ||  aDT == TpDComplex) {
+      itsMapAlign /= 2;
+    }
+  }
 }
 
-void SSMColumn::resync (uInt)
+void SSMColumn::resync (rownr_t)
 {
     // Invalidate the last value read.
     columnCache().invalidate();
+    // The zone map has to be read again from the index.
+    itsZoneMapInit = False;
+}
+
+Bool SSMColumn::canHaveZoneMap() const
+{
+  return StManZoneMap::isSupported (DataType(dataType()));
+}
+
+void SSMColumn::activateZoneMap()
+{
+  if (canHaveZoneMap()) {
+    itsZoneMap.activate();
+    itsZoneMapInit = True;
+  }
+}
+
+void SSMColumn::initZoneMap()
+{
+  // Get the possibly existing zone map from the index.
+  if (!itsZoneMapInit) {
+    itsZoneMap = StManZoneMap();
+    if (canHaveZoneMap()) {
+      itsSSMPtr->getColumnIndex(itsColNr).getZoneMap
+                               (itsSSMPtr->getColumnOffset(itsColNr), itsZoneMap);
+    }
+    itsZoneMapInit = True;
+  }
+}
+
+void SSMColumn::setZoneMapChanged (rownr_t aStartRow, rownr_t anEndRow)
+{
+  initZoneMap();
+  itsZoneMap.setChanged (aStartRow, anEndRow);
+}
+
+void SSMColumn::updateZoneMap()
+{
+  if (itsZoneMap.hasChanged()) {
+    Vector<rownr_t> aStartRows =
+      itsSSMPtr->getColumnIndex(itsColNr).getStartRows();
+    Vector<uInt> aZones = itsZoneMap.update (aStartRows,
+                                             itsSSMPtr->getNRow());
+    // Read the data of each changed zone (which is a bucket).
+    DataType aDT = DataType(dataType());
+    Block<char> aBuf;
+    for (uInt i=0; i<aZones.size(); i++) {
+      rownr_t aStartRow;
+      rownr_t anEndRow;
+      char* aValue = itsSSMPtr->find (aStartRows[aZones[i]], itsColNr,
+                                      aStartRow, anEndRow);
+      uInt aNr = anEndRow-aStartRow+1;
+      aBuf.resize (aNr * itsLocalSize, False, False);
+      itsReadFunc (aBuf.storage(), aValue, aNr * itsNrCopy);
+      Double aMin, aMax;
+      StManZoneMap::minMax (aMin, aMax, aBuf.storage(), aNr, aDT);
+      itsZoneMap.setZone (aZones[i], aMin, aMax);
+    }
+  }
+}
+
+Bool SSMColumn::getZoneMap (Vector<rownr_t>& startRows,
+                            Vector<Double>& minValues,
+                            Vector<Double>& maxValues)
+{
+  if (!canHaveZoneMap()) {
+    return False;
+  }
+  initZoneMap();
+  if (! itsZoneMap.isActive()) {
+    activateZoneMap();
+  }
+  if (itsZoneMap.hasChanged()) {
+    updateZoneMap();
+    // Write the new zone map when the table is flushed.
+    if (itsSSMPtr->table().isWritable()) {
+      itsSSMPtr->setIndexChanged();
+    }
+  }
+  itsZoneMap.getZones (startRows, minValues, maxValues);
+  return True;
+}
+
+void SSMColumn::flushZoneMap()
+{
+  if (itsZoneMapInit) {
+    if (itsZoneMap.isActive()) {
+      updateZoneMap();
+      itsSSMPtr->getColumnIndex(itsColNr).setZoneMap
+                               (itsSSMPtr->getColumnOffset(itsColNr), itsZoneMap);
+    } else {
+      itsSSMPtr->getColumnIndex(itsColNr).removeZoneMap
+                               (itsSSMPtr->getColumnOffset(itsColNr));
+    }
+  }
 }
 
 } //# NAMESPACE CASACORE - END
@@ -33,6 +33,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/StManColumn.h>
 #include <casacore/tables/DataMan/SSMBase.h>
+#include <casacore/tables/DataMan/StManZoneMap.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/OS/Conversion.h>
@@ -89,6 +90,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 // This cache is used by the higher level table classes to get faster
 // read access to the data.
 // The cache is not used for strings, because they are stored differently.
+// <br>If SSMBase uses a memory-mapped file, the cache refers directly to
+// the data in the mapped file if the data do not need to be converted.
+// In that way no copy of the data needs to be made.
 // </synopsis> 
 
 //# <todo asof="$DATE:$">
@@ -117,51 +121,51 @@ public:
   virtual void setMaxLength (uInt maxLength);
 
   // Get the dimensionality of the item in the given row.
-  virtual uInt ndim (uInt aRowNr);
+  virtual uInt ndim (rownr_t aRowNr);
   
   // Get the shape of the array in the given row.
-  virtual IPosition shape (uInt aRowNr);
+  virtual IPosition shape (rownr_t aRowNr);
   
   // Let the object initialize itself for a newly created table.
   // It is meant for a derived class.
-  virtual void doCreate (uInt aNrRows);
+  virtual void doCreate (rownr_t aNrRows);
 
   // Let the column object initialize itself for an existing table
-  virtual void getFile (uInt aNrRows);
+  virtual void getFile (rownr_t aNrRows);
 
   // Resync the storage manager with the new file contents.
   // It resets the last rownr put.
-  void resync (uInt aNrRow);
+  void resync (rownr_t aNrRow);
   
   // Get the scalar value in the given row.
   // <group>
-  virtual void getBoolV     (uInt aRowNr, Bool* aDataPtr);
-  virtual void getuCharV    (uInt aRowNr, uChar* aDataPtr);
-  virtual void getShortV    (uInt aRowNr, Short* aDataPtr);
-  virtual void getuShortV   (uInt aRowNr, uShort* aDataPtr);
-  virtual void getIntV      (uInt aRowNr, Int* aDataPtr);
-  virtual void getuIntV     (uInt aRowNr, uInt* aDataPtr);
-  virtual void getfloatV    (uInt aRowNr, float* aDataPtr);
-  virtual void getdoubleV   (uInt aRowNr, double* aDataPtr);
-  virtual void getComplexV  (uInt aRowNr, Complex* aDataPtr);
-  virtual void getDComplexV (uInt aRowNr, DComplex* aDataPtr);
-  virtual void getStringV   (uInt aRowNr, String* aDataPtr);
+  virtual void getBoolV     (rownr_t aRowNr, Bool* aDataPtr);
+  virtual void getuCharV    (rownr_t aRowNr, uChar* aDataPtr);
+  virtual void getShortV    (rownr_t aRowNr, Short* aDataPtr);
+  virtual void getuShortV   (rownr_t aRowNr, uShort* aDataPtr);
+  virtual void getIntV      (rownr_t aRowNr, Int* aDataPtr);
+  virtual void getuIntV     (rownr_t aRowNr, uInt* aDataPtr);
+  virtual void getfloatV    (rownr_t aRowNr, float* aDataPtr);
+  virtual void getdoubleV   (rownr_t aRowNr, double* aDataPtr);
+  virtual void getComplexV  (rownr_t aRowNr, Complex* aDataPtr);
+  virtual void getDComplexV (rownr_t aRowNr, DComplex* aDataPtr);
+  virtual void getStringV   (rownr_t aRowNr, String* aDataPtr);
   // </group>
   
   // Put the scalar value in the given row.
   // It updates the cache if the row is contained in the cache.
   // <group>
-  virtual void putBoolV     (uInt aRowNr, const Bool* aDataPtr);
-  virtual void putuCharV    (uInt aRowNr, const uChar* aDataPtr);
-  virtual void putShortV    (uInt aRowNr, const Short* aDataPtr);
-  virtual void putuShortV   (uInt aRowNr, const uShort* aDataPtr);
-  virtual void putIntV      (uInt aRowNr, const Int* aDataPtr);
-  virtual void putuIntV     (uInt aRowNr, const uInt* aDataPtr);
-  virtual void putfloatV    (uInt aRowNr, const float* aDataPtr);
-  virtual void putdoubleV   (uInt aRowNr, const double* aDataPtr);
-  virtual void putComplexV  (uInt aRowNr, const Complex* aDataPtr);
-  virtual void putDComplexV (uInt aRowNr, const DComplex* aDataPtr);
-  virtual void putStringV   (uInt aRowNr, const String* aDataPtr);
+  virtual void putBoolV     (rownr_t aRowNr, const Bool* aDataPtr);
+  virtual void putuCharV    (rownr_t aRowNr, const uChar* aDataPtr);
+  virtual void putShortV    (rownr_t aRowNr, const Short* aDataPtr);
+  virtual void putuShortV   (rownr_t aRowNr, const uShort* aDataPtr);
+  virtual void putIntV      (rownr_t aRowNr, const Int* aDataPtr);
+  virtual void putuIntV     (rownr_t aRowNr, const uInt* aDataPtr);
+  virtual void putfloatV    (rownr_t aRowNr, const float* aDataPtr);
+  virtual void putdoubleV   (rownr_t aRowNr, const double* aDataPtr);
+  virtual void putComplexV  (rownr_t aRowNr, const Complex* aDataPtr);
+  virtual void putDComplexV (rownr_t aRowNr, const DComplex* aDataPtr);
+  virtual void putStringV   (rownr_t aRowNr, const String* aDataPtr);
   // </group>
   
   // Get the scalar values of the entire column.
@@ -197,11 +201,11 @@ public:
   
   // Add (NewNrRows-OldNrRows) rows to the Column and initialize
   // the new rows when needed.
-  virtual void addRow (uInt aNewNrRows, uInt anOldNrRows, Bool doInit);
+  virtual void addRow (rownr_t aNewNrRows, rownr_t anOldNrRows, Bool doInit);
 
   // Remove the given row from the data bucket and possibly string bucket.
   // If needed, it also removes it from the cache.
-  virtual void deleteRow (uInt aRowNr);
+  virtual void deleteRow (rownr_t aRowNr);
 
   // Get the size of the dataType in bytes!!
   uInt getExternalSizeBytes() const;
@@ -219,35 +223,75 @@ public:
   // as is the case with Strings, it can be done here.
   void removeColumn();
 
+  // Get the zone map (minimum and maximum value per bucket) of the column.
+  // It is only possible for numeric scalar columns.
+  // If the column does not have a zone map yet, it is made and maintained
+  // thereafter.
+  virtual Bool getZoneMap (Vector<rownr_t>& startRows,
+                           Vector<Double>& minValues,
+                           Vector<Double>& maxValues);
+
+  // Prepare the storage manager for reading the column by multiple threads.
+  // It is possible for scalar columns with a fixed size data type, thus
+  // not for String columns.
+  virtual Bool prepareConcurrentGet (uInt nthreads);
+
+  // Get the values in the given rows by one of the concurrent threads.
+  // The buckets are pinned in the cache and the values are converted
+  // directly into the buffer, thus the column cache is not used.
+  virtual void getScalarCellsConcurrentV (const rownr_t* rownrs, size_t nrow,
+                                          void* dataPtr) const;
+
+  // Maintain a zone map for the column (if possible).
+  // It is used for the columns of a new table.
+  void activateZoneMap();
+
+  // Bring the zone map (if maintained) up-to-date and store it in the
+  // index, so it is written with the index.
+  void flushZoneMap();
+
 protected:
+  // Can the column have a zone map?
+  // By default it can if it has a numeric data type.
+  virtual Bool canHaveZoneMap() const;
+
+  // Get the zone map from the index (if not done yet).
+  void initZoneMap();
+
+  // Mark the given rows as changed in the zone map.
+  void setZoneMapChanged (rownr_t aStartRow, rownr_t anEndRow);
+
+  // Calculate the zones with changed rows.
+  void updateZoneMap();
+
   // Shift the rows in the bucket one to the left when removing the given row.
-  void shiftRows (char* aValue, uInt rowNr, uInt startRow, uInt endRow);
+  void shiftRows (char* aValue, rownr_t rowNr, rownr_t startRow, rownr_t endRow);
 
   // Fill the cache with data of the bucket containing the given row.
-  void getValue (uInt aRowNr);
+  void getValue (rownr_t aRowNr);
   
   // Get the bucketnr, offset, and length of a variable length string.
   // <src>data</src> must have 3 Ints to hold the values.
   // It returns a pointer to the data in the bucket, which can be used
   // for the case that the data bucket contains the (short) string.
-  Char* getRowValue (Int* data, uInt aRowNr);
+  Char* getRowValue (Int* data, rownr_t aRowNr);
     
   // Put the given value for the row into the correct data bucket.
-  void putValue (uInt aRowNr, const void* aValue);
+  void putValue (rownr_t aRowNr, const void* aValue);
 
   // Put the given string for the row into the correct data bucket.
   // The argument <src>aValue></src> must be 3 Ints (for bucketnr, offset,
   // and length). Only the length is actually used.
-  void putValueShortString (uInt aRowNr, const void* aValue,
+  void putValueShortString (rownr_t aRowNr, const void* aValue,
 			    const String& string);
   
   // Get the values for the entire column.
   // The data from all buckets is copied to the array.
-  void getColumnValue (void* anArray, uInt aNrRows);
+  void getColumnValue (void* anArray, rownr_t aNrRows);
   
   // Put the values from the array in the entire column.
   // Each data bucket is filled with the the appropriate part of the array.
-  void putColumnValue (const void* anArray, uInt aNrRows);
+  void putColumnValue (const void* anArray, rownr_t aNrRows);
 
 
   // Pointer to the parent storage manager.
@@ -271,10 +315,18 @@ protected:
   uInt              itsLocalSize;
   // The data in local format.
   void*             itsData;
+  // The alignment needed to use the data directly from a memory-mapped
+  // file. It is 0 if the data need to be converted (e.g. other endianness
+  // or Bool values stored as bits).
+  uInt              itsMapAlign;
   // Pointer to a convert function for writing.
   Conversion::ValueFunction* itsWriteFunc;
   // Pointer to a convert function for reading.
   Conversion::ValueFunction* itsReadFunc;
+  // The zone map of the column.
+  StManZoneMap      itsZoneMap;
+  // Has the zone map been initialized from the index?
+  Bool              itsZoneMapInit;
   
 private:
   // Forbid copy constructor.
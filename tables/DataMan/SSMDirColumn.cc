@@ -44,11 +44,16 @@ SSMDirColumn::~SSMDirColumn()
 void SSMDirColumn::setMaxLength (uInt)
 {}
 
-void SSMDirColumn::deleteRow(uInt aRowNr)
+Bool SSMDirColumn::canHaveZoneMap() const
+{
+  return False;
+}
+
+void SSMDirColumn::deleteRow(rownr_t aRowNr)
 {
   char* aValue;
-  uInt  aSRow;
-  uInt  anERow;
+  rownr_t  aSRow;
+  rownr_t  anERow;
   aValue = itsSSMPtr->find (aRowNr, itsColNr, aSRow, anERow);
   
   if (aRowNr < anERow) {
@@ -73,12 +78,12 @@ void SSMDirColumn::deleteRow(uInt aRowNr)
   }
 }
 
-void SSMDirColumn::getArrayBoolV     (uInt aRowNr, 
+void SSMDirColumn::getArrayBoolV     (rownr_t aRowNr, 
 				      Array<Bool>* aDataPtr)
 {
   Bool deleteIt;
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aValue;
 
   Bool* data = aDataPtr->getStorage (deleteIt);
@@ -92,7 +97,7 @@ void SSMDirColumn::getArrayBoolV     (uInt aRowNr,
   aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArrayuCharV    (uInt aRowNr, 
+void SSMDirColumn::getArrayuCharV    (rownr_t aRowNr, 
 				      Array<uChar>* aDataPtr)
 {
     Bool deleteIt;
@@ -101,7 +106,7 @@ void SSMDirColumn::getArrayuCharV    (uInt aRowNr,
     aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArrayShortV    (uInt aRowNr,
+void SSMDirColumn::getArrayShortV    (rownr_t aRowNr,
 				      Array<Short>* aDataPtr)
 {
     Bool deleteIt;
@@ -110,7 +115,7 @@ void SSMDirColumn::getArrayShortV    (uInt aRowNr,
     aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArrayuShortV   (uInt aRowNr,
+void SSMDirColumn::getArrayuShortV   (rownr_t aRowNr,
 				      Array<uShort>* aDataPtr)
 {
     Bool deleteIt;
@@ -119,7 +124,7 @@ void SSMDirColumn::getArrayuShortV   (uInt aRowNr,
     aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArrayIntV      (uInt aRowNr,
+void SSMDirColumn::getArrayIntV      (rownr_t aRowNr,
 				      Array<Int>* aDataPtr)
 {
     Bool deleteIt;
@@ -128,7 +133,7 @@ void SSMDirColumn::getArrayIntV      (uInt aRowNr,
     aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArrayuIntV     (uInt aRowNr,
+void SSMDirColumn::getArrayuIntV     (rownr_t aRowNr,
 				      Array<uInt>* aDataPtr)
 {
     Bool deleteIt;
@@ -137,7 +142,7 @@ void SSMDirColumn::getArrayuIntV     (uInt aRowNr,
     aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArrayfloatV    (uInt aRowNr,
+void SSMDirColumn::getArrayfloatV    (rownr_t aRowNr,
 				      Array<float>* aDataPtr)
 {
     Bool deleteIt;
@@ -146,7 +151,7 @@ void SSMDirColumn::getArrayfloatV    (uInt aRowNr,
     aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArraydoubleV   (uInt aRowNr,
+void SSMDirColumn::getArraydoubleV   (rownr_t aRowNr,
 				      Array<double>* aDataPtr)
 {
     Bool deleteIt;
@@ -155,7 +160,7 @@ void SSMDirColumn::getArraydoubleV   (uInt aRowNr,
     aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArrayComplexV  (uInt aRowNr,
+void SSMDirColumn::getArrayComplexV  (rownr_t aRowNr,
 				      Array<Complex>* aDataPtr)
 {
     Bool deleteIt;
@@ -164,7 +169,7 @@ void SSMDirColumn::getArrayComplexV  (uInt aRowNr,
     aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArrayDComplexV (uInt aRowNr,
+void SSMDirColumn::getArrayDComplexV (rownr_t aRowNr,
 				      Array<DComplex>* aDataPtr)
 {
     Bool deleteIt;
@@ -173,7 +178,7 @@ void SSMDirColumn::getArrayDComplexV (uInt aRowNr,
     aDataPtr->putStorage (data, deleteIt);
 }
 
-void SSMDirColumn::getArrayStringV (uInt aRowNr,
+void SSMDirColumn::getArrayStringV (rownr_t aRowNr,
 				    Array<String>* aDataPtr)
 {
   Int buf[3];
@@ -181,24 +186,24 @@ void SSMDirColumn::getArrayStringV (uInt aRowNr,
   itsSSMPtr->getStringHandler()->get(*aDataPtr, buf[0], buf[1], buf[2],False);
 }
 
-void SSMDirColumn::getValue(uInt aRowNr, void* data)
+void SSMDirColumn::getValue(rownr_t aRowNr, void* data)
 {
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aValue;
   aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
   itsReadFunc (data, aValue+(aRowNr-aStartRow)*itsExternalSizeBytes,
 	       itsNrCopy);
 }
 
-void SSMDirColumn::putArrayBoolV     (uInt aRowNr,
+void SSMDirColumn::putArrayBoolV     (rownr_t aRowNr,
 				      const Array<Bool>* aDataPtr)
 {
   Bool deleteIt;
   const Bool* data = aDataPtr->getStorage (deleteIt);
 
-  uInt  aStartRow;
-  uInt  anEndRow;
+  rownr_t  aStartRow;
+  rownr_t  anEndRow;
   char* aValue;
 
   aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow);
@@ -210,7 +215,7 @@ void SSMDirColumn::putArrayBoolV     (uInt aRowNr,
   aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArrayuCharV    (uInt aRowNr,
+void SSMDirColumn::putArrayuCharV    (rownr_t aRowNr,
 				      const Array<uChar>* aDataPtr)
 {
     Bool deleteIt;
@@ -219,7 +224,7 @@ void SSMDirColumn::putArrayuCharV    (uInt aRowNr,
     aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArrayShortV    (uInt aRowNr,
+void SSMDirColumn::putArrayShortV    (rownr_t aRowNr,
 				      const Array<Short>* aDataPtr)
 {
     Bool deleteIt;
@@ -228,7 +233,7 @@ void SSMDirColumn::putArrayShortV    (uInt aRowNr,
     aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArrayuShortV   (uInt aRowNr,
+void SSMDirColumn::putArrayuShortV   (rownr_t aRowNr,
 				      const Array<uShort>* aDataPtr)
 {
     Bool deleteIt;
@@ -237,7 +242,7 @@ void SSMDirColumn::putArrayuShortV   (uInt aRowNr,
     aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArrayIntV      (uInt aRowNr,
+void SSMDirColumn::putArrayIntV      (rownr_t aRowNr,
 				      const Array<Int>* aDataPtr)
 {
     Bool deleteIt;
@@ -246,7 +251,7 @@ void SSMDirColumn::putArrayIntV      (uInt aRowNr,
     aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArrayuIntV     (uInt aRowNr,
+void SSMDirColumn::putArrayuIntV     (rownr_t aRowNr,
 				      const Array<uInt>* aDataPtr)
 {
     Bool deleteIt;
@@ -255,7 +260,7 @@ void SSMDirColumn::putArrayuIntV     (uInt aRowNr,
     aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArrayfloatV    (uInt aRowNr,
+void SSMDirColumn::putArrayfloatV    (rownr_t aRowNr,
 				      const Array<float>* aDataPtr)
 {
     Bool deleteIt;
@@ -264,7 +269,7 @@ void SSMDirColumn::putArrayfloatV    (uInt aRowNr,
     aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArraydoubleV   (uInt aRowNr,
+void SSMDirColumn::putArraydoubleV   (rownr_t aRowNr,
 				      const Array<double>* aDataPtr)
 {
     Bool deleteIt;
@@ -273,7 +278,7 @@ void SSMDirColumn::putArraydoubleV   (uInt aRowNr,
     aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArrayComplexV  (uInt aRowNr,
+void SSMDirColumn::putArrayComplexV  (rownr_t aRowNr,
 				      const Array<Complex>* aDataPtr)
 {
     Bool deleteIt;
@@ -282,7 +287,7 @@ void SSMDirColumn::putArrayComplexV  (uInt aRowNr,
     aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArrayDComplexV (uInt aRowNr,
+void SSMDirColumn::putArrayDComplexV (rownr_t aRowNr,
 				      const Array<DComplex>* aDataPtr)
 {
     Bool deleteIt;
@@ -291,7 +296,7 @@ void SSMDirColumn::putArrayDComplexV (uInt aRowNr,
     aDataPtr->freeStorage (data, deleteIt);
 }
 
-void SSMDirColumn::putArrayStringV (uInt aRowNr,
+void SSMDirColumn::putArrayStringV (rownr_t aRowNr,
 				    const Array<String>* aDataPtr)
 {
   Int buf[3];
@@ -92,41 +92,44 @@ public:
 
   // Get an array value in the given row.
   // <group>
-  virtual void getArrayBoolV     (uInt rownr, Array<Bool>* dataPtr);
-  virtual void getArrayuCharV    (uInt rownr, Array<uChar>* dataPtr);
-  virtual void getArrayShortV    (uInt rownr, Array<Short>* dataPtr);
-  virtual void getArrayuShortV   (uInt rownr, Array<uShort>* dataPtr);
-  virtual void getArrayIntV      (uInt rownr, Array<Int>* dataPtr);
-  virtual void getArrayuIntV     (uInt rownr, Array<uInt>* dataPtr);
-  virtual void getArrayfloatV    (uInt rownr, Array<float>* dataPtr);
-  virtual void getArraydoubleV   (uInt rownr, Array<double>* dataPtr);
-  virtual void getArrayComplexV  (uInt rownr, Array<Complex>* dataPtr);
-  virtual void getArrayDComplexV (uInt rownr, Array<DComplex>* dataPtr);
-  virtual void getArrayStringV   (uInt rownr, Array<String>* dataPtr);
+  virtual void getArrayBoolV     (rownr_t rownr, Array<Bool>* dataPtr);
+  virtual void getArrayuCharV    (rownr_t rownr, Array<uChar>* dataPtr);
+  virtual void getArrayShortV    (rownr_t rownr, Array<Short>* dataPtr);
+  virtual void getArrayuShortV   (rownr_t rownr, Array<uShort>* dataPtr);
+  virtual void getArrayIntV      (rownr_t rownr, Array<Int>* dataPtr);
+  virtual void getArrayuIntV     (rownr_t rownr, Array<uInt>* dataPtr);
+  virtual void getArrayfloatV    (rownr_t rownr, Array<float>* dataPtr);
+  virtual void getArraydoubleV   (rownr_t rownr, Array<double>* dataPtr);
+  virtual void getArrayComplexV  (rownr_t rownr, Array<Complex>* dataPtr);
+  virtual void getArrayDComplexV (rownr_t rownr, Array<DComplex>* dataPtr);
+  virtual void getArrayStringV   (rownr_t rownr, Array<String>* dataPtr);
   // </group>
   
   // Put an array value in the given row.
   // <group>
-  virtual void putArrayBoolV     (uInt rownr, const Array<Bool>* dataPtr);
-  virtual void putArrayuCharV    (uInt rownr, const Array<uChar>* dataPtr);
-  virtual void putArrayShortV    (uInt rownr, const Array<Short>* dataPtr);
-  virtual void putArrayuShortV   (uInt rownr, const Array<uShort>* dataPtr);
-  virtual void putArrayIntV      (uInt rownr, const Array<Int>* dataPtr);
-  virtual void putArrayuIntV     (uInt rownr, const Array<uInt>* dataPtr);
-  virtual void putArrayfloatV    (uInt rownr, const Array<float>* dataPtr);
-  virtual void putArraydoubleV   (uInt rownr, const Array<double>* dataPtr);
-  virtual void putArrayComplexV  (uInt rownr, const Array<Complex>* dataPtr);
-  virtual void putArrayDComplexV (uInt rownr, const Array<DComplex>* dataPtr);
-  virtual void putArrayStringV   (uInt rownr, const Array<String>* dataPtr);
+  virtual void putArrayBoolV     (rownr_t rownr, const Array<Bool>* dataPtr);
+  virtual void putArrayuCharV    (rownr_t rownr, const Array<uChar>* dataPtr);
+  virtual void putArrayShortV    (rownr_t rownr, const Array<Short>* dataPtr);
+  virtual void putArrayuShortV   (rownr_t rownr, const Array<uShort>* dataPtr);
+  virtual void putArrayIntV      (rownr_t rownr, const Array<Int>* dataPtr);
+  virtual void putArrayuIntV     (rownr_t rownr, const Array<uInt>* dataPtr);
+  virtual void putArrayfloatV    (rownr_t rownr, const Array<float>* dataPtr);
+  virtual void putArraydoubleV   (rownr_t rownr, const Array<double>* dataPtr);
+  virtual void putArrayComplexV  (rownr_t rownr, const Array<Complex>* dataPtr);
+  virtual void putArrayDComplexV (rownr_t rownr, const Array<DComplex>* dataPtr);
+  virtual void putArrayStringV   (rownr_t rownr, const Array<String>* dataPtr);
   // </group>
 
   // Remove the given row from the data bucket and possibly string bucket.
-  virtual void deleteRow(uInt aRowNr);
+  virtual void deleteRow(rownr_t aRowNr);
 
 
 protected:
+  // Arrays cannot have a zone map.
+  virtual Bool canHaveZoneMap() const;
+
   // Read the array data for the given row into the data buffer.
-  void getValue (uInt aRowNr, void* data);
+  void getValue (rownr_t aRowNr, void* data);
   
 private:
   // Forbid copy constructor.
@@ -55,25 +55,76 @@ SSMIndex::~SSMIndex()
 
 void SSMIndex::get (AipsIO& anOs)
 {
-  anOs.getstart("SSMIndex");
+  uInt version = anOs.getstart("SSMIndex");
   anOs >> itsNUsed;
   anOs >> itsRowsPerBucket;
   anOs >> itsNrColumns;
   anOs >> itsFreeSpace;
-  getBlock (anOs, itsLastRow);
+  // Version 1 contains 32-bit row numbers.
+  // Version 3 also contains the zone maps.
+  if (version > 1) {
+    getBlock (anOs, itsLastRow);
+  } else {
+    Block<uInt> lastRow;
+    getBlock (anOs, lastRow);
+    itsLastRow.resize (lastRow.nelements(), True, False);
+    for (uInt i=0; i<lastRow.nelements(); ++i) {
+      itsLastRow[i] = lastRow[i];
+    }
+  }
   getBlock (anOs, itsBucketNumber);
+  itsZoneMaps.clear();
+  // Version 3 keyed the zone maps by column name, which is wrong after a
+  // column rename. Those zone maps are skipped (thus rebuilt when needed).
+  if (version > 2) {
+    uInt aNrMaps;
+    anOs >> aNrMaps;
+    for (uInt i=0; i<aNrMaps; i++) {
+      if (version == 3) {
+        String aName;
+        anOs >> aName;
+        StManZoneMap aZoneMap;
+        aZoneMap.get (anOs);
+      } else {
+        uInt anOffset;
+        anOs >> anOffset;
+        itsZoneMaps[anOffset].get (anOs);
+      }
+    }
+  }
   anOs.getend();
 }
 
 void SSMIndex::put (AipsIO& anOs) const
 {
-  anOs.putstart("SSMIndex", 1);
+  // Use the old format with 32-bit row numbers if possible.
+  // Zone maps need the newest format.
+  Bool useZone = !itsZoneMaps.empty();
+  Bool use64 = useZone  ||
+               (itsNUsed > 0  &&  itsLastRow[itsNUsed-1] > 4294967295u);
+  anOs.putstart("SSMIndex", useZone ? 4 : (use64 ? 2 : 1));
   anOs << itsNUsed;
   anOs << itsRowsPerBucket;
   anOs << itsNrColumns;
   anOs << itsFreeSpace;
-  putBlock (anOs, itsLastRow, itsNUsed);
+  if (use64) {
+    putBlock (anOs, itsLastRow, itsNUsed);
+  } else {
+    Block<uInt> lastRow(itsNUsed);
+    for (uInt i=0; i<itsNUsed; ++i) {
+      lastRow[i] = itsLastRow[i];
+    }
+    putBlock (anOs, lastRow, itsNUsed);
+  }
   putBlock (anOs, itsBucketNumber, itsNUsed);
+  if (useZone) {
+    anOs << uInt(itsZoneMaps.size());
+    for (std::map<uInt,StManZoneMap>::const_iterator iter =
+           itsZoneMaps.begin(); iter != itsZoneMaps.end(); ++iter) {
+      anOs << iter->first;
+      iter->second.put (anOs);
+    }
+  }
   anOs.putend();
 }
 
@@ -108,21 +159,21 @@ void SSMIndex::setNrColumns (Int aNrColumns, uInt aSizeUsed)
   }
 }
 
-void SSMIndex::addRow (uInt aNrRows)
+void SSMIndex::addRow (rownr_t aNrRows)
 {
-  uInt lastRow=0;
+  rownr_t lastRow=0;
   if (aNrRows == 0 ) {
     return;
   }
 
   if (itsNUsed > 0 ) {
     lastRow = itsLastRow[itsNUsed-1]+1;
-    uInt usedLast = lastRow;
+    rownr_t usedLast = lastRow;
     if (itsNUsed > 1) {
       usedLast -= itsLastRow[itsNUsed-2]+1;
     }
-    uInt fitLast = itsRowsPerBucket-usedLast;
-    uInt toAdd = min(fitLast, aNrRows);
+    rownr_t fitLast = itsRowsPerBucket-usedLast;
+    rownr_t toAdd = std::min(fitLast, aNrRows);
     
     itsLastRow[itsNUsed-1] += toAdd;
     aNrRows -= toAdd;
@@ -155,7 +206,7 @@ void SSMIndex::addRow (uInt aNrRows)
   
   while (aNrRows > 0) {
     itsBucketNumber[itsNUsed] =itsSSMPtr->getNewBucket();
-    uInt toAdd = min (aNrRows, itsRowsPerBucket);
+    rownr_t toAdd = std::min (aNrRows, rownr_t(itsRowsPerBucket));
     lastRow += toAdd;
     aNrRows -= toAdd;
     itsLastRow[itsNUsed] = lastRow-1;
@@ -163,7 +214,7 @@ void SSMIndex::addRow (uInt aNrRows)
   }
 }
 
-Int SSMIndex::deleteRow (uInt aRowNr)
+Int SSMIndex::deleteRow (rownr_t aRowNr)
 {
   // Decrement the rowNrs of all the intervals after the row to be removed
   uInt anIndex = getIndex(aRowNr);
@@ -182,11 +233,11 @@ Int SSMIndex::deleteRow (uInt aRowNr)
 
   Int anEmptyBucket = -1;
 
-  Int last = -1;
+  Int64 last = -1;
   if (anIndex > 0) {
     last = itsLastRow[anIndex-1];
   }
-  if (static_cast<Int>(itsLastRow[anIndex]) == last || isEmpty) {
+  if (static_cast<Int64>(itsLastRow[anIndex]) == last || isEmpty) {
     anEmptyBucket = itsBucketNumber[anIndex];
     if (anIndex+1 < itsNUsed) {
       objmove (&itsLastRow[anIndex],
@@ -210,7 +261,37 @@ void SSMIndex::recreate()
 }
 
 
-uInt SSMIndex::getIndex (uInt aRowNumber) const
+Vector<rownr_t> SSMIndex::getStartRows() const
+{
+  Vector<rownr_t> aStartRows(itsNUsed);
+  for (uInt i=0; i<itsNUsed; i++) {
+    aStartRows(i) = (i == 0  ?  0 : itsLastRow[i-1] + 1);
+  }
+  return aStartRows;
+}
+
+void SSMIndex::setZoneMap (uInt aColumnOffset, const StManZoneMap& aZoneMap)
+{
+  itsZoneMaps[aColumnOffset] = aZoneMap;
+}
+
+Bool SSMIndex::getZoneMap (uInt aColumnOffset, StManZoneMap& aZoneMap) const
+{
+  std::map<uInt,StManZoneMap>::const_iterator iter =
+    itsZoneMaps.find (aColumnOffset);
+  if (iter == itsZoneMaps.end()) {
+    return False;
+  }
+  aZoneMap = iter->second;
+  return True;
+}
+
+void SSMIndex::removeZoneMap (uInt aColumnOffset)
+{
+  itsZoneMaps.erase (aColumnOffset);
+}
+
+uInt SSMIndex::getIndex (rownr_t aRowNumber) const
 {
   Bool isFound;
   uInt anIndex = binarySearchBrackets( isFound, itsLastRow, aRowNumber, 
@@ -303,8 +384,8 @@ void SSMIndex::addColumn (Int anOffset, uInt nbits)
   }
 }
 
-void SSMIndex::find (uInt aRowNumber, uInt& aBucketNr, 
-		     uInt& aStartRow, uInt& anEndRow) const
+void SSMIndex::find (rownr_t aRowNumber, uInt& aBucketNr, 
+		     rownr_t& aStartRow, rownr_t& anEndRow) const
 {
   uInt anIndex = getIndex(aRowNumber);
   aBucketNr = itsBucketNumber[anIndex];
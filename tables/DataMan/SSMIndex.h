@@ -32,6 +32,8 @@
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Containers/SimOrdMap.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/tables/DataMan/StManZoneMap.h>
+#include <map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -74,6 +76,8 @@ class SSMBase;
 //       When a new column is added <linkto class=SSMBase>SSMBase</linkto>
 //       will scan the SSMIndex objects to find the hole fitting best.
 // </ol>
+// Furthermore, it holds the zone maps (minimum and maximum value per bucket)
+// of the columns using this index, so they are stored together with it.
 // </synopsis>
   
 // <todo asof="$DATE:$">
@@ -112,7 +116,7 @@ public:
   void setNrColumns (Int aNrColumns, uInt aSizeUsed);
 
   // Add some rows.
-  void addRow (uInt aNrRows);
+  void addRow (rownr_t aNrRows);
 
   // Show Statistics of index.
   void showStatistics (ostream& anOs) const;
@@ -132,7 +136,7 @@ public:
   void addColumn (Int anOffset, uInt nbits);
 
   // Delete the given row.
-  Int deleteRow (uInt aRowNumber);
+  Int deleteRow (rownr_t aRowNumber);
 
   // Get the number of rows that fits in ach bucket.
   uInt getRowsPerBucket() const;
@@ -140,12 +144,27 @@ public:
   // Find the bucket containing the given row.
   // An exception is thrown if not found.
   // It also sets the first and last row number fitting in that bucket.
-  void find (uInt aRowNumber, uInt& aBucketNr, uInt& aStartRow,
-	     uInt& anEndRow) const;
+  void find (rownr_t aRowNumber, uInt& aBucketNr, rownr_t& aStartRow,
+	     rownr_t& anEndRow) const;
+
+  // Get the first row number of each bucket.
+  Vector<rownr_t> getStartRows() const;
+
+  // Set the zone map of the given column (to be written with the index).
+  // The column is identified by its offset in the buckets, because
+  // (unlike the column name) it does not change when the column is renamed.
+  void setZoneMap (uInt aColumnOffset, const StManZoneMap& aZoneMap);
+
+  // Get the zone map of the given column.
+  // It returns False if the index does not contain the zone map.
+  Bool getZoneMap (uInt aColumnOffset, StManZoneMap& aZoneMap) const;
+
+  // Remove the zone map of the given column (if existing).
+  void removeZoneMap (uInt aColumnOffset);
 
 private:
   // Get the index of the bucket containing the given row.
-  uInt getIndex (uInt aRowNr) const;
+  uInt getIndex (rownr_t aRowNr) const;
 
 
   //# Pointer to specific Storage Manager.    
@@ -155,7 +174,7 @@ private:
   uInt itsNUsed;
 
   //# Last row nr indexed together with itsBucketNumber
-  Block<uInt> itsLastRow;
+  Block<rownr_t> itsLastRow;
 
   //# Bucketnumbers indexed together with itsLastRow.
   //# So itsLastRow[0] contains the last rownumber of the bucket
@@ -170,6 +189,9 @@ private:
 
   //# Nr of columns using this index.
   Int itsNrColumns;
+
+  //# Zone maps of the columns using this index (keyed by column offset).
+  std::map<uInt,StManZoneMap> itsZoneMaps;
 };
 
 
@@ -167,7 +167,7 @@ public:
     // The argument dataPtr is in fact a T*, but a void*
     // is needed to be generic.
     // The default implementation calls the appropriate getBlockXXV function.
-    uInt getBlockV (uInt rownr, uInt nrmax, void* dataPtr);
+    uInt getBlockV (rownr_t rownr, uInt nrmax, void* dataPtr);
 
     // Put nrmax scalars from the given row on.
     // It returns the actual number of values put.
@@ -176,7 +176,7 @@ public:
     // The argument dataPtr is in fact a const T*, but a const void*
     // is needed to be generic.
     // The default implementation calls the appropriate putBlockXXV function.
-    void putBlockV (uInt rownr, uInt nrmax, const void* dataPtr);
+    void putBlockV (rownr_t rownr, uInt nrmax, const void* dataPtr);
 
     // Get the array value in the given row.
     // The argument dataPtr is in fact an Array<T>*, but a void*
@@ -184,7 +184,7 @@ public:
     // The array pointed to by dataPtr has to have the correct shape
     // (which is guaranteed by the ArrayColumn get function).
     // The default implementation calls the appropriate getArrayXXV.
-    void getArrayV (uInt rownr, void* dataPtr);
+    void getArrayV (rownr_t rownr, void* dataPtr);
 
     // Put the array value into the given row.
     // The argument dataPtr is in fact a const Array<T>*, but a const void*
@@ -192,7 +192,7 @@ public:
     // The array pointed to by dataPtr has to have the correct shape
     // (which is guaranteed by the ArrayColumn put function).
     // The default implementation calls the appropriate putArrayXXV.
-    void putArrayV (uInt rownr, const void* dataPtr);
+    void putArrayV (rownr_t rownr, const void* dataPtr);
 
     // Get all array values in the column.
     // The argument dataPtr is in fact an Array<T>*, but a void*
@@ -232,7 +232,7 @@ public:
     // The array pointed to by dataPtr has to have the correct shape
     // (which is guaranteed by the ArrayColumn getSlice function).
     // The default implementation calls the appropriate getSliceXXV.
-    void getSliceV (uInt rownr, const Slicer& slicer, void* dataPtr);
+    void getSliceV (rownr_t rownr, const Slicer& slicer, void* dataPtr);
 
     // Put into a section of the array in the given row.
     // The argument dataPtr is in fact a const Array<T>*, but a const void*
@@ -240,7 +240,7 @@ public:
     // The array pointed to by dataPtr has to have the correct shape
     // (which is guaranteed by the ArrayColumn putSlice function).
     // The default implementation calls the appropriate putSliceXXV.
-    void putSliceV (uInt rownr, const Slicer& slicer, const void* dataPtr);
+    void putSliceV (rownr_t rownr, const Slicer& slicer, const void* dataPtr);
 
     // Get a section of all arrays in the column.
     // The argument dataPtr is in fact an Array<T>*, but a void*
@@ -396,27 +396,27 @@ protected:
     // (which is guaranteed by the ScalarColumn get function).
     // The default implementation gets one value.
     // <group>
-    virtual uInt getBlockBoolV     (uInt rownr, uInt nrmax,
+    virtual uInt getBlockBoolV     (rownr_t rownr, uInt nrmax,
 				    Bool* dataPtr);
-    virtual uInt getBlockuCharV    (uInt rownr, uInt nrmax,
+    virtual uInt getBlockuCharV    (rownr_t rownr, uInt nrmax,
 				    uChar* dataPtr);
-    virtual uInt getBlockShortV    (uInt rownr, uInt nrmax,
+    virtual uInt getBlockShortV    (rownr_t rownr, uInt nrmax,
 				    Short* dataPtr);
-    virtual uInt getBlockuShortV   (uInt rownr, uInt nrmax,
+    virtual uInt getBlockuShortV   (rownr_t rownr, uInt nrmax,
 				    uShort* dataPtr);
-    virtual uInt getBlockIntV      (uInt rownr, uInt nrmax,
+    virtual uInt getBlockIntV      (rownr_t rownr, uInt nrmax,
 				    Int* dataPtr);
-    virtual uInt getBlockuIntV     (uInt rownr, uInt nrmax,
+    virtual uInt getBlockuIntV     (rownr_t rownr, uInt nrmax,
 				    uInt* dataPtr);
-    virtual uInt getBlockfloatV    (uInt rownr, uInt nrmax,
+    virtual uInt getBlockfloatV    (rownr_t rownr, uInt nrmax,
 				    float* dataPtr);
-    virtual uInt getBlockdoubleV   (uInt rownr, uInt nrmax,
+    virtual uInt getBlockdoubleV   (rownr_t rownr, uInt nrmax,
 				    double* dataPtr);
-    virtual uInt getBlockComplexV  (uInt rownr, uInt nrmax,
+    virtual uInt getBlockComplexV  (rownr_t rownr, uInt nrmax,
 				    Complex* dataPtr);
-    virtual uInt getBlockDComplexV (uInt rownr, uInt nrmax,
+    virtual uInt getBlockDComplexV (rownr_t rownr, uInt nrmax,
 				    DComplex* dataPtr);
-    virtual uInt getBlockStringV   (uInt rownr, uInt nrmax,
+    virtual uInt getBlockStringV   (rownr_t rownr, uInt nrmax,
 				    String* dataPtr);
     // </group>
 
@@ -426,27 +426,27 @@ protected:
     // The buffer pointed to by dataPtr has to have the length nrmax.
     // The default implementation puts one value at the time.
     // <group>
-    virtual void putBlockBoolV     (uInt rownr, uInt nrmax,
+    virtual void putBlockBoolV     (rownr_t rownr, uInt nrmax,
 				    const Bool* dataPtr);
-    virtual void putBlockuCharV    (uInt rownr, uInt nrmax,
+    virtual void putBlockuCharV    (rownr_t rownr, uInt nrmax,
 				    const uChar* dataPtr);
-    virtual void putBlockShortV    (uInt rownr, uInt nrmax,
+    virtual void putBlockShortV    (rownr_t rownr, uInt nrmax,
 			            const Short* dataPtr);
-    virtual void putBlockuShortV   (uInt rownr, uInt nrmax,
+    virtual void putBlockuShortV   (rownr_t rownr, uInt nrmax,
 				    const uShort* dataPtr);
-    virtual void putBlockIntV      (uInt rownr, uInt nrmax,
+    virtual void putBlockIntV      (rownr_t rownr, uInt nrmax,
 				    const Int* dataPtr);
-    virtual void putBlockuIntV     (uInt rownr, uInt nrmax,
+    virtual void putBlockuIntV     (rownr_t rownr, uInt nrmax,
 				    const uInt* dataPtr);
-    virtual void putBlockfloatV    (uInt rownr, uInt nrmax,
+    virtual void putBlockfloatV    (rownr_t rownr, uInt nrmax,
 				    const float* dataPtr);
-    virtual void putBlockdoubleV   (uInt rownr, uInt nrmax,
+    virtual void putBlockdoubleV   (rownr_t rownr, uInt nrmax,
 				    const double* dataPtr);
-    virtual void putBlockComplexV  (uInt rownr, uInt nrmax,
+    virtual void putBlockComplexV  (rownr_t rownr, uInt nrmax,
 				    const Complex* dataPtr);
-    virtual void putBlockDComplexV (uInt rownr, uInt nrmax,
+    virtual void putBlockDComplexV (rownr_t rownr, uInt nrmax,
 				    const DComplex* dataPtr);
-    virtual void putBlockStringV   (uInt rownr, uInt nrmax,
+    virtual void putBlockStringV   (rownr_t rownr, uInt nrmax,
 				    const String* dataPtr);
     // </group>
 
@@ -455,17 +455,17 @@ protected:
     // (which is guaranteed by the ArrayColumn get function).
     // The default implementation loops through all rows.
     // <group>
-    virtual void getArrayBoolV     (uInt rownr, Array<Bool>* dataPtr);
-    virtual void getArrayuCharV    (uInt rownr, Array<uChar>* dataPtr);
-    virtual void getArrayShortV    (uInt rownr, Array<Short>* dataPtr);
-    virtual void getArrayuShortV   (uInt rownr, Array<uShort>* dataPtr);
-    virtual void getArrayIntV      (uInt rownr, Array<Int>* dataPtr);
-    virtual void getArrayuIntV     (uInt rownr, Array<uInt>* dataPtr);
-    virtual void getArrayfloatV    (uInt rownr, Array<float>* dataPtr);
-    virtual void getArraydoubleV   (uInt rownr, Array<double>* dataPtr);
-    virtual void getArrayComplexV  (uInt rownr, Array<Complex>* dataPtr);
-    virtual void getArrayDComplexV (uInt rownr, Array<DComplex>* dataPtr);
-    virtual void getArrayStringV   (uInt rownr, Array<String>* dataPtr);
+    virtual void getArrayBoolV     (rownr_t rownr, Array<Bool>* dataPtr);
+    virtual void getArrayuCharV    (rownr_t rownr, Array<uChar>* dataPtr);
+    virtual void getArrayShortV    (rownr_t rownr, Array<Short>* dataPtr);
+    virtual void getArrayuShortV   (rownr_t rownr, Array<uShort>* dataPtr);
+    virtual void getArrayIntV      (rownr_t rownr, Array<Int>* dataPtr);
+    virtual void getArrayuIntV     (rownr_t rownr, Array<uInt>* dataPtr);
+    virtual void getArrayfloatV    (rownr_t rownr, Array<float>* dataPtr);
+    virtual void getArraydoubleV   (rownr_t rownr, Array<double>* dataPtr);
+    virtual void getArrayComplexV  (rownr_t rownr, Array<Complex>* dataPtr);
+    virtual void getArrayDComplexV (rownr_t rownr, Array<DComplex>* dataPtr);
+    virtual void getArrayStringV   (rownr_t rownr, Array<String>* dataPtr);
     // </group>
 
     // Put the array value into the given row.
@@ -473,27 +473,27 @@ protected:
     // (which is guaranteed by the ArrayColumn put function).
     // The default implementation loops through all rows.
     // <group>
-    virtual void putArrayBoolV     (uInt rownr,
+    virtual void putArrayBoolV     (rownr_t rownr,
 				    const Array<Bool>* dataPtr);
-    virtual void putArrayuCharV    (uInt rownr,
+    virtual void putArrayuCharV    (rownr_t rownr,
 				    const Array<uChar>* dataPtr);
-    virtual void putArrayShortV    (uInt rownr,
+    virtual void putArrayShortV    (rownr_t rownr,
 				    const Array<Short>* dataPtr);
-    virtual void putArrayuShortV   (uInt rownr,
+    virtual void putArrayuShortV   (rownr_t rownr,
 				    const Array<uShort>* dataPtr);
-    virtual void putArrayIntV      (uInt rownr,
+    virtual void putArrayIntV      (rownr_t rownr,
 				    const Array<Int>* dataPtr);
-    virtual void putArrayuIntV     (uInt rownr,
+    virtual void putArrayuIntV     (rownr_t rownr,
 				    const Array<uInt>* dataPtr);
-    virtual void putArrayfloatV    (uInt rownr,
+    virtual void putArrayfloatV    (rownr_t rownr,
 				    const Array<float>* dataPtr);
-    virtual void putArraydoubleV   (uInt rownr,
+    virtual void putArraydoubleV   (rownr_t rownr,
 				    const Array<double>* dataPtr);
-    virtual void putArrayComplexV  (uInt rownr,
+    virtual void putArrayComplexV  (rownr_t rownr,
 				    const Array<Complex>* dataPtr);
-    virtual void putArrayDComplexV (uInt rownr,
+    virtual void putArrayDComplexV (rownr_t rownr,
 				    const Array<DComplex>* dataPtr);
-    virtual void putArrayStringV   (uInt rownr,
+    virtual void putArrayStringV   (rownr_t rownr,
 				    const Array<String>* dataPtr);
     // </group>
 
@@ -596,27 +596,27 @@ protected:
     // (which is guaranteed by the ArrayColumn getSlice function).
     // The default implementation throws an "invalid operation exception".
     // <group>
-    virtual void getSliceBoolV     (uInt rownr, const Slicer& ns,
+    virtual void getSliceBoolV     (rownr_t rownr, const Slicer& ns,
 				    Array<Bool>* dataPtr);
-    virtual void getSliceuCharV    (uInt rownr, const Slicer& ns,
+    virtual void getSliceuCharV    (rownr_t rownr, const Slicer& ns,
 				    Array<uChar>* dataPtr);
-    virtual void getSliceShortV    (uInt rownr, const Slicer& ns,
+    virtual void getSliceShortV    (rownr_t rownr, const Slicer& ns,
 				    Array<Short>* dataPtr);
-    virtual void getSliceuShortV   (uInt rownr, const Slicer& ns,
+    virtual void getSliceuShortV   (rownr_t rownr, const Slicer& ns,
 				    Array<uShort>* dataPtr);
-    virtual void getSliceIntV      (uInt rownr, const Slicer& ns,
+    virtual void getSliceIntV      (rownr_t rownr, const Slicer& ns,
 				    Array<Int>* dataPtr);
-    virtual void getSliceuIntV     (uInt rownr, const Slicer& ns,
+    virtual void getSliceuIntV     (rownr_t rownr, const Slicer& ns,
 				    Array<uInt>* dataPtr);
-    virtual void getSlicefloatV    (uInt rownr, const Slicer& ns,
+    virtual void getSlicefloatV    (rownr_t rownr, const Slicer& ns,
 				    Array<float>* dataPtr);
-    virtual void getSlicedoubleV   (uInt rownr, const Slicer& ns,
+    virtual void getSlicedoubleV   (rownr_t rownr, const Slicer& ns,
 				    Array<double>* dataPtr);
-    virtual void getSliceComplexV  (uInt rownr, const Slicer& ns,
+    virtual void getSliceComplexV  (rownr_t rownr, const Slicer& ns,
 				    Array<Complex>* dataPtr);
-    virtual void getSliceDComplexV (uInt rownr, const Slicer& ns,
+    virtual void getSliceDComplexV (rownr_t rownr, const Slicer& ns,
 				    Array<DComplex>* dataPtr);
-    virtual void getSliceStringV   (uInt rownr, const Slicer& ns,
+    virtual void getSliceStringV   (rownr_t rownr, const Slicer& ns,
 				    Array<String>* dataPtr);
     // </group>
 
@@ -625,27 +625,27 @@ protected:
     // (which is guaranteed by the ArrayColumn putSlice function).
     // The default implementation throws an "invalid operation exception".
     // <group>
-    virtual void putSliceBoolV     (uInt rownr, const Slicer& ns,
+    virtual void putSliceBoolV     (rownr_t rownr, const Slicer& ns,
 				    const Array<Bool>* dataPtr);
-    virtual void putSliceuCharV    (uInt rownr, const Slicer& ns,
+    virtual void putSliceuCharV    (rownr_t rownr, const Slicer& ns,
 				    const Array<uChar>* dataPtr);
-    virtual void putSliceShortV    (uInt rownr, const Slicer& ns,
+    virtual void putSliceShortV    (rownr_t rownr, const Slicer& ns,
 				    const Array<Short>* dataPtr);
-    virtual void putSliceuShortV   (uInt rownr, const Slicer& ns,
+    virtual void putSliceuShortV   (rownr_t rownr, const Slicer& ns,
 				    const Array<uShort>* dataPtr);
-    virtual void putSliceIntV      (uInt rownr, const Slicer& ns,
+    virtual void putSliceIntV      (rownr_t rownr, const Slicer& ns,
 				    const Array<Int>* dataPtr);
-    virtual void putSliceuIntV     (uInt rownr, const Slicer& ns,
+    virtual void putSliceuIntV     (rownr_t rownr, const Slicer& ns,
 				    const Array<uInt>* dataPtr);
-    virtual void putSlicefloatV    (uInt rownr, const Slicer& ns,
+    virtual void putSlicefloatV    (rownr_t rownr, const Slicer& ns,
 				    const Array<float>* dataPtr);
-    virtual void putSlicedoubleV   (uInt rownr, const Slicer& ns,
+    virtual void putSlicedoubleV   (rownr_t rownr, const Slicer& ns,
 				    const Array<double>* dataPtr);
-    virtual void putSliceComplexV  (uInt rownr, const Slicer& ns,
+    virtual void putSliceComplexV  (rownr_t rownr, const Slicer& ns,
 				    const Array<Complex>* dataPtr);
-    virtual void putSliceDComplexV (uInt rownr, const Slicer& ns,
+    virtual void putSliceDComplexV (rownr_t rownr, const Slicer& ns,
 				    const Array<DComplex>* dataPtr);
-    virtual void putSliceStringV   (uInt rownr, const Slicer& ns,
+    virtual void putSliceStringV   (rownr_t rownr, const Slicer& ns,
 				    const Array<String>* dataPtr);
     // </group>
 
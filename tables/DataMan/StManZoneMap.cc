@@ -0,0 +1,199 @@
+//# StManZoneMap.cc: Minimum and maximum value per bucket of a column
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+#include <casacore/tables/DataMan/StManZoneMap.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/Containers/BlockIO.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <float.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+StManZoneMap::StManZoneMap()
+: itsActive       (False),
+  itsChanged      (False),
+  itsChangedStart (0),
+  itsChangedEnd   (0)
+{}
+
+Bool StManZoneMap::isSupported (DataType dtype)
+{
+  switch (dtype) {
+  case TpUChar:
+  case TpShort:
+  case TpUShort:
+  case TpInt:
+  case TpUInt:
+  case TpFloat:
+  case TpDouble:
+    return True;
+  default:
+    return False;
+  }
+}
+
+void StManZoneMap::activate()
+{
+  itsActive = True;
+  itsStartRows.resize (0);
+  itsMin.resize (0);
+  itsMax.resize (0);
+  itsChanged      = True;
+  itsChangedStart = 0;
+  itsChangedEnd   = 0;
+}
+
+Vector<uInt> StManZoneMap::update (const Vector<rownr_t>& startRows,
+                                   rownr_t nrow)
+{
+  uInt nzone = startRows.size();
+  uInt nold  = itsMin.size();
+  Block<rownr_t> newStart(nzone+1);
+  Block<Double> newMin(nzone, DBL_MAX);
+  Block<Double> newMax(nzone, -DBL_MAX);
+  for (uInt i=0; i<nzone; ++i) {
+    newStart[i] = startRows[i];
+  }
+  newStart[nzone] = nrow;
+  Vector<uInt> todo(nzone);
+  uInt ntodo = 0;
+  uInt j = 0;
+  for (uInt i=0; i<nzone; ++i) {
+    rownr_t st  = newStart[i];
+    rownr_t end = newStart[i+1];        // exclusive
+    // Nothing to do for an empty zone.
+    if (end > st) {
+      // The old values can be used if the same zone existed and none
+      // of its rows has changed.
+      while (j < nold  &&  itsStartRows[j] < st) {
+        j++;
+      }
+      if (j < nold  &&  itsStartRows[j] == st  &&  itsStartRows[j+1] == end
+      &&  !(itsChanged  &&  end > itsChangedStart  &&  st <= itsChangedEnd)) {
+        newMin[i] = itsMin[j];
+        newMax[i] = itsMax[j];
+      } else {
+        todo[ntodo++] = i;
+      }
+    }
+  }
+  itsStartRows = newStart;
+  itsMin       = newMin;
+  itsMax       = newMax;
+  itsChanged   = False;
+  todo.resize (ntodo, True);
+  return todo;
+}
+
+void StManZoneMap::getZones (Vector<rownr_t>& startRows,
+                             Vector<Double>& minValues,
+                             Vector<Double>& maxValues) const
+{
+  uInt nzone = itsMin.size();
+  startRows.resize (nzone);
+  minValues.resize (nzone);
+  maxValues.resize (nzone);
+  for (uInt i=0; i<nzone; ++i) {
+    startRows[i] = itsStartRows[i];
+    minValues[i] = itsMin[i];
+    maxValues[i] = itsMax[i];
+  }
+}
+
+template<typename T>
+static void zoneMinMax (Double& minValue, Double& maxValue,
+                        const T* values, uInt nvalues)
+{
+  for (uInt i=0; i<nvalues; ++i) {
+    Double v = values[i];
+    if (!isNaN(v)) {
+      if (v < minValue) minValue = v;
+      if (v > maxValue) maxValue = v;
+    }
+  }
+}
+
+void StManZoneMap::minMax (Double& minValue, Double& maxValue,
+                           const void* values, uInt nvalues, DataType dtype)
+{
+  minValue = DBL_MAX;
+  maxValue = -DBL_MAX;
+  switch (dtype) {
+  case TpUChar:
+    zoneMinMax (minValue, maxValue, static_cast<const uChar*>(values), nvalues);
+    break;
+  case TpShort:
+    zoneMinMax (minValue, maxValue, static_cast<const Short*>(values), nvalues);
+    break;
+  case TpUShort:
+    zoneMinMax (minValue, maxValue, static_cast<const uShort*>(values), nvalues);
+    break;
+  case TpInt:
+    zoneMinMax (minValue, maxValue, static_cast<const Int*>(values), nvalues);
+    break;
+  case TpUInt:
+    zoneMinMax (minValue, maxValue, static_cast<const uInt*>(values), nvalues);
+    break;
+  case TpFloat:
+    zoneMinMax (minValue, maxValue, static_cast<const float*>(values), nvalues);
+    break;
+  case TpDouble:
+    zoneMinMax (minValue, maxValue, static_cast<const double*>(values), nvalues);
+    break;
+  default:
+    throw AipsError ("StManZoneMap::minMax - unsupported data type");
+  }
+}
+
+void StManZoneMap::put (AipsIO& os) const
+{
+  uInt nzone = itsMin.size();
+  os.putstart ("StManZoneMap", 1);
+  os << nzone;
+  putBlock (os, itsStartRows, nzone+1);
+  putBlock (os, itsMin, nzone);
+  putBlock (os, itsMax, nzone);
+  os.putend();
+}
+
+void StManZoneMap::get (AipsIO& os)
+{
+  uInt nzone;
+  os.getstart ("StManZoneMap");
+  os >> nzone;
+  getBlock (os, itsStartRows);
+  getBlock (os, itsMin);
+  getBlock (os, itsMax);
+  os.getend();
+  itsActive  = True;
+  itsChanged = False;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,168 @@
+//# StManZoneMap.h: Minimum and maximum value per bucket of a column
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+
+#ifndef TABLES_STMANZONEMAP_H
+#define TABLES_STMANZONEMAP_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Utilities/DataType.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class AipsIO;
+
+
+// <summary>
+// Minimum and maximum value per bucket of a column in a storage manager.
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tStandardStMan.cc, tIncrementalStMan.cc">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=DataManagerColumn>DataManagerColumn</linkto>
+// </prerequisite>
+
+// <etymology>
+// StManZoneMap is the zone map (as it is called in databases) of a column
+// in a storage manager.
+// </etymology>
+
+// <synopsis>
+// A zone map holds the minimum and maximum value of a scalar numeric column
+// for each zone, i.e. a consecutive range of rows (usually a bucket).
+// A query can use it to skip the zones that cannot contain the values
+// searched for (see function <src>DataManagerColumn::getZoneMap</src>).
+// <p>
+// The storage manager tells which rows have changed. When the zone map
+// is needed, function <src>update</src> is called with the current zones.
+// It retains the values of the zones that did not change and returns the
+// zones for which the storage manager has to calculate the minimum and
+// maximum (using the static function <src>minMax</src>).
+// Thus the zone map is maintained incrementally; e.g., when rows are
+// added, usually only the last zones have to be calculated.
+// <br>The storage manager can store the zone map alongside its index,
+// so it is available when the table is opened again.
+// <p>
+// The zone map is only maintained if it is active. A storage manager makes
+// it active for the numeric scalar columns of a new table, or for existing
+// tables when a zone map is asked for.
+// </synopsis>
+
+// <example>
+// See class <linkto class=SSMColumn>SSMColumn</linkto>.
+// </example>
+
+class StManZoneMap
+{
+public:
+  // Create an inactive zone map.
+  StManZoneMap();
+
+  // Can a zone map be kept for a column with the given data type?
+  static Bool isSupported (DataType dtype);
+
+  // Is the zone map active (i.e., is it maintained)?
+  Bool isActive() const
+    { return itsActive; }
+
+  // Make the zone map active. All rows are marked as changed, so all zones
+  // will be calculated at the next update.
+  void activate();
+
+  // Mark the given rows (inclusive) as changed.
+  // Nothing is done if the zone map is not active.
+  void setChanged (rownr_t startRow, rownr_t endRow)
+  {
+    if (itsActive) {
+      if (itsChanged) {
+        if (startRow < itsChangedStart) itsChangedStart = startRow;
+        if (endRow   > itsChangedEnd)   itsChangedEnd   = endRow;
+      } else {
+        itsChanged      = True;
+        itsChangedStart = startRow;
+        itsChangedEnd   = endRow;
+      }
+    }
+  }
+
+  // Have rows changed since the last update?
+  Bool hasChanged() const
+    { return itsChanged; }
+
+  // Update the zone map for the current zones, given by their start rows
+  // (the last zone ends at row <src>nrow-1</src>).
+  // The values of a zone are retained if the zone existed before and none
+  // of its rows has changed.
+  // It returns the indices of the zones to be (re)calculated; the caller
+  // has to set their values using <src>setZone</src>.
+  // Thereafter no rows are marked as changed.
+  Vector<uInt> update (const Vector<rownr_t>& startRows, rownr_t nrow);
+
+  // Set the minimum and maximum of a zone.
+  void setZone (uInt zone, Double minValue, Double maxValue)
+    { itsMin[zone] = minValue; itsMax[zone] = maxValue; }
+
+  // Get the zones with their minimum and maximum.
+  void getZones (Vector<rownr_t>& startRows,
+                 Vector<Double>& minValues, Vector<Double>& maxValues) const;
+
+  // Determine the minimum and maximum of the given values with the given
+  // data type. NaN values are ignored. If there are no (valid) values,
+  // the minimum is set to DBL_MAX and the maximum to -DBL_MAX.
+  static void minMax (Double& minValue, Double& maxValue,
+                      const void* values, uInt nvalues, DataType dtype);
+
+  // Write the zone map into AipsIO. It should not have changed rows.
+  void put (AipsIO& os) const;
+
+  // Read the zone map from AipsIO. It gets active.
+  void get (AipsIO& os);
+
+private:
+  Bool           itsActive;
+  Bool           itsChanged;
+  rownr_t        itsChangedStart;
+  rownr_t        itsChangedEnd;
+  //# Start row of each zone plus the number of rows as the last entry.
+  Block<rownr_t> itsStartRows;
+  Block<Double>  itsMin;
+  Block<Double>  itsMax;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -0,0 +1,324 @@
+//# TSMCodec.cc: Lossless compression of tiles in the Tiled Storage Manager
+//# Copyright (C) 2015
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/DataMan/TSMCodec.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/string.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# The LZ format is a sequence of blocks, each consisting of:
+//#  - a token byte; the upper 4 bits give the number of literals,
+//#    the lower 4 bits the match length minus MinMatch. A value 15 means
+//#    that extra length bytes follow (each 255 means yet another byte).
+//#  - the literals.
+//#  - a 2-byte little-endian offset of the match (not in the last block).
+//#  - the extra match length bytes.
+//# The last block only contains literals. The last LastLiterals bytes
+//# are always literals, so a match never reaches the end of the data.
+namespace {
+    const uInt MinMatch     = 4;
+    const uInt LastLiterals = 5;
+    const uInt MaxOffset    = 65535;
+    const uInt HashLog      = 12;
+
+    inline uInt read32 (const unsigned char* p)
+      { return uInt(p[0]) | uInt(p[1])<<8 | uInt(p[2])<<16 | uInt(p[3])<<24; }
+
+    inline uInt hash32 (uInt v)
+      { return (v * 2654435761u) >> (32 - HashLog); }
+
+    // Write a length exceeding 15 as a sequence of bytes.
+    inline unsigned char* putLength (unsigned char* op, uInt length)
+    {
+        while (length >= 255) {
+            *op++ = 255;
+            length -= 255;
+        }
+        *op++ = (unsigned char)length;
+        return op;
+    }
+
+    // Read the extra length bytes; check that the input is not exhausted.
+    inline uInt getLength (const unsigned char*& ip, const unsigned char* iend)
+    {
+        uInt length = 0;
+        unsigned char c;
+        do {
+            if (ip >= iend) {
+                throw DataManError ("TSMCodec: corrupt compressed tile");
+            }
+            c = *ip++;
+            length += c;
+        } while (c == 255);
+        return length;
+    }
+
+    // Write a block of literals followed by a match (if matchLength>0).
+    unsigned char* putSequence (unsigned char* op, const unsigned char* lit,
+                                uInt nlit, uInt offset, uInt matchLength)
+    {
+        unsigned char* token = op++;
+        uInt ml = (matchLength == 0  ?  0 : matchLength - MinMatch);
+        *token = (unsigned char)((nlit < 15 ? nlit : 15) << 4  |
+                                 (ml < 15 ? ml : 15));
+        if (nlit >= 15) {
+            op = putLength (op, nlit - 15);
+        }
+        memcpy (op, lit, nlit);
+        op += nlit;
+        if (matchLength > 0) {
+            *op++ = (unsigned char)(offset & 255);
+            *op++ = (unsigned char)(offset >> 8);
+            if (ml >= 15) {
+                op = putLength (op, ml - 15);
+            }
+        }
+        return op;
+    }
+}
+
+
+TSMCodec::Type TSMCodec::fromString (const String& name)
+{
+    String nm(name);
+    nm.downcase();
+    if (nm == "none") {
+        return None;
+    } else if (nm == "lz") {
+        return LZ;
+    } else if (nm == "shufflelz") {
+        return ShuffleLZ;
+    }
+    throw DataManError ("TSMCodec: unknown tile codec " + name +
+                        " (valid are None, LZ, ShuffleLZ)");
+}
+
+String TSMCodec::toString (Type codec)
+{
+    switch (codec) {
+    case LZ:
+        return "LZ";
+    case ShuffleLZ:
+        return "ShuffleLZ";
+    default:
+        break;
+    }
+    return "None";
+}
+
+void TSMCodec::shuffle (char* out, const char* in,
+                        uInt nvalues, uInt valueSize)
+{
+    for (uInt j=0; j<valueSize; j++) {
+        const char* inp = in + j;
+        for (uInt i=0; i<nvalues; i++) {
+            *out++ = *inp;
+            inp += valueSize;
+        }
+    }
+}
+
+void TSMCodec::unshuffle (char* out, const char* in,
+                          uInt nvalues, uInt valueSize)
+{
+    for (uInt j=0; j<valueSize; j++) {
+        char* outp = out + j;
+        for (uInt i=0; i<nvalues; i++) {
+            *outp = *in++;
+            outp += valueSize;
+        }
+    }
+}
+
+uInt TSMCodec::maxCompressedLength (uInt length)
+{
+    return length + length/255 + 16;
+}
+
+uInt TSMCodec::compressLZ (char* out, const char* in, uInt length)
+{
+    const unsigned char* ip = (const unsigned char*)in;
+    unsigned char* op = (unsigned char*)out;
+    const unsigned char* anchor = ip;
+    if (length > MinMatch + LastLiterals) {
+        // The table contains the last position+1 of a 4-byte sequence.
+        Block<uInt> table (1<<HashLog, 0u);
+        const unsigned char* mlimit = ip + length - LastLiterals;
+        const unsigned char* slimit = mlimit - MinMatch;
+        const unsigned char* p = ip;
+        while (p < slimit) {
+            uInt v = read32 (p);
+            uInt h = hash32 (v);
+            uInt pos = p - ip;
+            uInt ref = table[h];
+            table[h] = pos + 1;
+            if (ref > 0  &&  pos - (ref-1) <= MaxOffset
+            &&  read32 (ip + ref - 1) == v) {
+                const unsigned char* r = ip + ref - 1;
+                uInt ml = MinMatch;
+                while (p + ml < mlimit  &&  r[ml] == p[ml]) {
+                    ml++;
+                }
+                op = putSequence (op, anchor, p - anchor, p - r, ml);
+                p += ml;
+                anchor = p;
+            } else {
+                p++;
+            }
+        }
+    }
+    // The remaining bytes are literals.
+    op = putSequence (op, anchor, ip + length - anchor, 0, 0);
+    return op - (unsigned char*)out;
+}
+
+void TSMCodec::decompressLZ (char* out, uInt outLength,
+                             const char* in, uInt inLength)
+{
+    const unsigned char* ip = (const unsigned char*)in;
+    const unsigned char* iend = ip + inLength;
+    unsigned char* op = (unsigned char*)out;
+    unsigned char* oend = op + outLength;
+    while (True) {
+        if (ip >= iend) {
+            throw DataManError ("TSMCodec: corrupt compressed tile");
+        }
+        uInt token = *ip++;
+        uInt nlit = token >> 4;
+        if (nlit == 15) {
+            nlit += getLength (ip, iend);
+        }
+        if (nlit > uInt(iend - ip)  ||  nlit > uInt(oend - op)) {
+            throw DataManError ("TSMCodec: corrupt compressed tile");
+        }
+        memcpy (op, ip, nlit);
+        op += nlit;
+        ip += nlit;
+        if (op == oend) {
+            break;
+        }
+        if (iend - ip < 2) {
+            throw DataManError ("TSMCodec: corrupt compressed tile");
+        }
+        uInt offset = uInt(ip[0]) | uInt(ip[1])<<8;
+        ip += 2;
+        uInt ml = token & 15;
+        if (ml == 15) {
+            ml += getLength (ip, iend);
+        }
+        ml += MinMatch;
+        if (offset == 0  ||  offset > uInt(op - (unsigned char*)out)
+        ||  ml > uInt(oend - op)) {
+            throw DataManError ("TSMCodec: corrupt compressed tile");
+        }
+        // The match can overlap the output, so copy byte by byte.
+        const unsigned char* r = op - offset;
+        for (uInt i=0; i<ml; i++) {
+            *op++ = *r++;
+        }
+    }
+}
+
+uInt TSMCodec::encode (Type codec, Block<char>& out,
+                       const char* tile, uInt tileLength,
+                       const Block<uInt>& partOffset,
+                       const Block<uInt>& valueSize)
+{
+    uInt maxLength = 1 + maxCompressedLength (tileLength);
+    if (out.nelements() < maxLength) {
+        out.resize (maxLength, False, False);
+    }
+    uInt length = 0;
+    if (codec == LZ) {
+        length = compressLZ (out.storage() + 1, tile, tileLength);
+    } else if (codec == ShuffleLZ) {
+        Block<char> shuffled (tileLength);
+        uInt nrpart = partOffset.nelements();
+        for (uInt i=0; i<nrpart; i++) {
+            uInt st = partOffset[i];
+            uInt end = (i+1 < nrpart  ?  partOffset[i+1] : tileLength);
+            uInt sz = valueSize[i];
+            uInt nval = (end - st) / sz;
+            shuffle (shuffled.storage() + st, tile + st, nval, sz);
+            // Copy a possible remainder as such.
+            memcpy (shuffled.storage() + st + nval*sz, tile + st + nval*sz,
+                    end - st - nval*sz);
+        }
+        length = compressLZ (out.storage() + 1, shuffled.storage(), tileLength);
+    }
+    // Store the tile as such if compression does not help.
+    if (codec == None  ||  length >= tileLength) {
+        out[0] = None;
+        memcpy (out.storage() + 1, tile, tileLength);
+        return 1 + tileLength;
+    }
+    out[0] = char(codec);
+    return 1 + length;
+}
+
+void TSMCodec::decode (char* tile, uInt tileLength,
+                       const char* in, uInt inLength,
+                       const Block<uInt>& partOffset,
+                       const Block<uInt>& valueSize)
+{
+    if (inLength == 0) {
+        throw DataManError ("TSMCodec: corrupt compressed tile");
+    }
+    switch (in[0]) {
+    case None:
+        if (inLength != 1 + tileLength) {
+            throw DataManError ("TSMCodec: corrupt compressed tile");
+        }
+        memcpy (tile, in + 1, tileLength);
+        break;
+    case LZ:
+        decompressLZ (tile, tileLength, in + 1, inLength - 1);
+        break;
+    case ShuffleLZ:
+        {
+            Block<char> shuffled (tileLength);
+            decompressLZ (shuffled.storage(), tileLength, in + 1, inLength - 1);
+            uInt nrpart = partOffset.nelements();
+            for (uInt i=0; i<nrpart; i++) {
+                uInt st = partOffset[i];
+                uInt end = (i+1 < nrpart  ?  partOffset[i+1] : tileLength);
+                uInt sz = valueSize[i];
+                uInt nval = (end - st) / sz;
+                unshuffle (tile + st, shuffled.storage() + st, nval, sz);
+                memcpy (tile + st + nval*sz, shuffled.storage() + st + nval*sz,
+                        end - st - nval*sz);
+            }
+        }
+        break;
+    default:
+        throw DataManError ("TSMCodec: unknown codec in compressed tile");
+    }
+}
+
+} //# NAMESPACE CASACORE - END
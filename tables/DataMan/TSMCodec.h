@@ -0,0 +1,150 @@
+//# TSMCodec.h: Lossless compression of tiles in the Tiled Storage Manager
+//# Copyright (C) 2015
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TSMCODEC_H
+#define TABLES_TSMCODEC_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/BasicSL/String.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// Lossless compression of tiles in the Tiled Storage Manager
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="UNKNOWN" date="before2004/08/25" tests="tTSMCodec.cc">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=TiledStMan>TiledStMan</linkto>
+//   <li> <linkto class=TSMCube>TSMCube</linkto>
+// </prerequisite>
+
+// <synopsis>
+// TSMCodec offers the functions to compress and decompress the tiles
+// of a hypercube in the Tiled Storage Managers. The tiles are compressed
+// after they have been converted to the external (canonical) format,
+// so the compressed data are independent of the machine.
+// <br>The following codecs are supported:
+// <ul>
+//  <li> <src>None</src> does not compress; the tiles are stored as usual.
+//  <li> <src>LZ</src> uses a fast LZ77-style compression (similar to LZ4)
+//       on the bytes of the tile.
+//  <li> <src>ShuffleLZ</src> shuffles the bytes of the tile data first,
+//       thus puts the first bytes of all values together, then all
+//       second bytes, etc. Thereafter LZ compression is done.
+//       Shuffling usually improves the compression of numeric data
+//       considerably, because the exponents and high-order bytes of
+//       the mantissas are very similar.
+// </ul>
+// Compressed tiles have a variable length. A tile is stored with a
+// 1-byte header telling how it has been compressed. If the compression
+// does not make the tile smaller, it is stored uncompressed.
+// <p>
+// The functions are thread-safe; they do not use static data.
+// </synopsis>
+
+// <motivation>
+// Float visibility and image cubes compress well, which saves disk space
+// and IO bandwidth.
+// </motivation>
+
+class TSMCodec
+{
+public:
+    // Define the possible codecs.
+    enum Type {
+        None=0,
+        LZ=1,
+        ShuffleLZ=2
+    };
+
+    // Convert a codec name (case-insensitive) to its type.
+    // An exception is thrown if the name is unknown.
+    static Type fromString (const String& name);
+
+    // Convert the codec type to its name.
+    static String toString (Type codec);
+
+    // Shuffle the bytes of <src>nvalues</src> values with
+    // <src>valueSize</src> bytes each.
+    // The first bytes of all values are stored first, then the second
+    // bytes, etc.
+    static void shuffle (char* out, const char* in,
+                         uInt nvalues, uInt valueSize);
+
+    // Reverse the shuffle operation.
+    static void unshuffle (char* out, const char* in,
+                           uInt nvalues, uInt valueSize);
+
+    // Compress the buffer using LZ compression.
+    // The output buffer should have at least
+    // <src>maxCompressedLength(length)</src> bytes.
+    // It returns the length of the compressed data.
+    static uInt compressLZ (char* out, const char* in, uInt length);
+
+    // Decompress an LZ compressed buffer.
+    // The output buffer must have the length of the uncompressed data.
+    // An exception is thrown if the compressed data are corrupt.
+    static void decompressLZ (char* out, uInt outLength,
+                              const char* in, uInt inLength);
+
+    // Get the maximum length of the LZ compressed data
+    // (in case the data do not compress at all).
+    static uInt maxCompressedLength (uInt length);
+
+    // Encode a tile using the given codec.
+    // The tile consists of several parts (one per data column) starting at
+    // the given offsets. The values in a part have the given size
+    // (which is used for shuffling).
+    // The encoded tile (including its 1-byte header) is stored in the
+    // output buffer, which is resized as needed.
+    // It returns the length of the encoded tile.
+    static uInt encode (Type codec, Block<char>& out,
+                        const char* tile, uInt tileLength,
+                        const Block<uInt>& partOffset,
+                        const Block<uInt>& valueSize);
+
+    // Decode a tile encoded with function <src>encode</src>.
+    // The output buffer must have the length of the tile.
+    // An exception is thrown if the encoded data are corrupt.
+    static void decode (char* tile, uInt tileLength,
+                        const char* in, uInt inLength,
+                        const Block<uInt>& partOffset,
+                        const Block<uInt>& valueSize);
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -104,36 +104,36 @@ public:
     virtual ~TSMCoordColumn();
 
     // Set the shape of the coordinate vector in the given row.
-    void setShape (uInt rownr, const IPosition& shape);
+    void setShape (rownr_t rownr, const IPosition& shape);
 
     // Is the value shape defined in the given row?
-    Bool isShapeDefined (uInt rownr);
+    Bool isShapeDefined (rownr_t rownr);
 
     // Get the shape of the item in the given row.
-    IPosition shape (uInt rownr);
+    IPosition shape (rownr_t rownr);
 
     // Get a scalar value in the given row.
     // The buffer pointed to by dataPtr has to have the correct length
     // (which is guaranteed by the Scalar/ArrayColumn get function).
     // <group>
-    void getIntV      (uInt rownr, Int* dataPtr);
-    void getuIntV     (uInt rownr, uInt* dataPtr);
-    void getfloatV    (uInt rownr, float* dataPtr);
-    void getdoubleV   (uInt rownr, double* dataPtr);
-    void getComplexV  (uInt rownr, Complex* dataPtr);
-    void getDComplexV (uInt rownr, DComplex* dataPtr);
+    void getIntV      (rownr_t rownr, Int* dataPtr);
+    void getuIntV     (rownr_t rownr, uInt* dataPtr);
+    void getfloatV    (rownr_t rownr, float* dataPtr);
+    void getdoubleV   (rownr_t rownr, double* dataPtr);
+    void getComplexV  (rownr_t rownr, Complex* dataPtr);
+    void getDComplexV (rownr_t rownr, DComplex* dataPtr);
     // </group>
 
     // Put a scalar value into the given row.
     // The buffer pointed to by dataPtr has to have the correct length
     // (which is guaranteed by the Scalar/ArrayColumn put function).
     // <group>
-    void putIntV      (uInt rownr, const Int* dataPtr);
-    void putuIntV     (uInt rownr, const uInt* dataPtr);
-    void putfloatV    (uInt rownr, const float* dataPtr);
-    void putdoubleV   (uInt rownr, const double* dataPtr);
-    void putComplexV  (uInt rownr, const Complex* dataPtr);
-    void putDComplexV (uInt rownr, const DComplex* dataPtr);
+    void putIntV      (rownr_t rownr, const Int* dataPtr);
+    void putuIntV     (rownr_t rownr, const uInt* dataPtr);
+    void putfloatV    (rownr_t rownr, const float* dataPtr);
+    void putdoubleV   (rownr_t rownr, const double* dataPtr);
+    void putComplexV  (rownr_t rownr, const Complex* dataPtr);
+    void putDComplexV (rownr_t rownr, const DComplex* dataPtr);
     // </group>
 
     // Get the array value in the given row.
@@ -141,12 +141,12 @@ public:
     // (which is guaranteed by the ArrayColumn get function).
     // The default implementation thrown an "invalid operation exception".
     // <group>
-    void getArrayIntV      (uInt rownr, Array<Int>* dataPtr);
-    void getArrayuIntV     (uInt rownr, Array<uInt>* dataPtr);
-    void getArrayfloatV    (uInt rownr, Array<float>* dataPtr);
-    void getArraydoubleV   (uInt rownr, Array<double>* dataPtr);
-    void getArrayComplexV  (uInt rownr, Array<Complex>* dataPtr);
-    void getArrayDComplexV (uInt rownr, Array<DComplex>* dataPtr);
+    void getArrayIntV      (rownr_t rownr, Array<Int>* dataPtr);
+    void getArrayuIntV     (rownr_t rownr, Array<uInt>* dataPtr);
+    void getArrayfloatV    (rownr_t rownr, Array<float>* dataPtr);
+    void getArraydoubleV   (rownr_t rownr, Array<double>* dataPtr);
+    void getArrayComplexV  (rownr_t rownr, Array<Complex>* dataPtr);
+    void getArrayDComplexV (rownr_t rownr, Array<DComplex>* dataPtr);
     // </group>
 
     // Put the array value into the given row.
@@ -154,12 +154,12 @@ public:
     // (which is guaranteed by the ArrayColumn put function).
     // The default implementation thrown an "invalid operation exception".
     // <group>
-    void putArrayIntV      (uInt rownr, const Array<Int>* dataPtr);
-    void putArrayuIntV     (uInt rownr, const Array<uInt>* dataPtr);
-    void putArrayfloatV    (uInt rownr, const Array<float>* dataPtr);
-    void putArraydoubleV   (uInt rownr, const Array<double>* dataPtr);
-    void putArrayComplexV  (uInt rownr, const Array<Complex>* dataPtr);
-    void putArrayDComplexV (uInt rownr, const Array<DComplex>* dataPtr);
+    void putArrayIntV      (rownr_t rownr, const Array<Int>* dataPtr);
+    void putArrayuIntV     (rownr_t rownr, const Array<uInt>* dataPtr);
+    void putArrayfloatV    (rownr_t rownr, const Array<float>* dataPtr);
+    void putArraydoubleV   (rownr_t rownr, const Array<double>* dataPtr);
+    void putArrayComplexV  (rownr_t rownr, const Array<Complex>* dataPtr);
+    void putArrayDComplexV (rownr_t rownr, const Array<DComplex>* dataPtr);
     // </group>
 
 private:
@@ -32,22 +32,43 @@
 #include <casacore/tables/DataMan/TiledStMan.h>
 #include <casacore/tables/DataMan/TSMFile.h>
 #include <casacore/tables/DataMan/TSMColumn.h>
+#include <casacore/tables/DataMan/TSMPrefetch.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/Arrays/ArrayUtil.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Containers/RecordField.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Containers/BlockIO.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/IO/BucketFile.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/OS/Conversion.h>
 #include <casacore/casa/OS/HostInfo.h>
 #include <casacore/casa/string.h>                           // for memcpy
 #include <casacore/casa/iostream.h>
+#include <exception>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// Lock the access mutex of a hypercube only if it has a read-ahead thread.
+// Without such a thread the cache is only used by the caller, so the
+// (common) case without read-ahead does not pay for the locking.
+class TSMCubeAccessLock
+{
+public:
+    TSMCubeAccessLock (Mutex& mutex, Bool doLock)
+      : itsMutex (doLock ? &mutex : 0)
+      { if (itsMutex) itsMutex->lock(); }
+    ~TSMCubeAccessLock()
+      { if (itsMutex) itsMutex->unlock(); }
+private:
+    TSMCubeAccessLock (const TSMCubeAccessLock&);
+    TSMCubeAccessLock& operator= (const TSMCubeAccessLock&);
+    Mutex* itsMutex;
+};
+
 // Find out if local size is a multiple of 4, so we can move as integers.
 #define TSMCube_FindMult \
   uInt localPixelWords = 0; \
@@ -119,9 +140,14 @@ TSMCube::TSMCube (TiledStMan* stman, TSMFile* file,
   fileOffset_p   (0),
   cache_p        (0),
   userSetCache_p (False),
-  lastColAccess_p(NoAccess)
+  lastColAccess_p(NoAccess),
+  prefetch_p     (0),
+  raAccess_p     (NoAccess),
+  codec_p        (TSMCodec::None)
 {
     if (fileOffset < 0) {
+        // New hypercubes use the codec of the storage manager.
+        codec_p = stmanPtr_p->tileCodec();
         // TiledCellStMan uses an empty shape; setShape is called later. 
         if (! cubeShape.empty()) {
             // A shape is given, so set it.
@@ -147,7 +173,10 @@ TSMCube::TSMCube (TiledStMan* stman, AipsIO& ios,
   filePtr_p      (0),
   cache_p        (0),
   userSetCache_p (False),
-  lastColAccess_p(NoAccess)
+  lastColAccess_p(NoAccess),
+  prefetch_p     (0),
+  raAccess_p     (NoAccess),
+  codec_p        (TSMCodec::None)
 {
     Int fileSeqnr = getObject (ios);
     if (fileSeqnr >= 0) {
@@ -159,6 +188,8 @@ TSMCube::TSMCube (TiledStMan* stman, AipsIO& ios,
 
 TSMCube::~TSMCube()
 {
+    // Stop the read-ahead thread before the cache is deleted.
+    delete prefetch_p;
     delete cache_p;
     delete cachedTile_p;
 }
@@ -166,15 +197,18 @@ TSMCube::~TSMCube()
 
 void TSMCube::clearCache (Bool doFlush)
 {
+    stopPrefetch();
     if (doFlush) {
         flushCache();
     }
     if (cache_p != 0) {
         cache_p->clear (0, False);
     }
+    decoded_p.clear();
 }
 void TSMCube::emptyCache()
 {
+    stopPrefetch();
     if (cache_p != 0) {
         cache_p->resize (0);
     }
@@ -190,6 +224,9 @@ void TSMCube::showCacheStatistics (ostream& os) const
         os << "tileShape: " << tileShape_p << endl;
         os << "maxCacheSz:" << stmanPtr_p->maximumCacheSize() << endl;
         cache_p->showStatistics (os);
+        if (prefetch_p != 0) {
+            prefetch_p->showStatistics (os);
+        }
         os << "<<<" << endl;
     }
 }
@@ -292,6 +329,13 @@ void TSMCube::setShape (const IPosition& cubeShape, const IPosition& tileShape)
     tileShape_p  = adjustTileShape (cubeShape, tileShape);
     // Calculate the various variables.
     setup();
+    // A compressed cube gets its file space when the tiles are written.
+    if (codec_p != TSMCodec::None) {
+        tileOffset_p = Block<Int64> (nrTiles_p, Int64(0));
+        tileLength_p = Block<uInt> (nrTiles_p, 0u);
+        tileSpace_p  = Block<uInt> (nrTiles_p, 0u);
+        freeExtents_p.clear();
+    }
     // If used directly, create the cache.
     // It has to be done here, otherwise the file does not get extended if
     // no explicit put is done.
@@ -299,7 +343,9 @@ void TSMCube::setShape (const IPosition& cubeShape, const IPosition& tileShape)
       makeCache();
     }
     // Tell TSMFile that the file gets extended.
-    filePtr_p->extend (nrTiles_p * bucketSize_p);
+    if (codec_p == TSMCodec::None) {
+        filePtr_p->extend (nrTiles_p * bucketSize_p);
+    }
     // Initialize the coordinate columns (as far as needed).
     stmanPtr_p->initCoordinates (this);
     // Set flag if writing.
@@ -312,8 +358,12 @@ void TSMCube::putObject (AipsIO& ios)
     flushCache();
     // If the offset is small enough, write it as an old style file,
     // so older software can still read it.
+    // Version 3 is only used for compressed tiles.
     Bool vers1 = (fileOffset_p <= 2u*1024u*1024u*1024u);
-    if (vers1) {
+    if (codec_p != TSMCodec::None) {
+        ios << 3;                          // version 3
+        vers1 = False;
+    } else if (vers1) {
         ios << 1;                          // version 1
     } else {
         ios << 2;                          // version 2
@@ -333,6 +383,22 @@ void TSMCube::putObject (AipsIO& ios)
     } else {
 	ios << fileOffset_p;
     }
+    if (codec_p != TSMCodec::None) {
+        ios << Int(codec_p);
+        putBlock (ios, tileOffset_p, tileOffset_p.nelements());
+        putBlock (ios, tileLength_p, tileLength_p.nelements());
+        putBlock (ios, tileSpace_p, tileSpace_p.nelements());
+        Block<Int64> freeOffset (freeExtents_p.size());
+        Block<uInt>  freeLength (freeExtents_p.size());
+        uInt i = 0;
+        for (std::map<Int64,uInt>::const_iterator iter=freeExtents_p.begin();
+             iter!=freeExtents_p.end(); ++iter, ++i) {
+            freeOffset[i] = iter->first;
+            freeLength[i] = iter->second;
+        }
+        putBlock (ios, freeOffset, freeOffset.nelements());
+        putBlock (ios, freeLength, freeLength.nelements());
+    }
 }
 Int TSMCube::getObject (AipsIO& ios)
 {
@@ -352,6 +418,23 @@ Int TSMCube::getObject (AipsIO& ios)
     } else {
         ios >> fileOffset_p;
     }
+    codec_p = TSMCodec::None;
+    if (version >= 3) {
+        Int codec;
+        ios >> codec;
+        codec_p = TSMCodec::Type(codec);
+        getBlock (ios, tileOffset_p);
+        getBlock (ios, tileLength_p);
+        getBlock (ios, tileSpace_p);
+        Block<Int64> freeOffset;
+        Block<uInt>  freeLength;
+        getBlock (ios, freeOffset);
+        getBlock (ios, freeLength);
+        freeExtents_p.clear();
+        for (uInt i=0; i<freeOffset.nelements(); i++) {
+            freeExtents_p[freeOffset[i]] = freeLength[i];
+        }
+    }
     return fileSeqnr;
 }
 
@@ -377,6 +460,9 @@ void TSMCube::setup()
     bucketSize_p = stmanPtr_p->getLengthOffset (tileSize_p, externalOffset_p,
 						localOffset_p,
 						localTileLength_p);
+    if (codec_p != TSMCodec::None) {
+        stmanPtr_p->getElementSizes (elementSize_p);
+    }
 
     // Resize IPosition member variables used in accessSection()
     resizeTileSections();
@@ -405,11 +491,15 @@ void TSMCube::makeCache()
                                    bucketSize_p, nrTiles_p, 1, this,
                                    readCallBack, writeCallBack,
                                    initCallBack, deleteCallBack);
+        if (codec_p != TSMCodec::None) {
+            cache_p->setBucketIO (readBucketCallBack, writeBucketCallBack);
+        }
     }
 }
 
 void TSMCube::flushCache()
 {
+    stopPrefetch();
     if (cache_p != 0) {
 	cache_p->flush();
     }
@@ -417,15 +507,19 @@ void TSMCube::flushCache()
 
 void TSMCube::resyncCache()
 {
+    stopPrefetch();
     if (cache_p != 0) {
       cache_p->resync (nrTiles_p, 0, -1);
     }
+    decoded_p.clear();
 }
 
 void TSMCube::deleteCache()
 {
+    stopPrefetch();
     delete cache_p;
     cache_p = 0;
+    decoded_p.clear();
 }
 
 
@@ -441,6 +535,7 @@ void TSMCube::extend (uInt nr, const Record& coordValues,
     if (!extensible_p) {
         throw (TSMError ("Hypercube is not extensible"));
     }
+    stopPrefetch();
     // Make the cache here, otherwise nrTiles_p is too high.
     makeCache();
     uInt lastDim = nrdim_p - 1;
@@ -450,7 +545,18 @@ void TSMCube::extend (uInt nr, const Record& coordValues,
                              / tileShape_p(lastDim);
     nrTiles_p = nrTilesSubCube_p * tilesPerDim_p(lastDim);
     getCache()->extend (nrTiles_p - nrold);
-    filePtr_p->extend ((nrTiles_p - nrold) * bucketSize_p);
+    if (codec_p == TSMCodec::None) {
+        filePtr_p->extend ((nrTiles_p - nrold) * bucketSize_p);
+    } else {
+        tileOffset_p.resize (nrTiles_p);
+        tileLength_p.resize (nrTiles_p);
+        tileSpace_p.resize (nrTiles_p);
+        for (uInt i=nrold; i<nrTiles_p; i++) {
+            tileOffset_p[i] = 0;
+            tileLength_p[i] = 0;
+            tileSpace_p[i]  = 0;
+        }
+    }
     // Update the last coordinate (if there).
     if (lastCoordColumn != 0) {
         extendCoordinates (coordValues, lastCoordColumn->columnName(),
@@ -724,6 +830,113 @@ void TSMCube::deleteCallBack (void* owner, char* buffer)
         delete [] buffer;
     }
 }
+void TSMCube::readBucketCallBack (void* owner, uInt tileNr, char* external)
+{
+    ((TSMCube*)owner)->readCompressed (tileNr, external);
+}
+void TSMCube::readCompressed (uInt tileNr, char* external)
+{
+    // Use the tile if already decompressed by decodeTiles.
+    std::map<uInt, std::vector<char> >::iterator iter = decoded_p.find(tileNr);
+    if (iter != decoded_p.end()) {
+        memcpy (external, &(iter->second[0]), bucketSize_p);
+        decoded_p.erase (iter);
+        return;
+    }
+    // A tile not written yet contains zeroes.
+    if (tileNr >= tileLength_p.nelements()  ||  tileLength_p[tileNr] == 0) {
+        memset (external, 0, bucketSize_p);
+        return;
+    }
+    uInt length = tileLength_p[tileNr];
+    if (codecBuffer_p.nelements() < length) {
+        codecBuffer_p.resize (length, False, False);
+    }
+    BucketFile* file = filePtr_p->bucketFile();
+    file->seek (tileOffset_p[tileNr]);
+    file->read (codecBuffer_p.storage(), length);
+    TSMCodec::decode (external, bucketSize_p, codecBuffer_p.storage(), length,
+                      externalOffset_p, elementSize_p);
+}
+void TSMCube::writeBucketCallBack (void* owner, uInt tileNr,
+                                   const char* external)
+{
+    ((TSMCube*)owner)->writeCompressed (tileNr, external);
+}
+void TSMCube::writeCompressed (uInt tileNr, const char* external)
+{
+    uInt length = TSMCodec::encode (codec_p, codecBuffer_p,
+                                    external, bucketSize_p,
+                                    externalOffset_p, elementSize_p);
+    // Move the tile if it does not fit anymore. Free its old space first,
+    // so it can be merged with adjacent free space and be reused.
+    if (length > tileSpace_p[tileNr]) {
+        if (tileSpace_p[tileNr] > 0) {
+            addFreeExtent (tileOffset_p[tileNr], tileSpace_p[tileNr]);
+        }
+        Int64 offset;
+        uInt space;
+        if (! takeFreeExtent (length, offset, space)) {
+            // Reserve some space to let the tile grow.
+            offset = filePtr_p->length();
+            space  = length + length/8;
+            filePtr_p->extend (space);
+        }
+        tileOffset_p[tileNr] = offset;
+        tileSpace_p[tileNr]  = space;
+    }
+    BucketFile* file = filePtr_p->bucketFile();
+    file->seek (tileOffset_p[tileNr]);
+    file->write (codecBuffer_p.storage(), length);
+    tileLength_p[tileNr] = length;
+}
+
+void TSMCube::addFreeExtent (Int64 offset, uInt length)
+{
+    std::map<Int64,uInt>::iterator next = freeExtents_p.lower_bound (offset);
+    // Merge with the preceding extent if adjacent.
+    if (next != freeExtents_p.begin()) {
+        std::map<Int64,uInt>::iterator prev = next;
+        --prev;
+        if (prev->first + prev->second == offset) {
+            offset  = prev->first;
+            length += prev->second;
+            freeExtents_p.erase (prev);
+        }
+    }
+    // Merge with the next extent if adjacent.
+    if (next != freeExtents_p.end()  &&  offset + length == next->first) {
+        length += next->second;
+        freeExtents_p.erase (next);
+    }
+    freeExtents_p[offset] = length;
+}
+
+Bool TSMCube::takeFreeExtent (uInt length, Int64& offset, uInt& space)
+{
+    std::map<Int64,uInt>::iterator best = freeExtents_p.end();
+    for (std::map<Int64,uInt>::iterator iter=freeExtents_p.begin();
+         iter!=freeExtents_p.end(); ++iter) {
+        if (iter->second >= length  &&
+            (best == freeExtents_p.end()  ||  iter->second < best->second)) {
+            best = iter;
+        }
+    }
+    if (best == freeExtents_p.end()) {
+        return False;
+    }
+    offset = best->first;
+    space  = best->second;
+    freeExtents_p.erase (best);
+    // Keep the remainder free unless it is too small to be of use;
+    // in that case it serves as extra space for the tile.
+    uInt extra = length/8;
+    if (space > length + extra) {
+        addFreeExtent (offset + length + extra, space - length - extra);
+        space = length + extra;
+    }
+    return True;
+}
 char* TSMCube::initCallBack (void* owner)
 {
     uInt size = ((TSMCube*)owner)->localTileLength();
@@ -742,6 +955,204 @@ uInt TSMCube::cacheSize() const
     return cache_p->cacheSize();
 }
 
+Bool TSMCube::prefetchTile (uInt tileNr)
+{
+    ScopedMutexLock lock(accessMutex_p);
+    BucketCache* cachePtr = getCache();
+    if (tileNr >= cachePtr->nBucket()) {
+        return False;
+    }
+    cachePtr->getBucket (tileNr);
+    return True;
+}
+
+uInt TSMCube::prefetchDepth() const
+{
+#ifdef USE_THREADS
+    // The read-ahead thread does IO on the cube's file while holding only
+    // the access mutex of this cube. Hence the file must not be used by
+    // anything else, which is not the case for the file shared by the
+    // non-extensible hypercubes and for a MultiFile.
+    if (!extensible_p  ||  stmanPtr_p->multiFile() != 0) {
+        return 0;
+    }
+    Int depth = stmanPtr_p->tsmOption().prefetchDepth();
+    if (depth > 0) {
+        return depth;
+    }
+#endif
+    return 0;
+}
+
+void TSMCube::decodeTiles (const IPosition& startTile,
+                           const IPosition& endTile)
+{
+    // Find the stored tiles not in the cache yet.
+    BucketCache* cachePtr = getCache();
+    std::vector<uInt> tiles;
+    addTileNumbers (tiles, startTile, endTile);
+    std::vector<uInt> todo;
+    todo.reserve (tiles.size());
+    for (std::vector<uInt>::const_iterator iter=tiles.begin();
+         iter!=tiles.end(); ++iter) {
+        if (*iter < tileLength_p.nelements()  &&  tileLength_p[*iter] > 0
+        &&  !cachePtr->inCache(*iter)
+        &&  decoded_p.find(*iter) == decoded_p.end()) {
+            todo.push_back (*iter);
+        }
+    }
+    // Do not hold more tiles than fit in the maximum cache size.
+    uInt nr = validateCacheSize (todo.size());
+    if (nr < 2) {
+        return;
+    }
+    // Read the compressed tiles (serially) and decompress them in parallel.
+    std::vector<std::vector<char> > compressed(nr);
+    std::vector<std::vector<char> > tileData(nr);
+    BucketFile* file = filePtr_p->bucketFile();
+    for (uInt i=0; i<nr; i++) {
+        compressed[i].resize (tileLength_p[todo[i]]);
+        tileData[i].resize (bucketSize_p);
+        file->seek (tileOffset_p[todo[i]]);
+        file->read (&(compressed[i][0]), compressed[i].size());
+    }
+    std::vector<char> ok(nr, 1);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (Int i=0; i<Int(nr); i++) {
+        // A corrupt tile is skipped here; the error is reported when
+        // the cache reads it.
+        try {
+            TSMCodec::decode (&(tileData[i][0]), bucketSize_p,
+                              &(compressed[i][0]), compressed[i].size(),
+                              externalOffset_p, elementSize_p);
+        } catch (std::exception&) {
+            ok[i] = 0;
+        }
+    }
+    for (uInt i=0; i<nr; i++) {
+        if (ok[i]) {
+            decoded_p[todo[i]].swap (tileData[i]);
+        }
+    }
+}
+
+void TSMCube::stopPrefetch()
+{
+    if (prefetch_p != 0) {
+        prefetch_p->cancel();
+    }
+}
+
+void TSMCube::waitPrefetch()
+{
+    if (prefetch_p != 0) {
+        prefetch_p->wait();
+    }
+}
+
+void TSMCube::addTileNumbers (std::vector<uInt>& tiles,
+                              const IPosition& startTile,
+                              const IPosition& endTile) const
+{
+    IPosition tilePos (startTile);
+    uInt i;
+    while (True) {
+        tiles.push_back (expandedTilesPerDim_p.offset (tilePos));
+        for (i=0; i<nrdim_p; i++) {
+            if (++tilePos(i) <= endTile(i)) {
+                break;
+            }
+            tilePos(i) = startTile(i);
+        }
+        if (i == nrdim_p) {
+            break;
+        }
+    }
+}
+
+void TSMCube::readAhead (const IPosition& startTile, const IPosition& endTile,
+                         Bool writeFlag)
+{
+    uInt depth = prefetchDepth();
+    if (depth == 0) {
+        return;
+    }
+    // Do not read ahead while writing.
+    if (writeFlag) {
+        stopPrefetch();
+        raStartTile_p.resize (0);
+        return;
+    }
+    std::vector<uInt> tiles;
+    addTileNumbers (tiles, startTile, endTile);
+    if (prefetch_p != 0) {
+        prefetch_p->account (tiles);
+    }
+    // The access is regular if the tiles are those of the previous
+    // section shifted by a fixed step.
+    // Nothing needs to be done if the same tiles are accessed again.
+    IPosition step;
+    Bool regular = (raAccess_p == lastColAccess_p  &&
+                    raStartTile_p.nelements() == nrdim_p);
+    if (regular) {
+        step = startTile - raStartTile_p;
+        IPosition zero (nrdim_p, 0);
+        if (step.isEqual (zero)) {
+            if (endTile.isEqual (raEndTile_p)) {
+                return;
+            }
+            regular = False;
+        } else {
+            regular = step.isEqual (endTile - raEndTile_p);
+        }
+    }
+    raStartTile_p.resize (nrdim_p);
+    raEndTile_p.resize (nrdim_p);
+    raStartTile_p = startTile;
+    raEndTile_p   = endTile;
+    raAccess_p    = lastColAccess_p;
+    if (!regular) {
+        stopPrefetch();
+        return;
+    }
+    // The cache has to hold the current and next sections.
+    // Enlarge it if needed (unless the user has set its size).
+    uInt ntile = tiles.size();
+    if (!userSetCache_p  &&  cacheSize() < (depth+1) * ntile) {
+        setCacheSize ((depth+1) * ntile, False, False);
+    }
+    uInt nsect = cacheSize() / ntile;
+    if (nsect <= 1) {
+        return;
+    }
+    depth = std::min (depth, nsect-1);
+    // Queue the tiles of the next sections inside the cube.
+    std::vector<uInt> nextTiles;
+    IPosition st (startTile);
+    IPosition en (endTile);
+    for (uInt j=0; j<depth; j++) {
+        st += step;
+        en += step;
+        for (uInt i=0; i<nrdim_p; i++) {
+            if (st(i) < 0  ||  en(i) >= tilesPerDim_p(i)) {
+                j = depth;
+                break;
+            }
+        }
+        if (j < depth) {
+            addTileNumbers (nextTiles, st, en);
+        }
+    }
+    if (! nextTiles.empty()) {
+        if (prefetch_p == 0) {
+            prefetch_p = new TSMPrefetch (this);
+        }
+        prefetch_p->queue (nextTiles);
+    }
+}
+
 uInt TSMCube::validateCacheSize (uInt cacheSize) const
 {
   return validateCacheSize (cacheSize, stmanPtr_p->maximumCacheSize(),
@@ -767,6 +1178,7 @@ void TSMCube::setCacheSize (uInt cacheSize, Bool forceSmaller, Bool userSet)
     // the first of a bunch of accesses at the same tiles.
     // However, don't let the cache exceed the maximum,
     // unless it is only 10% more.
+    stopPrefetch();
     BucketCache* cachePtr = getCache();
     cacheSize = validateCacheSize (cacheSize);
     if (forceSmaller  ||  cacheSize > cachePtr->cacheSize()) {
@@ -972,8 +1384,15 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
             lineIndex = i;
         }
     }
+    // Read ahead if possible and serialize with the read-ahead thread.
+    readAhead (startTile_p, endTile_p, writeFlag);
+    TSMCubeAccessLock lock(accessMutex_p, prefetch_p != 0);
     // Get the cache.
     BucketCache* cachePtr = getCache();
+    // Decompress the compressed tiles of the section in parallel.
+    if (codec_p != TSMCodec::None  &&  !oneEntireTile) {
+        decodeTiles (startTile_p, endTile_p);
+    }
     
 //    cout << "nrTileSection_p=" << nrTileSection_p << endl;
 //    cout << "startTile_p=" << startTile_p << endl;
@@ -1340,6 +1759,17 @@ void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
 	stmanPtr_p->setDataChanged();
     }
     uInt i, j;
+    // Read ahead if possible and serialize with the read-ahead thread.
+    if (prefetchDepth() > 0) {
+        IPosition stTile (nrdim_p);
+        IPosition enTile (nrdim_p);
+        for (i=0; i<nrdim_p; i++) {
+            stTile(i) = start(i) / tileShape_p(i);
+            enTile(i) = end(i) / tileShape_p(i);
+        }
+        readAhead (stTile, enTile, writeFlag);
+    }
+    TSMCubeAccessLock lock(accessMutex_p, prefetch_p != 0);
     // Get the cache (if needed).
     BucketCache* cachePtr = getCache();
 
@@ -32,10 +32,14 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/TSMShape.h>
+#include <casacore/tables/DataMan/TSMCodec.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/OS/Mutex.h>
 #include <casacore/casa/OS/Conversion.h>
 #include <casacore/casa/iosfwd.h>
+#include <vector>
+#include <map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -44,6 +48,7 @@ class TiledStMan;
 class TSMFile;
 class TSMColumn;
 class BucketCache;
+class TSMPrefetch;
 template<class T> class Block;
 
 // <summary>
@@ -91,6 +96,38 @@ template<class T> class Block;
 // The description of class
 // <linkto class=ROTiledStManAccessor>ROTiledStManAccessor</linkto>
 // contains a discussion about the effect of setting the maximum cache size.
+// <p>
+// If a prefetch depth is given in the <linkto class=TSMOption>TSMOption</linkto>,
+// TSMCube reads tiles ahead using a
+// <linkto class=TSMPrefetch>TSMPrefetch</linkto> object.
+// When reading sections, it keeps track of the tiles accessed by the
+// previous section. If the tiles of the current section are those of the
+// previous section shifted by a fixed step (as is the case when iterating
+// using a TableIterator, LatticeIterator, or getColumnRange), the tiles of
+// the next sections are queued to be read by a background thread.
+// The access type set by TSMDataColumn (see <src>setLastColAccess</src>)
+// is taken into account; the prediction starts again if it changes.
+// The number of sections read ahead is limited by the cache size.
+// <br>Read-ahead is only done for an extensible hypercube not stored in a
+// MultiFile, because only then the cube's file is not used by others.
+// <p>
+// The tiles of a hypercube can be stored compressed using one of the
+// codecs in class <linkto class=TSMCodec>TSMCodec</linkto>. The codec is
+// taken from the storage manager when the hypercube is created and is kept
+// in the hypercube's header. The cache still holds the tiles uncompressed,
+// but the cache does not read and write the tiles itself. Instead they are
+// compressed and decompressed by TSMCube, which keeps an index
+// containing the offset and length of each compressed tile.
+// A compressed tile is rewritten in place if it fits in its space.
+// Otherwise it is moved to the best fitting free extent or to the end of
+// the file, where some extra space is reserved to let it grow a bit.
+// The space it used becomes a free extent, merged with adjacent free
+// extents. The space per tile and the free extents are kept in the
+// hypercube's header. A tile not written yet has length 0 and reads as
+// zeroes.
+// <br>When a section spanning multiple tiles is accessed, its compressed
+// tiles not in the cache are read and decompressed in parallel (using
+// OpenMP) before the section is accessed.
 // </synopsis> 
 
 // <motivation>
@@ -150,6 +187,9 @@ public:
     // Show the cache statistics.
     virtual void showCacheStatistics (ostream& os) const;
 
+    // Wait until the read-ahead thread (if any) has read the queued tiles.
+    void waitPrefetch();
+
     // Put the data of the object into the AipsIO stream.
     void putObject (AipsIO& ios);
 
@@ -230,6 +270,13 @@ public:
     // Get the current cache size (in buckets).
     uInt cacheSize() const;
 
+    // Get the codec used to compress the tiles.
+    TSMCodec::Type tileCodec() const;
+
+    // Read a tile into the cache. It is used by the read-ahead thread.
+    // It returns False if the tile could not be read.
+    Bool prefetchTile (uInt tileNr);
+
     // Calculate the cache size (in buckets) for the given slice
     // and access path.
     // <group>
@@ -322,6 +369,32 @@ private:
     // Delete the cache object.
     virtual void deleteCache();
 
+    // Get the number of sections to read ahead (0 = no read-ahead).
+    uInt prefetchDepth() const;
+
+    // Predict which tiles are needed for the next sections from the
+    // tiles accessed by the previous and current section and queue them
+    // for the read-ahead thread. The current tiles are accounted for
+    // in the read-ahead statistics.
+    // <br>Read-ahead is stopped when writing.
+    // <br>It must be called before the access mutex is acquired.
+    void readAhead (const IPosition& startTile, const IPosition& endTile,
+                    Bool writeFlag);
+
+    // Add the numbers of the tiles in the given tile box to the vector.
+    void addTileNumbers (std::vector<uInt>& tiles,
+                         const IPosition& startTile,
+                         const IPosition& endTile) const;
+
+    // Stop the read-ahead thread from accessing the cache, so it can be
+    // changed safely. It cancels the queued tiles.
+    void stopPrefetch();
+
+    // Decompress the stored tiles in the given tile box that are not in
+    // the cache. It is done in parallel. The tiles are kept aside until
+    // the cache asks for them.
+    void decodeTiles (const IPosition& startTile, const IPosition& endTile);
+
     // Access a line in a more optimized way.
     void accessLine (char* section, uInt pixelOffset,
 		     uInt localPixelSize,
@@ -338,8 +411,27 @@ private:
 			       const char* local);
     static char* initCallBack (void* owner);
     static void deleteCallBack (void* owner, char* buffer);
+    static void readBucketCallBack (void* owner, uInt tileNr, char* external);
+    static void writeBucketCallBack (void* owner, uInt tileNr,
+                                     const char* external);
     // </group>
 
+    // Define the functions doing the actual read and write of a
+    // compressed tile. They are used instead of the cache's IO.
+    // <group>
+    void readCompressed (uInt tileNr, char* external);
+    void writeCompressed (uInt tileNr, const char* external);
+    // </group>
+
+    // Add the file space of a compressed tile to the free extents.
+    // It is merged with adjacent free extents.
+    void addFreeExtent (Int64 offset, uInt length);
+
+    // Take the best fitting free extent for a compressed tile of the given
+    // length. The remainder of the extent stays free, unless it is small.
+    // False is returned if no free extent is large enough.
+    Bool takeFreeExtent (uInt length, Int64& offset, uInt& space);
+
     // Define the functions doing the actual read and write of the 
     // data in the tile and converting it to/from local format.
     // <group>
@@ -415,6 +507,33 @@ protected:
     IPosition endPixelInFirstTile_p;
     // Last pixel in last tile
     IPosition endPixelInLastTile_p;
+
+    // The read-ahead engine (only created if needed).
+    TSMPrefetch*    prefetch_p;
+    // Serializes the cache access of the caller and read-ahead thread.
+    // The caller only locks it if the read-ahead thread exists.
+    Mutex           accessMutex_p;
+    // The tile box of the previous section read (for read-ahead).
+    IPosition       raStartTile_p;
+    IPosition       raEndTile_p;
+    // The access type of the previous section read.
+    AccessType      raAccess_p;
+    // The codec used to compress the tiles.
+    TSMCodec::Type  codec_p;
+    // The file offset and length of each compressed tile (0 = not stored).
+    Block<Int64>    tileOffset_p;
+    Block<uInt>     tileLength_p;
+    // The space available for each compressed tile in the file.
+    Block<uInt>     tileSpace_p;
+    // The free extents (offset and length) in the file after moving
+    // compressed tiles.
+    std::map<Int64, uInt> freeExtents_p;
+    // The size of a value in each data column (used for shuffling).
+    Block<uInt>     elementSize_p;
+    // Buffer holding a compressed tile.
+    Block<char>     codecBuffer_p;
+    // The tiles decompressed by decodeTiles, but not yet in the cache.
+    std::map<uInt, std::vector<char> > decoded_p;
 };
 
 
@@ -450,6 +569,10 @@ inline Record& TSMCube::rwValueRecord()
 {
     return values_p;
 }
+inline TSMCodec::Type TSMCube::tileCodec() const
+{
+    return codec_p;
+}
 inline Bool TSMCube::userSetCache() const
 {
     return userSetCache_p;
@@ -105,12 +105,12 @@ Bool TSMDataColumn::canChangeShape() const
     return stmanPtr_p->canChangeShape();
 }
 
-void TSMDataColumn::setShape (uInt rownr, const IPosition& shape)
+void TSMDataColumn::setShape (rownr_t rownr, const IPosition& shape)
 {
     setShapeTiled (rownr, shape, stmanPtr_p->defaultTileShape());
 }
 
-void TSMDataColumn::setShapeTiled (uInt rownr, const IPosition& shape,
+void TSMDataColumn::setShapeTiled (rownr_t rownr, const IPosition& shape,
 				   const IPosition& tileShape)
 {
     TSMCube* hypercube = stmanPtr_p->getHypercube (rownr);
@@ -131,7 +131,7 @@ void TSMDataColumn::setShapeTiled (uInt rownr, const IPosition& shape,
     }
 }
 
-Bool TSMDataColumn::isShapeDefined (uInt rownr)
+Bool TSMDataColumn::isShapeDefined (rownr_t rownr)
 {
     //# The shape is defined when the shape is fixed or when
     //# a hypercube has been defined for this row.
@@ -142,7 +142,7 @@ Bool TSMDataColumn::isShapeDefined (uInt rownr)
     return (hypercube->cubeShape().nelements() != 0);
 }
 
-IPosition TSMDataColumn::shape (uInt rownr)
+IPosition TSMDataColumn::shape (rownr_t rownr)
 {
     //# Return the shape when it is fixed.
     if (shapeColumn().nelements() != 0) {
@@ -165,7 +165,7 @@ IPosition TSMDataColumn::shape (uInt rownr)
 }
 
 
-void TSMDataColumn::accessCell (uInt rownr, const void* dataPtr, 
+void TSMDataColumn::accessCell (rownr_t rownr, const void* dataPtr, 
 				Bool writeFlag)
 {
     // Get the hypercube the row is in.
@@ -190,7 +190,7 @@ void TSMDataColumn::accessCell (uInt rownr, const void* dataPtr,
 			      localPixelSize_p, tilePixelSize_p, writeFlag);
 }
 
-void TSMDataColumn::accessCellSlice (uInt rownr, const Slicer& ns,
+void TSMDataColumn::accessCellSlice (rownr_t rownr, const Slicer& ns,
 				     const void* dataPtr, Bool writeFlag)
 {
     IPosition end;
@@ -322,9 +322,9 @@ void TSMDataColumn::accessColumnCells (const RefRows& rownrs,
   // Step through all rownr intervals and all rownrs in each interval.
   RefRowsSliceIter iter(rownrs);
   while (! iter.pastEnd()) {
-    uInt rownr = iter.sliceStart();
-    uInt erow = iter.sliceEnd();
-    uInt irow = iter.sliceIncr();
+    rownr_t rownr = iter.sliceStart();
+    rownr_t erow = iter.sliceEnd();
+    rownr_t irow = iter.sliceIncr();
     while (rownr <= erow) {
       // Get the hypercube and the position of the row in it.
       // A read has to be done if we have another hypercube
@@ -404,9 +404,9 @@ void TSMDataColumn::accessColumnSliceCells (const RefRows& rownrs,
   // Step through all rownr intervals and all rownrs in each interval.
   RefRowsSliceIter iter(rownrs);
   while (! iter.pastEnd()) {
-    uInt rownr = iter.sliceStart();
-    uInt erow = iter.sliceEnd();
-    uInt irow = iter.sliceIncr();
+    rownr_t rownr = iter.sliceStart();
+    rownr_t erow = iter.sliceEnd();
+    rownr_t irow = iter.sliceIncr();
     while (rownr <= erow) {
       // Get the hypercube and the position of the row in it.
       // A read has to be done if we have another hypercube
@@ -517,17 +517,17 @@ void TSMDataColumn::accessSlicedCells (TSMCube* hypercube,
 }
 
 
-void TSMDataColumn::getfloatV (uInt rownr, float* dataPtr)
+void TSMDataColumn::getfloatV (rownr_t rownr, float* dataPtr)
 {
     accessCell (rownr, dataPtr, False);
 }
-void TSMDataColumn::putfloatV (uInt rownr, const float* dataPtr)
+void TSMDataColumn::putfloatV (rownr_t rownr, const float* dataPtr)
 {
     accessCell (rownr, dataPtr, True);
 }
 
 
-void TSMDataColumn::getArrayfloatV (uInt rownr, Array<float>* dataPtr)
+void TSMDataColumn::getArrayfloatV (rownr_t rownr, Array<float>* dataPtr)
 {
     Bool deleteIt;
     float* data = dataPtr->getStorage (deleteIt);
@@ -535,7 +535,7 @@ void TSMDataColumn::getArrayfloatV (uInt rownr, Array<float>* dataPtr)
     dataPtr->putStorage (data, deleteIt);
 }
 
-void TSMDataColumn::putArrayfloatV (uInt rownr, const Array<float>* dataPtr)
+void TSMDataColumn::putArrayfloatV (rownr_t rownr, const Array<float>* dataPtr)
 {
     Bool deleteIt;
     const float* data = dataPtr->getStorage (deleteIt);
@@ -543,7 +543,7 @@ void TSMDataColumn::putArrayfloatV (uInt rownr, const Array<float>* dataPtr)
     dataPtr->freeStorage (data, deleteIt);
 }
 
-void TSMDataColumn::getSlicefloatV (uInt rownr, const Slicer& ns,
+void TSMDataColumn::getSlicefloatV (rownr_t rownr, const Slicer& ns,
 				    Array<float>* dataPtr)
 {
     Bool deleteIt;
@@ -551,7 +551,7 @@ void TSMDataColumn::getSlicefloatV (uInt rownr, const Slicer& ns,
     accessCellSlice (rownr, ns, data, False);
     dataPtr->putStorage (data, deleteIt);
 }
-void TSMDataColumn::putSlicefloatV (uInt rownr, const Slicer& ns,
+void TSMDataColumn::putSlicefloatV (rownr_t rownr, const Slicer& ns,
 				    const Array<float>* dataPtr)
 {
     Bool deleteIt;
@@ -690,29 +690,29 @@ void TSMDataColumn::putColumnSliceCellsfloatV (const RefRows& rownrs,
 
 
 #define TSMDATACOLUMN_GETPUT(T,NM) \
-void TSMDataColumn::aips_name2(get,NM) (uInt rownr, T* dataPtr) \
+void TSMDataColumn::aips_name2(get,NM) (rownr_t rownr, T* dataPtr) \
 { \
     accessCell (rownr, dataPtr, False); \
 } \
-void TSMDataColumn::aips_name2(put,NM) (uInt rownr, const T* dataPtr) \
+void TSMDataColumn::aips_name2(put,NM) (rownr_t rownr, const T* dataPtr) \
 { \
     accessCell (rownr, dataPtr, True); \
 } \
-void TSMDataColumn::aips_name2(getArray,NM) (uInt rownr, Array<T>* dataPtr) \
+void TSMDataColumn::aips_name2(getArray,NM) (rownr_t rownr, Array<T>* dataPtr) \
 { \
     Bool deleteIt; \
     T* data = dataPtr->getStorage (deleteIt); \
     accessCell (rownr, data, False); \
     dataPtr->putStorage (data, deleteIt); \
 } \
-void TSMDataColumn::aips_name2(putArray,NM) (uInt rownr, const Array<T>* dataPtr) \
+void TSMDataColumn::aips_name2(putArray,NM) (rownr_t rownr, const Array<T>* dataPtr) \
 { \
     Bool deleteIt; \
     const T* data = dataPtr->getStorage (deleteIt); \
     accessCell (rownr, data, True); \
     dataPtr->freeStorage (data, deleteIt); \
 } \
-void TSMDataColumn::aips_name2(getSlice,NM) (uInt rownr, const Slicer& ns, \
+void TSMDataColumn::aips_name2(getSlice,NM) (rownr_t rownr, const Slicer& ns, \
 					     Array<T>* dataPtr) \
 { \
     Bool deleteIt; \
@@ -720,7 +720,7 @@ void TSMDataColumn::aips_name2(getSlice,NM) (uInt rownr, const Slicer& ns, \
     accessCellSlice (rownr, ns, data, False); \
     dataPtr->putStorage (data, deleteIt); \
 } \
-void TSMDataColumn::aips_name2(putSlice,NM) (uInt rownr, const Slicer& ns, \
+void TSMDataColumn::aips_name2(putSlice,NM) (rownr_t rownr, const Slicer& ns, \
 					     const Array<T>* dataPtr) \
 { \
     Bool deleteIt; \
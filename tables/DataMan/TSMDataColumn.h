@@ -134,52 +134,52 @@ public:
     // Set the shape of the data array in the given row.
     // It will check if it matches already defined data and coordinates shapes.
     // It will define undefined data and coordinates shapes.
-    void setShape (uInt rownr, const IPosition& shape);
+    void setShape (rownr_t rownr, const IPosition& shape);
 
     // Set the shape and tile shape of the array in the given row.
     // It will check if it matches already defined data and coordinates shapes.
     // It will define undefined data and coordinates shapes.
     // The tile shape is adjusted to the array shape (size 0 gets set to 1;
     // size > cubesize gets set to the cubesize).
-    void setShapeTiled (uInt rownr, const IPosition& shape,
+    void setShapeTiled (rownr_t rownr, const IPosition& shape,
 			const IPosition& tileShape);
 
     // Is the value shape defined in the given row?
-    Bool isShapeDefined (uInt rownr);
+    Bool isShapeDefined (rownr_t rownr);
 
     // Get the shape of the item in the given row.
-    IPosition shape (uInt rownr);
+    IPosition shape (rownr_t rownr);
 
     // Get a scalar value in the given row.
     // The buffer pointed to by dataPtr has to have the correct length
     // (which is guaranteed by the Scalar/ArrayColumn get function).
     // <group>
-    void getBoolV     (uInt rownr, Bool* dataPtr);
-    void getuCharV    (uInt rownr, uChar* dataPtr);
-    void getShortV    (uInt rownr, Short* dataPtr);
-    void getuShortV   (uInt rownr, uShort* dataPtr);
-    void getIntV      (uInt rownr, Int* dataPtr);
-    void getuIntV     (uInt rownr, uInt* dataPtr);
-    void getfloatV    (uInt rownr, float* dataPtr);
-    void getdoubleV   (uInt rownr, double* dataPtr);
-    void getComplexV  (uInt rownr, Complex* dataPtr);
-    void getDComplexV (uInt rownr, DComplex* dataPtr);
+    void getBoolV     (rownr_t rownr, Bool* dataPtr);
+    void getuCharV    (rownr_t rownr, uChar* dataPtr);
+    void getShortV    (rownr_t rownr, Short* dataPtr);
+    void getuShortV   (rownr_t rownr, uShort* dataPtr);
+    void getIntV      (rownr_t rownr, Int* dataPtr);
+    void getuIntV     (rownr_t rownr, uInt* dataPtr);
+    void getfloatV    (rownr_t rownr, float* dataPtr);
+    void getdoubleV   (rownr_t rownr, double* dataPtr);
+    void getComplexV  (rownr_t rownr, Complex* dataPtr);
+    void getDComplexV (rownr_t rownr, DComplex* dataPtr);
     // </group>
 
     // Put a scalar value into the given row.
     // The buffer pointed to by dataPtr has to have the correct length
     // (which is guaranteed by the Scalar/ArrayColumn put function).
     // <group>
-    void putBoolV     (uInt rownr, const Bool* dataPtr);
-    void putuCharV    (uInt rownr, const uChar* dataPtr);
-    void putShortV    (uInt rownr, const Short* dataPtr);
-    void putuShortV   (uInt rownr, const uShort* dataPtr);
-    void putIntV      (uInt rownr, const Int* dataPtr);
-    void putuIntV     (uInt rownr, const uInt* dataPtr);
-    void putfloatV    (uInt rownr, const float* dataPtr);
-    void putdoubleV   (uInt rownr, const double* dataPtr);
-    void putComplexV  (uInt rownr, const Complex* dataPtr);
-    void putDComplexV (uInt rownr, const DComplex* dataPtr);
+    void putBoolV     (rownr_t rownr, const Bool* dataPtr);
+    void putuCharV    (rownr_t rownr, const uChar* dataPtr);
+    void putShortV    (rownr_t rownr, const Short* dataPtr);
+    void putuShortV   (rownr_t rownr, const uShort* dataPtr);
+    void putIntV      (rownr_t rownr, const Int* dataPtr);
+    void putuIntV     (rownr_t rownr, const uInt* dataPtr);
+    void putfloatV    (rownr_t rownr, const float* dataPtr);
+    void putdoubleV   (rownr_t rownr, const double* dataPtr);
+    void putComplexV  (rownr_t rownr, const Complex* dataPtr);
+    void putDComplexV (rownr_t rownr, const DComplex* dataPtr);
     // </group>
 
     // Get the array value in the given row.
@@ -187,16 +187,16 @@ public:
     // (which is guaranteed by the ArrayColumn get function).
     // The default implementation thrown an "invalid operation exception".
     // <group>
-    void getArrayBoolV     (uInt rownr, Array<Bool>* dataPtr);
-    void getArrayuCharV    (uInt rownr, Array<uChar>* dataPtr);
-    void getArrayShortV    (uInt rownr, Array<Short>* dataPtr);
-    void getArrayuShortV   (uInt rownr, Array<uShort>* dataPtr);
-    void getArrayIntV      (uInt rownr, Array<Int>* dataPtr);
-    void getArrayuIntV     (uInt rownr, Array<uInt>* dataPtr);
-    void getArrayfloatV    (uInt rownr, Array<float>* dataPtr);
-    void getArraydoubleV   (uInt rownr, Array<double>* dataPtr);
-    void getArrayComplexV  (uInt rownr, Array<Complex>* dataPtr);
-    void getArrayDComplexV (uInt rownr, Array<DComplex>* dataPtr);
+    void getArrayBoolV     (rownr_t rownr, Array<Bool>* dataPtr);
+    void getArrayuCharV    (rownr_t rownr, Array<uChar>* dataPtr);
+    void getArrayShortV    (rownr_t rownr, Array<Short>* dataPtr);
+    void getArrayuShortV   (rownr_t rownr, Array<uShort>* dataPtr);
+    void getArrayIntV      (rownr_t rownr, Array<Int>* dataPtr);
+    void getArrayuIntV     (rownr_t rownr, Array<uInt>* dataPtr);
+    void getArrayfloatV    (rownr_t rownr, Array<float>* dataPtr);
+    void getArraydoubleV   (rownr_t rownr, Array<double>* dataPtr);
+    void getArrayComplexV  (rownr_t rownr, Array<Complex>* dataPtr);
+    void getArrayDComplexV (rownr_t rownr, Array<DComplex>* dataPtr);
     // </group>
 
     // Put the array value into the given row.
@@ -204,58 +204,58 @@ public:
     // (which is guaranteed by the ArrayColumn put function).
     // The default implementation thrown an "invalid operation exception".
     // <group>
-    void putArrayBoolV     (uInt rownr, const Array<Bool>* dataPtr);
-    void putArrayuCharV    (uInt rownr, const Array<uChar>* dataPtr);
-    void putArrayShortV    (uInt rownr, const Array<Short>* dataPtr);
-    void putArrayuShortV   (uInt rownr, const Array<uShort>* dataPtr);
-    void putArrayIntV      (uInt rownr, const Array<Int>* dataPtr);
-    void putArrayuIntV     (uInt rownr, const Array<uInt>* dataPtr);
-    void putArrayfloatV    (uInt rownr, const Array<float>* dataPtr);
-    void putArraydoubleV   (uInt rownr, const Array<double>* dataPtr);
-    void putArrayComplexV  (uInt rownr, const Array<Complex>* dataPtr);
-    void putArrayDComplexV (uInt rownr, const Array<DComplex>* dataPtr);
+    void putArrayBoolV     (rownr_t rownr, const Array<Bool>* dataPtr);
+    void putArrayuCharV    (rownr_t rownr, const Array<uChar>* dataPtr);
+    void putArrayShortV    (rownr_t rownr, const Array<Short>* dataPtr);
+    void putArrayuShortV   (rownr_t rownr, const Array<uShort>* dataPtr);
+    void putArrayIntV      (rownr_t rownr, const Array<Int>* dataPtr);
+    void putArrayuIntV     (rownr_t rownr, const Array<uInt>* dataPtr);
+    void putArrayfloatV    (rownr_t rownr, const Array<float>* dataPtr);
+    void putArraydoubleV   (rownr_t rownr, const Array<double>* dataPtr);
+    void putArrayComplexV  (rownr_t rownr, const Array<Complex>* dataPtr);
+    void putArrayDComplexV (rownr_t rownr, const Array<DComplex>* dataPtr);
     // </group>
 
-    void getSliceBoolV     (uInt rownr, const Slicer& slicer,
+    void getSliceBoolV     (rownr_t rownr, const Slicer& slicer,
 			    Array<Bool>* dataPtr);
-    void getSliceuCharV    (uInt rownr, const Slicer& slicer,
+    void getSliceuCharV    (rownr_t rownr, const Slicer& slicer,
 			    Array<uChar>* dataPtr);
-    void getSliceShortV    (uInt rownr, const Slicer& slicer,
+    void getSliceShortV    (rownr_t rownr, const Slicer& slicer,
 			    Array<Short>* dataPtr);
-    void getSliceuShortV   (uInt rownr, const Slicer& slicer,
+    void getSliceuShortV   (rownr_t rownr, const Slicer& slicer,
 			    Array<uShort>* dataPtr);
-    void getSliceIntV      (uInt rownr, const Slicer& slicer,
+    void getSliceIntV      (rownr_t rownr, const Slicer& slicer,
 			    Array<Int>* dataPtr);
-    void getSliceuIntV     (uInt rownr, const Slicer& slicer,
+    void getSliceuIntV     (rownr_t rownr, const Slicer& slicer,
 			    Array<uInt>* dataPtr);
-    void getSlicefloatV    (uInt rownr, const Slicer& slicer,
+    void getSlicefloatV    (rownr_t rownr, const Slicer& slicer,
 			    Array<float>* dataPtr);
-    void getSlicedoubleV   (uInt rownr, const Slicer& slicer,
+    void getSlicedoubleV   (rownr_t rownr, const Slicer& slicer,
 			    Array<double>* dataPtr);
-    void getSliceComplexV  (uInt rownr, const Slicer& slicer,
+    void getSliceComplexV  (rownr_t rownr, const Slicer& slicer,
 			    Array<Complex>* dataPtr);
-    void getSliceDComplexV (uInt rownr, const Slicer& slicer,
+    void getSliceDComplexV (rownr_t rownr, const Slicer& slicer,
 			    Array<DComplex>* dataPtr);
 
-    void putSliceBoolV     (uInt rownr, const Slicer& slicer,
+    void putSliceBoolV     (rownr_t rownr, const Slicer& slicer,
 			    const Array<Bool>* dataPtr);
-    void putSliceuCharV    (uInt rownr, const Slicer& slicer,
+    void putSliceuCharV    (rownr_t rownr, const Slicer& slicer,
 			    const Array<uChar>* dataPtr);
-    void putSliceShortV    (uInt rownr, const Slicer& slicer,
+    void putSliceShortV    (rownr_t rownr, const Slicer& slicer,
 			    const Array<Short>* dataPtr);
-    void putSliceuShortV   (uInt rownr, const Slicer& slicer,
+    void putSliceuShortV   (rownr_t rownr, const Slicer& slicer,
 			    const Array<uShort>* dataPtr);
-    void putSliceIntV      (uInt rownr, const Slicer& slicer,
+    void putSliceIntV      (rownr_t rownr, const Slicer& slicer,
 			    const Array<Int>* dataPtr);
-    void putSliceuIntV     (uInt rownr, const Slicer& slicer,
+    void putSliceuIntV     (rownr_t rownr, const Slicer& slicer,
 			    const Array<uInt>* dataPtr);
-    void putSlicefloatV    (uInt rownr, const Slicer& slicer,
+    void putSlicefloatV    (rownr_t rownr, const Slicer& slicer,
 			    const Array<float>* dataPtr);
-    void putSlicedoubleV   (uInt rownr, const Slicer& slicer,
+    void putSlicedoubleV   (rownr_t rownr, const Slicer& slicer,
 			    const Array<double>* dataPtr);
-    void putSliceComplexV  (uInt rownr, const Slicer& slicer,
+    void putSliceComplexV  (rownr_t rownr, const Slicer& slicer,
 			    const Array<Complex>* dataPtr);
-    void putSliceDComplexV (uInt rownr, const Slicer& slicer,
+    void putSliceDComplexV (rownr_t rownr, const Slicer& slicer,
 			    const Array<DComplex>* dataPtr);
 
     void getScalarColumnBoolV     (Vector<Bool>* arr);
@@ -564,11 +564,11 @@ private:
     // Read or write a data cell in the cube.
     // A cell can contain a scalar or an array (depending on the
     // column definition).
-    void accessCell (uInt rownr,
+    void accessCell (rownr_t rownr,
 		     const void* dataPtr, Bool writeFlag);
 
     // Read or write a slice of a data cell in the cube.
-    void accessCellSlice (uInt rownr, const Slicer& ns,
+    void accessCellSlice (rownr_t rownr, const Slicer& ns,
 			  const void* dataPtr, Bool writeFlag);
 
     // Read or write an entire column.
@@ -31,10 +31,11 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   TSMOption::TSMOption (TSMOption::Option option, Int bufferSize,
-                        Int maxCacheSizeMB)
-    : itsOption       (option),
-      itsBufferSize   (bufferSize),
-      itsMaxCacheSize (maxCacheSizeMB)
+                        Int maxCacheSizeMB, Int prefetchDepth)
+    : itsOption        (option),
+      itsBufferSize    (bufferSize),
+      itsMaxCacheSize  (maxCacheSizeMB),
+      itsPrefetchDepth (prefetchDepth)
   {}
 
   void TSMOption::fillOption (Bool newTable)
@@ -67,6 +68,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (itsMaxCacheSize <= -2) {
       AipsrcValue<Int>::find (itsMaxCacheSize, "table.tsm.maxcachesizemb", -1);
     }
+    // Default is no read-ahead.
+    if (itsPrefetchDepth <= -2) {
+      AipsrcValue<Int>::find (itsPrefetchDepth, "table.tsm.prefetchdepth", 0);
+    }
+    if (itsPrefetchDepth < 0) {
+      itsPrefetchDepth = 0;
+    }
     // Default is to use the old caching behaviour
     // Abandoned default to use mmap for existing files on 64 bit systems.
     if (itsOption == TSMOption::Default) {
@@ -77,6 +77,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //       The maximum cache size can be given as a constructor argument.
 //  <li> <src>TSMOption::MMap</src>
 //       Use memory-mapped IO.
+//       This option is also used by the Standard Storage Manager for
+//       tables opened readonly. It makes it possible to use the data
+//       directly from the mapped file without copying them.
 //  <li> <src>TSMOption::Buffer</src>
 //       Use buffered file IO without.
 //       The buffer size can be given as a constructor argument.
@@ -109,6 +112,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> <src>tables.tsm.buffersize</src> gives the buffer size for option
 //       <src>TSMOption::Buffer</src>. A value <=0 means use the default 4096.
 //       It defaults to 0.
+//  <li> <src>tables.tsm.prefetchdepth</src> gives the number of sections
+//       to read ahead for option <src>TSMOption::Cache</src>.
+//       If the hypercube is read in a regular way (e.g. by a TableIterator
+//       or LatticeIterator), the tiles of the next sections are read by
+//       a background thread. A value <=0 means no read-ahead.
+//       It defaults to 0. Note that read-ahead requires casacore to be
+//       built with thread support. It is only done for extensible
+//       hypercubes in a table not using a MultiFile.
 // </ul>
 // </synopsis>
 
@@ -134,7 +145,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // The parameter values are described in the synopsis.
     // A size value -2 means reading that size from the aipsrc file.
     TSMOption (Option option=Aipsrc, Int bufferSize=-2,
-               Int maxCacheSizeMB=-2);
+               Int maxCacheSizeMB=-2, Int prefetchDepth=-2);
 
     // Fill the option in case Aipsrc or Default was given.
     // It is done as explained in the synopsis.
@@ -152,10 +163,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int maxCacheSizeMB() const
       { return itsMaxCacheSize; }
 
+    // Get the number of sections to read ahead. 0 means no read-ahead.
+    Int prefetchDepth() const
+      { return itsPrefetchDepth; }
+
   private:
     Option itsOption;
     Int    itsBufferSize;
     Int    itsMaxCacheSize;
+    Int    itsPrefetchDepth;
   };
 
 } //# NAMESPACE CASACORE - END
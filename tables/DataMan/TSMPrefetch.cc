@@ -0,0 +1,239 @@
+//# TSMPrefetch.cc: Read tiles of a hypercube ahead in a background thread
+//# Copyright (C) 2015
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/DataMan/TSMPrefetch.h>
+#include <casacore/tables/DataMan/TSMCube.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#ifdef USE_THREADS
+#include <pthread.h>
+#endif
+
+#define ITSTHREAD \
+  (static_cast<pthread_t*>(itsThread))
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TSMPrefetch::TSMPrefetch (TSMCube* cube)
+: itsCube      (cube),
+  itsBusy      (False),
+  itsStop      (False),
+  itsThread    (0),
+  itsNPrefetch (0),
+  itsNHit      (0),
+  itsNMiss     (0)
+{}
+
+TSMPrefetch::~TSMPrefetch()
+{
+#ifdef USE_THREADS
+    if (itsThread != 0) {
+        {
+	    ScopedMutexLock lock(itsMutex);
+	    itsStop = True;
+	    itsCondition.broadcast();
+	}
+	pthread_join (*ITSTHREAD, 0);
+	delete ITSTHREAD;
+    }
+#endif
+}
+
+void TSMPrefetch::startThread()
+{
+#ifdef USE_THREADS
+    if (itsThread == 0) {
+        itsThread = new pthread_t;
+	int error = pthread_create (ITSTHREAD, 0, runThread, this);
+	if (error != 0) {
+	    delete ITSTHREAD;
+	    itsThread = 0;
+	    throw SystemCallError ("pthread_create", error);
+	}
+    }
+#endif
+}
+
+void* TSMPrefetch::runThread (void* prefetcher)
+{
+    static_cast<TSMPrefetch*>(prefetcher)->run();
+    return 0;
+}
+
+void TSMPrefetch::run()
+{
+    while (True) {
+        uInt tileNr;
+	{
+	    ScopedMutexLock lock(itsMutex);
+	    // Wait for a tile still to be read.
+	    while (!itsStop  &&  (itsQueue.empty()  ||
+			itsQueued.find(itsQueue.front()) == itsQueued.end())) {
+	        if (itsQueue.empty()) {
+		    itsCondition.wait (itsMutex);
+		} else {
+		    itsQueue.pop_front();
+		}
+	    }
+	    if (itsStop) {
+	        break;
+	    }
+	    tileNr = itsQueue.front();
+	    itsQueue.pop_front();
+	    itsBusy = True;
+	}
+	// Read the tile without holding the lock, so the main thread can
+	// queue and account meanwhile.
+	// Errors are ignored; they will show up when the tile is accessed.
+	Bool done = False;
+	try {
+	    done = itsCube->prefetchTile (tileNr);
+	} catch (std::exception&) {
+	}
+	{
+	    ScopedMutexLock lock(itsMutex);
+	    itsBusy = False;
+	    // Only register it if not accessed or cancelled meanwhile.
+	    if (itsQueued.erase (tileNr) > 0  &&  done) {
+	        itsLoaded.insert (tileNr);
+		itsNPrefetch++;
+	    }
+	    itsCondition.broadcast();
+	}
+    }
+}
+
+void TSMPrefetch::queue (const std::vector<uInt>& tiles)
+{
+#ifdef USE_THREADS
+    Bool added = False;
+    {
+        ScopedMutexLock lock(itsMutex);
+	for (std::vector<uInt>::const_iterator iter=tiles.begin();
+	     iter!=tiles.end(); ++iter) {
+	    if (itsLoaded.find(*iter) == itsLoaded.end()
+	    &&  itsQueued.insert(*iter).second) {
+	        itsQueue.push_back (*iter);
+		added = True;
+	    }
+	}
+	if (added) {
+	    itsCondition.broadcast();
+	}
+    }
+    if (added) {
+        startThread();
+    }
+#else
+    (void)tiles;
+#endif
+}
+
+void TSMPrefetch::account (const std::vector<uInt>& tiles)
+{
+    ScopedMutexLock lock(itsMutex);
+    for (std::vector<uInt>::const_iterator iter=tiles.begin();
+	 iter!=tiles.end(); ++iter) {
+        if (itsLoaded.erase (*iter) > 0) {
+	    itsNHit++;
+	} else {
+	    // The caller reads it itself, so the thread does not need to.
+	    itsQueued.erase (*iter);
+	    itsNMiss++;
+	}
+    }
+}
+
+void TSMPrefetch::cancel()
+{
+    ScopedMutexLock lock(itsMutex);
+    itsQueue.clear();
+    itsQueued.clear();
+    while (itsBusy) {
+        itsCondition.wait (itsMutex);
+    }
+    itsLoaded.clear();
+}
+
+void TSMPrefetch::wait()
+{
+    // The thread signals the condition after each tile read.
+    ScopedMutexLock lock(itsMutex);
+    while (itsBusy  ||  !itsQueued.empty()) {
+        itsCondition.wait (itsMutex);
+    }
+}
+
+void TSMPrefetch::initStatistics()
+{
+    ScopedMutexLock lock(itsMutex);
+    itsNPrefetch = 0;
+    itsNHit      = 0;
+    itsNMiss     = 0;
+}
+
+uInt TSMPrefetch::nprefetch() const
+{
+    ScopedMutexLock lock(itsMutex);
+    return itsNPrefetch;
+}
+
+uInt TSMPrefetch::nhit() const
+{
+    ScopedMutexLock lock(itsMutex);
+    return itsNHit;
+}
+
+uInt TSMPrefetch::nmiss() const
+{
+    ScopedMutexLock lock(itsMutex);
+    return itsNMiss;
+}
+
+void TSMPrefetch::showStatistics (ostream& os) const
+{
+    // Copy the counters, because the thread updates them.
+    uInt nprefetch, nhit, nmiss;
+    {
+        ScopedMutexLock lock(itsMutex);
+	nprefetch = itsNPrefetch;
+	nhit      = itsNHit;
+	nmiss     = itsNMiss;
+    }
+    os << "#prefetch: " << nprefetch << endl;
+    os << "#pf-hits:  " << nhit;
+    if (nhit + nmiss > 0) {
+        os << "        hit-rate:  "
+	   << 100 * float(nhit) / float(nhit + nmiss) << "%";
+    }
+    os << endl;
+    os << "#pf-miss:  " << nmiss << endl;
+}
+
+} //# NAMESPACE CASACORE - END
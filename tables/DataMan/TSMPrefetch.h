@@ -0,0 +1,163 @@
+//# TSMPrefetch.h: Read tiles of a hypercube ahead in a background thread
+//# Copyright (C) 2015
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TSMPREFETCH_H
+#define TABLES_TSMPREFETCH_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/OS/Mutex.h>
+#include <casacore/casa/iosfwd.h>
+#include <deque>
+#include <set>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward declarations
+class TSMCube;
+
+
+// <summary>
+// Read tiles of a hypercube ahead in a background thread
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="UNKNOWN" date="before2004/08/25" tests="tTiledShapeStMan.cc">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=TSMCube>TSMCube</linkto>
+//   <li> <linkto class=TSMOption>TSMOption</linkto>
+// </prerequisite>
+
+// <synopsis>
+// TSMPrefetch is the read-ahead engine of a
+// <linkto class=TSMCube>TSMCube</linkto> using a BucketCache.
+// TSMCube predicts from the sequence of sections accessed which tiles
+// will be needed next and queues them in this object. A background thread
+// takes the tiles from the queue and reads them into the cache using
+// <src>TSMCube::prefetchTile</src>. In this way the IO for the next
+// sections can overlap with the processing of the current section.
+// <p>
+// The tiles actually accessed are accounted for, so it is known how
+// many of them were prefetched (hits) and how many had to be read by the
+// caller itself (misses). Tiles accessed are removed from the queue,
+// so they are not read needlessly.
+// <p>
+// The thread is started when the first tiles are queued. It is stopped
+// by the destructor.
+// The queue can be cancelled, which waits until the tile being read is
+// done. It has to be done before the cache is changed (e.g. resized).
+// <br>If casacore is built without thread support, no thread is started
+// and queued tiles are ignored.
+// </synopsis>
+
+// <motivation>
+// Iterating through a large data column or lattice is often IO bound,
+// while the tiles to be accessed next are completely predictable.
+// </motivation>
+
+class TSMPrefetch
+{
+public:
+    // Create the read-ahead engine for the given hypercube.
+    explicit TSMPrefetch (TSMCube* cube);
+
+    // Stop the background thread and delete the object.
+    ~TSMPrefetch();
+
+    // Queue tiles to be read by the background thread.
+    // Tiles already queued or prefetched are ignored.
+    void queue (const std::vector<uInt>& tiles);
+
+    // Account for the tiles accessed by the caller.
+    // A tile prefetched counts as a hit, otherwise as a miss.
+    // The tiles are removed from the queue.
+    void account (const std::vector<uInt>& tiles);
+
+    // Remove all tiles from the queue and wait until the tile being read
+    // (if any) is done. Thereafter the thread is idle.
+    void cancel();
+
+    // Wait until the thread has read all queued tiles (if any).
+    void wait();
+
+    // Get the statistics.
+    // <group>
+    uInt nprefetch() const;
+    uInt nhit() const;
+    uInt nmiss() const;
+    // </group>
+
+    // (Re)initialize the statistics.
+    void initStatistics();
+
+    // Show the statistics.
+    void showStatistics (ostream& os) const;
+
+private:
+    // Forbid copy constructor.
+    TSMPrefetch (const TSMPrefetch&);
+
+    // Forbid assignment.
+    TSMPrefetch& operator= (const TSMPrefetch&);
+
+    // Start the thread (if not started yet).
+    void startThread();
+
+    // The function executed by the thread.
+    static void* runThread (void* prefetcher);
+
+    // Read the queued tiles until stopped.
+    void run();
+
+    //# Data members
+    TSMCube*           itsCube;
+    mutable Mutex      itsMutex;
+    Condition          itsCondition;
+    // The tiles to read in order of arrival.
+    std::deque<uInt>   itsQueue;
+    // The tiles still to be read (a tile in the queue but not in this set
+    // has been accessed or cancelled in the meantime).
+    std::set<uInt>     itsQueued;
+    // The tiles prefetched, but not accessed yet.
+    std::set<uInt>     itsLoaded;
+    Bool               itsBusy;
+    Bool               itsStop;
+    // The thread handle (a void* to avoid including pthread.h).
+    void*              itsThread;
+    uInt               itsNPrefetch;
+    uInt               itsNHit;
+    uInt               itsNMiss;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -65,6 +65,7 @@ TiledCellStMan::TiledCellStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt ("MAXIMUMCACHESIZE"));
     }
+    setTileCodecFromSpec (spec);
 }
 
 TiledCellStMan::~TiledCellStMan()
@@ -75,6 +76,7 @@ DataManager* TiledCellStMan::clone() const
     TiledCellStMan* smp = new TiledCellStMan (hypercolumnName_p,
 					      defaultTileShape_p,
 					      maximumCacheSize());
+    smp->setTileCodec (tileCodec());
     return smp;
 }
 
@@ -99,7 +101,7 @@ Bool TiledCellStMan::canChangeShape() const
     return True;
 }
 
-void TiledCellStMan::setShape (uInt, TSMCube* hypercube,
+void TiledCellStMan::setShape (rownr_t, TSMCube* hypercube,
 			       const IPosition& shape,
 			       const IPosition& tileShape)
 {
@@ -131,7 +133,7 @@ void TiledCellStMan::setupCheck (const TableDesc& tableDesc,
 }
 
 
-void TiledCellStMan::create (uInt nrrow)
+void TiledCellStMan::create (rownr_t nrrow)
 {
     // Set up the various things.
     setup(0);
@@ -165,7 +167,7 @@ Bool TiledCellStMan::flush (AipsIO&, Bool fsync)
     return True;
 }
 
-void TiledCellStMan::readHeader (uInt tabNrrow, Bool firstTime)
+void TiledCellStMan::readHeader (rownr_t tabNrrow, Bool firstTime)
 {
     // Open the header file and read data from it.
     AipsIO* headerFile = headerFileOpen();
@@ -178,7 +180,7 @@ void TiledCellStMan::readHeader (uInt tabNrrow, Bool firstTime)
 }
 
 
-void TiledCellStMan::addRow (uInt nrow)
+void TiledCellStMan::addRow (rownr_t nrow)
 {
     // Resize block when needed.
     uInt size = cubeSet_p.nelements();
@@ -205,7 +207,7 @@ void TiledCellStMan::addRow (uInt nrow)
 }
 
 
-TSMCube* TiledCellStMan::getHypercube (uInt rownr)
+TSMCube* TiledCellStMan::getHypercube (rownr_t rownr)
 {
     // Check if the row number is correct.
     if (rownr >= nrrow_p) {
@@ -213,7 +215,7 @@ TSMCube* TiledCellStMan::getHypercube (uInt rownr)
     }
     return cubeSet_p[rownr];
 }
-TSMCube* TiledCellStMan::getHypercube (uInt rownr, IPosition& position)
+TSMCube* TiledCellStMan::getHypercube (rownr_t rownr, IPosition& position)
 {
     // Check if the row number is correct.
     if (rownr >= nrrow_p) {
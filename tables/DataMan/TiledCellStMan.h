@@ -193,7 +193,7 @@ public:
     Bool canChangeShape() const;
 
     // Set the shape and tile shape of the hypercube.
-    virtual void setShape (uInt rownr, TSMCube* hypercube,
+    virtual void setShape (rownr_t rownr, TSMCube* hypercube,
 			   const IPosition& shape,
 			   const IPosition& tileShape);
 
@@ -218,14 +218,14 @@ private:
     virtual IPosition defaultTileShape() const;
 
     // Add rows to the storage manager.
-    void addRow (uInt nrrow);
+    void addRow (rownr_t nrrow);
 
     // Get the hypercube in which the given row is stored.
-    virtual TSMCube* getHypercube (uInt rownr);
+    virtual TSMCube* getHypercube (rownr_t rownr);
 
     // Get the hypercube in which the given row is stored.
     // It also returns the position of the row in that hypercube.
-    virtual TSMCube* getHypercube (uInt rownr, IPosition& position);
+    virtual TSMCube* getHypercube (rownr_t rownr, IPosition& position);
 
     // Check if the hypercolumn definition fits this storage manager.
     virtual void setupCheck (const TableDesc& tableDesc,
@@ -237,10 +237,10 @@ private:
 
     // Let the storage manager create files as needed for a new table.
     // This allows a column with an indirect array to create its file.
-    virtual void create (uInt nrrow);
+    virtual void create (rownr_t nrrow);
 
     // Read the header info.
-    virtual void readHeader (uInt nrrow, Bool firstTime);
+    virtual void readHeader (rownr_t nrrow, Bool firstTime);
 
 
     //# Declare the data members.
@@ -70,6 +70,7 @@ TiledColumnStMan::TiledColumnStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt ("MAXIMUMCACHESIZE"));
     }
+    setTileCodecFromSpec (spec);
 }
 
 TiledColumnStMan::~TiledColumnStMan()
@@ -80,6 +81,7 @@ DataManager* TiledColumnStMan::clone() const
     TiledColumnStMan* smp = new TiledColumnStMan (hypercolumnName_p,
 						  tileShape_p,
 						  maximumCacheSize());
+    smp->setTileCodec (tileCodec());
     return smp;
 }
 
@@ -102,7 +104,7 @@ Bool TiledColumnStMan::canAccessColumn (Bool& reask) const
 }
 
 
-void TiledColumnStMan::create (uInt nrrow)
+void TiledColumnStMan::create (rownr_t nrrow)
 {
     // Set up the various things.
     setup(1);
@@ -144,7 +146,7 @@ Bool TiledColumnStMan::flush (AipsIO&, Bool fsync)
     return True;
 }
 
-void TiledColumnStMan::readHeader (uInt tabNrrow, Bool firstTime)
+void TiledColumnStMan::readHeader (rownr_t tabNrrow, Bool firstTime)
 {
     // Open the header file and read data from it.
     AipsIO* headerFile = headerFileOpen();
@@ -198,7 +200,7 @@ IPosition TiledColumnStMan::defaultTileShape() const
     return tileShape_p;
 }
 
-void TiledColumnStMan::addRow (uInt nrow)
+void TiledColumnStMan::addRow (rownr_t nrow)
 {
     cubeSet_p[0]->extend (nrow, emptyRecord, coordColSet_p[nrdim_p - 1]);
     nrrow_p += nrow;
@@ -206,7 +208,7 @@ void TiledColumnStMan::addRow (uInt nrow)
 }
 
 
-TSMCube* TiledColumnStMan::getHypercube (uInt rownr)
+TSMCube* TiledColumnStMan::getHypercube (rownr_t rownr)
 {
     // Check if the row number is correct.
     if (rownr >= nrrow_p) {
@@ -214,7 +216,7 @@ TSMCube* TiledColumnStMan::getHypercube (uInt rownr)
     }
     return cubeSet_p[0];
 }
-TSMCube* TiledColumnStMan::getHypercube (uInt rownr, IPosition& position)
+TSMCube* TiledColumnStMan::getHypercube (rownr_t rownr, IPosition& position)
 {
     // Check if the row number is correct.
     if (rownr >= nrrow_p) {
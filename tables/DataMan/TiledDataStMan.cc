@@ -61,6 +61,7 @@ TiledDataStMan::TiledDataStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt ("MAXIMUMCACHESIZE"));
     }
+    setTileCodecFromSpec (spec);
 }
 
 TiledDataStMan::~TiledDataStMan()
@@ -70,6 +71,7 @@ DataManager* TiledDataStMan::clone() const
 {
     TiledDataStMan* smp = new TiledDataStMan (hypercolumnName_p,
 					      maximumCacheSize());
+    smp->setTileCodec (tileCodec());
     return smp;
 }
 
@@ -84,7 +86,7 @@ String TiledDataStMan::dataManagerType() const
     { return "TiledDataStMan"; }
 
 
-void TiledDataStMan::create (uInt nrrow)
+void TiledDataStMan::create (rownr_t nrrow)
 {
     // Set up the various things.
     setup(-1);
@@ -116,7 +118,7 @@ Bool TiledDataStMan::flush (AipsIO&, Bool fsync)
     return True;
 }
 
-void TiledDataStMan::readHeader (uInt tabNrrow, Bool firstTime)
+void TiledDataStMan::readHeader (rownr_t tabNrrow, Bool firstTime)
 {
     // Open the header file and read data from it.
     AipsIO* headerFile = headerFileOpen();
@@ -134,7 +136,7 @@ void TiledDataStMan::readHeader (uInt tabNrrow, Bool firstTime)
 }
 
 
-void TiledDataStMan::addRow (uInt nrow)
+void TiledDataStMan::addRow (rownr_t nrow)
 {
     nrrow_p += nrow;
     setDataChanged();
@@ -144,7 +146,7 @@ void TiledDataStMan::addRow (uInt nrow)
 void TiledDataStMan::checkNrrow (const IPosition& cubeShape,
 				 uInt incrInLastDim) const
 {
-    uInt nrrow = addedNrrow (cubeShape, incrInLastDim);
+    rownr_t nrrow = addedNrrow (cubeShape, incrInLastDim);
     if (nrrowLast_p + nrrow > nrrow_p) {
 	throw (TSMError
 	             ("Insufficient #rows in table for add/extendHypercube"));
@@ -213,12 +215,12 @@ void TiledDataStMan::updateRowMap (uInt cubeNr, uInt incrInLastDim)
     nrrowLast_p += nr;
 }
 
-TSMCube* TiledDataStMan::getHypercube (uInt rownr)
+TSMCube* TiledDataStMan::getHypercube (rownr_t rownr)
 {
     IPosition pos;
     return TiledDataStMan::getHypercube (rownr, pos);
 }
-TSMCube* TiledDataStMan::getHypercube (uInt rownr, IPosition& position)
+TSMCube* TiledDataStMan::getHypercube (rownr_t rownr, IPosition& position)
 {
     // Check if the row number is correct.
     if (rownr >= nrrowLast_p ) {
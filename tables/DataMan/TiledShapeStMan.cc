@@ -76,6 +76,7 @@ TiledShapeStMan::TiledShapeStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt ("MAXIMUMCACHESIZE"));
     }
+    setTileCodecFromSpec (spec);
 }
 
 TiledShapeStMan::~TiledShapeStMan()
@@ -86,6 +87,7 @@ DataManager* TiledShapeStMan::clone() const
     TiledShapeStMan* smp = new TiledShapeStMan (hypercolumnName_p,
 						defaultTileShape_p,
 						maximumCacheSize());
+    smp->setTileCodec (tileCodec());
     return smp;
 }
 
@@ -131,7 +133,7 @@ TSMCube* TiledShapeStMan::singleHypercube()
     return cubeSet_p[1];
 }
 
-void TiledShapeStMan::setShape (uInt rownr, TSMCube*,
+void TiledShapeStMan::setShape (rownr_t rownr, TSMCube*,
 				const IPosition& shape,
 				const IPosition& tileShape)
 {
@@ -192,7 +194,7 @@ void TiledShapeStMan::setupCheck (const TableDesc& tableDesc,
 }
 
 
-void TiledShapeStMan::create (uInt nrrow)
+void TiledShapeStMan::create (rownr_t nrrow)
 {
     // Set up the various things.
     setup(1);
@@ -228,7 +230,7 @@ Bool TiledShapeStMan::flush (AipsIO&, Bool fsync)
     return True;
 }
 
-void TiledShapeStMan::readHeader (uInt tabNrrow, Bool firstTime)
+void TiledShapeStMan::readHeader (rownr_t tabNrrow, Bool firstTime)
 {
     // Open the header file and read data from it.
     AipsIO* headerFile = headerFileOpen();
@@ -246,9 +248,9 @@ void TiledShapeStMan::readHeader (uInt tabNrrow, Bool firstTime)
 }
 
 
-void TiledShapeStMan::addRow (uInt nrow)
+void TiledShapeStMan::addRow (rownr_t nrow)
 {
-    uInt oldnrrow = nrrow_p;
+    rownr_t oldnrrow = nrrow_p;
     nrrow_p += nrow;
     if (fixedCellShape_p.nelements() > 0) {
 	for (uInt i=oldnrrow; i<oldnrrow+nrow; i++) {
@@ -259,7 +261,7 @@ void TiledShapeStMan::addRow (uInt nrow)
 }
 
 
-void TiledShapeStMan::addHypercube (uInt rownr,
+void TiledShapeStMan::addHypercube (rownr_t rownr,
 				    const IPosition& cubeShape,
 				    const IPosition& tileShape)
 {
@@ -277,7 +279,7 @@ void TiledShapeStMan::addHypercube (uInt rownr,
     extendHypercube (rownr, ncube);
 }
 
-void TiledShapeStMan::extendHypercube (uInt rownr, uInt cubeNr)
+void TiledShapeStMan::extendHypercube (rownr_t rownr, uInt cubeNr)
 {
     TSMCube* hypercube = cubeSet_p[cubeNr];
     uInt pos = hypercube->cubeShape()(nrdim_p-1);
@@ -287,14 +289,14 @@ void TiledShapeStMan::extendHypercube (uInt rownr, uInt cubeNr)
 }
 
 
-void TiledShapeStMan::updateRowMap (uInt cubeNr, uInt pos, uInt rownr)
+void TiledShapeStMan::updateRowMap (uInt cubeNr, uInt pos, rownr_t rownr)
 {
     // Check if the row number is correct.
     if (rownr >= nrrow_p) {
 	throw (TSMError ("TiledShapeStMan::updateRowMap: rownr is too high"));
     }
     // Determine the next row used and check (in debug mode) if it is right.
-    uInt nextRow = 0;
+    rownr_t nextRow = 0;
     if (nrUsedRowMap_p > 0) {
         nextRow = 1 + rowMap_p[nrUsedRowMap_p-1];
     }
@@ -451,7 +453,7 @@ void TiledShapeStMan::updateRowMap (uInt cubeNr, uInt pos, uInt rownr)
     posMap_p[index]  = pos;
 }
 
-TSMCube* TiledShapeStMan::getHypercube (uInt rownr)
+TSMCube* TiledShapeStMan::getHypercube (rownr_t rownr)
 {
     if (rownr >= nrrow_p) {
 	throw (TSMError ("getHypercube: rownr is too high"));
@@ -472,7 +474,7 @@ TSMCube* TiledShapeStMan::getHypercube (uInt rownr)
     return cubeSet_p[cubeMap_p[lastHC_p]];
 }
 
-TSMCube* TiledShapeStMan::getHypercube (uInt rownr, IPosition& position)
+TSMCube* TiledShapeStMan::getHypercube (rownr_t rownr, IPosition& position)
 {
     if (rownr >= nrrow_p) {
 	throw (TSMError ("getHypercube: rownr is too high"));
@@ -60,7 +60,8 @@ TiledStMan::TiledStMan ()
   maxCacheSize_p    (0),
   nrdim_p           (0),
   nrCoordVector_p   (0),
-  dataChanged_p     (False)
+  dataChanged_p     (False),
+  tileCodec_p       (TSMCodec::None)
 {}
 
 TiledStMan::TiledStMan (const String& hypercolumnName, uInt maximumCacheSize)
@@ -72,7 +73,8 @@ TiledStMan::TiledStMan (const String& hypercolumnName, uInt maximumCacheSize)
   maxCacheSize_p    (maximumCacheSize),
   nrdim_p           (0),
   nrCoordVector_p   (0),
-  dataChanged_p     (False)
+  dataChanged_p     (False),
+  tileCodec_p       (TSMCodec::None)
 {}
 
 TiledStMan::~TiledStMan()
@@ -289,6 +291,7 @@ Record TiledStMan::dataManagerSpec() const
     Record rec = getProperties();
     rec.define ("DEFAULTTILESHAPE", defaultTileShape().asVector());
     rec.define ("MAXIMUMCACHESIZE", Int(persMaxCacheSize_p));
+    rec.define ("TILECODEC", TSMCodec::toString (tileCodec_p));
     Record subrec;
     Int nrrec=0;
     for (uInt i=0; i<cubeSet_p.nelements(); i++) {
@@ -322,7 +325,7 @@ void TiledStMan::setProperties (const Record& rec)
 }
 
 
-void TiledStMan::setShape (uInt, TSMCube*, const IPosition&, const IPosition&)
+void TiledStMan::setShape (rownr_t, TSMCube*, const IPosition&, const IPosition&)
 {
     throw (TSMError ("setShape is not possible for TSM " + hypercolumnName_p));
 }
@@ -356,6 +359,28 @@ void TiledStMan::deleteManager()
 void TiledStMan::setMaximumCacheSize (uInt nbytes)
     { maxCacheSize_p = nbytes; }
 
+void TiledStMan::setTileCodec (TSMCodec::Type codec)
+    { tileCodec_p = codec; }
+
+void TiledStMan::setTileCodecFromSpec (const Record& spec)
+{
+    if (spec.isDefined ("TILECODEC")) {
+        tileCodec_p = TSMCodec::fromString (spec.asString ("TILECODEC"));
+    }
+}
+
+void TiledStMan::checkCodecOption()
+{
+    // Compressed tiles have a variable length, so they can only be
+    // accessed using the BucketCache.
+    if (tileCodec_p != TSMCodec::None
+    &&  tsmOption().option() != TSMOption::Cache) {
+        setTsmOption (TSMOption (TSMOption::Cache, 0,
+                                 tsmOption().maxCacheSizeMB(),
+                                 tsmOption().prefetchDepth()));
+    }
+}
+
 
 Bool TiledStMan::canChangeShape() const
 {
@@ -415,27 +440,27 @@ TSMCube* TiledStMan::getTSMCube (uInt hypercube)
 }
 
 
-const IPosition& TiledStMan::hypercubeShape (uInt rownr) const
+const IPosition& TiledStMan::hypercubeShape (rownr_t rownr) const
 {
     return getHypercube(rownr)->cubeShape();
 }
 
-const IPosition& TiledStMan::tileShape (uInt rownr) const
+const IPosition& TiledStMan::tileShape (rownr_t rownr) const
 {
     return getHypercube(rownr)->tileShape();
 }
 
-uInt TiledStMan::bucketSize (uInt rownr) const
+uInt TiledStMan::bucketSize (rownr_t rownr) const
 {
     return getHypercube(rownr)->bucketSize();
 }
 
-uInt TiledStMan::cacheSize (uInt rownr) const
+uInt TiledStMan::cacheSize (rownr_t rownr) const
 {
     return getHypercube(rownr)->cacheSize();
 }
 
-uInt TiledStMan::calcCacheSize (uInt rownr,
+uInt TiledStMan::calcCacheSize (rownr_t rownr,
 				const IPosition& sliceShape,
 				const IPosition& windowStart,
 				const IPosition& windowLength,
@@ -446,7 +471,7 @@ uInt TiledStMan::calcCacheSize (uInt rownr,
 					       windowLength, axisPath);
 }
 
-void TiledStMan::setCacheSize (uInt rownr,
+void TiledStMan::setCacheSize (rownr_t rownr,
 			       const IPosition& sliceShape,
 			       const IPosition& windowStart,
 			       const IPosition& windowLength,
@@ -459,14 +484,14 @@ void TiledStMan::setCacheSize (uInt rownr,
 				       forceSmaller, True);
 }
 
-void TiledStMan::setCacheSize (uInt rownr, uInt nbuckets, Bool forceSmaller)
+void TiledStMan::setCacheSize (rownr_t rownr, uInt nbuckets, Bool forceSmaller)
 {
     // Set the cache size (in buckets) for the given hypercube.
     TSMCube* hypercube = getHypercube(rownr);
     hypercube->setCacheSize (nbuckets, forceSmaller, True);
 }
 
-Bool TiledStMan::userSetCache (uInt rownr) const
+Bool TiledStMan::userSetCache (rownr_t rownr) const
 {
     return getHypercube(rownr)->userSetCache();
 }
@@ -489,6 +514,15 @@ void TiledStMan::showCacheStatistics (ostream& os) const
     }
 }
 
+void TiledStMan::waitPrefetch()
+{
+    for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+	if (cubeSet_p[i] != 0) {
+	    cubeSet_p[i]->waitPrefetch();
+	}
+    }
+}
+
 TSMCube* TiledStMan::singleHypercube()
 {
     if (cubeSet_p.nelements() != 1  ||  cubeSet_p[0] == 0) {
@@ -518,6 +552,22 @@ uInt TiledStMan::getLengthOffset (uInt nrPixels, Block<uInt>& dataOffset,
     return length;
 }
 
+void TiledStMan::getElementSizes (Block<uInt>& elementSize) const
+{
+    uInt nrcol = dataCols_p.nelements();
+    elementSize.resize (nrcol);
+    for (uInt i=0; i<nrcol; i++) {
+        uInt size = dataCols_p[i]->tilePixelSize();
+        // A complex value consists of two real values.
+        int dtype = dataCols_p[i]->dataType();
+        if (dtype == TpComplex  ||  dtype == TpDComplex) {
+            size /= 2;
+        }
+        // Bools are stored as bits.
+        elementSize[i] = (size == 0  ?  1 : size);
+    }
+}
+
 void TiledStMan::readTile (char* local,
 			   const Block<uInt>& localOffset,
 			   const char* external,
@@ -901,6 +951,7 @@ TSMCube* TiledStMan::makeHypercube (const IPosition& cubeShape,
 
 void TiledStMan::createFile (uInt index)
 {
+    checkCodecOption();
     TSMFile* file = new TSMFile (this, index, tsmOption(), multiFile());
     fileSet_p[index] = file;
 }
@@ -976,7 +1027,7 @@ void TiledStMan::checkCoordinates (const PtrBlock<TSMColumn*>& coordColSet,
 
 uInt TiledStMan::addedNrrow (const IPosition& shape, uInt incrInLastDim) const
 {
-    uInt nrrowAdded = 1;
+    rownr_t nrrowAdded = 1;
     for (uInt i=nrCoordVector_p; i<nrdim_p-1; i++) {
 	nrrowAdded *= shape(i);
     }
@@ -984,12 +1035,12 @@ uInt TiledStMan::addedNrrow (const IPosition& shape, uInt incrInLastDim) const
 }
 
 
-void TiledStMan::open (uInt nrrow, AipsIO&)
+void TiledStMan::open (rownr_t nrrow, AipsIO&)
 {
     // Read the header info (for the first time).
     readHeader (nrrow, True);
 }
-void TiledStMan::resync (uInt nrrow)
+void TiledStMan::resync (rownr_t nrrow)
 {
     // Reread the header info.
     readHeader (nrrow, False);
@@ -1034,7 +1085,15 @@ void TiledStMan::headerFilePut (AipsIO& headerFile, uInt nrCube)
     uInt i;
     // The endian switch is a new feature. So only put it if little endian
     // is used. In that way older software can read newer tables.
-    if (asBigEndian()) {
+    // Similarly, the tile codec is only put if tiles are compressed.
+    //# Version 4 stores the number of rows as a 64-bit value; it is only
+    //# used if needed, so older software can still read most tables.
+    Bool use64 = (nrrow_p > 4294967295u);
+    if (use64  ||  tileCodec_p != TSMCodec::None) {
+        headerFile.putstart ("TiledStMan", use64 ? 4 : 3);
+	headerFile << asBigEndian();
+	headerFile << Int(tileCodec_p);
+    } else if (asBigEndian()) {
         headerFile.putstart ("TiledStMan", 1);
     } else {
         headerFile.putstart ("TiledStMan", 2);
@@ -1044,7 +1103,11 @@ void TiledStMan::headerFilePut (AipsIO& headerFile, uInt nrCube)
     //# and the column data types.
     //# This is only done to check it when reading back.
     headerFile << sequenceNr();
-    headerFile << nrrow_p;
+    if (use64) {
+        headerFile << nrrow_p;
+    } else {
+        headerFile << uInt(nrrow_p);
+    }
     headerFile << ncolumn();
     for (i=0; i<ncolumn(); i++) {
 	headerFile << colSet_p[i]->dataType();
@@ -1068,7 +1131,7 @@ void TiledStMan::headerFilePut (AipsIO& headerFile, uInt nrCube)
     headerFile.putend();
 }
 
-void TiledStMan::headerFileGet (AipsIO& headerFile, uInt tabNrrow,
+void TiledStMan::headerFileGet (AipsIO& headerFile, rownr_t tabNrrow,
 				Bool firstTime, Int extraNdim)
 {
     nrrow_p = tabNrrow;
@@ -1081,11 +1144,24 @@ void TiledStMan::headerFileGet (AipsIO& headerFile, uInt tabNrrow,
     if (bigEndian != asBigEndian()) {
         throw DataManError("Endian flag in TSM mismatches the table flag");
     }
+    if (version >= 3) {
+        Int codec;
+        headerFile >> codec;
+        tileCodec_p = TSMCodec::Type(codec);
+        checkCodecOption();
+    }
     //# Get and check the number of rows and columns and the column types.
-    uInt nrrow, nrcol, seqnr;
+    rownr_t nrrow;
+    uInt nrcol, seqnr;
     int  dtype;
     headerFile >> seqnr;
-    headerFile >> nrrow;
+    if (version >= 4) {
+        headerFile >> nrrow;
+    } else {
+        uInt nrrow32;
+        headerFile >> nrrow32;
+        nrrow = nrrow32;
+    }
     headerFile >> nrcol;
     if (seqnr != sequenceNr()  ||  nrcol != ncolumn()) {
       //# Temporary hack to fix a corrupted table.
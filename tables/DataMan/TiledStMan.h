@@ -32,6 +32,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/DataManager.h>
+#include <casacore/tables/DataMan/TSMCodec.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/OS/Conversion.h>
@@ -87,6 +88,14 @@ template<class T> class Vector;
 // data cells are consistent.
 // It also contains various data members and functions to make them
 // persistent by writing them into an AipsIO stream.
+// <p>
+// The tiles of new hypercubes can be stored compressed by setting a
+// <linkto class=TSMCodec>TSMCodec</linkto> using function
+// <src>setTileCodec</src> or the field <src>TILECODEC</src> in the
+// data manager specification record (with value None, LZ, or ShuffleLZ).
+// Compressed tiles can only be accessed using the Cache option of
+// <linkto class=TSMOption>TSMOption</linkto>, so that option is always
+// used for a storage manager with compressed tiles.
 // </synopsis> 
 
 // <motivation>
@@ -173,18 +182,26 @@ public:
     // Get the current maximum cache size (in bytes).
     uInt maximumCacheSize() const;
 
+    // Set the codec used to compress the tiles of new hypercubes.
+    // It should be set before the storage manager is used to create
+    // a table; it does not change the codec of existing hypercubes.
+    void setTileCodec (TSMCodec::Type codec);
+
+    // Get the codec used to compress the tiles of new hypercubes.
+    TSMCodec::Type tileCodec() const;
+
     // Get the current cache size (in buckets) for the hypercube in
     // the given row.
-    uInt cacheSize (uInt rownr) const;
+    uInt cacheSize (rownr_t rownr) const;
 
     // Get the hypercube shape of the data in the given row.
-    const IPosition& hypercubeShape (uInt rownr) const;
+    const IPosition& hypercubeShape (rownr_t rownr) const;
 
     // Get the tile shape of the data in the given row.
-    const IPosition& tileShape (uInt rownr) const;
+    const IPosition& tileShape (rownr_t rownr) const;
 
     // Get the bucket size (in bytes) of the hypercube in the given row.
-    uInt bucketSize (uInt rownr) const;
+    uInt bucketSize (rownr_t rownr) const;
 
     // Can the tiled storage manager handle changing array shapes?
     // The default is no (but TiledCellStMan can).
@@ -222,14 +239,14 @@ public:
     // new size is smaller.
     // <br>A flag is set indicating that the TSMDataColumn
     // access functions do not need to size the cache.
-    uInt calcCacheSize (uInt rownr, const IPosition& sliceShape,
+    uInt calcCacheSize (rownr_t rownr, const IPosition& sliceShape,
 			const IPosition& windowStart,
 			const IPosition& windowLength,
 			const IPosition& axisPath) const;
 
     // Set the cache size using the <src>calcCacheSize</src>
     // function mentioned above.
-    void setCacheSize (uInt rownr, const IPosition& sliceShape,
+    void setCacheSize (rownr_t rownr, const IPosition& sliceShape,
 		       const IPosition& windowStart,
 		       const IPosition& windowLength,
 		       const IPosition& axisPath,
@@ -242,10 +259,10 @@ public:
     // new size is smaller.
     // <br>A flag is set indicating that the TSMDataColumn
     // access functions do not need to size the cache.
-    void setCacheSize (uInt rownr, uInt nbuckets, Bool forceSmaller);
+    void setCacheSize (rownr_t rownr, uInt nbuckets, Bool forceSmaller);
 
     // Determine if the user set the cache size (using setCacheSize).
-    Bool userSetCache (uInt rownr) const;
+    Bool userSetCache (rownr_t rownr) const;
 
     // Empty the caches used by the hypercubes in this storage manager.
     // It will flush the caches as needed and remove all buckets from them
@@ -256,17 +273,26 @@ public:
     // Show the statistics of all caches used.
     void showCacheStatistics (ostream& os) const;
 
+    // Wait until the read-ahead threads of the hypercubes have read
+    // the tiles queued.
+    void waitPrefetch();
+
     // Get the length of the data for the given number of pixels.
     // This can be used to calculate the length of a tile.
     uInt getLengthOffset (uInt nrPixels, Block<uInt>& dataOffset,
 			  Block<uInt>& localOffset,
 			  uInt& localTileLength) const;
 
+    // Get the size of a value in the tile of each data column.
+    // It is the canonical size of the basic type (e.g. 4 for Complex)
+    // and 1 for Bool. It is used to shuffle the bytes of compressed tiles.
+    void getElementSizes (Block<uInt>& elementSize) const;
+
     // Get the number of coordinate vectors.
     uInt nrCoordVector() const;
 
     // Get the nr of rows in this storage manager.
-    uInt nrow() const;
+    rownr_t nrow() const;
 
     // Does the storage manager allow to add rows? (yes)
     Bool canAddRow() const;
@@ -290,13 +316,13 @@ public:
     
     // Get the hypercube in which the given row is stored.
     // <group>
-    const TSMCube* getHypercube (uInt rownr) const;
-    virtual TSMCube* getHypercube (uInt rownr) = 0;
+    const TSMCube* getHypercube (rownr_t rownr) const;
+    virtual TSMCube* getHypercube (rownr_t rownr) = 0;
     // </group>
 
     // Get the hypercube in which the given row is stored.
     // It also returns the position of the row in that hypercube.
-    virtual TSMCube* getHypercube (uInt rownr, IPosition& position) = 0;
+    virtual TSMCube* getHypercube (rownr_t rownr, IPosition& position) = 0;
 
     // Make the correct TSMCube type (depending on tsmOption()).
     TSMCube* makeTSMCube (TSMFile* file, const IPosition& cubeShape,
@@ -317,10 +343,10 @@ public:
     TSMFile* getFile (uInt sequenceNumber);
 
     // Open the storage manager for an existing table.
-    virtual void open (uInt nrrow, AipsIO&);
+    virtual void open (rownr_t nrrow, AipsIO&);
 
     // Resync the storage manager with the new file contents.
-    virtual void resync (uInt nrrow);
+    virtual void resync (rownr_t nrrow);
 
     // Reopen all files used in this storage manager for read/write access.
     virtual void reopenRW();
@@ -354,7 +380,7 @@ public:
 
     // Set the shape and tile shape of a hypercube.
     // By default it throws an "impossible" exception.
-    virtual void setShape (uInt rownr, TSMCube* hypercube,
+    virtual void setShape (rownr_t rownr, TSMCube* hypercube,
 			   const IPosition& shape,
 			   const IPosition& tileShape);
 
@@ -398,6 +424,13 @@ protected:
     // Get the table description needed for the hypercolumn description.
     virtual const TableDesc& getDesc() const;
 
+    // Get the tile codec from the data manager specification record
+    // (if defined in it).
+    void setTileCodecFromSpec (const Record& spec);
+
+    // Make sure the Cache option is used if tiles are compressed.
+    void checkCodecOption();
+
     // Check if values are given in the record for all columns in
     // the block. Also check if the data types are correct.
     // An exception is thrown if something is incorrect.
@@ -443,7 +476,7 @@ protected:
 
     // Let a derived class read the header info.
     // This is used by the open and resync function.
-    virtual void readHeader (uInt nrrow, Bool firstTime) = 0;
+    virtual void readHeader (rownr_t nrrow, Bool firstTime) = 0;
 
     // Create the TSM header file.
     // It creates an AipsIO object for it.
@@ -460,7 +493,7 @@ protected:
     // Read the data from the header file.
     // When done for the first time, setup() is called to initialize
     // the various variables (using the extraNdim variable).
-    void headerFileGet (AipsIO& headerFile, uInt tabNrrow, Bool firstTime,
+    void headerFileGet (AipsIO& headerFile, rownr_t tabNrrow, Bool firstTime,
 			Int extraNdim);
 
     // Close the header file.
@@ -488,7 +521,7 @@ protected:
     // The name of the hypercolumn.
     String hypercolumnName_p;
     // The number of rows in the columns.
-    uInt  nrrow_p;
+    rownr_t  nrrow_p;
     // The assembly of all columns.
     PtrBlock<TSMColumn*>  colSet_p;
     // The assembly of all data columns.
@@ -516,6 +549,8 @@ protected:
     IPosition fixedCellShape_p;
     // Has any data changed since the last flush?
     Bool      dataChanged_p;
+    // The codec used for the tiles of new hypercubes.
+    TSMCodec::Type tileCodec_p;
 
 private:
     // Forbid copy constructor.
@@ -529,10 +564,13 @@ private:
 inline uInt TiledStMan::maximumCacheSize() const
     { return maxCacheSize_p; }
 
+inline TSMCodec::Type TiledStMan::tileCodec() const
+    { return tileCodec_p; }
+
 inline uInt TiledStMan::nrCoordVector() const
     { return nrCoordVector_p; }
 
-inline uInt TiledStMan::nrow() const
+inline rownr_t TiledStMan::nrow() const
     { return nrrow_p; }
 
 inline uInt TiledStMan::nhypercubes() const
@@ -544,7 +582,7 @@ inline void TiledStMan::setDataChanged()
 inline const TSMCube* TiledStMan::getTSMCube (uInt hypercube) const
     { return const_cast<TiledStMan*>(this)->getTSMCube (hypercube); }
 
-inline const TSMCube* TiledStMan::getHypercube (uInt rownr) const
+inline const TSMCube* TiledStMan::getHypercube (rownr_t rownr) const
     { return const_cast<TiledStMan*>(this)->getHypercube (rownr); }
 
 inline void TiledStMan::setPersMaxCacheSize (uInt nbytes)
@@ -68,10 +68,10 @@ Bool VirtualScalarColumn<T>::canAccessScalarColumn (Bool& reask) const
 //# to overcome the limitations of the SGI compiler (in May 1995).
 #define VIRTUALSCALARCOLUMN_GETPUT(TP,NM) \
 template<class T> \
-void VirtualScalarColumn<T>::aips_name2(get,NM) (uInt rownr, TP* dataPtr) \
+void VirtualScalarColumn<T>::aips_name2(get,NM) (rownr_t rownr, TP* dataPtr) \
     { getVirtualScalarColumn (this, rownr, dataPtr); } \
 template<class T> \
-void VirtualScalarColumn<T>::aips_name2(put,NM) (uInt rownr, \
+void VirtualScalarColumn<T>::aips_name2(put,NM) (rownr_t rownr, \
                                                  const TP* dataPtr) \
     { putVirtualScalarColumn (this, rownr, dataPtr); }
 
@@ -88,10 +88,10 @@ VIRTUALSCALARCOLUMN_GETPUT(DComplex,DComplexV)
 VIRTUALSCALARCOLUMN_GETPUT(String,StringV)
 
 template<class T>
-void VirtualScalarColumn<T>::getOtherV (uInt rownr, void* dataPtr)
+void VirtualScalarColumn<T>::getOtherV (rownr_t rownr, void* dataPtr)
     { get (rownr, *(T*)dataPtr); }
 template<class T>
-void VirtualScalarColumn<T>::putOtherV (uInt rownr, const void* dataPtr)
+void VirtualScalarColumn<T>::putOtherV (rownr_t rownr, const void* dataPtr)
     { put (rownr, *(const T*)dataPtr); }
 
 
@@ -103,10 +103,10 @@ template<class T>
 void VirtualScalarColumn<T>::putScalarColumnV (const void* dataPtr)
     { putScalarColumn (*(const Vector<T>*)dataPtr); }
 template<class T>
-uInt VirtualScalarColumn<T>::getBlockV (uInt rownr, uInt nrmax, void* dataPtr)
+uInt VirtualScalarColumn<T>::getBlockV (rownr_t rownr, uInt nrmax, void* dataPtr)
     { return getBlock (rownr, nrmax, (T*)dataPtr); }
 template<class T>
-void VirtualScalarColumn<T>::putBlockV (uInt rownr, uInt nrmax, const void* dataPtr)
+void VirtualScalarColumn<T>::putBlockV (rownr_t rownr, uInt nrmax, const void* dataPtr)
     { putBlock (rownr, nrmax, (const T*)dataPtr); }
 
 
@@ -114,7 +114,7 @@ void VirtualScalarColumn<T>::putBlockV (uInt rownr, uInt nrmax, const void* data
 
 //# The default implementation of put throws an exception.
 template<class T>
-void VirtualScalarColumn<T>::put (uInt, const T&)
+void VirtualScalarColumn<T>::put (rownr_t, const T&)
     { throwPut(); }
 
 //# The default implementation of get/putScalarColumn handles its data using
@@ -125,7 +125,7 @@ void VirtualScalarColumn<T>::getScalarColumn (Vector<T>& vec)
     Bool deleteIt;
     T* data = vec.getStorage (deleteIt);
     uInt nrgot;
-    uInt rownr=0;
+    rownr_t rownr=0;
     for (uInt nrtodo=vec.nelements(); nrtodo>0;) {
         nrgot = getBlock (rownr, nrtodo, data);
         nrtodo -= nrgot;
@@ -146,7 +146,7 @@ void VirtualScalarColumn<T>::putScalarColumn (const Vector<T>& vec)
 //# The default implementation of getBlock gets one value.
 //# The default implementation of putBlock puts one value at a time.
 template<class T>
-uInt VirtualScalarColumn<T>::getBlock (uInt rownr, uInt nrmax, T* dataPtr)
+uInt VirtualScalarColumn<T>::getBlock (rownr_t rownr, uInt nrmax, T* dataPtr)
 {
     if (nrmax > 0) {
 	get (rownr, *dataPtr);
@@ -155,7 +155,7 @@ uInt VirtualScalarColumn<T>::getBlock (uInt rownr, uInt nrmax, T* dataPtr)
     return 0;
 }
 template<class T>
-void VirtualScalarColumn<T>::putBlock (uInt rownr, uInt nrmax, const T* dataPtr)
+void VirtualScalarColumn<T>::putBlock (rownr_t rownr, uInt nrmax, const T* dataPtr)
 {
     while (nrmax > 0) {
 	put (rownr++, *dataPtr++);
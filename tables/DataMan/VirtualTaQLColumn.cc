@@ -142,7 +142,7 @@ DataManagerColumn* VirtualTaQLColumn::makeIndArrColumn (const String& name,
 }
 
 
-void VirtualTaQLColumn::create (uInt)
+void VirtualTaQLColumn::create (rownr_t)
 {
   // Define a keyword in the column telling the expression.
   itsTempWritable = True;
@@ -228,12 +228,12 @@ Bool VirtualTaQLColumn::isWritable() const
 }
 
 
-uInt VirtualTaQLColumn::ndim (uInt rownr)
+uInt VirtualTaQLColumn::ndim (rownr_t rownr)
 {
   return shape(rownr).nelements();
 }
 
-IPosition VirtualTaQLColumn::shape (uInt rownr)
+IPosition VirtualTaQLColumn::shape (rownr_t rownr)
 {
   if (!itsIsArray) {
     return IPosition();
@@ -249,58 +249,58 @@ IPosition VirtualTaQLColumn::shape (uInt rownr)
   return itsCurShape;
 }
 
-Bool VirtualTaQLColumn::isShapeDefined (uInt)
+Bool VirtualTaQLColumn::isShapeDefined (rownr_t)
 {
   return True;
 }
 
 
-void VirtualTaQLColumn::getBoolV (uInt rownr, Bool* dataPtr)
+void VirtualTaQLColumn::getBoolV (rownr_t rownr, Bool* dataPtr)
 {
   *dataPtr = itsNode->getBool (rownr);
 }
-void VirtualTaQLColumn::getuCharV (uInt rownr, uChar* dataPtr)
+void VirtualTaQLColumn::getuCharV (rownr_t rownr, uChar* dataPtr)
 {
   *dataPtr = uChar(itsNode->getInt (rownr));
 }
-void VirtualTaQLColumn::getShortV (uInt rownr, Short* dataPtr)
+void VirtualTaQLColumn::getShortV (rownr_t rownr, Short* dataPtr)
 {
   *dataPtr = Short(itsNode->getInt (rownr));
 }
-void VirtualTaQLColumn::getuShortV (uInt rownr, uShort* dataPtr)
+void VirtualTaQLColumn::getuShortV (rownr_t rownr, uShort* dataPtr)
 {
   *dataPtr = uShort(itsNode->getInt (rownr));
 }
-void VirtualTaQLColumn::getIntV (uInt rownr, Int* dataPtr)
+void VirtualTaQLColumn::getIntV (rownr_t rownr, Int* dataPtr)
 {
   *dataPtr = Int(itsNode->getInt (rownr));
 }
-void VirtualTaQLColumn::getuIntV (uInt rownr, uInt* dataPtr)
+void VirtualTaQLColumn::getuIntV (rownr_t rownr, uInt* dataPtr)
 {
   *dataPtr = uInt(itsNode->getInt (rownr));
 }
-void VirtualTaQLColumn::getfloatV (uInt rownr, float* dataPtr)
+void VirtualTaQLColumn::getfloatV (rownr_t rownr, float* dataPtr)
 {
   *dataPtr = Float(itsNode->getDouble (rownr));
 }
-void VirtualTaQLColumn::getdoubleV (uInt rownr, double* dataPtr)
+void VirtualTaQLColumn::getdoubleV (rownr_t rownr, double* dataPtr)
 {
   *dataPtr = itsNode->getDouble (rownr);
 }
-void VirtualTaQLColumn::getComplexV (uInt rownr, Complex* dataPtr)
+void VirtualTaQLColumn::getComplexV (rownr_t rownr, Complex* dataPtr)
 {
   *dataPtr = Complex(itsNode->getDComplex (rownr));
 }
-void VirtualTaQLColumn::getDComplexV (uInt rownr, DComplex* dataPtr)
+void VirtualTaQLColumn::getDComplexV (rownr_t rownr, DComplex* dataPtr)
 {
   *dataPtr = itsNode->getDComplex (rownr);
 }
-void VirtualTaQLColumn::getStringV (uInt rownr, String* dataPtr)
+void VirtualTaQLColumn::getStringV (rownr_t rownr, String* dataPtr)
 {
   *dataPtr = itsNode->getString (rownr);
 }
 
-void VirtualTaQLColumn::getArrayV (uInt rownr, void* dataPtr)
+void VirtualTaQLColumn::getArrayV (rownr_t rownr, void* dataPtr)
 {
   // Usually getShape is called before getArray.
   // To avoid double calculation of the same value, the result is cached
@@ -360,7 +360,7 @@ void VirtualTaQLColumn::getArrayV (uInt rownr, void* dataPtr)
   clearCurResult();
 }
 
-IPosition VirtualTaQLColumn::getResult (uInt rownr, void* dataPtr)
+IPosition VirtualTaQLColumn::getResult (rownr_t rownr, void* dataPtr)
 {
   IPosition shp;
   switch (itsDataType) {
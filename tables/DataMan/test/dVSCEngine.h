@@ -114,17 +114,17 @@ public:
     DataManager* clone() const;
 
     // Store the target column names in the source column keywords.
-    void create (uInt);
+    void create (rownr_t);
 
     // Prepare the engine by allocating column objects
     // for the target columns.
     void prepare();
 
     // Get the data from a row.
-    void get (uInt rownr, VSCExample& value);
+    void get (rownr_t rownr, VSCExample& value);
 
     // Put the data in a row.
-    void put (uInt rownr, const VSCExample& value);
+    void put (rownr_t rownr, const VSCExample& value);
 
     // Register the class name and the static makeObject "constructor".
     // This will make the engine known to the table system.
@@ -0,0 +1,160 @@
+//# tSSMConcurrent.cc: Test program for concurrent reading of SSM columns
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/TSMOption.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+using namespace casacore;
+
+// This program tests reading the columns of a StandardStMan by multiple
+// threads at the same time using TableColumn::getScalarCellsConcurrent.
+// Each thread reads every third row of a block of rows, so consecutive
+// and non-consecutive rows are read from buckets pinned in the cache.
+
+void createTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Bool> ("FLAG"));
+  td.addColumn (ScalarColumnDesc<Int> ("SCAN"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<Complex> ("VIS"));
+  td.addColumn (ScalarColumnDesc<String> ("NAME"));
+  SetupNewTable newtab ("tSSMConcurrent_tmp.tab", td, Table::New);
+  // Use small buckets, so many buckets are needed.
+  StandardStMan ssm ("SSM", 512, 2);
+  newtab.bindAll (ssm);
+  Table tab(newtab, nrow);
+  ScalarColumn<Bool> flag(tab, "FLAG");
+  ScalarColumn<Int> scan(tab, "SCAN");
+  ScalarColumn<Double> time(tab, "TIME");
+  ScalarColumn<Complex> vis(tab, "VIS");
+  for (uInt i=0; i<nrow; ++i) {
+    flag.put (i, i%3 == 0);
+    scan.put (i, i);
+    time.put (i, 1000. + i);
+    vis.put (i, Complex(i, -Float(i)));
+  }
+}
+
+// Read the column with the given number of threads.
+// The row numbers are mapped by <src>rowMap</src> to get the expected values.
+template<typename T>
+void readColumn (const Table& tab, const String& name, uInt nthreads,
+                 const Vector<rownr_t>& rowMap, T (*expected)(rownr_t))
+{
+  TableColumn col(tab, name);
+  AlwaysAssertExit (col.prepareConcurrentGet (nthreads));
+  const Int blockSize = 150;
+  Int nblock = (tab.nrow() + blockSize - 1) / blockSize;
+  Int nerr = 0;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthreads) reduction(+:nerr)
+#endif
+  for (Int blk=0; blk<nblock; ++blk) {
+    std::vector<rownr_t> rows;
+    for (rownr_t i=blk*blockSize; i<std::min(rownr_t(blk+1)*blockSize,
+                                             tab.nrow()); i+=3) {
+      rows.push_back (i);
+      // Also read consecutive rows.
+      if (i+1 < tab.nrow()) {
+        rows.push_back (i+1);
+      }
+    }
+    Vector<T> values(rows.size());
+    col.getScalarCellsConcurrent (&rows[0], rows.size(), values.data());
+    for (size_t i=0; i<rows.size(); ++i) {
+      if (values[i] != expected(rowMap[rows[i]])) {
+        nerr++;
+      }
+    }
+  }
+  col.prepareConcurrentGet (1);
+  AlwaysAssertExit (nerr == 0);
+}
+
+Bool  expFlag (rownr_t row) { return row%3 == 0; }
+Int   expScan (rownr_t row) { return row; }
+Double expTime (rownr_t row) { return 1000. + row; }
+Complex expVis (rownr_t row) { return Complex(row, -Float(row)); }
+
+void readTable (const Table& tab, const Vector<rownr_t>& rowMap)
+{
+  for (uInt nthreads=1; nthreads<=4; nthreads*=2) {
+    readColumn (tab, "FLAG", nthreads, rowMap, expFlag);
+    readColumn (tab, "SCAN", nthreads, rowMap, expScan);
+    readColumn (tab, "TIME", nthreads, rowMap, expTime);
+    readColumn (tab, "VIS", nthreads, rowMap, expVis);
+  }
+  // A String column cannot be read concurrently.
+  AlwaysAssertExit (! TableColumn(tab, "NAME").prepareConcurrentGet (4));
+  // Normal reading must still work.
+  ScalarColumn<Int> scan(tab, "SCAN");
+  for (rownr_t i=0; i<tab.nrow(); ++i) {
+    AlwaysAssertExit (rownr_t(scan(i)) == rowMap[i]);
+  }
+}
+
+int main()
+{
+  try {
+    createTable (5000);
+    Vector<rownr_t> rowMap(5000);
+    indgen (rowMap);
+    {
+      // Use the bucket cache.
+      Table tab("tSSMConcurrent_tmp.tab", Table::Old,
+                TSMOption(TSMOption::Cache));
+      readTable (tab, rowMap);
+      // Read a selection of rows.
+      Vector<rownr_t> selRows(1000);
+      indgen (selRows, rownr_t(17), rownr_t(4));
+      readTable (tab(selRows), selRows);
+    }
+    {
+      // Use the memory-mapped file.
+      Table tab("tSSMConcurrent_tmp.tab", Table::Old,
+                TSMOption(TSMOption::MMap));
+      readTable (tab, rowMap);
+    }
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,216 @@
+//# tStManZoneMap.cc: Test program for the zone maps of the ISM and SSM
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <limits>
+
+using namespace casacore;
+
+// This program tests the zone maps (minimum and maximum per bucket)
+// kept by the IncrementalStMan and StandardStMan and their use in
+// a table selection.
+
+// Get the values of a numeric column as Double.
+Vector<Double> getValues (const Table& tab, const String& name)
+{
+  TableColumn col(tab, name);
+  Vector<Double> values(tab.nrow());
+  for (rownr_t i=0; i<values.size(); ++i) {
+    values[i] = col.asdouble (i);
+  }
+  return values;
+}
+
+// Check if the zone map of the column covers all values.
+void checkZoneMap (const Table& tab, const String& name)
+{
+  TableColumn col(tab, name);
+  Vector<Double> values = getValues (tab, name);
+  Vector<rownr_t> startRows;
+  Vector<Double> minValues, maxValues;
+  AlwaysAssertExit (col.getZoneMap (startRows, minValues, maxValues));
+  AlwaysAssertExit (startRows.size() > 0  &&  startRows[0] == 0);
+  AlwaysAssertExit (startRows.size() == minValues.size());
+  for (uInt i=0; i<startRows.size(); ++i) {
+    rownr_t end = (i+1 < startRows.size() ? startRows[i+1] : tab.nrow());
+    for (rownr_t j=startRows[i]; j<end; ++j) {
+      AlwaysAssertExit (values[j] >= minValues[i]  &&
+                        values[j] <= maxValues[i]);
+    }
+  }
+}
+
+// Check if the selection gives the same rows as a brute force selection.
+void checkSelect (const Table& tab, const String& name,
+                  Double start, Double end)
+{
+  Table sel = tab(tab.col(name) >= start  &&  tab.col(name) < end);
+  Vector<Double> values = getValues (tab, name);
+  Vector<rownr_t> rows = sel.rowNumbers();
+  rownr_t n = 0;
+  for (rownr_t i=0; i<values.size(); ++i) {
+    if (values[i] >= start  &&  values[i] < end) {
+      AlwaysAssertExit (n < rows.size()  &&  rows[n] == i);
+      n++;
+    }
+  }
+  AlwaysAssertExit (n == rows.size());
+}
+
+void createTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<Int> ("SCAN"));
+  td.addColumn (ScalarColumnDesc<Float> ("WEIGHT"));
+  td.addColumn (ArrayColumnDesc<Float> ("DATA", IPosition(1,2),
+                                        ColumnDesc::FixedShape));
+  SetupNewTable newtab ("tStManZoneMap_tmp.tab", td, Table::New);
+  IncrementalStMan ism ("ISM", 1024);
+  StandardStMan ssm ("SSM", 512);
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("TIME", ism);
+  Table tab(newtab, nrow);
+  ScalarColumn<Double> time(tab, "TIME");
+  ScalarColumn<Int> scan(tab, "SCAN");
+  ScalarColumn<Float> weight(tab, "WEIGHT");
+  for (uInt i=0; i<nrow; ++i) {
+    time.put (i, 1000. + i/10);
+    scan.put (i, i/50);
+    weight.put (i, (i%7) * 0.5);
+  }
+  // Array columns do not have a zone map.
+  Vector<rownr_t> startRows;
+  Vector<Double> minValues, maxValues;
+  AlwaysAssertExit (! TableColumn(tab, "DATA").getZoneMap
+                    (startRows, minValues, maxValues));
+}
+
+void checkTable (const Table& tab)
+{
+  checkZoneMap (tab, "TIME");
+  checkZoneMap (tab, "SCAN");
+  checkZoneMap (tab, "WEIGHT");
+  checkSelect (tab, "TIME", 1010, 1020);
+  checkSelect (tab, "SCAN", 3, 5);
+  checkSelect (tab, "WEIGHT", 1, 2);
+  checkSelect (tab, "SCAN", 1000, 2000);
+}
+
+int main()
+{
+  try {
+    createTable (5000);
+    {
+      // Use the zone maps as persisted with the index.
+      Table tab("tStManZoneMap_tmp.tab");
+      Vector<rownr_t> startRows;
+      Vector<Double> minValues, maxValues;
+      TableColumn(tab, "SCAN").getZoneMap (startRows, minValues, maxValues);
+      AlwaysAssertExit (startRows.size() > 1);
+      AlwaysAssertExit (minValues[0] == 0);
+      AlwaysAssertExit (maxValues[maxValues.size()-1] == 99);
+      checkTable (tab);
+    }
+    {
+      // Update, add and remove rows; the zone maps have to follow.
+      Table tab("tStManZoneMap_tmp.tab", Table::Update);
+      ScalarColumn<Double> time(tab, "TIME");
+      ScalarColumn<Int> scan(tab, "SCAN");
+      scan.put (10, 200);
+      time.put (20, 5000);
+      checkTable (tab);
+      tab.addRow (100);
+      for (uInt i=5000; i<5100; ++i) {
+        time.put (i, 2000);
+        scan.put (i, -1);
+      }
+      checkTable (tab);
+      Vector<rownr_t> rows(500);
+      indgen (rows, rownr_t(1000));
+      tab.removeRow (rows);
+      checkTable (tab);
+    }
+    {
+      Table tab("tStManZoneMap_tmp.tab");
+      AlwaysAssertExit (tab.nrow() == 4600);
+      checkTable (tab);
+    }
+    {
+      // Swap the names of two columns; their zone maps must not be swapped.
+      Table tab("tStManZoneMap_tmp.tab", Table::Update);
+      tab.renameColumn ("TMP", "SCAN");
+      tab.renameColumn ("SCAN", "WEIGHT");
+      tab.renameColumn ("WEIGHT", "TMP");
+    }
+    {
+      Table tab("tStManZoneMap_tmp.tab", Table::Update);
+      checkTable (tab);
+      // Infinite values must be found by a selection with an open end,
+      // also if a zone contains infinite values only.
+      // Note that the Float column is now called SCAN.
+      TableColumn col(tab, "SCAN");
+      Vector<rownr_t> startRows;
+      Vector<Double> minValues, maxValues;
+      AlwaysAssertExit (col.getZoneMap (startRows, minValues, maxValues));
+      AlwaysAssertExit (startRows.size() > 3);
+      ScalarColumn<Float> weight(tab, "SCAN");
+      for (rownr_t i=startRows[1]; i<startRows[2]; ++i) {
+        weight.put (i, std::numeric_limits<Float>::infinity());
+      }
+      for (rownr_t i=startRows[2]; i<startRows[3]; ++i) {
+        weight.put (i, -std::numeric_limits<Float>::infinity());
+      }
+      checkZoneMap (tab, "SCAN");
+      Table sel1 = tab(tab.col("SCAN") > 10);
+      AlwaysAssertExit (sel1.nrow() == startRows[2] - startRows[1]);
+      AlwaysAssertExit (sel1.rowNumbers()[0] == startRows[1]);
+      Table sel2 = tab(tab.col("SCAN") < -10);
+      AlwaysAssertExit (sel2.nrow() == startRows[3] - startRows[2]);
+      AlwaysAssertExit (sel2.rowNumbers()[0] == startRows[2]);
+    }
+  } catch (std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -92,6 +92,9 @@ void info(const Table aTable);
 // put/putColumn cache test
 void putColumnTest();
 
+// test readonly access using a memory-mapped file
+void mappedTest();
+
 int main (int argc, const char* argv[])
 {
     uInt aNr = 250;
@@ -108,6 +111,7 @@ int main (int argc, const char* argv[])
 	deleteAndRestore();
 	// 
 	putColumnTest();
+	mappedTest();
 	// delete middle Column
        	deleteColumn    ("Col-2");
 	// add a Bool Column Should fit in freed space
@@ -598,18 +602,39 @@ void putColumnTest()
   AlwaysAssertExit (ab(5) == 4);
 }
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
+void mappedTest()
+{
+  // Get the values using the normal cache.
+  Vector<DComplex> dcvals;
+  Vector<Int> ivals;
+  Vector<Bool> bvals;
+  {
+    Table aTable = Table("tStandardStMan_tmp.data");
+    dcvals = ScalarColumn<DComplex>(aTable,"Col-1").getColumn();
+    ivals  = ScalarColumn<Int>(aTable,"Col-2").getColumn();
+    bvals  = ScalarColumn<Bool>(aTable,"Col-3").getColumn();
+  }
+  // Get them again using a memory-mapped file; per row and entire column.
+  Table aTable = Table("tStandardStMan_tmp.data", Table::Old,
+                       TSMOption(TSMOption::MMap));
+  ScalarColumn<DComplex> aa(aTable,"Col-1");
+  ScalarColumn<Int> ab(aTable,"Col-2");
+  ScalarColumn<Bool> ac(aTable,"Col-3");
+  AlwaysAssertExit (allEQ (aa.getColumn(), dcvals));
+  AlwaysAssertExit (allEQ (ab.getColumn(), ivals));
+  AlwaysAssertExit (allEQ (ac.getColumn(), bvals));
+  for (uInt i=0; i<aTable.nrow(); i++) {
+    AlwaysAssertExit (aa(i) == dcvals(i));
+    AlwaysAssertExit (ab(i) == ivals(i));
+    AlwaysAssertExit (ac(i) == bvals(i));
+  }
+  // Reopening for write should switch off the mapping.
+  // Flush twice, so the index is written in the same place again.
+  aTable.reopenRW();
+  ab.put (5, ivals(5) + 10);
+  AlwaysAssertExit (ab(5) == ivals(5) + 10);
+  aTable.flush();
+  ab.put (5, ivals(5));
+  AlwaysAssertExit (allEQ (ab.getColumn(), ivals));
+  aTable.flush();
+}
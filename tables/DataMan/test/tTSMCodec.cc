@@ -0,0 +1,323 @@
+//# tTSMCodec.cc: Test program for compressed tiles in the Tiled Storage Managers
+//# Copyright (C) 2015
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/DataMan/TSMCodec.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for compressed tiles in the Tiled Storage Managers.
+// </summary>
+
+// Test the basic codec functions.
+void testCodec()
+{
+  // Fill a buffer with smooth float data (compresses well after shuffle).
+  uInt nval = 4096;
+  Block<float> values(nval);
+  for (uInt i=0; i<nval; i++) {
+    values[i] = 1000 + i/16;
+  }
+  const char* data = (const char*)(values.storage());
+  uInt length = nval * sizeof(float);
+  // Test shuffle.
+  std::vector<char> shuf(length), unshuf(length);
+  TSMCodec::shuffle (&shuf[0], data, nval, sizeof(float));
+  TSMCodec::unshuffle (&unshuf[0], &shuf[0], nval, sizeof(float));
+  AlwaysAssertExit (memcmp (data, &unshuf[0], length) == 0);
+  // Test the codecs using two parts (float and short).
+  Block<uInt> partOffset(2);
+  partOffset[0] = 0;
+  partOffset[1] = length - 1000;
+  Block<uInt> valueSize(2);
+  valueSize[0] = 4;
+  valueSize[1] = 2;
+  uInt lengths[3];
+  for (Int c=TSMCodec::None; c<=TSMCodec::ShuffleLZ; c++) {
+    TSMCodec::Type codec = TSMCodec::Type(c);
+    Block<char> encoded;
+    uInt len = TSMCodec::encode (codec, encoded, data, length,
+                                 partOffset, valueSize);
+    std::vector<char> decoded(length);
+    TSMCodec::decode (&decoded[0], length, encoded.storage(), len,
+                      partOffset, valueSize);
+    AlwaysAssertExit (memcmp (data, &decoded[0], length) == 0);
+    AlwaysAssertExit (TSMCodec::fromString (TSMCodec::toString(codec))
+                      == codec);
+    lengths[c] = len;
+  }
+  AlwaysAssertExit (lengths[TSMCodec::None] == length + 1);
+  AlwaysAssertExit (lengths[TSMCodec::LZ] < length);
+  AlwaysAssertExit (lengths[TSMCodec::ShuffleLZ] < lengths[TSMCodec::LZ]);
+  // Incompressible data are stored as such.
+  Block<char> noise(1000);
+  uInt seed = 1;
+  for (uInt i=0; i<noise.nelements(); i++) {
+    seed = seed * 1103515245 + 12345;
+    noise[i] = char(seed >> 16);
+  }
+  Block<char> encoded;
+  Block<uInt> offs(1, 0u);
+  Block<uInt> sizes(1, 1u);
+  uInt len = TSMCodec::encode (TSMCodec::LZ, encoded, noise.storage(),
+                               noise.nelements(), offs, sizes);
+  AlwaysAssertExit (len == noise.nelements() + 1);
+  AlwaysAssertExit (encoded[0] == char(TSMCodec::None));
+  // Corrupt data must result in an exception.
+  len = TSMCodec::encode (TSMCodec::LZ, encoded, data, length,
+                          partOffset, valueSize);
+  std::vector<char> decoded(length);
+  Bool failed = False;
+  try {
+    TSMCodec::decode (&decoded[0], length, encoded.storage(), len/2,
+                      partOffset, valueSize);
+  } catch (AipsError& x) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  failed = False;
+  try {
+    TSMCodec::fromString ("zip");
+  } catch (AipsError& x) {
+    cout << x.getMesg() << endl;
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  cout << "codec tests have been done" << endl;
+}
+
+// The data value in a row.
+// Every 7th row gets some values which compress worse.
+Cube<Float> rowData (uInt row, const IPosition& shape, Bool modify=False)
+{
+  Cube<Float> data(shape);
+  indgen (data, Float(row));
+  if (modify  &&  row%7 == 0) {
+    data(1,1,1) = 1.2345e-20;
+    data(2,3,4) = -7.5e10;
+  }
+  return data;
+}
+
+// Create a table with two compressed columns.
+// The spec record is used to define the codec of the TiledColumnStMan,
+// while setTileCodec is used for the TiledShapeStMan.
+void writeTable (const IPosition& shape, uInt nrrow)
+{
+  TableDesc td ("", "1", TableDesc::Scratch);
+  td.addColumn (ArrayColumnDesc<Float> ("Data", shape, ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Bool> ("Flag", 3));
+  SetupNewTable newtab("tTSMCodec_tmp.data", td, Table::New);
+  Record spec;
+  spec.define ("DEFAULTTILESHAPE", IPosition(4,4,8,8,4).asVector());
+  spec.define ("TILECODEC", "ShuffleLZ");
+  TiledColumnStMan sm1 ("TSMData", spec);
+  TiledShapeStMan sm2 ("TSMFlag", IPosition(4,4,8,8,4));
+  sm2.setTileCodec (TSMCodec::LZ);
+  newtab.bindColumn ("Data", sm1);
+  newtab.bindColumn ("Flag", sm2);
+  // Ask for buffered IO; the compressed tiles must use the cache.
+  Table table(newtab, 0, False, Table::LittleEndian,
+              TSMOption(TSMOption::Buffer, 0, 0));
+  ArrayColumn<Float> data (table, "Data");
+  ArrayColumn<Bool> flag (table, "Flag");
+  for (uInt i=0; i<nrrow; i++) {
+    table.addRow();
+    data.put (i, rowData(i, shape));
+    flag.put (i, rowData(i, shape) > Float(i+100));
+  }
+  // Rewrite some rows with data that compress worse.
+  for (uInt i=0; i<nrrow; i+=7) {
+    data.put (i, rowData(i, shape, True));
+  }
+  cout << "TILECODEC " << table.dataManagerInfo().subRecord(0)
+    .subRecord("SPEC").asString("TILECODEC") << ' '
+       << table.dataManagerInfo().subRecord(1)
+    .subRecord("SPEC").asString("TILECODEC") << endl;
+}
+
+Bool checkRow (const Cube<Float>& arr, uInt row, const IPosition& shape)
+{
+  return allEQ (arr, rowData(row, shape, True));
+}
+
+void readTable (const IPosition& shape, uInt nrrow, const TSMOption& tsmOpt)
+{
+  Table table("tTSMCodec_tmp.data", Table::Old, tsmOpt);
+  AlwaysAssertExit (table.nrow() == nrrow);
+  ArrayColumn<Float> data (table, "Data");
+  ArrayColumn<Bool> flag (table, "Flag");
+  // Read entire cells.
+  for (uInt i=0; i<nrrow; i++) {
+    AlwaysAssertExit (checkRow (data(i), i, shape));
+    AlwaysAssertExit (allEQ (flag(i), rowData(i, shape) > Float(i+100)));
+  }
+  // Read the entire column (spans many tiles, so decompressed in parallel).
+  Array<Float> all = data.getColumn();
+  for (uInt i=0; i<nrrow; i++) {
+    Cube<Float> arr (all[i]);
+    AlwaysAssertExit (checkRow (arr, i, shape));
+  }
+  // Read a slice of the column.
+  Slicer slicer (IPosition(3,1,2,3), IPosition(3,2,5,4));
+  Array<Float> sl = data.getColumn (slicer);
+  for (uInt i=0; i<nrrow; i++) {
+    Cube<Float> arr (sl[i]);
+    Cube<Float> full(data(i));
+    AlwaysAssertExit (allEQ (arr, full(slicer)));
+  }
+  cout << "read " << nrrow << " rows" << endl;
+}
+
+void extendTable (const IPosition& shape, uInt nrrow, uInt nradd)
+{
+  Table table("tTSMCodec_tmp.data", Table::Update);
+  ArrayColumn<Float> data (table, "Data");
+  ArrayColumn<Bool> flag (table, "Flag");
+  for (uInt i=nrrow; i<nrrow+nradd; i++) {
+    table.addRow();
+    data.put (i, rowData(i, shape, True));
+    flag.put (i, rowData(i, shape) > Float(i+100));
+  }
+}
+
+// The data value in a row with a fraction of the values being noise.
+// The more noise, the worse the data compress.
+Cube<Float> noisyData (uInt row, const IPosition& shape, uInt noise)
+{
+  Cube<Float> data = rowData (row, shape);
+  uInt seed = row + 1;
+  Float* ptr = data.data();
+  for (uInt i=0; i<data.size(); i++) {
+    seed = seed * 1103515245 + 12345;
+    if ((seed >> 16) % 16 < noise) {
+      ptr[i] = Float(seed >> 8);
+    }
+  }
+  return data;
+}
+
+Int64 dataFileSize (const String& tableName)
+{
+  return RegularFile(tableName + "/table.f0_TSM0").size();
+}
+
+// Rewrite the data several times, each time with data that compress worse.
+// So the tiles grow and have to be moved.
+// The space of the moved tiles must be reused, thus the file must not be
+// much larger than a file holding the final data only.
+void rewriteTable (const IPosition& shape, uInt nrrow)
+{
+  const uInt nround = 8;
+  {
+    Table table("tTSMCodec_tmp.data", Table::Update);
+    ArrayColumn<Float> data (table, "Data");
+    for (uInt noise=1; noise<=nround; noise++) {
+      for (uInt i=0; i<nrrow; i++) {
+        data.put (i, noisyData(i, shape, noise));
+      }
+      table.flush();
+    }
+  }
+  // Write the final data in a new table.
+  {
+    Table tab("tTSMCodec_tmp.data");
+    tab.deepCopy ("tTSMCodec_tmp.data2", Table::New, True);
+  }
+  {
+    Table table("tTSMCodec_tmp.data2");
+    ArrayColumn<Float> data (table, "Data");
+    AlwaysAssertExit (allEQ (data(0), noisyData(0, shape, nround)));
+    Record dminfo = table.dataManagerInfo();
+    for (uInt i=0; i<dminfo.nfields(); i++) {
+      if (dminfo.subRecord(i).asString("NAME") == "TSMData") {
+        AlwaysAssertExit (dminfo.subRecord(i).subRecord("SPEC")
+                          .asString("TILECODEC") == "ShuffleLZ");
+      }
+    }
+  }
+  // The free extents have to be persistent.
+  {
+    Table table("tTSMCodec_tmp.data", Table::Update);
+    ArrayColumn<Float> data (table, "Data");
+    for (uInt i=0; i<nrrow; i++) {
+      AlwaysAssertExit (allEQ (data(i), noisyData(i, shape, nround)));
+      data.put (i, noisyData(i, shape, 2));
+    }
+    table.flush();
+    for (uInt i=0; i<nrrow; i++) {
+      data.put (i, noisyData(i, shape, nround));
+    }
+  }
+  Table table("tTSMCodec_tmp.data");
+  ArrayColumn<Float> data (table, "Data");
+  for (uInt i=0; i<nrrow; i++) {
+    AlwaysAssertExit (allEQ (data(i), noisyData(i, shape, nround)));
+  }
+  Int64 size1 = dataFileSize ("tTSMCodec_tmp.data");
+  Int64 size2 = dataFileSize ("tTSMCodec_tmp.data2");
+  cout << "rewritten file size < 2*new file size: "
+       << (size1 < 2*size2) << endl;
+}
+
+int main()
+{
+  try {
+    testCodec();
+    IPosition shape(3,4,16,16);
+    writeTable (shape, 50);
+    readTable (shape, 50, TSMOption(TSMOption::Cache, 0, 0));
+    readTable (shape, 50, TSMOption(TSMOption::MMap, 0, 0));
+    extendTable (shape, 50, 23);
+    readTable (shape, 73, TSMOption(TSMOption::Default, 0, 0));
+    // The compressed data file must be much smaller than the raw data.
+    Int64 rawSize = 73 * shape.product() * sizeof(Float);
+    Int64 fileSize = RegularFile("tTSMCodec_tmp.data/table.f0_TSM0").size();
+    cout << "file size < raw/2: " << (fileSize < rawSize/2) << endl;
+    rewriteTable (shape, 73);
+  } catch (AipsError& x) {
+    cout << "Caught an exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;
+}
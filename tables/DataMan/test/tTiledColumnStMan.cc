@@ -46,6 +46,8 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <casacore/casa/sstream.h>
+#include <stdlib.h>
 
 #include <casacore/casa/namespace.h>
 // <summary>
@@ -59,6 +61,7 @@
 void writeFixed(const TSMOption&);
 void readTable(const TSMOption&, Bool readKeys);
 void writeNoHyper(const TSMOption&);
+void readPrefetch();
 
 int main () {
     try {
@@ -68,6 +71,7 @@ int main () {
 	readTable(TSMOption::Buffer, False);
         writeFixed(TSMOption::Buffer);
 	readTable(TSMOption::Cache, False);
+	readPrefetch();
     } catch (AipsError x) {
 	cout << "Caught an exception: " << x.getMesg() << endl;
 	return 1;
@@ -356,6 +360,69 @@ void readTable (const TSMOption& tsmOpt, Bool readKeys)
     }
 }
 
+// Get the number of prefetch hits from the cache statistics.
+uInt prefetchHits (const ROTiledStManAccessor& accessor)
+{
+    ostringstream os;
+    accessor.showCacheStatistics (os);
+    istringstream is(os.str());
+    String prefix("#pf-hits:");
+    String line;
+    while (getline (is, line)) {
+        if (line.startsWith (prefix)) {
+	    return atoi (line.substr(prefix.size()).c_str());
+	}
+    }
+    return 0;
+}
+
+// Read the data sequentially with read-ahead.
+// The cache statistics are not shown, because the number of prefetched
+// tiles depends on the timing of the read-ahead thread.
+void readPrefetch()
+{
+    Table table("tTiledColumnStMan_tmp.data", Table::Old,
+                TSMOption(TSMOption::Cache, 0, 0, 2));
+    ROTiledStManAccessor accessor (table, "TSMExample");
+    ArrayColumn<float> data (table, "Data");
+    Matrix<float> array(IPosition(2,16,20));
+    Matrix<float> result(IPosition(2,16,20));
+    indgen (array);
+    for (uInt i=0; i<table.nrow(); i++) {
+	data.get (i, result);
+	if (! allEQ (array, result)) {
+	    cout << "mismatch in prefetched data row " << i << endl;
+	}
+	array += float(200);
+	// Let the read-ahead thread read the next tiles.
+	accessor.waitPrefetch();
+    }
+#ifdef USE_THREADS
+    // The next rows' tiles must have been found in the cache.
+    if (prefetchHits (accessor) == 0) {
+        cout << "no prefetched tiles have been used" << endl;
+    }
+#endif
+    accessor.clearCaches();
+    // Read slices of each cell, so the same tiles are accessed several times
+    // before moving to the next cell.
+    Matrix<float> slice(8,20);
+    Array<float> sliceResult;
+    for (uInt i=0; i<table.nrow(); i++) {
+	for (uInt j=0; j<20; j++) {
+	    for (uInt k=0; k<8; k++) {
+	        slice(k,j) = float(200*i + 16*j + k + 8);
+	    }
+	}
+	data.getSlice (i, Slicer(IPosition(2,8,0), IPosition(2,8,20)),
+		       sliceResult, True);
+	if (! allEQ (sliceResult, slice)) {
+	    cout << "mismatch in prefetched getSlice " << i << endl;
+	}
+    }
+    cout << "prefetched get's have been done" << endl;
+}
+
 // First build a description.
 void writeNoHyper(const TSMOption& tsmOpt)
 {
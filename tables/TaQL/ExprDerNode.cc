@@ -29,9 +29,11 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/BasicMath/Math.h>
@@ -39,6 +41,7 @@
 #include <casacore/casa/OS/Time.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
 
 
 
@@ -54,6 +57,12 @@ TableExprNodeConstBool::~TableExprNodeConstBool()
 {}
 Bool TableExprNodeConstBool::getBool (const TableExprId&)
     { return value_p; }
+void TableExprNodeConstBool::getBoolVector (const Vector<rownr_t>& rownrs,
+                                            Vector<Bool>& values)
+{
+    values.resize (rownrs.size());
+    values = value_p;
+}
 
 TableExprNodeConstInt::TableExprNodeConstInt (const Int64& val)
 : TableExprNodeBinary (NTInt, VTScalar, OtLiteral, Table()),
@@ -67,6 +76,18 @@ Double TableExprNodeConstInt::getDouble (const TableExprId&)
     { return value_p; }
 DComplex TableExprNodeConstInt::getDComplex (const TableExprId&)
     { return double(value_p); }
+void TableExprNodeConstInt::getIntVector (const Vector<rownr_t>& rownrs,
+                                          Vector<Int64>& values)
+{
+    values.resize (rownrs.size());
+    values = value_p;
+}
+void TableExprNodeConstInt::getDoubleVector (const Vector<rownr_t>& rownrs,
+                                             Vector<Double>& values)
+{
+    values.resize (rownrs.size());
+    values = Double(value_p);
+}
 
 TableExprNodeConstDouble::TableExprNodeConstDouble (const Double& val)
 : TableExprNodeBinary (NTDouble, VTScalar, OtLiteral, Table()),
@@ -78,6 +99,12 @@ Double TableExprNodeConstDouble::getDouble (const TableExprId&)
     { return value_p; }
 DComplex TableExprNodeConstDouble::getDComplex (const TableExprId&)
     { return value_p; }
+void TableExprNodeConstDouble::getDoubleVector (const Vector<rownr_t>& rownrs,
+                                                Vector<Double>& values)
+{
+    values.resize (rownrs.size());
+    values = value_p;
+}
 
 TableExprNodeConstDComplex::TableExprNodeConstDComplex (const DComplex& val)
 : TableExprNodeBinary (NTComplex, VTScalar, OtLiteral, Table()),
@@ -105,6 +132,8 @@ TableExprNodeConstRegex::~TableExprNodeConstRegex()
 {}
 TaqlRegex TableExprNodeConstRegex::getRegex (const TableExprId&)
     { return value_p; }
+Bool TableExprNodeConstRegex::isThreadSafe() const
+    { return False; }
 
 TableExprNodeConstDate::TableExprNodeConstDate (const MVTime& val)
 : TableExprNodeBinary (NTDate, VTScalar, OtLiteral, Table()),
@@ -129,7 +158,9 @@ TableExprNodeColumn::TableExprNodeColumn (const Table& table,
   : TableExprNodeBinary (NTNumeric, VTScalar, OtColumn, table),
     selTable_p       (table),
     tabCol_p         (table, name),
-    applySelection_p (True)
+    applySelection_p (True),
+    concurrent_p     (False),
+    mutex_p          (0)
 {
     //# Check if the column is a scalar.
     if (! tabCol_p.columnDesc().isScalar()) {
@@ -186,7 +217,7 @@ void TableExprNodeColumn::disableApplySelection()
     applySelection_p = False;
 }
   
-void TableExprNodeColumn::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeColumn::applySelection (const Vector<rownr_t>& rownrs)
 {
     if (applySelection_p) {
         // Attach the column to the selection of the table.
@@ -204,100 +235,363 @@ void TableExprNodeColumn::applySelection (const Vector<uInt>& rownrs)
 const TableColumn& TableExprNodeColumn::getColumn() const
     { return tabCol_p; }
 
+// Lock the mutex (if given) while reading a column in a multi-threaded
+// evaluation of an expression.
+class TableExprColumnLock
+{
+public:
+    explicit TableExprColumnLock (Mutex* mutex)
+      : itsMutex (mutex)
+      { if (itsMutex) itsMutex->lock(); }
+    ~TableExprColumnLock()
+      { if (itsMutex) itsMutex->unlock(); }
+private:
+    TableExprColumnLock (const TableExprColumnLock&);
+    TableExprColumnLock& operator= (const TableExprColumnLock&);
+    Mutex* itsMutex;
+};
+
+// Read a value in the data type of the column without locking.
+template<typename T>
+static T getOneConcurrent (const TableColumn& col, rownr_t rownr)
+{
+    T val;
+    col.getScalarCellsConcurrent (&rownr, 1, &val);
+    return val;
+}
+
+// Read a real value concurrently and convert it to the requested type.
+template<typename T>
+static T getRealConcurrent (const TableColumn& col, rownr_t rownr)
+{
+    switch (col.columnDesc().dataType()) {
+    case TpUChar:
+        return getOneConcurrent<uChar> (col, rownr);
+    case TpShort:
+        return getOneConcurrent<Short> (col, rownr);
+    case TpUShort:
+        return getOneConcurrent<uShort> (col, rownr);
+    case TpInt:
+        return getOneConcurrent<Int> (col, rownr);
+    case TpUInt:
+        return getOneConcurrent<uInt> (col, rownr);
+    case TpInt64:
+        return getOneConcurrent<Int64> (col, rownr);
+    case TpFloat:
+        return T(getOneConcurrent<Float> (col, rownr));
+    case TpDouble:
+        return T(getOneConcurrent<Double> (col, rownr));
+    default:
+        throw TableInvExpr ("TableExprNodeColumn: column " +
+                            col.columnDesc().name() +
+                            " has an invalid type for concurrent reading");
+    }
+}
+
 Bool TableExprNodeColumn::getBool (const TableExprId& id)
 {
+    if (concurrent_p) {
+        return getOneConcurrent<Bool> (tabCol_p, id.rownr());
+    }
     Bool val;
+    TableExprColumnLock lock(mutex_p);
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 Int64 TableExprNodeColumn::getInt (const TableExprId& id)
 {
+    if (concurrent_p) {
+        return getRealConcurrent<Int64> (tabCol_p, id.rownr());
+    }
     Int64 val;
+    TableExprColumnLock lock(mutex_p);
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 Double TableExprNodeColumn::getDouble (const TableExprId& id)
 {
+    if (concurrent_p) {
+        return getRealConcurrent<Double> (tabCol_p, id.rownr());
+    }
     Double val;
+    TableExprColumnLock lock(mutex_p);
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 DComplex TableExprNodeColumn::getDComplex (const TableExprId& id)
 {
+    if (concurrent_p) {
+        switch (tabCol_p.columnDesc().dataType()) {
+        case TpComplex:
+            return getOneConcurrent<Complex> (tabCol_p, id.rownr());
+        case TpDComplex:
+            return getOneConcurrent<DComplex> (tabCol_p, id.rownr());
+        default:
+            return getRealConcurrent<Double> (tabCol_p, id.rownr());
+        }
+    }
     DComplex val;
+    TableExprColumnLock lock(mutex_p);
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 String TableExprNodeColumn::getString (const TableExprId& id)
 {
+    // String columns are never read concurrently.
     String val;
+    TableExprColumnLock lock(mutex_p);
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
 
+// Assign the values to the result vector. The values are converted if the
+// data types differ, otherwise the vector is referenced.
+template<typename T, typename U>
+static void assignVector (Vector<U>& values, const Vector<T>& vals)
+{
+    values.resize (vals.size());
+    convertArray (values, vals);
+}
+template<typename T>
+static void assignVector (Vector<T>& values, const Vector<T>& vals)
+{
+    values.reference (vals);
+}
+
+// Read the values of a scalar column in the given rows.
+// If concurrent, the values are read without locking, otherwise the
+// mutex (if given) is locked while reading.
+template<typename T, typename U>
+static void getColumnVector (const TableColumn& col,
+                             const Vector<rownr_t>& rownrs,
+                             Vector<U>& values,
+                             Bool concurrent, Mutex* mutex)
+{
+    Vector<T> vals;
+    if (concurrent) {
+        vals.resize (rownrs.size());
+        Bool deleteIt;
+        const rownr_t* rows = rownrs.getStorage (deleteIt);
+        col.getScalarCellsConcurrent (rows, rownrs.size(), vals.data());
+        rownrs.freeStorage (rows, deleteIt);
+    } else {
+        TableExprColumnLock lock(mutex);
+        ScalarColumn<T> scol (col);
+        vals.reference (scol.getColumnCells (RefRows(rownrs, False, True)));
+    }
+    assignVector (values, vals);
+}
+
+void TableExprNodeColumn::getBoolVector (const Vector<rownr_t>& rownrs,
+                                         Vector<Bool>& values)
+{
+    if (tabCol_p.columnDesc().dataType() == TpBool) {
+        getColumnVector<Bool> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+    } else {
+        TableExprNodeRep::getBoolVector (rownrs, values);
+    }
+}
+void TableExprNodeColumn::getIntVector (const Vector<rownr_t>& rownrs,
+                                        Vector<Int64>& values)
+{
+    switch (tabCol_p.columnDesc().dataType()) {
+    case TpUChar:
+        getColumnVector<uChar> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpShort:
+        getColumnVector<Short> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpUShort:
+        getColumnVector<uShort> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpInt:
+        getColumnVector<Int> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpUInt:
+        getColumnVector<uInt> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    default:
+        TableExprNodeRep::getIntVector (rownrs, values);
+    }
+}
+void TableExprNodeColumn::getDoubleVector (const Vector<rownr_t>& rownrs,
+                                           Vector<Double>& values)
+{
+    switch (tabCol_p.columnDesc().dataType()) {
+    case TpUChar:
+        getColumnVector<uChar> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpShort:
+        getColumnVector<Short> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpUShort:
+        getColumnVector<uShort> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpInt:
+        getColumnVector<Int> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpUInt:
+        getColumnVector<uInt> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpFloat:
+        getColumnVector<Float> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    case TpDouble:
+        getColumnVector<Double> (tabCol_p, rownrs, values,
+                                concurrent_p, mutex_p);
+        break;
+    default:
+        TableExprNodeRep::getDoubleVector (rownrs, values);
+    }
+}
+
+void TableExprNodeColumn::setThreadedRead (Bool concurrent, Mutex* mutex)
+{
+    concurrent_p = concurrent;
+    mutex_p      = mutex;
+}
+
+Bool TableExprNodeColumn::prepareConcurrentGet (uInt nthreads)
+{
+    return tabCol_p.prepareConcurrentGet (nthreads);
+}
+
 Bool TableExprNodeColumn::getColumnDataType (DataType& dt) const
 {
     dt = tabCol_p.columnDesc().dataType();
     return True;
 }
 
-Array<Bool>     TableExprNodeColumn::getColumnBool (const Vector<uInt>& rownrs)
+Array<Bool>     TableExprNodeColumn::getColumnBool (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Bool> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<uChar>    TableExprNodeColumn::getColumnuChar (const Vector<uInt>& rownrs)
+Array<uChar>    TableExprNodeColumn::getColumnuChar (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<uChar> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Short>    TableExprNodeColumn::getColumnShort (const Vector<uInt>& rownrs)
+Array<Short>    TableExprNodeColumn::getColumnShort (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Short> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<uShort>   TableExprNodeColumn::getColumnuShort (const Vector<uInt>& rownrs)
+Array<uShort>   TableExprNodeColumn::getColumnuShort (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<uShort> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Int>      TableExprNodeColumn::getColumnInt (const Vector<uInt>& rownrs)
+Array<Int>      TableExprNodeColumn::getColumnInt (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Int> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<uInt>     TableExprNodeColumn::getColumnuInt (const Vector<uInt>& rownrs)
+Array<uInt>     TableExprNodeColumn::getColumnuInt (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<uInt> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Float>    TableExprNodeColumn::getColumnFloat (const Vector<uInt>& rownrs)
+Array<Float>    TableExprNodeColumn::getColumnFloat (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Float> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Double>   TableExprNodeColumn::getColumnDouble (const Vector<uInt>& rownrs)
+Array<Double>   TableExprNodeColumn::getColumnDouble (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Double> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<Complex>  TableExprNodeColumn::getColumnComplex (const Vector<uInt>& rownrs)
+Array<Complex>  TableExprNodeColumn::getColumnComplex (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<Complex> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<DComplex> TableExprNodeColumn::getColumnDComplex (const Vector<uInt>& rownrs)
+Array<DComplex> TableExprNodeColumn::getColumnDComplex (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<DComplex> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
-Array<String>   TableExprNodeColumn::getColumnString (const Vector<uInt>& rownrs)
+Array<String>   TableExprNodeColumn::getColumnString (const Vector<rownr_t>& rownrs)
 {
     ScalarColumn<String> col (tabCol_p);
     return col.getColumnCells (rownrs);
 }
 
 
+TableExprColumnThreads::TableExprColumnThreads
+                              (const vector<TableExprNodeRep*>& nodes,
+                               uInt nthreads)
+  : itsConcurrent (False)
+{
+    if (nthreads <= 1) {
+        return;
+    }
+    vector<TableExprNodeRep*> cols;
+    for (uInt i=0; i<nodes.size(); ++i) {
+        if (nodes[i] != 0) {
+            nodes[i]->getColumnNodes (cols);
+        }
+    }
+    for (uInt i=0; i<cols.size(); ++i) {
+        TableExprNodeColumn* col = dynamic_cast<TableExprNodeColumn*>(cols[i]);
+        if (col != 0) {
+            itsColumns.push_back (col);
+        }
+    }
+    // Only read concurrently if all storage managers support it.
+    // Otherwise all reads are serialized, because columns can share
+    // a storage manager.
+    itsConcurrent = True;
+    try {
+        for (uInt i=0; i<itsColumns.size() && itsConcurrent; ++i) {
+            itsConcurrent = itsColumns[i]->prepareConcurrentGet (nthreads);
+        }
+    } catch (...) {
+        for (uInt i=0; i<itsColumns.size(); ++i) {
+            itsColumns[i]->prepareConcurrentGet (1);
+        }
+        throw;
+    }
+    if (! itsConcurrent) {
+        for (uInt i=0; i<itsColumns.size(); ++i) {
+            itsColumns[i]->prepareConcurrentGet (1);
+        }
+    }
+    for (uInt i=0; i<itsColumns.size(); ++i) {
+        itsColumns[i]->setThreadedRead (itsConcurrent,
+                                        itsConcurrent ? 0 : &itsMutex);
+    }
+}
+
+TableExprColumnThreads::~TableExprColumnThreads()
+{
+    for (uInt i=0; i<itsColumns.size(); ++i) {
+        itsColumns[i]->setThreadedRead (False, 0);
+        if (itsConcurrent) {
+            // A destructor should not throw.
+            try {
+                itsColumns[i]->prepareConcurrentGet (1);
+            } catch (std::exception& x) {
+                cerr << "~TableExprColumnThreads: " << x.what() << endl;
+            }
+        }
+    }
+}
+
+
 
 TableExprNodeRownr::TableExprNodeRownr (const Table& table, uInt origin)
 : TableExprNodeBinary (NTInt, VTScalar, OtRownr, table),
@@ -321,11 +615,11 @@ TableExprNodeRowid::TableExprNodeRowid (const Table& table)
 }
 TableExprNodeRowid::~TableExprNodeRowid ()
 {}
-void TableExprNodeRowid::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeRowid::applySelection (const Vector<rownr_t>& rownrs)
 {
     // Select the rowid-s of the given rows.
-    Vector<uInt> newRows(rownrs.size());
-    for (uInt i=0; i<rownrs.size(); ++i) {
+    Vector<rownr_t> newRows(rownrs.size());
+    for (size_t i=0; i<rownrs.size(); ++i) {
         newRows[i] = rownrs_p[rownrs[i]];
     }
     rownrs_p.reference (newRows);
@@ -352,5 +646,10 @@ Double TableExprNodeRandom::getDouble (const TableExprId&)
     return random_p();
 }
 
+Bool TableExprNodeRandom::isThreadSafe() const
+{
+    return False;
+}
+
 } //# NAMESPACE CASACORE - END
 
@@ -34,6 +34,7 @@
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/BasicMath/Random.h>
+#include <casacore/casa/OS/Mutex.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -78,6 +79,7 @@ public:
     TableExprNodeConstBool (const Bool& value);
     ~TableExprNodeConstBool();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
 private:
     Bool value_p;
 };
@@ -111,6 +113,9 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntVector    (const Vector<rownr_t>& rownrs, Vector<Int64>& values);
+    void getDoubleVector (const Vector<rownr_t>& rownrs,
+                          Vector<Double>& values);
 private:
     Int64 value_p;
 };
@@ -143,6 +148,8 @@ public:
     ~TableExprNodeConstDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleVector (const Vector<rownr_t>& rownrs,
+                          Vector<Double>& values);
 private:
     Double value_p;
 };
@@ -236,6 +243,8 @@ public:
     TableExprNodeConstRegex (const TaqlRegex& value);
     ~TableExprNodeConstRegex();
     TaqlRegex getRegex (const TableExprId& id);
+    // Regex matching is not thread-safe.
+    Bool isThreadSafe() const;
 private:
     TaqlRegex      value_p;
     StringDistance dist_p;
@@ -309,7 +318,7 @@ public:
     virtual void disableApplySelection();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     // Get the data type of this scalar column.
     Bool getColumnDataType (DataType&) const;
@@ -322,26 +331,95 @@ public:
     String   getString   (const TableExprId& id);
     const TableColumn& getColumn() const;
 
+    // Get the data for a block of rows.
+    // The values are read in bulk using getColumnCells.
+    void getBoolVector   (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
+    void getIntVector    (const Vector<rownr_t>& rownrs, Vector<Int64>& values);
+    void getDoubleVector (const Vector<rownr_t>& rownrs,
+                          Vector<Double>& values);
+
     // Get the data for the given rows.
-    Array<Bool>     getColumnBool (const Vector<uInt>& rownrs);
-    Array<uChar>    getColumnuChar (const Vector<uInt>& rownrs);
-    Array<Short>    getColumnShort (const Vector<uInt>& rownrs);
-    Array<uShort>   getColumnuShort (const Vector<uInt>& rownrs);
-    Array<Int>      getColumnInt (const Vector<uInt>& rownrs);
-    Array<uInt>     getColumnuInt (const Vector<uInt>& rownrs);
-    Array<Float>    getColumnFloat (const Vector<uInt>& rownrs);
-    Array<Double>   getColumnDouble (const Vector<uInt>& rownrs);
-    Array<Complex>  getColumnComplex (const Vector<uInt>& rownrs);
-    Array<DComplex> getColumnDComplex (const Vector<uInt>& rownrs);
-    Array<String>   getColumnString (const Vector<uInt>& rownrs);
+    Array<Bool>     getColumnBool (const Vector<rownr_t>& rownrs);
+    Array<uChar>    getColumnuChar (const Vector<rownr_t>& rownrs);
+    Array<Short>    getColumnShort (const Vector<rownr_t>& rownrs);
+    Array<uShort>   getColumnuShort (const Vector<rownr_t>& rownrs);
+    Array<Int>      getColumnInt (const Vector<rownr_t>& rownrs);
+    Array<uInt>     getColumnuInt (const Vector<rownr_t>& rownrs);
+    Array<Float>    getColumnFloat (const Vector<rownr_t>& rownrs);
+    Array<Double>   getColumnDouble (const Vector<rownr_t>& rownrs);
+    Array<Complex>  getColumnComplex (const Vector<rownr_t>& rownrs);
+    Array<DComplex> getColumnDComplex (const Vector<rownr_t>& rownrs);
+    Array<String>   getColumnString (const Vector<rownr_t>& rownrs);
 
     // Get the column unit (can be empty).
     static Unit getColumnUnit (const TableColumn&);
 
+    // Set how the column is read when the expression is evaluated by
+    // multiple threads (see class TableExprColumnThreads).
+    // If <src>concurrent</src> is True, the values are read using
+    // TableColumn::getScalarCellsConcurrent. Otherwise, if a mutex is
+    // given, it is locked around each read of the column.
+    // Use False and a null pointer to return to normal (serial) reading.
+    void setThreadedRead (Bool concurrent, Mutex* mutex);
+
+    // Prepare the column for concurrent reading by the given number of
+    // threads (1 resets it). It returns False if the storage manager
+    // does not support it.
+    Bool prepareConcurrentGet (uInt nthreads);
+
 protected:
     Table       selTable_p;
     TableColumn tabCol_p;
     Bool        applySelection_p;
+    Bool        concurrent_p;
+    Mutex*      mutex_p;
+};
+
+
+
+// <summary>
+// Prepare the column nodes of expressions for multi-threaded evaluation
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="UNKNOWN" date="" tests="tTableGramGroupAggr">
+// </reviewed>
+
+// <synopsis>
+// This class prepares the scalar column nodes of the given expression
+// nodes to be read by multiple threads and resets them in its destructor.
+// If the storage managers of all columns support concurrent reading (see
+// <linkto class=TableColumn>TableColumn::prepareConcurrentGet</linkto>),
+// the threads read the columns without any locking. Otherwise the reads
+// of the columns are serialized by a mutex owned by this object, because
+// the storage managers are not thread-safe.
+// <br>Nothing is done if only one thread is used, so normal reading does
+// not need any locking.
+// </synopsis>
+
+class TableExprColumnThreads
+{
+public:
+    // Prepare the column nodes in the given expression nodes.
+    TableExprColumnThreads (const vector<TableExprNodeRep*>& nodes,
+                            uInt nthreads);
+
+    // Reset the column nodes to normal reading.
+    ~TableExprColumnThreads();
+
+    // Are the columns read concurrently without locking?
+    Bool isConcurrent() const
+      { return itsConcurrent; }
+
+private:
+    // Copying is not possible.
+    TableExprColumnThreads (const TableExprColumnThreads&);
+    TableExprColumnThreads& operator= (const TableExprColumnThreads&);
+
+    vector<TableExprNodeColumn*> itsColumns;
+    Mutex                        itsMutex;
+    Bool                         itsConcurrent;
 };
 
 
@@ -406,10 +484,10 @@ class TableExprNodeRowid : public TableExprNodeBinary
 public:
     TableExprNodeRowid (const Table&);
     ~TableExprNodeRowid();
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
     Int64 getInt (const TableExprId& id);
 private:
-    Vector<uInt> rownrs_p;
+    Vector<rownr_t> rownrs_p;
 };
 
 
@@ -439,6 +517,8 @@ public:
     TableExprNodeRandom (const Table&);
     ~TableExprNodeRandom();
     Double getDouble (const TableExprId& id);
+    // The random generator has a state, so it cannot be used in parallel.
+    Bool isThreadSafe() const;
 private:
     MLCG    generator_p;
     Uniform random_p;
@@ -58,6 +58,19 @@ TableExprFuncNode::TableExprFuncNode (FunctionType ftype, NodeDataType dtype,
 TableExprFuncNode::~TableExprFuncNode()
 {}
 
+Bool TableExprFuncNode::isThreadSafe() const
+{
+    if (dataType() == NTString  ||  dataType() == NTRegex) {
+        return False;
+    }
+    for (uInt i=0; i<operands_p.nelements(); i++) {
+        if (operands_p[i] != 0  &&  !operands_p[i]->isThreadSafe()) {
+            return False;
+        }
+    }
+    return True;
+}
+
 // Fill the children pointers of a node.
 // Also reduce the tree if possible by combining constants.
 // If one of the nodes is a constant, convert its type if
@@ -301,6 +301,10 @@ public:
     MVTime    getDate     (const TableExprId& id);
     // </group>
 
+    // The function is thread-safe if its operands are, except for string
+    // functions (which might use static Regex objects).
+    virtual Bool isThreadSafe() const;
+
     // Check the data and value types of the operands.
     // It sets the exptected data and value types of the operands.
     // Set the value type of the function result and returns
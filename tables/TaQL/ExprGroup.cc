@@ -188,6 +188,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     { return False; }
   void TableExprGroupFuncBase::finish()
   {}
+  Bool TableExprGroupFuncBase::canMerge() const
+    { return False; }
+  void TableExprGroupFuncBase::merge (const TableExprGroupFuncBase&)
+  { throw TableInvExpr ("TableExprGroupFuncBase::merge not implemented"); }
+  Bool TableExprGroupFuncBase::isOperandThreadSafe() const
+    { return itsOperand == 0  ||  itsOperand->isThreadSafe(); }
   CountedPtr<vector<TableExprId> > TableExprGroupFuncBase::getIds() const
   { throw TableInvExpr ("TableExprGroupFuncBase::getIds not implemented"); }
   Bool TableExprGroupFuncBase::getBool (const vector<TableExprId>&)
@@ -241,6 +247,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsId = id;
     }
   }
+  Bool TableExprGroupFirst::canMerge() const
+  {
+    // The operand is only evaluated after the aggregation.
+    return True;
+  }
+  void TableExprGroupFirst::merge (const TableExprGroupFuncBase& other)
+  {
+    if (itsId.rownr() < 0) {
+      itsId = dynamic_cast<const TableExprGroupFirst&>(other).itsId;
+    }
+  }
   Bool TableExprGroupFirst::getBool (const vector<TableExprId>&)
     { return itsOperand->getBool (itsId); }
   Int64 TableExprGroupFirst::getInt (const vector<TableExprId>&)
@@ -275,6 +292,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsId = id;
   }
+  void TableExprGroupLast::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupLast& that =
+      dynamic_cast<const TableExprGroupLast&>(other);
+    if (that.itsId.rownr() >= 0) {
+      itsId = that.itsId;
+    }
+  }
 
   TableExprGroupExprId::TableExprGroupExprId (TableExprNodeRep* node)
     : TableExprGroupFuncBase (node)
@@ -295,6 +320,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     return itsIds;
   }
+  Bool TableExprGroupExprId::canMerge() const
+  {
+    return True;
+  }
+  void TableExprGroupExprId::merge (const TableExprGroupFuncBase& other)
+  {
+    const vector<TableExprId>& ids =
+      *dynamic_cast<const TableExprGroupExprId&>(other).itsIds;
+    itsIds->insert (itsIds->end(), ids.begin(), ids.end());
+  }
 
   TableExprGroupRowid::TableExprGroupRowid (TableExprNodeRep* node)
     : TableExprGroupFuncBase (node)
@@ -509,5 +544,25 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
   }
 
+  Bool TableExprGroupFuncSet::canMerge() const
+  {
+    for (uInt i=0; i<itsFuncs.size(); ++i) {
+      if (! itsFuncs[i]->canMerge()) {
+        return False;
+      }
+    }
+    return True;
+  }
+
+  void TableExprGroupFuncSet::merge (const TableExprGroupFuncSet& other)
+  {
+    AlwaysAssert (other.itsFuncs.size() == itsFuncs.size(), AipsError);
+    // The other set contains the later rows, so its id is the last row.
+    itsId = other.itsId;
+    for (uInt i=0; i<itsFuncs.size(); ++i) {
+      itsFuncs[i]->merge (*other.itsFuncs[i]);
+    }
+  }
+
 
 } //# NAMESPACE CASACORE - END
@@ -220,6 +220,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // If needed, finish the aggregation.
     // By default nothing is done.
     virtual void finish();
+    // Can the aggregation be done in parallel for parts of the table?
+    // It requires that the partial results can be merged (see function
+    // <src>merge</src>) and that the operand is thread-safe.
+    // The default implementation returns False.
+    virtual Bool canMerge() const;
+    // Merge the partial result of another function object of the same type
+    // into this one. The other object contains the result of the rows
+    // following the rows used by this object.
+    // The default implementation throws an exception.
+    virtual void merge (const TableExprGroupFuncBase& other);
     // Get the assembled TableExprIds of a group. It is specifically meant
     // for TableExprGroupExprId used for lazy aggregation.
     virtual CountedPtr<vector<TableExprId> > getIds() const;
@@ -246,6 +256,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     TableExprGroupFuncBase (const TableExprGroupFuncBase&);
     TableExprGroupFuncBase& operator= (const TableExprGroupFuncBase&);
   protected:
+    // Is the operand (if any) thread-safe?
+    Bool isOperandThreadSafe() const;
+
     //# Data member
     TableExprNodeRep* itsNode;
     TableExprNodeRep* itsOperand;
@@ -288,6 +301,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupFirst (TableExprNodeRep* node);
     virtual ~TableExprGroupFirst();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
     virtual Bool getBool (const vector<TableExprId>&);
     virtual Int64 getInt (const vector<TableExprId>&);
     virtual Double getDouble (const vector<TableExprId>&);
@@ -321,6 +336,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupLast (TableExprNodeRep* node);
     virtual ~TableExprGroupLast();
     virtual void apply (const TableExprId& id);
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -341,6 +357,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     virtual ~TableExprGroupExprId();
     virtual Bool isLazy() const;
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
     virtual CountedPtr<vector<TableExprId> > getIds() const;
   private:
     CountedPtr<vector<TableExprId> > itsIds;
@@ -782,6 +800,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Apply the functions to the given row.
     void apply (const TableExprId& id);
 
+    // Can all functions merge their partial results?
+    Bool canMerge() const;
+
+    // Merge the partial results of another set into this one.
+    // The other set must contain the same function types and the result
+    // of rows following the rows used by this set.
+    void merge (const TableExprGroupFuncSet& other);
+
     // Get the vector of functions.
     const vector<CountedPtr<TableExprGroupFuncBase> >& getFuncs() const
       { return itsFuncs; }
@@ -48,6 +48,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue++;
   }
+  Bool TableExprGroupCountAll::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupCountAll::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupCountAll& that =
+      dynamic_cast<const TableExprGroupCountAll&>(other);
+    itsValue += that.itsValue;
+  }
 
   TableExprGroupCount::TableExprGroupCount (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node),
@@ -72,6 +82,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsValue++;
     }
   }
+  Bool TableExprGroupCount::canMerge() const
+  {
+    return itsColumn == 0  &&  isOperandThreadSafe();
+  }
+  void TableExprGroupCount::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupCount& that =
+      dynamic_cast<const TableExprGroupCount&>(other);
+    itsValue += that.itsValue;
+  }
 
   TableExprGroupAny::TableExprGroupAny (TableExprNodeRep* node)
     : TableExprGroupFuncBool (node, False)
@@ -83,6 +103,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (v) itsValue = True;
   }
+  Bool TableExprGroupAny::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupAny::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupAny& that =
+      dynamic_cast<const TableExprGroupAny&>(other);
+    if (that.itsValue) itsValue = True;
+  }
 
   TableExprGroupAll::TableExprGroupAll (TableExprNodeRep* node)
     : TableExprGroupFuncBool (node, True)
@@ -94,6 +124,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (!v) itsValue = False;
   }
+  Bool TableExprGroupAll::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupAll::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupAll& that =
+      dynamic_cast<const TableExprGroupAll&>(other);
+    if (!that.itsValue) itsValue = False;
+  }
 
   TableExprGroupNTrue::TableExprGroupNTrue (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -105,6 +145,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (v) itsValue++;
   }
+  Bool TableExprGroupNTrue::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupNTrue::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupNTrue& that =
+      dynamic_cast<const TableExprGroupNTrue&>(other);
+    itsValue += that.itsValue;
+  }
 
   TableExprGroupNFalse::TableExprGroupNFalse (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -116,6 +166,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (!v) itsValue++;
   }
+  Bool TableExprGroupNFalse::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupNFalse::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupNFalse& that =
+      dynamic_cast<const TableExprGroupNFalse&>(other);
+    itsValue += that.itsValue;
+  }
 
   TableExprGroupMinInt::TableExprGroupMinInt (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node, std::numeric_limits<Int64>::max())
@@ -127,6 +187,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 v = itsOperand->getInt(id);
     if (v<itsValue) itsValue = v;
   }
+  Bool TableExprGroupMinInt::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupMinInt::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMinInt& that =
+      dynamic_cast<const TableExprGroupMinInt&>(other);
+    if (that.itsValue<itsValue) itsValue = that.itsValue;
+  }
 
   TableExprGroupMaxInt::TableExprGroupMaxInt (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node, std::numeric_limits<Int64>::min())
@@ -138,6 +208,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 v = itsOperand->getInt(id);
     if (v>itsValue) itsValue = v;
   }
+  Bool TableExprGroupMaxInt::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupMaxInt::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMaxInt& that =
+      dynamic_cast<const TableExprGroupMaxInt&>(other);
+    if (that.itsValue>itsValue) itsValue = that.itsValue;
+  }
 
   TableExprGroupSumInt::TableExprGroupSumInt(TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -148,6 +228,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue += itsOperand->getInt(id);
   }
+  Bool TableExprGroupSumInt::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupSumInt::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumInt& that =
+      dynamic_cast<const TableExprGroupSumInt&>(other);
+    itsValue += that.itsValue;
+  }
 
   TableExprGroupProductInt::TableExprGroupProductInt(TableExprNodeRep* node)
     : TableExprGroupFuncInt (node, 1)
@@ -158,6 +248,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue *= itsOperand->getInt(id);
   }
+  Bool TableExprGroupProductInt::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupProductInt::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupProductInt& that =
+      dynamic_cast<const TableExprGroupProductInt&>(other);
+    itsValue *= that.itsValue;
+  }
 
   TableExprGroupSumSqrInt::TableExprGroupSumSqrInt(TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -169,6 +269,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 v = itsOperand->getInt(id);
     itsValue += v*v;
   }
+  Bool TableExprGroupSumSqrInt::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupSumSqrInt::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumSqrInt& that =
+      dynamic_cast<const TableExprGroupSumSqrInt&>(other);
+    itsValue += that.itsValue;
+  }
 
 
   TableExprGroupMinDouble::TableExprGroupMinDouble(TableExprNodeRep* node)
@@ -181,6 +291,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double v = itsOperand->getDouble(id);
     if (v<itsValue) itsValue = v;
   }
+  Bool TableExprGroupMinDouble::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupMinDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMinDouble& that =
+      dynamic_cast<const TableExprGroupMinDouble&>(other);
+    if (that.itsValue<itsValue) itsValue = that.itsValue;
+  }
 
   TableExprGroupMaxDouble::TableExprGroupMaxDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node, std::numeric_limits<Double>::min())
@@ -192,6 +312,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double v = itsOperand->getDouble(id);
     if (v>itsValue) itsValue = v;
   }
+  Bool TableExprGroupMaxDouble::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupMaxDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMaxDouble& that =
+      dynamic_cast<const TableExprGroupMaxDouble&>(other);
+    if (that.itsValue>itsValue) itsValue = that.itsValue;
+  }
 
   TableExprGroupSumDouble::TableExprGroupSumDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node)
@@ -202,6 +332,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue += itsOperand->getDouble(id);
   }
+  Bool TableExprGroupSumDouble::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupSumDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumDouble& that =
+      dynamic_cast<const TableExprGroupSumDouble&>(other);
+    itsValue += that.itsValue;
+  }
 
   TableExprGroupProductDouble::TableExprGroupProductDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node, 1)
@@ -212,6 +352,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue *= itsOperand->getDouble(id);
   }
+  Bool TableExprGroupProductDouble::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupProductDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupProductDouble& that =
+      dynamic_cast<const TableExprGroupProductDouble&>(other);
+    itsValue *= that.itsValue;
+  }
 
   TableExprGroupSumSqrDouble::TableExprGroupSumSqrDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node)
@@ -223,6 +373,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double v = itsOperand->getDouble(id);
     itsValue += v*v;
   }
+  Bool TableExprGroupSumSqrDouble::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupSumSqrDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumSqrDouble& that =
+      dynamic_cast<const TableExprGroupSumSqrDouble&>(other);
+    itsValue += that.itsValue;
+  }
 
   TableExprGroupMeanDouble::TableExprGroupMeanDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node),
@@ -235,6 +395,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsValue += itsOperand->getDouble(id);
     itsNr++;
   }
+  Bool TableExprGroupMeanDouble::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupMeanDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMeanDouble& that =
+      dynamic_cast<const TableExprGroupMeanDouble&>(other);
+    itsValue += that.itsValue;
+    itsNr    += that.itsNr;
+  }
   void TableExprGroupMeanDouble::finish()
   {
     if (itsNr > 0) {
@@ -260,6 +431,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsValue += delta/itsNr;
     itsM2    += delta*(v-itsValue);
   }
+  Bool TableExprGroupVarianceDouble::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupVarianceDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupVarianceDouble& that =
+      dynamic_cast<const TableExprGroupVarianceDouble&>(other);
+    // Combine the partial means and variances using the parallel algorithm
+    // described at the same wikipedia page.
+    if (that.itsNr > 0) {
+      Int64  nr    = itsNr + that.itsNr;
+      Double delta = that.itsValue - itsValue;
+      itsValue += delta * that.itsNr / nr;
+      itsM2    += that.itsM2 + delta*delta * itsNr / nr * that.itsNr;
+      itsNr     = nr;
+    }
+  }
   void TableExprGroupVarianceDouble::finish()
   {
     if (itsNr > 1) {
@@ -292,6 +481,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsValue += v*v;
     itsNr++;
   }
+  Bool TableExprGroupRmsDouble::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupRmsDouble::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupRmsDouble& that =
+      dynamic_cast<const TableExprGroupRmsDouble&>(other);
+    itsValue += that.itsValue;
+    itsNr    += that.itsNr;
+  }
   void TableExprGroupRmsDouble::finish()
   {
     if (itsNr > 0) {
@@ -337,6 +537,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue += itsOperand->getDComplex(id);
   }
+  Bool TableExprGroupSumDComplex::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupSumDComplex::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumDComplex& that =
+      dynamic_cast<const TableExprGroupSumDComplex&>(other);
+    itsValue += that.itsValue;
+  }
 
   TableExprGroupProductDComplex::TableExprGroupProductDComplex(TableExprNodeRep* node)
     : TableExprGroupFuncDComplex (node, DComplex(1,0))
@@ -347,6 +557,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue *= itsOperand->getDComplex(id);
   }
+  Bool TableExprGroupProductDComplex::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupProductDComplex::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupProductDComplex& that =
+      dynamic_cast<const TableExprGroupProductDComplex&>(other);
+    itsValue *= that.itsValue;
+  }
 
   TableExprGroupSumSqrDComplex::TableExprGroupSumSqrDComplex(TableExprNodeRep* node)
     : TableExprGroupFuncDComplex (node)
@@ -358,6 +578,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     DComplex v = itsOperand->getDComplex(id);
     itsValue += v*v;
   }
+  Bool TableExprGroupSumSqrDComplex::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupSumSqrDComplex::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumSqrDComplex& that =
+      dynamic_cast<const TableExprGroupSumSqrDComplex&>(other);
+    itsValue += that.itsValue;
+  }
 
   TableExprGroupMeanDComplex::TableExprGroupMeanDComplex(TableExprNodeRep* node)
     : TableExprGroupFuncDComplex (node),
@@ -370,6 +600,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsValue += itsOperand->getDComplex(id);
     itsNr++;
   }
+  Bool TableExprGroupMeanDComplex::canMerge() const
+  {
+    return isOperandThreadSafe();
+  }
+  void TableExprGroupMeanDComplex::merge (const TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMeanDComplex& that =
+      dynamic_cast<const TableExprGroupMeanDComplex&>(other);
+    itsValue += that.itsValue;
+    itsNr    += that.itsNr;
+  }
   void TableExprGroupMeanDComplex::finish()
   {
     if (itsNr > 0) {
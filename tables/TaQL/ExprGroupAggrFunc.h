@@ -55,6 +55,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupCountAll (TableExprNodeRep* node);
     virtual ~TableExprGroupCountAll();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
     // Set result in case it is known directly.
     void setResult (Int64 cnt)
       { itsValue = cnt; }
@@ -75,6 +77,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupCount (TableExprNodeRep* node);
     virtual ~TableExprGroupCount();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   private:
     TableExprNodeArrayColumn* itsColumn;
   };
@@ -94,6 +98,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupAny (TableExprNodeRep* node);
     virtual ~TableExprGroupAny();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -111,6 +117,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupAll (TableExprNodeRep* node);
     virtual ~TableExprGroupAll();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -128,6 +136,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupNTrue (TableExprNodeRep* node);
     virtual ~TableExprGroupNTrue();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -145,6 +155,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupNFalse (TableExprNodeRep* node);
     virtual ~TableExprGroupNFalse();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -162,6 +174,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupMinInt (TableExprNodeRep* node);
     virtual ~TableExprGroupMinInt();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -179,6 +193,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupMaxInt (TableExprNodeRep* node);
     virtual ~TableExprGroupMaxInt();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -196,6 +212,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupSumInt (TableExprNodeRep* node);
     virtual ~TableExprGroupSumInt();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -213,6 +231,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupProductInt (TableExprNodeRep* node);
     virtual ~TableExprGroupProductInt();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -230,6 +250,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupSumSqrInt (TableExprNodeRep* node);
     virtual ~TableExprGroupSumSqrInt();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
 
@@ -248,6 +270,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupMinDouble (TableExprNodeRep* node);
     virtual ~TableExprGroupMinDouble();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -265,6 +289,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupMaxDouble (TableExprNodeRep* node);
     virtual ~TableExprGroupMaxDouble();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -282,6 +308,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupSumDouble (TableExprNodeRep* node);
     virtual ~TableExprGroupSumDouble();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -299,6 +327,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupProductDouble (TableExprNodeRep* node);
     virtual ~TableExprGroupProductDouble();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -316,6 +346,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupSumSqrDouble (TableExprNodeRep* node);
     virtual ~TableExprGroupSumSqrDouble();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -333,6 +365,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupMeanDouble (TableExprNodeRep* node);
     virtual ~TableExprGroupMeanDouble();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
     virtual void finish();
   private:
     Int64 itsNr;
@@ -355,6 +389,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupVarianceDouble (TableExprNodeRep* node);
     virtual ~TableExprGroupVarianceDouble();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
     virtual void finish();
   protected:
     Int64  itsNr;
@@ -395,6 +431,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupRmsDouble (TableExprNodeRep* node);
     virtual ~TableExprGroupRmsDouble();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
     virtual void finish();
   private:
     Int64 itsNr;
@@ -441,6 +479,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupSumDComplex (TableExprNodeRep* node);
     virtual ~TableExprGroupSumDComplex();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -458,6 +498,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupProductDComplex (TableExprNodeRep* node);
     virtual ~TableExprGroupProductDComplex();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -475,6 +517,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupSumSqrDComplex (TableExprNodeRep* node);
     virtual ~TableExprGroupSumSqrDComplex();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -492,6 +536,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupMeanDComplex (TableExprNodeRep* node);
     virtual ~TableExprGroupMeanDComplex();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (const TableExprGroupFuncBase& other);
     virtual void finish();
   private:
     Int64 itsNr;
@@ -27,15 +27,70 @@
 
 #include <casacore/tables/TaQL/ExprLogicNode.h>
 #include <casacore/tables/TaQL/ExprDerNode.h>
+#include <casacore/tables/TaQL/ExprNodeSet.h>
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
 #include <casacore/casa/Quanta/MVTime.h>
+#include <functional>
 #include <float.h>                     // for DBL_MAX
 #include <limits.h>                     // for DBL_MAX
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+// Compare the values of two vectors element by element.
+// The comparison functor is inlined, so the loop can be vectorized.
+template<typename T, typename CMP>
+static void compareVectors (const Vector<T>& left, const Vector<T>& right,
+                            Vector<Bool>& result, CMP cmp)
+{
+    result.resize (left.size());
+    Bool* res = result.data();
+    const T* lval = left.data();
+    const T* rval = right.data();
+    size_t n = left.size();
+    for (size_t i=0; i<n; ++i) {
+        res[i] = cmp(lval[i], rval[i]);
+    }
+}
+
+// Evaluate the right operand of an AND (OR) for the rows where the
+// left operand is True (False) and store its result in those rows.
+// In this way the right operand is only evaluated for the rows needed,
+// just like getBool does.
+static void evalRightOperand (TableExprNodeRep* rnode,
+                              const Vector<rownr_t>& rownrs,
+                              Vector<Bool>& values, Bool which)
+{
+    size_t n = values.size();
+    size_t nr = 0;
+    for (size_t i=0; i<n; ++i) {
+        if (values[i] == which) {
+            nr++;
+        }
+    }
+    if (nr == n) {
+        rnode->getBoolVector (rownrs, values);
+    } else if (nr > 0) {
+        Vector<rownr_t> rows(nr);
+        nr = 0;
+        for (size_t i=0; i<n; ++i) {
+            if (values[i] == which) {
+                rows[nr++] = rownrs[i];
+            }
+        }
+        Vector<Bool> right;
+        rnode->getBoolVector (rows, right);
+        nr = 0;
+        for (size_t i=0; i<n; ++i) {
+            if (values[i] == which) {
+                values[i] = right[nr++];
+            }
+        }
+    }
+}
+
+
 // Implement the comparison operators for each data type.
 
 TableExprNodeEQBool::TableExprNodeEQBool (const TableExprNodeRep& node)
@@ -57,6 +112,14 @@ Bool TableExprNodeEQInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) == rnode_p->getInt(id);
 }
+void TableExprNodeEQInt::getBoolVector (const Vector<rownr_t>& rownrs,
+                                        Vector<Bool>& values)
+{
+    Vector<Int64> left, right;
+    lnode_p->getIntVector (rownrs, left);
+    rnode_p->getIntVector (rownrs, right);
+    compareVectors (left, right, values, std::equal_to<Int64>());
+}
 
 TableExprNodeEQDouble::TableExprNodeEQDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -67,6 +130,14 @@ Bool TableExprNodeEQDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) == rnode_p->getDouble(id);
 }
+void TableExprNodeEQDouble::getBoolVector (const Vector<rownr_t>& rownrs,
+                                           Vector<Bool>& values)
+{
+    Vector<Double> left, right;
+    lnode_p->getDoubleVector (rownrs, left);
+    rnode_p->getDoubleVector (rownrs, right);
+    compareVectors (left, right, values, std::equal_to<Double>());
+}
 
 TableExprNodeEQDComplex::TableExprNodeEQDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -128,6 +199,14 @@ Bool TableExprNodeNEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) != rnode_p->getInt(id);
 }
+void TableExprNodeNEInt::getBoolVector (const Vector<rownr_t>& rownrs,
+                                        Vector<Bool>& values)
+{
+    Vector<Int64> left, right;
+    lnode_p->getIntVector (rownrs, left);
+    rnode_p->getIntVector (rownrs, right);
+    compareVectors (left, right, values, std::not_equal_to<Int64>());
+}
 
 TableExprNodeNEDouble::TableExprNodeNEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -138,6 +217,14 @@ Bool TableExprNodeNEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) != rnode_p->getDouble(id);
 }
+void TableExprNodeNEDouble::getBoolVector (const Vector<rownr_t>& rownrs,
+                                           Vector<Bool>& values)
+{
+    Vector<Double> left, right;
+    lnode_p->getDoubleVector (rownrs, left);
+    rnode_p->getDoubleVector (rownrs, right);
+    compareVectors (left, right, values, std::not_equal_to<Double>());
+}
 
 TableExprNodeNEDComplex::TableExprNodeNEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -189,6 +276,14 @@ Bool TableExprNodeGTInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) > rnode_p->getInt(id);
 }
+void TableExprNodeGTInt::getBoolVector (const Vector<rownr_t>& rownrs,
+                                        Vector<Bool>& values)
+{
+    Vector<Int64> left, right;
+    lnode_p->getIntVector (rownrs, left);
+    rnode_p->getIntVector (rownrs, right);
+    compareVectors (left, right, values, std::greater<Int64>());
+}
 
 TableExprNodeGTDouble::TableExprNodeGTDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -199,6 +294,14 @@ Bool TableExprNodeGTDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) > rnode_p->getDouble(id);
 }
+void TableExprNodeGTDouble::getBoolVector (const Vector<rownr_t>& rownrs,
+                                           Vector<Bool>& values)
+{
+    Vector<Double> left, right;
+    lnode_p->getDoubleVector (rownrs, left);
+    rnode_p->getDoubleVector (rownrs, right);
+    compareVectors (left, right, values, std::greater<Double>());
+}
 
 TableExprNodeGTDComplex::TableExprNodeGTDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -240,6 +343,14 @@ Bool TableExprNodeGEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) >= rnode_p->getInt(id);
 }
+void TableExprNodeGEInt::getBoolVector (const Vector<rownr_t>& rownrs,
+                                        Vector<Bool>& values)
+{
+    Vector<Int64> left, right;
+    lnode_p->getIntVector (rownrs, left);
+    rnode_p->getIntVector (rownrs, right);
+    compareVectors (left, right, values, std::greater_equal<Int64>());
+}
 
 TableExprNodeGEDouble::TableExprNodeGEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -250,6 +361,14 @@ Bool TableExprNodeGEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) >= rnode_p->getDouble(id);
 }
+void TableExprNodeGEDouble::getBoolVector (const Vector<rownr_t>& rownrs,
+                                           Vector<Bool>& values)
+{
+    Vector<Double> left, right;
+    lnode_p->getDoubleVector (rownrs, left);
+    rnode_p->getDoubleVector (rownrs, right);
+    compareVectors (left, right, values, std::greater_equal<Double>());
+}
 
 TableExprNodeGEDComplex::TableExprNodeGEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -374,6 +493,12 @@ Bool TableExprNodeOR::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) || rnode_p->getBool(id);
 }
+void TableExprNodeOR::getBoolVector (const Vector<rownr_t>& rownrs,
+                                     Vector<Bool>& values)
+{
+    lnode_p->getBoolVector (rownrs, values);
+    evalRightOperand (rnode_p, rownrs, values, False);
+}
 
 
 TableExprNodeAND::TableExprNodeAND (const TableExprNodeRep& node)
@@ -385,6 +510,12 @@ Bool TableExprNodeAND::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) && rnode_p->getBool(id);
 }
+void TableExprNodeAND::getBoolVector (const Vector<rownr_t>& rownrs,
+                                      Vector<Bool>& values)
+{
+    lnode_p->getBoolVector (rownrs, values);
+    evalRightOperand (rnode_p, rownrs, values, True);
+}
 
 
 TableExprNodeNOT::TableExprNodeNOT (const TableExprNodeRep& node)
@@ -396,91 +527,147 @@ Bool TableExprNodeNOT::getBool (const TableExprId& id)
 {
   return ! lnode_p->getBool(id);
 }
+void TableExprNodeNOT::getBoolVector (const Vector<rownr_t>& rownrs,
+                                      Vector<Bool>& values)
+{
+    lnode_p->getBoolVector (rownrs, values);
+    Bool* res = values.data();
+    size_t n = values.size();
+    for (size_t i=0; i<n; ++i) {
+        res[i] = !res[i];
+    }
+}
 
 
 
-void TableExprNodeEQDouble::ranges (Block<TableExprRange>& blrange)
+//# Helper functions to determine the range of a scalar column compared
+//# with a constant. If that is not the case, an empty block is returned.
+//# The range can be a superset of the values selected (e.g. for >).
+static Bool isScalarColumn (const TableExprNodeRep* node)
+{
+    return (node->operType()  == TableExprNodeRep::OtColumn
+        &&  node->valueType() == TableExprNodeRep::VTScalar);
+}
+
+//# Range for col==const.
+static void rangeEQ (Block<TableExprRange>& blrange,
+                     TableExprNodeRep* lnode, TableExprNodeRep* rnode)
 {
     Double dval = 0;
     TableExprNodeRep* tsncol = 0;
-    //# We can store a range if there is a scalar column and constant
-    //# (left or right).
-    if (lnode_p->operType()  == TableExprNodeRep::OtColumn
-    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-    &&  rnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-	tsncol = lnode_p;
-	dval = rnode_p->getDouble (0);
-    }else{
-	if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-	&&  rnode_p->valueType() == TableExprNodeRep::VTScalar
-        &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-	    tsncol = rnode_p;
-	    dval = lnode_p->getDouble (0);
-	}
+    if (isScalarColumn(lnode)
+    &&  rnode->operType() == TableExprNodeRep::OtLiteral) {
+        tsncol = lnode;
+        dval = rnode->getDouble (0);
+    } else if (isScalarColumn(rnode)
+           &&  lnode->operType() == TableExprNodeRep::OtLiteral) {
+        tsncol = rnode;
+        dval = lnode->getDouble (0);
     }
-    //# Now create a range (if possible).
     //# The cast is harmless, since it is surely that object type.
     TableExprNodeRep::createRange (blrange,
-				   dynamic_cast<TableExprNodeColumn*>(tsncol),
-				   dval, dval);
+                                   dynamic_cast<TableExprNodeColumn*>(tsncol),
+                                   dval, dval);
 }
 
-void TableExprNodeGEDouble::ranges (Block<TableExprRange>& blrange)
+//# Range for col>=const or const>=col (also used for >).
+static void rangeGE (Block<TableExprRange>& blrange,
+                     TableExprNodeRep* lnode, TableExprNodeRep* rnode)
 {
     Double st = 0;
     Double end = 0;
     TableExprNodeRep* tsncol = 0;
-    //# We can store a range if there is a scalar column and constant
-    //# (left or right).
-    if (lnode_p->operType()  == TableExprNodeRep::OtColumn
-    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-    &&  rnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-	tsncol = lnode_p;
-	st = rnode_p->getDouble (0);
-	end = DBL_MAX;
-    }else{
-	if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-	&&  rnode_p->valueType() == TableExprNodeRep::VTScalar
-        &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-	    tsncol = rnode_p;
-	    end = lnode_p->getDouble (0);
-	    st = -DBL_MAX;
-	}
+    if (isScalarColumn(lnode)
+    &&  rnode->operType() == TableExprNodeRep::OtLiteral) {
+        tsncol = lnode;
+        st = rnode->getDouble (0);
+        end = DBL_MAX;
+    } else if (isScalarColumn(rnode)
+           &&  lnode->operType() == TableExprNodeRep::OtLiteral) {
+        tsncol = rnode;
+        end = lnode->getDouble (0);
+        st = -DBL_MAX;
     }
-    //# Now create a range (if possible).
-    //# The cast is harmless, since it is surely that object type.
     TableExprNodeRep::createRange (blrange,
-				   dynamic_cast<TableExprNodeColumn*>(tsncol),
-				   st, end);
+                                   dynamic_cast<TableExprNodeColumn*>(tsncol),
+                                   st, end);
 }
 
-void TableExprNodeGTDouble::ranges (Block<TableExprRange>& blrange)
+//# Range for col IN constant set or array (the hull of its values).
+static void rangeIN (Block<TableExprRange>& blrange,
+                     TableExprNodeRep* lnode, TableExprNodeRep* rnode)
 {
-    Double st = 0;
-    Double end = 0;
+    Double st = DBL_MAX;
+    Double end = -DBL_MAX;
     TableExprNodeRep* tsncol = 0;
-    //# We can store a range if there is a scalar column and constant
-    //# (left or right).
-    if (lnode_p->operType()  == TableExprNodeRep::OtColumn
-    &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-    &&  rnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-	tsncol = lnode_p;
-	st = rnode_p->getDouble (0);
-	end = DBL_MAX;
-    }else{
-	if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-        &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
-        &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
-	    tsncol = rnode_p;
-	    end = lnode_p->getDouble (0);
-	    st = -DBL_MAX;
-	}
+    if (isScalarColumn(lnode)  &&  rnode->isConstant()) {
+        const TableExprNodeSet* set = dynamic_cast<TableExprNodeSet*>(rnode);
+        if (set) {
+            if (! set->hasArrays()) {
+                tsncol = lnode;
+                for (uInt i=0; i<set->nelements(); ++i) {
+                    const TableExprNodeSetElem& elem = (*set)[i];
+                    Double sv = (elem.start() ?
+                                 elem.start()->getDouble(0) : -DBL_MAX);
+                    Double ev = sv;
+                    if (! elem.isSingle()) {
+                        ev = (elem.end() ? elem.end()->getDouble(0) : DBL_MAX);
+                    }
+                    st  = std::min (st, sv);
+                    end = std::max (end, ev);
+                }
+            }
+        } else if (rnode->valueType() == TableExprNodeRep::VTArray) {
+            Array<Double> arr = rnode->getArrayDouble (0);
+            if (! arr.empty()) {
+                tsncol = lnode;
+                minMax (st, end, arr);
+            }
+        }
     }
-    //# Now create a range (if possible).
-    //# The cast is harmless, since it is surely that object type.
     TableExprNodeRep::createRange (blrange,
-				   dynamic_cast<TableExprNodeColumn*>(tsncol),
-				   st, end);
+                                   dynamic_cast<TableExprNodeColumn*>(tsncol),
+                                   st, end);
+}
+
+void TableExprNodeEQInt::ranges (Block<TableExprRange>& blrange)
+{
+    rangeEQ (blrange, lnode_p, rnode_p);
+}
+
+void TableExprNodeEQDouble::ranges (Block<TableExprRange>& blrange)
+{
+    rangeEQ (blrange, lnode_p, rnode_p);
+}
+
+void TableExprNodeGEInt::ranges (Block<TableExprRange>& blrange)
+{
+    rangeGE (blrange, lnode_p, rnode_p);
+}
+
+void TableExprNodeGEDouble::ranges (Block<TableExprRange>& blrange)
+{
+    rangeGE (blrange, lnode_p, rnode_p);
+}
+
+void TableExprNodeGTInt::ranges (Block<TableExprRange>& blrange)
+{
+    rangeGE (blrange, lnode_p, rnode_p);
+}
+
+void TableExprNodeGTDouble::ranges (Block<TableExprRange>& blrange)
+{
+    rangeGE (blrange, lnode_p, rnode_p);
+}
+
+void TableExprNodeINInt::ranges (Block<TableExprRange>& blrange)
+{
+    rangeIN (blrange, lnode_p, rnode_p);
+}
+
+void TableExprNodeINDouble::ranges (Block<TableExprRange>& blrange)
+{
+    rangeIN (blrange, lnode_p, rnode_p);
 }
 
 
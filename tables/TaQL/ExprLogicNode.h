@@ -103,6 +103,8 @@ public:
     TableExprNodeEQInt (const TableExprNodeRep&);
     ~TableExprNodeEQInt();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
+    void ranges (Block<TableExprRange>&);
 };
 
 
@@ -133,6 +135,7 @@ public:
     TableExprNodeEQDouble (const TableExprNodeRep&);
     ~TableExprNodeEQDouble();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
     void ranges (Block<TableExprRange>&);
 };
 
@@ -315,6 +318,7 @@ public:
     TableExprNodeNEInt (const TableExprNodeRep&);
     ~TableExprNodeNEInt();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
 };
 
 
@@ -345,6 +349,7 @@ public:
     TableExprNodeNEDouble (const TableExprNodeRep&);
     ~TableExprNodeNEDouble();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
 };
 
 
@@ -496,6 +501,8 @@ public:
     TableExprNodeGTInt (const TableExprNodeRep&);
     ~TableExprNodeGTInt();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
+    void ranges (Block<TableExprRange>&);
 };
 
 
@@ -526,6 +533,7 @@ public:
     TableExprNodeGTDouble (const TableExprNodeRep&);
     ~TableExprNodeGTDouble();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
     void ranges (Block<TableExprRange>&);
 };
 
@@ -648,6 +656,8 @@ public:
     TableExprNodeGEInt (const TableExprNodeRep&);
     ~TableExprNodeGEInt();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
+    void ranges (Block<TableExprRange>&);
 };
 
 
@@ -678,6 +688,7 @@ public:
     TableExprNodeGEDouble (const TableExprNodeRep&);
     ~TableExprNodeGEDouble();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
     void ranges (Block<TableExprRange>&);
 };
 
@@ -801,6 +812,7 @@ public:
     virtual ~TableExprNodeINInt();
     virtual void convertConstChild();
     virtual Bool getBool (const TableExprId& id);
+    virtual void ranges (Block<TableExprRange>&);
 private:
     Bool        itsDoTracing;
     //# If the right node is constant and its range is sufficiently small,
@@ -838,6 +850,7 @@ public:
     TableExprNodeINDouble (const TableExprNodeRep&);
     ~TableExprNodeINDouble();
     Bool getBool (const TableExprId& id);
+    void ranges (Block<TableExprRange>&);
 };
 
 
@@ -957,6 +970,7 @@ public:
     TableExprNodeOR (const TableExprNodeRep&);
     ~TableExprNodeOR();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
     void ranges (Block<TableExprRange>&);
 };
 
@@ -986,6 +1000,7 @@ public:
     TableExprNodeAND (const TableExprNodeRep&);
     ~TableExprNodeAND();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
     void ranges (Block<TableExprRange>&);
 };
 
@@ -1015,6 +1030,7 @@ public:
     TableExprNodeNOT (const TableExprNodeRep&);
     ~TableExprNodeNOT();
     Bool getBool (const TableExprId& id);
+    void getBoolVector (const Vector<rownr_t>& rownrs, Vector<Bool>& values);
 };
 
 
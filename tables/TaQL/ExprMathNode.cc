@@ -53,6 +53,19 @@ Double TableExprNodePlusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) + rnode_p->getInt(id); }
 DComplex TableExprNodePlusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) + rnode_p->getInt(id)); }
+void TableExprNodePlusInt::getIntVector (const Vector<rownr_t>& rownrs,
+                                         Vector<Int64>& values)
+{
+    Vector<Int64> right;
+    lnode_p->getIntVector (rownrs, values);
+    rnode_p->getIntVector (rownrs, right);
+    Int64* res = values.data();
+    const Int64* rval = right.data();
+    size_t n = values.size();
+    for (size_t i=0; i<n; ++i) {
+        res[i] += rval[i];
+    }
+}
 
 TableExprNodePlusDouble::TableExprNodePlusDouble (const TableExprNodeRep& node)
 : TableExprNodePlus (NTDouble, node)
@@ -63,6 +76,19 @@ Double TableExprNodePlusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
 DComplex TableExprNodePlusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
+void TableExprNodePlusDouble::getDoubleVector (const Vector<rownr_t>& rownrs,
+                                               Vector<Double>& values)
+{
+    Vector<Double> right;
+    lnode_p->getDoubleVector (rownrs, values);
+    rnode_p->getDoubleVector (rownrs, right);
+    Double* res = values.data();
+    const Double* rval = right.data();
+    size_t n = values.size();
+    for (size_t i=0; i<n; ++i) {
+        res[i] += rval[i];
+    }
+}
 
 TableExprNodePlusDComplex::TableExprNodePlusDComplex (const TableExprNodeRep& node)
 : TableExprNodePlus (NTComplex, node)
@@ -125,6 +151,19 @@ Double TableExprNodeMinusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) - rnode_p->getInt(id); }
 DComplex TableExprNodeMinusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) - rnode_p->getInt(id)); }
+void TableExprNodeMinusInt::getIntVector (const Vector<rownr_t>& rownrs,
+                                          Vector<Int64>& values)
+{
+    Vector<Int64> right;
+    lnode_p->getIntVector (rownrs, values);
+    rnode_p->getIntVector (rownrs, right);
+    Int64* res = values.data();
+    const Int64* rval = right.data();
+    size_t n = values.size();
+    for (size_t i=0; i<n; ++i) {
+        res[i] -= rval[i];
+    }
+}
 
 TableExprNodeMinusDouble::TableExprNodeMinusDouble (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTDouble, node)
@@ -143,6 +182,19 @@ Double TableExprNodeMinusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
 DComplex TableExprNodeMinusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
+void TableExprNodeMinusDouble::getDoubleVector (const Vector<rownr_t>& rownrs,
+                                                Vector<Double>& values)
+{
+    Vector<Double> right;
+    lnode_p->getDoubleVector (rownrs, values);
+    rnode_p->getDoubleVector (rownrs, right);
+    Double* res = values.data();
+    const Double* rval = right.data();
+    size_t n = values.size();
+    for (size_t i=0; i<n; ++i) {
+        res[i] -= rval[i];
+    }
+}
 
 TableExprNodeMinusDComplex::TableExprNodeMinusDComplex (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTComplex, node)
@@ -198,6 +250,19 @@ Double TableExprNodeTimesInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) * rnode_p->getInt(id); }
 DComplex TableExprNodeTimesInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) * rnode_p->getInt(id)); }
+void TableExprNodeTimesInt::getIntVector (const Vector<rownr_t>& rownrs,
+                                          Vector<Int64>& values)
+{
+    Vector<Int64> right;
+    lnode_p->getIntVector (rownrs, values);
+    rnode_p->getIntVector (rownrs, right);
+    Int64* res = values.data();
+    const Int64* rval = right.data();
+    size_t n = values.size();
+    for (size_t i=0; i<n; ++i) {
+        res[i] *= rval[i];
+    }
+}
 
 TableExprNodeTimesDouble::TableExprNodeTimesDouble (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTDouble, node)
@@ -208,6 +273,19 @@ Double TableExprNodeTimesDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
 DComplex TableExprNodeTimesDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
+void TableExprNodeTimesDouble::getDoubleVector (const Vector<rownr_t>& rownrs,
+                                                Vector<Double>& values)
+{
+    Vector<Double> right;
+    lnode_p->getDoubleVector (rownrs, values);
+    rnode_p->getDoubleVector (rownrs, right);
+    Double* res = values.data();
+    const Double* rval = right.data();
+    size_t n = values.size();
+    for (size_t i=0; i<n; ++i) {
+        res[i] *= rval[i];
+    }
+}
 
 TableExprNodeTimesDComplex::TableExprNodeTimesDComplex (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTComplex, node)
@@ -255,6 +333,19 @@ Double TableExprNodeDivideDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
 DComplex TableExprNodeDivideDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
+void TableExprNodeDivideDouble::getDoubleVector (const Vector<rownr_t>& rownrs,
+                                                 Vector<Double>& values)
+{
+    Vector<Double> right;
+    lnode_p->getDoubleVector (rownrs, values);
+    rnode_p->getDoubleVector (rownrs, right);
+    Double* res = values.data();
+    const Double* rval = right.data();
+    size_t n = values.size();
+    for (size_t i=0; i<n; ++i) {
+        res[i] /= rval[i];
+    }
+}
 
 TableExprNodeDivideDComplex::TableExprNodeDivideDComplex (const TableExprNodeRep& node)
 : TableExprNodeDivide (NTComplex, node)
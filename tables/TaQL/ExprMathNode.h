@@ -103,6 +103,7 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntVector (const Vector<rownr_t>& rownrs, Vector<Int64>& values);
 };
 
 
@@ -135,6 +136,8 @@ public:
     ~TableExprNodePlusDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleVector (const Vector<rownr_t>& rownrs,
+                          Vector<Double>& values);
 };
 
 
@@ -291,6 +294,7 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntVector (const Vector<rownr_t>& rownrs, Vector<Int64>& values);
 };
 
 
@@ -323,6 +327,8 @@ public:
     virtual void handleUnits();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleVector (const Vector<rownr_t>& rownrs,
+                          Vector<Double>& values);
 };
 
 
@@ -446,6 +452,7 @@ public:
     Int64    getInt      (const TableExprId& id);
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getIntVector (const Vector<rownr_t>& rownrs, Vector<Int64>& values);
 };
 
 
@@ -477,6 +484,8 @@ public:
     ~TableExprNodeTimesDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleVector (const Vector<rownr_t>& rownrs,
+                          Vector<Double>& values);
 };
 
 
@@ -567,6 +576,8 @@ public:
     ~TableExprNodeDivideDouble();
     Double   getDouble   (const TableExprId& id);
     DComplex getDComplex (const TableExprId& id);
+    void getDoubleVector (const Vector<rownr_t>& rownrs,
+                          Vector<Double>& values);
 };
 
 
@@ -35,6 +35,7 @@
 #include <casacore/tables/TaQL/ExprFuncNode.h>
 #include <casacore/tables/TaQL/ExprConeNode.h>
 #include <casacore/tables/TaQL/TaQLStyle.h>
+#include <casacore/tables/Tables/RowNumbers.h>
 #include <casacore/casa/Utilities/DataType.h>
 #include <casacore/casa/BasicSL/Complex.h>
 
@@ -890,7 +891,7 @@ public:
 
     // Re-create the column object for a selection of rows.
     // Nothing is done if the node does not represent a column object.
-    void applySelection (const Vector<uInt>& rownrs)
+    void applySelection (const Vector<rownr_t>& rownrs)
       { node_p->applySelection (rownrs); }
 
     // Get the unit of the expression.
@@ -910,7 +911,7 @@ public:
     // Get the number of rows in the table associated with this expression.
     // One is returned if the expression is a constant.
     // Zero is returned if no table is associated with it.
-    uInt nrow() const
+    rownr_t nrow() const
       { return node_p->nrow(); }
 
     // Is the result value defined?
@@ -956,6 +957,19 @@ public:
     Array<String>   getStringAS   (const TableExprId& id) const;
     // </group>
 
+    // Get the values of a scalar expression for a block of rows at once.
+    // This is much faster than getting the values row by row, because
+    // column values are read in bulk and the operators are applied to
+    // entire vectors.
+    // <group>
+    void getBoolVector   (const RowNumbers& rownrs,
+                          Vector<Bool>& values) const;
+    void getIntVector    (const RowNumbers& rownrs,
+                          Vector<Int64>& values) const;
+    void getDoubleVector (const RowNumbers& rownrs,
+                          Vector<Double>& values) const;
+    // </group>
+
     // </group>
 
     // Get the data type for doing a getColumn on the expression.
@@ -969,17 +983,17 @@ public:
     // The data of function called should match the data type as
     // returned by function <src>getColumnDataType</src>.
     // <group>
-    Array<Bool>     getColumnBool (const Vector<uInt>& rownrs) const;
-    Array<uChar>    getColumnuChar (const Vector<uInt>& rownrs) const;
-    Array<Short>    getColumnShort (const Vector<uInt>& rownrs) const;
-    Array<uShort>   getColumnuShort (const Vector<uInt>& rownrs) const;
-    Array<Int>      getColumnInt (const Vector<uInt>& rownrs) const;
-    Array<uInt>     getColumnuInt (const Vector<uInt>& rownrs) const;
-    Array<Float>    getColumnFloat (const Vector<uInt>& rownrs) const;
-    Array<Double>   getColumnDouble (const Vector<uInt>& rownrs) const;
-    Array<Complex>  getColumnComplex (const Vector<uInt>& rownrs) const;
-    Array<DComplex> getColumnDComplex (const Vector<uInt>& rownrs) const;
-    Array<String>   getColumnString (const Vector<uInt>& rownrs) const;
+    Array<Bool>     getColumnBool (const RowNumbers& rownrs) const;
+    Array<uChar>    getColumnuChar (const RowNumbers& rownrs) const;
+    Array<Short>    getColumnShort (const RowNumbers& rownrs) const;
+    Array<uShort>   getColumnuShort (const RowNumbers& rownrs) const;
+    Array<Int>      getColumnInt (const RowNumbers& rownrs) const;
+    Array<uInt>     getColumnuInt (const RowNumbers& rownrs) const;
+    Array<Float>    getColumnFloat (const RowNumbers& rownrs) const;
+    Array<Double>   getColumnDouble (const RowNumbers& rownrs) const;
+    Array<Complex>  getColumnComplex (const RowNumbers& rownrs) const;
+    Array<DComplex> getColumnDComplex (const RowNumbers& rownrs) const;
+    Array<String>   getColumnString (const RowNumbers& rownrs) const;
     // </group>
 
     // Show the tree.
@@ -1164,6 +1178,15 @@ inline void TableExprNode::get (const TableExprId& id,
 inline void TableExprNode::get (const TableExprId& id,
 				Array<MVTime>& value) const
     { value = node_p->getArrayDate (id); }
+inline void TableExprNode::getBoolVector (const RowNumbers& rownrs,
+                                          Vector<Bool>& values) const
+    { node_p->getBoolVector (rownrs, values); }
+inline void TableExprNode::getIntVector (const RowNumbers& rownrs,
+                                         Vector<Int64>& values) const
+    { node_p->getIntVector (rownrs, values); }
+inline void TableExprNode::getDoubleVector (const RowNumbers& rownrs,
+                                            Vector<Double>& values) const
+    { node_p->getDoubleVector (rownrs, values); }
 inline Bool TableExprNode::getBool (const TableExprId& id) const
     { return node_p->getBool (id); }
 inline Int64 TableExprNode::getInt (const TableExprId& id) const
@@ -1195,27 +1218,27 @@ inline Array<DComplex> TableExprNode::getDComplexAS (const TableExprId& id) cons
 inline Array<String> TableExprNode::getStringAS (const TableExprId& id) const
     { return node_p->getStringAS (id); }
 
-inline Array<Bool>      TableExprNode::getColumnBool (const Vector<uInt>& rownrs) const
+inline Array<Bool>      TableExprNode::getColumnBool (const RowNumbers& rownrs) const
     { return node_p->getColumnBool (rownrs); }
-inline Array<uChar>     TableExprNode::getColumnuChar (const Vector<uInt>& rownrs) const
+inline Array<uChar>     TableExprNode::getColumnuChar (const RowNumbers& rownrs) const
     { return node_p->getColumnuChar (rownrs); }
-inline Array<Short>     TableExprNode::getColumnShort (const Vector<uInt>& rownrs) const
+inline Array<Short>     TableExprNode::getColumnShort (const RowNumbers& rownrs) const
     { return node_p->getColumnShort (rownrs); }
-inline Array<uShort>    TableExprNode::getColumnuShort (const Vector<uInt>& rownrs) const
+inline Array<uShort>    TableExprNode::getColumnuShort (const RowNumbers& rownrs) const
     { return node_p->getColumnuShort (rownrs); }
-inline Array<Int>       TableExprNode::getColumnInt (const Vector<uInt>& rownrs) const
+inline Array<Int>       TableExprNode::getColumnInt (const RowNumbers& rownrs) const
     { return node_p->getColumnInt (rownrs); }
-inline Array<uInt>      TableExprNode::getColumnuInt (const Vector<uInt>& rownrs) const
+inline Array<uInt>      TableExprNode::getColumnuInt (const RowNumbers& rownrs) const
     { return node_p->getColumnuInt (rownrs); }
-inline Array<Float>     TableExprNode::getColumnFloat (const Vector<uInt>& rownrs) const
+inline Array<Float>     TableExprNode::getColumnFloat (const RowNumbers& rownrs) const
     { return node_p->getColumnFloat (rownrs); }
-inline Array<Double>    TableExprNode::getColumnDouble (const Vector<uInt>& rownrs) const
+inline Array<Double>    TableExprNode::getColumnDouble (const RowNumbers& rownrs) const
     { return node_p->getColumnDouble (rownrs); }
-inline Array<Complex>   TableExprNode::getColumnComplex (const Vector<uInt>& rownrs) const
+inline Array<Complex>   TableExprNode::getColumnComplex (const RowNumbers& rownrs) const
     { return node_p->getColumnComplex (rownrs); }
-inline Array<DComplex>  TableExprNode::getColumnDComplex (const Vector<uInt>& rownrs) const
+inline Array<DComplex>  TableExprNode::getColumnDComplex (const RowNumbers& rownrs) const
     { return node_p->getColumnDComplex (rownrs); }
-inline Array<String>    TableExprNode::getColumnString (const Vector<uInt>& rownrs) const
+inline Array<String>    TableExprNode::getColumnString (const RowNumbers& rownrs) const
     { return node_p->getColumnString (rownrs); }
 
 
@@ -62,6 +62,11 @@ TableExprNodeArray::TableExprNodeArray (NodeDataType dtype, OperType otype,
 TableExprNodeArray::~TableExprNodeArray()
 {}
 
+Bool TableExprNodeArray::isThreadSafe() const
+{
+  return False;
+}
+
 TableExprNodeRep* TableExprNodeArray::makeConstantScalar()
 {
   if (isConstant()) {
@@ -382,77 +387,77 @@ Array<MVTime> TableExprNodeArray::getSliceDate (const TableExprId& id,
     return arr(start, end, incr);
 }
 
-Array<Bool>     TableExprNodeArray::getElemColumnBool (const Vector<uInt>&,
+Array<Bool>     TableExprNodeArray::getElemColumnBool (const Vector<rownr_t>&,
                                                        const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnBool(Slicer) not implemented)");
     return Array<Bool>();
 }
-Array<uChar>    TableExprNodeArray::getElemColumnuChar (const Vector<uInt>&,
+Array<uChar>    TableExprNodeArray::getElemColumnuChar (const Vector<rownr_t>&,
                                                         const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnuChar(Slicer) not implemented)");
     return Array<uChar>();
 }
-Array<Short>    TableExprNodeArray::getElemColumnShort (const Vector<uInt>&,
+Array<Short>    TableExprNodeArray::getElemColumnShort (const Vector<rownr_t>&,
                                                         const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnShort(Slicer) not implemented)");
     return Array<Short>();
 }
-Array<uShort>   TableExprNodeArray::getElemColumnuShort (const Vector<uInt>&,
+Array<uShort>   TableExprNodeArray::getElemColumnuShort (const Vector<rownr_t>&,
                                                          const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnuShort(Slicer) not implemented)");
     return Array<uShort>();
 }
-Array<Int>      TableExprNodeArray::getElemColumnInt (const Vector<uInt>&,
+Array<Int>      TableExprNodeArray::getElemColumnInt (const Vector<rownr_t>&,
                                                       const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnInt(Slicer) not implemented)");
     return Array<Int>();
 }
-Array<uInt>     TableExprNodeArray::getElemColumnuInt (const Vector<uInt>&,
+Array<uInt>     TableExprNodeArray::getElemColumnuInt (const Vector<rownr_t>&,
                                                        const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnuInt(Slicer) not implemented)");
     return Array<uInt>();
 }
-Array<Float>    TableExprNodeArray::getElemColumnFloat (const Vector<uInt>&,
+Array<Float>    TableExprNodeArray::getElemColumnFloat (const Vector<rownr_t>&,
                                                         const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnFloat(Slicer) not implemented)");
     return Array<Float>();
 }
-Array<Double>   TableExprNodeArray::getElemColumnDouble (const Vector<uInt>&,
+Array<Double>   TableExprNodeArray::getElemColumnDouble (const Vector<rownr_t>&,
                                                          const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnDouble(Slicer) not implemented)");
     return Array<Double>();
 }
-Array<Complex>  TableExprNodeArray::getElemColumnComplex (const Vector<uInt>&,
+Array<Complex>  TableExprNodeArray::getElemColumnComplex (const Vector<rownr_t>&,
                                                           const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnComplex(Slicer) not implemented)");
     return Array<Complex>();
 }
-Array<DComplex> TableExprNodeArray::getElemColumnDComplex (const Vector<uInt>&,
+Array<DComplex> TableExprNodeArray::getElemColumnDComplex (const Vector<rownr_t>&,
                                                            const Slicer&)
 {
     TableExprNode::throwInvDT
                        ("(getElemColumnDComplex(Slicer) not implemented)");
     return Array<DComplex>();
 }
-Array<String>   TableExprNodeArray::getElemColumnString (const Vector<uInt>&,
+Array<String>   TableExprNodeArray::getElemColumnString (const Vector<rownr_t>&,
                                                          const Slicer&)
 {
     TableExprNode::throwInvDT
@@ -548,7 +553,7 @@ void TableExprNodeArrayColumn::disableApplySelection()
     applySelection_p = False;
 }
   
-void TableExprNodeArrayColumn::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumn::applySelection (const Vector<rownr_t>& rownrs)
 {
     if (applySelection_p) {
         // Attach the column to the selection of the table.
@@ -590,7 +595,7 @@ TableExprNodeArrayColumnBool::TableExprNodeArrayColumnBool
 TableExprNodeArrayColumnBool::~TableExprNodeArrayColumnBool()
 {}
 
-void TableExprNodeArrayColumnBool::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnBool::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<Bool>(tabCol_p);
@@ -612,7 +617,7 @@ Array<Bool> TableExprNodeArrayColumnBool::getSliceBool (const TableExprId& id,
     return col_p.getSlice (id.rownr(), index);
 }
 Array<Bool> TableExprNodeArrayColumnBool::getElemColumnBool
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -626,7 +631,7 @@ TableExprNodeArrayColumnuChar::TableExprNodeArrayColumnuChar
 TableExprNodeArrayColumnuChar::~TableExprNodeArrayColumnuChar()
 {}
 
-void TableExprNodeArrayColumnuChar::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnuChar::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<uChar>(tabCol_p);
@@ -656,7 +661,7 @@ Array<Int64> TableExprNodeArrayColumnuChar::getSliceInt
     return out;
 }
 Array<uChar> TableExprNodeArrayColumnuChar::getElemColumnuChar
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -670,7 +675,7 @@ TableExprNodeArrayColumnShort::TableExprNodeArrayColumnShort
 TableExprNodeArrayColumnShort::~TableExprNodeArrayColumnShort()
 {}
 
-void TableExprNodeArrayColumnShort::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnShort::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<Short>(tabCol_p);
@@ -700,7 +705,7 @@ Array<Int64> TableExprNodeArrayColumnShort::getSliceInt
     return out;
 }
 Array<Short> TableExprNodeArrayColumnShort::getElemColumnShort
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -714,7 +719,7 @@ TableExprNodeArrayColumnuShort::TableExprNodeArrayColumnuShort
 TableExprNodeArrayColumnuShort::~TableExprNodeArrayColumnuShort()
 {}
 
-void TableExprNodeArrayColumnuShort::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnuShort::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<uShort>(tabCol_p);
@@ -744,7 +749,7 @@ Array<Int64> TableExprNodeArrayColumnuShort::getSliceInt
     return out;
 }
 Array<uShort> TableExprNodeArrayColumnuShort::getElemColumnuShort
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -758,7 +763,7 @@ TableExprNodeArrayColumnInt::TableExprNodeArrayColumnInt
 TableExprNodeArrayColumnInt::~TableExprNodeArrayColumnInt()
 {}
 
-void TableExprNodeArrayColumnInt::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnInt::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<Int>(tabCol_p);
@@ -788,7 +793,7 @@ Array<Int64> TableExprNodeArrayColumnInt::getSliceInt
     return out;
 }
 Array<Int> TableExprNodeArrayColumnInt::getElemColumnInt
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -802,7 +807,7 @@ TableExprNodeArrayColumnuInt::TableExprNodeArrayColumnuInt
 TableExprNodeArrayColumnuInt::~TableExprNodeArrayColumnuInt()
 {}
 
-void TableExprNodeArrayColumnuInt::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnuInt::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<uInt>(tabCol_p);
@@ -832,7 +837,7 @@ Array<Int64> TableExprNodeArrayColumnuInt::getSliceInt
     return out;
 }
 Array<uInt> TableExprNodeArrayColumnuInt::getElemColumnuInt
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -846,7 +851,7 @@ TableExprNodeArrayColumnFloat::TableExprNodeArrayColumnFloat
 TableExprNodeArrayColumnFloat::~TableExprNodeArrayColumnFloat()
 {}
 
-void TableExprNodeArrayColumnFloat::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnFloat::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<Float>(tabCol_p);
@@ -876,7 +881,7 @@ Array<Double> TableExprNodeArrayColumnFloat::getSliceDouble
     return out;
 }
 Array<Float> TableExprNodeArrayColumnFloat::getElemColumnFloat
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -890,7 +895,7 @@ TableExprNodeArrayColumnDouble::TableExprNodeArrayColumnDouble
 TableExprNodeArrayColumnDouble::~TableExprNodeArrayColumnDouble()
 {}
 
-void TableExprNodeArrayColumnDouble::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnDouble::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<Double>(tabCol_p);
@@ -914,7 +919,7 @@ Array<Double> TableExprNodeArrayColumnDouble::getSliceDouble
     return col_p.getSlice (id.rownr(), index);
 }
 Array<Double> TableExprNodeArrayColumnDouble::getElemColumnDouble
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -928,7 +933,7 @@ TableExprNodeArrayColumnComplex::TableExprNodeArrayColumnComplex
 TableExprNodeArrayColumnComplex::~TableExprNodeArrayColumnComplex()
 {}
 
-void TableExprNodeArrayColumnComplex::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnComplex::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<Complex>(tabCol_p);
@@ -959,7 +964,7 @@ Array<DComplex> TableExprNodeArrayColumnComplex::getSliceDComplex
     return out;
 }
 Array<Complex> TableExprNodeArrayColumnComplex::getElemColumnComplex
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -973,7 +978,7 @@ TableExprNodeArrayColumnDComplex::TableExprNodeArrayColumnDComplex
 TableExprNodeArrayColumnDComplex::~TableExprNodeArrayColumnDComplex()
 {}
 
-void TableExprNodeArrayColumnDComplex::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnDComplex::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<DComplex>(tabCol_p);
@@ -998,7 +1003,7 @@ Array<DComplex> TableExprNodeArrayColumnDComplex::getSliceDComplex
     return col_p.getSlice (id.rownr(), index);
 }
 Array<DComplex> TableExprNodeArrayColumnDComplex::getElemColumnDComplex
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -1012,7 +1017,7 @@ TableExprNodeArrayColumnString::TableExprNodeArrayColumnString
 TableExprNodeArrayColumnString::~TableExprNodeArrayColumnString()
 {}
 
-void TableExprNodeArrayColumnString::applySelection (const Vector<uInt>& rownrs)
+void TableExprNodeArrayColumnString::applySelection (const Vector<rownr_t>& rownrs)
 {
     TableExprNodeArrayColumn::applySelection (rownrs);
     col_p = ArrayColumn<String>(tabCol_p);
@@ -1036,7 +1041,7 @@ Array<String> TableExprNodeArrayColumnString::getSliceString
     return col_p.getSlice (id.rownr(), index);
 }
 Array<String> TableExprNodeArrayColumnString::getElemColumnString
-(const Vector<uInt>& rownrs, const Slicer& index)
+(const Vector<rownr_t>& rownrs, const Slicer& index)
 {
     return col_p.getColumnCells (rownrs, index);
 }
@@ -1387,77 +1392,77 @@ Array<MVTime> TableExprNodeArrayPart::getArrayDate (const TableExprId& id)
     return arrNode_p->getSliceDate (id, indexNode_p->getSlicer(id));
 }
 
-Array<Bool> TableExprNodeArrayPart::getColumnBool (const Vector<uInt>& rownrs)
+Array<Bool> TableExprNodeArrayPart::getColumnBool (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnBool (rownrs);
     }
     return colNode_p->getElemColumnBool (rownrs, indexNode_p->getSlicer(0));
 }
-Array<uChar>    TableExprNodeArrayPart::getColumnuChar (const Vector<uInt>& rownrs)
+Array<uChar>    TableExprNodeArrayPart::getColumnuChar (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnuChar (rownrs);
     }
     return colNode_p->getElemColumnuChar (rownrs, indexNode_p->getSlicer(0));
 }
-Array<Short>    TableExprNodeArrayPart::getColumnShort (const Vector<uInt>& rownrs)
+Array<Short>    TableExprNodeArrayPart::getColumnShort (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnShort (rownrs);
     }
     return colNode_p->getElemColumnShort (rownrs, indexNode_p->getSlicer(0));
 }
-Array<uShort>   TableExprNodeArrayPart::getColumnuShort (const Vector<uInt>& rownrs)
+Array<uShort>   TableExprNodeArrayPart::getColumnuShort (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnuShort (rownrs);
     }
     return colNode_p->getElemColumnuShort (rownrs, indexNode_p->getSlicer(0));
 }
-Array<Int>      TableExprNodeArrayPart::getColumnInt (const Vector<uInt>& rownrs)
+Array<Int>      TableExprNodeArrayPart::getColumnInt (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnInt (rownrs);
     }
     return colNode_p->getElemColumnInt (rownrs, indexNode_p->getSlicer(0));
 }
-Array<uInt>     TableExprNodeArrayPart::getColumnuInt (const Vector<uInt>& rownrs)
+Array<uInt>     TableExprNodeArrayPart::getColumnuInt (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnuInt (rownrs);
     }
     return colNode_p->getElemColumnuInt (rownrs, indexNode_p->getSlicer(0));
 }
-Array<Float>    TableExprNodeArrayPart::getColumnFloat (const Vector<uInt>& rownrs)
+Array<Float>    TableExprNodeArrayPart::getColumnFloat (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnFloat (rownrs);
     }
     return colNode_p->getElemColumnFloat (rownrs, indexNode_p->getSlicer(0));
 }
-Array<Double>   TableExprNodeArrayPart::getColumnDouble (const Vector<uInt>& rownrs)
+Array<Double>   TableExprNodeArrayPart::getColumnDouble (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnDouble (rownrs);
     }
     return colNode_p->getElemColumnDouble (rownrs, indexNode_p->getSlicer(0));
 }
-Array<Complex>  TableExprNodeArrayPart::getColumnComplex (const Vector<uInt>& rownrs)
+Array<Complex>  TableExprNodeArrayPart::getColumnComplex (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnComplex (rownrs);
     }
     return colNode_p->getElemColumnComplex (rownrs, indexNode_p->getSlicer(0));
 }
-Array<DComplex> TableExprNodeArrayPart::getColumnDComplex (const Vector<uInt>& rownrs)
+Array<DComplex> TableExprNodeArrayPart::getColumnDComplex (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnDComplex (rownrs);
     }
     return colNode_p->getElemColumnDComplex (rownrs, indexNode_p->getSlicer(0));
 }
-Array<String>   TableExprNodeArrayPart::getColumnString (const Vector<uInt>& rownrs)
+Array<String>   TableExprNodeArrayPart::getColumnString (const Vector<rownr_t>& rownrs)
 {
     if (colNode_p == 0) {
 	return TableExprNodeRep::getColumnString (rownrs);
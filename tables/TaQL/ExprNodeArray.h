@@ -80,6 +80,10 @@ public:
     // The default implementation returns 0.
     virtual TableExprNodeRep* makeConstantScalar();
 
+    // Array expressions are not evaluated in parallel (yet), because
+    // the array columns do not serialize their access.
+    virtual Bool isThreadSafe() const;
+
     // Get the shape of the array in the given row.
     // This default implementation evaluates the value and returns its shape.
     virtual const IPosition& getShape (const TableExprId& id);
@@ -148,27 +152,27 @@ public:
 
     // Get a single element for the entire column (used by sort).
     // <group>
-    virtual Array<Bool>     getElemColumnBool     (const Vector<uInt>& rownrs,
+    virtual Array<Bool>     getElemColumnBool     (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<uChar>    getElemColumnuChar    (const Vector<uInt>& rownrs,
+    virtual Array<uChar>    getElemColumnuChar    (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<Short>    getElemColumnShort    (const Vector<uInt>& rownrs,
+    virtual Array<Short>    getElemColumnShort    (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<uShort>   getElemColumnuShort   (const Vector<uInt>& rownrs,
+    virtual Array<uShort>   getElemColumnuShort   (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<Int>      getElemColumnInt      (const Vector<uInt>& rownrs,
+    virtual Array<Int>      getElemColumnInt      (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<uInt>     getElemColumnuInt     (const Vector<uInt>& rownrs,
+    virtual Array<uInt>     getElemColumnuInt     (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<Float>    getElemColumnFloat    (const Vector<uInt>& rownrs,
+    virtual Array<Float>    getElemColumnFloat    (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<Double>   getElemColumnDouble   (const Vector<uInt>& rownrs,
+    virtual Array<Double>   getElemColumnDouble   (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<Complex>  getElemColumnComplex  (const Vector<uInt>& rownrs,
+    virtual Array<Complex>  getElemColumnComplex  (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<DComplex> getElemColumnDComplex (const Vector<uInt>& rownrs,
+    virtual Array<DComplex> getElemColumnDComplex (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
-    virtual Array<String>   getElemColumnString   (const Vector<uInt>& rownrs,
+    virtual Array<String>   getElemColumnString   (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
     // </group>
 
@@ -219,7 +223,7 @@ public:
     virtual void disableApplySelection();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     // Get the TableColumn object.
     const TableColumn& getColumn() const;
@@ -268,12 +272,12 @@ public:
     ~TableExprNodeArrayColumnBool();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual Bool getElemBool (const TableExprId& id, const Slicer& index);
     virtual Array<Bool>  getArrayBool (const TableExprId& id);
     virtual Array<Bool>  getSliceBool (const TableExprId& id, const Slicer&);
-    virtual Array<Bool>  getElemColumnBool (const Vector<uInt>& rownrs,
+    virtual Array<Bool>  getElemColumnBool (const Vector<rownr_t>& rownrs,
                                             const Slicer&);
 protected:
     ArrayColumn<Bool> col_p;
@@ -306,13 +310,13 @@ public:
     ~TableExprNodeArrayColumnuChar();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual Int64 getElemInt (const TableExprId& id, const Slicer& index);
     virtual Array<Int64> getArrayInt (const TableExprId& id);
     virtual Array<Int64> getSliceInt (const TableExprId& id,
 					  const Slicer&);
-    virtual Array<uChar>  getElemColumnuChar (const Vector<uInt>& rownrs,
+    virtual Array<uChar>  getElemColumnuChar (const Vector<rownr_t>& rownrs,
                                               const Slicer&);
 protected:
     ArrayColumn<uChar> col_p;
@@ -345,13 +349,13 @@ public:
     ~TableExprNodeArrayColumnShort();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual Int64 getElemInt (const TableExprId& id, const Slicer& index);
     virtual Array<Int64> getArrayInt (const TableExprId& id);
     virtual Array<Int64> getSliceInt (const TableExprId& id,
 					  const Slicer&);
-    virtual Array<Short>  getElemColumnShort (const Vector<uInt>& rownrs,
+    virtual Array<Short>  getElemColumnShort (const Vector<rownr_t>& rownrs,
                                               const Slicer&);
 protected:
     ArrayColumn<Short> col_p;
@@ -384,13 +388,13 @@ public:
     ~TableExprNodeArrayColumnuShort();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual Int64 getElemInt (const TableExprId& id, const Slicer& index);
     virtual Array<Int64> getArrayInt (const TableExprId& id);
     virtual Array<Int64> getSliceInt (const TableExprId& id,
 					  const Slicer&);
-    virtual Array<uShort> getElemColumnuShort (const Vector<uInt>& rownrs,
+    virtual Array<uShort> getElemColumnuShort (const Vector<rownr_t>& rownrs,
                                                const Slicer&);
 protected:
     ArrayColumn<uShort> col_p;
@@ -423,13 +427,13 @@ public:
     ~TableExprNodeArrayColumnInt();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual Int64 getElemInt (const TableExprId& id, const Slicer& index);
     virtual Array<Int64> getArrayInt (const TableExprId& id);
     virtual Array<Int64> getSliceInt (const TableExprId& id,
 					  const Slicer&);
-    virtual Array<Int>    getElemColumnInt (const Vector<uInt>& rownrs,
+    virtual Array<Int>    getElemColumnInt (const Vector<rownr_t>& rownrs,
                                             const Slicer&);
 protected:
     ArrayColumn<Int> col_p;
@@ -462,13 +466,13 @@ public:
     ~TableExprNodeArrayColumnuInt();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual Int64 getElemInt (const TableExprId& id, const Slicer& index);
     virtual Array<Int64> getArrayInt (const TableExprId& id);
     virtual Array<Int64> getSliceInt (const TableExprId& id,
 					  const Slicer&);
-    virtual Array<uInt>   getElemColumnuInt (const Vector<uInt>& rownrs,
+    virtual Array<uInt>   getElemColumnuInt (const Vector<rownr_t>& rownrs,
                                              const Slicer&);
 protected:
     ArrayColumn<uInt> col_p;
@@ -501,13 +505,13 @@ public:
     ~TableExprNodeArrayColumnFloat();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual Double getElemDouble (const TableExprId& id, const Slicer& index);
     virtual Array<Double> getArrayDouble (const TableExprId& id);
     virtual Array<Double> getSliceDouble (const TableExprId& id,
 					  const Slicer&);
-    virtual Array<Float>  getElemColumnFloat (const Vector<uInt>& rownrs,
+    virtual Array<Float>  getElemColumnFloat (const Vector<rownr_t>& rownrs,
                                               const Slicer&);
 protected:
     ArrayColumn<Float> col_p;
@@ -540,13 +544,13 @@ public:
     ~TableExprNodeArrayColumnDouble();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual Double getElemDouble (const TableExprId& id, const Slicer& index);
     virtual Array<Double> getArrayDouble (const TableExprId& id);
     virtual Array<Double> getSliceDouble (const TableExprId& id,
 					  const Slicer&);
-    virtual Array<Double> getElemColumnDouble (const Vector<uInt>& rownrs,
+    virtual Array<Double> getElemColumnDouble (const Vector<rownr_t>& rownrs,
                                                const Slicer&);
 protected:
     ArrayColumn<Double> col_p;
@@ -579,13 +583,13 @@ public:
     ~TableExprNodeArrayColumnComplex();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual DComplex getElemDComplex (const TableExprId& id, const Slicer& index);
     virtual Array<DComplex> getArrayDComplex (const TableExprId& id);
     virtual Array<DComplex> getSliceDComplex (const TableExprId& id,
 					      const Slicer&);
-    virtual Array<Complex>  getElemColumnComplex (const Vector<uInt>& rownrs,
+    virtual Array<Complex>  getElemColumnComplex (const Vector<rownr_t>& rownrs,
                                                   const Slicer&);
 protected:
     ArrayColumn<Complex> col_p;
@@ -618,13 +622,13 @@ public:
     ~TableExprNodeArrayColumnDComplex();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual DComplex getElemDComplex (const TableExprId& id, const Slicer& index);
     virtual Array<DComplex> getArrayDComplex (const TableExprId& id);
     virtual Array<DComplex> getSliceDComplex (const TableExprId& id,
 					      const Slicer&);
-    virtual Array<DComplex> getElemColumnDComplex (const Vector<uInt>& rownrs,
+    virtual Array<DComplex> getElemColumnDComplex (const Vector<rownr_t>& rownrs,
                                                    const Slicer&);
 protected:
     ArrayColumn<DComplex> col_p;
@@ -657,13 +661,13 @@ public:
     ~TableExprNodeArrayColumnString();
 
     // Re-create the column object for a selection of rows.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     virtual String getElemString (const TableExprId& id, const Slicer& index);
     virtual Array<String> getArrayString (const TableExprId& id);
     virtual Array<String> getSliceString (const TableExprId& id,
 					  const Slicer&);
-    virtual Array<String> getElemColumnString (const Vector<uInt>& rownrs,
+    virtual Array<String> getElemColumnString (const Vector<rownr_t>& rownrs,
                                                const Slicer&);
 protected:
     ArrayColumn<String> col_p;
@@ -807,17 +811,17 @@ public:
     // (that means that the index can vary with row number).
     Bool getColumnDataType (DataType&) const;
 
-    Array<Bool>     getColumnBool (const Vector<uInt>& rownrs);
-    Array<uChar>    getColumnuChar (const Vector<uInt>& rownrs);
-    Array<Short>    getColumnShort (const Vector<uInt>& rownrs);
-    Array<uShort>   getColumnuShort (const Vector<uInt>& rownrs);
-    Array<Int>      getColumnInt (const Vector<uInt>& rownrs);
-    Array<uInt>     getColumnuInt (const Vector<uInt>& rownrs);
-    Array<Float>    getColumnFloat (const Vector<uInt>& rownrs);
-    Array<Double>   getColumnDouble (const Vector<uInt>& rownrs);
-    Array<Complex>  getColumnComplex (const Vector<uInt>& rownrs);
-    Array<DComplex> getColumnDComplex (const Vector<uInt>& rownrs);
-    Array<String>   getColumnString (const Vector<uInt>& rownrs);
+    Array<Bool>     getColumnBool (const Vector<rownr_t>& rownrs);
+    Array<uChar>    getColumnuChar (const Vector<rownr_t>& rownrs);
+    Array<Short>    getColumnShort (const Vector<rownr_t>& rownrs);
+    Array<uShort>   getColumnuShort (const Vector<rownr_t>& rownrs);
+    Array<Int>      getColumnInt (const Vector<rownr_t>& rownrs);
+    Array<uInt>     getColumnuInt (const Vector<rownr_t>& rownrs);
+    Array<Float>    getColumnFloat (const Vector<rownr_t>& rownrs);
+    Array<Double>   getColumnDouble (const Vector<rownr_t>& rownrs);
+    Array<Complex>  getColumnComplex (const Vector<rownr_t>& rownrs);
+    Array<DComplex> getColumnDComplex (const Vector<rownr_t>& rownrs);
+    Array<String>   getColumnString (const Vector<rownr_t>& rownrs);
 
     // Get the index node.
     const TableExprNodeIndex* getIndexNode() const;
@@ -37,6 +37,7 @@
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/iostream.h>
 
@@ -117,7 +118,7 @@ void TableExprNodeRep::show (ostream& os, uInt indent) const
 void TableExprNodeRep::disableApplySelection()
 {}
 
-void TableExprNodeRep::applySelection (const Vector<uInt>&)
+void TableExprNodeRep::applySelection (const Vector<rownr_t>&)
 {}
 
 void TableExprNodeRep::getAggrNodes (vector<TableExprNodeRep*>&)
@@ -155,7 +156,7 @@ void TableExprNodeRep::adaptSetUnits (const Unit&)
 {}
 
 //# Determine the number of rows in the table used in the expression.
-uInt TableExprNodeRep::nrow() const
+rownr_t TableExprNodeRep::nrow() const
 {
     if (exprtype_p == Constant) {
         return 1;
@@ -307,6 +308,45 @@ Array<MVTime> TableExprNodeRep::getArrayDate (const TableExprId&)
     return Array<MVTime>();
 }
 
+void TableExprNodeRep::getBoolVector (const Vector<rownr_t>& rownrs,
+                                      Vector<Bool>& values)
+{
+    values.resize (rownrs.size());
+    TableExprId id;
+    for (size_t i=0; i<rownrs.size(); ++i) {
+        id.setRownr (rownrs[i]);
+        values[i] = getBool (id);
+    }
+}
+void TableExprNodeRep::getIntVector (const Vector<rownr_t>& rownrs,
+                                     Vector<Int64>& values)
+{
+    values.resize (rownrs.size());
+    TableExprId id;
+    for (size_t i=0; i<rownrs.size(); ++i) {
+        id.setRownr (rownrs[i]);
+        values[i] = getInt (id);
+    }
+}
+void TableExprNodeRep::getDoubleVector (const Vector<rownr_t>& rownrs,
+                                        Vector<Double>& values)
+{
+    // An integer node can use the (possibly faster) integer version.
+    if (dataType() == NTInt) {
+        Vector<Int64> ivalues;
+        getIntVector (rownrs, ivalues);
+        values.resize (ivalues.size());
+        convertArray (values, ivalues);
+        return;
+    }
+    values.resize (rownrs.size());
+    TableExprId id;
+    for (size_t i=0; i<rownrs.size(); ++i) {
+        id.setRownr (rownrs[i]);
+        values[i] = getDouble (id);
+    }
+}
+
 Array<Bool> TableExprNodeRep::getBoolAS (const TableExprId& id)
 {
   if (valueType() == VTArray) {
@@ -422,10 +462,10 @@ Array<Bool> TableExprNodeRep::hasArrayDate (const TableExprId& id,
 
 
 Array<Bool>     TableExprNodeRep::getColumnBool
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<Bool> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -434,28 +474,28 @@ Array<Bool>     TableExprNodeRep::getColumnBool
     return vec;
 }
 Array<uChar>    TableExprNodeRep::getColumnuChar
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnuChar not implemented)");
     return Array<uChar>();
 }
 Array<Short>    TableExprNodeRep::getColumnShort
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnShort not implemented)");
     return Array<Short>();
 }
 Array<uShort>   TableExprNodeRep::getColumnuShort
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnuShort not implemented)");
     return Array<uShort>();
 }
 Array<Int>      TableExprNodeRep::getColumnInt
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<Int> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -464,16 +504,16 @@ Array<Int>      TableExprNodeRep::getColumnInt
     return vec;
 }
 Array<uInt>     TableExprNodeRep::getColumnuInt
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnuInt not implemented)");
     return Array<uInt>();
 }
 // Array<Int64>    TableExprNodeRep::getColumnInt64
-// (const Vector<uInt>& rownrs)
+// (const Vector<rownr_t>& rownrs)
 // {
 //     TableExprId id;
-//     uInt nrrow = rownrs.size();
+//     rownr_t nrrow = rownrs.size();
 //     Vector<Int64> vec (nrrow);
 //     for (uInt i=0; i<nrrow; i++) {
 //       id.setRownr   (rownrs[i]);
@@ -482,16 +522,16 @@ Array<uInt>     TableExprNodeRep::getColumnuInt
 //     return vec;
 // }
 Array<Float>    TableExprNodeRep::getColumnFloat
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnFloat not implemented)");
     return Array<Float>();
 }
 Array<Double>   TableExprNodeRep::getColumnDouble
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<Double> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -500,16 +540,16 @@ Array<Double>   TableExprNodeRep::getColumnDouble
     return vec;
 }
 Array<Complex>  TableExprNodeRep::getColumnComplex
-(const Vector<uInt>&)
+(const Vector<rownr_t>&)
 {
     TableExprNode::throwInvDT ("(getColumnComplex not implemented)");
     return Array<Complex>();
 }
 Array<DComplex> TableExprNodeRep::getColumnDComplex
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<DComplex> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -518,10 +558,10 @@ Array<DComplex> TableExprNodeRep::getColumnDComplex
     return vec;
 }
 Array<String>   TableExprNodeRep::getColumnString
-(const Vector<uInt>& rownrs)
+(const Vector<rownr_t>& rownrs)
 {
     TableExprId id;
-    uInt nrrow = rownrs.size();
+    rownr_t nrrow = rownrs.size();
     Vector<String> vec (nrrow);
     for (uInt i=0; i<nrrow; i++) {
       id.setRownr   (rownrs[i]);
@@ -737,6 +777,12 @@ void TableExprNodeBinary::getColumnNodes (vector<TableExprNodeRep*>& cols)
   }
 }
 
+Bool TableExprNodeBinary::isThreadSafe() const
+{
+  return (lnode_p == 0  ||  lnode_p->isThreadSafe())  &&
+         (rnode_p == 0  ||  rnode_p->isThreadSafe());
+}
+
 // Check the datatypes and get the common one.
 // For use with operands.
 TableExprNodeRep::NodeDataType TableExprNodeBinary::getDT
@@ -1109,6 +1155,11 @@ Bool TableExprNodeRep::isLazyAggregate() const
   return True;
 }
 
+Bool TableExprNodeRep::isThreadSafe() const
+{
+  return False;
+}
+
 
 
 uInt TableExprNodeMulti::checkNumOfArg
@@ -228,7 +228,7 @@ public:
 
     // Re-create the column object for a selection of rows.
     // The default implementation does nothing.
-    virtual void applySelection (const Vector<uInt>& rownrs);
+    virtual void applySelection (const Vector<rownr_t>& rownrs);
 
     // Get the unit conversion factor.
     // Default 1 is returned.
@@ -254,6 +254,12 @@ public:
     // (because all UDF aggregate functions have to be lazy).
     virtual Bool isLazyAggregate() const;
 
+    // Can the expression be evaluated in parallel by multiple threads?
+    // That is the case if the node and its children do not change internal
+    // state when getting a value, while table columns use a mutex.
+    // The default implementation returns False.
+    virtual Bool isThreadSafe() const;
+
     // Get a scalar value for this node in the given row.
     // The appropriate functions are implemented in the derived classes and
     // will usually invoke the get in their children and apply the
@@ -281,6 +287,25 @@ public:
     virtual Array<MVTime> getArrayDate       (const TableExprId& id);
     // </group>
 
+    // Get the scalar values for this node in a block of rows.
+    // The vector is resized as needed and is filled with the values
+    // in the given rows.
+    // <br>The default implementations get the values row by row.
+    // Column nodes read the values in bulk and arithmetic, comparison
+    // and logical nodes apply their operator to the entire vectors in
+    // a tight loop, which avoids the virtual function calls per row.
+    // <br>Note that a derived class must return a vector which does not
+    // share its data with another object, because a parent node can
+    // calculate its result in place.
+    // <group>
+    virtual void getBoolVector   (const Vector<rownr_t>& rownrs,
+                                  Vector<Bool>& values);
+    virtual void getIntVector    (const Vector<rownr_t>& rownrs,
+                                  Vector<Int64>& values);
+    virtual void getDoubleVector (const Vector<rownr_t>& rownrs,
+                                  Vector<Double>& values);
+    // </group>
+
     // General get functions for template purposes.
     // <group>
     void get (const TableExprId& id, Bool& value)
@@ -346,7 +371,7 @@ public:
     // Get the number of rows in the table associated with this expression.
     // One is returned if the expression is a constant.
     // Zero is returned if no table is associated with it.
-    uInt nrow() const;
+    rownr_t nrow() const;
 
     // Get the data type of the column.
     // It returns True when it could set the data type (which it can
@@ -358,17 +383,17 @@ public:
     // The data of function called should match the data type as
     // returned by function <src>getColumnDataType</src>.
     // <group>
-    virtual Array<Bool>     getColumnBool (const Vector<uInt>& rownrs);
-    virtual Array<uChar>    getColumnuChar (const Vector<uInt>& rownrs);
-    virtual Array<Short>    getColumnShort (const Vector<uInt>& rownrs);
-    virtual Array<uShort>   getColumnuShort (const Vector<uInt>& rownrs);
-    virtual Array<Int>      getColumnInt (const Vector<uInt>& rownrs);
-    virtual Array<uInt>     getColumnuInt (const Vector<uInt>& rownrs);
-    virtual Array<Float>    getColumnFloat (const Vector<uInt>& rownrs);
-    virtual Array<Double>   getColumnDouble (const Vector<uInt>& rownrs);
-    virtual Array<Complex>  getColumnComplex (const Vector<uInt>& rownrs);
-    virtual Array<DComplex> getColumnDComplex (const Vector<uInt>& rownrs);
-    virtual Array<String>   getColumnString (const Vector<uInt>& rownrs);
+    virtual Array<Bool>     getColumnBool (const Vector<rownr_t>& rownrs);
+    virtual Array<uChar>    getColumnuChar (const Vector<rownr_t>& rownrs);
+    virtual Array<Short>    getColumnShort (const Vector<rownr_t>& rownrs);
+    virtual Array<uShort>   getColumnuShort (const Vector<rownr_t>& rownrs);
+    virtual Array<Int>      getColumnInt (const Vector<rownr_t>& rownrs);
+    virtual Array<uInt>     getColumnuInt (const Vector<rownr_t>& rownrs);
+    virtual Array<Float>    getColumnFloat (const Vector<rownr_t>& rownrs);
+    virtual Array<Double>   getColumnDouble (const Vector<rownr_t>& rownrs);
+    virtual Array<Complex>  getColumnComplex (const Vector<rownr_t>& rownrs);
+    virtual Array<DComplex> getColumnDComplex (const Vector<rownr_t>& rownrs);
+    virtual Array<String>   getColumnString (const Vector<rownr_t>& rownrs);
     // </group>
 
     // Convert the tree to a number of range vectors which at least
@@ -565,6 +590,9 @@ public:
     // Get the nodes representing a table column.
     virtual void getColumnNodes (vector<TableExprNodeRep*>& cols);
   
+    // The node is thread-safe if its children (if any) are.
+    virtual Bool isThreadSafe() const;
+
     // Check the data types and get the common one.
     static NodeDataType getDT (NodeDataType leftDtype,
 			       NodeDataType rightDype,
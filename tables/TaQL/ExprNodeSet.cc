@@ -761,7 +761,7 @@ TableExprNodeSet::TableExprNodeSet (const Slicer& indices)
     }
 }
 
-TableExprNodeSet::TableExprNodeSet (const Vector<uInt>& rownrs,
+TableExprNodeSet::TableExprNodeSet (const Vector<rownr_t>& rownrs,
                                     const TableExprNodeSet& set)
 : TableExprNodeRep (set.dataType(), VTSet, OtUndef, Table()),
   itsElems         (rownrs.size() * set.nelements()),
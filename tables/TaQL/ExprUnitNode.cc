@@ -139,6 +139,17 @@ Double TableExprNodeUnit::getDouble (const TableExprId& id)
 DComplex TableExprNodeUnit::getDComplex (const TableExprId& id)
   { return factor_p * lnode_p->getDComplex(id); }
 
+void TableExprNodeUnit::getDoubleVector (const Vector<rownr_t>& rownrs,
+                                         Vector<Double>& values)
+{
+  lnode_p->getDoubleVector (rownrs, values);
+  Double* res = values.data();
+  size_t n = values.size();
+  for (size_t i=0; i<n; ++i) {
+    res[i] *= factor_p;
+  }
+}
+
 
 
 
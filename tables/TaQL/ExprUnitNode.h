@@ -91,6 +91,8 @@ public:
 
   virtual Double   getDouble   (const TableExprId& id);
   virtual DComplex getDComplex (const TableExprId& id);
+  virtual void getDoubleVector (const Vector<rownr_t>& rownrs,
+                                Vector<Double>& values);
 private:
   Double factor_p;
 };
@@ -162,6 +162,10 @@ TaQLNode TaQLNode::restoreNode (AipsIO& aio)
     return TaQLRegexNodeRep::restore (aio);
   case TaQLNode_Count:
     return TaQLCountNodeRep::restore (aio);
+  case TaQLNode_Groupby:
+    return TaQLGroupNodeRep::restore (aio);
+  case TaQLNode_Param:
+    return TaQLParamNodeRep::restore (aio);
   default:
     throw AipsError ("TaQLNode::restoreNode - unknown node type");
   }
@@ -1006,8 +1006,8 @@ TaQLSelectNodeRep* TaQLSelectNodeRep::restore (AipsIO& aio)
   TaQLMultiNode tables = TaQLNode::restoreMultiNode (aio);
   TaQLNode join = TaQLNode::restoreMultiNode (aio);
   TaQLNode where = TaQLNode::restoreNode (aio);
-  TaQLNode groupby = TaQLNode::restoreMultiNode (aio);
-  TaQLNode having = TaQLNode::restoreMultiNode (aio);
+  TaQLNode groupby = TaQLNode::restoreNode (aio);
+  TaQLNode having = TaQLNode::restoreNode (aio);
   TaQLNode sort = TaQLNode::restoreNode (aio);
   TaQLNode limitoff = TaQLNode::restoreNode (aio);
   TaQLNode giving = TaQLNode::restoreNode (aio);
@@ -1345,4 +1345,26 @@ TaQLUnitNodeRep* TaQLUnitNodeRep::restore (AipsIO& aio)
 }
 
 
+TaQLParamNodeRep::~TaQLParamNodeRep()
+{}
+TaQLNodeResult TaQLParamNodeRep::visit (TaQLNodeVisitor& visitor) const
+{
+  return visitor.visitParamNode (*this);
+}
+void TaQLParamNodeRep::show (std::ostream& os) const
+{
+  os << '$' << itsIndex;
+}
+void TaQLParamNodeRep::save (AipsIO& aio) const
+{
+  aio << itsIndex;
+}
+TaQLParamNodeRep* TaQLParamNodeRep::restore (AipsIO& aio)
+{
+  Int index;
+  aio >> index;
+  return new TaQLParamNodeRep (index);
+}
+
+
 } //# NAMESPACE CASACORE - END
@@ -1194,6 +1194,39 @@ public:
 };
 
 
+// <summary>
+// Raw TaQL parse tree node defining a parameter of a prepared statement.
+// </summary>
+// <use visibility=local>
+// <reviewed reviewer="" date="" tests="tTaQLNode">
+// </reviewed>
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TaQLNodeRep>TaQLNodeRep</linkto>
+// </prerequisite>
+// <synopsis> 
+// This class is a TaQLNodeRep holding the number of a parameter given
+// as $n in an expression. The numbers start at 1.
+// The value of the parameter is given when the command is executed
+// (see class <linkto class=TaQLStatement>TaQLStatement</linkto>).
+// </synopsis> 
+
+class TaQLParamNodeRep: public TaQLNodeRep
+{
+public:
+  explicit TaQLParamNodeRep (Int index)
+    : TaQLNodeRep (TaQLNode_Param),
+      itsIndex(index) {}
+  virtual ~TaQLParamNodeRep();
+  virtual TaQLNodeResult visit (TaQLNodeVisitor&) const;
+  virtual void show (std::ostream& os) const;
+  virtual void save (AipsIO& aio) const;
+  static TaQLParamNodeRep* restore (AipsIO& aio);
+
+  Int itsIndex;
+};
+
+
 } //# NAMESPACE CASACORE - END
 
 #endif
@@ -50,10 +50,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
   TaQLNodeResult TaQLNodeHandler::handleTree (const TaQLNode& node,
-				  const std::vector<const Table*>& tempTables)
+				  const std::vector<const Table*>& tempTables,
+				  const std::vector<TableExprNode>& params)
   {
     clearStack();
     itsTempTables = tempTables;
+    itsParams     = params;
+    itsUsedTables.clear();
     return node.visit (*this);
   }
     
@@ -497,7 +500,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (! node.getNoExecute()) {
       if (outer) {
 	curSel->execute (node.style().doTiming(), False, False, 0,
-                         node.style().doTracing());
+                         node.style().doTracing(), node.style().nthreads());
 	hrval->setTable (curSel->getTable());
 	hrval->setNames (new Vector<String>(curSel->getColumnNames()));
 	hrval->setString ("select");
@@ -665,6 +668,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return new TaQLNodeHRValue (expr.useUnit(node.itsUnit));
   }
 
+  TaQLNodeResult TaQLNodeHandler::visitParamNode (const TaQLParamNodeRep& node)
+  {
+    if (node.itsIndex < 1  ||  node.itsIndex > Int(itsParams.size())) {
+      throw TableInvExpr ("No value given for parameter $" +
+                          String::toString(node.itsIndex));
+    }
+    return new TaQLNodeHRValue (itsParams[node.itsIndex - 1]);
+  }
+
   Record TaQLNodeHandler::handleRecord (const TaQLMultiNodeRep* node)
   {
     Record rec;
@@ -842,6 +854,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       const TaQLNodeHRValue& res = getHR(result);
       topStack()->addTable (res.getInt(), res.getString(), res.getTable(),
 			    res.getAlias(), itsTempTables, itsStack);
+      itsUsedTables.push_back (topStack()->getFromTables().back().table());
     }
     //# Possibly let handleColumns also add a table (for selected columns)
   }
@@ -98,8 +98,15 @@ public:
 
   // Handle and process the raw parse tree.
   // The result contains a Table or TableExprNode object.
+  // The values of the parameters $n in the expressions can be given.
   TaQLNodeResult handleTree (const TaQLNode& tree,
-			     const std::vector<const Table*>&);
+			     const std::vector<const Table*>&,
+			     const std::vector<TableExprNode>& params =
+			       std::vector<TableExprNode>());
+
+  // Get the tables used in the FROM clauses of the processed command.
+  const std::vector<Table>& usedTables() const
+    { return itsUsedTables; }
 
   // Define the functions to visit each node type.
   // <group>
@@ -132,6 +139,7 @@ public:
   virtual TaQLNodeResult visitColSpecNode  (const TaQLColSpecNodeRep& node);
   virtual TaQLNodeResult visitRecFldNode   (const TaQLRecFldNodeRep& node);
   virtual TaQLNodeResult visitUnitNode     (const TaQLUnitNodeRep& node);
+  virtual TaQLNodeResult visitParamNode    (const TaQLParamNodeRep& node);
   // </group>
 
   // Get the actual result object from the result.
@@ -196,6 +204,10 @@ private:
   std::vector<TableParseSelect*> itsStack;
   //# The temporary tables referred to by $i in the TaQL string.
   std::vector<const Table*> itsTempTables;
+  //# The values of the parameters $i in the TaQL expressions.
+  std::vector<TableExprNode> itsParams;
+  //# The tables used in the FROM clauses.
+  std::vector<Table> itsUsedTables;
 };
 
 
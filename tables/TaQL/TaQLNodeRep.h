@@ -110,6 +110,7 @@ public:
   #define TaQLNode_Regex    char(27)
   #define TaQLNode_Count    char(28)
   #define TaQLNode_Groupby  char(29)
+  #define TaQLNode_Param    char(30)
   // </group>
 
   // Constructor for derived classes specifying the type.
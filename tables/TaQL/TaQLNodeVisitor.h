@@ -106,6 +106,7 @@ public:
   virtual TaQLNodeResult visitColSpecNode  (const TaQLColSpecNodeRep& node) = 0;
   virtual TaQLNodeResult visitRecFldNode   (const TaQLRecFldNodeRep& node) = 0;
   virtual TaQLNodeResult visitUnitNode     (const TaQLUnitNodeRep& node) = 0;
+  virtual TaQLNodeResult visitParamNode    (const TaQLParamNodeRep& node) = 0;
   // </group>
 
 protected:
@@ -0,0 +1,156 @@
+//# TaQLParseCache.cc: Cache of parsed TaQL commands
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/TaQL/TaQLParseCache.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/IO/MemoryIO.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/iostream.h>
+#include <cstring>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TaQLParseCache TaQLParseCache::theirCache;
+Bool TaQLParseCache::theirSizeSet = False;
+
+
+TaQLParseCache::TaQLParseCache (uInt maxSize)
+  : itsCache   (maxSize),
+    itsNHits   (0),
+    itsNMisses (0)
+{}
+
+TaQLParseCache::~TaQLParseCache()
+{}
+
+TaQLParseCache& TaQLParseCache::global()
+{
+  ScopedMutexLock lock(theirCache.itsMutex);
+  if (!theirSizeSet) {
+    Int size;
+    AipsrcValue<Int>::find (size, "taql.parsecache.size", 64);
+    theirCache.itsCache.setMaxSize (std::max (size, 0));
+    theirSizeSet = True;
+  }
+  return theirCache;
+}
+
+TaQLNode TaQLParseCache::get (const String& command)
+{
+  Entry entry;
+  {
+    ScopedMutexLock lock(itsMutex);
+    const Entry* cached = itsCache.find (command);
+    if (cached) {
+      entry = *cached;
+      itsNHits++;
+    } else {
+      itsNMisses++;
+    }
+  }
+  if (entry.tree.size() == 0) {
+    // Not found, so parse the command (which throws in case of errors).
+    TaQLNode tree = TaQLNode::parse (command);
+    ScopedMutexLock lock(itsMutex);
+    if (itsCache.maxSize() > 0  &&  tree.isValid()  &&
+        !itsCache.contains(command)) {
+      MemoryIO memio(4096, 4096);
+      AipsIO aio(&memio);
+      tree.save (aio);
+      entry.style = tree.style();
+      entry.tree.resize (memio.length());
+      memcpy (entry.tree.storage(), memio.getBuffer(), memio.length());
+      itsCache.put (command, entry);
+    }
+    return tree;
+  }
+  // Restore the tree from its serialized form.
+  // The nodes take the TaQL style from TaQLNode::theirStyle, so it has
+  // to be set while holding the parser's mutex.
+  MemoryIO memio(entry.tree.storage(), entry.tree.size());
+  AipsIO aio(&memio);
+  ScopedMutexLock lock(TaQLNode::theirMutex);
+  TaQLNode::theirStyle = entry.style;
+  TaQLNode tree = TaQLNode::restore (aio);
+  TaQLNode::theirStyle.reset();
+  return tree;
+}
+
+uInt TaQLParseCache::maxSize() const
+{
+  ScopedMutexLock lock(itsMutex);
+  return itsCache.maxSize();
+}
+
+void TaQLParseCache::setMaxSize (uInt maxSize)
+{
+  ScopedMutexLock lock(itsMutex);
+  itsCache.setMaxSize (maxSize);
+  if (this == &theirCache) {
+    theirSizeSet = True;
+  }
+}
+
+uInt TaQLParseCache::size() const
+{
+  ScopedMutexLock lock(itsMutex);
+  return itsCache.size();
+}
+
+void TaQLParseCache::clear()
+{
+  ScopedMutexLock lock(itsMutex);
+  itsCache.clear();
+  itsNHits   = 0;
+  itsNMisses = 0;
+}
+
+uInt64 TaQLParseCache::nhits() const
+{
+  ScopedMutexLock lock(itsMutex);
+  return itsNHits;
+}
+
+uInt64 TaQLParseCache::nmisses() const
+{
+  ScopedMutexLock lock(itsMutex);
+  return itsNMisses;
+}
+
+void TaQLParseCache::showStatistics (std::ostream& os) const
+{
+  ScopedMutexLock lock(itsMutex);
+  os << "TaQLParseCache: " << itsCache.size() << " of "
+     << itsCache.maxSize()
+     << " commands cached, " << itsNHits << " hits, "
+     << itsNMisses << " misses" << endl;
+}
+
+
+} //# NAMESPACE CASACORE - END
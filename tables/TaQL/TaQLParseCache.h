@@ -0,0 +1,153 @@
+//# TaQLParseCache.h: Cache of parsed TaQL commands
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TAQLPARSECACHE_H
+#define TABLES_TAQLPARSECACHE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/TaQLNode.h>
+#include <casacore/tables/TaQL/TaQLStyle.h>
+#include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Containers/LRUCache.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/OS/Mutex.h>
+#include <casacore/casa/iosfwd.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// Cache of parsed TaQL commands
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tTaQLStatement">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TaQLNode>TaQLNode</linkto>
+// </prerequisite>
+
+// <synopsis> 
+// TaQLParseCache keeps the raw parse trees of the most recently used
+// TaQL commands, keyed by the command text. If a command is found in the
+// cache, the flex/bison parser does not need to be invoked again.
+// It is mainly useful for prepared statements (see class
+// <linkto class=TaQLStatement>TaQLStatement</linkto>) where the same
+// command is executed many times with different parameter values.
+// <p>
+// The cache has a maximum number of entries; when full, the least recently
+// used command is removed (see class <linkto class=LRUCache>LRUCache</linkto>).
+// In principle only one TaQLParseCache object
+// exists in a process (see function <src>global</src>). Its size is
+// defined by the aipsrc variable <src>taql.parsecache.size</src>
+// (default 64). A size 0 disables the cache.
+// <p>
+// Only the raw parse tree is cached, not the result of processing it,
+// because the processing depends on the contents of the tables used.
+// The tree is kept in serialized form (see <src>TaQLNode::save</src>),
+// so each <src>get</src> returns a new tree which is not shared with
+// other users. In this way the cache can be used by multiple threads;
+// a mutex synchronizes access to it.
+// </synopsis> 
+
+// <example>
+// <srcblock>
+//   TaQLNode tree = TaQLParseCache::global().get
+//                          ("select from my.ms where ANTENNA1 = $1");
+// </srcblock>
+// </example>
+
+class TaQLParseCache
+{
+public:
+  // Construct an empty cache holding at most <src>maxSize</src> commands.
+  explicit TaQLParseCache (uInt maxSize=64);
+
+  ~TaQLParseCache();
+
+  // Get the parse tree of a command.
+  // If not in the cache, the command is parsed and added to the cache.
+  // An exception is thrown in case of parse errors.
+  TaQLNode get (const String& command);
+
+  // Get or set the maximum number of cached commands.
+  // Setting it to a lower value removes the oldest commands.
+  // <group>
+  uInt maxSize() const;
+  void setMaxSize (uInt maxSize);
+  // </group>
+
+  // Get the number of cached commands.
+  uInt size() const;
+
+  // Remove all commands from the cache and reset the statistics.
+  void clear();
+
+  // Get the number of cache hits and misses.
+  // <group>
+  uInt64 nhits() const;
+  uInt64 nmisses() const;
+  // </group>
+
+  // Show the statistics.
+  void showStatistics (std::ostream&) const;
+
+  // Get the process-wide cache used by tableCommand.
+  // At first use its size is read from aipsrc.
+  static TaQLParseCache& global();
+
+private:
+  // The copy constructor and assignment are forbidden.
+  // <group>
+  TaQLParseCache (const TaQLParseCache&);
+  TaQLParseCache& operator= (const TaQLParseCache&);
+  // </group>
+
+  //# The style and serialized parse tree of a cached command.
+  struct Entry {
+    TaQLStyle    style;
+    Block<uChar> tree;
+  };
+
+  LRUCache<String, Entry> itsCache;
+  uInt64 itsNHits;
+  uInt64 itsNMisses;
+  //# A mutex to synchronize access to the cache.
+  mutable Mutex itsMutex;
+  //# The global cache.
+  static TaQLParseCache theirCache;
+  static Bool theirSizeSet;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
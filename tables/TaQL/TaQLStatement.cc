@@ -0,0 +1,93 @@
+//# TaQLStatement.cc: A prepared TaQL command with parameters
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/TaQL/TaQLStatement.h>
+#include <casacore/tables/TaQL/TaQLParseCache.h>
+#include <casacore/tables/TaQL/TaQLNodeHandler.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/Exceptions/Error.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TaQLStatement::TaQLStatement()
+{}
+
+TaQLStatement::TaQLStatement (const String& command)
+  : itsCommand (command),
+    itsTree    (TaQLParseCache::global().get (command))
+{}
+
+TaQLResult TaQLStatement::execute (const std::vector<TableExprNode>& params)
+{
+  std::vector<const Table*> tempTables;
+  Vector<String> cols;
+  String commandType;
+  return execute (params, tempTables, cols, commandType);
+}
+
+TaQLResult TaQLStatement::execute (const std::vector<TableExprNode>& params,
+                                   const std::vector<const Table*>& tempTables,
+                                   Vector<String>& cols,
+                                   String& commandType)
+{
+  commandType = "error";
+  if (! itsTree.isValid()) {
+    throw TableInvExpr ("TaQLStatement::execute: no command given");
+  }
+  Timer timer;
+  try {
+    TaQLNodeHandler treeHandler;
+    TaQLNodeResult res = treeHandler.handleTree (itsTree, tempTables, params);
+    // Keep the tables open for a next execution.
+    itsUsedTables = treeHandler.usedTables();
+    const TaQLNodeHRValue& hrval = TaQLNodeHandler::getHR(res);
+    commandType = hrval.getString();
+    TableExprNode expr = hrval.getExpr();
+    if (itsTree.style().doTiming()) {
+      timer.show (" Total time   ");
+    }
+    if (! expr.isNull()) {
+      return TaQLResult(expr);                 // result of CALC command
+    }
+    //# Copy the possibly selected column names.
+    if (hrval.getNames()) {
+      Vector<String> tmp(*(hrval.getNames()));
+      cols.reference (tmp);
+    } else {
+      cols.resize (0);
+    }
+    return hrval.getTable();
+  } catch (std::exception& x) {
+    throw TableParseError ("'" + itsCommand + "'\n  " + x.what());
+  } 
+}
+
+
+} //# NAMESPACE CASACORE - END
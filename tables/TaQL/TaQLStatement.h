@@ -0,0 +1,140 @@
+//# TaQLStatement.h: A prepared TaQL command with parameters
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_TAQLSTATEMENT_H
+#define TABLES_TAQLSTATEMENT_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/TaQL/TaQLNode.h>
+#include <casacore/tables/TaQL/TaQLResult.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// A prepared TaQL command with parameters
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTaQLStatement">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto group=TableParse.h#tableCommand>tableCommand</linkto>
+//   <li> Note 199 describing
+//        <a href="../notes/199.html">
+//        TaQL</a>
+// </prerequisite>
+
+// <synopsis> 
+// A TaQLStatement is a TaQL command that is parsed once and can be
+// executed many times. The command can contain parameters $1, $2, etc.
+// in its expressions. Their values are given as TableExprNode objects
+// when executing the command, where the first value is used for $1.
+// Note that in a FROM clause $n still denotes a temporary table.
+// <p>
+// The parse tree is obtained via the process-wide
+// <linkto class=TaQLParseCache>TaQLParseCache</linkto>, so creating a
+// statement for a command used before is cheap as well.
+// The processing of the parse tree (finding the columns, etc.) is done
+// at each execution, because it depends on the contents of the tables
+// (which can change between executions).
+// <br>The tables used in the FROM clauses are kept open by the statement
+// after an execution, so a subsequent execution does not need to open
+// them again (opening a table that is already open in the process only
+// requires a lookup in the table cache). They are released when the
+// statement is destructed or <src>releaseTables</src> is called.
+// <p>
+// A TaQLStatement object should not be executed by multiple threads
+// simultaneously; each thread should use its own object.
+// </synopsis> 
+
+// <example>
+// <srcblock>
+//   TaQLStatement stmt ("select from my.ms where ANTENNA1=$1 && TIME>$2");
+//   for (Int ant=0; ant<10; ++ant) {
+//     std::vector<TableExprNode> params(2);
+//     params[0] = ant;
+//     params[1] = startTime;
+//     Table sel = stmt.execute(params).table();
+//   }
+// </srcblock>
+// </example>
+
+class TaQLStatement
+{
+public:
+  // Create an empty statement.
+  TaQLStatement();
+
+  // Parse the command (using the parse cache).
+  // An exception is thrown in case of parse errors.
+  explicit TaQLStatement (const String& command);
+
+  // Get the command.
+  const String& command() const
+    { return itsCommand; }
+
+  // Execute the command with the given parameter values.
+  // The temporary tables referred to by $n in the FROM clauses can be given.
+  // The command type (select, update, etc.) and the selected or updated
+  // column names are returned in the last arguments.
+  // <group>
+  TaQLResult execute (const std::vector<TableExprNode>& params =
+                        std::vector<TableExprNode>());
+  TaQLResult execute (const std::vector<TableExprNode>& params,
+                      const std::vector<const Table*>& tempTables,
+                      Vector<String>& columnNames,
+                      String& commandType);
+  // </group>
+
+  // Get the tables kept open after the last execution.
+  const std::vector<Table>& usedTables() const
+    { return itsUsedTables; }
+
+  // Release the tables kept open after the last execution.
+  void releaseTables()
+    { itsUsedTables.clear(); }
+
+private:
+  String             itsCommand;
+  TaQLNode           itsTree;
+  std::vector<Table> itsUsedTables;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
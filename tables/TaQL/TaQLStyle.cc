@@ -37,7 +37,8 @@ TaQLStyle::TaQLStyle (uInt origin)
     itsEndExcl   (False),
     itsCOrder    (False),
     itsDoTiming  (False),
-    itsDoTracing (False)
+    itsDoTracing (False),
+    itsNThreads  (1)
 {
   // Define mscal as a synonym for derivedmscal.
   defineSynonym ("mscal", "derivedmscal");
@@ -85,6 +86,7 @@ void TaQLStyle::reset()
   set ("GLISH"); 
   itsDoTiming  = False;
   itsDoTracing = False;
+  itsNThreads  = 1;
 }
 
 void TaQLStyle::defineSynonym (const String& synonym, const String& udfLibName)
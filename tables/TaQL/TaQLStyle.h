@@ -55,6 +55,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //
 // The class is also used to tell the TaQL execution engine if timings
 // or tracing of the various parts of the TaQL command need to be done.
+// It also tells how many threads can be used to execute the WHERE and
+// GROUPBY part of a SELECT command (given by <src>USING THREADS n</src>).
 //
 // Finally it is possible to define synonyms for UDF library names.
 // For example, 'derivedmscal' is a lot to type, so a synonym 'mscal'
@@ -64,10 +66,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 class TaQLStyle
 {
 public:
-  // Default style is Glish and no timing/tracing.
+  // Default style is Glish, no timing/tracing, and single threaded.
   explicit TaQLStyle (uInt origin=1);
 
-  // Reset to the default Glish style and no timing/tracing.
+  // Reset to the default Glish style, no timing/tracing and 1 thread.
   void reset();
 
   // Set the style according to the (case-insensitive) value.
@@ -115,12 +117,22 @@ public:
   Bool doTracing() const
     { return itsDoTracing; }
 
+  // Set the number of threads to use in the execution.
+  // A value 0 means that all available cores are used.
+  void setNThreads (uInt nthreads)
+    { itsNThreads = nthreads; }
+
+  // Get the number of threads to use.
+  uInt nthreads() const
+    { return itsNThreads; }
+
 private:
   uInt itsOrigin;
   Bool itsEndExcl;
   Bool itsCOrder;
   Bool itsDoTiming;
   Bool itsDoTracing;
+  uInt itsNThreads;
   std::map<String,String> itsUDFLibNameMap;
 };
 
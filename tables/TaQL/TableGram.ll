@@ -101,6 +101,7 @@ UNION     [Uu][Nn][Ii][Oo][Nn]
 INTERSECT [Ii][Nn][Tt][Ee][Rr][Ss][Ee][Cc][Tt]
 EXCEPT    ([Ee][Xx][Cc][Ee][Pp][Tt])|([Mm][Ii][Nn][Uu][Ss])
 STYLE     [Uu][Ss][Ii][Nn][Gg]{WHITE}[Ss][Tt][Yy][Ll][Ee]{WHITE1}
+THREADS   [Uu][Ss][Ii][Nn][Gg]{WHITE}[Tt][Hh][Rr][Ee][Aa][Dd][Ss]{WHITE1}{WHITE}{INT}
 TIMEWORD  [Tt][Ii][Mm][Ee]
 SELECT    [Ss][Ee][Ll][Ee][Cc][Tt]
 UPDATE    [Uu][Pp][Dd][Aa][Tt][Ee]
@@ -208,6 +209,16 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
             BEGIN(STYLEstate);
 	    return STYLE;
 	  }
+ /* The number of threads is the integer at the end */
+{THREADS} {
+            tableGramPosition() += yyleng;
+            String str(TableGramtext, yyleng);
+            String::size_type pos = str.find_last_not_of ("0123456789");
+            lvalp->val = new TaQLConstNode(
+                new TaQLConstNodeRep (String(str.substr (pos+1))));
+            TaQLNode::theirNodesCreated.push_back (lvalp->val);
+	    return THREADS;
+	  }
 {SELECT}  {
             tableGramPosition() += yyleng;
 	    BEGIN(EXPRstate);
@@ -593,6 +604,15 @@ PATTREX   {OPERREX}{WHITE}({PATTEX}|{DISTEX})
 	    return TABNAME;
 	  }
 
+ /* Elsewhere $n is a parameter of a prepared statement */
+{TEMPTAB} {
+            tableGramPosition() += yyleng;
+            lvalp->val = new TaQLConstNode(
+                new TaQLConstNodeRep (String(TableGramtext+1)));
+            TaQLNode::theirNodesCreated.push_back (lvalp->val);
+	    return PARAM;
+	  }
+
  /* Whitespace is skipped */
 {WHITE}   { tableGramPosition() += yyleng; }
 
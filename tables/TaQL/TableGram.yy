@@ -70,8 +70,10 @@ using namespace casacore;
 %token ALL                  /* ALL (in SELECT ALL) */
 %token <val> NAME           /* name of function, field, table, or alias */
 %token <val> UDFLIBSYN      /* UDF library name synonym definition */
+%token <val> THREADS        /* number of threads to use */
 %token <val> FLDNAME        /* name of field or table */
 %token <val> TABNAME        /* table name */
+%token <val> PARAM          /* parameter $n of a prepared statement */
 %token <val> LITERAL
 %token <val> STRINGLITERAL
 %token <valre> REGEX
@@ -223,6 +225,9 @@ stylecoms: stylecoms stylecomm
          ;
 
 stylecomm: STYLE stylelist
+         | THREADS
+             { TaQLNode::theirStyle.setNThreads
+                                  (String::toInt ($1->getString(), True)); }
          ;
 
 stylelist: stylelist COMMA NAME
@@ -1103,6 +1108,12 @@ simbexpr:  LPAREN orexpr RPAREN
          | literal {
 	       $$ = $1;
 	   }
+         | PARAM {
+	       $$ = new TaQLNode(
+                    new TaQLParamNodeRep (String::toInt ($1->getString(),
+                                                         True)));
+	       TaQLNode::theirNodesCreated.push_back ($$);
+	   }
          | set {
 	       $$ = $1;
 	   }
@@ -30,6 +30,7 @@
 #include <casacore/tables/TaQL/TableParse.h>
 #include <casacore/tables/TaQL/TableGram.h>
 #include <casacore/tables/TaQL/TaQLResult.h>
+#include <casacore/tables/TaQL/TaQLStatement.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprDerNode.h>
 #include <casacore/tables/TaQL/ExprDerNodeArray.h>
@@ -53,6 +54,7 @@
 #include <casacore/tables/Tables/SetupNewTab.h>
 #include <casacore/tables/DataMan/StandardStMan.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/Tables/ColumnsIndex.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Arrays/ArrayUtil.h>
@@ -64,9 +66,17 @@
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/OS/Timer.h>
 #include <casacore/casa/ostream.h>
+#include <algorithm>
+#include <limits.h>
+#include <float.h>
+#include <limits>
 
 #include <casacore/casa/Containers/BlockIO.h>
+#include <casacore/casa/Containers/BlockPool.h>
 
+#ifdef _OPENMP
+# include <omp.h>
+#endif
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -170,7 +180,8 @@ TableParseSelect::TableParseSelect (CommandType commandType)
     stride_p        (1),
     insSel_p        (0),
     noDupl_p        (False),
-    order_p         (Sort::Ascending)
+    order_p         (Sort::Ascending),
+    nthreads_p      (1)
 {}
 
 TableParseSelect::~TableParseSelect()
@@ -1457,7 +1468,7 @@ TableExprNode TableParseSelect::doExists (Bool notexists, Bool showTimings)
     timer.show ("  Exists query");
   }
   // Flag notexists tells if NOT EXISTS or EXISTS was given.
-  return TableExprNode (notexists == (table_p.nrow() < limit_p));
+  return TableExprNode (notexists == (table_p.nrow() < rownr_t(limit_p)));
 }
 
 //# Execute a subquery and create the correct node object for it.
@@ -1710,7 +1721,7 @@ void TableParseSelect::handleCount()
 
 //# Execute the updates.
 void TableParseSelect::doUpdate (Bool showTimings, const Table& origTable,
-                                 Table& updTable, const Vector<uInt>& rownrs,
+                                 Table& updTable, const Vector<rownr_t>& rownrs,
                                  const CountedPtr<TableExprGroupResult>& groups)
 {
   Timer timer;
@@ -1791,7 +1802,7 @@ void TableParseSelect::doUpdate (Bool showTimings, const Table& origTable,
   IPosition trc,blc,inc;
   // Loop through all rows in the table and update each row.
   TableExprIdAggr rowid(groups);
-  for (uInt row=0; row<rownrs.size(); ++row) {
+  for (rownr_t row=0; row<rownrs.size(); ++row) {
     rowid.setRownr (rownrs[row]);
     for (uInt i=0; i<nrkey; i++) {
       TableColumn& col = cols[i];
@@ -1953,7 +1964,7 @@ void TableParseSelect::doUpdate (Bool showTimings, const Table& origTable,
 }
 
 template<typename T>
-void TableParseSelect::updateValue1 (uInt row, const TableExprId& rowid,
+void TableParseSelect::updateValue1 (rownr_t row, const TableExprId& rowid,
                                      Bool isScalarCol,
                                      const TableExprNode& node,
                                      TableColumn& col,
@@ -2003,7 +2014,7 @@ void TableParseSelect::updateValue1 (uInt row, const TableExprId& rowid,
 }
 
 template<typename TCOL, typename TNODE>
-void TableParseSelect::updateValue2 (uInt row, const TableExprId& rowid,
+void TableParseSelect::updateValue2 (rownr_t row, const TableExprId& rowid,
                                      Bool isScalarCol,
                                      const TableExprNode& node,
                                      TableColumn& col,
@@ -2075,7 +2086,7 @@ Table TableParseSelect::doInsert (Bool showTimings, Table& table)
   // Add a single row if the inserts are given as expressions.
   // Select the single row and use update to put the expressions into the row.
   if (update_p.size() > 0) {
-    Vector<uInt> rownrs(1);
+    Vector<rownr_t> rownrs(1);
     rownrs[0] = table.nrow();
     table.addRow();
     Table sel = table(rownrs);
@@ -2119,9 +2130,9 @@ Table TableParseSelect::doInsert (Bool showTimings, Table& table)
     }
   }
   // Add the required nr of rows to the table and make a selection of it.
-  uInt rownr = table.nrow();
+  rownr_t rownr = table.nrow();
   table.addRow (sel.nrow());
-  Vector<uInt> rownrs(sel.nrow());
+  Vector<rownr_t> rownrs(sel.nrow());
   indgen (rownrs, rownr);     // fill with rownr, rownr+1, etc.
   Table tab = table(rownrs);
   TableRow rowto (tab, Vector<String>(columnNames_p));
@@ -2177,7 +2188,7 @@ Table TableParseSelect::doCount (Bool showTimings, const Table& table)
   while (!iter.pastEnd()) {
     Table tabfrom = iter.table();
     // Add one row containing the column values.
-    uInt rownr = tab.nrow();
+    rownr_t rownr = tab.nrow();
     tab.addRow();
     Table tabto = tab.project (bcolNames);
     TableCopy::copyRows (tabto, tabfrom, rownr, 0, 1);
@@ -2192,6 +2203,227 @@ Table TableParseSelect::doCount (Bool showTimings, const Table& table)
 }
 
 
+Vector<rownr_t> TableParseSelect::doWhereParallel (const Table& table,
+                                                   rownr_t nrmax)
+{
+  // In each round every thread evaluates the expression for a block of
+  // rows. The results are combined in row order, so it is possible to
+  // stop as soon as nrmax rows are found.
+  // Only the rows that can match according to the zone maps are used.
+  const rownr_t blockSize = 4096;
+  uInt nthr = nthreads_p;
+  rownr_t nrow = table.nrow();
+  std::vector<std::pair<rownr_t,rownr_t> > intervals;
+  table.zoneIntervals (node_p, intervals);
+  std::vector<std::pair<rownr_t,rownr_t> > blocks;
+  for (uInt i=0; i<intervals.size(); ++i) {
+    for (rownr_t bst=intervals[i].first; bst<intervals[i].second;
+         bst+=blockSize) {
+      blocks.push_back (std::make_pair
+                        (bst, std::min(blockSize, intervals[i].second-bst)));
+    }
+  }
+  rownr_t nblock = blocks.size();
+  vector<Vector<rownr_t> > found(nthr);
+  vector<String> errors(nthr);
+  Vector<rownr_t> rownrs(std::min(nrow, rownr_t(nthr)*blockSize));
+  rownr_t nfound = 0;
+  Bool done = False;
+  String error;
+  // Let the threads read the columns concurrently if possible.
+  vector<TableExprNodeRep*> exprNodes
+    (1, const_cast<TableExprNodeRep*>(node_p.getNodeRep()));
+  TableExprColumnThreads colThreads (exprNodes, nthr);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthr)
+#endif
+  {
+    // The pool is per thread, so enable it once in each thread.
+    BlockPoolScope poolScope;
+    for (rownr_t st=0; st<nblock; st+=nthr) {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+      for (Int i=0; i<Int(nthr); ++i) {
+        rownr_t blk = st + i;
+        found[i].resize (0);
+        if (blk < nblock) {
+          // An exception cannot be thrown out of a parallel region.
+          try {
+            Vector<rownr_t> blockRows(blocks[blk].second);
+            indgen (blockRows, blocks[blk].first);
+            Vector<Bool> vals;
+            node_p.getBoolVector (blockRows, vals);
+            found[i].resize (ntrue(vals));
+            rownr_t nr = 0;
+            for (rownr_t j=0; j<vals.size(); ++j) {
+              if (vals[j]) {
+                found[i][nr++] = blockRows[j];
+              }
+            }
+          } catch (std::exception& x) {
+            errors[i] = x.what();
+          }
+        }
+      }
+      // Combine the results of this round in row order.
+#ifdef _OPENMP
+#pragma omp single
+#endif
+      {
+        for (uInt i=0; i<nthr && !done; ++i) {
+          if (! errors[i].empty()) {
+            error = errors[i];
+            done  = True;
+            break;
+          }
+          if (nfound + found[i].size() > rownrs.size()) {
+            rownrs.resize (std::max(rownr_t(2*rownrs.size()),
+                                    nfound + found[i].size()), True);
+          }
+          for (rownr_t j=0; j<found[i].size(); ++j) {
+            rownrs[nfound++] = found[i][j];
+          }
+        }
+        if (nrmax > 0  &&  nfound >= nrmax) {
+          nfound = nrmax;
+          done   = True;
+        }
+      }
+      // All threads see the same value of done after the single's barrier.
+      if (done) {
+        break;
+      }
+    }
+  }
+  if (! error.empty()) {
+    throw TableInvExpr (error);
+  }
+  rownrs.resize (nfound, True);
+  return rownrs;
+}
+
+Bool TableParseSelect::findIndexRows (const Table& table,
+                                      Vector<rownr_t>& rownrs,
+                                      String& columnName)
+{
+  if (node_p.dataType() != TpBool  ||  !node_p.isScalar()  ||
+      !table.isRootTable()) {
+    return False;
+  }
+  Block<TableExprRange> ranges;
+  node_p.ranges (ranges);
+  for (uInt i=0; i<ranges.size(); ++i) {
+    const TableColumn& col = ranges[i].getColumn();
+    // The column must be part of the table itself (not of a selection).
+    if (! (col.table().isRootTable()  &&  col.table().isSameRoot (table))) {
+      continue;
+    }
+    columnName = col.columnDesc().name();
+    DataType dtype = col.columnDesc().dataType();
+    if (! ColumnsIndex::hasPersistentIndex
+                              (table, Vector<String>(1, columnName))  ||
+        !(dtype == TpDouble  ||  dtype == TpInt  ||  dtype == TpUInt  ||
+          dtype == TpShort  ||  dtype == TpUChar)) {
+      continue;
+    }
+    ColumnsIndex colInx (table, columnName);
+    const Vector<Double>& st  = ranges[i].start();
+    const Vector<Double>& end = ranges[i].end();
+    std::vector<rownr_t> rows;
+    for (uInt j=0; j<st.size(); ++j) {
+      Record& lower = colInx.accessLowerKey();
+      Record& upper = colInx.accessUpperKey();
+      if (dtype == TpDouble) {
+        // An open end of a range is given as -DBL_MAX or DBL_MAX, so use
+        // infinity instead to find infinite values as well.
+        Double sv = st[j];
+        Double ev = end[j];
+        if (sv == -DBL_MAX) {
+          sv = -std::numeric_limits<Double>::infinity();
+        }
+        if (ev == DBL_MAX) {
+          ev = std::numeric_limits<Double>::infinity();
+        }
+        lower.define (columnName, sv);
+        upper.define (columnName, ev);
+      } else {
+        // Use the integer values inside the range (clipped to the
+        // range of the data type).
+        Double minv = 0;
+        Double maxv = UCHAR_MAX;
+        if (dtype == TpInt) {
+          minv = INT_MIN;
+          maxv = INT_MAX;
+        } else if (dtype == TpUInt) {
+          maxv = UINT_MAX;
+        } else if (dtype == TpShort) {
+          minv = SHRT_MIN;
+          maxv = SHRT_MAX;
+        }
+        Double sv = std::max (minv, ceil(st[j]));
+        Double ev = std::min (maxv, floor(end[j]));
+        if (sv > ev) {
+          continue;
+        }
+        switch (dtype) {
+        case TpInt:
+          lower.define (columnName, Int(sv));
+          upper.define (columnName, Int(ev));
+          break;
+        case TpUInt:
+          lower.define (columnName, uInt(sv));
+          upper.define (columnName, uInt(ev));
+          break;
+        case TpShort:
+          lower.define (columnName, Short(sv));
+          upper.define (columnName, Short(ev));
+          break;
+        default:
+          lower.define (columnName, uChar(sv));
+          upper.define (columnName, uChar(ev));
+          break;
+        }
+      }
+      Vector<uInt> inxRows = colInx.getRowNumbers (True, True);
+      rows.insert (rows.end(), inxRows.begin(), inxRows.end());
+    }
+    // Test the rows in increasing order (as a full WHERE would do).
+    std::sort (rows.begin(), rows.end());
+    rows.erase (std::unique (rows.begin(), rows.end()), rows.end());
+    rownrs.resize (rows.size());
+    std::copy (rows.begin(), rows.end(), rownrs.begin());
+    return True;
+  }
+  return False;
+}
+
+Vector<rownr_t> TableParseSelect::doWhereRows (const Vector<rownr_t>& rownrs,
+                                               rownr_t nrmax)
+{
+  // Evaluate in blocks, so it is possible to stop when nrmax rows are found.
+  const rownr_t blockSize = 4096;
+  Vector<rownr_t> found(rownrs.size());
+  rownr_t nfound = 0;
+  for (rownr_t st=0; st<rownrs.size(); st+=blockSize) {
+    rownr_t nr = std::min (blockSize, rownr_t(rownrs.size()) - st);
+    Vector<rownr_t> blockRows (rownrs(Slice(st, nr)));
+    Vector<Bool> vals;
+    node_p.getBoolVector (blockRows, vals);
+    for (rownr_t j=0; j<nr; ++j) {
+      if (vals[j]) {
+        found[nfound++] = blockRows[j];
+        if (nrmax > 0  &&  nfound >= nrmax) {
+          found.resize (nfound, True);
+          return found;
+        }
+      }
+    }
+  }
+  found.resize (nfound, True);
+  return found;
+}
+
 //# Execute the groupby.
 CountedPtr<TableExprGroupResult> TableParseSelect::doGroupby
 (Bool showTimings, vector<TableExprNodeRep*> aggrNodes, Int groupAggrUsed)
@@ -2234,10 +2466,10 @@ void TableParseSelect::doHaving (Bool showTimings,
   ///                        "HAVING expression (mismatches first table)");
   ///  }
   // Find the rows matching the HAVING expression.
-  Vector<uInt> rownrs(rownrs_p.size());
-  uInt nr = 0;
+  Vector<rownr_t> rownrs(rownrs_p.size());
+  rownr_t nr = 0;
   TableExprIdAggr rowid(groups);
-  for (uInt i=0; i<rownrs_p.size(); ++i) {
+  for (rownr_t i=0; i<rownrs_p.size(); ++i) {
     rowid.setRownr (rownrs_p[i]);
     if (havingNode_p.getBool (rowid)) {
       rownrs[nr++] = rownrs_p[i];
@@ -2268,41 +2500,71 @@ CountedPtr<TableExprGroupResult> TableParseSelect::doOnlyCountAll
   // The nr of rows is the result of count(*), so simply set it.
   func.setResult (rownrs_p.size());
   // The resulting table has only 1 group; use the last row with it.
-  rownrs_p.reference (Vector<uInt>(1, rownrs_p[rownrs_p.size()-1]));
+  rownrs_p.reference (Vector<rownr_t>(1, rownrs_p[rownrs_p.size()-1]));
   // Save the aggregation results in a result object.
   return CountedPtr<TableExprGroupResult>(new TableExprGroupResult(funcSets));
 }
 
-vector<CountedPtr<TableExprGroupFuncSet> >
-TableParseSelect::doGroupByAggrMultipleKeys
-(const vector<TableExprNodeRep*>& aggrNodes)
+void TableParseSelect::doGroupByAggrMultipleKeys
+(const vector<TableExprNodeRep*>& aggrNodes, rownr_t st, rownr_t end,
+ vector<CountedPtr<TableExprGroupFuncSet> >& funcSets,
+ std::map<TableExprGroupKeySet, int>& keyFuncMap)
 {
   // We have to group the data according to the (maybe empty) groupby.
   // We step through the table in the normal order which may not be the
   // groupby order.
   // A map<key,int> is used to keep track of the results where the int
   // is the index in a vector of a set of aggregate function objects.
-  vector<CountedPtr<TableExprGroupFuncSet> > funcSets;
-  std::map<TableExprGroupKeySet, int> keyFuncMap;
   // Create the set of groupby key objects.
   TableExprGroupKeySet keySet(groupbyNodes_p);
   // Loop through all rows.
   // For each row generate the key to get the right entry.
   TableExprId rowid(0);
-  for (uInt i=0; i<rownrs_p.size(); ++i) {
+  for (rownr_t i=st; i<end; ++i) {
     rowid.setRownr (rownrs_p[i]);
     keySet.fill (groupbyNodes_p, rowid);
     int groupnr = funcSets.size();
     std::map<TableExprGroupKeySet, int>::iterator iter=keyFuncMap.find (keySet);
     if (iter == keyFuncMap.end()) {
       keyFuncMap[keySet] = groupnr;
-      funcSets.push_back (new TableExprGroupFuncSet (aggrNodes));
+      funcSets.push_back (makeFuncSet (aggrNodes));
     } else {
       groupnr = iter->second;
     }
     funcSets[groupnr]->apply (rowid);
   }
-  return funcSets;
+}
+
+TableExprGroupFuncSet* TableParseSelect::makeFuncSet
+(const vector<TableExprNodeRep*>& aggrNodes)
+{
+  // Creating the function objects is not thread-safe, because an
+  // aggregate node keeps the last function object created.
+  TableExprGroupFuncSet* funcSet;
+#ifdef _OPENMP
+#pragma omp critical(TaQLMakeFuncSet)
+#endif
+  funcSet = new TableExprGroupFuncSet (aggrNodes);
+  return funcSet;
+}
+
+uInt TableParseSelect::groupbyThreads
+(const vector<TableExprNodeRep*>& aggrNodes) const
+{
+  if (nthreads_p <= 1  ||  rownrs_p.size() < nthreads_p) {
+    return 1;
+  }
+  for (uInt i=0; i<groupbyNodes_p.size(); ++i) {
+    if (! groupbyNodes_p[i].getNodeRep()->isThreadSafe()) {
+      return 1;
+    }
+  }
+  // All aggregate functions must be able to merge partial results.
+  TableExprGroupFuncSet funcSet(aggrNodes);
+  if (! funcSet.canMerge()) {
+    return 1;
+  }
+  return nthreads_p;
 }
 
 CountedPtr<TableExprGroupResult> TableParseSelect::doGroupByAggr
@@ -2334,17 +2596,20 @@ CountedPtr<TableExprGroupResult> TableParseSelect::doGroupByAggr
   // Use a faster way for a single groupby key.
   if (groupbyNodes_p.size() == 1  &&
       groupbyNodes_p[0].dataType() == TpDouble) {
-    funcSets = doGroupByAggrSingleKey<Double> (immediateNodes);
+    funcSets = doGroupByAggrKeys<Double>
+      (immediateNodes, &TableParseSelect::doGroupByAggrSingleKey<Double>);
   } else if (groupbyNodes_p.size() == 1  &&
              groupbyNodes_p[0].dataType() == TpInt) {
-    funcSets = doGroupByAggrSingleKey<Int64> (immediateNodes);
+    funcSets = doGroupByAggrKeys<Int64>
+      (immediateNodes, &TableParseSelect::doGroupByAggrSingleKey<Int64>);
   } else {
-    funcSets = doGroupByAggrMultipleKeys (immediateNodes);
+    funcSets = doGroupByAggrKeys<TableExprGroupKeySet>
+      (immediateNodes, &TableParseSelect::doGroupByAggrMultipleKeys);
   }
   // Let the function nodes finish their operation.
   // Form the rownr vector from the rows kept in the aggregate objects.
   // Similarly, form the TableExprId vector if there are lazy nodes.
-  Vector<uInt> rownrs(funcSets.size());
+  Vector<rownr_t> rownrs(funcSets.size());
   vector<CountedPtr<vector<TableExprId> > > ids;
   ids.reserve (funcSets.size());
   uInt n=0;
@@ -2545,8 +2810,8 @@ void TableParseSelect::doSort (Bool showTimings)
       AlwaysAssert (False, AipsError);
     }
   }
-  uInt nrrow = rownrs_p.size();
-  Vector<uInt> newRownrs (nrrow);
+  rownr_t nrrow = rownrs_p.size();
+  Vector<rownr_t> newRownrs (nrrow);
   int sortOpt = Sort::HeapSort;                  
   if (noDupl_p) {
     sortOpt += Sort::NoDuplicates;
@@ -2596,7 +2861,7 @@ void TableParseSelect::doSort (Bool showTimings)
     timer.show ("  Orderby     ");
   }
   // Convert index to rownr.
-  for (uInt i=0; i<newRownrs.size(); ++i) {
+  for (rownr_t i=0; i<newRownrs.size(); ++i) {
     newRownrs[i] = rownrs_p[newRownrs[i]];
   }
   rownrs_p.reference (newRownrs);
@@ -2606,7 +2871,7 @@ void TableParseSelect::doSort (Bool showTimings)
 void TableParseSelect::doLimOff (Bool showTimings)
 {
   Timer timer;
-  Vector<uInt> newRownrs;
+  Vector<rownr_t> newRownrs;
   // Negative values mean from the end (a la Python indexing).
   Int64 nrow = rownrs_p.size();
   if (offset_p < 0) {
@@ -2939,10 +3204,10 @@ Table TableParseSelect::doDistinct (Bool showTimings, const Table& table)
   } else {
     // Get the rownumbers.
     // Make sure it does not reference an internal array.
-    Vector<uInt> rownrs(tabs.rowNumbers(table));
+    Vector<rownr_t> rownrs(tabs.rowNumbers(table));
     rownrs.unique();
     // Put the rownumbers back in the original order.
-    GenSort<uInt>::sort (rownrs);
+    GenSort<rownr_t>::sort (rownrs);
     result = table(rownrs);
     rownrs_p.reference (rownrs);
   }
@@ -2978,8 +3243,8 @@ void TableParseSelect::handleGiving (const TableExprNodeSet& set)
 
 //# Execute all parts of a TaQL command doing some selection.
 void TableParseSelect::execute (Bool showTimings, Bool setInGiving,
-				Bool mustSelect, uInt maxRow,
-                                Bool doTracing)
+				Bool mustSelect, rownr_t maxRow,
+                                Bool doTracing, uInt nthreads)
 {
   //# A selection query consists of:
   //#  - SELECT to do projection
@@ -3009,6 +3274,9 @@ void TableParseSelect::execute (Bool showTimings, Bool setInGiving,
   //# If GROUPBY/aggr is used, all clauses can contain other columns than
   //# aggregate or GROUPBY columns. The last row in a group is used for them.
 
+  //# Array expressions create many temporary arrays with the same shape,
+  //# so let them reuse storage instead of allocating it over and over.
+  BlockPoolScope poolScope;
   //# Set limit if not given.
   if (limit_p == 0) {
     limit_p = maxRow;
@@ -3016,6 +3284,18 @@ void TableParseSelect::execute (Bool showTimings, Bool setInGiving,
       cerr << "LIMIT not given; set to " << limit_p << endl;
     }
   }
+  //# Determine the number of threads to use (0 means all cores).
+  nthreads_p = nthreads;
+#ifdef _OPENMP
+  if (nthreads_p == 0) {
+    nthreads_p = omp_get_max_threads();
+  }
+#else
+  nthreads_p = 1;
+#endif
+  if (doTracing  &&  nthreads_p > 1) {
+    cerr << "Using at most " << nthreads_p << " threads" << endl;
+  }
   //# Give an error if no command part has been given.
   if (mustSelect  &&  commandType_p == PSELECT
   &&  node_p.isNull()  &&  sort_p.size() == 0
@@ -3086,7 +3366,25 @@ void TableParseSelect::execute (Bool showTimings, Bool setInGiving,
 //#//		 << rang[i].end() << endl;
 //#//	}
     Timer timer;
-    resultTable = table(node_p, nrmax);
+    Vector<rownr_t> indexRows;
+    String indexColumn;
+    if (findIndexRows (table, indexRows, indexColumn)) {
+      resultTable = table(doWhereRows (indexRows, nrmax));
+      if (doTracing) {
+        cerr << "WHERE used the index on column " << indexColumn
+             << " to test " << indexRows.size() << " rows" << endl;
+      }
+    } else if (nthreads_p > 1  &&  node_p.dataType() == TpBool  &&
+        node_p.isScalar()  &&  !node_p.getNodeRep()->isConstant()  &&
+        node_p.getNodeRep()->isThreadSafe()  &&
+        !node_p.table().isNull()  &&  node_p.table().nrow() == table.nrow()) {
+      resultTable = table(doWhereParallel (table, nrmax));
+      if (doTracing) {
+        cerr << "WHERE done in parallel" << endl;
+      }
+    } else {
+      resultTable = table(node_p, nrmax);
+    }
     if (showTimings) {
       timer.show ("  Where       ");
     }
@@ -3297,6 +3595,7 @@ TaQLResult tableCommand (const String& str,
 }
 
 //# Do the actual parsing of a command and execute it.
+//# The parse tree is taken from the parse cache if possible.
 TaQLResult tableCommand (const String& str,
 			 const std::vector<const Table*>& tempTables,
 			 Vector<String>& cols,
@@ -3305,32 +3604,10 @@ TaQLResult tableCommand (const String& str,
   commandType = "error";
   // Do the first parse step. It returns a raw parse tree
   // (or throws an exception).
-  Timer timer;
-  TaQLNode tree = TaQLNode::parse(str);
-  // Now process the raw tree and get the final ParseSelect object.
-  try {
-    TaQLNodeHandler treeHandler;
-    TaQLNodeResult res = treeHandler.handleTree (tree, tempTables);
-    const TaQLNodeHRValue& hrval = TaQLNodeHandler::getHR(res);
-    commandType = hrval.getString();
-    TableExprNode expr = hrval.getExpr();
-    if (tree.style().doTiming()) {
-      timer.show (" Total time   ");
-    }
-    if (! expr.isNull()) {
-      return TaQLResult(expr);                 // result of CALC command
-    }
-    //# Copy the possibly selected column names.
-    if (hrval.getNames()) {
-      Vector<String> tmp(*(hrval.getNames()));
-      cols.reference (tmp);
-    } else {
-      cols.resize (0);
-    }
-    return hrval.getTable();
-  } catch (std::exception& x) {
-    throw TableParseError ("'" + str + "'\n  " + x.what());
-  } 
+  TaQLStatement stmt(str);
+  // Now process the raw tree and execute it.
+  return stmt.execute (std::vector<TableExprNode>(), tempTables,
+                       cols, commandType);
 }
 
 } //# NAMESPACE CASACORE - END
@@ -33,8 +33,10 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprDerNode.h>
 #include <casacore/tables/TaQL/TaQLResult.h>
 #include <casacore/tables/TaQL/ExprGroup.h>
+#include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Containers/Block.h>
@@ -144,6 +146,11 @@ private:
 // column names can be returned.
 // Zero or more temporary tables can be used in the command
 // using the $nnn syntax.
+// <br>The raw parse tree of the command is kept in the
+// <linkto class=TaQLParseCache>TaQLParseCache</linkto>, so executing the
+// same command again does not need to parse it again. Use class
+// <linkto class=TaQLStatement>TaQLStatement</linkto> to execute a command
+// with parameters ($nnn in expressions) many times.
 // </synopsis>
 // <group name=tableCommand>
 TaQLResult tableCommand (const String& command);
@@ -383,8 +390,13 @@ public:
   // Optionally the maximum nr of rows to be selected can be given.
   // It will be used as the default value for the LIMIT clause.
   // 0 = no maximum.
+  // The WHERE and GROUPBY parts are executed in parallel if
+  // <src>nthreads</src> differs from 1 (0 means all available cores)
+  // and if the expressions are thread-safe. It is only possible if
+  // compiled with OpenMP.
   void execute (Bool showTimings, Bool setInGiving,
-                Bool mustSelect, uInt maxRow, Bool doTracing=False);
+                Bool mustSelect, rownr_t maxRow, Bool doTracing=False,
+                uInt nthreads=1);
 
   // Execute a query in a from clause resulting in a Table.
   Table doFromQuery (Bool showTimings);
@@ -503,6 +515,9 @@ public:
   // Get the resulting table.
   const Table& getTable() const;
 
+  // Get the tables given in the FROM clause.
+  const vector<TableParse>& getFromTables() const;
+
   // An exception is thrown if the node uses an aggregate function.
   static void checkAggrFuncs (const TableExprNode& node);
 
@@ -528,7 +543,7 @@ private:
   // Rows 0,1,2,.. in UpdTable are updated from the expression result
   // for the rows in the given rownrs vector.
   void doUpdate (Bool showTimings, const Table& origTable,
-                 Table& updTable, const Vector<uInt>& rownrs,
+                 Table& updTable, const Vector<rownr_t>& rownrs,
                  const CountedPtr<TableExprGroupResult>& groups =
                  CountedPtr<TableExprGroupResult>());
 
@@ -566,6 +581,21 @@ private:
   // It returns the Table containing the subset of rows in the input Table.
   Table adjustApplySelNodes (const Table&);
 
+  // Evaluate the WHERE expression in parallel for blocks of rows.
+  // It returns the numbers of the matching rows (at most nrmax if > 0).
+  Vector<rownr_t> doWhereParallel (const Table&, rownr_t nrmax);
+
+  // Find the rows possibly matching the WHERE expression using a
+  // persistent index (see class ColumnsIndex) on a column compared with
+  // constants in the expression.
+  // It returns False if no such index can be used.
+  Bool findIndexRows (const Table&, Vector<rownr_t>& rownrs,
+                      String& columnName);
+
+  // Evaluate the WHERE expression for the given rows (in increasing order).
+  // It returns the numbers of the matching rows (at most nrmax if > 0).
+  Vector<rownr_t> doWhereRows (const Vector<rownr_t>& rownrs, rownr_t nrmax);
+
   // Do the groupby/aggregate step and return its result.
   CountedPtr<TableExprGroupResult> doGroupby
   (bool showTimings, vector<TableExprNodeRep*> aggrNodes,
@@ -598,12 +628,12 @@ private:
   // Update the values in the columns (helpers of doUpdate).
   // <group>
   template<typename TCOL, typename TNODE>
-  void updateValue2 (uInt row, const TableExprId& rowid, Bool isScalarCol,
+  void updateValue2 (rownr_t row, const TableExprId& rowid, Bool isScalarCol,
                      const TableExprNode& node, TableColumn& col,
                      const Slicer* slicerPtr,
                      IPosition& blc, IPosition& trc, IPosition& inc);
   template<typename T>
-  void updateValue1 (uInt row, const TableExprId& rowid, Bool isScalarCol,
+  void updateValue1 (rownr_t row, const TableExprId& rowid, Bool isScalarCol,
                      const TableExprNode& node, TableColumn& col,
                      const Slicer* slicerPtr,
                      IPosition& blc, IPosition& trc, IPosition& inc);
@@ -677,24 +707,26 @@ private:
   // Create the set of aggregate functions and groupby keys in case
   // a single groupby key is given.
   // This offers much faster map access then doGroupByAggrMultiple.
+  // The rows st till end in rownrs_p are used; the groups found are added
+  // to funcSets and keyFuncMap.
   template<typename T>
-  vector<CountedPtr<TableExprGroupFuncSet> > doGroupByAggrSingleKey
-  (const vector<TableExprNodeRep*>& aggrNodes)
+  void doGroupByAggrSingleKey
+  (const vector<TableExprNodeRep*>& aggrNodes, rownr_t st, rownr_t end,
+   vector<CountedPtr<TableExprGroupFuncSet> >& funcSets,
+   std::map<T, int>& keyFuncMap)
   {
     // We have to group the data according to the (possibly empty) groupby.
     // We step through the table in the normal order which may not be the
     // groupby order.
     // A map<key,int> is used to keep track of the results where the int
     // is the index in a vector of a set of aggregate function objects.
-    vector<CountedPtr<TableExprGroupFuncSet> > funcSets;
-    std::map<T, int> keyFuncMap;
     T lastKey = std::numeric_limits<Double>::max();
     int groupnr = -1;
     // Loop through all rows.
     // For each row generate the key to get the right entry.
     TableExprId rowid(0);
     T key;
-    for (uInt i=0; i<rownrs_p.size(); ++i) {
+    for (rownr_t i=st; i<end; ++i) {
       rowid.setRownr (rownrs_p[i]);
       groupbyNodes_p[0].get (rowid, key);
       if (key != lastKey) {
@@ -702,7 +734,7 @@ private:
         if (iter == keyFuncMap.end()) {
           groupnr = funcSets.size();
           keyFuncMap[key] = groupnr;
-          funcSets.push_back (new TableExprGroupFuncSet (aggrNodes));
+          funcSets.push_back (makeFuncSet (aggrNodes));
         } else {
           groupnr = iter->second;
         }
@@ -710,14 +742,93 @@ private:
       rowid.setRownr (rownrs_p[i]);
       funcSets[groupnr]->apply (rowid);
     }
-    return funcSets;
   }
 
   // Create the set of aggregate functions and groupby keys in case
   // multiple keys are given.
-  vector<CountedPtr<TableExprGroupFuncSet> > doGroupByAggrMultipleKeys
+  void doGroupByAggrMultipleKeys
+  (const vector<TableExprNodeRep*>& aggrNodes, rownr_t st, rownr_t end,
+   vector<CountedPtr<TableExprGroupFuncSet> >& funcSets,
+   std::map<TableExprGroupKeySet, int>& keyFuncMap);
+
+  // Create a new set of aggregate function objects.
+  // It is thread-safe.
+  static TableExprGroupFuncSet* makeFuncSet
   (const vector<TableExprNodeRep*>& aggrNodes);
 
+  // Determine the number of threads to use for the aggregation.
+  // It returns 1 if the groupby keys or aggregate functions do not support
+  // parallel aggregation.
+  uInt groupbyThreads (const vector<TableExprNodeRep*>& aggrNodes) const;
+
+  // Create the set of aggregate functions using the given function
+  // (doGroupByAggrSingleKey or doGroupByAggrMultipleKeys) to do the
+  // aggregation for a part of the rows.
+  // If possible, the rows are split in parts which are aggregated in
+  // parallel, whereafter the partial results are merged in row order.
+  template<typename T>
+  vector<CountedPtr<TableExprGroupFuncSet> > doGroupByAggrKeys
+  (const vector<TableExprNodeRep*>& aggrNodes,
+   void (TableParseSelect::*aggrFunc)
+   (const vector<TableExprNodeRep*>&, rownr_t, rownr_t,
+    vector<CountedPtr<TableExprGroupFuncSet> >&, std::map<T, int>&))
+  {
+    vector<CountedPtr<TableExprGroupFuncSet> > funcSets;
+    std::map<T, int> keyFuncMap;
+    rownr_t nrow = rownrs_p.size();
+    uInt nthr = groupbyThreads (aggrNodes);
+    if (nthr <= 1) {
+      (this->*aggrFunc) (aggrNodes, 0, nrow, funcSets, keyFuncMap);
+      return funcSets;
+    }
+    vector<vector<CountedPtr<TableExprGroupFuncSet> > > partSets(nthr);
+    vector<std::map<T, int> > partMaps(nthr);
+    vector<String> errors(nthr);
+    // Let the threads read the columns concurrently if possible.
+    vector<TableExprNodeRep*> exprNodes(aggrNodes);
+    for (uInt i=0; i<groupbyNodes_p.size(); ++i) {
+      exprNodes.push_back
+        (const_cast<TableExprNodeRep*>(groupbyNodes_p[i].getNodeRep()));
+    }
+    TableExprColumnThreads colThreads (exprNodes, nthr);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthr)
+#endif
+    for (Int i=0; i<Int(nthr); ++i) {
+      // An exception cannot be thrown out of a parallel loop.
+      try {
+        (this->*aggrFunc) (aggrNodes, nrow*i/nthr, nrow*(i+1)/nthr,
+                           partSets[i], partMaps[i]);
+      } catch (std::exception& x) {
+        errors[i] = x.what();
+      }
+    }
+    for (uInt i=0; i<nthr; ++i) {
+      if (! errors[i].empty()) {
+        throw TableInvExpr (errors[i]);
+      }
+    }
+    // Merge the groups of the parts in order, so the groups are in the
+    // same order as when aggregating sequentially.
+    for (uInt i=0; i<nthr; ++i) {
+      vector<const T*> keys(partSets[i].size());
+      for (typename std::map<T, int>::const_iterator iter=partMaps[i].begin();
+           iter!=partMaps[i].end(); ++iter) {
+        keys[iter->second] = &(iter->first);
+      }
+      for (uInt j=0; j<keys.size(); ++j) {
+        typename std::map<T, int>::iterator iter = keyFuncMap.find (*keys[j]);
+        if (iter == keyFuncMap.end()) {
+          keyFuncMap[*keys[j]] = funcSets.size();
+          funcSets.push_back (partSets[i][j]);
+        } else {
+          funcSets[iter->second]->merge (*partSets[i][j]);
+        }
+      }
+    }
+    return funcSets;
+  }
+
   //# Command type.
   CommandType commandType_p;
   //# Table description for a series of column descriptions.
@@ -785,7 +896,9 @@ private:
   Block<uInt>  projectExprSubset_p;
   Block<Bool>  projectExprSelColumn_p;
   //# The resulting row numbers.
-  Vector<uInt> rownrs_p;
+  Vector<rownr_t> rownrs_p;
+  //# The number of threads to use for WHERE and GROUPBY.
+  uInt nthreads_p;
 };
 
 
@@ -830,6 +943,9 @@ inline const Block<String>& TableParseSelect::getColumnNames() const
 inline const Table& TableParseSelect::getTable() const
   { return table_p; }
 
+inline const vector<TableParse>& TableParseSelect::getFromTables() const
+  { return fromTables_p; }
+
 inline void TableParseSelect::addUpdate (TableParseUpdate* upd)
   { update_p.push_back (upd); }
 
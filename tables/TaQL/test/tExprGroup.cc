@@ -60,6 +60,53 @@ Bool foundError = False;
   }\
 }
 
+// Check that merging the partial results of the two halves of the records
+// gives the same result as aggregating all records at once.
+// This is done when aggregating in parallel.
+void checkMerge (TableExprAggrNode& aggr, const vector<Record>& recs,
+                 const String& str)
+{
+  CountedPtr<TableExprGroupFuncBase> func = aggr.makeGroupAggrFunc();
+  if (! func->canMerge()) {
+    return;
+  }
+  CountedPtr<TableExprGroupFuncBase> func1 = aggr.makeGroupAggrFunc();
+  CountedPtr<TableExprGroupFuncBase> func2 = aggr.makeGroupAggrFunc();
+  for (uInt i=0; i<recs.size(); ++i) {
+    TableExprId id(recs[i]);
+    func->apply (id);
+    if (i < recs.size()/2) {
+      func1->apply (id);
+    } else {
+      func2->apply (id);
+    }
+  }
+  func1->merge (*func2);
+  func->finish();
+  func1->finish();
+  Bool ok = True;
+  switch (aggr.dataType()) {
+  case TableExprNodeRep::NTBool:
+    ok = (func->getBool() == func1->getBool());
+    break;
+  case TableExprNodeRep::NTInt:
+    ok = (func->getInt() == func1->getInt());
+    break;
+  case TableExprNodeRep::NTDouble:
+    ok = near (func->getDouble(), func1->getDouble(), 1.e-10);
+    break;
+  case TableExprNodeRep::NTComplex:
+    ok = near (func->getDComplex(), func1->getDComplex(), 1.e-10);
+    break;
+  default:
+    break;
+  }
+  if (!ok) {
+    foundError = True;
+    cout << str << ": merged result differs" << endl;
+  }
+}
+
 void check (const TableExprNode& expr,
             const vector<Record>& recs,
             Bool expVal, const String& str)
@@ -80,6 +127,7 @@ void check (const TableExprNode& expr,
     cout << str << ": found value " << val << "; expected "
          << expVal << endl;
   }
+  checkMerge (aggr, recs, str);
 }
 
 void check (const TableExprNode& expr,
@@ -102,6 +150,7 @@ void check (const TableExprNode& expr,
     cout << str << ": found value " << val << "; expected "
          << expVal << endl;
   }
+  checkMerge (aggr, recs, str);
 }
 
 void check (const TableExprNode& expr,
@@ -124,6 +173,7 @@ void check (const TableExprNode& expr,
     cout << str << ": found value " << val << "; expected "
          << expVal << endl;
   }
+  checkMerge (aggr, recs, str);
 }
 
 void check (const TableExprNode& expr,
@@ -146,6 +196,7 @@ void check (const TableExprNode& expr,
     cout << str << ": found value " << val << "; expected "
          << expVal << endl;
   }
+  checkMerge (aggr, recs, str);
 }
 
 void checkLazy (const TableExprNode& expr,
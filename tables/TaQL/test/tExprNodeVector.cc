@@ -0,0 +1,196 @@
+//# tExprNodeVector.cc: Test program for evaluating expressions for a block of rows
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for evaluating expressions for a block of rows at once.
+// The results are compared with evaluating the expressions row by row.
+// </summary>
+
+Table makeTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int> ("ci"));
+  td.addColumn (ScalarColumnDesc<Short> ("cs"));
+  td.addColumn (ScalarColumnDesc<Float> ("cf"));
+  td.addColumn (ScalarColumnDesc<Double> ("cd"));
+  td.addColumn (ScalarColumnDesc<Bool> ("cb"));
+  td.rwColumnDesc("cd").rwKeywordSet().define ("QuantumUnits",
+                                               Vector<String>(1, "m"));
+  SetupNewTable newtab ("tExprNodeVector_tmp.data", td, Table::Scratch);
+  Table tab (newtab, Table::Memory, nrow);
+  ScalarColumn<Int> ci (tab, "ci");
+  ScalarColumn<Short> cs (tab, "cs");
+  ScalarColumn<Float> cf (tab, "cf");
+  ScalarColumn<Double> cd (tab, "cd");
+  ScalarColumn<Bool> cb (tab, "cb");
+  for (uInt i=0; i<nrow; ++i) {
+    ci.put (i, i%13);
+    cs.put (i, i%7 - 3);
+    cf.put (i, i*0.5);
+    cd.put (i, i*0.25 - 5);
+    cb.put (i, i%3 == 0);
+  }
+  return tab;
+}
+
+// Check that evaluating a Bool expression for a block of rows gives
+// the same result as row by row.
+void checkBool (const TableExprNode& expr, const Vector<rownr_t>& rownrs)
+{
+  Vector<Bool> vals;
+  expr.getBoolVector (rownrs, vals);
+  AlwaysAssertExit (vals.size() == rownrs.size());
+  for (uInt i=0; i<rownrs.size(); ++i) {
+    AlwaysAssertExit (vals[i] == expr.getBool (rownrs[i]));
+  }
+}
+
+void checkInt (const TableExprNode& expr, const Vector<rownr_t>& rownrs)
+{
+  Vector<Int64> vals;
+  expr.getIntVector (rownrs, vals);
+  AlwaysAssertExit (vals.size() == rownrs.size());
+  for (uInt i=0; i<rownrs.size(); ++i) {
+    AlwaysAssertExit (vals[i] == expr.getInt (rownrs[i]));
+  }
+  // An integer expression can also be evaluated as double.
+  Vector<Double> dvals;
+  expr.getDoubleVector (rownrs, dvals);
+  for (uInt i=0; i<rownrs.size(); ++i) {
+    AlwaysAssertExit (dvals[i] == Double(vals[i]));
+  }
+}
+
+void checkDouble (const TableExprNode& expr, const Vector<rownr_t>& rownrs)
+{
+  Vector<Double> vals;
+  expr.getDoubleVector (rownrs, vals);
+  AlwaysAssertExit (vals.size() == rownrs.size());
+  for (uInt i=0; i<rownrs.size(); ++i) {
+    AlwaysAssertExit (vals[i] == expr.getDouble (rownrs[i]));
+  }
+}
+
+void doTest (const Table& tab, const Vector<rownr_t>& rownrs)
+{
+  TableExprNode ci = tab.col("ci");
+  TableExprNode cs = tab.col("cs");
+  TableExprNode cf = tab.col("cf");
+  TableExprNode cd = tab.col("cd");
+  TableExprNode cb = tab.col("cb");
+  // Column and constant nodes.
+  checkInt (ci, rownrs);
+  checkInt (cs, rownrs);
+  checkDouble (cf, rownrs);
+  checkDouble (cd, rownrs);
+  checkBool (cb, rownrs);
+  checkInt (TableExprNode(Int64(3)), rownrs);
+  checkDouble (TableExprNode(2.5), rownrs);
+  checkBool (TableExprNode(True), rownrs);
+  // Arithmetic.
+  checkInt (ci + 2*cs, rownrs);
+  checkInt (ci - cs*cs, rownrs);
+  checkDouble (cd - cf, rownrs);
+  checkDouble (cd * cf + ci, rownrs);
+  checkDouble (cf / (ci+1), rownrs);
+  // Unit conversion.
+  TableExprNode cdcm (cd);
+  cdcm.adaptUnit ("cm");
+  checkDouble (cdcm + 1, rownrs);
+  // Comparisons.
+  checkBool (ci == 3, rownrs);
+  checkBool (ci != cs, rownrs);
+  checkBool (ci > cs+3, rownrs);
+  checkBool (ci >= 5, rownrs);
+  checkBool (cd == cf, rownrs);
+  checkBool (cd != 0., rownrs);
+  checkBool (cf > cd, rownrs);
+  checkBool (cf >= ci, rownrs);
+  checkBool (ci < cd, rownrs);
+  checkBool (cd <= 10., rownrs);
+  // Logical operators.
+  checkBool (ci > 5  &&  cd < 20., rownrs);
+  checkBool (cb  ||  cf > 30., rownrs);
+  checkBool ((ci > 5  &&  !cb)  ||  cs == 0, rownrs);
+  checkBool (!(ci > 100)  &&  cb, rownrs);
+  // A node without a vectorized version (a function).
+  checkDouble (sqrt(cf) + cd, rownrs);
+  checkBool (near(cf, cd), rownrs);
+}
+
+int main()
+{
+  try {
+    Table tab = makeTable (10000);
+    // Test all rows and an arbitrary subset of rows.
+    Vector<rownr_t> rownrs(tab.nrow());
+    indgen (rownrs);
+    doTest (tab, rownrs);
+    Vector<rownr_t> subset(100);
+    for (uInt i=0; i<subset.size(); ++i) {
+      subset[i] = (i*37) % tab.nrow();
+    }
+    doTest (tab, subset);
+    // A selection (which uses block evaluation) must match the rows
+    // for which the expression is true.
+    TableExprNode expr = (tab.col("ci") > 5  &&  tab.col("cd") < 1000.)  ||
+                         tab.col("cb");
+    Table sel = tab(expr);
+    Vector<rownr_t> rows = sel.rowNumbers();
+    uInt nr = 0;
+    for (uInt i=0; i<tab.nrow(); ++i) {
+      if (expr.getBool(i)) {
+        AlwaysAssertExit (rows[nr] == i);
+        nr++;
+      }
+    }
+    AlwaysAssertExit (sel.nrow() == nr);
+    // Test selection with a maximum number of rows and an offset
+    // (which is the number of matching rows to skip).
+    Table sel2 = tab(expr, 20, 3000);
+    AlwaysAssertExit (sel2.nrow() == 20);
+    AlwaysAssertExit (allEQ (sel2.rowNumbers(), rows(Slice(3000, 20))));
+  } catch (AipsError& x) {
+    cout << "Unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,190 @@
+//# tTaQLStatement.cc: Test program for prepared TaQL statements and the parse cache
+//# Copyright (C) 2016
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#include <casacore/tables/TaQL/TaQLStatement.h>
+#include <casacore/tables/TaQL/TaQLParseCache.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+// <summary>
+// Test program for prepared TaQL statements with parameters and
+// for the cache of parsed TaQL commands.
+// </summary>
+
+void makeTable (uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int> ("ci"));
+  td.addColumn (ScalarColumnDesc<Double> ("cd"));
+  td.addColumn (ScalarColumnDesc<String> ("cs"));
+  SetupNewTable newtab ("tTaQLStatement_tmp.data", td, Table::New);
+  Table tab (newtab, nrow);
+  ScalarColumn<Int> ci (tab, "ci");
+  ScalarColumn<Double> cd (tab, "cd");
+  ScalarColumn<String> cs (tab, "cs");
+  for (uInt i=0; i<nrow; ++i) {
+    ci.put (i, i%10);
+    cd.put (i, i*0.5);
+    cs.put (i, "s" + String::toString(i%3));
+  }
+}
+
+// Compare the result of a statement with parameters with the same
+// command with the values filled in.
+void compare (TaQLStatement& stmt, const std::vector<TableExprNode>& params,
+              const String& command)
+{
+  Table t1 = stmt.execute(params).table();
+  Table t2 = tableCommand(command).table();
+  AlwaysAssertExit (t1.nrow() == t2.nrow());
+  AlwaysAssertExit (allEQ (t1.rowNumbers(), t2.rowNumbers()));
+}
+
+void testParams()
+{
+  TaQLStatement stmt ("select from tTaQLStatement_tmp.data"
+                      " where ci=$1 && cd<$2");
+  for (Int i=0; i<10; ++i) {
+    std::vector<TableExprNode> params(2);
+    params[0] = i;
+    params[1] = 10.*i;
+    compare (stmt, params,
+             "select from tTaQLStatement_tmp.data where ci=" +
+             String::toString(i) + " && cd<" + String::toString(10.*i));
+  }
+  // The table is kept open by the statement.
+  AlwaysAssertExit (stmt.usedTables().size() == 1);
+  AlwaysAssertExit (stmt.usedTables()[0].nrow() == 100);
+  stmt.releaseTables();
+  AlwaysAssertExit (stmt.usedTables().empty());
+  // Use a string parameter and parameters in a BETWEEN.
+  TaQLStatement stmt2 ("select from tTaQLStatement_tmp.data"
+                       " where cs=$1 && ci between $2 and $3");
+  std::vector<TableExprNode> params(3);
+  params[0] = "s1";
+  params[1] = 2;
+  params[2] = 5;
+  compare (stmt2, params, "select from tTaQLStatement_tmp.data"
+           " where cs='s1' && ci between 2 and 5");
+  // In the FROM clause $1 is still a temporary table.
+  Table tab("tTaQLStatement_tmp.data");
+  std::vector<const Table*> tempTables(1, &tab);
+  TaQLStatement stmt3 ("select from $1 where ci<$1");
+  std::vector<TableExprNode> params3(1, TableExprNode(Int(3)));
+  Vector<String> cols;
+  String type;
+  Table t3 = stmt3.execute(params3, tempTables, cols, type).table();
+  AlwaysAssertExit (type == "select");
+  AlwaysAssertExit (t3.nrow() == 30);
+  // A CALC command with a parameter.
+  TaQLStatement stmt4 ("calc $1 + $2");
+  std::vector<TableExprNode> params4(2);
+  params4[0] = 3;
+  params4[1] = 4.5;
+  AlwaysAssertExit (stmt4.execute(params4).node().getDouble(0) == 7.5);
+  // Missing parameters must give an exception.
+  Bool failed = False;
+  try {
+    stmt4.execute (std::vector<TableExprNode>(1, TableExprNode(Int(1))));
+  } catch (const TableParseError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  failed = False;
+  try {
+    tableCommand ("select from tTaQLStatement_tmp.data where ci=$1");
+  } catch (const TableParseError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+void testCache()
+{
+  TaQLParseCache& cache = TaQLParseCache::global();
+  cache.setMaxSize (2);
+  cache.clear();
+  String cmd1 ("select from tTaQLStatement_tmp.data where ci=1");
+  String cmd2 ("select ci,gcount() from tTaQLStatement_tmp.data groupby ci");
+  String cmd3 ("using style python select from tTaQLStatement_tmp.data"
+               " where ci in [1:4]");
+  // First time a command is parsed, thereafter taken from the cache.
+  // The results must be the same.
+  for (uInt i=0; i<2; ++i) {
+    AlwaysAssertExit (tableCommand(cmd1).table().nrow() == 10);
+    // The GROUPBY node must be restored correctly.
+    AlwaysAssertExit (tableCommand(cmd2).table().nrow() == 10);
+  }
+  AlwaysAssertExit (cache.size() == 2);
+  AlwaysAssertExit (cache.nmisses() == 2);
+  AlwaysAssertExit (cache.nhits() == 2);
+  // The style must be kept (python style has an exclusive end).
+  AlwaysAssertExit (tableCommand(cmd3).table().nrow() == 30);
+  AlwaysAssertExit (tableCommand(cmd3).table().nrow() == 30);
+  AlwaysAssertExit (cache.nhits() == 3);
+  // cmd1 is least recently used, so has been removed.
+  AlwaysAssertExit (cache.size() == 2);
+  AlwaysAssertExit (tableCommand(cmd2).table().nrow() == 10);
+  AlwaysAssertExit (cache.nhits() == 4);
+  AlwaysAssertExit (tableCommand(cmd1).table().nrow() == 10);
+  AlwaysAssertExit (cache.nmisses() == 4);
+  // A statement also uses the cache.
+  TaQLStatement stmt(cmd1);
+  AlwaysAssertExit (cache.nhits() == 5);
+  AlwaysAssertExit (stmt.execute().table().nrow() == 10);
+  cache.showStatistics (cout);
+  // A size 0 disables the cache.
+  cache.setMaxSize (0);
+  AlwaysAssertExit (cache.size() == 0);
+  AlwaysAssertExit (tableCommand(cmd1).table().nrow() == 10);
+  AlwaysAssertExit (cache.size() == 0);
+}
+
+int main()
+{
+  try {
+    makeTable (100);
+    testParams();
+    testCache();
+  } catch (AipsError& x) {
+    cout << "Unexpected exception: " << x.getMesg() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -306,7 +306,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //     ArrayColumn<Float> arr2Col (tab, "arr2");
 //
 //     // Loop through all rows in the table.
-//     uInt nrrow = tab.nrow();
+//     rownr_t nrrow = tab.nrow();
 //     for (uInt i=0; i<nrow; i++) {
 //         // Read the row for both columns.
 //         cout << "Column ac in row i = " << acCol(i) << endl;
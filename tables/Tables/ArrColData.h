@@ -130,7 +130,7 @@ public:
 
     // Initialize the rows from startRownr till endRownr (inclusive)
     // with the default value defined in the column description (if defined).
-    void initialize (uInt startRownr, uInt endRownr);
+    void initialize (rownr_t startRownr, rownr_t endRownr);
 
     // Get the global #dimensions of an array (ie. for all rows).
     uInt ndimColumn() const;
@@ -144,32 +144,32 @@ public:
 
     // Get the #dimensions of an array in a particular cell.
     // If the cell does not contain an array, 0 is returned.
-    uInt ndim (uInt rownr) const;
+    uInt ndim (rownr_t rownr) const;
 
     // Get the shape of an array in a particular cell.
     // If the cell does not contain an array, an empty IPosition is returned.
-    IPosition shape(uInt rownr) const;
+    IPosition shape(rownr_t rownr) const;
 
     // Set dimensions of array in a particular cell.
     // <group>
-    void setShape (uInt rownr, const IPosition& shape);
+    void setShape (rownr_t rownr, const IPosition& shape);
     // The shape of tiles in the array can also be defined.
-    void setShape (uInt rownr, const IPosition& shape,
+    void setShape (rownr_t rownr, const IPosition& shape,
 		   const IPosition& tileShape);
     // </group>
 
     // Test if the given cell contains an array.
-    Bool isDefined (uInt rownr) const;
+    Bool isDefined (rownr_t rownr) const;
 
     // Get the array from a particular cell.
     // The length of the buffer pointed to by arrayPtr must match
     // the actual length. This is checked by ArrayColumn.
-    void get (uInt rownr, void* arrayPtr) const;
+    void get (rownr_t rownr, void* arrayPtr) const;
 
     // Get a slice of an N-dimensional array in a particular cell.
     // The length of the buffer pointed to by arrayPtr must match
     // the actual length. This is checked by ArrayColumn.
-    void getSlice (uInt rownr, const Slicer&, void* arrayPtr) const;
+    void getSlice (rownr_t rownr, const Slicer&, void* arrayPtr) const;
 
     // Get the array of all values in a column.
     // If the column contains n-dim arrays, the resulting array is (n+1)-dim.
@@ -203,12 +203,12 @@ public:
     // Put the value in a particular cell.
     // The length of the buffer pointed to by arrayPtr must match
     // the actual length. This is checked by ArrayColumn.
-    void put (uInt rownr, const void* arrayPtr);
+    void put (rownr_t rownr, const void* arrayPtr);
 
     // Put a slice of an N-dimensional array in a particular cell.
     // The length of the buffer pointed to by arrayPtr must match
     // the actual length. This is checked by ArrayColumn.
-    void putSlice (uInt rownr, const Slicer&, const void* arrayPtr);
+    void putSlice (rownr_t rownr, const Slicer&, const void* arrayPtr);
 
     // Put the array of all values in the column.
     // If the column contains n-dim arrays, the source array is (n+1)-dim.
@@ -157,7 +157,7 @@ void ArrayColumn<T>::checkShape (const IPosition& shp,
 }
 
 template<class T>
-Array<T> ArrayColumn<T>::operator() (uInt rownr) const
+Array<T> ArrayColumn<T>::operator() (rownr_t rownr) const
 {
     Array<T> arr;
     get (rownr, arr);
@@ -165,7 +165,7 @@ Array<T> ArrayColumn<T>::operator() (uInt rownr) const
 }
 
 template<class T>
-Array<T> ArrayColumn<T>::get (uInt rownr) const
+Array<T> ArrayColumn<T>::get (rownr_t rownr) const
 {
     Array<T> arr;
     get (rownr, arr);
@@ -173,7 +173,7 @@ Array<T> ArrayColumn<T>::get (uInt rownr) const
 }
 
 template<class T>
-void ArrayColumn<T>::get (uInt rownr, Array<T>& arr, Bool resize) const
+void ArrayColumn<T>::get (rownr_t rownr, Array<T>& arr, Bool resize) const
 {
     TABLECOLUMNCHECKROW(rownr);
     // Check array conformance and resize if needed and possible.
@@ -183,7 +183,7 @@ void ArrayColumn<T>::get (uInt rownr, Array<T>& arr, Bool resize) const
 
 
 template<class T>
-Array<T> ArrayColumn<T>::getSlice (uInt rownr,
+Array<T> ArrayColumn<T>::getSlice (rownr_t rownr,
                                    const Slicer& arraySection) const
 {
     Array<T> arr;
@@ -192,7 +192,7 @@ Array<T> ArrayColumn<T>::getSlice (uInt rownr,
 }
 
 template<class T>
-void ArrayColumn<T>::getSlice (uInt rownr, const Slicer& arraySection,
+void ArrayColumn<T>::getSlice (rownr_t rownr, const Slicer& arraySection,
                                Array<T>& arr, Bool resize) const
                                {
     TABLECOLUMNCHECKROW(rownr);
@@ -231,7 +231,7 @@ void ArrayColumn<T>::getSlice (uInt rownr, const Slicer& arraySection,
 
 template<class T>
 Array<T> ArrayColumn<T>::getSlice
-(uInt rownr, const Vector<Vector<Slice> >& arraySlices) const
+(rownr_t rownr, const Vector<Vector<Slice> >& arraySlices) const
 {
     Array<T> arr;
     getSlice (rownr, arraySlices, arr);
@@ -239,7 +239,7 @@ Array<T> ArrayColumn<T>::getSlice
 }
 
 template<class T>
-void ArrayColumn<T>::getSlice (uInt rownr,
+void ArrayColumn<T>::getSlice (rownr_t rownr,
                                const Vector<Vector<Slice> >& arraySlices,
                                Array<T>& arr, Bool resize) const
 {
@@ -297,7 +297,7 @@ ArrayColumn<T>::getColumnCells (const RefRows & rows,
    }
 
    uInt nSlicers = dataSlicers.size();
-   uInt nRows = rows.nrows();
+   rownr_t nRows = rows.nrows();
 
    for (uInt i = 0; i < nRows; i++){
 
@@ -409,7 +409,7 @@ Array<T> ArrayColumn<T>::getColumn() const
 template<class T>
 void ArrayColumn<T>::getColumn (Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     //# Take shape of array in first row.
     IPosition shp;
     if (nrrow > 0) {
@@ -431,7 +431,7 @@ void ArrayColumn<T>::getColumn (Array<T>& arr, Bool resize) const
 	baseColPtr_p->getArrayColumn (&arr);
       }else{
         ArrayIterator<T> iter(arr, arr.ndim()-1);
-        for (uInt rownr=0; rownr<nrrow; rownr++) {
+        for (rownr_t rownr=0; rownr<nrrow; rownr++) {
           Array<T>& darr = iter.array();
           if (! darr.shape().isEqual (baseColPtr_p->shape (rownr))) {
             throw TableArrayConformanceError
@@ -459,7 +459,7 @@ template<class T>
 void ArrayColumn<T>::getColumn (const Slicer& arraySection,
                                 Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     //# Use shape of array in first row.
     IPosition shp, blc,trc,inc;
     if (nrrow > 0) {
@@ -482,7 +482,7 @@ void ArrayColumn<T>::getColumn (const Slicer& arraySection,
         baseColPtr_p->getColumnSlice (defSlicer, &arr);
       }else{
         ArrayIterator<T> iter(arr, arr.ndim()-1);
-        for (uInt rownr=0; rownr<nrrow; rownr++) {
+        for (rownr_t rownr=0; rownr<nrrow; rownr++) {
           getSlice (rownr, defSlicer, iter.array());
           iter.next();
         }
@@ -504,7 +504,7 @@ template<class T>
 void ArrayColumn<T>::getColumn (const Vector<Vector<Slice> >& arraySlices,
                                 Array<T>& arr, Bool resize) const
 {
-  uInt nrrow = nrow();
+  rownr_t nrrow = nrow();
   // Get total shape.
   // Use shape of first row (if there) as overall array shape.
   IPosition colShp;
@@ -538,7 +538,7 @@ template<class T>
 void ArrayColumn<T>::getColumnRange (const Slicer& rowRange,
                                      Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp, blc, trc, inc;
     shp = rowRange.inferShapeFromSource (IPosition(1,nrrow), blc, trc, inc);
     //# If the entire column is accessed, use that function.
@@ -561,7 +561,7 @@ template<class T>
 void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
                                      Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = rownrs.nrow();
+    rownr_t nrrow = rownrs.nrow();
      //# Take shape of array in first row.
     IPosition arrshp;
     if (nrrow > 0) {
@@ -589,7 +589,7 @@ void ArrayColumn<T>::getColumnRange (const Slicer& rowRange,
                                      const Slicer& arraySection,
                                      Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp, blc, trc, inc;
     shp = rowRange.inferShapeFromSource (IPosition(1,nrrow), blc, trc, inc);
     //# If the entire column is accessed, use that function.
@@ -615,7 +615,7 @@ void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
                                      const Slicer& arraySection,
                                      Array<T>& arr, Bool resize) const
 {
-    uInt nrrow = rownrs.nrow();
+    rownr_t nrrow = rownrs.nrow();
     IPosition arrshp, arrblc, arrtrc, arrinc;
     if (nrrow > 0) {
 	arrshp = arraySection.inferShapeFromSource (shape(rownrs.firstRow()),
@@ -640,9 +640,9 @@ void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
         ArrayIterator<T> iter(arr, arr.ndim()-1);
         RefRowsSliceIter rowsIter(rownrs);
         while (! rowsIter.pastEnd()) {
-          uInt rownr = rowsIter.sliceStart();
-          uInt end   = rowsIter.sliceEnd();
-          uInt incr  = rowsIter.sliceIncr();
+          rownr_t rownr = rowsIter.sliceStart();
+          rownr_t end   = rowsIter.sliceEnd();
+          rownr_t incr  = rowsIter.sliceIncr();
           while (rownr <= end) {
             getSlice (rownr, defSlicer, iter.array());
             iter.next();
@@ -656,7 +656,7 @@ void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
 
 
 template<class T>
-void ArrayColumn<T>::setShape (uInt rownr, const IPosition& shape)
+void ArrayColumn<T>::setShape (rownr_t rownr, const IPosition& shape)
 {
     checkWritable();
     TABLECOLUMNCHECKROW(rownr); 
@@ -675,7 +675,7 @@ void ArrayColumn<T>::setShape (uInt rownr, const IPosition& shape)
 }
 	
 template<class T>
-void ArrayColumn<T>::setShape (uInt rownr, const IPosition& shape,
+void ArrayColumn<T>::setShape (rownr_t rownr, const IPosition& shape,
 			       const IPosition& tileShape)
 {
     checkWritable();
@@ -695,7 +695,7 @@ void ArrayColumn<T>::setShape (uInt rownr, const IPosition& shape,
 }
 	
 template<class T>
-void ArrayColumn<T>::put (uInt rownr, const Array<T>& arr)
+void ArrayColumn<T>::put (rownr_t rownr, const Array<T>& arr)
 {
     checkWritable();
     TABLECOLUMNCHECKROW(rownr); 
@@ -717,7 +717,7 @@ void ArrayColumn<T>::put (uInt rownr, const Array<T>& arr)
 }
 
 template<class T>
-void ArrayColumn<T>::putSlice (uInt rownr, const Slicer& arraySection,
+void ArrayColumn<T>::putSlice (rownr_t rownr, const Slicer& arraySection,
 			       const Array<T>& arr)
 {
     checkWritable();
@@ -748,7 +748,7 @@ void ArrayColumn<T>::putSlice (uInt rownr, const Slicer& arraySection,
 }
 
 template<class T>
-void ArrayColumn<T>::putSlice (uInt rownr,
+void ArrayColumn<T>::putSlice (rownr_t rownr,
                                const Vector<Vector<Slice> >& arraySlices,
 			       const Array<T>& arr)
 {
@@ -814,8 +814,8 @@ void ArrayColumn<T>::putColumnCells (const RefRows & rows,
 }
 
 template<class T>
-void ArrayColumn<T>::put (uInt thisRownr, const TableColumn& that,
-			  uInt thatRownr)
+void ArrayColumn<T>::put (rownr_t thisRownr, const TableColumn& that,
+			  rownr_t thatRownr)
 {
     TableColumn::put (thisRownr, that, thatRownr);
 }
@@ -825,7 +825,7 @@ void ArrayColumn<T>::putColumn (const Array<T>& arr)
 {
     checkWritable();
     //# First check if number of rows matches.
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp  = arr.shape();
     uInt last = shp.nelements() - 1;
     if (shp(last) != Int(nrrow)) {
@@ -861,7 +861,7 @@ void ArrayColumn<T>::putColumn (const Array<T>& arr)
     }else{
         if (arr.nelements() > 0) {
 	    ReadOnlyArrayIterator<T> iter(arr, arr.ndim()-1);
-	    for (uInt rownr=0; rownr<nrrow; rownr++) {
+	    for (rownr_t rownr=0; rownr<nrrow; rownr++) {
 	        baseColPtr_p->put (rownr, &(iter.array()));
 		iter.next();
 	    }
@@ -873,7 +873,7 @@ template<class T>
 void ArrayColumn<T>::putColumn (const Slicer& arraySection, const Array<T>& arr)
 {
     checkWritable();
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     //# First check if number of rows matches.
     IPosition arrshp = arr.shape();
     uInt last = arrshp.nelements() - 1;
@@ -908,7 +908,7 @@ void ArrayColumn<T>::putColumn (const Slicer& arraySection, const Array<T>& arr)
     }else{
         if (arr.nelements() > 0) {
 	    ReadOnlyArrayIterator<T> iter(arr, arr.ndim()-1);
-	    for (uInt rownr=0; rownr<nrrow; rownr++) {
+	    for (rownr_t rownr=0; rownr<nrrow; rownr++) {
 	        putSlice (rownr, arraySection, iter.array());
 		iter.next();
 	    }
@@ -921,7 +921,7 @@ void ArrayColumn<T>::putColumn (const Vector<Vector<Slice> >& arraySlices,
                                 const Array<T>& arr)
 {
   checkWritable();
-  uInt nrrow = nrow();
+  rownr_t nrrow = nrow();
   // Get total shape.
   // Use shape of first row (if there) as overall array shape.
   IPosition colShp;
@@ -951,7 +951,7 @@ template<class T>
 void ArrayColumn<T>::putColumnRange (const Slicer& rowRange,
 				     const Array<T>& arr)
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp, blc, trc, inc;
     shp = rowRange.inferShapeFromSource (IPosition(1,nrrow), blc, trc, inc);
     //# If the entire column is accessed, use that function.
@@ -968,7 +968,7 @@ void ArrayColumn<T>::putColumnCells (const RefRows& rownrs,
 {
     checkWritable();
     //# First check if number of rows matches.
-    uInt nrrow = rownrs.nrow();
+    rownr_t nrrow = rownrs.nrow();
     IPosition arrshp  = arr.shape();
     uInt last = arrshp.nelements() - 1;
     if (arrshp(last) != Int(nrrow)) {
@@ -990,9 +990,9 @@ void ArrayColumn<T>::putColumnCells (const RefRows& rownrs,
 	//# Otherwise set the shape of each cell (as far as needed).
         RefRowsSliceIter iter(rownrs);
         while (! iter.pastEnd()) {
-            uInt rownr = iter.sliceStart();
-            uInt end = iter.sliceEnd();
-            uInt incr = iter.sliceIncr();
+            rownr_t rownr = iter.sliceStart();
+            rownr_t end = iter.sliceEnd();
+            rownr_t incr = iter.sliceIncr();
             while (rownr <= end) {
 		setShape (rownr, arrshp);
 		rownr += incr;
@@ -1009,7 +1009,7 @@ void ArrayColumn<T>::putColumnRange (const Slicer& rowRange,
 				     const Slicer& arraySection,
 				     const Array<T>& arr)
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     IPosition shp, blc, trc, inc;
     shp = rowRange.inferShapeFromSource (IPosition(1,nrrow), blc, trc, inc);
     //# If the entire column is accessed, use that function.
@@ -1027,7 +1027,7 @@ void ArrayColumn<T>::putColumnCells (const RefRows& rownrs,
 {
     checkWritable();
     //# First check if number of rows matches.
-    uInt nrrow = rownrs.nrow();
+    rownr_t nrrow = rownrs.nrow();
     IPosition arrshp = arr.shape();
     uInt last = arrshp.nelements() - 1;
     if (arrshp(last) != Int(nrrow)) {
@@ -1055,8 +1055,8 @@ void ArrayColumn<T>::putColumnCells (const RefRows& rownrs,
 
 
 template<class T>
-void ArrayColumn<T>::put (uInt thisRownr, const ArrayColumn<T>& that,
-			  uInt thatRownr)
+void ArrayColumn<T>::put (rownr_t thisRownr, const ArrayColumn<T>& that,
+			  rownr_t thatRownr)
 {
     put (thisRownr, that(thatRownr));
 }
@@ -1068,7 +1068,7 @@ void ArrayColumn<T>::put (uInt thisRownr, const ArrayColumn<T>& that,
 template<class T>
 void ArrayColumn<T>::fillColumn (const Array<T>& value)
 {
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     for (uInt i=0; i<nrrow; i++) {
 	put (i, value);
     }
@@ -1079,7 +1079,7 @@ void ArrayColumn<T>::putColumn (const ArrayColumn<T>& that)
 {
     checkWritable();
     //# Check the column lengths.
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     if (nrrow != that.nrow()) {
       throw (TableConformanceError
              ("Nr of rows differ in ArrayColumn::putColumn for column " +
@@ -56,14 +56,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   class GetCellSlices : public BaseSlicesFunctor<T>
   {
   public:
-    GetCellSlices (const ArrayColumn<T>& col, uInt rownr)
+    GetCellSlices (const ArrayColumn<T>& col, rownr_t rownr)
       : itsCol(col), itsRow(rownr)
     {}
     virtual void apply (const Slicer& slicer, Array<T>& arr)
       { itsCol.getSlice (itsRow, slicer, arr); }
   private:
     const ArrayColumn<T>& itsCol;
-    uInt                  itsRow;
+    rownr_t                  itsRow;
   };
 
   // <summary> Functor to get irregular array slices from a column</summary>
@@ -85,14 +85,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   class PutCellSlices : public BaseSlicesFunctor<T>
   {
   public:
-    PutCellSlices (ArrayColumn<T>& col, uInt rownr)
+    PutCellSlices (ArrayColumn<T>& col, rownr_t rownr)
       : itsCol(col), itsRow(rownr)
     {}
     virtual void apply (const Slicer& slicer, Array<T>& arr)
       { itsCol.putSlice (itsRow, slicer, arr); }
   private:
     ArrayColumn<T>& itsCol;
-    uInt            itsRow;
+    rownr_t            itsRow;
   };
 
   // <summary> Functor to get irregular array slices from a column</summary>
@@ -46,13 +46,13 @@ BaseColumn::~BaseColumn()
 //# By default all functions throw an exception
 //# to ensure they are called correctly.
 
-void BaseColumn::setShape (uInt, const IPosition&)
+void BaseColumn::setShape (rownr_t, const IPosition&)
 {
   throw (TableInvOper ("invalid setShape() for column " + colDesc_p.name() +
                        "; only valid for an array"));
 }
 
-void BaseColumn::setShape (uInt, const IPosition&, const IPosition&)
+void BaseColumn::setShape (rownr_t, const IPosition&, const IPosition&)
 {
   throw (TableInvOper ("invalid setShape() for column " + colDesc_p.name() +
                        "; only valid for an array"));
@@ -72,14 +72,14 @@ IPosition BaseColumn::shapeColumn() const
   return IPosition(0);
 }
 
-uInt BaseColumn::ndim (uInt) const
+uInt BaseColumn::ndim (rownr_t) const
 {
   throw (TableInvOper ("invalid ndim() for column " + colDesc_p.name() +
                        "; only valid for an array"));
   return 0;
 }
 
-IPosition BaseColumn::shape (uInt) const
+IPosition BaseColumn::shape (rownr_t) const
 {
   throw (TableInvOper ("invalid shape() for column " + colDesc_p.name() +
                        "; only valid for an array"));
@@ -122,9 +122,24 @@ Bool BaseColumn::canAccessColumnSlice (Bool& reask) const
     reask = False;                     // By default a column slice
     return False;                      // can never be accessed
 }
+Bool BaseColumn::getZoneMap (Vector<rownr_t>&, Vector<Double>&,
+                             Vector<Double>&) const
+{
+    return False;
+}
+Bool BaseColumn::prepareConcurrentGet (uInt)
+{
+    return False;
+}
+void BaseColumn::getScalarCellsConcurrent (const rownr_t*, size_t,
+                                           void*) const
+{
+  throw (TableInvOper ("getScalarCellsConcurrent() not implemented for "
+                       "column " + colDesc_p.name()));
+}
 
 
-void BaseColumn::getSlice (uInt, const Slicer&, void*) const
+void BaseColumn::getSlice (rownr_t, const Slicer&, void*) const
 {
   throw (TableInvOper ("getSlice() not implemented for column " +
                        colDesc_p.name() + "; only valid for an array"));
@@ -167,7 +182,7 @@ void BaseColumn::getColumnSlice (const Slicer&, void*) const
                        colDesc_p.name() + "; only valid for an array"));
 }
 
-void BaseColumn::putSlice (uInt, const Slicer&, const void*)
+void BaseColumn::putSlice (rownr_t, const Slicer&, const void*)
 {
   throw (TableInvOper ("putSlice() not implemented for column " +
                        colDesc_p.name() + "; only valid for an array"));
@@ -218,7 +233,7 @@ void BaseColumn::makeSortKey (Sort&, CountedPtr<BaseCompare>&, Int,
                        " is only valid for a scalar"));
 }
 void BaseColumn::makeRefSortKey (Sort&, CountedPtr<BaseCompare>&, Int,
-				 const Vector<uInt>&, const void*&)
+				 const Vector<rownr_t>&, const void*&)
 {
   throw (TableInvOper ("makeSortKey(rownrs) for column " + colDesc_p.name() +
                        " is only valid for a scalar"));
@@ -240,7 +255,7 @@ void BaseColumn::freeIterBuf (void*&, void*&)
 }
 
 
-void BaseColumn::getScalar (uInt rownr, Bool& value) const
+void BaseColumn::getScalar (rownr_t rownr, Bool& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -254,7 +269,7 @@ void BaseColumn::getScalar (uInt rownr, Bool& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, uChar& value) const
+void BaseColumn::getScalar (rownr_t rownr, uChar& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -268,7 +283,7 @@ void BaseColumn::getScalar (uInt rownr, uChar& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, Short& value) const
+void BaseColumn::getScalar (rownr_t rownr, Short& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -282,7 +297,7 @@ void BaseColumn::getScalar (uInt rownr, Short& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, uShort& value) const
+void BaseColumn::getScalar (rownr_t rownr, uShort& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -301,7 +316,7 @@ void BaseColumn::getScalar (uInt rownr, uShort& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, Int& value) const
+void BaseColumn::getScalar (rownr_t rownr, Int& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -320,7 +335,7 @@ void BaseColumn::getScalar (uInt rownr, Int& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, uInt& value) const
+void BaseColumn::getScalar (rownr_t rownr, uInt& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -344,7 +359,7 @@ void BaseColumn::getScalar (uInt rownr, uInt& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, Int64& value) const
+void BaseColumn::getScalar (rownr_t rownr, Int64& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -380,7 +395,7 @@ void BaseColumn::getScalar (uInt rownr, Int64& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, float& value) const
+void BaseColumn::getScalar (rownr_t rownr, float& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -424,7 +439,7 @@ void BaseColumn::getScalar (uInt rownr, float& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, double& value) const
+void BaseColumn::getScalar (rownr_t rownr, double& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -468,7 +483,7 @@ void BaseColumn::getScalar (uInt rownr, double& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, Complex& value) const
+void BaseColumn::getScalar (rownr_t rownr, Complex& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -523,7 +538,7 @@ void BaseColumn::getScalar (uInt rownr, Complex& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, DComplex& value) const
+void BaseColumn::getScalar (rownr_t rownr, DComplex& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -577,7 +592,7 @@ void BaseColumn::getScalar (uInt rownr, DComplex& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, String& value) const
+void BaseColumn::getScalar (rownr_t rownr, String& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -591,7 +606,7 @@ void BaseColumn::getScalar (uInt rownr, String& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, TableRecord& value) const
+void BaseColumn::getScalar (rownr_t rownr, TableRecord& value) const
 {
     if (!colDescPtr_p->isScalar()) {
         throwGetScalar();
@@ -605,7 +620,7 @@ void BaseColumn::getScalar (uInt rownr, TableRecord& value) const
     }
 }
 
-void BaseColumn::getScalar (uInt rownr, void* value,
+void BaseColumn::getScalar (rownr_t rownr, void* value,
 			    const String& dataTypeId) const
 {
     if (!colDescPtr_p->isScalar()) {
@@ -619,7 +634,7 @@ void BaseColumn::getScalar (uInt rownr, void* value,
 }
 
 
-void BaseColumn::putScalar (uInt rownr, const Bool& value)
+void BaseColumn::putScalar (rownr_t rownr, const Bool& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -633,7 +648,7 @@ void BaseColumn::putScalar (uInt rownr, const Bool& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const uChar& value)
+void BaseColumn::putScalar (rownr_t rownr, const uChar& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -675,7 +690,7 @@ void BaseColumn::putScalar (uInt rownr, const uChar& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const Short& value)
+void BaseColumn::putScalar (rownr_t rownr, const Short& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -712,7 +727,7 @@ void BaseColumn::putScalar (uInt rownr, const Short& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const uShort& value)
+void BaseColumn::putScalar (rownr_t rownr, const uShort& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -749,7 +764,7 @@ void BaseColumn::putScalar (uInt rownr, const uShort& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const Int& value)
+void BaseColumn::putScalar (rownr_t rownr, const Int& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -781,7 +796,7 @@ void BaseColumn::putScalar (uInt rownr, const Int& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const uInt& value)
+void BaseColumn::putScalar (rownr_t rownr, const uInt& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -813,7 +828,7 @@ void BaseColumn::putScalar (uInt rownr, const uInt& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const float& value)
+void BaseColumn::putScalar (rownr_t rownr, const float& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -840,7 +855,7 @@ void BaseColumn::putScalar (uInt rownr, const float& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const double& value)
+void BaseColumn::putScalar (rownr_t rownr, const double& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -867,7 +882,7 @@ void BaseColumn::putScalar (uInt rownr, const double& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const Complex& value)
+void BaseColumn::putScalar (rownr_t rownr, const Complex& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -885,7 +900,7 @@ void BaseColumn::putScalar (uInt rownr, const Complex& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const DComplex& value)
+void BaseColumn::putScalar (rownr_t rownr, const DComplex& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -903,7 +918,7 @@ void BaseColumn::putScalar (uInt rownr, const DComplex& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const String& value)
+void BaseColumn::putScalar (rownr_t rownr, const String& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -917,7 +932,7 @@ void BaseColumn::putScalar (uInt rownr, const String& value)
     }
 }
 
-void BaseColumn::putScalar (uInt rownr, const TableRecord& value)
+void BaseColumn::putScalar (rownr_t rownr, const TableRecord& value)
 {
     if (!colDescPtr_p->isScalar()) {
         throwPutScalar();
@@ -121,16 +121,16 @@ public:
 	{ return colDesc_p; }
 
     // Get nr of rows in the column.
-    virtual uInt nrow() const = 0;
+    virtual rownr_t nrow() const = 0;
 
     // Test if the given cell contains a defined value.
-    virtual Bool isDefined (uInt rownr) const = 0;
+    virtual Bool isDefined (rownr_t rownr) const = 0;
 
     // Set the shape of the array in the given row.
-    virtual void setShape (uInt rownr, const IPosition& shape);
+    virtual void setShape (rownr_t rownr, const IPosition& shape);
 
     // Set the shape and tile shape of the array in the given row.
-    virtual void setShape (uInt rownr, const IPosition& shape,
+    virtual void setShape (rownr_t rownr, const IPosition& shape,
 			   const IPosition& tileShape);
 
     // Get the global #dimensions of an array (ie. for all rows).
@@ -140,10 +140,10 @@ public:
     virtual IPosition shapeColumn() const;
 
     // Get the #dimensions of an array in a particular cell.
-    virtual uInt ndim (uInt rownr) const;
+    virtual uInt ndim (rownr_t rownr) const;
 
     // Get the shape of an array in a particular cell.
-    virtual IPosition shape (uInt rownr) const;
+    virtual IPosition shape (rownr_t rownr) const;
 
     // Ask the data manager if the shape of an existing array can be changed.
     // Default is no.
@@ -175,14 +175,14 @@ public:
 
     // Initialize the rows from startRow till endRow (inclusive)
     // with the default value defined in the column description.
-    virtual void initialize (uInt startRownr, uInt endRownr) = 0;
+    virtual void initialize (rownr_t startRownr, rownr_t endRownr) = 0;
 
     // Get the value from a particular cell.
     // This can be a scalar or an array.
-    virtual void get (uInt rownr, void* dataPtr) const = 0;
+    virtual void get (rownr_t rownr, void* dataPtr) const = 0;
 
     // Get a slice of an N-dimensional array in a particular cell.
-    virtual void getSlice (uInt rownr, const Slicer&, void* dataPtr) const;
+    virtual void getSlice (rownr_t rownr, const Slicer&, void* dataPtr) const;
 
     // Get the vector of all scalar values in a column.
     virtual void getScalarColumn (void* dataPtr) const;
@@ -215,10 +215,10 @@ public:
 
     // Put the value in a particular cell.
     // This can be a scalar or an array.
-    virtual void put (uInt rownr, const void* dataPtr) = 0;
+    virtual void put (rownr_t rownr, const void* dataPtr) = 0;
 
     // Put a slice of an N-dimensional array in a particular cell.
-    virtual void putSlice (uInt rownr, const Slicer&, const void* dataPtr);
+    virtual void putSlice (rownr_t rownr, const Slicer&, const void* dataPtr);
 
     // Put the vector of all scalar values in the column.
     virtual void putScalarColumn (const void* dataPtr);
@@ -254,42 +254,42 @@ public:
     // Note that an unsigned integer cannot be converted to a signed integer
     // with the same length. So only Int64 can handle all integer values.
     // <group>
-    void getScalar (uInt rownr, Bool& value) const;
-    void getScalar (uInt rownr, uChar& value) const;
-    void getScalar (uInt rownr, Short& value) const;
-    void getScalar (uInt rownr, uShort& value) const;
-    void getScalar (uInt rownr, Int& value) const;
-    void getScalar (uInt rownr, uInt& value) const;
-    void getScalar (uInt rownr, Int64& value) const;
-    void getScalar (uInt rownr, float& value) const;
-    void getScalar (uInt rownr, double& value) const;
-    void getScalar (uInt rownr, Complex& value) const;
-    void getScalar (uInt rownr, DComplex& value) const;
-    void getScalar (uInt rownr, String& value) const;
-    void getScalar (uInt rownr, TableRecord& value) const;
+    void getScalar (rownr_t rownr, Bool& value) const;
+    void getScalar (rownr_t rownr, uChar& value) const;
+    void getScalar (rownr_t rownr, Short& value) const;
+    void getScalar (rownr_t rownr, uShort& value) const;
+    void getScalar (rownr_t rownr, Int& value) const;
+    void getScalar (rownr_t rownr, uInt& value) const;
+    void getScalar (rownr_t rownr, Int64& value) const;
+    void getScalar (rownr_t rownr, float& value) const;
+    void getScalar (rownr_t rownr, double& value) const;
+    void getScalar (rownr_t rownr, Complex& value) const;
+    void getScalar (rownr_t rownr, DComplex& value) const;
+    void getScalar (rownr_t rownr, String& value) const;
+    void getScalar (rownr_t rownr, TableRecord& value) const;
     // </group>
 
     // Get a scalar for the other data types.
     // The given data type id must match the data type id of this column.
-    void getScalar (uInt rownr, void* value, const String& dataTypeId) const;
+    void getScalar (rownr_t rownr, void* value, const String& dataTypeId) const;
 
     // Put the value into the row and convert it from the given type.
     // This can only be used for scalar columns with a standard data type.
     // <group>
-    void putScalar (uInt rownr, const Bool& value);
-    void putScalar (uInt rownr, const uChar& value);
-    void putScalar (uInt rownr, const Short& value);
-    void putScalar (uInt rownr, const uShort& value);
-    void putScalar (uInt rownr, const Int& value);
-    void putScalar (uInt rownr, const uInt& value);
-    void putScalar (uInt rownr, const float& value);
-    void putScalar (uInt rownr, const double& value);
-    void putScalar (uInt rownr, const Complex& value);
-    void putScalar (uInt rownr, const DComplex& value);
-    void putScalar (uInt rownr, const String& value);
-    void putScalar (uInt rownr, const Char* value)
+    void putScalar (rownr_t rownr, const Bool& value);
+    void putScalar (rownr_t rownr, const uChar& value);
+    void putScalar (rownr_t rownr, const Short& value);
+    void putScalar (rownr_t rownr, const uShort& value);
+    void putScalar (rownr_t rownr, const Int& value);
+    void putScalar (rownr_t rownr, const uInt& value);
+    void putScalar (rownr_t rownr, const float& value);
+    void putScalar (rownr_t rownr, const double& value);
+    void putScalar (rownr_t rownr, const Complex& value);
+    void putScalar (rownr_t rownr, const DComplex& value);
+    void putScalar (rownr_t rownr, const String& value);
+    void putScalar (rownr_t rownr, const Char* value)
         { putScalar (rownr, String(value)); }
-    void putScalar (uInt rownr, const TableRecord& value);
+    void putScalar (rownr_t rownr, const TableRecord& value);
     // </group>
 
     // Get a pointer to the underlying column cache.
@@ -298,6 +298,28 @@ public:
     // Set the maximum cache size (in bytes) to be used by a storage manager.
     virtual void setMaximumCacheSize (uInt nbytes) = 0;
 
+    // Get the zone map (minimum and maximum value per part) of a scalar
+    // numeric column (see
+    // <linkto class=DataManagerColumn>DataManagerColumn::getZoneMap</linkto>).
+    // By default False is returned meaning that no zone map is available.
+    virtual Bool getZoneMap (Vector<rownr_t>& startRows,
+                             Vector<Double>& minValues,
+                             Vector<Double>& maxValues) const;
+
+    // Prepare a scalar column for getting values by multiple threads (see
+    // <linkto class=DataManagerColumn>DataManagerColumn::prepareConcurrentGet
+    // </linkto>). A value of 1 ends the concurrent access.
+    // By default False is returned meaning that the column cannot be
+    // read concurrently.
+    virtual Bool prepareConcurrentGet (uInt nthreads);
+
+    // Get the scalar values in the given rows (thread-safe).
+    // The argument dataPtr is in fact a T* pointing to <src>nrow</src>
+    // values. It can only be used if <src>prepareConcurrentGet</src>
+    // returned True. By default an exception is thrown.
+    virtual void getScalarCellsConcurrent (const rownr_t* rownrs, size_t nrow,
+                                           void* dataPtr) const;
+
     // Add this column and its data to the Sort object.
     // It may allocate some storage on the heap, which will be saved
     // in the argument dataSave.
@@ -307,7 +329,7 @@ public:
 			      Int order, const void*& dataSave);
     // Do it only for the given row numbers.
     virtual void makeRefSortKey (Sort&, CountedPtr<BaseCompare>& cmpObj,
-				 Int order, const Vector<uInt>& rownrs,
+				 Int order, const Vector<rownr_t>& rownrs,
 				 const void*& dataSave);
     // </group>
 
@@ -34,6 +34,8 @@
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/BaseColumn.h>
 #include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprRange.h>
+#include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/tables/Tables/BaseTabIter.h>
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/tables/Tables/TableError.h>
@@ -52,13 +54,15 @@
 #include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/OS/Directory.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <float.h>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 // The constructor of the derived class should call unmarkForDelete
 // when the construction ended succesfully.
-BaseTable::BaseTable (const String& name, int option, uInt nrrow)
+BaseTable::BaseTable (const String& name, int option, rownr_t nrrow)
 : nrlink_p    (0),
   nrrow_p     (nrrow),
   nrrowToAdd_p(0),
@@ -264,8 +268,14 @@ void BaseTable::writeStart (AipsIO& ios, Bool bigEndian)
     ios.open (Table::fileName(name_p), ByteIO::New);
     //# Start the object as Table, so class Table can read it back.
     //# Version 2 (of PlainTable) does not have its own TableRecord anymore.
-    ios.putstart ("Table", 2);
-    ios << nrrow_p;
+    //# Version 3 stores the number of rows as a 64-bit value.
+    if (nrrow_p > 4294967295u) {
+        ios.putstart ("Table", 3);
+        ios << nrrow_p;
+    } else {
+        ios.putstart ("Table", 2);
+        ios << uInt(nrrow_p);
+    }
     //# Write endianity as a uInt, because older tables contain a uInt 0 here.
     uInt endian = 0;
     if (!bigEndian) {
@@ -277,6 +287,22 @@ void BaseTable::writeStart (AipsIO& ios, Bool bigEndian)
     }
 }
 
+uInt BaseTable::readStart (AipsIO& ios, rownr_t& nrrow, uInt& format,
+                           String& type)
+{
+    uInt version = ios.getstart ("Table");
+    if (version > 2) {
+        ios >> nrrow;
+    } else {
+        uInt nrrow32;
+        ios >> nrrow32;
+        nrrow = nrrow32;
+    }
+    ios >> format;
+    ios >> type;
+    return version;
+}
+
 //# End writing a table file.
 void BaseTable::writeEnd (AipsIO& ios)
 {
@@ -287,6 +313,11 @@ void BaseTable::writeEnd (AipsIO& ios)
 void BaseTable::setTableChanged()
 {}
 
+uInt BaseTable::getDataModifyCounter() const
+{
+    return getModifyCounter();
+}
+
 
 void BaseTable::markForDelete (Bool callback, const String& oldName)
 {
@@ -510,21 +541,21 @@ Bool BaseTable::canAddRow() const
 Bool BaseTable::canRemoveRow() const
     { return False; }
 
-void BaseTable::addRow (uInt, Bool)
+void BaseTable::addRow (rownr_t, Bool)
     { throw (TableInvOper ("Table: cannot add a row to table " + name_p)); }
 
-void BaseTable::removeRow (uInt)
+void BaseTable::removeRow (rownr_t)
     { throw (TableInvOper ("Table: cannot remove a row from table " + name_p)); }
 
-void BaseTable::removeRow (const Vector<uInt>& rownrs)
+void BaseTable::removeRow (const Vector<rownr_t>& rownrs)
 {
     //# Copy the rownrs and sort them.
     //# Loop through them from end to start. In that way we are sure
     //# that the deletion of a row does not affect later rows.
-    Vector<uInt> rownrsCopy;
+    Vector<rownr_t> rownrsCopy;
     rownrsCopy = rownrs;
     genSort (rownrsCopy);
-    for (Int i=rownrsCopy.nelements()-1; i>=0; i--) {
+    for (Int64 i=rownrsCopy.nelements()-1; i>=0; i--) {
 	removeRow (rownrsCopy(i));
     }
 }
@@ -564,11 +595,11 @@ void BaseTable::addColumns (const TableDesc& desc, const Record& dmInfo,
 
 
 //# Get a vector of row numbers.
-Vector<uInt> BaseTable::rowNumbers() const
+Vector<rownr_t> BaseTable::rowNumbers() const
 {
     AlwaysAssert (!isNull(), AipsError);
-    Vector<uInt> vec(nrow());
-    indgen (vec, (uInt)0);                  // store 0,1,... in it
+    Vector<rownr_t> vec(nrow());
+    indgen (vec, rownr_t(0));                  // store 0,1,... in it
     return vec;
 }
 
@@ -581,7 +612,7 @@ Bool BaseTable::rowOrder() const
     { return True; }
 
 //# By the default the table cannot return the storage of rownrs.
-Vector<uInt>* BaseTable::rowStorage()
+Vector<rownr_t>* BaseTable::rowStorage()
 {
     throw (TableInvOper ("rowStorage() not possible; table " + name_p +
                          " is no RefTable"));
@@ -633,12 +664,12 @@ BaseTable* BaseTable::doSort (PtrBlock<BaseColumn*>& sortCol,
     }
     //# Create a reference table.
     //# This table will NOT be in row order.
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     RefTable* resultTable = makeRefTable (False, nrrow);
     //# Now sort the table storing the row-numbers in the RefTable.
     //# Adjust rownrs in case source table is already a RefTable.
     //# Then delete possible allocated data blocks.
-    Vector<uInt>& rows = *(resultTable->rowStorage());
+    Vector<rownr_t>& rows = *(resultTable->rowStorage());
     //# Note that nrrow can change in case Sort::NoDuplicates was given.
     nrrow = sortobj.sort (rows, nrrow, option);
     adjustRownrs (nrrow, rows, False);
@@ -649,7 +680,7 @@ BaseTable* BaseTable::doSort (PtrBlock<BaseColumn*>& sortCol,
     return resultTable;
 }
 
-RefTable* BaseTable::makeRefTable (Bool rowOrder, uInt initialNrrow)
+RefTable* BaseTable::makeRefTable (Bool rowOrder, rownr_t initialNrrow)
 {
     RefTable* rtp = new RefTable(this, rowOrder, initialNrrow);
     return rtp;
@@ -657,10 +688,10 @@ RefTable* BaseTable::makeRefTable (Bool rowOrder, uInt initialNrrow)
 
 
 //# No rownrs have to be adjusted and they are by default in ascending order.
-Bool BaseTable::adjustRownrs (uInt, Vector<uInt>&, Bool) const
+Bool BaseTable::adjustRownrs (rownr_t, Vector<rownr_t>&, Bool) const
     { return True; }
 
-BaseTable* BaseTable::select (uInt maxRow, uInt offset)
+BaseTable* BaseTable::select (rownr_t maxRow, rownr_t offset)
 {
     if (offset > nrow()) {
         offset = nrow();
@@ -671,14 +702,14 @@ BaseTable* BaseTable::select (uInt maxRow, uInt offset)
     if (offset == 0  &&  maxRow == nrow()) {
         return this;
     }
-    Vector<uInt> rownrs(maxRow);
+    Vector<rownr_t> rownrs(maxRow);
     indgen(rownrs, offset);
     return select(rownrs);
 }
 
 // Do the row selection.
 BaseTable* BaseTable::select (const TableExprNode& node,
-                              uInt maxRow, uInt offset)
+                              rownr_t maxRow, rownr_t offset)
 {
     // Check we don't deal with a null table.
     AlwaysAssert (!isNull(), AipsError);
@@ -698,7 +729,7 @@ BaseTable* BaseTable::select (const TableExprNode& node,
             return select (maxRow, offset);
         }
         // Select no rows.
-        return select(Vector<uInt>());
+        return select(Vector<rownr_t>());
     }
     // Now check if this table has been used for all columns.
     // Accept that the expression has no table, which can be the case for
@@ -712,23 +743,44 @@ BaseTable* BaseTable::select (const TableExprNode& node,
     //# Loop through all rows and add to reference table if true.
     //# Add the rownr of the root table (one may search a reference table).
     //# Adjust the row numbers to reflect row numbers in the root table.
+    //# The expression is evaluated for a block of rows at a time, which
+    //# is much faster than evaluating it row by row.
+    //# Only the row intervals that can contain matching rows according
+    //# to the zone maps of the columns in the expression are evaluated.
     SPtrHolder<RefTable> resultTable (makeRefTable (True, 0));
-    Bool val;
-    uInt nrrow = nrow();
-    TableExprId id;
-    for (uInt i=0; i<nrrow; i++) {
-      id.setRownr (i);
-      node.get (id, val);
-      if (val) {
-        if (offset == 0) {
-          resultTable->addRownr (i);                  // add row
-          // Stop if max #rows reached (note that maxRow==0 means no limit).
-          if (resultTable->nrow() == maxRow) {
-            break;
+    const rownr_t blockSize = 4096;
+    rownr_t nrrow = nrow();
+    std::vector<std::pair<rownr_t,rownr_t> > intervals;
+    zoneIntervals (node, nrrow, intervals);
+    Vector<rownr_t> rownrs;
+    Vector<Bool> vals;
+    Bool done = False;
+    for (uInt j=0; j<intervals.size() && !done; j++) {
+      rownr_t endrow = intervals[j].second;
+      rownr_t nr = 0;
+      for (rownr_t st=intervals[j].first; st<endrow && !done; st+=nr) {
+        nr = std::min (blockSize, endrow-st);
+        // Do not evaluate more rows than needed to reach the limit.
+        if (maxRow > 0) {
+          nr = std::min (nr, offset + maxRow - resultTable->nrow());
+        }
+        rownrs.resize (nr);
+        indgen (rownrs, st);
+        node.getBoolVector (rownrs, vals);
+        for (rownr_t i=0; i<nr; i++) {
+          if (vals[i]) {
+            if (offset == 0) {
+              resultTable->addRownr (st+i);             // add row
+              // Stop if max #rows reached (maxRow==0 means no limit).
+              if (resultTable->nrow() == maxRow) {
+                done = True;
+                break;
+              }
+            } else {
+              // Skip first offset matching rows.
+              offset--;
+            }
           }
-        } else {
-          // Skip first offset matching rows.
-          offset--;
         }
       }
     }
@@ -736,7 +788,74 @@ BaseTable* BaseTable::select (const TableExprNode& node,
     return resultTable.transfer();
 }
 
-BaseTable* BaseTable::select (const Vector<uInt>& rownrs)
+void BaseTable::zoneIntervals
+                 (const TableExprNode& node, rownr_t nrrow,
+                  std::vector<std::pair<rownr_t,rownr_t> >& intervals) const
+{
+    intervals.assign (1, std::make_pair (rownr_t(0), nrrow));
+    // Get the ranges of the columns compared with constants.
+    // Ranges of different columns are ANDed.
+    Block<TableExprRange> ranges;
+    TableExprNode expr(node);
+    expr.ranges (ranges);
+    Vector<rownr_t> startRows;
+    Vector<Double> minValues, maxValues;
+    for (uInt i=0; i<ranges.size(); i++) {
+      const TableColumn& col = ranges[i].getColumn();
+      if (col.table().baseTablePtr() != this  ||
+          !col.getZoneMap (startRows, minValues, maxValues)) {
+        continue;
+      }
+      // An open end of a range is given as -DBL_MAX or DBL_MAX. Use
+      // infinity instead, otherwise zones containing an infinite value
+      // would not match.
+      Vector<Double> st  = ranges[i].start().copy();
+      Vector<Double> end = ranges[i].end().copy();
+      for (uInt k=0; k<st.size(); k++) {
+        if (st[k] == -DBL_MAX) {
+          st[k] = -std::numeric_limits<Double>::infinity();
+        }
+        if (end[k] == DBL_MAX) {
+          end[k] = std::numeric_limits<Double>::infinity();
+        }
+      }
+      // Find the zones (merged where adjacent) overlapping any range.
+      std::vector<std::pair<rownr_t,rownr_t> > zones;
+      for (uInt j=0; j<startRows.size(); j++) {
+        Bool match = False;
+        for (uInt k=0; k<st.size() && !match; k++) {
+          match = (minValues[j] <= end[k]  &&  maxValues[j] >= st[k]);
+        }
+        if (match) {
+          rownr_t zend = (j+1 < startRows.size()  ?  startRows[j+1] : nrrow);
+          if (!zones.empty()  &&  zones.back().second == startRows[j]) {
+            zones.back().second = zend;
+          } else {
+            zones.push_back (std::make_pair (startRows[j], zend));
+          }
+        }
+      }
+      // Intersect them with the intervals found so far.
+      std::vector<std::pair<rownr_t,rownr_t> > result;
+      uInt k = 0;
+      for (uInt j=0; j<zones.size(); j++) {
+        while (k < intervals.size()  &&  intervals[k].second <= zones[j].first) {
+          k++;
+        }
+        for (uInt m=k; m<intervals.size()  &&
+                         intervals[m].first < zones[j].second; m++) {
+          rownr_t s = std::max (intervals[m].first, zones[j].first);
+          rownr_t e = std::min (intervals[m].second, zones[j].second);
+          if (s < e) {
+            result.push_back (std::make_pair (s, e));
+          }
+        }
+      }
+      intervals.swap (result);
+    }
+}
+
+BaseTable* BaseTable::select (const Vector<rownr_t>& rownrs)
 {
     AlwaysAssert (!isNull(), AipsError);
     RefTable* rtp = new RefTable(this, rownrs);
@@ -776,10 +895,10 @@ BaseTable* BaseTable::tabAnd (BaseTable* that)
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted afterwards.
     Bool allsw1, allsw2;
-    uInt* inx1;
-    uInt* inx2;
-    uInt nr1 = this->logicRows (inx1, allsw1);
-    uInt nr2 = that->logicRows (inx2, allsw2);
+    rownr_t* inx1;
+    rownr_t* inx2;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
+    rownr_t nr2 = that->logicRows (inx2, allsw2);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refAnd (nr1, inx1, nr2, inx2);       // store rownrs in new RefTable
     if (allsw1) {
@@ -807,10 +926,10 @@ BaseTable* BaseTable::tabOr (BaseTable* that)
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted afterwards.
     Bool allsw1, allsw2;
-    uInt* inx1;
-    uInt* inx2;
-    uInt nr1 = this->logicRows (inx1, allsw1);
-    uInt nr2 = that->logicRows (inx2, allsw2);
+    rownr_t* inx1;
+    rownr_t* inx2;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
+    rownr_t nr2 = that->logicRows (inx2, allsw2);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refOr (nr1, inx1, nr2, inx2);       // store rownrs in new RefTable
     if (allsw1) {
@@ -841,10 +960,10 @@ BaseTable* BaseTable::tabSub (BaseTable* that)
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted afterwards.
     Bool allsw1, allsw2;
-    uInt* inx1;
-    uInt* inx2;
-    uInt nr1 = this->logicRows (inx1, allsw1);
-    uInt nr2 = that->logicRows (inx2, allsw2);
+    rownr_t* inx1;
+    rownr_t* inx2;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
+    rownr_t nr2 = that->logicRows (inx2, allsw2);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refSub (nr1, inx1, nr2, inx2);       // store rownrs in new RefTable
     if (allsw1) {
@@ -874,10 +993,10 @@ BaseTable* BaseTable::tabXor (BaseTable* that)
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted afterwards.
     Bool allsw1, allsw2;
-    uInt* inx1;
-    uInt* inx2;
-    uInt nr1 = this->logicRows (inx1, allsw1);
-    uInt nr2 = that->logicRows (inx2, allsw2);
+    rownr_t* inx1;
+    rownr_t* inx2;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
+    rownr_t nr2 = that->logicRows (inx2, allsw2);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refXor (nr1, inx1, nr2, inx2);       // store rownrs in new RefTable
     if (allsw1) {
@@ -902,8 +1021,8 @@ BaseTable* BaseTable::tabNot()
     //# Sorting means that the array is allocated on the heap, which has
     //# to be deleted.
     Bool allsw1;
-    uInt* inx1;
-    uInt nr1 = this->logicRows (inx1, allsw1);
+    rownr_t* inx1;
+    rownr_t nr1 = this->logicRows (inx1, allsw1);
     RefTable* rtp = makeRefTable (True, 0);           // will be in row order
     rtp->refNot (nr1, inx1, root()->nrow());    // store rownrs in new RefTable
     if (allsw1) {
@@ -923,18 +1042,18 @@ void BaseTable::logicCheck (BaseTable* that)
 //# Get the rownrs from the reference table.
 //# Note that rowStorage() throws an exception if it is not a RefTable.
 //# Sort them if not in row order.
-uInt BaseTable::logicRows (uInt*& inx, Bool& allsw)
+rownr_t BaseTable::logicRows (rownr_t*& inx, Bool& allsw)
 {
     AlwaysAssert (!isNull(), AipsError);
     allsw = False;
     inx = RefTable::getStorage (*rowStorage());
-    uInt nr = nrow();
+    rownr_t nr = nrow();
     if (!rowOrder()) {
 	//# rows are not in order, so sort them.
 	//# They have to be copied, because the original should not be changed.
-	uInt* inxcp = new uInt[nr];
+	rownr_t* inxcp = new rownr_t[nr];
 	objcopy (inxcp, inx, nr);
-	GenSort<uInt>::sort (inxcp, nr);
+	GenSort<rownr_t>::sort (inxcp, nr);
 	inx = inxcp;
 	allsw = True;
     }
@@ -994,7 +1113,7 @@ Bool BaseTable::checkRemoveColumn (const Vector<String>& columnNames,
     return True;
 }
 
-void BaseTable::checkRowNumberThrow (uInt rownr) const
+void BaseTable::checkRowNumberThrow (rownr_t rownr) const
 {
     throw (TableError ("TableColumn: row number " + String::toString(rownr) +
 		       " exceeds #rows " +
@@ -38,6 +38,8 @@
 #include <casacore/casa/Utilities/CountedPtr.h>
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/IO/FileLocker.h>
+#include <vector>
+#include <utility>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -101,7 +103,7 @@ class BaseTable
 public:
 
     // Initialize the object.
-    BaseTable (const String& tableName, int tableOption, uInt nrrow);
+    BaseTable (const String& tableName, int tableOption, rownr_t nrrow);
 
     virtual ~BaseTable();
 
@@ -156,6 +158,10 @@ public:
     // Get the modify counter.
     virtual uInt getModifyCounter() const = 0;
 
+    // Get the modify counter of the column data.
+    // By default the modify counter is returned.
+    virtual uInt getDataModifyCounter() const;
+
     // Set the table to being changed. By default it does nothing.
     virtual void setTableChanged();
 
@@ -292,9 +298,16 @@ public:
     virtual void flushTableInfo();
 
     // Get number of rows.
-    uInt nrow() const
+    rownr_t nrow() const
 	{ return nrrow_p; }
 
+    // Read the start of a table file as written by <src>writeStart</src>.
+    // It returns the version and fills the number of rows, the
+    // endianity format and the table type.
+    // The number of rows is stored as a 32-bit value in versions < 3.
+    static uInt readStart (AipsIO&, rownr_t& nrrow, uInt& format,
+                           String& type);
+
     // Get a column object using its index.
     virtual BaseColumn* getColumn (uInt columnIndex) const = 0;
 
@@ -306,7 +319,7 @@ public:
 
     // Add one or more rows and possibly initialize them.
     // This will fail for tables not supporting addition of rows.
-    virtual void addRow (uInt nrrow = 1, Bool initialize = True);
+    virtual void addRow (rownr_t nrrow = 1, Bool initialize = True);
 
     // Test if it is possible to remove a row from this table.
     virtual Bool canRemoveRow() const;
@@ -328,8 +341,8 @@ public:
     // row 21 into row 20.
     // </note>
     // <group>
-    virtual void removeRow (uInt rownr);
-    void removeRow (const Vector<uInt>& rownrs);
+    virtual void removeRow (rownr_t rownr);
+    void removeRow (const Vector<rownr_t>& rownrs);
     // </group>
 
     // Find the data manager with the given name or for the given column.
@@ -339,13 +352,22 @@ public:
     // Select rows using the given expression (which can be null).
     // Skip first <src>offset</src> matching rows.
     // Return at most <src>maxRow</src> matching rows.
-    BaseTable* select (const TableExprNode&, uInt maxRow, uInt offset);
+    BaseTable* select (const TableExprNode&, rownr_t maxRow, rownr_t offset);
+
+    // Determine the row intervals <src>[start,end)</src> (in increasing order)
+    // that can contain rows matching the expression according to the
+    // zone maps (see <linkto class=TableColumn>TableColumn::getZoneMap</linkto>)
+    // of the columns in the expression compared with constants.
+    // If no zone map can be used, the only interval returned is all rows.
+    void zoneIntervals
+                  (const TableExprNode& node, rownr_t nrrow,
+                   std::vector<std::pair<rownr_t,rownr_t> >& intervals) const;
 
     // Select maxRow rows and skip first offset rows. maxRow=0 means all.
-    BaseTable* select (uInt maxRow, uInt offset);
+    BaseTable* select (rownr_t maxRow, rownr_t offset);
 
     // Select rows using a vector of row numbers.
-    BaseTable* select (const Vector<uInt>& rownrs);
+    BaseTable* select (const Vector<rownr_t>& rownrs);
 
     // Select rows using a mask block.
     // The length of the block must match the number of rows in the table.
@@ -428,7 +450,7 @@ public:
     // Get a vector of row numbers.
     // By default it returns the row numbers 0..nrrow()-1.
     // It needs to be implemented for RefTable only.
-    virtual Vector<uInt> rowNumbers() const;
+    virtual Vector<rownr_t> rowNumbers() const;
 
     // Get pointer to root table (i.e. parent of a RefTable).
     // Default it is this table.
@@ -444,12 +466,12 @@ public:
 
     // By the default the table cannot return the storage of rownrs.
     // That can only be done by a RefTable, where it is implemented.
-    virtual Vector<uInt>* rowStorage();
+    virtual Vector<rownr_t>* rowStorage();
 
     // Adjust the row numbers to be the actual row numbers in the
     // root table. This is, for instance, used when a RefTable is sorted.
     // Optionally it also determines if the resulting rows are in order.
-    virtual Bool adjustRownrs (uInt nrrow, Vector<uInt>& rownrs,
+    virtual Bool adjustRownrs (rownr_t nrrow, Vector<rownr_t>& rownrs,
 			       Bool determineOrder) const;
 
     // Do the actual sort.
@@ -461,11 +483,11 @@ public:
 			       int sortOption);
 
     // Create a RefTable object.
-    RefTable* makeRefTable (Bool rowOrder, uInt initialNrrow);
+    RefTable* makeRefTable (Bool rowOrder, rownr_t initialNrrow);
 
     // Check if the row number is valid.
     // It throws an exception if out of range.
-    void checkRowNumber (uInt rownr) const
+    void checkRowNumber (rownr_t rownr) const
         { if (rownr >= nrrow_p + nrrowToAdd_p) checkRowNumberThrow (rownr); }
 
     // Get the table's trace-id.
@@ -475,8 +497,8 @@ public:
 
 protected:
     uInt           nrlink_p;            //# #references to this table
-    uInt           nrrow_p;             //# #rows in this table
-    uInt           nrrowToAdd_p;        //# #rows to be added
+    rownr_t           nrrow_p;             //# #rows in this table
+    rownr_t           nrrowToAdd_p;        //# #rows to be added
     TableDesc*     tdescPtr_p;          //# Pointer to table description
     String         name_p;              //# table name
     int            option_p;            //# Table constructor option
@@ -519,6 +541,8 @@ protected:
     Bool openedForWrite() const;
 
     // Start writing a table. It does a putstart and writes <src>nrrow_p</src>.
+    // The old (version 2) format is used if the number of rows fits in
+    // 32 bits.
     // It should be ended by calling <src>writeEnd</src>.
     void writeStart (AipsIO&, Bool bigEndian);
 
@@ -554,7 +578,7 @@ private:
                          const Array<String>& columnNames, Bool sort) const;
 
     // Throw an exception for checkRowNumber.
-    void checkRowNumberThrow (uInt rownr) const;
+    void checkRowNumberThrow (rownr_t rownr) const;
 
     // Check if the tables combined in a logical operation have the
     // same root.
@@ -562,7 +586,7 @@ private:
 
     // Get the rownrs of the table in ascending order to be
     // used in the logical operation on the table.
-    uInt logicRows (uInt*& rownrs, Bool& allocated);
+    rownr_t logicRows (rownr_t*& rownrs, Bool& allocated);
 
     // Make an empty table description.
     // This is used if one asks for the description of a NullTable.
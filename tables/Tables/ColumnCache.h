@@ -92,7 +92,7 @@ public:
 
     // Set the start and end row number for which the given data pointer
     // is valid.
-    void set (uInt startRow, uInt endRow, const void* dataPtr);
+    void set (rownr_t startRow, rownr_t endRow, const void* dataPtr);
 
     // Invalidate the cache.
     // This clears the data pointer and sets startRow>endRow.
@@ -100,7 +100,7 @@ public:
 
     // Calculate the offset in the cached data for the given row.
     // -1 is returned if the row is not within the cached rows.
-    Int offset (uInt rownr) const;
+    Int offset (rownr_t rownr) const;
 
     // Give a pointer to the data.
     // The calling function has to do a proper cast after which the
@@ -109,14 +109,14 @@ public:
 
     // Give the start, end (including), and increment row number
     // of the cached column values.
-    uInt start() const {return itsStart;}
-    uInt end() const {return itsEnd;}
+    rownr_t start() const {return itsStart;}
+    rownr_t end() const {return itsEnd;}
     uInt incr() const {return itsIncr;}
 
 private:
-    uInt  itsStart;
-    uInt  itsEnd;
-    uInt  itsIncr;
+    rownr_t itsStart;
+    rownr_t itsEnd;
+    uInt    itsIncr;
     const void* itsData;
 };
 
@@ -131,7 +131,7 @@ inline void ColumnCache::invalidate()
     set (1, 0, 0);
 }
 
-inline Int ColumnCache::offset (uInt rownr) const
+inline Int ColumnCache::offset (rownr_t rownr) const
 {
     return rownr<itsStart || rownr>itsEnd  ?  -1 :
 	                                      Int((rownr-itsStart)*itsIncr);
@@ -143,11 +143,11 @@ inline const void* ColumnCache::dataPtr() const
 }
 
 /*
-inline uInt ColumnCache::start() const
+inline rownr_t ColumnCache::start() const
 {
     return itsStart;
 }
-inline uInt ColumnCache::end() const
+inline rownr_t ColumnCache::end() const
 {
     return itsEnd;
 }
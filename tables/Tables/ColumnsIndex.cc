@@ -34,7 +34,13 @@
 #include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/Containers/RecordField.h>
 #include <casacore/casa/Utilities/Sort.h>
+#include <casacore/casa/Utilities/Compare.h>
+#include <casacore/casa/Arrays/ArrayIO.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/Utilities/Copy.h>
+#include <casacore/casa/Utilities/CountedPtr.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/tables/Tables/TableError.h>
 
@@ -83,6 +89,7 @@ void ColumnsIndex::copy (const ColumnsIndex& that)
     itsTable = that.itsTable;
     itsNrrow   = itsTable.nrow();
     itsNoSort  = that.itsNoSort;
+    itsPersistent = that.itsPersistent;
     itsCompare = that.itsCompare;
     makeObjects (that.itsLowerKeyPtr->description());
   }
@@ -189,6 +196,7 @@ void ColumnsIndex::create (const Table& table,
   itsNrrow = itsTable.nrow();
   itsCompare = (compareFunction == 0  ?  compare : compareFunction);
   itsNoSort = noSort;
+  itsPersistent = !noSort  &&  hasPersistentIndex (table, columnNames);
   // Loop through all column names.
   // Always add it to the RecordDesc.
   RecordDesc description;
@@ -302,17 +310,33 @@ void ColumnsIndex::makeObjects (const RecordDesc& description)
   }
 }
 
-void ColumnsIndex::readData()
+void ColumnsIndex::readData (Bool storeIndex)
 {
-  // Acquire a lock if needed.
-  TableLocker locker(itsTable, FileLocker::Read);
-  uInt nrrow = itsTable.nrow();
+  // Acquire the lock only once. If the persistent index might have to be
+  // stored, try to get a write lock without waiting for it. If it cannot
+  // be acquired, a read lock is used and storing the index is left to a
+  // later call.
+  CountedPtr<TableLocker> locker;
+  if (itsPersistent  &&  canWriteIndex()) {
+    try {
+      locker = new TableLocker (itsTable, FileLocker::Write, 1);
+    } catch (TableError&) {
+    }
+  }
+  if (locker.null()) {
+    locker = new TableLocker (itsTable, FileLocker::Read);
+  }
+  Bool canStore = itsPersistent  &&  itsTable.hasLock (FileLocker::Write);
+  rownr_t nrrow = itsTable.nrow();
   if (nrrow != itsNrrow) {
     itsColumnChanged.set (True);
     itsChanged = True;
     itsNrrow = nrrow;
   }
   if (!itsChanged) {
+    if (storeIndex  &&  canStore) {
+      writeIndex();
+    }
     return;
   }
   Sort sort;
@@ -429,10 +453,12 @@ void ColumnsIndex::readData()
   }
   // Sort the data if needed.
   // Otherwise fill the index vector with 0..n.
-  itsDataIndex.resize (itsNrrow);
   if (!itsNoSort) {
-    sort.sort (itsDataIndex, itsNrrow);
+    if ((sortData (sort)  ||  storeIndex)  &&  canStore) {
+      writeIndex();
+    }
   } else {
+    itsDataIndex.resize (itsNrrow);
     indgen (itsDataIndex);
   }
   // Determine all unique keys (itsUniqueIndex will contain the index of
@@ -443,6 +469,285 @@ void ColumnsIndex::readData()
   itsChanged = False;
 }
 
+Bool ColumnsIndex::sortData (Sort& sort)
+{
+  // Try to reuse the current sort order or the persistent one.
+  Vector<rownr_t> oldIndex;
+  if (itsDataIndex.nelements() > 0) {
+    oldIndex.reference (itsDataIndex);
+  } else if (itsPersistent) {
+    oldIndex.reference (readIndex());
+  }
+  rownr_t nold = validSortSize (oldIndex);
+  if (nold == itsNrrow) {
+    itsDataIndex.reference (oldIndex);
+    // A sort order read from file is not new.
+    return False;
+  }
+  if (nold == 0) {
+    itsDataIndex.resize (itsNrrow);
+    sort.sort (itsDataIndex, itsNrrow);
+    return True;
+  }
+  // Rows have been added, so only sort the new rows and merge them with
+  // the old ones. On equal keys the old rows go first.
+  const RecordDesc& desc = itsLowerKeyPtr->description();
+  Sort sortNew;
+  for (uInt i=0; i<itsDataTypes.nelements(); i++) {
+    const char* data = static_cast<const char*>(itsData[i]);
+    switch (itsDataTypes[i]) {
+    case TpBool:
+      data += nold*sizeof(Bool);
+      break;
+    case TpUChar:
+      data += nold*sizeof(uChar);
+      break;
+    case TpShort:
+      data += nold*sizeof(Short);
+      break;
+    case TpInt:
+      data += nold*sizeof(Int);
+      break;
+    case TpUInt:
+      data += nold*sizeof(uInt);
+      break;
+    case TpFloat:
+      data += nold*sizeof(Float);
+      break;
+    case TpDouble:
+      data += nold*sizeof(Double);
+      break;
+    case TpComplex:
+      data += nold*sizeof(Complex);
+      break;
+    case TpDComplex:
+      data += nold*sizeof(DComplex);
+      break;
+    case TpString:
+      data += nold*sizeof(String);
+      break;
+    }
+    sortNew.sortKey (data, desc.type(i));
+  }
+  rownr_t nnew = itsNrrow - nold;
+  Vector<rownr_t> newIndex(nnew);
+  sortNew.sort (newIndex, nnew);
+  Vector<rownr_t> index(itsNrrow);
+  rownr_t i = 0;
+  rownr_t j = 0;
+  for (rownr_t k=0; k<itsNrrow; ++k) {
+    if (j == nnew  ||
+        (i < nold  &&  compareRows (oldIndex[i], newIndex[j]+nold) <= 0)) {
+      index[k] = oldIndex[i++];
+    } else {
+      index[k] = newIndex[j++] + nold;
+    }
+  }
+  itsDataIndex.reference (index);
+  return True;
+}
+
+rownr_t ColumnsIndex::validSortSize (const Vector<rownr_t>& oldIndex) const
+{
+  rownr_t nold = oldIndex.nelements();
+  if (nold == 0  ||  nold > itsNrrow) {
+    return 0;
+  }
+  // The index has to contain each row once and the data must be in order.
+  Block<Bool> used(nold, False);
+  for (rownr_t i=0; i<nold; ++i) {
+    rownr_t row = oldIndex[i];
+    if (row >= nold  ||  used[row]) {
+      return 0;
+    }
+    used[row] = True;
+    if (i > 0  &&  compareRows (oldIndex[i-1], row) > 0) {
+      return 0;
+    }
+  }
+  return nold;
+}
+
+Int ColumnsIndex::compareRows (rownr_t row1, rownr_t row2) const
+{
+  for (uInt i=0; i<itsDataTypes.nelements(); i++) {
+    Int cmp = 0;
+    switch (itsDataTypes[i]) {
+    case TpBool:
+    {
+      const Bool* data = static_cast<const Bool*>(itsData[i]);
+      cmp = ObjCompare<Bool>::compare (data+row1, data+row2);
+      break;
+    }
+    case TpUChar:
+    {
+      const uChar* data = static_cast<const uChar*>(itsData[i]);
+      cmp = ObjCompare<uChar>::compare (data+row1, data+row2);
+      break;
+    }
+    case TpShort:
+    {
+      const Short* data = static_cast<const Short*>(itsData[i]);
+      cmp = ObjCompare<Short>::compare (data+row1, data+row2);
+      break;
+    }
+    case TpInt:
+    {
+      const Int* data = static_cast<const Int*>(itsData[i]);
+      cmp = ObjCompare<Int>::compare (data+row1, data+row2);
+      break;
+    }
+    case TpUInt:
+    {
+      const uInt* data = static_cast<const uInt*>(itsData[i]);
+      cmp = ObjCompare<uInt>::compare (data+row1, data+row2);
+      break;
+    }
+    case TpFloat:
+    {
+      const Float* data = static_cast<const Float*>(itsData[i]);
+      cmp = ObjCompare<Float>::compare (data+row1, data+row2);
+      break;
+    }
+    case TpDouble:
+    {
+      const Double* data = static_cast<const Double*>(itsData[i]);
+      cmp = ObjCompare<Double>::compare (data+row1, data+row2);
+      break;
+    }
+    case TpComplex:
+    {
+      const Complex* data = static_cast<const Complex*>(itsData[i]);
+      cmp = ObjCompare<Complex>::compare (data+row1, data+row2);
+      break;
+    }
+    case TpDComplex:
+    {
+      const DComplex* data = static_cast<const DComplex*>(itsData[i]);
+      cmp = ObjCompare<DComplex>::compare (data+row1, data+row2);
+      break;
+    }
+    case TpString:
+    {
+      const String* data = static_cast<const String*>(itsData[i]);
+      cmp = ObjCompare<String>::compare (data+row1, data+row2);
+      break;
+    }
+    }
+    if (cmp != 0) {
+      return cmp;
+    }
+  }
+  return 0;
+}
+
+String ColumnsIndex::indexFileName (const Table& table,
+                                    const Vector<String>& columnNames)
+{
+  String name = table.tableName() + "/table.index.";
+  for (uInt i=0; i<columnNames.nelements(); ++i) {
+    if (i > 0) {
+      name += ',';
+    }
+    name += columnNames[i];
+  }
+  return name;
+}
+
+Bool ColumnsIndex::canPersist (const Table& table)
+{
+  return (!table.isNull()  &&  table.isRootTable()  &&
+          table.tableType() == Table::Plain  &&
+          File(table.tableName()).isDirectory());
+}
+
+Bool ColumnsIndex::hasPersistentIndex (const Table& table,
+                                       const Vector<String>& columnNames)
+{
+  return (canPersist (table)  &&
+          File(indexFileName (table, columnNames)).exists());
+}
+
+void ColumnsIndex::removePersistentIndex (const Table& table,
+                                          const Vector<String>& columnNames)
+{
+  if (hasPersistentIndex (table, columnNames)) {
+    RegularFile (indexFileName (table, columnNames)).remove();
+  }
+}
+
+void ColumnsIndex::setPersistent (Bool persistent)
+{
+  itsPersistent = False;
+  if (persistent  &&  !itsNoSort  &&  canPersist (itsTable)) {
+    itsPersistent = True;
+    readData (True);
+  }
+}
+
+Vector<rownr_t> ColumnsIndex::readIndex() const
+{
+  Vector<rownr_t> index;
+  Vector<String> names = columnNames();
+  String fileName = indexFileName (itsTable, names);
+  if (File(fileName).exists()) {
+    // A file that cannot be read is ignored; the index is rebuilt.
+    try {
+      AipsIO aio(fileName);
+      uInt version = aio.getstart ("ColumnsIndex");
+      Vector<String> fileNames;
+      aio >> fileNames;
+      if (version == 1) {
+        // The first version stored the row numbers as uInt.
+        Vector<uInt> index32;
+        aio >> index32;
+        index.resize (index32.nelements());
+        convertArray (index, index32);
+      } else {
+        aio >> index;
+      }
+      aio.getend();
+      if (fileNames.nelements() != names.nelements()  ||
+          !allEQ (fileNames, names)) {
+        index.resize (0);
+      }
+    } catch (AipsError&) {
+      index.resize (0);
+    }
+  }
+  return index;
+}
+
+Bool ColumnsIndex::canWriteIndex() const
+{
+  // The index file is part of the table, so it can only be written if the
+  // table is writable.
+  // Note that a readonly table (e.g. queried by TaQL) uses the stored
+  // index, but never rewrites it.
+  return (itsTable.isWritable()  &&  File(itsTable.tableName()).isWritable());
+}
+
+void ColumnsIndex::writeIndex() const
+{
+  // The caller (readData) holds the write lock of the table.
+  // Write into a temporary file first, so another process reading the
+  // index never sees a partially written file.
+  Vector<String> names = columnNames();
+  String fileName = indexFileName (itsTable, names);
+  String tmpName = fileName + "_tmp";
+  try {
+    {
+      AipsIO aio(tmpName, ByteIO::New);
+      aio.putstart ("ColumnsIndex", 2);
+      aio << names << itsDataIndex;
+      aio.putend();
+    }
+    RegularFile(tmpName).move (fileName, True);
+  } catch (AipsError&) {
+    // Storing the index is an optimization, so ignore failures.
+  }
+}
+
 uInt ColumnsIndex::bsearch (Bool& found, const Block<void*>& fieldPtrs) const
 {
   found = False;
@@ -591,13 +896,13 @@ Int ColumnsIndex::compare (const Block<void*>& fieldPtrs,
   return 0;
 }
  
-uInt ColumnsIndex::getRowNumber (Bool& found, const Record& key)
+rownr_t ColumnsIndex::getRowNumber (Bool& found, const Record& key)
 {
   copyKey (itsLowerFields, key);
   return getRowNumber (found);
 }
 
-uInt ColumnsIndex::getRowNumber (Bool& found)
+rownr_t ColumnsIndex::getRowNumber (Bool& found)
 {
   if (!isUnique()) {
     throw (TableError ("ColumnsIndex::getRowNumber only possible "
@@ -605,7 +910,7 @@ uInt ColumnsIndex::getRowNumber (Bool& found)
   }
   // Read the data (if needed).
   readData();
-  uInt inx = bsearch (found, itsLowerFields);
+  rownr_t inx = bsearch (found, itsLowerFields);
   if (found) {
     inx = itsDataInx[inx];
   }
@@ -679,10 +984,10 @@ void ColumnsIndex::fillRowNumbers (Vector<uInt>& rows,
   }
   uInt nr = end-start;
   rows.resize (nr);
-  Bool deleteIt;
-  uInt* rowStorage = rows.getStorage (deleteIt);
-  objcopy (rowStorage, itsDataInx+start, nr);
-  rows.putStorage (rowStorage, deleteIt);
+  // The public interface still returns the row numbers as uInt.
+  for (uInt i=0; i<nr; ++i) {
+    rows[i] = itsDataInx[start+i];
+  }
 }
 
 void ColumnsIndex::setChanged()
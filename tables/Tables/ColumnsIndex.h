@@ -41,6 +41,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Forward Declarations
 class String;
 class TableColumn;
+class Sort;
 template<typename T> class RecordFieldPtr;
 
 // <summary>
@@ -110,6 +111,25 @@ template<typename T> class RecordFieldPtr;
 // <br>If data have changed, the entire index will be recreated by
 // rereading and optionally resorting the data. This will be deferred
 // until the next key lookup.
+// <p>
+// The index can be made persistent using function <src>setPersistent</src>.
+// In that case the sort order of the index is stored in a file
+// <src>table.index.col1,col2,...</src> in the table directory.
+// When a ColumnsIndex is created for the same columns thereafter, the
+// sort order is read from that file, so the (expensive) sort step is not
+// needed. Because it cannot be known if the table data have been changed
+// in the meantime, the stored order is checked against the data read
+// (which takes linear time). If rows have been added, only the new rows
+// are sorted and merged into the stored order. If the check fails
+// (e.g. because column data have changed), the data are fully resorted.
+// Whenever the sort order changes, the file is rewritten (while holding
+// the table's write lock), so it stays up-to-date with the table.
+// The file is not rewritten if the table is not writable, for instance
+// when it is opened readonly for a query. Only (non-selection) tables
+// stored on disk can have a persistent index.
+// <br>A TaQL WHERE clause comparing a column with constants
+// (e.g. <src>TIME BETWEEN t1 AND t2</src>) uses a persistent index on
+// that column (if it exists) to find the rows to test.
 // </synopsis>
 
 // <example>
@@ -213,7 +233,7 @@ template<typename T> class RecordFieldPtr;
 //     // Fill the key field.
 //     *time = ...;
 //     // Find the row number for this time.
-//     uInt rownr = colInx.getRowNumber (found);
+//     rownr_t rownr = colInx.getRowNumber (found);
 // }
 // </srcblock>
 // </example>
@@ -307,8 +327,8 @@ public:
     // functions. Note that the given Record will be copied to the internal
     // record, thus overwrites it.
     // <group>
-    uInt getRowNumber (Bool& found);
-    uInt getRowNumber (Bool& found, const Record& key);
+    rownr_t getRowNumber (Bool& found);
+    rownr_t getRowNumber (Bool& found, const Record& key);
     // </group>
 
     // Find the row numbers matching the key. It should be used instead
@@ -339,6 +359,28 @@ public:
     // The data type may differ.
     static void copyKeyField (void* field, int dtype, const Record& key);
 
+    // Make the index persistent or not.
+    // If made persistent, the sort order is written into the table directory
+    // and kept up-to-date. If made non-persistent, the stored sort order is
+    // not used and updated anymore (but not removed).
+    // <br>An index created with <src>noSort=True</src> cannot be persistent.
+    // Nothing is done if the table is not stored on disk.
+    // The sort order is only written if the table is writable.
+    void setPersistent (Bool persistent = True);
+
+    // Is the index persistent?
+    // It is automatically the case if a persistent index for the columns
+    // already existed when constructing this object.
+    Bool isPersistent() const;
+
+    // Test if a persistent index for the given columns exists in the table.
+    static Bool hasPersistentIndex (const Table&,
+                                    const Vector<String>& columnNames);
+
+    // Remove a persistent index for the given columns from the table.
+    static void removePersistentIndex (const Table&,
+                                       const Vector<String>& columnNames);
+
 protected:
     // Copy that object to this.
     void copy (const ColumnsIndex& that);
@@ -359,7 +401,9 @@ protected:
 
     // Read the data of the columns forming the index, sort them and
     // form the index.
-    void readData();
+    // If <src>storeIndex</src> is True, the persistent index is stored
+    // even if the sort order has not changed.
+    void readData (Bool storeIndex = False);
 
     // Do a binary search on <src>itsUniqueIndex</src> for the key in
     // <src>fieldPtrs</src>.
@@ -380,6 +424,37 @@ protected:
     // <src>itsUniqueIndex</src> vector (end is not inclusive).
     void fillRowNumbers (Vector<uInt>& rows, uInt start, uInt end) const;
 
+    // Sort the data (which have been read) and fill <src>itsDataIndex</src>.
+    // The old sort order is reused if still valid.
+    // It returns True if a new sort order has been made.
+    Bool sortData (Sort& sort);
+
+    // Return the number of entries in the old sort order if it is a valid
+    // sort order of the first rows in the data. Otherwise return 0.
+    rownr_t validSortSize (const Vector<rownr_t>& oldIndex) const;
+
+    // Compare the data of the keys in the given rows.
+    // -1 is returned when less, 0 when equal, 1 when greater.
+    Int compareRows (rownr_t row1, rownr_t row2) const;
+
+    // Get the name of the file containing the persistent index.
+    static String indexFileName (const Table&,
+                                 const Vector<String>& columnNames);
+
+    // Can the index of the table be made persistent?
+    static Bool canPersist (const Table&);
+
+    // Read the persistent sort order. An empty vector is returned if
+    // it does not exist or cannot be read.
+    Vector<rownr_t> readIndex() const;
+
+    // Can the persistent index file be written?
+    Bool canWriteIndex() const;
+
+    // Write the sort order into the persistent index file.
+    // The caller must hold the write lock of the table.
+    void writeIndex() const;
+
 private:
     // Fill the internal key fields from the corresponding external key.
     void copyKey (Block<void*> fields, const Record& key);
@@ -393,7 +468,7 @@ private:
     }
 
     Table  itsTable;
-    uInt   itsNrrow;
+    rownr_t   itsNrrow;
     Record* itsLowerKeyPtr;
     Record* itsUpperKeyPtr;
     Block<Int>   itsDataTypes;
@@ -406,12 +481,13 @@ private:
     Block<Bool>  itsColumnChanged;
     Bool         itsChanged;
     Bool         itsNoSort;            //# True = sort is not needed
+    Bool         itsPersistent;        //# True = keep index in table dir
     Compare*     itsCompare;           //# Compare function
-    Vector<uInt> itsDataIndex;         //# Row numbers of all keys
+    Vector<rownr_t> itsDataIndex;      //# Row numbers of all keys
     //# Indices in itsDataIndex for each unique key
-    Vector<uInt> itsUniqueIndex;
-    uInt*        itsDataInx;           //# pointer to data in itsDataIndex
-    uInt*        itsUniqueInx;         //# pointer to data in itsUniqueIndex
+    Vector<rownr_t> itsUniqueIndex;
+    rownr_t*     itsDataInx;           //# pointer to data in itsDataIndex
+    rownr_t*     itsUniqueInx;         //# pointer to data in itsUniqueIndex
 };
 
 
@@ -423,6 +499,10 @@ inline const Table& ColumnsIndex::table() const
 {
     return itsTable;
 }
+inline Bool ColumnsIndex::isPersistent() const
+{
+    return itsPersistent;
+}
 inline Record& ColumnsIndex::accessKey()
 {
     return *itsLowerKeyPtr;
@@ -206,7 +206,7 @@ void ColumnsIndexArray::readData()
 {
   // Acquire a lock if needed.
   TableLocker locker(itsTable, FileLocker::Read);
-  uInt nrrow = itsTable.nrow();
+  rownr_t nrrow = itsTable.nrow();
   if (nrrow != itsNrrow) {
     itsChanged = True;
     itsNrrow = nrrow;
@@ -363,13 +363,13 @@ Int ColumnsIndexArray::compare (void* fieldPtr,
   return 0;
 }
  
-uInt ColumnsIndexArray::getRowNumber (Bool& found, const Record& key)
+rownr_t ColumnsIndexArray::getRowNumber (Bool& found, const Record& key)
 {
   ColumnsIndex::copyKeyField (itsLowerField, itsDataType, key);
   return getRowNumber (found);
 }
 
-uInt ColumnsIndexArray::getRowNumber (Bool& found)
+rownr_t ColumnsIndexArray::getRowNumber (Bool& found)
 {
   if (!isUnique()) {
     throw (TableError ("ColumnsIndexArray::getRowNumber only possible "
@@ -462,7 +462,7 @@ void ColumnsIndexArray::fillRowNumbers (Vector<uInt>& rows,
   }
   rows.putStorage (rowStorage, deleteIt);
   if (unique) {
-    uInt nrrow = GenSort<uInt>::sort (rows, Sort::Ascending,
+    rownr_t nrrow = GenSort<uInt>::sort (rows, Sort::Ascending,
 				      Sort::NoDuplicates);
     rows.resize (nrrow, True);
   }
@@ -485,7 +485,7 @@ void ColumnsIndexArray::setChanged (const String& columnName)
 void ColumnsIndexArray::getArray (Vector<uChar>& result, const String& name)
 {
   ArrayColumn<uChar> arrCol (itsTable, name);
-  uInt nrrow = arrCol.nrow();
+  rownr_t nrrow = arrCol.nrow();
   if (nrrow > 0) {
     Block<uInt> nrel(nrrow, uInt(0));
     Array<uChar> arr = arrCol(0);
@@ -517,7 +517,7 @@ void ColumnsIndexArray::getArray (Vector<uChar>& result, const String& name)
 void ColumnsIndexArray::getArray (Vector<Short>& result, const String& name)
 {
   ArrayColumn<Short> arrCol (itsTable, name);
-  uInt nrrow = arrCol.nrow();
+  rownr_t nrrow = arrCol.nrow();
   if (nrrow > 0) {
     Block<uInt> nrel(nrrow, uInt(0));
     Array<Short> arr = arrCol(0);
@@ -549,7 +549,7 @@ void ColumnsIndexArray::getArray (Vector<Short>& result, const String& name)
 void ColumnsIndexArray::getArray (Vector<Int>& result, const String& name)
 {
   ArrayColumn<Int> arrCol (itsTable, name);
-  uInt nrrow = arrCol.nrow();
+  rownr_t nrrow = arrCol.nrow();
   if (nrrow > 0) {
     Block<uInt> nrel(nrrow, uInt(0));
     Array<Int> arr = arrCol(0);
@@ -581,7 +581,7 @@ void ColumnsIndexArray::getArray (Vector<Int>& result, const String& name)
 void ColumnsIndexArray::getArray (Vector<uInt>& result, const String& name)
 {
   ArrayColumn<uInt> arrCol (itsTable, name);
-  uInt nrrow = arrCol.nrow();
+  rownr_t nrrow = arrCol.nrow();
   if (nrrow > 0) {
     Block<uInt> nrel(nrrow, uInt(0));
     Array<uInt> arr = arrCol(0);
@@ -613,7 +613,7 @@ void ColumnsIndexArray::getArray (Vector<uInt>& result, const String& name)
 void ColumnsIndexArray::getArray (Vector<String>& result, const String& name)
 {
   ArrayColumn<String> arrCol (itsTable, name);
-  uInt nrrow = arrCol.nrow();
+  rownr_t nrrow = arrCol.nrow();
   if (nrrow > 0) {
     Block<uInt> nrel(nrrow, uInt(0));
     Array<String> arr = arrCol(0);
@@ -127,7 +127,7 @@ class TableColumn;
 // // NAME is a unique key, so only one row number matches.
 // // Otherwise function getRowNumbers had to be used.
 // *nameFld = "MYNAME";
-// uInt rownr = colInx.getRowNumber (found);
+// rownr_t rownr = colInx.getRowNumber (found);
 // if (!found) {
 //     cout << "Name MYNAME is unknown" << endl;
 // }
@@ -203,8 +203,8 @@ public:
   // functions. Note that the given Record will be copied to the internal
   // record, thus overwrites it.
   // <group>
-  uInt getRowNumber (Bool& found);
-  uInt getRowNumber (Bool& found, const Record& key);
+  rownr_t getRowNumber (Bool& found);
+  rownr_t getRowNumber (Bool& found, const Record& key);
   // </group>
 
   // Find the row numbers matching the key. It should be used instead
@@ -298,7 +298,7 @@ protected:
 
 private:
   Table  itsTable;
-  uInt   itsNrrow;
+  rownr_t   itsNrrow;
   Record* itsLowerKeyPtr;
   Record* itsUpperKeyPtr;
   Int     itsDataType;
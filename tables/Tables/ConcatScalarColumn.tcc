@@ -51,9 +51,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void ConcatScalarColumn<T>::getScalarColumn (void* dataPtr) const
   {
     Vector<T>& vec = *static_cast<Vector<T>*>(dataPtr);
-    uInt st = 0;
+    rownr_t st = 0;
     for (uInt i=0; i<refColPtr_p.nelements(); ++i) {
-      uInt nr = refColPtr_p[i]->nrow();
+      rownr_t nr = refColPtr_p[i]->nrow();
       Vector<T> part = vec(Slice(st, nr));
       refColPtr_p[i]->getScalarColumn (&part);
       st += nr;
@@ -69,16 +69,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Vector<T>& vec = *static_cast<Vector<T>*>(dataPtr);
     // Get the rownrs as a vector and sort it.
     // In this way the data will be read in sequential order.
-    Vector<uInt> rows = rownrs.convert();
+    Vector<rownr_t> rows = rownrs.convert();
     Vector<uInt> inx;
-    GenSortIndirect<uInt>::sort (inx, rows);
+    GenSortIndirect<rownr_t>::sort (inx, rows);
     const ConcatRows& ccRows = refTabPtr_p->rows();
-    uInt tabRownr;
+    rownr_t tabRownr;
     uInt tableNr=0;
     // Map each row to rownr and tablenr.
     // Note this is pretty fast because it is done in row order.
     for (uInt i=0; i<inx.nelements(); ++i) {
-      uInt row = inx[i];
+      rownr_t row = inx[i];
       ccRows.mapRownr (tableNr, tabRownr, rows[row]);
       refColPtr_p[tableNr]->get (tabRownr, &(vec[row]));
     }
@@ -90,9 +90,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void ConcatScalarColumn<T>::putScalarColumn (const void* dataPtr)
   {
     Vector<T> vec (*static_cast<const Vector<T>*>(dataPtr));
-    uInt st = 0;
+    rownr_t st = 0;
     for (uInt i=0; i<refColPtr_p.nelements(); ++i) {
-      uInt nr = refColPtr_p[i]->nrow();
+      rownr_t nr = refColPtr_p[i]->nrow();
       Vector<T> part = vec(Slice(st, nr));
       refColPtr_p[i]->putScalarColumn (&part);
       st += nr;
@@ -108,16 +108,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     const Vector<T>& vec = *static_cast<const Vector<T>*>(dataPtr);
     // Get the rownrs as a vector and sort it.
     // In this way the data will be read in sequential order.
-    Vector<uInt> rows = rownrs.convert();
+    Vector<rownr_t> rows = rownrs.convert();
     Vector<uInt> inx;
-    GenSortIndirect<uInt>::sort (inx, rows);
+    GenSortIndirect<rownr_t>::sort (inx, rows);
     const ConcatRows& ccRows = refTabPtr_p->rows();
-    uInt tabRownr;
+    rownr_t tabRownr;
     uInt tableNr=0;
     // Map each row to rownr and tablenr.
     // Note this is pretty fast because it is done in row order.
     for (uInt i=0; i<inx.nelements(); ++i) {
-      uInt row = inx[i];
+      rownr_t row = inx[i];
       ccRows.mapRownr (tableNr, tabRownr, rows[row]);
       refColPtr_p[tableNr]->put (tabRownr, &(vec[row]));
     }
@@ -147,7 +147,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void ConcatScalarColumn<T>::makeRefSortKey (Sort& sortobj,
                                               CountedPtr<BaseCompare>& cmpObj,
 					      Int order,
-					      const Vector<uInt>& rownrs,
+					      const Vector<rownr_t>& rownrs,
 					      const void*& dataSave)
   {
     //# Get the data as a column.
@@ -170,7 +170,7 @@ Bool NullTable::canAddRow() const
   return False;
 }
 
-void NullTable::addRow (uInt, Bool)
+void NullTable::addRow (rownr_t, Bool)
 {
   throwError ("addRow");
 }
@@ -181,7 +181,7 @@ Bool NullTable::canRemoveRow() const
   return False;
 }
 
-void NullTable::removeRow (uInt)
+void NullTable::removeRow (rownr_t)
 {
   throwError ("removeRow");
 }
@@ -242,10 +242,10 @@ void NullTable::renameHypercolumn (const String&, const String&)
   throwError ("renameHypercolumn");
 }
 
-Vector<uInt> NullTable::rowNumbers() const
+Vector<rownr_t> NullTable::rowNumbers() const
 {
   throwError ("rowNumbers");
-  return Vector<uInt>();
+  return Vector<rownr_t>();
 }
 
 BaseTable* NullTable::root()
@@ -260,13 +260,13 @@ Bool NullTable::rowOrder() const
   return False;
 }
 
-Vector<uInt>* NullTable::rowStorage()
+Vector<rownr_t>* NullTable::rowStorage()
 {
   throwError ("rowStorage");
   return 0;
 }
 
-Bool NullTable::adjustRownrs (uInt, Vector<uInt>&,
+Bool NullTable::adjustRownrs (rownr_t, Vector<rownr_t>&,
 			      Bool) const
 {
   throwError ("adjustRownrs");
@@ -55,7 +55,7 @@ PlainColumn::~PlainColumn()
 {}
 
 
-uInt PlainColumn:: nrow() const
+rownr_t PlainColumn:: nrow() const
     { return colSetPtr_p->nrow(); }
 
 
@@ -101,6 +101,23 @@ ColumnCache& PlainColumn::columnCache()
 void PlainColumn::setMaximumCacheSize (uInt nbytes)
     { dataManPtr_p->setMaximumCacheSize (nbytes); }
 
+Bool PlainColumn::getZoneMap (Vector<rownr_t>& startRows,
+                              Vector<Double>& minValues,
+                              Vector<Double>& maxValues) const
+    { return dataColPtr_p->getZoneMap (startRows, minValues, maxValues); }
+
+Bool PlainColumn::prepareConcurrentGet (uInt nthreads)
+{
+    if (nthreads > 1) {
+        colSetPtr_p->checkReadLock (True);
+    }
+    return dataColPtr_p->prepareConcurrentGet (nthreads);
+}
+
+void PlainColumn::getScalarCellsConcurrent (const rownr_t* rownrs,
+                                            size_t nrow, void* dataPtr) const
+    { dataColPtr_p->getScalarCellsConcurrentV (rownrs, nrow, dataPtr); }
+
 
 //# Read/write the column.
 //# Its data will be read/written by the appropriate storage manager.
@@ -104,7 +104,7 @@ public:
     // </group>
 
     // Get nr of rows in the column.
-    uInt nrow() const;
+    rownr_t nrow() const;
 
     // Define the shape of all arrays in the column.
     virtual void setShapeColumn (const IPosition& shape);
@@ -131,6 +131,20 @@ public:
     // Set the maximum cache size (in bytes) to be used by a storage manager.
     virtual void setMaximumCacheSize (uInt nbytes);
 
+    // Get the zone map of the column from its data manager.
+    virtual Bool getZoneMap (Vector<rownr_t>& startRows,
+                             Vector<Double>& minValues,
+                             Vector<Double>& maxValues) const;
+
+    // Prepare the data manager column for concurrent reading.
+    // The table is read-locked (if needed) and synchronized first,
+    // because the concurrent get functions do not check the lock.
+    virtual Bool prepareConcurrentGet (uInt nthreads);
+
+    // Get scalar values concurrently from the data manager column.
+    virtual void getScalarCellsConcurrent (const rownr_t* rownrs, size_t nrow,
+                                           void* dataPtr) const;
+
     // Write the column.
     void putFile (AipsIO&, const TableAttr&);
 
@@ -50,7 +50,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 TableCache PlainTable::theirTableCache;
 
 
-PlainTable::PlainTable (SetupNewTable& newtab, uInt nrrow, Bool initialize,
+PlainTable::PlainTable (SetupNewTable& newtab, rownr_t nrrow, Bool initialize,
 			const TableLock& lockOptions, int endianFormat,
                         const TSMOption& tsmOption)
 : BaseTable      (newtab.name(), newtab.option(), 0),
@@ -151,7 +151,7 @@ PlainTable::PlainTable (SetupNewTable& newtab, uInt nrrow, Bool initialize,
 
 
 PlainTable::PlainTable (AipsIO&, uInt version, const String& tabname,
-			const String& type, uInt nrrow, int opt,
+			const String& type, rownr_t nrrow, int opt,
 			const TableLock& lockOptions,
                         const TSMOption& tsmOption,
 			Bool addToCache, uInt locknr)
@@ -194,12 +194,9 @@ PlainTable::PlainTable (AipsIO&, uInt version, const String& tabname,
     //# FilebufIO should do its own buffering and have a sync function.
     AipsIO ios (Table::fileName(tabname), ByteIO::Old);
     String tp;
-    version = ios.getstart ("Table");
     uInt format;
-    ios >> nrrow;
-    ios >> format;
+    version = readStart (ios, nrrow, format, tp);
     bigEndian_p = (format==0);
-    ios >> tp;
 #if defined(TABLEREPAIR)
     cerr << "tableRepair: found " << nrrow << " rows; give new number: ";
     cin >> nrrow_p;
@@ -403,7 +400,7 @@ Bool PlainTable::lock (FileLocker::LockType type, uInt nattempts)
 	    // Older readonly table files may have empty locksync data.
 	    // Skip the sync-ing in that case.
 	    uInt ncolumn;
-            uInt nrrow;
+            rownr_t nrrow;
 	    if (! lockSync_p.read (nrrow, ncolumn, tableChanged,
 				   colSetPtr_p->dataManChanged())) {
 		tableChanged = False;
@@ -467,6 +464,11 @@ uInt PlainTable::getModifyCounter() const
     return lockSync_p.getModifyCounter();
 }
 
+uInt PlainTable::getDataModifyCounter() const
+{
+    return lockSync_p.getDataModifyCounter();
+}
+
 
 void PlainTable::flush (Bool fsync, Bool recursive)
 {
@@ -487,7 +489,7 @@ void PlainTable::resync()
     // Older readonly table files may have empty locksync data.
     // Skip the sync-ing in that case.
     uInt ncolumn;
-    uInt nrrow;
+    rownr_t nrrow;
     if (! lockSync_p.read (nrrow, ncolumn, tableChanged,
 			   colSetPtr_p->dataManChanged())) {
         tableChanged = False;
@@ -633,7 +635,7 @@ Bool PlainTable::canRenameColumn (const String& columnName) const
 
 
 //# Add rows.
-void PlainTable::addRow (uInt nrrw, Bool initialize)
+void PlainTable::addRow (rownr_t nrrw, Bool initialize)
 {
     if (nrrw > 0) {
         checkWritable("addRow");
@@ -651,7 +653,7 @@ void PlainTable::addRow (uInt nrrw, Bool initialize)
     }
 }
 
-void PlainTable::removeRow (uInt rownr)
+void PlainTable::removeRow (rownr_t rownr)
 {
     checkWritable("rowmoveRow");
     //# Locking has to be done here, otherwise nrrow_p is not up-to-date
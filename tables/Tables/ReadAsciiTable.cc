@@ -654,7 +654,7 @@ Bool ReadAsciiTable::getValue (char* string1, Int lineSize, char* first,
 void ReadAsciiTable::handleScalar (char* string1, Int lineSize, char* first,
 				   Int& at1, Char separator,
 				   Int type,
-				   TableColumn& tabcol, uInt rownr)
+				   TableColumn& tabcol, rownr_t rownr)
 {
   switch (type) {
   case RATBool:
@@ -967,7 +967,7 @@ void ReadAsciiTable::handleArray (char* string1, Int lineSize, char* first,
 				  Int& at1, Char separator,
 				  const IPosition& shape, Int varAxis,
 				  Int type,
-				  TableColumn& tabcol, uInt rownr)
+				  TableColumn& tabcol, rownr_t rownr)
 {
   switch (type) {
   case RATBool:
@@ -1358,7 +1358,7 @@ Table ReadAsciiTable::makeTab (String& formatString,
     for (Int i=0; i<nrcol; i++) {
 	tabcol[i].reference (TableColumn (tab, nameOfColumn[i]));
     }
-    uInt rownr = 0;
+    rownr_t rownr = 0;
 
 // OK, Now we have real data
 // stringsav may contain the first data line.
@@ -30,6 +30,7 @@
 #include <casacore/tables/Tables/RefTable.h>
 #include <casacore/tables/Tables/RefRows.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -57,22 +58,22 @@ TableRecord& RefColumn::keywordSet()
     { return colPtr_p->keywordSet(); }
 
 
-uInt RefColumn::nrow() const
+rownr_t RefColumn::nrow() const
     { return refTabPtr_p->nrow(); }
 
-void RefColumn::initialize (uInt startRow, uInt endRow)
+void RefColumn::initialize (rownr_t startRow, rownr_t endRow)
 {
-    uInt rownr;
+    rownr_t rownr;
     for (uInt i=startRow; i<endRow; i++) {
 	rownr = refTabPtr_p->rootRownr(i);
 	colPtr_p->initialize (rownr, rownr);
     }
 }
 
-void RefColumn::setShape (uInt rownr, const IPosition& shape)
+void RefColumn::setShape (rownr_t rownr, const IPosition& shape)
     { colPtr_p->setShape (refTabPtr_p->rootRownr(rownr), shape); }
 
-void RefColumn::setShape (uInt rownr, const IPosition& shape,
+void RefColumn::setShape (rownr_t rownr, const IPosition& shape,
 			  const IPosition& tileShape)
     { colPtr_p->setShape (refTabPtr_p->rootRownr(rownr), shape, tileShape); }
 
@@ -82,13 +83,13 @@ uInt RefColumn::ndimColumn() const
 IPosition RefColumn::shapeColumn() const
     { return colPtr_p->shapeColumn(); }
 
-uInt RefColumn::ndim (uInt rownr) const
+uInt RefColumn::ndim (rownr_t rownr) const
     { return colPtr_p->ndim (refTabPtr_p->rootRownr(rownr)); }
 
-IPosition RefColumn::shape(uInt rownr) const
+IPosition RefColumn::shape(rownr_t rownr) const
     { return colPtr_p->shape (refTabPtr_p->rootRownr(rownr)); }
 
-Bool RefColumn::isDefined (uInt rownr) const
+Bool RefColumn::isDefined (rownr_t rownr) const
     { return colPtr_p->isDefined (refTabPtr_p->rootRownr(rownr)); }
 
 
@@ -117,16 +118,16 @@ Bool RefColumn::canChangeShape() const
     { return colPtr_p->canChangeShape(); }
 
 
-void RefColumn::get (uInt rownr, void* dataPtr) const
+void RefColumn::get (rownr_t rownr, void* dataPtr) const
     { colPtr_p->get (refTabPtr_p->rootRownr(rownr), dataPtr); }
 
-void RefColumn::getSlice (uInt rownr, const Slicer& ns, void* dataPtr) const
+void RefColumn::getSlice (rownr_t rownr, const Slicer& ns, void* dataPtr) const
     { colPtr_p->getSlice (refTabPtr_p->rootRownr(rownr), ns, dataPtr); }
 
-void RefColumn::put (uInt rownr, const void* dataPtr)
+void RefColumn::put (rownr_t rownr, const void* dataPtr)
     { colPtr_p->put (refTabPtr_p->rootRownr(rownr), dataPtr); }
 
-void RefColumn::putSlice (uInt rownr, const Slicer& ns, const void* dataPtr)
+void RefColumn::putSlice (rownr_t rownr, const Slicer& ns, const void* dataPtr)
     { colPtr_p->putSlice (refTabPtr_p->rootRownr(rownr), ns, dataPtr); }
 
 void RefColumn::getScalarColumn (void* dataPtr) const
@@ -201,6 +202,24 @@ ColumnCache& RefColumn::columnCache()
 void RefColumn::setMaximumCacheSize (uInt nbytes)
     { colPtr_p->setMaximumCacheSize (nbytes); }
 
+Bool RefColumn::prepareConcurrentGet (uInt nthreads)
+    { return colPtr_p->prepareConcurrentGet (nthreads); }
+
+void RefColumn::getScalarCellsConcurrent (const rownr_t* rownrs, size_t nrow,
+                                          void* dataPtr) const
+{
+    if (nrow == 1) {
+        rownr_t rownr = refTabPtr_p->rootRownr (rownrs[0]);
+        colPtr_p->getScalarCellsConcurrent (&rownr, 1, dataPtr);
+    } else {
+        std::vector<rownr_t> rows(nrow);
+        for (size_t i=0; i<nrow; ++i) {
+            rows[i] = refTabPtr_p->rootRownr (rownrs[i]);
+        }
+        colPtr_p->getScalarCellsConcurrent (&rows[0], nrow, dataPtr);
+    }
+}
+
 
 void RefColumn::makeSortKey (Sort& sortobj, CountedPtr<BaseCompare>& cmpObj,
 			     Int order, const void*& dataSave)
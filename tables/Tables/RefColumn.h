@@ -113,16 +113,16 @@ public:
     // </group>
 
     // Get nr of rows in the column.
-    virtual uInt nrow() const;
+    virtual rownr_t nrow() const;
 
     // Test if a value in a particular cell has been defined.
-    virtual Bool isDefined (uInt rownr) const;
+    virtual Bool isDefined (rownr_t rownr) const;
 
     // Set the shape of the array in the given row.
-    virtual void setShape (uInt rownr, const IPosition& shape);
+    virtual void setShape (rownr_t rownr, const IPosition& shape);
 
     // Set the shape and tile shape of the array in the given row.
-    virtual void setShape (uInt rownr, const IPosition& shape,
+    virtual void setShape (rownr_t rownr, const IPosition& shape,
 			   const IPosition& tileShape);
 
     // Get the global #dimensions of an array (i.e. for all rows).
@@ -132,10 +132,10 @@ public:
     virtual IPosition shapeColumn() const;
 
     // Get the #dimensions of an array in a particular cell.
-    virtual uInt ndim (uInt rownr) const;
+    virtual uInt ndim (rownr_t rownr) const;
 
     // Get the shape of an array in a particular cell.
-    virtual IPosition shape (uInt rownr) const;
+    virtual IPosition shape (rownr_t rownr) const;
 
     // It can change shape if the underlying column can.
     virtual Bool canChangeShape() const;
@@ -165,14 +165,14 @@ public:
 
     // Initialize the rows from startRownr till endRownr (inclusive)
     // with the default value defined in the column description (if defined).
-    void initialize (uInt startRownr, uInt endRownr);
+    void initialize (rownr_t startRownr, rownr_t endRownr);
 
     // Get the value from a particular cell.
     // This can be a scalar or an array.
-    virtual void get (uInt rownr, void* dataPtr) const;
+    virtual void get (rownr_t rownr, void* dataPtr) const;
 
     // Get a slice of an N-dimensional array in a particular cell.
-    virtual void getSlice (uInt rownr, const Slicer&, void* dataPtr) const;
+    virtual void getSlice (rownr_t rownr, const Slicer&, void* dataPtr) const;
 
     // Get the vector of all scalar values in a column.
     virtual void getScalarColumn (void* dataPtr) const;
@@ -205,10 +205,10 @@ public:
 
     // Put the value in a particular cell.
     // This can be a scalar or an array.
-    virtual void put (uInt rownr, const void* dataPtr);
+    virtual void put (rownr_t rownr, const void* dataPtr);
 
     // Put a slice of an N-dimensional array in a particular cell.
-    virtual void putSlice (uInt rownr, const Slicer&, const void* dataPtr);
+    virtual void putSlice (rownr_t rownr, const Slicer&, const void* dataPtr);
 
     // Put the vector of all scalar values in the column.
     virtual void putScalarColumn (const void* dataPtr);
@@ -245,6 +245,14 @@ public:
     // Set the maximum cache size (in bytes) to be used by a storage manager.
     virtual void setMaximumCacheSize (uInt nbytes);
 
+    // Prepare the referenced column for concurrent reading.
+    virtual Bool prepareConcurrentGet (uInt nthreads);
+
+    // Get scalar values concurrently from the referenced column.
+    // The row numbers are converted to row numbers in the referenced column.
+    virtual void getScalarCellsConcurrent (const rownr_t* rownrs, size_t nrow,
+                                           void* dataPtr) const;
+
     // Add this column and its data to the Sort object.
     // It may allocate some storage on the heap, which will be saved
     // in the argument dataSave.
@@ -45,7 +45,7 @@ public:
     ColumnHolder(Table &inTab, const Table &outTab);
     ~ColumnHolder();
     void attach(const String &outCol, const String &inCol);
-    Bool copy(uInt toRow, uInt fromRow);
+    Bool copy(rownr_t toRow, rownr_t fromRow);
 private:
     //# The following constructors and operator don't seem to be useful
     ColumnHolder();
@@ -107,7 +107,7 @@ void ColumnHolder::attach(const String &outCol, const String &inCol)
     }
 }
 
-Bool ColumnHolder::copy(uInt toRow, uInt fromRow)
+Bool ColumnHolder::copy(rownr_t toRow, rownr_t fromRow)
 {
     uInt i;
     if (fromRow >= in.nrow() || toRow >= out.nrow()) {
@@ -156,7 +156,7 @@ RowCopier::RowCopier(Table &out, const Table &in,
     }
 }
 
-Bool RowCopier::copy(uInt toRow, uInt fromRow)
+Bool RowCopier::copy(rownr_t toRow, rownr_t fromRow)
 {
     return columns_p->copy(toRow, fromRow);
 }
@@ -0,0 +1,93 @@
+//# RowNumbers.cc: Vector of row numbers
+//# Copyright (C) 2015
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+//# Includes
+#include <casacore/tables/Tables/RowNumbers.h>
+#include <casacore/tables/Tables/TableError.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+RowNumbers::RowNumbers (const std::vector<rownr_t>& rows)
+  : Vector<rownr_t> (rows.size())
+{
+  for (size_t i=0; i<rows.size(); ++i) {
+    (*this)[i] = rows[i];
+  }
+}
+
+RowNumbers::RowNumbers (const Vector<uInt>& rows)
+  : Vector<rownr_t> (convertRownrs(rows))
+{}
+
+RowNumbers::RowNumbers (const std::vector<uInt>& rows)
+  : Vector<rownr_t> (rows.size())
+{
+  for (size_t i=0; i<rows.size(); ++i) {
+    (*this)[i] = rows[i];
+  }
+}
+
+RowNumbers::operator Vector<uInt>() const
+{
+  return convertRownrs (*this);
+}
+
+Vector<uInt> RowNumbers::convertRownrs (const Vector<rownr_t>& rows)
+{
+  Vector<uInt> vec(rows.size());
+  Bool deleteIt;
+  const rownr_t* in = rows.getStorage (deleteIt);
+  uInt* out = vec.data();
+  for (size_t i=0; i<vec.size(); ++i) {
+    if (in[i] > 4294967295u) {
+      rownr_t rownr = in[i];
+      rows.freeStorage (in, deleteIt);
+      throw TableError ("RowNumbers: row number " +
+                        String::toString(rownr) +
+                        " exceeds 32 bits; use Vector<rownr_t>");
+    }
+    out[i] = in[i];
+  }
+  rows.freeStorage (in, deleteIt);
+  return vec;
+}
+
+Vector<rownr_t> RowNumbers::convertRownrs (const Vector<uInt>& rows)
+{
+  Vector<rownr_t> vec(rows.size());
+  Bool deleteIt;
+  const uInt* in = rows.getStorage (deleteIt);
+  rownr_t* out = vec.data();
+  for (size_t i=0; i<vec.size(); ++i) {
+    out[i] = in[i];
+  }
+  rows.freeStorage (in, deleteIt);
+  return vec;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,128 @@
+//# RowNumbers.h: Vector of row numbers
+//# Copyright (C) 2015
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: aips2-request@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+//#
+//# $Id$
+
+#ifndef TABLES_ROWNUMBERS_H
+#define TABLES_ROWNUMBERS_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Vector of row numbers
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="UNKNOWN" date="" tests="tRefRows.cc">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=Vector>Vector</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Row numbers in tables are 64-bit values (type <src>rownr_t</src>),
+// so tables can contain more than 4 billion rows.
+// RowNumbers is a <src>Vector<rownr_t></src> that can also be constructed
+// from (and converted to) a <src>Vector<uInt></src>. In this way code
+// using 32-bit row numbers in functions like
+// <src>Table::operator()</src> or <src>Table::rowNumbers</src> still works.
+// <br>Converting to a <src>Vector<uInt></src> throws an exception if
+// a row number does not fit in 32 bits.
+// </synopsis>
+
+// <example>
+// <srcblock>
+//   Table tab("my.tab");
+//   // Select the first 10 rows.
+//   Vector<uInt> rows(10);
+//   indgen (rows);
+//   Table sel = tab(rows);
+//   // Get the row numbers in the original table.
+//   RowNumbers rownrs = sel.rowNumbers();
+// </srcblock>
+// </example>
+
+class RowNumbers : public Vector<rownr_t>
+{
+public:
+    // Construct an empty vector.
+    RowNumbers()
+      {}
+
+    // Construct with the given number of elements (not initialized).
+    explicit RowNumbers (size_t n)
+      : Vector<rownr_t> (n)
+      {}
+
+    // Construct from a vector of 64-bit row numbers (reference semantics).
+    RowNumbers (const Vector<rownr_t>& rows)
+      : Vector<rownr_t> (rows)
+      {}
+
+    // Construct from a std::vector of 64-bit row numbers.
+    RowNumbers (const std::vector<rownr_t>& rows);
+
+    // Construct from a vector of 32-bit row numbers (copy semantics).
+    // <group>
+    RowNumbers (const Vector<uInt>& rows);
+    RowNumbers (const std::vector<uInt>& rows);
+    // </group>
+
+    // Copy constructor (reference semantics).
+    RowNumbers (const RowNumbers& that)
+      : Vector<rownr_t> (that)
+      {}
+
+    // Assignment (copy semantics).
+    // The assignment operators of Vector remain visible.
+    // <group>
+    RowNumbers& operator= (const RowNumbers& that)
+      { Vector<rownr_t>::operator= (that); return *this; }
+    using Vector<rownr_t>::operator=;
+    // </group>
+
+    // Convert to a vector of 32-bit row numbers (for backward compatibility).
+    // An exception is thrown if a row number exceeds 32 bits.
+    operator Vector<uInt>() const;
+
+    // Convert between 32-bit and 64-bit row number vectors.
+    // <group>
+    static Vector<uInt> convertRownrs (const Vector<rownr_t>& rows);
+    static Vector<rownr_t> convertRownrs (const Vector<uInt>& rows);
+    // </group>
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
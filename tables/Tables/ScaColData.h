@@ -111,13 +111,13 @@ public:
 
     // Initialize the rows from startRownr till endRownr (inclusive)
     // with the default value defined in the column description.
-    void initialize (uInt startRownr, uInt endRownr);
+    void initialize (rownr_t startRownr, rownr_t endRownr);
 
     // Test if the given cell contains a defined value.
-    Bool isDefined (uInt rownr) const;
+    Bool isDefined (rownr_t rownr) const;
 
     // Get the value from a particular cell.
-    void get (uInt rownr, void*) const;
+    void get (rownr_t rownr, void*) const;
 
     // Get the array of all values in the column.
     // The length of the buffer pointed to by dataPtr must match
@@ -132,7 +132,7 @@ public:
     // Put the value in a particular cell.
     // The length of the buffer pointed to by dataPtr must match
     // the actual length. This is checked by ScalarColumn.
-    void put (uInt rownr, const void* dataPtr);
+    void put (rownr_t rownr, const void* dataPtr);
 
     // Put the array of all values in the column.
     // The length of the buffer pointed to by dataPtr must match
@@ -156,7 +156,7 @@ public:
 		      const void*& dataSave);
     // Do it only for the given row numbers.
     void makeRefSortKey (Sort&, CountedPtr<BaseCompare>& cmpFunc, Int order,
-			 const Vector<uInt>& rownrs, const void*& dataSave);
+			 const Vector<rownr_t>& rownrs, const void*& dataSave);
     // </group>
 
     // Free storage on the heap allocated by makeSortkey().
@@ -87,7 +87,7 @@ Bool ScalarColumnData<T>::canAccessScalarColumnCells (Bool& reask) const
 
 
 template<class T>
-void ScalarColumnData<T>::initialize (uInt startRow, uInt endRow)
+void ScalarColumnData<T>::initialize (rownr_t startRow, rownr_t endRow)
 {
     if (colDescPtr_p->dataType() != TpOther) {
 	for (uInt i=startRow; i<=endRow; i++) {
@@ -97,7 +97,7 @@ void ScalarColumnData<T>::initialize (uInt startRow, uInt endRow)
 }	
 
 template<class T>
-Bool ScalarColumnData<T>::isDefined (uInt rownr) const
+Bool ScalarColumnData<T>::isDefined (rownr_t rownr) const
 {
     if (!undefFlag_p) {
 	return True;
@@ -109,7 +109,7 @@ Bool ScalarColumnData<T>::isDefined (uInt rownr) const
 
 
 template<class T>
-void ScalarColumnData<T>::get (uInt rownr, void* val) const
+void ScalarColumnData<T>::get (rownr_t rownr, void* val) const
 {
     if (rtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'r', rownr);
@@ -148,13 +148,28 @@ void ScalarColumnData<T>::getScalarColumnCells (const RefRows& rownrs,
 	throw (TableArrayConformanceError("ScalarColumnData::getColumnCells"));
     }
     checkReadLock (True);
-    dataColPtr_p->getScalarColumnCellsV (rownrs, &vec);
+    // Get the values one by one if the data manager cannot get
+    // multiple cells (as is the case for many virtual columns).
+    Bool reask;
+    if (canAccessScalarColumnCells (reask)) {
+        dataColPtr_p->getScalarColumnCellsV (rownrs, &vec);
+    } else {
+        uInt i = 0;
+        RefRowsSliceIter iter(rownrs);
+        while (! iter.pastEnd()) {
+            for (rownr_t row=iter.sliceStart(); row<=iter.sliceEnd();
+                 row+=iter.sliceIncr()) {
+                dataColPtr_p->get (row, &(vec[i++]));
+            }
+            iter++;
+        }
+    }
     autoReleaseLock();
 }
 
 
 template<class T>
-void ScalarColumnData<T>::put (uInt rownr, const void* val)
+void ScalarColumnData<T>::put (rownr_t rownr, const void* val)
 {
     if (wtraceColumn_p) {
       TableTrace::trace (traceId(), columnDesc().name(), 'w', rownr);
@@ -210,7 +225,7 @@ void ScalarColumnData<T>::makeSortKey (Sort& sortobj,
     //# Get the data as a column.
     //# Save the pointer to the vector for deletion by freeSortKey().
     dataSave = 0;
-    uInt nrrow = nrow();
+    rownr_t nrrow = nrow();
     Vector<T>* vecPtr = new Vector<T>(nrrow);
     Bool reask;
     if (canAccessScalarColumn (reask)) {
@@ -230,14 +245,14 @@ template<class T>
 void ScalarColumnData<T>::makeRefSortKey (Sort& sortobj,
                                           CountedPtr<BaseCompare>& cmpObj,
 					  Int order,
-					  const Vector<uInt>& rownrs,
+					  const Vector<rownr_t>& rownrs,
 					  const void*& dataSave)
 {
     //#// Optimal is to ask the data manager for a pointer to
     //#// the consecutive data. Often this may succeed.
     //# Get the data as a column.
     dataSave = 0;
-    uInt nrrow = rownrs.nelements();
+    rownr_t nrrow = rownrs.nelements();
     Vector<T>* vecPtr = new Vector<T>(nrrow);
     Bool reask;
     if (canAccessScalarColumnCells (reask)) {
@@ -73,7 +73,7 @@ void TabVecScaCol<T>::putVal (uInt i, const T& val)
 template<class T>
 void TabVecScaCol<T>::set (const T& val)
 {
-    uInt nrrow = colPtr_p->nrow();
+    rownr_t nrrow = colPtr_p->nrow();
     for (uInt i=0; i<nrrow; i++) {
 	colPtr_p->put (i, val);
     }
@@ -50,6 +50,7 @@
 #include <casacore/casa/OS/Directory.h>
 #include <casacore/casa/OS/DirectoryIterator.h>
 #include <casacore/casa/iostream.h>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -126,7 +127,7 @@ Table::Table (const String& name, const String& type,
     baseTabPtr_p->link();
 }
 
-Table::Table (SetupNewTable& newtab, uInt nrrow, Bool initialize,
+Table::Table (SetupNewTable& newtab, rownr_t nrrow, Bool initialize,
 	      Table::EndianFormat endianFormat, const TSMOption& tsmOpt)
 : baseTabPtr_p     (0),
   isCounted_p      (True),
@@ -137,7 +138,7 @@ Table::Table (SetupNewTable& newtab, uInt nrrow, Bool initialize,
     baseTabPtr_p->link();
 }
 Table::Table (SetupNewTable& newtab, Table::TableType type,
-	      uInt nrrow, Bool initialize,
+	      rownr_t nrrow, Bool initialize,
 	      Table::EndianFormat endianFormat, const TSMOption& tsmOpt)
 : baseTabPtr_p     (0),
   isCounted_p      (True),
@@ -153,7 +154,7 @@ Table::Table (SetupNewTable& newtab, Table::TableType type,
 }
 Table::Table (SetupNewTable& newtab, Table::TableType type,
 	      const TableLock& lockOptions,
-	      uInt nrrow, Bool initialize,
+	      rownr_t nrrow, Bool initialize,
 	      Table::EndianFormat endianFormat, const TSMOption& tsmOpt)
 : baseTabPtr_p     (0),
   isCounted_p      (True),
@@ -168,7 +169,7 @@ Table::Table (SetupNewTable& newtab, Table::TableType type,
     baseTabPtr_p->link();
 }
 Table::Table (SetupNewTable& newtab, TableLock::LockOption lockOption,
-	      uInt nrrow, Bool initialize, Table::EndianFormat endianFormat,
+	      rownr_t nrrow, Bool initialize, Table::EndianFormat endianFormat,
               const TSMOption& tsmOpt)
 : baseTabPtr_p     (0),
   isCounted_p      (True),
@@ -180,7 +181,7 @@ Table::Table (SetupNewTable& newtab, TableLock::LockOption lockOption,
     baseTabPtr_p->link();
 }
 Table::Table (SetupNewTable& newtab, const TableLock& lockOptions,
-	      uInt nrrow, Bool initialize, Table::EndianFormat endianFormat,
+	      rownr_t nrrow, Bool initialize, Table::EndianFormat endianFormat,
               const TSMOption& tsmOpt)
 : baseTabPtr_p     (0),
   isCounted_p      (True),
@@ -425,13 +426,11 @@ Bool Table::isNativeDataType (DataType dtype)
 uInt Table::getLayout (TableDesc& desc, const String& tableName)
 {
     String tabName = Path(tableName).absoluteName();
-    uInt nrow, format;
+    rownr_t nrow;
+    uInt format;
     String tp;
     AipsIO ios (Table::fileName(tabName));
-    ios.getstart ("Table");
-    ios >> nrow;
-    ios >> format;
-    ios >> tp;
+    BaseTable::readStart (ios, nrow, format, tp);
     if (tp == "PlainTable") {
 	PlainTable::getLayout (desc, ios);
     } else if (tp == "RefTable") {
@@ -547,11 +546,9 @@ BaseTable* Table::makeBaseTable (const String& name, const String& type,
     AipsIO ios (Table::fileName(name), fopt);
     //# Determine the kind of table by reading the type.
     String tp;
-    uInt version = ios.getstart ("Table");
-    uInt nrrow, format;
-    ios >> nrrow;
-    ios >> format;
-    ios >> tp;
+    rownr_t nrrow;
+    uInt format;
+    uInt version = BaseTable::readStart (ios, nrrow, format, tp);
     if (tp == "PlainTable") {
 	baseTabPtr = new PlainTable (ios, version, name, type, nrrow,
 				     tableOption, lockOptions, tsmOpt,
@@ -709,24 +706,24 @@ void Table::removeColumn (const String& columnName)
     baseTabPtr_p->removeColumn (Vector<String>(1, columnName));
 }
 
-Vector<uInt> Table::rowNumbers () const
+RowNumbers Table::rowNumbers () const
     { return baseTabPtr_p->rowNumbers(); }
 
-Vector<uInt> Table::rowNumbers (const Table& that, Bool tryFast) const
+RowNumbers Table::rowNumbers (const Table& that, Bool tryFast) const
 {
-    Vector<uInt> thisRows(rowNumbers());
-    const uInt highValue = 4294967295u;
+    Vector<rownr_t> thisRows(rowNumbers());
+    const rownr_t highValue = std::numeric_limits<rownr_t>::max();
     // If that is the root table of this, we can simply use rowNumbers().
     // The same is true if empty.
     if (that.baseTabPtr_p == baseTabPtr_p->root()  ||  nrow() == 0) {
       return thisRows;
     }
     // Get the rowNumbers of that.
-    Vector<uInt> thatRows(that.rowNumbers());
+    Vector<rownr_t> thatRows(that.rowNumbers());
     // Try if a fast conversion can be done.
     // That is the case if this is not a superset of that and if orders match.
     if (tryFast) {
-      Vector<uInt> outRows;
+      Vector<rownr_t> outRows;
       if (fastRowNumbers (thisRows, thatRows, outRows)) {
         return outRows;
       }
@@ -734,24 +731,24 @@ Vector<uInt> Table::rowNumbers (const Table& that, Bool tryFast) const
     // Alas, we have to do it the hard way.
     // Transform the rowNumbers of that to a vector
     // mapping rownr in root to rownr in that.
-    uInt nrthat = thatRows.nelements();
-    uInt maxv = nrthat;
-    Vector<uInt> rownrs(thatRows);
+    rownr_t nrthat = thatRows.nelements();
+    rownr_t maxv = nrthat;
+    Vector<rownr_t> rownrs(thatRows);
     // That mapping only needs to be done if that is not a root table.
     // Non-used rownrs are initialized with a very high value.
     if (! that.isRootTable()) {
         maxv = max(thatRows);
-        Vector<uInt> tmp(maxv+1, highValue);
+        Vector<rownr_t> tmp(maxv+1, highValue);
 	rownrs.reference (tmp);
     }
     Bool deleteIt;
-    uInt* rownrsData = rownrs.getStorage (deleteIt);
+    rownr_t* rownrsData = rownrs.getStorage (deleteIt);
     // Now make the mapping.
     // thatRows is not needed anymore, so resize at the end to reclaim memory.
     if (! that.isRootTable()) {
         Bool deleteThat;
-        const uInt* thatRowData = thatRows.getStorage (deleteThat);
-	for (uInt i=0; i<nrthat; i++) {
+        const rownr_t* thatRowData = thatRows.getStorage (deleteThat);
+	for (rownr_t i=0; i<nrthat; i++) {
 	    rownrsData[thatRowData[i]] = i;
 	}
 	thatRows.freeStorage (thatRowData, deleteThat);
@@ -762,9 +759,9 @@ Vector<uInt> Table::rowNumbers (const Table& that, Bool tryFast) const
     // Use a very high value if the rownr is too high.
     thisRows.unique();
     Bool deleteThis;
-    uInt* thisRowData = thisRows.getStorage (deleteThis);
-    uInt nrthis = thisRows.nelements();
-    for (uInt i=0; i<nrthis; i++) {
+    rownr_t* thisRowData = thisRows.getStorage (deleteThis);
+    rownr_t nrthis = thisRows.nelements();
+    for (rownr_t i=0; i<nrthis; i++) {
         if (thisRowData[i] > maxv) {
 	    thisRowData[i] = highValue;
 	} else {
@@ -772,14 +769,14 @@ Vector<uInt> Table::rowNumbers (const Table& that, Bool tryFast) const
 	}
     }
     thisRows.putStorage (thisRowData, deleteThis);
-    const uInt *dummy(rownrsData);      // Need to const the pointer to get
+    const rownr_t *dummy(rownrsData);      // Need to const the pointer to get
                                         // by the SGI compiler.
     rownrs.freeStorage (dummy, deleteIt);
     return thisRows;
 }
 
-Bool Table::fastRowNumbers (const Vector<uInt>& v1, const Vector<uInt>& v2,
-                            Vector<uInt>& rows) const
+Bool Table::fastRowNumbers (const Vector<rownr_t>& v1, const Vector<rownr_t>& v2,
+                            Vector<rownr_t>& rows) const
 {
   // v1 cannot be a superset of v2.
   if (v1.size() > v2.size()) {
@@ -790,12 +787,12 @@ Bool Table::fastRowNumbers (const Vector<uInt>& v1, const Vector<uInt>& v2,
     return True;
   }
   Bool d1,d2,d3;
-  const uInt* r1 = v1.getStorage (d1);
-  const uInt* r2 = v2.getStorage (d2);
-  uInt* routc = rows.getStorage (d3);
-  uInt* rout = routc;
-  uInt i1=0;
-  uInt i2=0;
+  const rownr_t* r1 = v1.getStorage (d1);
+  const rownr_t* r2 = v2.getStorage (d2);
+  rownr_t* routc = rows.getStorage (d3);
+  rownr_t* rout = routc;
+  rownr_t i1=0;
+  rownr_t i2=0;
   Bool ok = True;
   while (ok) {
     if (r1[i1] == r2[i2]) {
@@ -900,11 +897,17 @@ TableExprNode Table::nodeRandom () const
 
 //# Select rows based on an expression.
 Table Table::operator() (const TableExprNode& expr,
-                         uInt maxRow, uInt offset) const
+                         rownr_t maxRow, rownr_t offset) const
     { return Table (baseTabPtr_p->select (expr, maxRow, offset)); }
+void Table::zoneIntervals
+                  (const TableExprNode& expr,
+                   std::vector<std::pair<rownr_t,rownr_t> >& intervals) const
+    { baseTabPtr_p->zoneIntervals (expr, nrow(), intervals); }
 //# Select rows based on row numbers.
-Table Table::operator() (const Vector<uInt>& rownrs) const
+Table Table::operator() (const Vector<rownr_t>& rownrs) const
     { return Table (baseTabPtr_p->select (rownrs)); }
+Table Table::operator() (const Vector<uInt>& rownrs) const
+    { return Table (baseTabPtr_p->select (RowNumbers(rownrs))); }
 //# Select rows based on a mask.
 Table Table::operator() (const Block<Bool>& mask) const
     { return Table (baseTabPtr_p->select (mask)); }
@@ -32,6 +32,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/tables/Tables/BaseTable.h>
+#include <casacore/tables/Tables/RowNumbers.h>
 #include <casacore/tables/Tables/TableLock.h>
 #include <casacore/tables/DataMan/TSMOption.h>
 #include <casacore/casa/Utilities/DataType.h>
@@ -125,7 +126,7 @@ template<class T> class CountedPtr;
 // Table myTable ("theTable", Table::Update);
 // // Write the column containing the scalar RA.
 // ScalarColumn<double> raColumn(myTable, "RA");
-// uInt nrrow = myTable.nrow();
+// rownr_t nrrow = myTable.nrow();
 // for (uInt i=0; i<nrrow; i++) {
 //    raColumn.put (i, i+10);    // Put value i+10 into row i
 // }
@@ -270,20 +271,20 @@ public:
     // inspection interval of 5 seconds.
     // <br>The data will be stored in the given endian format.
     // <group>
-    explicit Table (SetupNewTable&, uInt nrrow = 0, Bool initialize = False,
+    explicit Table (SetupNewTable&, rownr_t nrrow = 0, Bool initialize = False,
 		    EndianFormat = Table::AipsrcEndian,
                     const TSMOption& = TSMOption());
     Table (SetupNewTable&, TableType,
-	   uInt nrrow = 0, Bool initialize = False,
+	   rownr_t nrrow = 0, Bool initialize = False,
 	   EndianFormat = Table::AipsrcEndian, const TSMOption& = TSMOption());
     Table (SetupNewTable&, TableType, const TableLock& lockOptions,
-	   uInt nrrow = 0, Bool initialize = False,
+	   rownr_t nrrow = 0, Bool initialize = False,
 	   EndianFormat = Table::AipsrcEndian, const TSMOption& = TSMOption());
     Table (SetupNewTable&, TableLock::LockOption,
-	   uInt nrrow = 0, Bool initialize = False,
+	   rownr_t nrrow = 0, Bool initialize = False,
 	   EndianFormat = Table::AipsrcEndian, const TSMOption& = TSMOption());
     Table (SetupNewTable&, const TableLock& lockOptions,
-	   uInt nrrow = 0, Bool initialize = False,
+	   rownr_t nrrow = 0, Bool initialize = False,
 	   EndianFormat = Table::AipsrcEndian, const TSMOption& = TSMOption());
     // </group>
 
@@ -477,6 +478,17 @@ public:
     // (or is being changed) since the last time this function was called.
     Bool hasDataChanged();
 
+    // Get the modify counter of the table. It is incremented each time
+    // changes in column or keyword data are written (i.e. flushed). It is
+    // kept in the lock file, so it is shared by all processes using the
+    // table. Note that it is only up-to-date if the table is locked.
+    uInt modifyCounter() const;
+
+    // Get the modify counter of the column data. It is like
+    // <src>modifyCounter</src>, but is not incremented by changes in the
+    // table keywords. So it can be stored in a keyword itself.
+    uInt dataModifyCounter() const;
+
     // Flush the table, i.e. write out the buffers. If <src>sync=True</src>,
     // it is ensured that all data are physically written to disk.
     // Nothing will be done if the table is not writable.
@@ -712,7 +724,7 @@ public:
     // process updated the table, thus possible increased the number of rows.
     // If one wants to take that into account, he should acquire a
     // read-lock (using the lock function) before using nrow().
-    uInt nrow() const;
+    rownr_t nrow() const;
 
     // Test if it is possible to add a row to this table.
     // It is possible if all storage managers used for the table
@@ -723,7 +735,7 @@ public:
     // This will fail for tables not supporting addition of rows.
     // Optionally the rows can be initialized with the default
     // values as defined in the column descriptions.
-    void addRow (uInt nrrow = 1, Bool initialize = False);
+    void addRow (rownr_t nrrow = 1, Bool initialize = False);
 
     // Test if it is possible to remove a row from this table.
     // It is possible if all storage managers used for the table
@@ -748,7 +760,8 @@ public:
     // row 21 into row 20.
     // </note>
     // <group>
-    void removeRow (uInt rownr);
+    void removeRow (rownr_t rownr);
+    void removeRow (const Vector<rownr_t>& rownrs);
     void removeRow (const Vector<uInt>& rownrs);
     // </group>
 
@@ -800,7 +813,17 @@ public:
     // when <src>maxRow</src> rows are selected.
     // <br>The TableExprNode argument can be empty (null) meaning that only
     // the <src>maxRow/offset</src> arguments are taken into account.
-    Table operator() (const TableExprNode&, uInt maxRow=0, uInt offset=0) const;
+    Table operator() (const TableExprNode&, rownr_t maxRow=0, rownr_t offset=0) const;
+
+    // Determine the row intervals <src>[start,end)</src> that can contain
+    // rows matching the expression according to the zone maps of the columns
+    // compared with constants (see
+    // <linkto class=TableColumn>TableColumn::getZoneMap</linkto>).
+    // The selection done by <src>operator()</src> only evaluates the
+    // expression for these rows.
+    void zoneIntervals
+                  (const TableExprNode&,
+                   std::vector<std::pair<rownr_t,rownr_t> >& intervals) const;
 
     // Select rows using a vector of row numbers.
     // This can, for instance, be used to select the same rows as
@@ -808,7 +831,10 @@ public:
     // <srcblock>
     //     Table result = thisTable (otherTable.rowNumbers());
     // </srcblock>
+    // <group>
+    Table operator() (const Vector<rownr_t>& rownrs) const;
     Table operator() (const Vector<uInt>& rownrs) const;
+    // </group>
 
     // Select rows using a mask block.
     // The length of the block must match the number of rows in the table.
@@ -880,7 +906,9 @@ public:
     // containing the row numbers 0 .. #rows-1.
     // <br>Note that in general it is better to use the next
     // <src>rowNumbers(Table)</src> function.
-    Vector<uInt> rowNumbers() const;
+    // <br>The result can be assigned to a <src>Vector<uInt></src>
+    // as long as the row numbers fit in 32 bits.
+    RowNumbers rowNumbers() const;
 
     // Get a vector of row numbers in that table of rows in this table.
     // In case the table is a subset of that table, this tells which
@@ -890,7 +918,7 @@ public:
     // <note role=caution>This function is in principle meant for cases
     // where this table is a subset of that table. However, it can be used
     // for any table. In that case the returned vector contains a very high
-    // number (max_uint) for rows in this table not part of that table.
+    // number (max of rownr_t) for rows in this table not part of that table.
     // In that way they are invalid if used elsewhere.
     // <br>In the general case creating the row number vector can be slowish,
     // because it has to do two mappings. However, if this table is a subset
@@ -903,15 +931,15 @@ public:
     // <srcblock>
     // Table tab("somename");
     // Table subset = tab(some_select_expression);
-    // Vector<uInt> rownrs = subset.rowNumbers(tab);
+    // RowNumbers rownrs = subset.rowNumbers(tab);
     // </srcblock>
     // Note that one cannot be sure that table "somename" is the root
     // (i.e. original) table. It may also be a subset of another table.
     // In the latter case doing
-    // <br> <src>    Vector<uInt> rownrs = subset.rowNumbers()</src>
+    // <br> <src>    RowNumbers rownrs = subset.rowNumbers()</src>
     // does not give the row numbers in <src>tab</src>, but in the root table
     // (which is probably not what you want).
-  Vector<uInt> rowNumbers (const Table& that, Bool tryFast=False) const;
+  RowNumbers rowNumbers (const Table& that, Bool tryFast=False) const;
 
     // Add a column to the table.
     // The data manager used for the column depend on the function used.
@@ -1069,8 +1097,8 @@ private:
 
     // Try if v1 is a subset of v2 and fill rows with its indices in v2.
     // Return False if not a proper subset.
-    Bool fastRowNumbers (const Vector<uInt>& v1, const Vector<uInt>& v2,
-                         Vector<uInt>& rows) const;
+    Bool fastRowNumbers (const Vector<rownr_t>& v1, const Vector<rownr_t>& v2,
+                         Vector<rownr_t>& rows) const;
 
     // Show the info of the given columns.
     // Sort the columns if needed.
@@ -1112,6 +1140,11 @@ inline Bool Table::hasLock (Bool write) const
     return baseTabPtr_p->hasLock (write ? FileLocker::Write : FileLocker::Read);
 }
 
+inline uInt Table::modifyCounter() const
+    { return baseTabPtr_p->getModifyCounter(); }
+inline uInt Table::dataModifyCounter() const
+    { return baseTabPtr_p->getDataModifyCounter(); }
+
 inline Bool Table::isRootTable() const
     { return baseTabPtr_p == baseTabPtr_p->root(); }
 
@@ -1144,7 +1177,7 @@ inline void Table::unmarkForDelete()
 inline Bool Table::isMarkedForDelete() const
     { return baseTabPtr_p->isMarkedForDelete(); }
 
-inline uInt Table::nrow() const
+inline rownr_t Table::nrow() const
     { return baseTabPtr_p->nrow(); }
 inline BaseTable* Table::baseTablePtr() const
     { return baseTabPtr_p; }
@@ -1178,12 +1211,14 @@ inline Bool Table::canRemoveColumn (const Vector<String>& columnNames) const
 inline Bool Table::canRenameColumn (const String& columnName) const
     { return baseTabPtr_p->canRenameColumn (columnName); }
 
-inline void Table::addRow (uInt nrrow, Bool initialize)
+inline void Table::addRow (rownr_t nrrow, Bool initialize)
     { baseTabPtr_p->addRow (nrrow, initialize); }
-inline void Table::removeRow (uInt rownr)
+inline void Table::removeRow (rownr_t rownr)
     { baseTabPtr_p->removeRow (rownr); }
-inline void Table::removeRow (const Vector<uInt>& rownrs)
+inline void Table::removeRow (const Vector<rownr_t>& rownrs)
     { baseTabPtr_p->removeRow (rownrs); }
+inline void Table::removeRow (const Vector<uInt>& rownrs)
+    { baseTabPtr_p->removeRow (RowNumbers(rownrs)); }
 inline void Table::addColumn (const ColumnDesc& columnDesc, Bool addToParent)
     { baseTabPtr_p->addColumn (columnDesc, addToParent); }
 inline void Table::addColumn (const ColumnDesc& columnDesc,
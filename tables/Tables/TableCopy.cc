@@ -88,7 +88,7 @@ Table TableCopy::makeEmptyMemoryTable (const String& newName,
 }
 
 void TableCopy::copyRows (Table& out, const Table& in, uInt startout,
-			  uInt startin, uInt nrrow, Bool flush)
+			  uInt startin, rownr_t nrrow, Bool flush)
 {
   // Check if startin and nrrow are correct for input.
   if (startin + nrrow > in.nrow()) {
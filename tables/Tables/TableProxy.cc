@@ -42,6 +42,7 @@
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/TaQL/TaQLStatement.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/Tables/TableAttr.h>
 #include <casacore/tables/DataMan/DataManAccessor.h>
@@ -143,14 +144,34 @@ TableProxy::TableProxy (const std::vector<TableProxy>& tables,
 
 TableProxy::TableProxy (const String& command,
 			const std::vector<TableProxy>& tables)
+{
+  execCommand (command, tables, std::vector<TableExprNode>());
+}
+
+TableProxy::TableProxy (const String& command,
+			const std::vector<TableProxy>& tables,
+			const Record& params)
+{
+  std::vector<TableExprNode> values(params.nfields());
+  for (uInt i=0; i<values.size(); ++i) {
+    values[i] = makeParam (params, i);
+  }
+  execCommand (command, tables, values);
+}
+
+void TableProxy::execCommand (const String& command,
+			      const std::vector<TableProxy>& tables,
+			      const std::vector<TableExprNode>& params)
 {
   std::vector<const Table*> tabs(tables.size());
   for (uInt i=0; i<tabs.size(); i++) {
     tabs[i] = &(tables[i].table());
   }
   // Try to execute the command.
-  TaQLResult taqlResult;
-  taqlResult = tableCommand (command, tabs);
+  TaQLStatement stmt(command);
+  Vector<String> cols;
+  String commandType;
+  TaQLResult taqlResult = stmt.execute (params, tabs, cols, commandType);
   // Command succeeded.
   // Add table if result is a table.
   if (taqlResult.isTable()) {
@@ -161,6 +182,52 @@ TableProxy::TableProxy (const String& command,
   }
 }
 
+TableExprNode TableProxy::makeParam (const Record& params, uInt fieldnr)
+{
+  switch (params.dataType(fieldnr)) {
+  case TpBool:
+    return params.asBool (fieldnr);
+  case TpUChar:
+  case TpShort:
+  case TpInt:
+    return params.asInt (fieldnr);
+  case TpUInt:
+    return params.asuInt (fieldnr);
+  case TpInt64:
+    return params.asInt64 (fieldnr);
+  case TpFloat:
+  case TpDouble:
+    return params.asDouble (fieldnr);
+  case TpComplex:
+  case TpDComplex:
+    return params.asDComplex (fieldnr);
+  case TpString:
+    return params.asString (fieldnr);
+  case TpArrayBool:
+    return params.asArrayBool (fieldnr);
+  case TpArrayUChar:
+  case TpArrayShort:
+  case TpArrayInt:
+    return params.asArrayInt (fieldnr);
+  case TpArrayUInt:
+    return params.asArrayuInt (fieldnr);
+  case TpArrayFloat:
+  case TpArrayDouble:
+    return params.asArrayDouble (fieldnr);
+  case TpArrayComplex:
+  case TpArrayDComplex:
+    return params.asArrayDComplex (fieldnr);
+  case TpArrayString:
+    return params.asArrayString (fieldnr);
+  default:
+    break;
+  }
+  throw TableError ("TableProxy: TaQL parameter $" +
+		    String::toString(fieldnr+1) +
+		    " (field " + params.name(fieldnr) +
+		    ") has an unsupported data type");
+}
+
 TableProxy::TableProxy (const String& fileName,
 			const String& headerName,
 			const String& tableName,
@@ -725,7 +792,7 @@ TableProxy TableProxy::selectRows (const Vector<Int>& rownrs,
   table_p.unlock();
   // Create a table from the selected rows.
   // Rename it and make it non-scratch if a name is given.
-  Vector<uInt> rows(rownrs.nelements());
+  Vector<rownr_t> rows(rownrs.nelements());
   convertArray (rows, rownrs);
   Table ntable = table_p(rows);
   if (! outName.empty()) {
@@ -749,7 +816,7 @@ void TableProxy::stillSameShape (Int& same, IPosition& shape,
 void TableProxy::calcValues (Record& rec, const TableExprNode& expr)
 {
   if (expr.isScalar()) {
-    Vector<uInt> rownrs(expr.nrow());
+    Vector<rownr_t> rownrs(expr.nrow());
     indgen (rownrs);
     switch (expr.getColumnDataType()) {
     case TpBool:
@@ -1627,7 +1694,7 @@ void TableProxy::removeRow (const Vector<Int>& rownrs)
 {
   // If needed synchronize table to get up-to-date number of rows.
   syncTable (table_p);
-  Vector<uInt> rows(rownrs.nelements());
+  Vector<rownr_t> rows(rownrs.nelements());
   convertArray (rows, rownrs);
   table_p.removeRow (rows);
 }
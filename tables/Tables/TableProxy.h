@@ -154,6 +154,16 @@ public:
   TableProxy (const String& command,
 	      const std::vector<TableProxy>& tables);
 
+  // Create a table object from a table command containing parameters
+  // $1, $2, etc. in its expressions. Their values are the fields of
+  // the record (in order of the fields).
+  // The parsed command is kept in a cache (see class TaQLParseCache),
+  // so a command executed repeatedly with different parameter values
+  // is parsed only once.
+  TableProxy (const String& command,
+	      const std::vector<TableProxy>& tables,
+	      const Record& params);
+
   // Create a table from an Ascii file.
   // It fills a string containing the names and types
   // of the columns (in the form COL1=R, COL2=D, ...).
@@ -312,6 +322,12 @@ public:
   // row is the starting row number (0-relative).
   // nrow=-1 means until the end of the table.
   // incr is the step in row number.
+  // <br>getColumnVH reads the values into the array in the given ValueHolder,
+  // which must have the correct shape. If the array references a buffer
+  // (e.g. a contiguous numpy array of the column's data type),
+  // the values are read directly into that buffer, thus without an extra
+  // copy and without allocating a new array. If the data types differ,
+  // the values are converted.
   // <group>
   ValueHolder getColumn (const String& columnName,
 			 Int row,
@@ -330,6 +346,7 @@ public:
 
   // Get some or all value slices from a column in the table.
   // If the inc vector is empty, it defaults to all 1.
+  // Similar to getColumnVH, getColumnSliceVH reads into the given array.
   // <group>
   ValueHolder getColumnSlice (const String& columnName,
 			      Int row,
@@ -759,6 +776,14 @@ private:
   // 'values' in rec.
   static void calcValues (Record& rec, const TableExprNode& expr);
 
+  // Execute a TaQL command with the given parameter values.
+  void execCommand (const String& command,
+		    const std::vector<TableProxy>& tables,
+		    const std::vector<TableExprNode>& params);
+
+  // Make a constant TableExprNode from the value of a record field.
+  static TableExprNode makeParam (const Record& params, uInt fieldnr);
+
   // Synchronize table if readlocking is in effect.
   // In this way the number of rows is up-to-date.
   void syncTable (Table& table);
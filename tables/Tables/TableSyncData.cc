@@ -46,7 +46,7 @@ TableSyncData::~TableSyncData()
     itsAipsIO.close();
 }
 
-void TableSyncData::write (uInt nrrow, uInt nrcolumn, Bool tableChanged,
+void TableSyncData::write (rownr_t nrrow, uInt nrcolumn, Bool tableChanged,
 			   const Block<Bool>& dataManChanged)
 {
     // Increment change counter when the table has changed.
@@ -81,8 +81,7 @@ void TableSyncData::write (uInt nrrow, uInt nrcolumn, Bool tableChanged,
     // Now write the data into the memoryIO object.
     // First clear it.
     itsMemIO.clear();
-    itsAipsIO.putstart ("sync" ,1);
-    itsAipsIO << itsNrrow;
+    putNrrow();
     itsAipsIO << itsNrcolumn;
     itsAipsIO << itsModifyCounter;
     if (itsNrcolumn >= 0) {
@@ -92,7 +91,7 @@ void TableSyncData::write (uInt nrrow, uInt nrcolumn, Bool tableChanged,
     itsAipsIO.putend();
 }
 
-void TableSyncData::write (uInt nrrow)
+void TableSyncData::write (rownr_t nrrow)
 {
     itsModifyCounter++;
     itsNrrow = nrrow;
@@ -100,14 +99,35 @@ void TableSyncData::write (uInt nrrow)
     // Now write the data into the memoryIO object.
     // First clear it.
     itsMemIO.clear();
-    itsAipsIO.putstart ("sync" ,1);
-    itsAipsIO << itsNrrow;
+    putNrrow();
     itsAipsIO << itsNrcolumn;
     itsAipsIO << itsModifyCounter;
     itsAipsIO.putend();
 }
 
-Bool TableSyncData::read (uInt& nrrow, uInt& nrcolumn, Bool& tableChanged,
+void TableSyncData::putNrrow()
+{
+    // Use the old format (with a 32-bit row count) if possible, so older
+    // software can still share the lock file.
+    if (itsNrrow > 4294967295u) {
+        itsAipsIO.putstart ("sync", 2);
+        itsAipsIO << itsNrrow;
+    } else {
+        itsAipsIO.putstart ("sync", 1);
+        itsAipsIO << uInt(itsNrrow);
+    }
+}
+
+uInt TableSyncData::getDataModifyCounter() const
+{
+    uInt counter = 0;
+    for (uInt i=0; i<itsDataManChangeCounter.nelements(); i++) {
+	counter += itsDataManChangeCounter[i];
+    }
+    return counter;
+}
+
+Bool TableSyncData::read (rownr_t& nrrow, uInt& nrcolumn, Bool& tableChanged,
 			  Block<Bool>& dataManChanged)
 {
     // Read the data into the memoryIO object.
@@ -116,8 +136,14 @@ Bool TableSyncData::read (uInt& nrrow, uInt& nrcolumn, Bool& tableChanged,
     uInt i;
     Int nrcol = -1;
     if (itsMemIO.length() > 0) {
-	itsAipsIO.getstart ("sync");
-	itsAipsIO >> nrrow;
+	uInt version = itsAipsIO.getstart ("sync");
+        if (version > 1) {
+            itsAipsIO >> nrrow;
+        } else {
+            uInt nrrow32;
+            itsAipsIO >> nrrow32;
+            nrrow = nrrow32;
+        }
 	itsAipsIO >> nrcol;
 	itsAipsIO >> itsModifyCounter;
     }
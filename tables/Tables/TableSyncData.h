@@ -85,19 +85,19 @@ public:
     // Update the synchronization data and write it into the MemoryIO object.
     // This function is called when a table flush is done to reflect
     // if anything has changed compared to the previous flush.
-    void write (uInt nrrow, uInt nrcolumn, Bool tableChanged,
+    void write (rownr_t nrrow, uInt nrcolumn, Bool tableChanged,
 		const Block<Bool>& dataManChanged);
 
     // Update the synchronization data and write it into the MemoryIO object.
     // This function should be used by an external filler when it flushes
     // its data.
-    void write (uInt nrrow);
+    void write (rownr_t nrrow);
 
     // Read the synchronization data from the MemoryIO object.
     // This function is called when a lock is acquired to see if
     // table data has to be reread.
     // <br>It returns False when the MemoryIO object is empty.
-    Bool read (uInt& nrrow, uInt& nrcolumn, Bool& tableChanged,
+    Bool read (rownr_t& nrrow, uInt& nrcolumn, Bool& tableChanged,
 	       Block<Bool>& dataManChanged);
 
     // Get the MemoryIO object.
@@ -108,6 +108,11 @@ public:
     // Get the modify counter.
     uInt getModifyCounter() const;
 
+    // Get the data modify counter, i.e. the sum of the change counters of
+    // the data managers. Unlike the modify counter, it does not change if
+    // only the table keywords have changed.
+    uInt getDataModifyCounter() const;
+
 
 private:
     // Copy constructor is forbidden.
@@ -116,9 +121,13 @@ private:
     // Assignment is forbidden.
     TableSyncData& operator= (const TableSyncData& that);
 
+    // Start writing the object and write the number of rows.
+    // The 32-bit format is used if the number of rows fits.
+    void putNrrow();
+
 
     //# Member variables.
-    uInt        itsNrrow;
+    rownr_t     itsNrrow;
     Int         itsNrcolumn;
     uInt        itsModifyCounter;
     uInt        itsTableChangeCounter;
@@ -162,8 +162,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void TableTrace::writeRefRows (const RefRows& rownrs)
   {
-    const Vector<uInt> rows = rownrs.rowVector();
-    for (uInt i=0; i<rows.size(); ++i) {
+    const Vector<rownr_t> rows = rownrs.rowVector();
+    for (size_t i=0; i<rows.size(); ++i) {
       if (i>0) theirTraceFile << ',';
       theirTraceFile << rows[i];
       if (rownrs.isSliced()) {
@@ -31,8 +31,10 @@
 #include <casacore/tables/Tables/ScaColDesc.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/Tables/ColumnsIndex.h>
+#include <casacore/tables/TaQL/TableParse.h>
 #include <casacore/casa/Arrays/ArrayIO.h>
 #include <casacore/casa/Arrays/ArrayUtil.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Containers/Record.h>
 #include <casacore/casa/Containers/RecordField.h>
 #include <casacore/casa/OS/Timer.h>
@@ -40,6 +42,7 @@
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
 #include <casacore/casa/stdio.h>
+#include <limits>
 
 
 #include <casacore/casa/namespace.h>
@@ -325,6 +328,88 @@ void d()
     cout << "<<<" << endl;
 }
 
+// Test a persistent index and its use in TaQL.
+void e()
+{
+    Table tab("tColumnsIndex_tmp.data", Table::Update);
+    Vector<String> names(1, "adouble");
+    AlwaysAssertExit (! ColumnsIndex::hasPersistentIndex (tab, names));
+    {
+        ColumnsIndex colInx (tab, "adouble");
+        AlwaysAssertExit (! colInx.isPersistent());
+        colInx.setPersistent();
+        AlwaysAssertExit (colInx.isPersistent());
+    }
+    AlwaysAssertExit (ColumnsIndex::hasPersistentIndex (tab, names));
+    // Add rows with descending values; they are merged into the stored index.
+    uInt nrow = tab.nrow();
+    ScalarColumn<Double> cdouble(tab, "adouble");
+    tab.addRow (10);
+    for (uInt i=0; i<10; i++) {
+        cdouble.put (nrow+i, 0.5 + 2*(9-i));
+    }
+    Bool found;
+    {
+        ColumnsIndex colInx (tab, "adouble");
+        AlwaysAssertExit (colInx.isPersistent());
+        RecordFieldPtr<Double> key (colInx.accessKey(), "adouble");
+        *key = 4.5;
+        AlwaysAssertExit (colInx.getRowNumber(found) == nrow+7  &&  found);
+        *key = 5;
+        AlwaysAssertExit (colInx.getRowNumber(found) == 5  &&  found);
+        // Change a value, so the stored index is not valid anymore.
+        cdouble.put (3, 1000.);
+        colInx.setChanged ("adouble");
+        *key = 1000;
+        AlwaysAssertExit (colInx.getRowNumber(found) == 3  &&  found);
+    }
+    {
+        // The rewritten index must be valid.
+        ColumnsIndex colInx (tab, "adouble");
+        RecordFieldPtr<Double> key (colInx.accessKey(), "adouble");
+        *key = 1000;
+        AlwaysAssertExit (colInx.getRowNumber(found) == 3  &&  found);
+        *key = 3;
+        AlwaysAssertExit (colInx.getRowNumbers().empty());
+    }
+    // Make an index on an integer column as well.
+    ColumnsIndex intInx (tab, "aint");
+    intInx.setPersistent();
+    // Add infinite values which must be found by open-ended ranges.
+    tab.addRow (2);
+    cdouble.put (nrow+10, std::numeric_limits<Double>::infinity());
+    cdouble.put (nrow+11, -std::numeric_limits<Double>::infinity());
+    // TaQL uses the indices; the result must be the same as without them.
+    String cmd1 ("select from tColumnsIndex_tmp.data"
+                 " where adouble between 4 and 6 || adouble == 1000");
+    String cmd2 ("select from tColumnsIndex_tmp.data"
+                 " where aint in [-3,-5,-7] && adouble < 10");
+    String cmd3 ("select from tColumnsIndex_tmp.data where aint > -3");
+    String cmd4 ("select from tColumnsIndex_tmp.data where adouble > 999");
+    String cmd5 ("select from tColumnsIndex_tmp.data where adouble < 0.1");
+    Vector<rownr_t> rows1 = tableCommand(cmd1).table().rowNumbers();
+    Vector<rownr_t> rows2 = tableCommand(cmd2).table().rowNumbers();
+    Vector<rownr_t> rows3 = tableCommand(cmd3).table().rowNumbers();
+    Vector<rownr_t> rows4 = tableCommand(cmd4).table().rowNumbers();
+    Vector<rownr_t> rows5 = tableCommand(cmd5).table().rowNumbers();
+    AlwaysAssertExit (rows4.size() == 2);
+    AlwaysAssertExit (rows4[0] == 3  &&  rows4[1] == nrow+10);
+    AlwaysAssertExit (rows5.size() > 0  &&  rows5[rows5.size()-1] == nrow+11);
+    AlwaysAssertExit (rows1.size() == 5);
+    AlwaysAssertExit (rows1[0] == 3  &&  rows1[1] == 4  &&  rows1[2] == 5  &&
+                      rows1[3] == 6  &&  rows1[4] == nrow+7);
+    AlwaysAssertExit (rows2.size() == 2);
+    AlwaysAssertExit (rows2[0] == 5  &&  rows2[1] == 7);
+    ColumnsIndex::removePersistentIndex (tab, names);
+    ColumnsIndex::removePersistentIndex (tab, Vector<String>(1, "aint"));
+    AlwaysAssertExit (! ColumnsIndex::hasPersistentIndex (tab, names));
+    AlwaysAssertExit (allEQ (rows1, tableCommand(cmd1).table().rowNumbers()));
+    AlwaysAssertExit (allEQ (rows2, tableCommand(cmd2).table().rowNumbers()));
+    AlwaysAssertExit (allEQ (rows3, tableCommand(cmd3).table().rowNumbers()));
+    AlwaysAssertExit (allEQ (rows4, tableCommand(cmd4).table().rowNumbers()));
+    AlwaysAssertExit (allEQ (rows5, tableCommand(cmd5).table().rowNumbers()));
+}
+
 int main()
 {
     try {
@@ -332,6 +417,7 @@ int main()
 	b();
 	c();
 	d();
+	e();
     } catch (AipsError x) {
         cout << "Exception caught: " << x.getMesg() << endl;
 	return 1;
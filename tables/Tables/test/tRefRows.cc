@@ -133,10 +133,48 @@ void doIt()
     }
 }
 
+// Test 64-bit row numbers and the conversion from/to 32-bit ones.
+void doRowNumbers()
+{
+    rownr_t big = 5000000000ULL;
+    {
+	RefRows ref(big, big+8, 4);
+	AlwaysAssertExit (ref.nrows() == 3);
+	AlwaysAssertExit (ref.firstRow() == big);
+	RowNumbers rows = ref.convert();
+	AlwaysAssertExit (rows.size() == 3);
+	AlwaysAssertExit (rows[0] == big  &&  rows[2] == big+8);
+	// Converting to 32-bit row numbers must fail.
+	Bool failed = False;
+	try {
+	    Vector<uInt> rows32 (rows);
+	} catch (AipsError& x) {
+	    failed = True;
+	}
+	AlwaysAssertExit (failed);
+    }
+    {
+	Vector<uInt> vec(4);
+	indgen (vec, uInt(2));
+	RowNumbers rows(vec);
+	AlwaysAssertExit (rows.size() == 4);
+	Vector<uInt> vec2 (rows);
+	AlwaysAssertExit (allEQ (vec, vec2));
+	Vector<rownr_t> root(10);
+	indgen (root, big);
+	RefRows ref(2, 5);
+	AlwaysAssertExit (ref.isSliced());
+	RowNumbers conv = ref.convert (root);
+	cout << conv << endl;
+	AlwaysAssertExit (conv[0] == big+2  &&  conv[3] == big+5);
+    }
+}
+
 int main()
 {
     try {
 	doIt();
+	doRowNumbers();
     } catch (AipsError x) {
 	cout << "\nCaught an exception: " << x.getMesg() << endl;
         return 1;
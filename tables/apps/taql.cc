@@ -568,6 +568,9 @@ void showHelp()
   cerr << "clears 'var' (removes it from the saved selections)." << endl;
   cerr << "Use command ? to show all saved selections." << endl;
   cerr << endl;
+  cerr << "Parsed commands are cached, so a repeated command is not parsed again." << endl;
+  cerr << "The cache size is given by aipsrc variable taql.parsecache.size (default 64)." << endl;
+  cerr << endl;
   cerr << "taql can be started with a few options:" << endl;
   cerr << " -s or --style defines the TaQL style." << endl;
   cerr << "  The default style is python; if no value is given after -s it defaults to glish" << endl;